@@ -12,6 +12,7 @@
 #include <libgen.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include "resampler.h"
 /** Compile with gcc runner.c model.c -include model.h -O3 -o model  */
 
 #if defined(IMAI_API_QUEUE_TIME)
@@ -49,6 +50,12 @@
 #define API_DATA_IN_IS_QUANTIZED IMAI_DATA_IN_IS_QUANTIZED
 #define API_DATA_IN_QUANTIZE IMAI_DATA_IN_QUANTIZE
 
+#if defined(IMAI_DATA_IN_FREQUENCY)
+#define API_DATA_IN_SAMPLE_RATE IMAI_DATA_IN_FREQUENCY
+#else
+#define API_DATA_IN_SAMPLE_RATE (16000)
+#endif
+
 #ifndef API_QERROR_MAX
 #define API_QERROR_MAX 0
 #endif
@@ -225,6 +232,8 @@ typedef struct
 
     char* bounds_path;              // --output-bounds
     char* qerror_path;              // --output-qerror  
+
+    uint32_t sample_rate;           // --sample-rate <hz>
 } args_t;
 
 
@@ -346,6 +355,7 @@ ARGS_EXPORT void print_usage(char* argv0)
     printf("-inh, --input-no-header            Input file don't have a header row.\n");
     printf("-int, --input-no-timestamp         Input file don't have a timestamp column.\n");
     printf("-ihd, --input-has-duration         Input file have duration column.\n");
+    printf("-sr, --sample-rate <hz>            Resample wav input to given rate. Default is %d.\n", API_DATA_IN_SAMPLE_RATE);
     printf("\n");
     printf("-o, --output <file>                Write result to given file. Use - for stdout.\n");
     printf("-of, --output-format <type>        Output file format. One of: csv, wav, npy. Default is csv.\n");
@@ -381,7 +391,7 @@ ARGS_EXPORT void print_usage(char* argv0)
         "                                   Only relevant when --batch-write is not given. \n"
         "                                   The second column is output file and will be overwritten.\n");
 #ifdef API_QBOUNDS
-    printf("-oq, --output-bounds <file>        Save quantization bounds file (.b).\n");
+    printf("-ob, --output-bounds <file>        Save quantization bounds file (.b).\n");
 #endif
 
 #ifdef API_QERROR
@@ -425,6 +435,8 @@ ARGS_EXPORT void parse_args(int argc, char* argv[], args_t* arg)
     arg->bounds_path = NULL;
     arg->qerror_path = NULL;
 
+    arg->sample_rate = API_DATA_IN_SAMPLE_RATE;
+
     for (int i = 1; i < argc; i++) {
 
         // --help
@@ -732,6 +744,20 @@ ARGS_EXPORT void parse_args(int argc, char* argv[], args_t* arg)
             arg->batch_individual_test = true;
         }
 
+        // --sample-rate <hz>
+        else if (strcmp(argv[i], "-sr") == 0 || strcmp(argv[i], "--sample-rate") == 0) {
+            i++;
+            if (argc <= i) {
+                fprintf(stderr, "Option -sr missing rate argument\n");
+                exit(1);
+            }
+
+            if (sscanf(argv[i], "%u", &arg->sample_rate) != 1 || arg->sample_rate == 0) {
+                fprintf(stderr, "Unable to parse %s. Must be a positive integer.\n", argv[i]);
+                exit(1);
+            }
+        }
+
         // --write-separate-time
         else if (strcmp(argv[i], "-wst") == 0 || strcmp(argv[i], "--write-separate-time") == 0) {
             arg->write_separate_time = true;
@@ -2658,8 +2684,20 @@ typedef struct
 	double time;
 	int data_column_count;
 	convert_read_fn* convert_read;
+
+	// Resampling to out_frequency, one resampler per channel. NULL when the file rate is used.
+	uint32_t out_frequency;
+	resampler_t* resamplers;
+	int16_t* pending;			// Resampled frames, interleaved
+	size_t pending_count;
+	size_t pending_pos;
+	uint64_t frames_in;
+	uint64_t frames_out;
+	bool flushed;
 } wav_t;
 
+#define WAV_RESAMPLE_CHUNK (RESAMPLER_CHUNK)
+
 WAV_EXPORT wav_t* wav_open_read(char* path, int data_column_count, convert_read_fn* convert);
 
 WAV_EXPORT void wav_close(wav_t* wav);
@@ -2668,6 +2706,8 @@ WAV_EXPORT bool wav_can_read(wav_t* wav);
 
 WAV_EXPORT int wav_read_data(wav_t* wav, float* time, float* duration, void* target);
 
+WAV_EXPORT int wav_set_sample_rate(wav_t* wav, uint32_t frequency);
+
 IO_EXPORT io_t* io_open_read(
 	file_format_t format,
 	char* path,
@@ -3043,6 +3083,8 @@ void qbounds_f32(const float* restrict src, int count, int index);
 QBOUNDS_EXPORT void reset_qbounds(void);
 QBOUNDS_EXPORT int save_qbounds_file(char* file_path);
 
+// The last slot holds the range of the output features over every file of
+// the run, the input range of a model fed by this preprocessor
 static qbounds_t _qbounds[API_QBOUNDS_MAX + 1];
 
 void qbounds_f32(const float* restrict src, int count, int index)
@@ -3066,9 +3108,9 @@ void qbounds_f32(const float* restrict src, int count, int index)
 
 QBOUNDS_EXPORT void reset_qbounds(void)
 {
-    for (int i = 0; i < API_QBOUNDS_MAX; i++)
+    for (int i = 0; i <= API_QBOUNDS_MAX; i++)
     {
-        _qbounds[i].max = FLT_MIN;
+        _qbounds[i].max = -FLT_MAX;
         _qbounds[i].min = FLT_MAX;
     }
 }
@@ -3096,6 +3138,10 @@ QBOUNDS_EXPORT int save_qbounds_file(char* file_path)
 
         fprintf(output_file, "_K%i, %.20e, %.20e\n", i, param.min, param.max);
     }
+    if (_qbounds[API_QBOUNDS_MAX].min <= _qbounds[API_QBOUNDS_MAX].max)
+    {
+        fprintf(output_file, "features, %.20e, %.20e\n", _qbounds[API_QBOUNDS_MAX].min, _qbounds[API_QBOUNDS_MAX].max);
+    }
     fflush(output_file);
     fclose(output_file);
     return 0;
@@ -3403,6 +3449,14 @@ WAV_EXPORT wav_t* wav_open_read(char* path, int data_column_count, convert_read_
 	wav->time = 0;
 	wav->data_column_count = data_column_count;
 	wav->convert_read = convert;
+	wav->out_frequency = 0;
+	wav->resamplers = NULL;
+	wav->pending = NULL;
+	wav->pending_count = 0;
+	wav->pending_pos = 0;
+	wav->frames_in = 0;
+	wav->frames_out = 0;
+	wav->flushed = false;
 
 	if (path[0] == '-' && path[1] == '\0') {
 		wav->fd = stdin;
@@ -3513,6 +3567,8 @@ WAV_EXPORT void wav_close(wav_t* wav)
 	if(wav->fd != NULL && wav->fd != stdin && wav->fd != stdout && wav->fd != stderr)
 		fclose(wav->fd);
 
+	free(wav->resamplers);
+	free(wav->pending);
 	free(wav);
 }
 
@@ -3521,16 +3577,12 @@ WAV_EXPORT bool wav_can_read(wav_t* wav)
 	return !feof(wav->fd);
 }
 
+// Reads one frame in the file format, scaled to -1.0 ... 1.0.
 // return 0 success
-WAV_EXPORT int wav_read_data(wav_t* wav, float* time, float* duration, void* target)
+static int wav_read_frame(wav_t* wav, double* values)
 {
 	int data_size = wav->data_column_count;
 
-	if (data_size != wav->fmt.channels) {
-		fprintf(stderr, "WAVE Read error. File has %i channels, but expected input is %i channels\n", wav->fmt.channels, data_size);
-		return -1;
-	}
-
 	for (int i = 0; i < data_size; i++) {
 		if (wav->fmt.format == 1 && wav->fmt.bps == 8)
 		{
@@ -3544,7 +3596,7 @@ WAV_EXPORT int wav_read_data(wav_t* wav, float* time, float* duration, void* tar
 					return -1;
 				}
 			}
-			wav->convert_read(target, i, ((float)value - 128) / 128.0);
+			values[i] = ((float)value - 128) / 128.0;
 		}
 		else if (wav->fmt.format == 1 && wav->fmt.bps == 16) {
 			int16_t value;
@@ -3557,7 +3609,7 @@ WAV_EXPORT int wav_read_data(wav_t* wav, float* time, float* duration, void* tar
 					return -1;
 				}
 			}
-			wav->convert_read(target, i, value / 32768.0);
+			values[i] = value / 32768.0;
 		}
 		else if (wav->fmt.format == 3 && wav->fmt.bps == 32) {
 			float value;
@@ -3570,7 +3622,7 @@ WAV_EXPORT int wav_read_data(wav_t* wav, float* time, float* duration, void* tar
 					return -1;
 				}
 			}
-			wav->convert_read(target, i, value);
+			values[i] = value;
 		}
 		else {
 			fprintf(stderr, "Unsupported format. Only 16 and 8 bit PCM and IeeeFloat are supported.");
@@ -3578,13 +3630,139 @@ WAV_EXPORT int wav_read_data(wav_t* wav, float* time, float* duration, void* tar
 		}
 	}
 
+	return 0;	// Success
+}
+
+// Refills wav->pending with the next resampled frames. Samples are resampled
+// in Q15, so float input is clipped to -1.0 ... 1.0.
+// return 0 success
+static int wav_resample_chunk(wav_t* wav)
+{
+	int channels = wav->data_column_count;
+	int16_t input[channels][WAV_RESAMPLE_CHUNK];
+	int16_t output[RESAMPLER_MAX_OUTPUT(WAV_RESAMPLE_CHUNK, 8000, 8000 * RESAMPLER_MAX_RATIO)];
+	double values[channels];
+	size_t frames = 0;
+	size_t produced = 0;
+	uint64_t total;
+
+	if (wav->flushed) {
+		return 1;	// EOF
+	}
+
+	while (frames < WAV_RESAMPLE_CHUNK) {
+		int ret = wav_read_frame(wav, values);
+		if (ret < 0) {
+			return ret;
+		}
+		if (ret > 0) {
+			break;
+		}
+		for (int c = 0; c < channels; c++) {
+			double v = round(values[c] * 32768.0);
+			input[c][frames] = (int16_t)(v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v));
+		}
+		frames++;
+	}
+
+	for (int c = 0; c < channels; c++) {
+		// At the end of the file, push the filter delay out with zeros
+		if (frames == 0) {
+			memset(input[c], 0, sizeof(input[c]));
+			produced = resampler_process(&wav->resamplers[c], input[c], RESAMPLER_TAPS / 2, output);
+		}
+		else {
+			produced = resampler_process(&wav->resamplers[c], input[c], frames, output);
+		}
+
+		for (size_t n = 0; n < produced; n++) {
+			wav->pending[n * channels + c] = output[n];
+		}
+	}
+
+	if (frames == 0) {
+		// Trim the flushed tail to the length of the input at the new rate
+		total = (wav->frames_in * wav->out_frequency + wav->fmt.frequency - 1) / wav->fmt.frequency;
+		produced = (wav->frames_out + produced > total) ? (size_t)(total - wav->frames_out) : produced;
+		wav->flushed = true;
+	}
+	wav->frames_in += frames;
+	wav->frames_out += produced;
+	wav->pending_count = produced;
+	wav->pending_pos = 0;
+
+	return 0;	// Success
+}
+
+// Resamples the input to frequency (samples per second) when it differs
+// from the rate of the file.
+// return 0 success
+WAV_EXPORT int wav_set_sample_rate(wav_t* wav, uint32_t frequency)
+{
+	if (frequency == 0 || frequency == wav->fmt.frequency) {
+		return 0;
+	}
+
+	wav->resamplers = malloc(wav->data_column_count * sizeof(resampler_t));
+	wav->pending = malloc(wav->data_column_count * RESAMPLER_MAX_OUTPUT(WAV_RESAMPLE_CHUNK, 8000, 8000 * RESAMPLER_MAX_RATIO) * sizeof(int16_t));
+	if (wav->resamplers == NULL || wav->pending == NULL) {
+		fprintf(stderr, "Memory allocation error.\n");
+		exit(1);
+	}
+
+	for (int c = 0; c < wav->data_column_count; c++) {
+		if (resampler_init(&wav->resamplers[c], wav->fmt.frequency, frequency) != 0) {
+			fprintf(stderr, "Unsupported resampling from %u Hz to %u Hz\n", wav->fmt.frequency, frequency);
+			return -1;
+		}
+	}
+	wav->out_frequency = frequency;
+
+	return 0;
+}
+
+// return 0 success
+WAV_EXPORT int wav_read_data(wav_t* wav, float* time, float* duration, void* target)
+{
+	int data_size = wav->data_column_count;
+	double frequency = wav->fmt.frequency;
+	double values[data_size];
+
+	if (data_size != wav->fmt.channels) {
+		fprintf(stderr, "WAVE Read error. File has %i channels, but expected input is %i channels\n", wav->fmt.channels, data_size);
+		return -1;
+	}
+
+	if (wav->resamplers != NULL) {
+		while (wav->pending_pos >= wav->pending_count) {
+			int ret = wav_resample_chunk(wav);
+			if (ret != 0) {
+				return ret;
+			}
+		}
+		for (int i = 0; i < data_size; i++) {
+			wav->convert_read(target, i, wav->pending[wav->pending_pos * data_size + i] / 32768.0);
+		}
+		wav->pending_pos++;
+		frequency = wav->out_frequency;
+	}
+	else {
+		int ret = wav_read_frame(wav, values);
+		if (ret != 0) {
+			return ret;
+		}
+		for (int i = 0; i < data_size; i++) {
+			wav->convert_read(target, i, values[i]);
+		}
+	}
+
 	if(time != NULL)
 		*time = (float)wav->time;
 
 	if(duration != NULL)
-		*duration = 1 / (double)wav->fmt.frequency;
+		*duration = 1 / frequency;
 
-	wav->time += 1 / (double)wav->fmt.frequency;
+	wav->time += 1 / frequency;
 
 	return 0;	// Success
 }
@@ -3709,6 +3887,16 @@ static void run_task(args_t* args, task_t* task, buffers_t* buf, global_stats_t*
         args->input_file_opt & FILE_DURATION,
         _data_read);
 
+    // Bring wav input to the rate the model was trained at
+    if (args->input_format == FORMAT_WAV && input_file != NULL) {
+        if (((wav_t*)input_file)->fmt.frequency != args->sample_rate && args->verbose) {
+            printf("Resampling %s from %u Hz to %u Hz\n", task->input_path, ((wav_t*)input_file)->fmt.frequency, args->sample_rate);
+        }
+        if (wav_set_sample_rate((wav_t*)input_file, args->sample_rate) != 0) {
+            exit(1);
+        }
+    }
+
     // Create expected file reader
     if (task->expected_path) {
         resolve_format(&args->expected_format, task->expected_path);
@@ -3841,6 +4029,10 @@ static void run_task(args_t* args, task_t* task, buffers_t* buf, global_stats_t*
             if (status != 0)
                 break;
 
+#ifdef API_QBOUNDS
+            qbounds_f32(buf->output_data, API_DATA_OUT_COUNT, API_QBOUNDS_MAX);
+#endif
+
             float time_out_start = min_f32(time_out_buf, API_TIME_OUT_COUNT);
             float time_out_duration = max_f32(time_out_buf, API_TIME_OUT_COUNT) - time_out_start;
 
@@ -3886,6 +4078,10 @@ static void run_task(args_t* args, task_t* task, buffers_t* buf, global_stats_t*
             if (status != 0)
                 break;
 
+#ifdef API_QBOUNDS
+            qbounds_f32(buf->output_data, API_DATA_OUT_COUNT, API_QBOUNDS_MAX);
+#endif
+
             if (output_file != NULL)
                 io_write_data(
                     output_file,
@@ -69,6 +69,18 @@
 #define MQTT_PUB_TOPIC                    "SmartListener"
 #define MQTT_SUB_TOPIC                    "ledstatus"
 
+/* Companion topic of MQTT_PUB_TOPIC carrying the pre-roll audio of confirmed
+ * events as binary IMA-ADPCM chunks (see event_clip.c). */
+#define MQTT_CLIP_TOPIC                   MQTT_PUB_TOPIC "/clip"
+
+/* Companion topic of MQTT_PUB_TOPIC carrying the periodic A-weighted sound
+ * level reports as compact JSON (see sound_level.c). */
+#define MQTT_LEVEL_TOPIC                  MQTT_PUB_TOPIC "/level"
+
+/* Companion topic of MQTT_PUB_TOPIC carrying the per-stage timing of the
+ * model pipeline when STAGE_PROFILER_ENABLE is set (see stage_profiler.c). */
+#define MQTT_PROFILE_TOPIC                MQTT_PUB_TOPIC "/profile"
+
 /* Set the QoS that is associated with the MQTT publish, and subscribe messages.
  * Valid choices are 0, 1, and 2. Other values should not be used in this macro.
  */
@@ -0,0 +1,300 @@
+/*
+ * arena_calibrate.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Sizes the tensor arena that models/model.c passes to mtb_init(). The size
+ * comes from the device: a build with MODEL_ARENA_LOG_ENABLE prints the
+ * arena bytes TFLM uses after AllocateTensors(), its tensor and node
+ * structures included, and --device takes that number. The margin, none by
+ * default, is rounded up to the tensor alignment. Without --device the arena
+ * keeps the whole SRAM budget.
+ *
+ * Every session also goes through models/model.c with the activity gate
+ * off, so every window runs the host interpreter, and two numbers are
+ * recorded: the bytes it plans its activations into and the highest byte
+ * any window wrote, from an arena painted before every run. The host
+ * interpreter keeps nothing else in the arena, so the device number must be
+ * at least their maximum. The header is written to models/model_arena.h,
+ * unless the size exceeds the SRAM budget: then nothing is written and the
+ * command fails. models/model.c does not build with an arena over the
+ * budget either, and IMAI_init() fails if TFLM reports more bytes than the
+ * arena has.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "commands.h"
+#include "sessions.h"
+#include "generator.h"
+#include "wav.h"
+#include "activity_gate.h"
+#include "mtb_ml_model.h"
+#include "models/model.h"
+#include "models/model_arena.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define DEFAULT_OUTPUT_FILE             "../source/models/model_arena.h"
+
+/* Percent added to the device measurement, which is exact for the TFLM
+ * build that printed it */
+#define DEFAULT_MARGIN_PERCENT          (0.0)
+
+/* Tensor alignment of TFLM */
+#define ARENA_ALIGNMENT                 (16)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    int peak;                       /* Larger of planned and written */
+    int planned;                    /* Bytes the host interpreter plans */
+    int written;                    /* Painted high-water mark */
+    int device;                     /* Arena bytes TFLM used on the device, 0 if not measured */
+    int size;                       /* Device bytes plus margin, aligned, or the budget */
+    size_t sessions;
+    size_t windows;
+} arena_calibration_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+static int write_header(const char *path, const arena_calibration_t *calibration, double margin, int budget);
+
+
+/*******************************************************************************
+* Function Name: arena_calibrate_main
+********************************************************************************
+* Summary:
+*    smartlistener_host arena-calibrate [--data DIR] [--pred DIR]
+*        [--device BYTES] [--margin PERCENT] [--budget BYTES]
+*        [--output FILE] [--check]
+*
+*******************************************************************************/
+int arena_calibrate_main(int argc, char *argv[])
+{
+    const char *data_dir = SESSION_DEFAULT_DATA_DIR;
+    const char *pred_dir = SESSION_DEFAULT_PRED_DIR;
+    const char *output_path = DEFAULT_OUTPUT_FILE;
+    double margin = DEFAULT_MARGIN_PERCENT;
+    int budget = MODEL_ARENA_BUDGET;
+    int device = 0;
+    int check = 0;
+    activity_gate_config_t config;
+    arena_calibration_t calibration;
+    int result = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--data") == 0) && (i + 1 < argc))
+        {
+            data_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--pred") == 0) && (i + 1 < argc))
+        {
+            pred_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--device") == 0) && (i + 1 < argc))
+        {
+            device = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--margin") == 0) && (i + 1 < argc))
+        {
+            margin = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--budget") == 0) && (i + 1 < argc))
+        {
+            budget = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+        {
+            output_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--check") == 0)
+        {
+            check = 1;
+        }
+        else
+        {
+            budget = 0;
+            break;
+        }
+    }
+    if ((margin < 0.0) || (budget <= 0) || (device < 0))
+    {
+        fprintf(stderr, "usage: smartlistener_host arena-calibrate [--data DIR] [--pred DIR] [--device BYTES] "
+                        "[--margin PERCENT] [--budget BYTES] [--output FILE] [--check]\n");
+        return 1;
+    }
+
+    activity_gate_get_config(&config);
+    config.enabled = 0;
+    activity_gate_set_config(&config);
+    activity_gate_init();
+
+    memset(&calibration, 0, sizeof(calibration));
+    calibration.device = device;
+    if ((IMAI_init() != IMAI_RET_SUCCESS) && (mtb_ml_model_host_bin() != NULL))
+    {
+        /* A new model whose activations alone do not fit the current arena */
+        calibration.planned = mtb_ml_model_host_arena_needed();
+        printf("Arena:                     %d bytes are too small, the interpreter plans %d\n", MODEL_ARENA_SIZE,
+               calibration.planned);
+    }
+    else if (mtb_ml_model_host_object() == NULL)
+    {
+        /* MODEL_STREAMING_ENABLE and MODEL_INT8_ENABLE have no arena */
+        fprintf(stderr, "The interpreter is not used by this build\n");
+        return 1;
+    }
+    else
+    {
+        mtb_ml_model_host_watch_arena(1);
+        if (session_walk(data_dir, pred_dir, 1, run_session, &calibration) < 0)
+        {
+            mtb_ml_model_host_watch_arena(0);
+            IMAI_finalize();
+            return 1;
+        }
+        mtb_ml_model_host_watch_arena(0);
+        calibration.planned = mtb_ml_model_host_arena_needed();
+        calibration.written = mtb_ml_model_host_arena_high_water();
+        IMAI_finalize();
+        if (calibration.windows == 0)
+        {
+            fprintf(stderr, "No session could be run\n");
+            return 1;
+        }
+        printf("Corpus:                    %zu sessions, %zu windows\n", calibration.sessions, calibration.windows);
+    }
+
+    calibration.peak = (calibration.written > calibration.planned) ? calibration.written : calibration.planned;
+    printf("Host peak:                 %d bytes (planned %d, written %d)\n", calibration.peak, calibration.planned,
+           calibration.written);
+    if (calibration.device > 0)
+    {
+        calibration.size = (int)((double)calibration.device * (1.0 + margin / 100.0) + 0.5);
+        calibration.size = (calibration.size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+        printf("Arena:                     %d bytes, %d used on the device with a %.1f %% margin, was %d, "
+               "budget %d\n", calibration.size, calibration.device, margin, MODEL_ARENA_SIZE, budget);
+    }
+    else
+    {
+        /* Nothing measured on the device, keep the whole budget */
+        calibration.size = budget;
+        printf("Arena:                     %d bytes, the budget, not measured on the device, was %d\n",
+               calibration.size, MODEL_ARENA_SIZE);
+    }
+
+    if ((calibration.device > 0) && (calibration.device < calibration.peak))
+    {
+        /* TFLM needs at least the activations, the number is from another model */
+        printf("The device used fewer bytes than the host interpreter plans, rebuild with MODEL_ARENA_LOG_ENABLE\n");
+        result = 1;
+    }
+    else if (calibration.size > budget)
+    {
+        printf("The arena exceeds the budget by %d bytes\n", calibration.size - budget);
+        result = 1;
+    }
+    else if (check)
+    {
+        /* The arena of the build must hold what was measured */
+        if (((calibration.device > 0) && (calibration.size > MODEL_ARENA_SIZE)) ||
+            (calibration.peak > MODEL_ARENA_SIZE))
+        {
+            printf("models/model_arena.h is too small, run arena-calibrate\n");
+            result = 1;
+        }
+    }
+    else if (write_header(output_path, &calibration, margin, budget) != 0)
+    {
+        result = 1;
+    }
+    else
+    {
+        printf("Written:                   %s, %+d bytes of RAM, rebuild to apply\n", output_path,
+               calibration.size - MODEL_ARENA_SIZE);
+    }
+    /* The activations did not fit, no window ran */
+    if (calibration.windows == 0)
+    {
+        result = 1;
+    }
+    printf("Result:                    %s\n", (result == 0) ? "PASS" : "FAIL");
+    return result;
+}
+
+
+/* Plays one recording at unit gain, like model-eval, and counts the windows */
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    arena_calibration_t *calibration = context;
+    size_t windows;
+
+    (void) session;
+    (void) index;
+    if (session_play(wav, 1.0f, NULL, NULL, &windows) == 0)
+    {
+        calibration->sessions++;
+        calibration->windows += windows;
+    }
+}
+
+
+/* models/model_arena.h */
+static int write_header(const char *path, const arena_calibration_t *calibration, double margin, int budget)
+{
+    FILE *file = generator_open(path);
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+    fprintf(file, "/*\n"
+                  " * model_arena.h\n"
+                  " *\n"
+                  " * Generated by smartlistener_host arena-calibrate from the windows of %zu sessions.\n"
+                  " * Any changes will be lost.\n"
+                  " *\n"
+                  " * Arena     Bytes\n"
+                  " * Host      %d (planned %d, written %d)\n", calibration->sessions, calibration->peak,
+                  calibration->planned, calibration->written);
+    if (calibration->device > 0)
+    {
+        fprintf(file, " * Device    %d (TFLM after AllocateTensors())\n"
+                      " * Margin    %.1f %%\n", calibration->device, margin);
+    }
+    else
+    {
+        fprintf(file, " * Device    not measured, build with MODEL_ARENA_LOG_ENABLE and pass --device\n");
+    }
+    fprintf(file, " * Size      %d\n"
+                  " * Budget    %d\n"
+                  " */\n\n", calibration->size, budget);
+    fprintf(file, "#ifndef SOURCE_MODELS_MODEL_ARENA_H_\n"
+                  "#define SOURCE_MODELS_MODEL_ARENA_H_\n\n"
+                  "/* Tensor arena of the interpreter, passed to mtb_init() */\n"
+                  "#define MODEL_ARENA_SIZE                    (%d)\n\n"
+                  "/* Highest arena byte of the host interpreter over the corpus. TFLM also\n"
+                  " * keeps its tensor and node structures in the arena. */\n"
+                  "#define MODEL_ARENA_PEAK                    (%d)\n\n"
+                  "/* SRAM set aside for the arena, models/model.c does not build with more */\n"
+                  "#define MODEL_ARENA_BUDGET                  (%d)\n\n"
+                  "/* Set to 1 to print the arena bytes TFLM uses in IMAI_init(), the number\n"
+                  " * arena-calibrate --device takes */\n"
+                  "#ifndef MODEL_ARENA_LOG_ENABLE\n"
+                  "#define MODEL_ARENA_LOG_ENABLE              (0)\n"
+                  "#endif\n\n"
+                  "#endif /* SOURCE_MODELS_MODEL_ARENA_H_ */\n",
+                  calibration->size, calibration->peak, budget);
+    return generator_close(file, path);
+}
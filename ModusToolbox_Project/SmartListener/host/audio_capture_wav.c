@@ -0,0 +1,276 @@
+/*
+ * audio_capture_wav.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Host port of the capture engine. A producer thread plays the role of the
+ * PDM/PCM DMA: it copies one block of a WAV recording every block period
+ * (scaled by the replay speed) and calls audio_capture_on_block_complete(),
+ * so overruns happen exactly as they would on the device.
+ */
+
+#include "audio_capture_wav.h"
+#include "wav.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define NSEC_PER_SEC                    1000000000LL
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static wav_t replay_wav;
+static size_t replay_position;
+static long long replay_period_ns;
+
+static pthread_t producer_thread;
+static pthread_mutex_t capture_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t capture_cond = PTHREAD_COND_INITIALIZER;
+static int producer_running;
+static int block_signalled;
+static int stream_ended;
+
+/* Destination of the read in progress */
+static int16_t *pending_block;
+static size_t pending_count;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void *producer_main(void *arg);
+static void timespec_add_ns(struct timespec *ts, long long ns);
+
+
+/*******************************************************************************
+* Function Name: audio_capture_wav_open
+********************************************************************************
+* Summary:
+*    Selects the recording replayed by the host port. Must be called before
+*    audio_capture_init().
+*
+* Parameters:
+*    path           16-bit PCM WAV file. The first channel is used, the first
+*                   two with stereo capture.
+*    speed          Replay speed relative to real time (1.0 = real time)
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int audio_capture_wav_open(const char *path, float speed)
+{
+    if (wav_load(path, &replay_wav) != 0)
+    {
+        return -1;
+    }
+    if (replay_wav.sample_rate != SAMPLE_RATE_HZ)
+    {
+        fprintf(stderr, "'%s': sample rate %d Hz, expected %d Hz\n", path,
+            replay_wav.sample_rate, SAMPLE_RATE_HZ);
+    }
+    if (speed <= 0.0f)
+    {
+        speed = 1.0f;
+    }
+
+    replay_position = 0;
+    replay_period_ns = (long long)(AUDIO_CAPTURE_BLOCK_SIZE * (double)NSEC_PER_SEC / SAMPLE_RATE_HZ / speed);
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_wav_close
+********************************************************************************
+* Summary:
+*    Stops the producer thread and releases the recording.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void audio_capture_wav_close(void)
+{
+    pthread_mutex_lock(&capture_mutex);
+    stream_ended = 1;
+    pthread_cond_broadcast(&capture_cond);
+    pthread_mutex_unlock(&capture_mutex);
+
+    if (producer_running)
+    {
+        pthread_join(producer_thread, NULL);
+        producer_running = 0;
+    }
+    wav_free(&replay_wav);
+}
+
+
+/*******************************************************************************
+* Port implementation, see audio_capture.h
+*******************************************************************************/
+int audio_capture_port_init(void)
+{
+    block_signalled = 0;
+    stream_ended = 0;
+    pending_block = NULL;
+    return (replay_wav.samples != NULL) ? AUDIO_CAPTURE_SUCCESS : AUDIO_CAPTURE_ERROR;
+}
+
+
+int audio_capture_port_start(void)
+{
+    if (pthread_create(&producer_thread, NULL, producer_main, NULL) != 0)
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+    producer_running = 1;
+    return AUDIO_CAPTURE_SUCCESS;
+}
+
+
+int audio_capture_port_read_async(int16_t *block, size_t count)
+{
+    /* Only called by audio_capture.c, either before the producer starts or
+     * from the producer thread itself */
+    pending_block = block;
+    pending_count = count;
+    return AUDIO_CAPTURE_SUCCESS;
+}
+
+
+void audio_capture_port_notify(void)
+{
+    pthread_mutex_lock(&capture_mutex);
+    block_signalled = 1;
+    pthread_cond_signal(&capture_cond);
+    pthread_mutex_unlock(&capture_mutex);
+}
+
+
+int audio_capture_port_wait(uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    int result = AUDIO_CAPTURE_SUCCESS;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    timespec_add_ns(&deadline, (long long)timeout_ms * 1000000LL);
+
+    pthread_mutex_lock(&capture_mutex);
+    while (!block_signalled && !stream_ended)
+    {
+        if (timeout_ms == AUDIO_CAPTURE_WAIT_FOREVER)
+        {
+            pthread_cond_wait(&capture_cond, &capture_mutex);
+        }
+        else if (pthread_cond_timedwait(&capture_cond, &capture_mutex, &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+
+    if (block_signalled)
+    {
+        block_signalled = 0;
+    }
+    else if (stream_ended)
+    {
+        result = AUDIO_CAPTURE_STREAMEND;
+    }
+    else
+    {
+        result = AUDIO_CAPTURE_TIMEOUT;
+    }
+    pthread_mutex_unlock(&capture_mutex);
+    return result;
+}
+
+
+uint32_t audio_capture_port_lock(void)
+{
+    pthread_mutex_lock(&capture_mutex);
+    return 0;
+}
+
+
+void audio_capture_port_unlock(uint32_t state)
+{
+    (void) state;
+    pthread_mutex_unlock(&capture_mutex);
+}
+
+
+/*******************************************************************************
+* Function Name: producer_main
+********************************************************************************
+* Summary:
+*    Stand-in for the PDM/PCM DMA. Completes one block per block period until
+*    the recording is exhausted.
+*
+*******************************************************************************/
+static void *producer_main(void *arg)
+{
+    struct timespec next;
+    size_t i;
+    int ended;
+
+    (void) arg;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (replay_position + pending_count / AUDIO_CAPTURE_CHANNELS <= replay_wav.frames)
+    {
+        timespec_add_ns(&next, replay_period_ns);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+        {
+        }
+
+        pthread_mutex_lock(&capture_mutex);
+        ended = stream_ended;
+        pthread_mutex_unlock(&capture_mutex);
+        if (ended)
+        {
+            return NULL;
+        }
+
+        /* Stereo capture duplicates the channel of a mono recording */
+        for (i = 0; i < pending_count; i++)
+        {
+            size_t frame = replay_position + i / AUDIO_CAPTURE_CHANNELS;
+            int channel = (int)(i % AUDIO_CAPTURE_CHANNELS);
+
+            if (channel >= replay_wav.channels)
+            {
+                channel = replay_wav.channels - 1;
+            }
+            pending_block[i] = replay_wav.samples[frame * replay_wav.channels + channel];
+        }
+        replay_position += pending_count / AUDIO_CAPTURE_CHANNELS;
+
+        audio_capture_on_block_complete();
+    }
+
+    pthread_mutex_lock(&capture_mutex);
+    stream_ended = 1;
+    pthread_cond_broadcast(&capture_cond);
+    pthread_mutex_unlock(&capture_mutex);
+    return NULL;
+}
+
+
+static void timespec_add_ns(struct timespec *ts, long long ns)
+{
+    ns += ts->tv_nsec;
+    ts->tv_sec += ns / NSEC_PER_SEC;
+    ts->tv_nsec = ns % NSEC_PER_SEC;
+}
@@ -0,0 +1,21 @@
+/*
+ * audio_capture_wav.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef HOST_AUDIO_CAPTURE_WAV_H_
+#define HOST_AUDIO_CAPTURE_WAV_H_
+
+#include "audio_capture.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int audio_capture_wav_open(const char *path, float speed);
+void audio_capture_wav_close(void);
+
+
+#endif /* HOST_AUDIO_CAPTURE_WAV_H_ */
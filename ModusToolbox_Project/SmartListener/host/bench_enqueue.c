@@ -0,0 +1,280 @@
+/*
+ * bench_enqueue.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Micro-benchmark of the model input path. Feeds a recording once with the
+ * per-sample IMAI_enqueue()/IMAI_dequeue() pair (as ml_task.c used to) and
+ * once with IMAI_enqueue_block() on AUDIO_CAPTURE_BLOCK_SIZE blocks, and
+ * reports the call count and time per sample of both. The network runs in
+ * the reference interpreter and costs the same in both, so its time is also
+ * taken out to show the input path on its own.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_capture.h"
+#include "audio_ingest.h"
+#include "mtb_ml_model.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same gain as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint64_t calls;                 /* IMAI_* calls made */
+    uint64_t outputs;               /* Score vectors dequeued */
+    uint64_t elapsed_ns;
+    uint64_t input_ns;              /* Without the time in mtb_ml_model_run() */
+} bench_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static float *load_samples(const wav_t *wav);
+static int run_per_sample(const float *samples, size_t count, int repeat, bench_result_t *result);
+static int run_block(const float *samples, size_t count, int repeat, bench_result_t *result);
+static void input_time(bench_result_t *result);
+static void keep_fastest(bench_result_t *best, const bench_result_t *pass, int index);
+static void print_result(const char *name, const bench_result_t *result, size_t samples);
+
+
+/*******************************************************************************
+* Function Name: bench_enqueue_main
+********************************************************************************
+* Summary:
+*    smartlistener_host bench-enqueue <file.wav> [--repeat N]
+*
+*******************************************************************************/
+int bench_enqueue_main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    int repeat = 1;
+    wav_t wav;
+    float *samples;
+    bench_result_t per_sample;
+    bench_result_t block;
+    int passes = 0;
+    int status = 1;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if ((path == NULL) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host bench-enqueue <file.wav> [--repeat N]\n");
+        return 1;
+    }
+
+    if (wav_load(path, &wav) != 0)
+    {
+        return 1;
+    }
+    samples = load_samples(&wav);
+    if (samples == NULL)
+    {
+        wav_free(&wav);
+        return 1;
+    }
+
+    /* Passes alternate between the two, the fastest pass of each counts */
+    memset(&per_sample, 0, sizeof(per_sample));
+    memset(&block, 0, sizeof(block));
+    for (int r = 0; r < repeat; r++)
+    {
+        bench_result_t pass;
+
+        if (run_per_sample(samples, wav.frames, 1, &pass) != 0)
+        {
+            break;
+        }
+        keep_fastest(&per_sample, &pass, r);
+        if (run_block(samples, wav.frames, 1, &pass) != 0)
+        {
+            break;
+        }
+        keep_fastest(&block, &pass, r);
+        passes++;
+    }
+    if (passes == repeat)
+    {
+        print_result("IMAI_enqueue (per sample)", &per_sample, wav.frames);
+        print_result("IMAI_enqueue_block", &block, wav.frames);
+        printf("Speed-up:                  %.2fx, %.2fx without the network\n",
+            (double)per_sample.elapsed_ns / (double)block.elapsed_ns,
+            (double)per_sample.input_ns / (double)block.input_ns);
+
+        if (per_sample.outputs == block.outputs)
+        {
+            status = 0;
+        }
+        else
+        {
+            fprintf(stderr, "Output count mismatch: %llu vs %llu\n",
+                (unsigned long long)per_sample.outputs, (unsigned long long)block.outputs);
+        }
+    }
+
+    IMAI_finalize();
+    free(samples);
+    wav_free(&wav);
+    return status;
+}
+
+
+/* Converts channel 0 of the recording the same way ml_task.c does */
+static float *load_samples(const wav_t *wav)
+{
+    float *samples = malloc(wav->frames * sizeof(float));
+    int16_t *pcm = malloc(wav->frames * sizeof(int16_t));
+
+    if ((samples == NULL) || (pcm == NULL))
+    {
+        free(samples);
+        free(pcm);
+        return NULL;
+    }
+    for (size_t i = 0; i < wav->frames; i++)
+    {
+        pcm[i] = wav->samples[i * wav->channels];
+    }
+    audio_ingest_block(pcm, samples, wav->frames, DIGITAL_BOOST_FACTOR);
+    free(pcm);
+    return samples;
+}
+
+
+static int run_per_sample(const float *samples, size_t count, int repeat, bench_result_t *result)
+{
+    float scores[IMAI_DATA_OUT_COUNT];
+    uint64_t start;
+
+    memset(result, 0, sizeof(*result));
+    if (IMAI_init() != IMAI_RET_SUCCESS)
+    {
+        return -1;
+    }
+
+    start = host_now_ns();
+    for (int r = 0; r < repeat; r++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (IMAI_enqueue(&samples[i]) != IMAI_RET_SUCCESS)
+            {
+                return -1;
+            }
+            result->calls += 2;
+            switch (IMAI_dequeue(scores))
+            {
+                case IMAI_RET_SUCCESS:
+                    result->outputs++;
+                    break;
+                case IMAI_RET_NODATA:
+                    break;
+                default:
+                    return -1;
+            }
+        }
+    }
+    result->elapsed_ns = host_now_ns() - start;
+    input_time(result);
+    return 0;
+}
+
+
+static int run_block(const float *samples, size_t count, int repeat, bench_result_t *result)
+{
+    float scores[IMAI_DATA_OUT_COUNT];
+    uint64_t start;
+
+    memset(result, 0, sizeof(*result));
+    if (IMAI_init() != IMAI_RET_SUCCESS)
+    {
+        return -1;
+    }
+
+    start = host_now_ns();
+    for (int r = 0; r < repeat; r++)
+    {
+        for (size_t i = 0; i < count; i += AUDIO_CAPTURE_BLOCK_SIZE)
+        {
+            int n = (count - i < AUDIO_CAPTURE_BLOCK_SIZE) ? (int)(count - i) : AUDIO_CAPTURE_BLOCK_SIZE;
+            int ready = IMAI_enqueue_block(&samples[i], n);
+            if (ready < 0)
+            {
+                return -1;
+            }
+            result->calls++;
+            while (ready-- > 0)
+            {
+                if (IMAI_dequeue(scores) != IMAI_RET_SUCCESS)
+                {
+                    return -1;
+                }
+                result->calls++;
+                result->outputs++;
+            }
+        }
+    }
+    result->elapsed_ns = host_now_ns() - start;
+    input_time(result);
+    return 0;
+}
+
+
+/* IMAI_init() restarts the counters of the shim, no time without the interpreter */
+static void input_time(bench_result_t *result)
+{
+    uint64_t runs;
+    uint64_t model_ns;
+
+    mtb_ml_model_host_run_time(&runs, &model_ns);
+    result->input_ns = result->elapsed_ns - model_ns;
+}
+
+
+/* Calls and outputs of one pass, times of the fastest pass */
+static void keep_fastest(bench_result_t *best, const bench_result_t *pass, int index)
+{
+    if ((index == 0) || (pass->elapsed_ns < best->elapsed_ns))
+    {
+        best->elapsed_ns = pass->elapsed_ns;
+    }
+    if ((index == 0) || (pass->input_ns < best->input_ns))
+    {
+        best->input_ns = pass->input_ns;
+    }
+    best->calls = pass->calls;
+    best->outputs = pass->outputs;
+}
+
+
+static void print_result(const char *name, const bench_result_t *result, size_t samples)
+{
+    printf("%s\n", name);
+    printf("  Calls:                   %llu\n", (unsigned long long)result->calls);
+    printf("  Score vectors:           %llu\n", (unsigned long long)result->outputs);
+    printf("  Time per sample:         %.1f ns, %.1f ns without the network\n",
+        (double)result->elapsed_ns / (double)samples, (double)result->input_ns / (double)samples);
+}
@@ -0,0 +1,183 @@
+/*
+ * bench_features.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Bytes moved, cycles and RAM of the feature history between the front-end
+ * and the model. The copying layout that model.c used before (a ring of 50
+ * log-mel frames, cbuffer_copyto() of the whole 50x30 window into the model
+ * input buffer every 6 frames) runs next to the current one (mirrored ring,
+ * every frame written twice, the model reads the window in place). Both get
+ * the same frames and must hand the model the same 1500 floats.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "commands.h"
+#include "bench_ring.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same shape as the model input */
+#define MEL_BANDS                       (30)
+#define WINDOW_FRAMES                   (50)
+#define STRIDE_FRAMES                   (6)
+#define FRAME_BYTES                     (MEL_BANDS * sizeof(float))
+#define WINDOW_BYTES                    (WINDOW_FRAMES * FRAME_BYTES)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint64_t bytes;                 /* Bytes copied, frames and windows */
+    uint64_t cycles;
+    uint64_t inferences;
+    size_t ram;                     /* Ring plus model input buffer */
+} feature_result_t;
+
+static uint8_t ring_memory[WINDOW_BYTES];
+static uint8_t mirror_memory[2 * WINDOW_BYTES];
+static float model_input[WINDOW_FRAMES * MEL_BANDS];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static const float *window_copying(bench_ring_t *ring, feature_result_t *result);
+static const float *window_inplace(bench_ring_t *ring);
+
+
+/*******************************************************************************
+* Function Name: bench_features_main
+********************************************************************************
+* Summary:
+*    smartlistener_host bench-features [--frames N] [--repeat N]
+*
+*******************************************************************************/
+int bench_features_main(int argc, char *argv[])
+{
+    int frames = 3000;
+    int repeat = 1;
+    float *features;
+    feature_result_t before = { 0, 0, 0, sizeof(ring_memory) + sizeof(model_input) };
+    feature_result_t after = { 0, 0, 0, sizeof(mirror_memory) };
+    uint64_t mismatches = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc))
+        {
+            frames = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host bench-features [--frames N] [--repeat N]\n");
+            return 1;
+        }
+    }
+    if ((frames < WINDOW_FRAMES) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host bench-features [--frames N] [--repeat N]\n");
+        return 1;
+    }
+
+    /* Log-mel like values, their content does not matter for the copies */
+    features = malloc((size_t)frames * FRAME_BYTES);
+    if (features == NULL)
+    {
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < frames * MEL_BANDS; i++)
+    {
+        features[i] = -8.0f + 10.0f * (float)rand() / RAND_MAX;
+    }
+
+    for (int r = 0; r < repeat; r++)
+    {
+        bench_ring_t ring;
+        bench_ring_t mirror;
+
+        bench_ring_init(&ring, ring_memory, WINDOW_BYTES, 0);
+        bench_ring_init(&mirror, mirror_memory, WINDOW_BYTES, 1);
+
+        /* Like _IMAI_process_block(): one frame in, a window out every 6 frames */
+        for (int f = 0; f < frames; f++)
+        {
+            const float *frame = &features[f * MEL_BANDS];
+            const float *window[2] = { NULL, NULL };
+            uint64_t c0;
+
+            c0 = read_cycles();
+            /* The ring holds whole frames, cbuffer_enqueue() */
+            before.bytes += bench_ring_write(&ring, frame, FRAME_BYTES);
+            if (ring.used >= (int)WINDOW_BYTES)
+            {
+                window[0] = window_copying(&ring, &before);
+            }
+            before.cycles += read_cycles() - c0;
+
+            c0 = read_cycles();
+            /* cbuffer_enqueue_mirrored() writes every frame twice */
+            after.bytes += bench_ring_write(&mirror, frame, FRAME_BYTES);
+            if (mirror.used >= (int)WINDOW_BYTES)
+            {
+                window[1] = window_inplace(&mirror);
+            }
+            after.cycles += read_cycles() - c0;
+
+            if ((window[0] != NULL) != (window[1] != NULL))
+            {
+                mismatches++;
+            }
+            else if (window[0] != NULL)
+            {
+                if (memcmp(window[0], window[1], WINDOW_BYTES) != 0)
+                {
+                    mismatches++;
+                }
+                before.inferences++;
+                after.inferences++;
+            }
+        }
+    }
+
+    printf("Frames:                    %d x %d\n", frames, repeat);
+    printf("Inferences:                %llu\n", (unsigned long long)before.inferences);
+    printf("Copying layout:            %6.0f bytes/inference, %6.0f cycles/inference, %zu bytes RAM\n",
+        (double)before.bytes / before.inferences, (double)before.cycles / before.inferences, before.ram);
+    printf("Mirrored in-place layout:  %6.0f bytes/inference, %6.0f cycles/inference, %zu bytes RAM\n",
+        (double)after.bytes / after.inferences, (double)after.cycles / after.inferences, after.ram);
+    printf("Model input:               %llu of %llu windows differ (%s)\n",
+        (unsigned long long)mismatches, (unsigned long long)before.inferences, (mismatches == 0) ? "PASS" : "FAIL");
+
+    free(features);
+    return (mismatches == 0) ? 0 : 1;
+}
+
+
+/* fixwin_dequeue(): cbuffer_copyto() of the whole window into the model input */
+static const float *window_copying(bench_ring_t *ring, feature_result_t *result)
+{
+    result->bytes += bench_ring_copy(ring, model_input, WINDOW_BYTES);
+    bench_ring_consume(ring, STRIDE_FRAMES * FRAME_BYTES);
+    return model_input;
+}
+
+
+/* fixwin_dequeue_inplace() */
+static const float *window_inplace(bench_ring_t *ring)
+{
+    const float *window = (const float *)&ring->buf[ring->read];
+
+    bench_ring_consume(ring, STRIDE_FRAMES * FRAME_BYTES);
+    return window;
+}
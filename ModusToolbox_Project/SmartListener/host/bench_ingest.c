@@ -0,0 +1,179 @@
+/*
+ * bench_ingest.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Compares the per-sample normalise/boost/clamp loop ml_task.c used to run
+ * with audio_ingest_block() on AUDIO_CAPTURE_BLOCK_SIZE blocks of a
+ * recording. Reports cycles (time stamp counter on x86) and time per block
+ * and checks that both produce the same samples and peak level.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_capture.h"
+#include "audio_ingest.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define SAMPLE_NORMALIZE(sample)        (((float) (sample)) / (float) (1 << (AUIDO_BITS_PER_SAMPLE - 1)))
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static float ingest_reference(const int16_t *src, float *dst, float *sample_max_slow);
+
+
+/*******************************************************************************
+* Function Name: bench_ingest_main
+********************************************************************************
+* Summary:
+*    smartlistener_host bench-ingest <file.wav> [--repeat N]
+*
+*******************************************************************************/
+int bench_ingest_main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    int repeat = 1;
+    wav_t wav;
+    int16_t *pcm;
+    size_t blocks;
+    float ref[AUDIO_CAPTURE_BLOCK_SIZE];
+    float out[AUDIO_CAPTURE_BLOCK_SIZE];
+    float slow_ref = 0.0f;
+    float slow_new = 0.0f;
+    uint64_t ref_cycles = 0, new_cycles = 0;
+    uint64_t ref_ns = 0, new_ns = 0;
+    size_t mismatches = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if ((path == NULL) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host bench-ingest <file.wav> [--repeat N]\n");
+        return 1;
+    }
+
+    if (wav_load(path, &wav) != 0)
+    {
+        return 1;
+    }
+    blocks = wav.frames / AUDIO_CAPTURE_BLOCK_SIZE;
+    if (blocks == 0)
+    {
+        fprintf(stderr, "Recording is shorter than one block\n");
+        wav_free(&wav);
+        return 1;
+    }
+
+    /* Channel 0 only, as captured on the device */
+    pcm = malloc(blocks * AUDIO_CAPTURE_BLOCK_SIZE * sizeof(int16_t));
+    if (pcm == NULL)
+    {
+        wav_free(&wav);
+        return 1;
+    }
+    for (size_t i = 0; i < blocks * AUDIO_CAPTURE_BLOCK_SIZE; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+
+    for (int r = 0; r < repeat; r++)
+    {
+        for (size_t b = 0; b < blocks; b++)
+        {
+            const int16_t *block = &pcm[b * AUDIO_CAPTURE_BLOCK_SIZE];
+            uint64_t t0, c0;
+            float peak_ref, peak_new;
+
+            t0 = host_now_ns();
+            c0 = read_cycles();
+            peak_ref = ingest_reference(block, ref, &slow_ref);
+            ref_cycles += read_cycles() - c0;
+            ref_ns += host_now_ns() - t0;
+
+            t0 = host_now_ns();
+            c0 = read_cycles();
+            peak_new = audio_ingest_block(block, out, AUDIO_CAPTURE_BLOCK_SIZE, DIGITAL_BOOST_FACTOR);
+            slow_new -= 0.0005f;
+            if (peak_new > slow_new)
+            {
+                slow_new = peak_new;
+            }
+            new_cycles += read_cycles() - c0;
+            new_ns += host_now_ns() - t0;
+
+            if ((memcmp(ref, out, sizeof(out)) != 0) || (peak_ref != peak_new) || (slow_ref != slow_new))
+            {
+                mismatches++;
+            }
+        }
+    }
+
+    blocks *= repeat;
+    printf("Blocks:                    %zu x %d samples\n", blocks, AUDIO_CAPTURE_BLOCK_SIZE);
+    printf("Per-sample loop:           %.0f cycles/block  %.2f us/block\n",
+        (double)ref_cycles / blocks, (double)ref_ns / blocks / 1000.0);
+    printf("audio_ingest_block:        %.0f cycles/block  %.2f us/block\n",
+        (double)new_cycles / blocks, (double)new_ns / blocks / 1000.0);
+    printf("Speed-up:                  %.2fx\n", (double)ref_cycles / (double)new_cycles);
+    printf("Mismatching blocks:        %zu\n", mismatches);
+
+    free(pcm);
+    wav_free(&wav);
+    return (mismatches == 0) ? 0 : 1;
+}
+
+
+/* The loop ml_task.c ran before audio_ingest_block(), kept as the reference */
+static float ingest_reference(const int16_t *src, float *dst, float *sample_max_slow)
+{
+    float sample;
+    float sample_abs;
+    float sample_max = 0;
+
+    *sample_max_slow -= 0.0005;
+    for (int i = 0; i < AUDIO_CAPTURE_BLOCK_SIZE; i++)
+    {
+        sample = SAMPLE_NORMALIZE(src[i]) * DIGITAL_BOOST_FACTOR;
+        if (sample > 1.0)
+        {
+            sample = 1.0;
+        }
+        else if (sample < -1.0)
+        {
+            sample = -1.0;
+        }
+        dst[i] = sample;
+
+        sample_abs = fabs(sample);
+        if (sample_abs > sample_max)
+        {
+            sample_max = sample_abs;
+        }
+        if (sample_max > *sample_max_slow)
+        {
+            *sample_max_slow = sample_max;
+        }
+    }
+    return sample_max;
+}
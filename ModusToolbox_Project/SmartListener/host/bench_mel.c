@@ -0,0 +1,189 @@
+/*
+ * bench_mel.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Cycles per frame of the model front-end after the FFT, mel_log_f32() of
+ * source/mel_log.c, on the FFT output of every hop of a recording. The
+ * arm_cmplx_mag_f32(), mel dot product and arm_clip_f32() / arm_vlog_f32()
+ * passes are also timed one by one, and their result must be bit-identical
+ * to mel_log_f32().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "mel_log.h"
+#include "frontend.h"
+#include "arm_math.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c and the model front-end */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define WINDOW_LEN                      (512)
+#define FRAME_HOP                       (320)
+#define SPECTRUM_BINS                   (WINDOW_LEN / 2 + 1)
+#define MEL_BANDS                       (30)
+#define MEL_FLOOR                       (0.00031f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Cycles of each pass of mel_log_f32() */
+typedef struct {
+    uint64_t total;
+    uint64_t magnitude;
+    uint64_t mel;
+    uint64_t clip_log;
+} mel_cycles_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void mel_passes(const float *spectrum, const int16_t *points, const float *coefs,
+                       float *output, mel_cycles_t *cycles);
+
+
+/*******************************************************************************
+* Function Name: bench_mel_main
+********************************************************************************
+* Summary:
+*    smartlistener_host bench-mel <file.wav> [--repeat N]
+*
+*******************************************************************************/
+int bench_mel_main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    int repeat = 1;
+    wav_t wav;
+    float *samples;
+    int16_t *pcm;
+    arm_rfft_fast_instance_f32 rfft;
+    const float *hann = frontend_window();
+    const int16_t *filter_points = frontend_filter_points();
+    const float *filter_coefs = frontend_filter_coefs();
+    float windowed[WINDOW_LEN];
+    float spectrum[WINDOW_LEN];
+    float scratch[SPECTRUM_BINS];
+    float reference[MEL_BANDS];
+    float output[MEL_BANDS];
+    mel_cycles_t cycles = { 0 };
+    uint64_t frames = 0;
+    uint64_t mismatches = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if ((path == NULL) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host bench-mel <file.wav> [--repeat N]\n");
+        return 1;
+    }
+    if (wav_load(path, &wav) != 0)
+    {
+        return 1;
+    }
+
+    /* Channel 0, converted the same way ml_task.c does */
+    samples = malloc(wav.frames * sizeof(float));
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    if ((samples == NULL) || (pcm == NULL) || (wav.frames < WINDOW_LEN))
+    {
+        fprintf(stderr, "Recording is shorter than one window\n");
+        free(samples);
+        free(pcm);
+        wav_free(&wav);
+        return 1;
+    }
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+    audio_ingest_block(pcm, samples, wav.frames, DIGITAL_BOOST_FACTOR);
+
+    arm_rfft_fast_init_f32(&rfft, WINDOW_LEN);
+
+    for (int r = 0; r < repeat; r++)
+    {
+        for (size_t start = 0; start + WINDOW_LEN <= wav.frames; start += FRAME_HOP)
+        {
+            uint64_t c0;
+
+            arm_mult_f32(&samples[start], hann, windowed, WINDOW_LEN);
+            arm_rfft_fast_f32(&rfft, windowed, spectrum, 0);
+
+            c0 = read_cycles();
+            mel_log_f32(spectrum, scratch, WINDOW_LEN, filter_points, filter_coefs, MEL_BANDS, MEL_FLOOR, reference);
+            cycles.total += read_cycles() - c0;
+
+            mel_passes(spectrum, filter_points, filter_coefs, output, &cycles);
+            if (memcmp(output, reference, sizeof(output)) != 0)
+            {
+                mismatches++;
+            }
+            frames++;
+        }
+    }
+
+    printf("Recording:                 %s\n", path);
+    printf("Frames:                    %llu\n", (unsigned long long)frames);
+    printf("mel_log_f32():             %6.0f cycles/frame\n", (double)cycles.total / frames);
+    printf("  arm_cmplx_mag_f32():     %6.0f cycles/frame\n", (double)cycles.magnitude / frames);
+    printf("  mel dot products:        %6.0f cycles/frame\n", (double)cycles.mel / frames);
+    printf("  clip and log:            %6.0f cycles/frame\n", (double)cycles.clip_log / frames);
+    printf("Result:                    %s (%llu frames differ)\n", (mismatches == 0) ? "PASS" : "FAIL",
+        (unsigned long long)mismatches);
+
+    free(samples);
+    free(pcm);
+    wav_free(&wav);
+    return (mismatches == 0) ? 0 : 1;
+}
+
+
+/* The passes of mel_log_f32(), timed one by one */
+static void mel_passes(const float *spectrum, const int16_t *points, const float *coefs,
+                       float *output, mel_cycles_t *cycles)
+{
+    static float magnitude[SPECTRUM_BINS];
+    uint64_t c0;
+
+    c0 = read_cycles();
+    magnitude[0] = fabsf(spectrum[0]);
+    magnitude[WINDOW_LEN / 2] = fabsf(spectrum[1]);
+    arm_cmplx_mag_f32(&spectrum[2], &magnitude[1], WINDOW_LEN / 2 - 1);
+    cycles->magnitude += read_cycles() - c0;
+
+    c0 = read_cycles();
+    for (int i = 0; i < MEL_BANDS; i++)
+    {
+        int len = points[i + 2] - points[i] + 1;
+
+        arm_dot_prod_f32(&magnitude[points[i]], coefs, len, &output[i]);
+        coefs += len;
+    }
+    cycles->mel += read_cycles() - c0;
+
+    c0 = read_cycles();
+    arm_clip_f32(output, output, MEL_FLOOR, FLT_MAX, MEL_BANDS);
+    arm_vlog_f32(output, output, MEL_BANDS);
+    cycles->clip_log += read_cycles() - c0;
+}
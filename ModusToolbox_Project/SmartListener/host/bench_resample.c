@@ -0,0 +1,176 @@
+/*
+ * bench_resample.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Quality and throughput of the polyphase resampler (resampler.c) for the
+ * capture rates it is meant for. For each input rate a passband tone is
+ * resampled to 16 kHz and compared with the ideal tone (SNR), a tone above
+ * 8 kHz checks the anti-aliasing of the downsampling rates, and a longer
+ * signal is timed in blocks of AUDIO_CAPTURE_BLOCK_SIZE samples.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "audio_capture.h"
+#include "resampler.h"
+#include "tone.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define TARGET_RATE_HZ                  (16000)
+#define TEST_SECONDS                    (2)
+#define TONE_AMPLITUDE                  (16384.0)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static size_t resample_signal(resampler_t *resampler, const int16_t *src, size_t count, int16_t *dst);
+static double rms_db(const int16_t *y, size_t count);
+
+
+/*******************************************************************************
+* Function Name: bench_resample_main
+********************************************************************************
+* Summary:
+*    smartlistener_host bench-resample [--repeat N]
+*
+*******************************************************************************/
+int bench_resample_main(int argc, char *argv[])
+{
+    static const uint32_t rates[] = { 8000, 22050, 32000, 44100, 48000 };
+    static resampler_t resampler;
+    int repeat = 20;
+    int ok = 1;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host bench-resample [--repeat N]\n");
+            return 1;
+        }
+    }
+    if (repeat < 1)
+    {
+        repeat = 1;
+    }
+
+    printf("Polyphase resampler to %d Hz, %d taps x %d phases (Q14)\n\n", TARGET_RATE_HZ,
+        RESAMPLER_TAPS, RESAMPLER_PHASES);
+    printf("%8s %12s %12s %14s %14s %12s\n", "input", "SNR 1 kHz", "SNR 3 kHz", "alias 12 kHz",
+        "Msamples/s", "ns/output");
+
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+    {
+        uint32_t rate = rates[r];
+        size_t count = (size_t)rate * TEST_SECONDS;
+        int16_t *src = malloc(count * sizeof(int16_t));
+        int16_t *dst = malloc(RESAMPLER_MAX_OUTPUT(count, rate, TARGET_RATE_HZ) * sizeof(int16_t));
+        double snr[2];
+        double alias = NAN;
+        size_t produced = 0;
+        uint64_t start;
+        double seconds;
+
+        if ((src == NULL) || (dst == NULL) || (resampler_init(&resampler, rate, TARGET_RATE_HZ) != 0))
+        {
+            fprintf(stderr, "Resampler setup failed for %lu Hz\n", (unsigned long)rate);
+            free(src);
+            free(dst);
+            return 1;
+        }
+
+        for (int t = 0; t < 2; t++)
+        {
+            double frequency = (t == 0) ? 1000.0 : 3000.0;
+
+            tone_fill(src, 0, count, frequency, TONE_AMPLITUDE, rate);
+            resampler_reset(&resampler);
+            produced = resample_signal(&resampler, src, count, dst);
+            /* Output n is the input signal at time n / TARGET_RATE_HZ. The first and
+             * last RESAMPLER_TAPS outputs see the zero history and are skipped. */
+            snr[t] = tone_snr_db(dst, RESAMPLER_TAPS, produced - 2 * RESAMPLER_TAPS, frequency, TONE_AMPLITUDE,
+                                 TARGET_RATE_HZ);
+        }
+
+        /* Only rates with content above 8 kHz can alias */
+        if (rate > 2 * 12000)
+        {
+            tone_fill(src, 0, count, 12000.0, TONE_AMPLITUDE, rate);
+            resampler_reset(&resampler);
+            produced = resample_signal(&resampler, src, count, dst);
+            alias = rms_db(&dst[RESAMPLER_TAPS], produced - RESAMPLER_TAPS) - 20.0 * log10(TONE_AMPLITUDE / sqrt(2.0));
+        }
+
+        start = host_now_ns();
+        produced = 0;
+        for (int i = 0; i < repeat; i++)
+        {
+            produced += resample_signal(&resampler, src, count, dst);
+        }
+        seconds = (host_now_ns() - start) / 1e9;
+
+        if (isnan(alias))
+        {
+            printf("%6.2fk %9.1f dB %9.1f dB %14s %14.1f %12.1f\n", rate / 1000.0, snr[0], snr[1], "-",
+                (double)count * repeat / seconds / 1e6, seconds * 1e9 / produced);
+        }
+        else
+        {
+            printf("%6.2fk %9.1f dB %9.1f dB %11.1f dB %14.1f %12.1f\n", rate / 1000.0, snr[0], snr[1], alias,
+                (double)count * repeat / seconds / 1e6, seconds * 1e9 / produced);
+        }
+
+        if ((snr[0] < 60.0) || (snr[1] < 60.0) || (!isnan(alias) && (alias > -60.0)))
+        {
+            ok = 0;
+        }
+        free(src);
+        free(dst);
+    }
+
+    printf("\nResult:                    %s (passband SNR >= 60 dB, aliasing <= -60 dB)\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+
+/* Feeds the signal in capture blocks, as ml_task.c does */
+static size_t resample_signal(resampler_t *resampler, const int16_t *src, size_t count, int16_t *dst)
+{
+    size_t produced = 0;
+
+    for (size_t i = 0; i < count; i += AUDIO_CAPTURE_BLOCK_SIZE)
+    {
+        size_t n = (count - i < AUDIO_CAPTURE_BLOCK_SIZE) ? count - i : AUDIO_CAPTURE_BLOCK_SIZE;
+        produced += resampler_process(resampler, &src[i], n, &dst[produced]);
+    }
+    return produced;
+}
+
+
+static double rms_db(const int16_t *y, size_t count)
+{
+    double sum = 0.0;
+
+    for (size_t n = 0; n < count; n++)
+    {
+        sum += (double)y[n] * y[n];
+    }
+    return 10.0 * log10(sum / count + 1e-9);
+}
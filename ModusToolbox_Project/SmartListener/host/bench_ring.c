@@ -0,0 +1,117 @@
+/*
+ * bench_ring.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * The circular buffers of the model front-end as bench-features and
+ * bench-window replay them: cbuffer_enqueue() and cbuffer_copyto() of the
+ * copying layout, and cbuffer_enqueue_mirrored() of the layout the model
+ * reads in place.
+ */
+
+#include "bench_ring.h"
+
+#include <string.h>
+
+
+/*******************************************************************************
+* Function Name: bench_ring_init
+********************************************************************************
+* Summary:
+*    Starts an empty ring.
+*
+* Parameters:
+*    ring           Ring
+*    buf            size bytes, 2 * size when mirrored
+*    size           Ring size in bytes
+*    mirrored       Non-zero to keep the mirror copy
+*
+*******************************************************************************/
+void bench_ring_init(bench_ring_t *ring, void *buf, int size, int mirrored)
+{
+    ring->buf = buf;
+    ring->size = size;
+    ring->used = 0;
+    ring->read = 0;
+    ring->write = 0;
+    ring->mirrored = mirrored;
+}
+
+
+/*******************************************************************************
+* Function Name: bench_ring_write
+********************************************************************************
+* Summary:
+*    cbuffer_enqueue(), or cbuffer_enqueue_mirrored() which writes every byte
+*    twice. The caller keeps used within size.
+*
+* Parameters:
+*    ring           Ring
+*    src            Bytes to append
+*    bytes          Number of bytes
+*
+* Return:
+*    Bytes copied
+*
+*******************************************************************************/
+size_t bench_ring_write(bench_ring_t *ring, const void *src, int bytes)
+{
+    const uint8_t *from = src;
+    int first = bytes;
+
+    if (ring->write + bytes > ring->size)
+    {
+        first = ring->size - ring->write;
+    }
+    memcpy(&ring->buf[ring->write], from, first);
+    memcpy(ring->buf, &from[first], bytes - first);
+    if (ring->mirrored)
+    {
+        memcpy(&ring->buf[ring->write + ring->size], from, first);
+        memcpy(&ring->buf[ring->size], &from[first], bytes - first);
+    }
+
+    ring->write = (ring->write + bytes) % ring->size;
+    ring->used += bytes;
+    return (size_t)bytes * (ring->mirrored ? 2 : 1);
+}
+
+
+/*******************************************************************************
+* Function Name: bench_ring_copy
+********************************************************************************
+* Summary:
+*    cbuffer_copyto(): copies bytes from the read position, across the wrap,
+*    without consuming them.
+*
+* Parameters:
+*    ring           Ring
+*    dst            Destination
+*    bytes          Number of bytes, at most size
+*
+* Return:
+*    Bytes copied
+*
+*******************************************************************************/
+size_t bench_ring_copy(const bench_ring_t *ring, void *dst, int bytes)
+{
+    uint8_t *to = dst;
+    int first = ring->size - ring->read;
+
+    if (first > bytes)
+    {
+        first = bytes;
+    }
+    memcpy(to, &ring->buf[ring->read], first);
+    memcpy(&to[first], ring->buf, bytes - first);
+    return (size_t)bytes;
+}
+
+
+/* Drops bytes from the read position */
+void bench_ring_consume(bench_ring_t *ring, int bytes)
+{
+    ring->read = (ring->read + bytes) % ring->size;
+    ring->used -= bytes;
+}
@@ -0,0 +1,38 @@
+/*
+ * bench_ring.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef HOST_BENCH_RING_H_
+#define HOST_BENCH_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Ring of size bytes. A mirrored ring has 2 * size bytes and keeps a copy of
+ * the first size bytes after them, so any size bytes from read are contiguous. */
+typedef struct {
+    uint8_t *buf;
+    int size;
+    int used;
+    int read;
+    int write;
+    int mirrored;
+} bench_ring_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void bench_ring_init(bench_ring_t *ring, void *buf, int size, int mirrored);
+size_t bench_ring_write(bench_ring_t *ring, const void *src, int bytes);
+size_t bench_ring_copy(const bench_ring_t *ring, void *dst, int bytes);
+void bench_ring_consume(bench_ring_t *ring, int bytes);
+
+
+#endif /* HOST_BENCH_RING_H_ */
@@ -0,0 +1,222 @@
+/*
+ * bench_window.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Bytes moved and cycles per hop of the analysis window handling in the
+ * model front-end, up to the magnitude spectrum. The copying chain that
+ * model.c used before (cbuffer_copyto() of the window, Hann into a frame,
+ * copy into the FFT scratch buffer, unpack into a 257x2 spectrum) runs next
+ * to the current one (mirrored ring read in place, Hann straight into the
+ * FFT scratch buffer, magnitudes from the packed FFT output). Both get the
+ * same recording in the same hops and their spectra must be bit-identical.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "bench_ring.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "frontend.h"
+#include "arm_math.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c and the model front-end */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define WINDOW_LEN                      (512)
+#define FRAME_HOP                       (320)
+#define SPECTRUM_BINS                   (WINDOW_LEN / 2 + 1)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint64_t bytes;                 /* Bytes copied, not counting the FFT itself */
+    uint64_t cycles;
+    uint64_t hops;
+} window_result_t;
+
+static arm_rfft_fast_instance_f32 rfft;
+static const float *hann;
+static float frame[WINDOW_LEN];
+static float windowed[WINDOW_LEN];
+static float temp_a[WINDOW_LEN];
+static float temp_b[WINDOW_LEN];
+static float spectrum[2 * SPECTRUM_BINS];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void spectrum_copying(bench_ring_t *ring, float *magnitude, window_result_t *result);
+static void spectrum_inplace(bench_ring_t *ring, float *magnitude);
+
+
+/*******************************************************************************
+* Function Name: bench_window_main
+********************************************************************************
+* Summary:
+*    smartlistener_host bench-window <file.wav> [--repeat N]
+*
+*******************************************************************************/
+int bench_window_main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    int repeat = 1;
+    wav_t wav;
+    float *samples;
+    int16_t *pcm;
+    float ring_memory[WINDOW_LEN];
+    float mirror_memory[2 * WINDOW_LEN];
+    float magnitude[2][SPECTRUM_BINS];
+    window_result_t before = { 0 };
+    window_result_t after = { 0 };
+    uint64_t mismatches = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if ((path == NULL) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host bench-window <file.wav> [--repeat N]\n");
+        return 1;
+    }
+    if (wav_load(path, &wav) != 0)
+    {
+        return 1;
+    }
+
+    /* Channel 0, converted the same way ml_task.c does */
+    samples = malloc(wav.frames * sizeof(float));
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    if ((samples == NULL) || (pcm == NULL) || (wav.frames < WINDOW_LEN))
+    {
+        fprintf(stderr, "Recording is shorter than one window\n");
+        free(samples);
+        free(pcm);
+        wav_free(&wav);
+        return 1;
+    }
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+    audio_ingest_block(pcm, samples, wav.frames, DIGITAL_BOOST_FACTOR);
+
+    arm_rfft_fast_init_f32(&rfft, WINDOW_LEN);
+    hann = frontend_window();
+
+    for (int r = 0; r < repeat; r++)
+    {
+        bench_ring_t ring;
+        bench_ring_t mirror;
+        size_t next = 0;
+
+        /* Input window rings, in bytes */
+        bench_ring_init(&ring, ring_memory, sizeof(ring_memory), 0);
+        bench_ring_init(&mirror, mirror_memory, sizeof(ring_memory), 1);
+
+        /* Like IMAI_enqueue_block(): fill the ring, then consume one hop */
+        while (next + (WINDOW_LEN - ring.used / sizeof(float)) <= wav.frames)
+        {
+            int n = WINDOW_LEN - ring.used / sizeof(float);
+            uint64_t c0;
+
+            c0 = read_cycles();
+            /* cbuffer_enqueue() */
+            before.bytes += bench_ring_write(&ring, &samples[next], n * sizeof(float));
+            spectrum_copying(&ring, magnitude[0], &before);
+            before.cycles += read_cycles() - c0;
+
+            c0 = read_cycles();
+            /* cbuffer_enqueue_mirrored() writes every sample twice */
+            after.bytes += bench_ring_write(&mirror, &samples[next], n * sizeof(float));
+            spectrum_inplace(&mirror, magnitude[1]);
+            after.cycles += read_cycles() - c0;
+
+            if (memcmp(magnitude[0], magnitude[1], sizeof(magnitude[0])) != 0)
+            {
+                mismatches++;
+            }
+            before.hops++;
+            after.hops++;
+            next += n;
+        }
+    }
+
+    printf("Recording:                 %s\n", path);
+    printf("Hops:                      %llu\n", (unsigned long long)before.hops);
+    printf("Copying window chain:      %6.0f bytes/hop, %6.0f cycles/hop\n",
+        (double)before.bytes / before.hops, (double)before.cycles / before.hops);
+    printf("Mirrored in-place chain:   %6.0f bytes/hop, %6.0f cycles/hop\n",
+        (double)after.bytes / after.hops, (double)after.cycles / after.hops);
+    printf("Spectra:                   %llu of %llu hops differ (%s)\n",
+        (unsigned long long)mismatches, (unsigned long long)before.hops, (mismatches == 0) ? "PASS" : "FAIL");
+
+    free(samples);
+    free(pcm);
+    wav_free(&wav);
+    return (mismatches == 0) ? 0 : 1;
+}
+
+
+/* The chain of fixwin_dequeue(), hannmul_cmsis_f32(), rfft_cmsis_f32() and norm_cmsis_cmplx_f32() */
+static void spectrum_copying(bench_ring_t *ring, float *magnitude, window_result_t *result)
+{
+    /* cbuffer_copyto() of the whole window */
+    bench_ring_copy(ring, frame, sizeof(frame));
+    bench_ring_consume(ring, FRAME_HOP * sizeof(float));
+
+    arm_mult_f32(frame, hann, windowed, WINDOW_LEN);
+
+    /* Copy into the FFT input, which arm_rfft_fast_f32() destroys */
+    for (int j = 0; j < WINDOW_LEN; j++)
+    {
+        temp_a[j] = windowed[j];
+    }
+    arm_rfft_fast_f32(&rfft, temp_a, temp_b, 0);
+
+    /* Unpack into interleaved bins 0..256 */
+    spectrum[0] = temp_b[0];
+    spectrum[1] = 0;
+    for (int j = 2; j < WINDOW_LEN; j += 2)
+    {
+        spectrum[j] = temp_b[j];
+        spectrum[j + 1] = temp_b[j + 1];
+    }
+    spectrum[WINDOW_LEN] = temp_b[1];
+    spectrum[WINDOW_LEN + 1] = 0;
+    arm_cmplx_mag_f32(spectrum, magnitude, SPECTRUM_BINS);
+
+    result->bytes += 2 * WINDOW_LEN * sizeof(float) + sizeof(spectrum);
+}
+
+
+/* The chain of fixwin_dequeue_inplace(), hannmul_cmsis_f32() and the magnitudes of the packed FFT output */
+static void spectrum_inplace(bench_ring_t *ring, float *magnitude)
+{
+    const float *window = (const float *)&ring->buf[ring->read];
+
+    bench_ring_consume(ring, FRAME_HOP * sizeof(float));
+
+    arm_mult_f32(window, hann, temp_a, WINDOW_LEN);
+    arm_rfft_fast_f32(&rfft, temp_a, temp_b, 0);
+    magnitude[0] = fabsf(temp_b[0]);
+    magnitude[SPECTRUM_BINS - 1] = fabsf(temp_b[1]);
+    arm_cmplx_mag_f32(&temp_b[2], &magnitude[1], SPECTRUM_BINS - 2);
+}
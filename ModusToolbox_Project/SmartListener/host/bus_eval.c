@@ -0,0 +1,364 @@
+/*
+ * bus_eval.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Runs a recording through the model with 0 to N mock consumers on the
+ * feature bus: a level meter and a tonal detector on the magnitude spectrum,
+ * and log-mel checksums. Every consumer must see every hop once, in order,
+ * with the same read-only frame as the others, and the frames must be the
+ * ones of the front-end (compared against frontend_frame() on the same
+ * windows, float front-end only). The cycles per hop outside the callbacks
+ * must not grow with the number of consumers: the FFT runs once per hop.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "activity_gate.h"
+#include "feature_bus.h"
+#include "frontend.h"
+#include "frontend_q15.h"
+#include "arm_math.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define BLOCK_SAMPLES                   (1600)
+
+#define MAX_CONSUMERS                   (FEATURE_BUS_MAX_SUBSCRIBERS)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef enum {
+    CONSUMER_LEVEL,                 /* dB of the spectrum energy */
+    CONSUMER_TONAL,                 /* Peak to mean ratio of the spectrum */
+    CONSUMER_CHECKSUM,              /* Sum of the log-mel frame */
+} consumer_kind_t;
+
+typedef struct {
+    consumer_kind_t kind;
+    uint32_t hops;                  /* Frames received */
+    uint32_t order_errors;          /* Frames out of order or missing a field */
+    uint32_t mismatches;            /* Frames that differ from the reference */
+    double result;                  /* Accumulated output, keeps the work alive */
+    uint64_t cycles;                /* Spent in the callback */
+} consumer_t;
+
+/* Reference frames of the whole recording */
+static float *reference_mel;
+static float *reference_magnitude;
+static size_t reference_hops;
+
+/* Frame of the current hop as seen by the previous consumer */
+static const feature_frame_t *first_frame;
+static uint32_t first_hop;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void consume(const feature_frame_t *frame, void *context);
+static int make_reference(const float *samples, size_t count);
+static int run_pass(const float *samples, size_t count, consumer_t *consumers, int n, uint64_t *cycles);
+
+
+/*******************************************************************************
+* Function Name: bus_eval_main
+********************************************************************************
+* Summary:
+*    smartlistener_host bus-eval <file.wav> [--consumers N] [--repeat N]
+*
+*******************************************************************************/
+int bus_eval_main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    int max_consumers = 4;
+    int repeat = 10;
+    wav_t wav;
+    int16_t *pcm;
+    float *samples;
+    uint64_t base_cycles = 0;
+    int pass = 1;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--consumers") == 0) && (i + 1 < argc))
+        {
+            max_consumers = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if ((path == NULL) || (max_consumers < 1) || (max_consumers > MAX_CONSUMERS) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host bus-eval <file.wav> [--consumers N (1-%d)] [--repeat N]\n",
+            MAX_CONSUMERS);
+        return 1;
+    }
+    if (wav_load(path, &wav) != 0)
+    {
+        return 1;
+    }
+
+    /* Channel 0, converted the same way ml_task.c does */
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    samples = malloc(wav.frames * sizeof(float));
+    if ((pcm == NULL) || (samples == NULL))
+    {
+        free(pcm);
+        free(samples);
+        wav_free(&wav);
+        return 1;
+    }
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+    audio_ingest_block(pcm, samples, wav.frames, DIGITAL_BOOST_FACTOR);
+    if (make_reference(samples, wav.frames) != 0)
+    {
+        free(pcm);
+        free(samples);
+        wav_free(&wav);
+        return 1;
+    }
+
+    printf("Recording:                 %s\n", path);
+    printf("Consumers  Cycles/hop  In callbacks  Front-end+model  Front-ends/hop  Magnitudes/hop  Errors\n");
+    for (int n = 0; n <= max_consumers; n++)
+    {
+        consumer_t consumers[MAX_CONSUMERS];
+        uint64_t best_cycles = UINT64_MAX;
+        uint64_t best_callback_cycles = 0;
+        uint32_t errors = 0;
+        feature_bus_stats_t before;
+        feature_bus_stats_t after;
+
+        /* The fastest pass, the host is not quiet enough for the mean */
+        feature_bus_get_stats(&before);
+        for (int r = 0; r < repeat; r++)
+        {
+            uint64_t cycles = 0;
+            uint64_t callback_cycles = 0;
+
+            if (run_pass(samples, wav.frames, consumers, n, &cycles) != 0)
+            {
+                pass = 0;
+                break;
+            }
+            for (int c = 0; c < n; c++)
+            {
+                callback_cycles += consumers[c].cycles;
+                errors += consumers[c].order_errors + consumers[c].mismatches;
+                if (consumers[c].hops != reference_hops)
+                {
+                    errors++;
+                }
+            }
+            if (cycles - callback_cycles < best_cycles - best_callback_cycles)
+            {
+                best_cycles = cycles;
+                best_callback_cycles = callback_cycles;
+            }
+        }
+        feature_bus_get_stats(&after);
+
+        if (n == 1)
+        {
+            base_cycles = best_cycles - best_callback_cycles;
+        }
+        printf("%9d  %10.0f  %12.0f  %15.0f  %14.2f  %14.2f  %6u\n", n, (double)best_cycles / reference_hops,
+            (double)best_callback_cycles / reference_hops,
+            (double)(best_cycles - best_callback_cycles) / reference_hops,
+            (double)(after.hops - before.hops) / (repeat * reference_hops),
+            (double)(after.magnitude_hops - before.magnitude_hops) / (repeat * reference_hops), errors);
+        if (errors > 0)
+        {
+            pass = 0;
+        }
+        if ((n == max_consumers) && (n > 1))
+        {
+            printf("Front-end+model:           %.2fx with %d consumers against 1\n",
+                (double)(best_cycles - best_callback_cycles) / base_cycles, n);
+        }
+    }
+#if FRONTEND_Q15_ENABLE
+    printf("Reference:                 not checked, q15 front-end\n");
+#endif
+    printf("Result:                    %s\n", pass ? "PASS" : "FAIL");
+
+    free(reference_mel);
+    free(reference_magnitude);
+    free(pcm);
+    free(samples);
+    wav_free(&wav);
+    return pass ? 0 : 1;
+}
+
+
+/* Mock consumer, context is its consumer_t */
+static void consume(const feature_frame_t *frame, void *context)
+{
+    consumer_t *consumer = (consumer_t *)context;
+    uint64_t c0 = read_cycles();
+
+    /* Same hop, same frame for everyone */
+    if ((frame->hop != consumer->hops) || (frame->log_mel == NULL))
+    {
+        consumer->order_errors++;
+    }
+    if ((first_frame != NULL) && (first_hop == frame->hop) &&
+        ((first_frame->log_mel != frame->log_mel) || (first_frame->magnitude != frame->magnitude)))
+    {
+        consumer->order_errors++;
+    }
+    first_frame = frame;
+    first_hop = frame->hop;
+#if !FRONTEND_Q15_ENABLE
+    if ((consumer->kind != CONSUMER_CHECKSUM) && (frame->magnitude == NULL))
+    {
+        consumer->order_errors++;
+    }
+    if ((frame->hop < reference_hops) &&
+        ((memcmp(frame->log_mel, &reference_mel[frame->hop * FEATURE_BUS_MEL_BANDS],
+                 FEATURE_BUS_MEL_BANDS * sizeof(float)) != 0) ||
+         ((frame->magnitude != NULL) &&
+          (memcmp(frame->magnitude, &reference_magnitude[frame->hop * FEATURE_BUS_BINS],
+                  FEATURE_BUS_BINS * sizeof(float)) != 0))))
+    {
+        consumer->mismatches++;
+    }
+#endif
+
+    switch (consumer->kind)
+    {
+        case CONSUMER_LEVEL:
+            if (frame->magnitude != NULL)
+            {
+                float energy;
+
+                arm_dot_prod_f32(frame->magnitude, frame->magnitude, FEATURE_BUS_BINS, &energy);
+                consumer->result += 10.0f * log10f(energy + 1e-12f);
+            }
+            break;
+        case CONSUMER_TONAL:
+            if (frame->magnitude != NULL)
+            {
+                float peak = 0.0f;
+                float sum = 0.0f;
+
+                for (int k = 1; k < FEATURE_BUS_BINS; k++)
+                {
+                    peak = (frame->magnitude[k] > peak) ? frame->magnitude[k] : peak;
+                    sum += frame->magnitude[k];
+                }
+                consumer->result += peak * (FEATURE_BUS_BINS - 1) / (sum + 1e-12f);
+            }
+            break;
+        default:
+            for (int b = 0; b < FEATURE_BUS_MEL_BANDS; b++)
+            {
+                consumer->result += frame->log_mel[b];
+            }
+            break;
+    }
+    consumer->hops++;
+    consumer->cycles += read_cycles() - c0;
+}
+
+
+/* Log-mel and magnitude of every hop, from the front-end kernels */
+static int make_reference(const float *samples, size_t count)
+{
+    arm_rfft_fast_instance_f32 rfft;
+    float temp_a[FEATURE_BUS_FFT_LEN];
+    float temp_b[FEATURE_BUS_FFT_LEN];
+
+    reference_hops = (count >= FEATURE_BUS_FFT_LEN) ? (count - FEATURE_BUS_FFT_LEN) / FRONTEND_HOP + 1 : 0;
+    reference_mel = malloc((reference_hops + 1) * FEATURE_BUS_MEL_BANDS * sizeof(float));
+    reference_magnitude = malloc((reference_hops + 1) * FEATURE_BUS_BINS * sizeof(float));
+    if ((reference_hops == 0) || (reference_mel == NULL) || (reference_magnitude == NULL) ||
+        (frontend_init(&rfft) != 0))
+    {
+        fprintf(stderr, "Recording is shorter than one window\n");
+        free(reference_mel);
+        free(reference_magnitude);
+        return -1;
+    }
+    for (size_t h = 0; h < reference_hops; h++)
+    {
+        float *magnitude = &reference_magnitude[h * FEATURE_BUS_BINS];
+
+        frontend_frame(&rfft, &samples[h * FRONTEND_HOP], temp_a, temp_b, &reference_mel[h * FEATURE_BUS_MEL_BANDS]);
+        magnitude[0] = fabsf(temp_b[0]);
+        magnitude[FEATURE_BUS_BINS - 1] = fabsf(temp_b[1]);
+        arm_cmplx_mag_f32(&temp_b[2], &magnitude[1], FEATURE_BUS_BINS - 2);
+    }
+    return 0;
+}
+
+
+/* The recording through IMAI_enqueue_block() with n consumers */
+static int run_pass(const float *samples, size_t count, consumer_t *consumers, int n, uint64_t *cycles)
+{
+    int ids[MAX_CONSUMERS];
+    float scores[IMAI_DATA_OUT_COUNT];
+    int result = 0;
+
+    if (IMAI_init() != IMAI_RET_SUCCESS)
+    {
+        return -1;
+    }
+    activity_gate_init();
+    first_frame = NULL;
+    for (int c = 0; c < n; c++)
+    {
+        memset(&consumers[c], 0, sizeof(consumers[c]));
+        consumers[c].kind = (c % 3 == 0) ? CONSUMER_LEVEL : ((c % 3 == 1) ? CONSUMER_TONAL : CONSUMER_CHECKSUM);
+        ids[c] = feature_bus_subscribe(consume, &consumers[c],
+                                       (consumers[c].kind == CONSUMER_CHECKSUM) ? FEATURE_BUS_LOG_MEL
+                                                                                : FEATURE_BUS_MAGNITUDE);
+    }
+
+    for (size_t i = 0; (i < count) && (result == 0); i += BLOCK_SAMPLES)
+    {
+        int block = (count - i < BLOCK_SAMPLES) ? (int)(count - i) : BLOCK_SAMPLES;
+        uint64_t c0 = read_cycles();
+        int ready = IMAI_enqueue_block(&samples[i], block);
+
+        *cycles += read_cycles() - c0;
+        if (ready < 0)
+        {
+            result = -1;
+        }
+        for (int k = 0; k < ready; k++)
+        {
+            IMAI_dequeue(scores);
+        }
+    }
+
+    for (int c = 0; c < n; c++)
+    {
+        feature_bus_unsubscribe(ids[c]);
+    }
+    IMAI_finalize();
+    return result;
+}
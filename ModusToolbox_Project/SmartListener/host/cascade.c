@@ -0,0 +1,1028 @@
+/*
+ * cascade.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Trains the first stage of cascade_model.c and tunes its threshold. Every
+ * recorded session goes through model.c and the host reference interpreter
+ * with the activity gate disabled, and the input window of every model run
+ * is kept with the prediction DEEPCRAFT Studio exported for it. A window is
+ * a candidate when the reference top class is an event (not unlabelled or
+ * unknown), and a confident event when that top score also reaches the
+ * ml_task.c threshold.
+ *
+ * The stage, band means and peaks into a few ReLU units, is trained
+ * with a class-balanced logistic loss on the confident event windows. The
+ * recall-vs-CPU curve of the training windows gives the threshold: the
+ * highest one that escalates every confident fire and glass_breaking window
+ * and at least --min-recall of all confident events. The sessions are
+ * split in CASCADE_FOLDS folds, and the stage and threshold trained without
+ * each fold are checked on it, which estimates the recall on recordings the
+ * stage has not seen. The stage that is written is then trained on all
+ * sessions. The report shows its curve, the cross-validated figures and the
+ * average time per window of the cascade against the full network. --curve
+ * writes the whole curve as CSV, --output the stage as C for the
+ * CASCADE_MODEL_ENABLE build.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "commands.h"
+#include "sessions.h"
+#include "generator.h"
+#include "wav.h"
+#include "activity_gate.h"
+#include "mtb_ml_model.h"
+#include "tflite_model.h"
+#include "cascade_model.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Classes whose confident windows must all reach the full network, same
+ * order as IMAI_DATA_OUT_SYMBOLS */
+#define CLASS_FIRE                      (2)
+#define CLASS_GLASS_BREAKING            (5)
+
+/* Share of all confident event windows the chosen threshold must escalate */
+#define DEFAULT_MIN_RECALL              (1.0)
+
+#define DEFAULT_HIDDEN                  (8)
+#define DEFAULT_HANGOVER                (CASCADE_MODEL_HANGOVER_WINDOWS)
+#define DEFAULT_EPOCHS                  (30)
+
+/* Session i is in fold i % CASCADE_FOLDS */
+#define CASCADE_FOLDS                   (4)
+
+/* Training windows of every fold */
+#define ALL_FOLDS                       (-1)
+
+/* Adam on minibatches, fixed seed so the output is reproducible */
+#define BATCH_SIZE                      (32)
+#define LEARNING_RATE                   (3e-3f)
+#define ADAM_BETA1                      (0.9f)
+#define ADAM_BETA2                      (0.999f)
+#define ADAM_EPSILON                    (1e-8f)
+#define RANDOM_SEED                     (0x5eed1234u)
+
+#define MAX_WINDOW                      (64 * 64)
+#define MAX_TENSORS                     (64)
+#define MAX_OPERATORS                   (32)
+#define MAX_INPUTS                      (CASCADE_MODEL_BAND_FEATURES * CASCADE_MODEL_MAX_BANDS)
+
+/* Escalation shares printed from the curve */
+#define CURVE_POINTS                    (9)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Windows of all sessions with their reference */
+typedef struct {
+    float *windows;                 /* [count][frames * bands] */
+    float *scores;                  /* First stage candidate score */
+    uint8_t *top;                   /* Reference top class */
+    uint8_t *confident;             /* Reference top score >= SESSION_EVENT_SCORE */
+    float *margins;                 /* Score minus the threshold trained without its fold */
+    uint8_t *fold;
+    uint32_t *session;              /* Index in the session list */
+    size_t count;
+    size_t capacity;
+} corpus_t;
+
+/* Windows of a subset that a threshold escalates */
+typedef struct {
+    size_t windows;
+    size_t escalated;
+    size_t events;                  /* Confident events of any class */
+    size_t events_escalated;
+    size_t protected_events;        /* Confident fire and glass_breaking */
+    size_t protected_escalated;
+    size_t class_events[SESSION_NUM_CLASSES];
+    size_t class_escalated[SESSION_NUM_CLASSES];
+    size_t protected_sessions;      /* Sessions with a confident fire or glass_breaking window */
+    size_t protected_detected;      /* Of those, sessions with one of them escalated */
+} curve_point_t;
+
+/* Sessions of the corpus and the interpreter time of their windows */
+typedef struct {
+    size_t sessions;
+    uint64_t model_runs;
+    uint64_t model_ns;
+} corpus_walk_t;
+
+/* Trainable parameters, or their gradients and Adam moments */
+typedef struct {
+    float weights[CASCADE_MODEL_MAX_HIDDEN * MAX_INPUTS];
+    float bias[CASCADE_MODEL_MAX_HIDDEN];
+    float output_weights[CASCADE_MODEL_MAX_HIDDEN];
+    float output_bias;
+} stage_params_t;
+
+#define PARAM_COUNT                     (sizeof(stage_params_t) / sizeof(float))
+
+static corpus_t corpus;
+static int window_frames;
+static int window_bands;
+static int input_tensor;
+static uint32_t network_macs;
+
+/* Windows of the session being run */
+static float *session_windows;
+static size_t session_capacity;
+static size_t session_count;
+
+static stage_params_t stage_params;
+static float stage_weights[CASCADE_MODEL_MAX_HIDDEN * MAX_INPUTS];
+static float stage_bias[CASCADE_MODEL_MAX_HIDDEN];
+static float stage_output_weights[CASCADE_MODEL_MAX_HIDDEN];
+static cascade_model_t stage;
+
+static uint32_t random_state = RANDOM_SEED;
+static int hangover_windows = DEFAULT_HANGOVER;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int load_input(void);
+static void input_hook(int op, void *context);
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+static int add_session(const session_t *session, uint32_t index);
+static void corpus_free(void);
+static void band_features(const float *window, float *features);
+static void train_stage(int hidden, int epochs, int fold);
+static void score_corpus(void);
+static float forward(const stage_params_t *params, int hidden, int inputs, const float *x, float *units);
+static void fold_normalization(int hidden, int inputs, const float *mean, const float *scale);
+static curve_point_t evaluate(const float *scores, float threshold, int fold);
+static float tune_threshold(double min_recall, int fold);
+static int write_curve(const char *path);
+static int write_stage(const char *path, size_t sessions);
+static void print_point(const char *name, float threshold, const curve_point_t *point);
+static int compare_scores(const void *a, const void *b);
+static float random_uniform(void);
+
+
+/*******************************************************************************
+* Function Name: cascade_main
+********************************************************************************
+* Summary:
+*    smartlistener_host cascade [--data DIR] [--pred DIR] [--hidden N]
+*        [--epochs N] [--min-recall X] [--curve FILE] [--output FILE]
+*        [--verbose]
+*
+*******************************************************************************/
+int cascade_main(int argc, char *argv[])
+{
+    const char *data_dir = SESSION_DEFAULT_DATA_DIR;
+    const char *pred_dir = SESSION_DEFAULT_PRED_DIR;
+    const char *curve_path = NULL;
+    const char *output_path = NULL;
+    int hidden = DEFAULT_HIDDEN;
+    int epochs = DEFAULT_EPOCHS;
+    double min_recall = DEFAULT_MIN_RECALL;
+    int verbose = 0;
+    activity_gate_config_t gate;
+    cascade_model_config_t config;
+    corpus_walk_t walk = { 0 };
+    uint64_t stage_ns;
+    float threshold;
+    curve_point_t validated;
+    curve_point_t all;
+    float *sorted;
+    double model_us;
+    double stage_us;
+    double cascade_us;
+    int result;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--data") == 0) && (i + 1 < argc))
+        {
+            data_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--pred") == 0) && (i + 1 < argc))
+        {
+            pred_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--hidden") == 0) && (i + 1 < argc))
+        {
+            hidden = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--epochs") == 0) && (i + 1 < argc))
+        {
+            epochs = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--hangover") == 0) && (i + 1 < argc))
+        {
+            hangover_windows = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--min-recall") == 0) && (i + 1 < argc))
+        {
+            min_recall = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--curve") == 0) && (i + 1 < argc))
+        {
+            curve_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+        {
+            output_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--verbose") == 0)
+        {
+            verbose = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host cascade [--data DIR] [--pred DIR] [--hidden N] [--epochs N]\n"
+                            "           [--hangover N] [--min-recall X] [--curve FILE] [--output FILE] [--verbose]\n");
+            return 1;
+        }
+    }
+    if ((hidden < 1) || (hidden > CASCADE_MODEL_MAX_HIDDEN) || (epochs < 1) || (hangover_windows < 0))
+    {
+        fprintf(stderr, "--hidden must be 1 to %d, --epochs at least 1, --hangover at least 0\n",
+                CASCADE_MODEL_MAX_HIDDEN);
+        return 1;
+    }
+
+    /* Every window reaches the interpreter, none is answered early */
+    activity_gate_get_config(&gate);
+    gate.enabled = 0;
+    activity_gate_set_config(&gate);
+    activity_gate_init();
+    cascade_model_get_config(&config);
+    config.enabled = 0;
+    cascade_model_set_config(&config);
+
+    if ((IMAI_init() != IMAI_RET_SUCCESS) || (load_input() != 0))
+    {
+        fprintf(stderr, "The model of model.c does not run on the host interpreter\n");
+        IMAI_finalize();
+        return 1;
+    }
+    mtb_ml_model_host_set_hook(input_hook, NULL);
+    if (session_walk(data_dir, pred_dir, 1, run_session, &walk) < 0)
+    {
+        mtb_ml_model_host_set_hook(NULL, NULL);
+        IMAI_finalize();
+        return 1;
+    }
+    mtb_ml_model_host_set_hook(NULL, NULL);
+    free(session_windows);
+    session_windows = NULL;
+    IMAI_finalize();
+
+    if ((corpus.count == 0) || (walk.model_runs == 0))
+    {
+        fprintf(stderr, "No session could be evaluated\n");
+        corpus_free();
+        return 1;
+    }
+
+    /* Each fold scored by the stage and threshold trained on the others */
+    for (int k = 0; k < CASCADE_FOLDS; k++)
+    {
+        train_stage(hidden, epochs, k);
+        if (cascade_model_init(&stage) != 0)
+        {
+            fprintf(stderr, "The first stage does not fit cascade_model.c\n");
+            corpus_free();
+            return 1;
+        }
+        score_corpus();
+        threshold = tune_threshold(min_recall, k);
+        for (size_t w = 0; w < corpus.count; w++)
+        {
+            if (corpus.fold[w] == k)
+            {
+                corpus.margins[w] = corpus.scores[w] - threshold;
+            }
+        }
+    }
+    validated = evaluate(corpus.margins, 0.0f, ALL_FOLDS);
+
+    /* The stage that is written */
+    train_stage(hidden, epochs, ALL_FOLDS);
+    cascade_model_init(&stage);
+    stage_ns = host_now_ns();
+    score_corpus();
+    stage_ns = host_now_ns() - stage_ns;
+    threshold = tune_threshold(min_recall, ALL_FOLDS);
+    stage.threshold = threshold;
+    stage.hangover = (uint16_t)hangover_windows;
+    all = evaluate(corpus.scores, threshold, ALL_FOLDS);
+
+    printf("Windows:                   %zu of %zu sessions, %zu confident events, %zu fire/glass_breaking sessions\n",
+           corpus.count, walk.sessions, all.events, all.protected_sessions);
+    printf("First stage:               %d band features, %d ReLU units, %lu operations per window (%.2f %% of %lu MACs)\n",
+           CASCADE_MODEL_BAND_FEATURES * window_bands, hidden, (unsigned long)stage.macs,
+           100.0 * stage.macs / network_macs, (unsigned long)network_macs);
+    printf("%-16s %9s %10s %9s %9s %9s %9s %15s\n", "Curve", "Threshold", "Escalated", "Events", "fire", "glass",
+           "Sessions", "MACs per window");
+    sorted = malloc(corpus.count * sizeof(float));
+    if (sorted != NULL)
+    {
+        static const float shares[CURVE_POINTS] = { 0.05f, 0.1f, 0.15f, 0.2f, 0.25f, 0.3f, 0.4f, 0.5f, 1.0f };
+
+        memcpy(sorted, corpus.scores, corpus.count * sizeof(float));
+        qsort(sorted, corpus.count, sizeof(float), compare_scores);
+        for (int p = 0; p < CURVE_POINTS; p++)
+        {
+            const size_t rank = (size_t)(shares[p] * corpus.count + 0.5f);
+            const float t = sorted[((rank > 0) ? rank : 1) - 1];
+            const curve_point_t point = evaluate(corpus.scores, t, ALL_FOLDS);
+            char name[32];
+
+            snprintf(name, sizeof(name), "Top %.0f %%", 100.0f * shares[p]);
+            print_point(name, t, &point);
+        }
+        free(sorted);
+    }
+    print_point("Chosen", threshold, &all);
+    print_point("Cross-validated", NAN, &validated);
+    if (verbose)
+    {
+        printf("%-16s %9s %10s %9s\n", "Class", "Events", "Escalated", "Recall");
+        for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+        {
+            if (all.class_events[c] > 0)
+            {
+                printf("%-16s %9zu %10zu %8.1f %%\n", session_class_name(c), all.class_events[c],
+                       all.class_escalated[c], 100.0 * all.class_escalated[c] / all.class_events[c]);
+            }
+        }
+    }
+
+    model_us = (double)walk.model_ns / walk.model_runs / 1e3;
+    stage_us = (double)stage_ns / corpus.count / 1e3;
+    cascade_us = stage_us + model_us * validated.escalated / validated.windows;
+    printf("Interpreter:               %.1f us per window\n", model_us);
+    printf("First stage:               %.2f us per window\n", stage_us);
+    printf("Cascade:                   %.1f us per window on average (%.1fx less) at the cross-validated escalation\n",
+           cascade_us, model_us / cascade_us);
+
+    if (((curve_path != NULL) && (write_curve(curve_path) != 0)) ||
+        ((output_path != NULL) && (write_stage(output_path, walk.sessions) != 0)))
+    {
+        corpus_free();
+        return 1;
+    }
+    if (curve_path != NULL)
+    {
+        printf("Curve:                     %s\n", curve_path);
+    }
+    if (output_path != NULL)
+    {
+        printf("Written:                   %s\n", output_path);
+    }
+
+    /* Cross-validated: no fire or glass_breaking recording missed and their windows within min_recall */
+    result = (validated.protected_detected == validated.protected_sessions) &&
+             ((double)validated.protected_escalated >= min_recall * validated.protected_events);
+    printf("Result:                    %s (cross-validated: %zu of %zu fire and glass_breaking recordings and "
+           "%.1f %% of their windows reach the network, at least %.1f %%)\n", result ? "PASS" : "FAIL",
+           validated.protected_detected, validated.protected_sessions,
+           100.0 * validated.protected_escalated / validated.protected_events, 100.0 * min_recall);
+    corpus_free();
+    return result ? 0 : 1;
+}
+
+
+/* Input tensor, window shape and cost of the flatbuffer model.c gave the
+ * interpreter */
+static int load_input(void)
+{
+    static tflite_tensor_t tensors[MAX_TENSORS];
+    static tflite_operator_t operators[MAX_OPERATORS];
+    tflite_model_t graph;
+    const tflite_tensor_t *tensor;
+
+    if (generator_load_graph(&graph, tensors, MAX_TENSORS, operators, MAX_OPERATORS) != 0)
+    {
+        return -1;
+    }
+    tensor = &tensors[graph.input];
+    if (tensor->dims < 2)
+    {
+        return -1;
+    }
+    window_frames = tensor->shape[tensor->dims - 2];
+    window_bands = tensor->shape[tensor->dims - 1];
+    input_tensor = graph.input;
+    network_macs = generator_count_macs(&graph, tensors, operators);
+    if ((window_bands > CASCADE_MODEL_MAX_BANDS) || (window_frames * window_bands > MAX_WINDOW))
+    {
+        return -1;
+    }
+    return 0;
+}
+
+
+/* Keeps the input window of every model run, the first operator reads it */
+static void input_hook(int op, void *context)
+{
+    const size_t size = (size_t)window_frames * window_bands;
+    const float *data;
+    int32_t elements;
+
+    (void) context;
+    if (op != 0)
+    {
+        return;
+    }
+    data = mtb_ml_model_host_tensor(input_tensor, &elements);
+    if ((data == NULL) || ((size_t)elements != size))
+    {
+        return;
+    }
+    if (session_count == session_capacity)
+    {
+        size_t capacity = (session_capacity > 0) ? 2 * session_capacity : 256;
+        float *windows = realloc(session_windows, capacity * size * sizeof(float));
+
+        if (windows == NULL)
+        {
+            return;
+        }
+        session_windows = windows;
+        session_capacity = capacity;
+    }
+    memcpy(&session_windows[session_count++ * size], data, size * sizeof(float));
+}
+
+
+/*******************************************************************************
+* Function Name: run_session
+********************************************************************************
+* Summary:
+*    Feeds one recording to the model in capture sized blocks at unit gain,
+*    like model-eval. input_hook() keeps the windows, which join the corpus
+*    with their reference predictions.
+*
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    corpus_walk_t *walk = context;
+    size_t windows;
+    uint64_t runs;
+    uint64_t ns;
+
+    session_count = 0;
+    if ((session_play(wav, 1.0f, NULL, NULL, &windows) != 0) || (add_session(session, (uint32_t)index) != 0))
+    {
+        return;
+    }
+    /* IMAI_init() restarts the counters of the shim */
+    mtb_ml_model_host_run_time(&runs, &ns);
+    walk->model_runs += runs;
+    walk->model_ns += ns;
+    walk->sessions++;
+}
+
+
+/* Appends the windows of the session run last that have a reference prediction */
+static int add_session(const session_t *session, uint32_t index)
+{
+    const size_t size = (size_t)window_frames * window_bands;
+    const size_t windows = (session_count < session->windows) ? session_count : session->windows;
+
+    if (session_count != session->windows)
+    {
+        fprintf(stderr, "%s: %zu windows, %zu reference predictions\n", session->name, session_count,
+                session->windows);
+    }
+    if (corpus.count + windows > corpus.capacity)
+    {
+        size_t capacity = (corpus.capacity > 0) ? 2 * corpus.capacity : 4096;
+        float *data;
+
+        while (capacity < corpus.count + windows)
+        {
+            capacity *= 2;
+        }
+        data = realloc(corpus.windows, capacity * size * sizeof(float));
+        if (data == NULL)
+        {
+            return -1;
+        }
+        corpus.windows = data;
+        if (((data = realloc(corpus.scores, capacity * sizeof(float))) == NULL) ||
+            ((corpus.scores = data, corpus.top = realloc(corpus.top, capacity)) == NULL) ||
+            ((corpus.confident = realloc(corpus.confident, capacity)) == NULL) ||
+            ((data = realloc(corpus.margins, capacity * sizeof(float))) == NULL) ||
+            ((corpus.margins = data, corpus.fold = realloc(corpus.fold, capacity)) == NULL) ||
+            ((corpus.session = realloc(corpus.session, capacity * sizeof(uint32_t))) == NULL))
+        {
+            return -1;
+        }
+        corpus.capacity = capacity;
+    }
+
+    memcpy(&corpus.windows[corpus.count * size], session_windows, windows * size * sizeof(float));
+    for (size_t w = 0; w < windows; w++)
+    {
+        const float *reference = session->predictions[w];
+        const int top = session_argmax(reference);
+
+        corpus.top[corpus.count] = (uint8_t)top;
+        corpus.confident[corpus.count] = (reference[top] >= SESSION_EVENT_SCORE);
+        corpus.fold[corpus.count] = (uint8_t)(index % CASCADE_FOLDS);
+        corpus.session[corpus.count] = index;
+        corpus.count++;
+    }
+    return 0;
+}
+
+
+static void corpus_free(void)
+{
+    free(corpus.windows);
+    free(corpus.scores);
+    free(corpus.top);
+    free(corpus.confident);
+    free(corpus.margins);
+    free(corpus.fold);
+    free(corpus.session);
+    memset(&corpus, 0, sizeof(corpus));
+}
+
+
+/* Band means then band peaks over the frames, the inputs of the first stage */
+static void band_features(const float *window, float *features)
+{
+    for (int b = 0; b < window_bands; b++)
+    {
+        float sum = 0.0f;
+        float peak = -FLT_MAX;
+
+        for (int f = 0; f < window_frames; f++)
+        {
+            sum += window[f * window_bands + b];
+            peak = fmaxf(peak, window[f * window_bands + b]);
+        }
+        features[b] = sum / window_frames;
+        features[window_bands + b] = peak;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: train_stage
+********************************************************************************
+* Summary:
+*    Trains the hidden and output layer on the standardized band features of
+*    the windows outside fold (all for ALL_FOLDS) with Adam, the loss weighted
+*    so confident events and the rest count the same, and fills stage with
+*    the normalization folded into the hidden layer.
+*
+*******************************************************************************/
+static void train_stage(int hidden, int epochs, int fold)
+{
+    const int inputs = CASCADE_MODEL_BAND_FEATURES * window_bands;
+    float mean[MAX_INPUTS] = { 0 };
+    float scale[MAX_INPUTS] = { 0 };
+    float units[CASCADE_MODEL_MAX_HIDDEN];
+    float *features;
+    uint8_t *labels;
+    size_t *order;
+    size_t count = 0;
+    size_t positives = 0;
+    float positive_weight;
+    float negative_weight;
+    static stage_params_t gradient;
+    static stage_params_t moment1;
+    static stage_params_t moment2;
+    float *param = (float *)&stage_params;
+    float *grad = (float *)&gradient;
+    float *m1 = (float *)&moment1;
+    float *m2 = (float *)&moment2;
+    int step = 0;
+
+    features = malloc(corpus.count * inputs * sizeof(float));
+    labels = malloc(corpus.count);
+    order = malloc(corpus.count * sizeof(size_t));
+    if ((features == NULL) || (labels == NULL) || (order == NULL))
+    {
+        free(features);
+        free(labels);
+        free(order);
+        return;
+    }
+
+    /* Standardized features of the training windows */
+    for (size_t w = 0; w < corpus.count; w++)
+    {
+        if (corpus.fold[w] == fold)
+        {
+            continue;
+        }
+        band_features(&corpus.windows[w * window_frames * window_bands], &features[count * inputs]);
+        for (int j = 0; j < inputs; j++)
+        {
+            mean[j] += features[count * inputs + j];
+        }
+        labels[count] = (uint8_t)(corpus.confident[w] && session_is_event(corpus.top[w]));
+        positives += labels[count];
+        count++;
+    }
+    for (int j = 0; j < inputs; j++)
+    {
+        mean[j] /= count;
+    }
+    for (size_t n = 0; n < count; n++)
+    {
+        for (int j = 0; j < inputs; j++)
+        {
+            const float d = features[n * inputs + j] - mean[j];
+            scale[j] += d * d;
+        }
+    }
+    for (int j = 0; j < inputs; j++)
+    {
+        scale[j] = sqrtf(scale[j] / count);
+        scale[j] = (scale[j] > 1e-6f) ? 1.0f / scale[j] : 1.0f;
+    }
+    for (size_t n = 0; n < count; n++)
+    {
+        for (int j = 0; j < inputs; j++)
+        {
+            features[n * inputs + j] = (features[n * inputs + j] - mean[j]) * scale[j];
+        }
+    }
+    positive_weight = (positives > 0) ? 0.5f * count / positives : 1.0f;
+    negative_weight = (positives < count) ? 0.5f * count / (count - positives) : 1.0f;
+
+    /* He initialization of the hidden layer, small output weights */
+    memset(&stage_params, 0, sizeof(stage_params));
+    memset(&moment1, 0, sizeof(moment1));
+    memset(&moment2, 0, sizeof(moment2));
+    random_state = RANDOM_SEED;
+    for (int i = 0; i < hidden * inputs; i++)
+    {
+        stage_params.weights[i] = (2.0f * random_uniform() - 1.0f) * sqrtf(6.0f / inputs);
+    }
+    for (int h = 0; h < hidden; h++)
+    {
+        stage_params.output_weights[h] = (2.0f * random_uniform() - 1.0f) * sqrtf(6.0f / hidden);
+    }
+
+    /* Rows of features[], shuffled every epoch */
+    for (size_t n = 0; n < count; n++)
+    {
+        order[n] = n;
+    }
+    for (int epoch = 0; epoch < epochs; epoch++)
+    {
+        for (size_t n = count - 1; n > 0; n--)
+        {
+            const size_t k = (size_t)(random_uniform() * (n + 1)) % (n + 1);
+            const size_t swap = order[n];
+
+            order[n] = order[k];
+            order[k] = swap;
+        }
+        for (size_t start = 0; start < count; start += BATCH_SIZE)
+        {
+            const size_t end = (start + BATCH_SIZE < count) ? start + BATCH_SIZE : count;
+            float correction1;
+            float correction2;
+
+            memset(&gradient, 0, sizeof(gradient));
+            for (size_t n = start; n < end; n++)
+            {
+                const size_t row = order[n];
+                const float *x = &features[row * inputs];
+                const int label = labels[row];
+                float logit;
+                float delta;
+
+                logit = forward(&stage_params, hidden, inputs, x, units);
+                delta = (1.0f / (1.0f + expf(-logit)) - label) * (label ? positive_weight : negative_weight);
+                delta /= (float)(end - start);
+
+                gradient.output_bias += delta;
+                for (int h = 0; h < hidden; h++)
+                {
+                    gradient.output_weights[h] += delta * units[h];
+                    if (units[h] > 0.0f)
+                    {
+                        const float back = delta * stage_params.output_weights[h];
+
+                        gradient.bias[h] += back;
+                        for (int j = 0; j < inputs; j++)
+                        {
+                            gradient.weights[h * inputs + j] += back * x[j];
+                        }
+                    }
+                }
+            }
+
+            step++;
+            correction1 = 1.0f - powf(ADAM_BETA1, step);
+            correction2 = 1.0f - powf(ADAM_BETA2, step);
+            for (size_t i = 0; i < PARAM_COUNT; i++)
+            {
+                m1[i] = ADAM_BETA1 * m1[i] + (1.0f - ADAM_BETA1) * grad[i];
+                m2[i] = ADAM_BETA2 * m2[i] + (1.0f - ADAM_BETA2) * grad[i] * grad[i];
+                param[i] -= LEARNING_RATE * (m1[i] / correction1) / (sqrtf(m2[i] / correction2) + ADAM_EPSILON);
+            }
+        }
+    }
+
+    fold_normalization(hidden, inputs, mean, scale);
+    free(features);
+    free(labels);
+    free(order);
+}
+
+
+/* Logit of the trainable stage on standardized features, units gets the hidden layer */
+static float forward(const stage_params_t *params, int hidden, int inputs, const float *x, float *units)
+{
+    float logit = params->output_bias;
+
+    for (int h = 0; h < hidden; h++)
+    {
+        float sum = params->bias[h];
+
+        for (int j = 0; j < inputs; j++)
+        {
+            sum += params->weights[h * inputs + j] * x[j];
+        }
+        units[h] = (sum > 0.0f) ? sum : 0.0f;
+        logit += params->output_weights[h] * units[h];
+    }
+    return logit;
+}
+
+
+/* Stage of cascade_model.c on raw band features: w' = w * scale, b' = b - sum(w' * mean) */
+static void fold_normalization(int hidden, int inputs, const float *mean, const float *scale)
+{
+    for (int h = 0; h < hidden; h++)
+    {
+        double bias = stage_params.bias[h];
+
+        for (int j = 0; j < inputs; j++)
+        {
+            stage_weights[h * inputs + j] = stage_params.weights[h * inputs + j] * scale[j];
+            bias -= (double)stage_weights[h * inputs + j] * mean[j];
+        }
+        stage_bias[h] = (float)bias;
+        stage_output_weights[h] = stage_params.output_weights[h];
+    }
+
+    memset(&stage, 0, sizeof(stage));
+    stage.frames = (uint16_t)window_frames;
+    stage.bands = (uint16_t)window_bands;
+    stage.hidden = (uint16_t)hidden;
+    stage.weights = stage_weights;
+    stage.bias = stage_bias;
+    stage.output_weights = stage_output_weights;
+    stage.output_bias = stage_params.output_bias;
+    /* Band sums and peaks, then the hidden and output layer */
+    stage.macs = (uint32_t)(2 * window_frames * window_bands + hidden * inputs + hidden);
+}
+
+
+/* Escalation and recall at a threshold over the windows outside fold, a
+ * window also runs the network within hangover_windows of a candidate */
+static curve_point_t evaluate(const float *scores, float threshold, int fold)
+{
+    curve_point_t point;
+    int hangover = 0;
+    int has_protected = 0;
+    int detected = 0;
+
+    memset(&point, 0, sizeof(point));
+    for (size_t w = 0; w < corpus.count; w++)
+    {
+        const int candidate = (scores[w] >= threshold);
+        const int escalated = candidate || (hangover > 0);
+        const int top = corpus.top[w];
+
+        hangover = candidate ? hangover_windows : ((hangover > 0) ? hangover - 1 : 0);
+        if (corpus.fold[w] != fold)
+        {
+            point.windows++;
+            point.escalated += escalated;
+            if (corpus.confident[w] && session_is_event(top))
+            {
+                point.events++;
+                point.events_escalated += escalated;
+                point.class_events[top]++;
+                point.class_escalated[top] += escalated;
+                if ((top == CLASS_FIRE) || (top == CLASS_GLASS_BREAKING))
+                {
+                    point.protected_events++;
+                    point.protected_escalated += escalated;
+                    has_protected = 1;
+                    detected |= escalated;
+                }
+            }
+        }
+        /* The windows of a session are contiguous, IMAI_init() restarts the hang-over */
+        if ((w + 1 == corpus.count) || (corpus.session[w + 1] != corpus.session[w]))
+        {
+            point.protected_sessions += has_protected;
+            point.protected_detected += detected;
+            hangover = 0;
+            has_protected = 0;
+            detected = 0;
+        }
+    }
+    return point;
+}
+
+
+/* First stage score of every window */
+static void score_corpus(void)
+{
+    for (size_t w = 0; w < corpus.count; w++)
+    {
+        corpus.scores[w] = cascade_model_score(&corpus.windows[w * window_frames * window_bands]);
+    }
+}
+
+
+/* Highest threshold on the windows outside fold that escalates every
+ * confident fire and glass_breaking window and min_recall of all confident
+ * events. Both only grow as the threshold falls, so the candidate scores
+ * are bisected. */
+static float tune_threshold(double min_recall, int fold)
+{
+    float *candidates = malloc(corpus.count * sizeof(float));
+    size_t count = 0;
+    size_t low = 0;
+    size_t high;
+    float threshold;
+
+    if (candidates == NULL)
+    {
+        return -FLT_MAX;
+    }
+    for (size_t w = 0; w < corpus.count; w++)
+    {
+        if (corpus.fold[w] != fold)
+        {
+            candidates[count++] = corpus.scores[w];
+        }
+    }
+    if (count == 0)
+    {
+        free(candidates);
+        return -FLT_MAX;
+    }
+    qsort(candidates, count, sizeof(float), compare_scores);
+
+    /* Smallest index of the descending scores whose threshold is enough */
+    high = count - 1;
+    while (low < high)
+    {
+        const size_t middle = low + (high - low) / 2;
+        const curve_point_t point = evaluate(corpus.scores, candidates[middle], fold);
+
+        if ((point.protected_escalated == point.protected_events) &&
+            ((double)point.events_escalated >= min_recall * point.events))
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    threshold = candidates[low];
+    free(candidates);
+    return threshold;
+}
+
+
+/* Threshold, share escalated and recalls of all sessions, one row per escalated percent */
+static int write_curve(const char *path)
+{
+    FILE *file;
+    float *sorted = malloc(corpus.count * sizeof(float));
+
+    if (sorted == NULL)
+    {
+        return -1;
+    }
+    file = generator_open(path);
+    if (file == NULL)
+    {
+        free(sorted);
+        return -1;
+    }
+    memcpy(sorted, corpus.scores, corpus.count * sizeof(float));
+    qsort(sorted, corpus.count, sizeof(float), compare_scores);
+
+    fprintf(file, "threshold,escalated,event_recall,fire_recall,glass_breaking_recall,session_recall,macs_per_window\n");
+    for (int percent = 1; percent <= 100; percent++)
+    {
+        const size_t rank = (size_t)((double)percent * corpus.count / 100.0 + 0.5);
+        const float threshold = sorted[((rank > 0) ? rank : 1) - 1];
+        const curve_point_t point = evaluate(corpus.scores, threshold, ALL_FOLDS);
+
+        fprintf(file, "%.6g,%.4f,%.4f,%.4f,%.4f,%.4f,%.0f\n", threshold, (double)point.escalated / point.windows,
+                point.events ? (double)point.events_escalated / point.events : 1.0,
+                point.class_events[CLASS_FIRE] ?
+                    (double)point.class_escalated[CLASS_FIRE] / point.class_events[CLASS_FIRE] : 1.0,
+                point.class_events[CLASS_GLASS_BREAKING] ?
+                    (double)point.class_escalated[CLASS_GLASS_BREAKING] / point.class_events[CLASS_GLASS_BREAKING] : 1.0,
+                point.protected_sessions ? (double)point.protected_detected / point.protected_sessions : 1.0,
+                stage.macs + (double)network_macs * point.escalated / point.windows);
+    }
+    free(sorted);
+    return generator_close(file, path);
+}
+
+
+/* models/model_cascade.c */
+static int write_stage(const char *path, size_t sessions)
+{
+    const int inputs = CASCADE_MODEL_BAND_FEATURES * stage.bands;
+    const unsigned long readonly = (unsigned long)((stage.hidden * inputs + 2 * stage.hidden) * sizeof(float));
+    FILE *file = generator_open(path);
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+    fprintf(file, "/*\n"
+                  " * model_cascade.c\n"
+                  " *\n"
+                  " * Generated by smartlistener_host cascade from the windows of %zu sessions.\n"
+                  " * Any changes will be lost.\n"
+                  " *\n"
+                  " * Memory    Size\n"
+                  " * Readonly  %lu bytes (Flash)\n"
+                  " * Ops       %lu per window, the network does %lu MACs\n"
+                  " */\n\n", sessions, readonly, (unsigned long)stage.macs,
+                  (unsigned long)network_macs);
+    fprintf(file, "#include \"cascade_model.h\"\n\n#if CASCADE_MODEL_ENABLE\n\n");
+    generator_write_floats(file, stage_weights, stage.hidden * inputs, "_weights");
+    generator_write_floats(file, stage_bias, stage.hidden, "_bias");
+    generator_write_floats(file, stage_output_weights, stage.hidden, "_output_weights");
+    fprintf(file, "const cascade_model_t model_cascade = {\n"
+                  "    .frames = %u,\n"
+                  "    .bands = %u,\n"
+                  "    .hidden = %u,\n"
+                  "    .weights = _weights,\n"
+                  "    .bias = _bias,\n"
+                  "    .output_weights = _output_weights,\n"
+                  "    .output_bias = %.9ef,\n"
+                  "    .threshold = %.9ef,\n"
+                  "    .hangover = %u,\n"
+                  "    .macs = %lu,\n"
+                  "};\n\n#endif /* CASCADE_MODEL_ENABLE */\n",
+                  stage.frames, stage.bands, stage.hidden, stage.output_bias, stage.threshold, stage.hangover,
+                  (unsigned long)stage.macs);
+    return generator_close(file, path);
+}
+
+
+static void print_point(const char *name, float threshold, const curve_point_t *point)
+{
+    char value[16];
+
+    snprintf(value, sizeof(value), isnan(threshold) ? "-" : "%.3f", threshold);
+    printf("%-16s %9s %9.1f %% %7.1f %% %7.1f %% %7.1f %% %7.1f %% %15.0f\n", name, value,
+           100.0 * point->escalated / point->windows,
+           point->events ? 100.0 * point->events_escalated / point->events : 100.0,
+           point->class_events[CLASS_FIRE] ?
+               100.0 * point->class_escalated[CLASS_FIRE] / point->class_events[CLASS_FIRE] : 100.0,
+           point->class_events[CLASS_GLASS_BREAKING] ?
+               100.0 * point->class_escalated[CLASS_GLASS_BREAKING] / point->class_events[CLASS_GLASS_BREAKING] : 100.0,
+           point->protected_sessions ? 100.0 * point->protected_detected / point->protected_sessions : 100.0,
+           stage.macs + (double)network_macs * point->escalated / point->windows);
+}
+
+
+/* Descending */
+static int compare_scores(const void *a, const void *b)
+{
+    const float x = *(const float *)a;
+    const float y = *(const float *)b;
+
+    return (x < y) - (x > y);
+}
+
+
+/* Uniform in [0, 1), xorshift32 */
+static float random_uniform(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (random_state >> 8) * (1.0f / 16777216.0f);
+}
+
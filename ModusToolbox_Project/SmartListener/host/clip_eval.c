@@ -0,0 +1,327 @@
+/*
+ * clip_eval.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Round trip of the event clip path (event_clip.c, adpcm.c) on a
+ * recording. The recording is fed to the pre-roll recorder in capture
+ * blocks, a clip is captured every EVENT_CLIP_SECONDS as if an event had
+ * been confirmed, every clip is cut into MQTT chunks, the chunks are parsed
+ * and decoded like the backend would and the result is compared with the
+ * original samples and with one continuous ADPCM encode/decode of the
+ * recording, which the chunks must match exactly. --drop N discards every
+ * Nth chunk to check that the remaining chunks still decode in place.
+ *
+ * IMA-ADPCM reaches about 27 dB SNR on a tone but only 13-20 dB on
+ * broadband sounds, so the codec is also checked on a 1 kHz tone.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_capture.h"
+#include "event_clip.h"
+#include "tone.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Clip rate, the model input rate */
+#define CLIP_SAMPLE_RATE_HZ             (16000)
+
+/* Lowest accepted SNR of a 1 kHz tone at -12 dBFS */
+#define MIN_TONE_SNR_DB                 (25.0)
+
+/* Core clock of the CM4, used to express the encode cost as CPU load */
+#define CM4_CLOCK_HZ                    (150000000.0)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static event_clip_recorder_t recorder;
+static event_clip_t clip;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int check_clip(const int16_t *original, const int16_t *reference, size_t end, int drop,
+                      double *signal, double *error, size_t *chunks, size_t *dropped, size_t *bytes);
+static int16_t *stream_round_trip(const int16_t *src, size_t count);
+static double round_trip_tone_snr(void);
+
+
+/*******************************************************************************
+* Function Name: clip_eval_main
+********************************************************************************
+* Summary:
+*    smartlistener_host clip-eval <file.wav> [--drop N]
+*
+*******************************************************************************/
+int clip_eval_main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    int drop = 0;
+    wav_t wav;
+    int16_t *pcm;
+    int16_t *reference;
+    double tone_snr;
+    size_t since_capture = 0;
+    size_t clips = 0;
+    size_t chunks = 0;
+    size_t dropped = 0;
+    size_t bytes = 0;
+    double signal = 0.0;
+    double error = 0.0;
+    double worst_snr = INFINITY;
+    uint64_t cycles = 0;
+    uint64_t start;
+    double cycles_per_sample;
+    int ok = 1;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--drop") == 0) && (i + 1 < argc))
+        {
+            drop = atoi(argv[++i]);
+        }
+        else if ((argv[i][0] != '-') && (path == NULL))
+        {
+            path = argv[i];
+        }
+        else
+        {
+            path = NULL;
+            break;
+        }
+    }
+    if (path == NULL)
+    {
+        fprintf(stderr, "usage: smartlistener_host clip-eval <file.wav> [--drop N]\n");
+        return 1;
+    }
+
+    if (wav_load(path, &wav) != 0)
+    {
+        return 1;
+    }
+    if (wav.sample_rate != CLIP_SAMPLE_RATE_HZ)
+    {
+        fprintf(stderr, "Expected a %d Hz recording, got %d Hz\n", CLIP_SAMPLE_RATE_HZ, wav.sample_rate);
+        wav_free(&wav);
+        return 1;
+    }
+
+    /* First channel only, as the ML task records the left microphone */
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    if (pcm == NULL)
+    {
+        wav_free(&wav);
+        return 1;
+    }
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+
+    reference = stream_round_trip(pcm, wav.frames);
+    if (reference == NULL)
+    {
+        free(pcm);
+        wav_free(&wav);
+        return 1;
+    }
+
+    event_clip_recorder_init(&recorder, CLIP_SAMPLE_RATE_HZ);
+    event_clip_init(&clip);
+
+    for (size_t offset = 0; offset + AUDIO_CAPTURE_BLOCK_SIZE <= wav.frames; offset += AUDIO_CAPTURE_BLOCK_SIZE)
+    {
+        start = read_cycles();
+        event_clip_recorder_write(&recorder, &pcm[offset], AUDIO_CAPTURE_BLOCK_SIZE, 1);
+        cycles += read_cycles() - start;
+
+        since_capture += AUDIO_CAPTURE_BLOCK_SIZE;
+        if (since_capture >= EVENT_CLIP_SECONDS * CLIP_SAMPLE_RATE_HZ)
+        {
+            double clip_signal = 0.0;
+            double clip_error = 0.0;
+
+            since_capture = 0;
+            if (event_clip_capture(&recorder, &clip, (uint16_t) clips, "clip_eval") != 0)
+            {
+                fprintf(stderr, "Clip still busy\n");
+                ok = 0;
+                break;
+            }
+            if (check_clip(pcm, reference, offset + AUDIO_CAPTURE_BLOCK_SIZE, drop, &clip_signal, &clip_error,
+                           &chunks, &dropped, &bytes) != 0)
+            {
+                ok = 0;
+            }
+            event_clip_release(&clip);
+
+            signal += clip_signal;
+            error += clip_error;
+            if (clip_signal > 0.0)
+            {
+                double snr = 10.0 * log10(clip_signal / (clip_error + 1e-9));
+                worst_snr = (snr < worst_snr) ? snr : worst_snr;
+            }
+            clips++;
+        }
+    }
+
+    cycles_per_sample = (double) cycles / (double)(wav.frames - wav.frames % AUDIO_CAPTURE_BLOCK_SIZE);
+    tone_snr = round_trip_tone_snr();
+
+    printf("Recording:             %s (%.1f s)\n", path, (double) wav.frames / CLIP_SAMPLE_RATE_HZ);
+    printf("Clips:                 %zu of %d s, %zu chunks (%zu dropped)\n", clips, EVENT_CLIP_SECONDS,
+           chunks, dropped);
+    printf("Pre-roll memory:       %zu bytes ADPCM for %zu bytes PCM (%.2fx)\n",
+           sizeof(recorder.blocks), (size_t) EVENT_CLIP_BLOCKS * EVENT_CLIP_BLOCK_SAMPLES * sizeof(int16_t),
+           (double)(EVENT_CLIP_BLOCKS * EVENT_CLIP_BLOCK_SAMPLES * sizeof(int16_t)) / sizeof(recorder.blocks));
+    if (clips > 0)
+    {
+        printf("Upload per clip:       %zu bytes in %zu chunks\n", bytes / clips, chunks / clips);
+    }
+    printf("Round trip SNR:        %.1f dB overall, %.1f dB worst clip (1 kHz tone: %.1f dB)\n",
+           10.0 * log10(signal / (error + 1e-9)), worst_snr, tone_snr);
+    printf("Encode cost:           %.1f cycles/sample, %.2f%% of a %.0f MHz core at %d Hz\n",
+           cycles_per_sample, 100.0 * cycles_per_sample * CLIP_SAMPLE_RATE_HZ / CM4_CLOCK_HZ,
+           CM4_CLOCK_HZ / 1e6, CLIP_SAMPLE_RATE_HZ);
+
+    if ((clips == 0) || (tone_snr < MIN_TONE_SNR_DB))
+    {
+        ok = 0;
+    }
+    printf("\nResult:                %s (chunks match the continuous stream, tone SNR >= %.0f dB)\n",
+           ok ? "PASS" : "FAIL", MIN_TONE_SNR_DB);
+
+    free(reference);
+    free(pcm);
+    wav_free(&wav);
+    return ok ? 0 : 1;
+}
+
+
+/*******************************************************************************
+* Function Name: check_clip
+********************************************************************************
+* Summary:
+*    Sends the captured clip through the chunker and the receiver and
+*    accumulates the signal and error energy of the decoded samples. The
+*    clip ends at the last complete ADPCM block before end.
+*
+* Parameters:
+*    original       Recording
+*    reference      Continuous ADPCM round trip of the recording
+*    end            Samples written to the recorder so far
+*    drop           Discard every drop-th chunk, 0 to keep all
+*    signal         Signal energy of the received samples, set
+*    error          Error energy of the received samples, set
+*    chunks         Chunk counter, incremented
+*    dropped        Dropped chunk counter, incremented
+*    bytes          Payload byte counter, incremented
+*
+* Return:
+*    0 if every received chunk parsed and matched the reference, else -1
+*
+*******************************************************************************/
+static int check_clip(const int16_t *original, const int16_t *reference, size_t end, int drop,
+                      double *signal, double *error, size_t *chunks, size_t *dropped, size_t *bytes)
+{
+    static uint8_t payload[EVENT_CLIP_CHUNK_BYTES];
+    static int16_t decoded[EVENT_CLIP_CHUNK_BLOCKS * EVENT_CLIP_BLOCK_SAMPLES];
+    uint16_t count = event_clip_chunk_count(&clip);
+    size_t first = end - end % EVENT_CLIP_BLOCK_SAMPLES - (size_t) clip.block_count * EVENT_CLIP_BLOCK_SAMPLES;
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        event_clip_chunk_info_t info;
+        size_t length = event_clip_chunk(&clip, i, payload, sizeof(payload));
+
+        (*chunks)++;
+        *bytes += length;
+        if ((drop > 0) && ((*chunks % drop) == 0))
+        {
+            (*dropped)++;
+            continue;
+        }
+
+        if ((length == 0) || (event_clip_parse_chunk(payload, length, &info, decoded) != 0) ||
+            (info.chunk_index != i) || (info.chunk_count != count) || (info.clip_id != clip.id) ||
+            (strcmp(info.label, clip.label) != 0))
+        {
+            fprintf(stderr, "Chunk %u of clip %u is malformed\n", (unsigned int) i, (unsigned int) clip.id);
+            return -1;
+        }
+
+        if (memcmp(decoded, &reference[first + info.first_sample], info.sample_count * sizeof(int16_t)) != 0)
+        {
+            fprintf(stderr, "Chunk %u of clip %u differs from the stream\n", (unsigned int) i, (unsigned int) clip.id);
+            return -1;
+        }
+
+        for (uint32_t n = 0; n < info.sample_count; n++)
+        {
+            double x = original[first + info.first_sample + n];
+            double e = decoded[n] - x;
+            *signal += x * x;
+            *error += e * e;
+        }
+    }
+    return 0;
+}
+
+
+/* Encodes and decodes the whole recording as one stream */
+static int16_t *stream_round_trip(const int16_t *src, size_t count)
+{
+    uint8_t *codes = malloc((count + 1) / 2);
+    int16_t *dst = malloc(count * sizeof(int16_t));
+    adpcm_state_t encoder;
+    adpcm_state_t decoder;
+
+    if ((codes == NULL) || (dst == NULL))
+    {
+        free(codes);
+        free(dst);
+        return NULL;
+    }
+
+    adpcm_init(&encoder);
+    adpcm_init(&decoder);
+    adpcm_encode(&encoder, src, count, 1, codes);
+    adpcm_decode(&decoder, codes, count, dst);
+    free(codes);
+    return dst;
+}
+
+
+/* SNR of the ADPCM round trip of a 1 kHz tone at -12 dBFS */
+static double round_trip_tone_snr(void)
+{
+    int16_t tone[CLIP_SAMPLE_RATE_HZ];
+    int16_t *decoded;
+    double snr;
+
+    tone_fill(tone, 0, CLIP_SAMPLE_RATE_HZ, 1000.0, 8192.0, CLIP_SAMPLE_RATE_HZ);
+    decoded = stream_round_trip(tone, CLIP_SAMPLE_RATE_HZ);
+    if (decoded == NULL)
+    {
+        return 0.0;
+    }
+    snr = tone_snr_db(decoded, 0, CLIP_SAMPLE_RATE_HZ, 1000.0, 8192.0, CLIP_SAMPLE_RATE_HZ);
+    free(decoded);
+    return snr;
+}
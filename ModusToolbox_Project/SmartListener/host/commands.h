@@ -0,0 +1,61 @@
+/*
+ * commands.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Entry points of the smartlistener_host sub-commands, see main.c.
+ */
+
+#ifndef HOST_COMMANDS_H_
+#define HOST_COMMANDS_H_
+
+#include <stdint.h>
+#include <time.h>
+
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int replay_main(int argc, char *argv[]);
+int bench_enqueue_main(int argc, char *argv[]);
+int bench_ingest_main(int argc, char *argv[]);
+int gate_eval_main(int argc, char *argv[]);
+int ring_stress_main(int argc, char *argv[]);
+int stereo_eval_main(int argc, char *argv[]);
+int bench_resample_main(int argc, char *argv[]);
+int clip_eval_main(int argc, char *argv[]);
+int bench_window_main(int argc, char *argv[]);
+int q15_eval_main(int argc, char *argv[]);
+int bench_mel_main(int argc, char *argv[]);
+int bench_features_main(int argc, char *argv[]);
+int stream_eval_main(int argc, char *argv[]);
+int frontend_check_main(int argc, char *argv[]);
+int bus_eval_main(int argc, char *argv[]);
+int level_cal_main(int argc, char *argv[]);
+int stage_profile_main(int argc, char *argv[]);
+int model_eval_main(int argc, char *argv[]);
+int quantize_main(int argc, char *argv[]);
+int cascade_main(int argc, char *argv[]);
+int layer_profile_main(int argc, char *argv[]);
+int memory_plan_main(int argc, char *argv[]);
+int arena_calibrate_main(int argc, char *argv[]);
+
+/* Monotonic time in nanoseconds */
+static inline uint64_t host_now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/* Cycle counter of the benches, nanoseconds where there is no TSC */
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define read_cycles()                   __rdtsc()
+#else
+#define read_cycles()                   host_now_ns()
+#endif
+
+
+#endif /* HOST_COMMANDS_H_ */
@@ -0,0 +1,261 @@
+/*
+ * frontend_check.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Checks the front-end tables that frontend.hpp generates at compile time
+ * against the arrays DEEPCRAFT baked into models/model.c (_K18, _K23, _K24)
+ * and into the preprocessor sampler.c of the model project (_K6, _K13). The
+ * arrays are read from the C sources, so the check also works when the
+ * host is built with FRONTEND_CONSTEXPR_ENABLE. With a recording, every hop
+ * also goes through frontend_frame() and through the model.c chain with the
+ * baked tables, and the log-mel frames must be bit-identical.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "mel_log.h"
+#include "frontend.h"
+#include "arm_math.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define DEFAULT_MODEL_FILE              "../source/models/model.c"
+#define DEFAULT_SAMPLER_FILE            "../../../ML_Model/SmartListener_Model/PreprocessorTrack/.factory/sampler.c"
+
+/* Same constants as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define MEL_FLOOR                       (0.00031f)
+
+#define TABLE_WORDS_MAX                 (1024)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint32_t words[TABLE_WORDS_MAX];
+    int count;
+} table_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int load_table(const char *path, const char *name, table_t *table);
+static int compare(const char *what, const void *generated, const void *baked, size_t bytes);
+static int check_frames(const char *path, const table_t *window, const table_t *points, const table_t *coefs);
+
+
+/*******************************************************************************
+* Function Name: frontend_check_main
+********************************************************************************
+* Summary:
+*    smartlistener_host frontend-check [<file.wav>] [--model FILE] [--sampler FILE]
+*
+*******************************************************************************/
+int frontend_check_main(int argc, char *argv[])
+{
+    const char *wav_path = NULL;
+    const char *model_path = DEFAULT_MODEL_FILE;
+    const char *sampler_path = DEFAULT_SAMPLER_FILE;
+    static table_t window;
+    static table_t points;
+    static table_t coefs;
+    static table_t sampler_window;
+    static table_t sampler_points;
+    int32_t generated_points[FRONTEND_MEL_BANDS + 2];
+    int failures = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--model") == 0) && (i + 1 < argc))
+        {
+            model_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--sampler") == 0) && (i + 1 < argc))
+        {
+            sampler_path = argv[++i];
+        }
+        else if (argv[i][0] != '-')
+        {
+            wav_path = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host frontend-check [<file.wav>] [--model FILE] [--sampler FILE]\n");
+            return 1;
+        }
+    }
+
+    if ((load_table(model_path, "_K18", &window) != 0) || (load_table(model_path, "_K23", &points) != 0) ||
+        (load_table(model_path, "_K24", &coefs) != 0) || (load_table(sampler_path, "_K6", &sampler_window) != 0) ||
+        (load_table(sampler_path, "_K13", &sampler_points) != 0))
+    {
+        return 1;
+    }
+
+    printf("Configuration:             FFT %d, hop %d, %d mel bands, %d Hz\n",
+        FRONTEND_FFT_LEN, FRONTEND_HOP, FRONTEND_MEL_BANDS, FRONTEND_SAMPLE_RATE);
+    printf("Filter coefficients:       %d generated, %d baked\n", frontend_filter_coef_count(), coefs.count);
+    if (coefs.count != frontend_filter_coef_count())
+    {
+        failures++;
+    }
+    else
+    {
+        failures += compare("model.c _K24 mel coefs", frontend_filter_coefs(), coefs.words,
+                            coefs.count * sizeof(float));
+    }
+    failures += compare("model.c _K18 window", frontend_window(), window.words,
+                        (window.count == FRONTEND_FFT_LEN) ? FRONTEND_FFT_LEN * sizeof(float) : 0);
+    failures += compare("model.c _K23 mel points", frontend_filter_points(), points.words,
+                        (points.count * 2 == FRONTEND_MEL_BANDS + 2) ? points.count * sizeof(uint32_t) : 0);
+    failures += compare("sampler.c _K6 window", frontend_window(), sampler_window.words,
+                        (sampler_window.count == FRONTEND_FFT_LEN) ? FRONTEND_FFT_LEN * sizeof(float) : 0);
+    for (int i = 0; i < FRONTEND_MEL_BANDS + 2; i++)
+    {
+        generated_points[i] = frontend_filter_points()[i];
+    }
+    failures += compare("sampler.c _K13 mel points", generated_points, sampler_points.words,
+                        (sampler_points.count == FRONTEND_MEL_BANDS + 2) ? sizeof(generated_points) : 0);
+
+    if (wav_path != NULL)
+    {
+        int result = check_frames(wav_path, &window, &points, &coefs);
+
+        if (result < 0)
+        {
+            return 1;
+        }
+        failures += result;
+    }
+
+    printf("Result:                    %s\n", (failures == 0) ? "PASS" : "FAIL");
+    return (failures == 0) ? 0 : 1;
+}
+
+
+/* Reads the words of "static const uint32_t <name>[] = { ... };" */
+static int load_table(const char *path, const char *name, table_t *table)
+{
+    FILE *file = fopen(path, "r");
+    char line[1024];
+    char header[64];
+    int inside = 0;
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+    snprintf(header, sizeof(header), "static const uint32_t %s[] = {", name);
+    table->count = 0;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char *p = line;
+
+        if (!inside)
+        {
+            inside = (strncmp(line, header, strlen(header)) == 0);
+            continue;
+        }
+        if (strstr(line, "};") != NULL)
+        {
+            fclose(file);
+            return 0;
+        }
+        while ((p = strstr(p, "0x")) != NULL)
+        {
+            if (table->count == TABLE_WORDS_MAX)
+            {
+                fclose(file);
+                fprintf(stderr, "%s of %s is too large\n", name, path);
+                return -1;
+            }
+            table->words[table->count++] = (uint32_t)strtoul(p, &p, 16);
+        }
+    }
+    fclose(file);
+    fprintf(stderr, "%s not found in %s\n", name, path);
+    return -1;
+}
+
+
+/* Bit-exact comparison, bytes is 0 if the sizes already differ */
+static int compare(const char *what, const void *generated, const void *baked, size_t bytes)
+{
+    int same = (bytes > 0) && (memcmp(generated, baked, bytes) == 0);
+
+    printf("%-26s %s\n", what, same ? "bit-identical" : "DIFFERENT");
+    return same ? 0 : 1;
+}
+
+
+/* Frames of the generated front-end against the model.c chain with the
+ * baked tables. Returns the number of failures or -1 on error. */
+static int check_frames(const char *path, const table_t *window, const table_t *points, const table_t *coefs)
+{
+    wav_t wav;
+    int16_t *pcm;
+    float *samples;
+    arm_rfft_fast_instance_f32 rfft;
+    float temp_a[FRONTEND_FFT_LEN];
+    float temp_b[FRONTEND_FFT_LEN];
+    float baked[FRONTEND_MEL_BANDS];
+    float generated[FRONTEND_MEL_BANDS];
+    uint64_t frames = 0;
+    uint64_t mismatches = 0;
+
+    if (wav_load(path, &wav) != 0)
+    {
+        return -1;
+    }
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    samples = malloc(wav.frames * sizeof(float));
+    if ((pcm == NULL) || (samples == NULL) || (frontend_init(&rfft) != 0))
+    {
+        free(pcm);
+        free(samples);
+        wav_free(&wav);
+        return -1;
+    }
+
+    /* Channel 0, converted the same way ml_task.c does */
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+    audio_ingest_block(pcm, samples, wav.frames, DIGITAL_BOOST_FACTOR);
+
+    for (size_t start = 0; start + FRONTEND_FFT_LEN <= wav.frames; start += FRONTEND_HOP)
+    {
+        /* hannmul_cmsis_f32() and rfft_mel_log_cmsis_f32() of model.c */
+        arm_mult_f32(&samples[start], (const float *)window->words, temp_a, FRONTEND_FFT_LEN);
+        arm_rfft_fast_f32(&rfft, temp_a, temp_b, 0);
+        mel_log_f32(temp_b, temp_a, FRONTEND_FFT_LEN, (const int16_t *)points->words, (const float *)coefs->words,
+                    FRONTEND_MEL_BANDS, MEL_FLOOR, baked);
+
+        frontend_frame(&rfft, &samples[start], temp_a, temp_b, generated);
+        if (memcmp(baked, generated, sizeof(baked)) != 0)
+        {
+            mismatches++;
+        }
+        frames++;
+    }
+
+    printf("Recording:                 %s\n", path);
+    printf("Log-mel frames:            %llu of %llu differ\n", (unsigned long long)mismatches,
+        (unsigned long long)frames);
+
+    free(pcm);
+    free(samples);
+    wav_free(&wav);
+    return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+/*
+ * gate_eval.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Runs every recorded session through the model front-end with the activity
+ * gate enabled (it is off by default) and compares the gated output with the
+ * predictions DEEPCRAFT Studio exported for the same recordings. A skipped
+ * window is reported as "unlabelled", so the output only changes where the
+ * gate skipped a window whose reference prediction was something else.
+ * Changes to "unknown" are harmless, ml_task.c ignores both; skipped windows
+ * where the reference is an event class above the ml_task.c confidence
+ * threshold are counted separately, and any of them fails the run. Sessions
+ * that are mostly below QUIET_LEVEL_DBFS are also summarised as "quiet".
+ *
+ * The sessions are played in chronological order and, like on the device,
+ * the gate keeps its noise floor from one to the next. --reset restarts it
+ * for every session instead, which is pessimistic: most recordings start
+ * with the event, so the floor is learned on the event itself.
+ *
+ * With CASCADE_MODEL_ENABLE the windows the first stage of the cascade
+ * answers count as skipped too, so the table is that of the whole cascade.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "sessions.h"
+#include "wav.h"
+#include "activity_gate.h"
+#include "cascade_model.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* A session is quiet when three quarters of its 20 ms frames are below this level */
+#define QUIET_LEVEL_DBFS                (-50.0f)
+#define LEVEL_FRAME_SIZE                (320)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    size_t sessions;
+    size_t windows;
+    size_t skipped;                 /* Windows answered by the gate */
+    size_t changed;                 /* Skipped windows whose reference was not unlabelled */
+    size_t events;                  /* Skipped windows with a confident event reference */
+    size_t event_windows;           /* Windows with a confident event reference */
+} gate_tally_t;
+
+/* Tallies of the walk and of the session being played */
+typedef struct {
+    float gain;
+    int reset;
+    int verbose;
+    gate_tally_t per_class[SESSION_NUM_CLASSES];
+    gate_tally_t quiet;
+    gate_tally_t total;
+    const session_t *session;
+    gate_tally_t tally;
+    activity_gate_stats_t gate;         /* Counters after the last window */
+    cascade_model_stats_t cascade;
+} gate_walk_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+static void check_window(size_t window, const float *scores, void *context);
+static int is_quiet(const wav_t *wav);
+static void add_tally(gate_tally_t *sum, const gate_tally_t *tally);
+static void print_gate_row(const char *name, const gate_tally_t *tally);
+
+
+/*******************************************************************************
+* Function Name: gate_eval_main
+********************************************************************************
+* Summary:
+*    smartlistener_host gate-eval [--data DIR] [--pred DIR] [--energy X]
+*        [--flux X] [--hangover N] [--gain X] [--reset] [--verbose]
+*
+*******************************************************************************/
+int gate_eval_main(int argc, char *argv[])
+{
+    const char *data_dir = SESSION_DEFAULT_DATA_DIR;
+    const char *pred_dir = SESSION_DEFAULT_PRED_DIR;
+    activity_gate_config_t config;
+    gate_walk_t walk = { .gain = 1.0f };
+
+    activity_gate_get_config(&config);
+    config.enabled = 1;
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--data") == 0) && (i + 1 < argc))
+        {
+            data_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--pred") == 0) && (i + 1 < argc))
+        {
+            pred_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--energy") == 0) && (i + 1 < argc))
+        {
+            config.energy_threshold = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--flux") == 0) && (i + 1 < argc))
+        {
+            config.flux_threshold = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--hangover") == 0) && (i + 1 < argc))
+        {
+            config.hangover_frames = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--gain") == 0) && (i + 1 < argc))
+        {
+            walk.gain = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--reset") == 0)
+        {
+            walk.reset = 1;
+        }
+        else if (strcmp(argv[i], "--verbose") == 0)
+        {
+            walk.verbose = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host gate-eval [--data DIR] [--pred DIR] [--energy X] "
+                "[--flux X] [--hangover N] [--gain X] [--reset] [--verbose]\n");
+            return 1;
+        }
+    }
+    activity_gate_set_config(&config);
+    activity_gate_init();
+
+    if (session_walk(data_dir, pred_dir, 1, run_session, &walk) < 0)
+    {
+        return 1;
+    }
+    IMAI_finalize();
+
+    printf("Gate: energy %.2f  flux %.2f  hang-over %lu frames\n",
+        config.energy_threshold, config.flux_threshold, (unsigned long)config.hangover_frames);
+#if CASCADE_MODEL_ENABLE
+    {
+        cascade_model_config_t cascade;
+
+        cascade_model_get_config(&cascade);
+        printf("Cascade: threshold %.3f  hang-over %lu windows\n", cascade.threshold,
+            (unsigned long)cascade.hangover_windows);
+    }
+#endif
+    printf("%-16s %8s %8s %8s %10s %8s %8s\n", "Session label", "Sessions", "Windows", "Skipped",
+        "Model cut", "Changed", "Events");
+    for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+    {
+        if (walk.per_class[c].sessions > 0)
+        {
+            print_gate_row(session_class_name(c), &walk.per_class[c]);
+        }
+    }
+    print_gate_row("quiet", &walk.quiet);
+    print_gate_row("all", &walk.total);
+    /* The gate must never drop an onset */
+    printf("Result:                    %s (%zu of %zu confident event windows skipped)\n",
+        (walk.total.events == 0) ? "PASS" : "FAIL", walk.total.events, walk.total.event_windows);
+    return (walk.total.events == 0) ? 0 : 1;
+}
+
+
+/*******************************************************************************
+* Function Name: run_session
+********************************************************************************
+* Summary:
+*    Feeds one recording to the model in capture sized blocks and compares
+*    every window the gate skipped with the reference prediction.
+*
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    gate_walk_t *walk = context;
+    gate_tally_t *tally = &walk->tally;
+    size_t windows;
+
+    (void) index;
+    if (walk->reset)
+    {
+        activity_gate_init();
+    }
+    memset(tally, 0, sizeof(*tally));
+    walk->session = session;
+    activity_gate_get_stats(&walk->gate);
+    /* IMAI_init() clears the counters of the cascade */
+    memset(&walk->cascade, 0, sizeof(walk->cascade));
+    if (session_play(wav, walk->gain, check_window, walk, &windows) != 0)
+    {
+        return;
+    }
+
+    if (windows != session->windows)
+    {
+        fprintf(stderr, "%s: %zu windows, %zu reference predictions\n", session->name, windows, session->windows);
+    }
+    tally->windows = (windows < session->windows) ? windows : session->windows;
+    if (walk->verbose)
+    {
+        printf("%s %-16s windows %3zu skipped %3zu changed %3zu events %3zu\n", session->name,
+            session_class_name(session->label), tally->windows, tally->skipped, tally->changed, tally->events);
+    }
+
+    if (session->label >= 0)
+    {
+        add_tally(&walk->per_class[session->label], tally);
+    }
+    if (is_quiet(wav))
+    {
+        add_tally(&walk->quiet, tally);
+    }
+    add_tally(&walk->total, tally);
+}
+
+
+/* A block completes at most one window, so the skip counters that moved
+ * since the last window tell whether the gate or the cascade answered it */
+static void check_window(size_t window, const float *scores, void *context)
+{
+    gate_walk_t *walk = context;
+    const session_t *session = walk->session;
+    activity_gate_stats_t gate;
+    cascade_model_stats_t cascade;
+    int skipped;
+
+    (void) scores;
+    activity_gate_get_stats(&gate);
+    cascade_model_get_stats(&cascade);
+    skipped = (gate.skipped_windows != walk->gate.skipped_windows) ||
+              (cascade.windows - cascade.escalated != walk->cascade.windows - walk->cascade.escalated);
+    walk->gate = gate;
+    walk->cascade = cascade;
+
+    if (window < session->windows)
+    {
+        int reference = session_argmax(session->predictions[window]);
+        int event = session_is_event(reference) &&
+                    (session->predictions[window][reference] >= SESSION_EVENT_SCORE);
+
+        walk->tally.event_windows += event;
+        if (skipped)
+        {
+            walk->tally.skipped++;
+            walk->tally.changed += (reference != ACTIVITY_GATE_IDLE_LABEL);
+            walk->tally.events += event;
+        }
+    }
+}
+
+
+static void print_gate_row(const char *name, const gate_tally_t *tally)
+{
+    size_t runs = tally->windows - tally->skipped;
+
+    printf("%-16s %8zu %8zu %8zu ", name, tally->sessions, tally->windows, tally->skipped);
+    if (runs > 0)
+    {
+        printf("%9.2fx", (double)tally->windows / (double)runs);
+    }
+    else
+    {
+        printf("%10s", "inf");
+    }
+    printf(" %8zu %8zu\n", tally->changed, tally->events);
+}
+
+
+/* Three quarters of the 20 ms frames of channel 0 below QUIET_LEVEL_DBFS */
+static int is_quiet(const wav_t *wav)
+{
+    const double threshold = 32768.0 * pow(10.0, QUIET_LEVEL_DBFS / 20.0);
+    size_t frames = wav->frames / LEVEL_FRAME_SIZE;
+    size_t below = 0;
+
+    for (size_t f = 0; f < frames; f++)
+    {
+        double energy = 0.0;
+        for (size_t i = f * LEVEL_FRAME_SIZE; i < (f + 1) * LEVEL_FRAME_SIZE; i++)
+        {
+            double sample = wav->samples[i * wav->channels];
+            energy += sample * sample;
+        }
+        below += (sqrt(energy / LEVEL_FRAME_SIZE) < threshold);
+    }
+    return (frames > 0) && (4 * below >= 3 * frames);
+}
+
+
+static void add_tally(gate_tally_t *sum, const gate_tally_t *tally)
+{
+    sum->sessions++;
+    sum->windows += tally->windows;
+    sum->skipped += tally->skipped;
+    sum->changed += tally->changed;
+    sum->events += tally->events;
+    sum->event_windows += tally->event_windows;
+}
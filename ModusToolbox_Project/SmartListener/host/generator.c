@@ -0,0 +1,224 @@
+/*
+ * generator.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Shared by the commands that write C for the firmware (quantize,
+ * cascade, arena-calibrate): the graph of the flatbuffer model.c gave the
+ * host interpreter, its cost, and the output file with its constant arrays.
+ */
+
+#include "generator.h"
+
+#include <stdarg.h>
+
+#include "mtb_ml_model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define NAME_MAX_LEN                    (64)
+
+#define LSTM_GATES                      (4)
+#define LSTM_INPUT_WEIGHTS              (1)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void write_name(FILE *file, const char *type, int count, const char *format, va_list args);
+
+
+/*******************************************************************************
+* Function Name: generator_load_graph
+********************************************************************************
+* Summary:
+*    Opens the flatbuffer model.c gave the host interpreter and reads its
+*    tensors and operators. Call after IMAI_init().
+*
+* Parameters:
+*    graph          Filled with the model
+*    tensors        Filled with every tensor, or NULL
+*    max_tensors    Size of tensors
+*    operators      Filled with every operator
+*    max_operators  Size of operators
+*
+* Return:
+*    0 on success, -1 if there is no model or it does not fit
+*
+*******************************************************************************/
+int generator_load_graph(tflite_model_t *graph, tflite_tensor_t *tensors, int max_tensors,
+                         tflite_operator_t *operators, int max_operators)
+{
+    const mtb_ml_model_bin_t *bin = mtb_ml_model_host_bin();
+
+    if ((bin == NULL) || (tflite_model_open(graph, bin->model_bin, bin->model_size) != 0) ||
+        ((tensors != NULL) && (graph->tensor_count > max_tensors)) || (graph->operator_count > max_operators))
+    {
+        return -1;
+    }
+    for (int t = 0; (tensors != NULL) && (t < graph->tensor_count); t++)
+    {
+        if (tflite_model_get_tensor(graph, t, &tensors[t]) != 0)
+        {
+            return -1;
+        }
+    }
+    for (int i = 0; i < graph->operator_count; i++)
+    {
+        if (tflite_model_get_operator(graph, i, &operators[i]) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: generator_count_macs
+********************************************************************************
+* Summary:
+*    Multiply-accumulates of one window of the graph of
+*    generator_load_graph(), padded taps included.
+*
+*******************************************************************************/
+uint32_t generator_count_macs(const tflite_model_t *graph, const tflite_tensor_t *tensors,
+                              const tflite_operator_t *operators)
+{
+    uint32_t macs = 0;
+
+    for (int i = 0; i < graph->operator_count; i++)
+    {
+        const tflite_operator_t *op = &operators[i];
+        const tflite_tensor_t *input = &tensors[op->inputs[0]];
+        const tflite_tensor_t *output = &tensors[op->outputs[0]];
+
+        switch (op->code)
+        {
+            case TFLITE_OP_CONV_2D:
+                macs += (uint32_t)tflite_tensor_elements(output) * tensors[op->inputs[1]].shape[2] * input->shape[3];
+                break;
+            case TFLITE_OP_FULLY_CONNECTED:
+                macs += (uint32_t)tflite_tensor_elements(output) * tensors[op->inputs[1]].shape[1];
+                break;
+            case TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM:
+                macs += (uint32_t)tflite_tensor_elements(output) * LSTM_GATES *
+                        (input->shape[2] + tensors[op->inputs[LSTM_INPUT_WEIGHTS]].shape[0]);
+                break;
+            default:
+                break;
+        }
+    }
+    return macs;
+}
+
+
+FILE *generator_open(const char *path)
+{
+    FILE *file = fopen(path, "w");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open %s for writing\n", path);
+    }
+    return file;
+}
+
+
+int generator_close(FILE *file, const char *path)
+{
+    if (fclose(file) != 0)
+    {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: generator_write_floats
+********************************************************************************
+* Summary:
+*    Writes "static const float <name>[count] = { ... };", nothing for a
+*    count of 0. The name is formatted like printf(). generator_write_int8()
+*    and generator_write_int32() do the same for their types.
+*
+* Parameters:
+*    file           Output file
+*    values         Array to write
+*    count          Number of values
+*    format         Name of the array
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void generator_write_floats(FILE *file, const float *values, int count, const char *format, ...)
+{
+    va_list args;
+
+    if (count == 0)
+    {
+        return;
+    }
+    va_start(args, format);
+    write_name(file, "float", count, format, args);
+    va_end(args);
+    for (int i = 0; i < count; i++)
+    {
+        /* 9 significant digits read back as the same float */
+        fprintf(file, "%s%.8ef,", (i % 6 == 0) ? "\n    " : " ", values[i]);
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+
+void generator_write_int8(FILE *file, const int8_t *values, int count, const char *format, ...)
+{
+    va_list args;
+
+    if (count == 0)
+    {
+        return;
+    }
+    va_start(args, format);
+    write_name(file, "int8_t", count, format, args);
+    va_end(args);
+    for (int i = 0; i < count; i++)
+    {
+        fprintf(file, "%s%d,", (i % 16 == 0) ? "\n    " : " ", values[i]);
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+
+void generator_write_int32(FILE *file, const int32_t *values, int count, const char *format, ...)
+{
+    va_list args;
+
+    if (count == 0)
+    {
+        return;
+    }
+    va_start(args, format);
+    write_name(file, "int32_t", count, format, args);
+    va_end(args);
+    for (int i = 0; i < count; i++)
+    {
+        fprintf(file, "%s%ld,", (i % 8 == 0) ? "\n    " : " ", (long)values[i]);
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+
+/* "static const <type> <name>[count] = {" */
+static void write_name(FILE *file, const char *type, int count, const char *format, va_list args)
+{
+    char name[NAME_MAX_LEN];
+
+    vsnprintf(name, sizeof(name), format, args);
+    fprintf(file, "static const %s %s[%d] = {", type, name, count);
+}
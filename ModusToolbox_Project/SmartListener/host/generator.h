@@ -0,0 +1,34 @@
+/*
+ * generator.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef HOST_GENERATOR_H_
+#define HOST_GENERATOR_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "tflite_model.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int generator_load_graph(tflite_model_t *graph, tflite_tensor_t *tensors, int max_tensors,
+                         tflite_operator_t *operators, int max_operators);
+uint32_t generator_count_macs(const tflite_model_t *graph, const tflite_tensor_t *tensors,
+                              const tflite_operator_t *operators);
+FILE *generator_open(const char *path);
+int generator_close(FILE *file, const char *path);
+void generator_write_floats(FILE *file, const float *values, int count, const char *format, ...)
+    __attribute__((format(printf, 4, 5)));
+void generator_write_int8(FILE *file, const int8_t *values, int count, const char *format, ...)
+    __attribute__((format(printf, 4, 5)));
+void generator_write_int32(FILE *file, const int32_t *values, int count, const char *format, ...)
+    __attribute__((format(printf, 4, 5)));
+
+
+#endif /* HOST_GENERATOR_H_ */
@@ -0,0 +1,369 @@
+/*
+ * layer_profile.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Runs a recording through the model with the layer profiler compiled in
+ * (LAYER_PROFILER_ENABLE=1) and writes the report the device prints on the
+ * UART, in nanoseconds from CLOCK_MONOTONIC, from the reference interpreter
+ * with the layer profiling of mtb_ml_model_profile_config() on. The
+ * activity gate is off, so every window is an invocation.
+ *
+ * With the code_generation_report.md of the ML configurator, the measured
+ * latency of each of its layers is put next to the estimate as a share of
+ * the total, as host nanoseconds and M4 cycles only compare that way.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "activity_gate.h"
+#include "layer_profiler.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define BLOCK_SAMPLES                   (1600)
+
+#define DEFAULT_ESTIMATE_FILE           "../../../ML_Model/Output/conv1dlstm-medium-balanced-3/" \
+                                        "Infineon/code_generation_report.md"
+
+/* Layers of the Latency table of code_generation_report.md */
+#define MAX_ESTIMATES                   (32)
+#define LINE_MAX_LENGTH                 (256)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    char name[64];
+    double cycles;
+} estimate_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int load_estimate(const char *path, estimate_t *estimates, int *count, double *scratch);
+static double parse_grouped(const char *text);
+static int compare_estimate(const char *path);
+
+
+/*******************************************************************************
+* Function Name: layer_profile_main
+********************************************************************************
+* Summary:
+*    smartlistener_host layer-profile <file.wav> [--repeat N] [--output FILE]
+*                                     [--estimate FILE]
+*
+*******************************************************************************/
+int layer_profile_main(int argc, char *argv[])
+{
+    const char *wav_path = NULL;
+    const char *output_path = NULL;
+    const char *estimate_path = DEFAULT_ESTIMATE_FILE;
+    int repeat = 1;
+    wav_t wav;
+    int16_t *pcm;
+    float *samples;
+    float scores[IMAI_DATA_OUT_COUNT];
+    activity_gate_config_t gate_config;
+    static char report[LAYER_PROFILER_REPORT_MAX];
+    int length;
+    int result = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+        {
+            output_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--estimate") == 0) && (i + 1 < argc))
+        {
+            estimate_path = argv[++i];
+        }
+        else if (argv[i][0] != '-')
+        {
+            wav_path = argv[i];
+        }
+        else
+        {
+            wav_path = NULL;
+            break;
+        }
+    }
+    if ((wav_path == NULL) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host layer-profile <file.wav> [--repeat N] [--output FILE] "
+                        "[--estimate FILE]\n");
+        return 1;
+    }
+    #if !LAYER_PROFILER_ENABLE
+    fprintf(stderr, "Built without the layer profiler, rebuild with -DLAYER_PROFILER_ENABLE=1 in CFLAGS\n");
+    return 1;
+    #endif
+
+    if (wav_load(wav_path, &wav) != 0)
+    {
+        return 1;
+    }
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    samples = malloc(wav.frames * sizeof(float));
+    if ((pcm == NULL) || (samples == NULL))
+    {
+        free(pcm);
+        free(samples);
+        wav_free(&wav);
+        return 1;
+    }
+    /* Channel 0, converted the same way ml_task.c does */
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+    audio_ingest_block(pcm, samples, wav.frames, DIGITAL_BOOST_FACTOR);
+
+    activity_gate_get_config(&gate_config);
+    gate_config.enabled = 0;
+    activity_gate_set_config(&gate_config);
+
+    layer_profiler_reset();
+    for (int r = 0; (r < repeat) && (result == 0); r++)
+    {
+        if (IMAI_init() != IMAI_RET_SUCCESS)
+        {
+            result = 1;
+            break;
+        }
+        activity_gate_init();
+        for (size_t i = 0; i < wav.frames; i += BLOCK_SAMPLES)
+        {
+            int block = (wav.frames - i < BLOCK_SAMPLES) ? (int)(wav.frames - i) : BLOCK_SAMPLES;
+            int ready = IMAI_enqueue_block(&samples[i], block);
+
+            if (ready < 0)
+            {
+                result = 1;
+                break;
+            }
+            for (int k = 0; k < ready; k++)
+            {
+                IMAI_dequeue(scores);
+            }
+        }
+        IMAI_finalize();
+    }
+
+    if (result == 0)
+    {
+        FILE *file = stdout;
+
+        length = layer_profiler_format(report, sizeof(report));
+        if (output_path != NULL)
+        {
+            file = fopen(output_path, "w");
+            if (file == NULL)
+            {
+                fprintf(stderr, "Cannot open %s for writing\n", output_path);
+                result = 1;
+            }
+        }
+        if (file != NULL)
+        {
+            fputs(report, file);
+            if ((file != stdout) && (fclose(file) != 0))
+            {
+                fprintf(stderr, "Cannot write %s\n", output_path);
+                result = 1;
+            }
+        }
+
+        printf("\nRecording:                 %s (%d passes)\n", wav_path, repeat);
+        printf("Invocations:               %lu of %d operators\n", (unsigned long)layer_profiler_invocations(),
+               layer_profiler_layer_count());
+        for (int i = 0; i < layer_profiler_layer_count(); i++)
+        {
+            layer_profiler_stats_t stats;
+
+            layer_profiler_get_stats(i, &stats);
+            if ((stats.count != layer_profiler_invocations()) || (stats.output_non_finite > 0))
+            {
+                printf("Layer %d (%s) ran %lu times, %lu non-finite outputs\n", i, stats.name,
+                       (unsigned long)stats.count, (unsigned long)stats.output_non_finite);
+                result = 1;
+            }
+        }
+        if ((layer_profiler_invocations() == 0) || (length >= (int)sizeof(report)))
+        {
+            result = 1;
+        }
+        if (compare_estimate(estimate_path) != 0)
+        {
+            result = 1;
+        }
+        printf("Result:                    %s\n", (result == 0) ? "PASS" : "FAIL");
+    }
+
+    free(pcm);
+    free(samples);
+    wav_free(&wav);
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: compare_estimate
+********************************************************************************
+* Summary:
+*    Prints the estimated and the measured latency of every layer of the
+*    estimate as a share of the total, and the scratch memory of both. The
+*    measured layers are matched by name in order, the ones the estimate
+*    does not list are summed up separately.
+*
+*******************************************************************************/
+static int compare_estimate(const char *path)
+{
+    estimate_t estimates[MAX_ESTIMATES];
+    int count = 0;
+    double estimated_total = 0.0;
+    double measured_total = 0.0;
+    double unmatched = 0.0;
+    double scratch = 0.0;
+    uint32_t measured_scratch = 0;
+    int next = 0;
+
+    if (load_estimate(path, estimates, &count, &scratch) != 0)
+    {
+        return 1;
+    }
+    for (int e = 0; e < count; e++)
+    {
+        estimated_total += estimates[e].cycles;
+    }
+    for (int i = 0; i < layer_profiler_layer_count(); i++)
+    {
+        layer_profiler_stats_t stats;
+
+        layer_profiler_get_stats(i, &stats);
+        measured_total += stats.mean;
+        measured_scratch = (stats.arena_high_water > measured_scratch) ? stats.arena_high_water : measured_scratch;
+    }
+    if ((estimated_total <= 0.0) || (measured_total <= 0.0))
+    {
+        return 1;
+    }
+
+    printf("Estimate:                  %s\n", path);
+    printf("  %-30s %12s %7s %12s %7s\n", "layer", "est. cycles", "share", "measured", "share");
+    for (int e = 0; e < count; e++)
+    {
+        layer_profiler_stats_t stats;
+        int i;
+
+        for (i = next; i < layer_profiler_layer_count(); i++)
+        {
+            layer_profiler_get_stats(i, &stats);
+            if (strcmp(stats.name, estimates[e].name) == 0)
+            {
+                break;
+            }
+            unmatched += stats.mean;
+        }
+        if (i == layer_profiler_layer_count())
+        {
+            printf("  %-30s %12.0f %6.1f%% %12s\n", estimates[e].name, estimates[e].cycles,
+                   100.0 * estimates[e].cycles / estimated_total, "-");
+            continue;
+        }
+        printf("  %-30s %12.0f %6.1f%% %12lu %6.1f%%\n", estimates[e].name, estimates[e].cycles,
+               100.0 * estimates[e].cycles / estimated_total, (unsigned long)stats.mean,
+               100.0 * stats.mean / measured_total);
+        next = i + 1;
+    }
+    for (int i = next; i < layer_profiler_layer_count(); i++)
+    {
+        layer_profiler_stats_t stats;
+
+        layer_profiler_get_stats(i, &stats);
+        unmatched += stats.mean;
+    }
+    printf("  %-30s %12s %7s %12.0f %6.1f%%\n", "(not in the estimate)", "-", "", unmatched,
+           100.0 * unmatched / measured_total);
+    printf("Scratch memory:            %lu bytes measured, %.0f estimated\n", (unsigned long)measured_scratch, scratch);
+    return 0;
+}
+
+
+/* Latency rows and the float scratch memory of code_generation_report.md */
+static int load_estimate(const char *path, estimate_t *estimates, int *count, double *scratch)
+{
+    FILE *file = fopen(path, "r");
+    char line[LINE_MAX_LENGTH];
+    int latency = 0;
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+    *count = 0;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[64];
+        char value[32];
+        char scratch_text[32];
+
+        if (strncmp(line, "### ", 4) == 0)
+        {
+            latency = (strncmp(line, "### Latency", 11) == 0);
+            continue;
+        }
+        if (sscanf(line, "| float | %31[0-9,] | %31[0-9,] |", value, scratch_text) == 2)
+        {
+            *scratch = parse_grouped(scratch_text);
+        }
+        else if (latency && (*count < MAX_ESTIMATES) &&
+                 (sscanf(line, "| %63[A-Z0-9_] | %31[0-9,] |", name, value) == 2))
+        {
+            snprintf(estimates[*count].name, sizeof(estimates[*count].name), "%s", name);
+            estimates[*count].cycles = parse_grouped(value);
+            (*count)++;
+        }
+    }
+    fclose(file);
+    if (*count == 0)
+    {
+        fprintf(stderr, "No latency table in %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+
+/* "1,234,567" to 1234567 */
+static double parse_grouped(const char *text)
+{
+    double value = 0.0;
+
+    for (; *text != '\0'; text++)
+    {
+        if ((*text >= '0') && (*text <= '9'))
+        {
+            value = value * 10.0 + (*text - '0');
+        }
+    }
+    return value;
+}
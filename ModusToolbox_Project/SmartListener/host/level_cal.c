@@ -0,0 +1,333 @@
+/*
+ * level_cal.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Calibration check of the sound level meter (sound_level.c). Synthetic
+ * reference tones go through the same path as on the device (int16 PCM,
+ * audio_ingest_block() with the digital boost, IMAI_enqueue_block(), the
+ * feature bus) and the readings must match:
+ *   - the A-weighting of IEC 61672-1 (nominal table values) from 63 Hz to
+ *     6.3 kHz at -40 dBFS,
+ *   - the level of a 1 kHz tone from -30 to -70 dBFS (linearity),
+ *   - the LAFmax and LAeq of a 200 ms 1 kHz tone burst (Fast time weighting,
+ *     -1.0 dB toneburst response).
+ * The expected readings are reference + dBFS + A(f). With a recording, it
+ * also prints the MQTT payloads of the recording and the cycles per hop the
+ * meter adds. The meter is only built with SOUND_LEVEL_ENABLE, the float mono
+ * front-end.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "activity_gate.h"
+#include "feature_bus.h"
+#include "sound_level.h"
+#include "tone.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define BLOCK_SAMPLES                   (1600)
+
+#define SAMPLE_RATE                     (SOUND_LEVEL_SAMPLE_RATE)
+#define TONE_SECONDS                    (3)
+#define TONE_DBFS                       (-40.0)
+#define DEFAULT_TOLERANCE_DB            (0.3)
+#define MAX_REPORTS                     (4096)
+#define TIMING_PASSES                   (5)
+
+/* Peak of a sine at dbfs, 0 dBFS is a full-scale sine */
+#define DBFS_AMPLITUDE(dbfs)            (32768.0 * pow(10.0, (dbfs) / 20.0))
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+#if SOUND_LEVEL_ENABLE
+/* A-weighting of IEC 61672-1, table 3. The 31 Hz bins of the 512-point FFT
+ * are too coarse for the slope of the weighting below 125 Hz, 63 Hz is held
+ * to the class 1 limit (1.5 dB) instead of the tolerance. */
+static const struct {
+    double hz;
+    double weight_db;
+    double limit_db;                /* 0 for the tolerance */
+} a_table[] = {
+    { 63.0, -26.2, 1.5 }, { 125.0, -16.1, 0.0 }, { 250.0, -8.6, 0.0 }, { 500.0, -3.2, 0.0 },
+    { 1000.0, 0.0, 0.0 }, { 2000.0, 1.2, 0.0 }, { 4000.0, 1.0, 0.0 }, { 6300.0, -0.1, 0.0 },
+};
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if SOUND_LEVEL_ENABLE
+static int run(const int16_t *pcm, size_t count, uint32_t period_ms, float reference, int with_meter,
+               sound_level_report_t *reports, int max_reports, uint64_t *cycles);
+static int check(const char *what, double measured, double expected, double tolerance);
+static int run_recording(const char *path, float reference);
+#endif
+
+
+/*******************************************************************************
+* Function Name: level_cal_main
+********************************************************************************
+* Summary:
+*    smartlistener_host level-cal [<file.wav>] [--reference DB] [--tolerance DB]
+*
+*******************************************************************************/
+int level_cal_main(int argc, char *argv[])
+{
+#if !SOUND_LEVEL_ENABLE
+    (void)argc;
+    (void)argv;
+    fprintf(stderr, "Built without the sound level meter, it needs the float mono front-end\n");
+    return 1;
+#else
+    const char *wav_path = NULL;
+    float reference = SOUND_LEVEL_REFERENCE_DB_SPL;
+    double tolerance = DEFAULT_TOLERANCE_DB;
+    /* One window more, so the last period completes */
+    const size_t count = TONE_SECONDS * SAMPLE_RATE + FEATURE_BUS_FFT_LEN;
+    sound_level_report_t reports[TONE_SECONDS];
+    int16_t *pcm;
+    int failures = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--reference") == 0) && (i + 1 < argc))
+        {
+            reference = strtof(argv[++i], NULL);
+        }
+        else if ((strcmp(argv[i], "--tolerance") == 0) && (i + 1 < argc))
+        {
+            tolerance = strtod(argv[++i], NULL);
+        }
+        else if (argv[i][0] != '-')
+        {
+            wav_path = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host level-cal [<file.wav>] [--reference DB] [--tolerance DB]\n");
+            return 1;
+        }
+    }
+
+    pcm = malloc(count * sizeof(int16_t));
+    if (pcm == NULL)
+    {
+        return 1;
+    }
+
+    printf("Reference:                 %.1f dB SPL for a full-scale sine, tolerance %.1f dB\n",
+        (double)reference, tolerance);
+    printf("%-26s %9s %9s %7s\n", "Tone", "Expected", "LAeq", "Error");
+
+    /* Frequency response, the last 1 s period of a 3 s tone */
+    for (size_t i = 0; i < sizeof(a_table) / sizeof(a_table[0]); i++)
+    {
+        char what[64];
+
+        tone_fill(pcm, 0, count, a_table[i].hz, DBFS_AMPLITUDE(TONE_DBFS), SAMPLE_RATE);
+        if (run(pcm, count, 1000, reference, 1, reports, TONE_SECONDS, NULL) != TONE_SECONDS)
+        {
+            failures++;
+            continue;
+        }
+        snprintf(what, sizeof(what), "%.0f Hz, %.0f dBFS", a_table[i].hz, TONE_DBFS);
+        failures += check(what, reports[TONE_SECONDS - 1].laeq, reference + TONE_DBFS + a_table[i].weight_db,
+                          (a_table[i].limit_db > 0.0) ? a_table[i].limit_db : tolerance);
+    }
+
+    /* Linearity at 1 kHz. -30 dBFS is -10 dBFS after the digital boost. */
+    for (double dbfs = -30.0; dbfs >= -70.0; dbfs -= 10.0)
+    {
+        char what[64];
+
+        tone_fill(pcm, 0, count, 1000.0, DBFS_AMPLITUDE(dbfs), SAMPLE_RATE);
+        if (run(pcm, count, 1000, reference, 1, reports, TONE_SECONDS, NULL) != TONE_SECONDS)
+        {
+            failures++;
+            continue;
+        }
+        snprintf(what, sizeof(what), "1000 Hz, %.0f dBFS", dbfs);
+        failures += check(what, reports[TONE_SECONDS - 1].laeq, reference + dbfs, tolerance);
+    }
+
+    /* 200 ms burst in the middle of the second 1.5 s period */
+    memset(pcm, 0, count * sizeof(int16_t));
+    tone_fill(pcm, SAMPLE_RATE * 9 / 4 - SAMPLE_RATE / 10, SAMPLE_RATE / 5, 1000.0, DBFS_AMPLITUDE(TONE_DBFS),
+              SAMPLE_RATE);
+    if (run(pcm, count, 1500, reference, 1, reports, 2, NULL) != 2)
+    {
+        failures++;
+    }
+    else
+    {
+        failures += check("1000 Hz burst 200 ms LAeq", reports[1].laeq,
+                          reference + TONE_DBFS + 10.0 * log10(0.2 / 1.5), tolerance);
+        failures += check("1000 Hz burst 200 ms LAFmax", reports[1].lafmax, reference + TONE_DBFS - 1.0, tolerance);
+    }
+    free(pcm);
+
+    if (wav_path != NULL)
+    {
+        int result = run_recording(wav_path, reference);
+
+        if (result < 0)
+        {
+            return 1;
+        }
+        failures += result;
+    }
+
+    printf("Result:                    %s\n", (failures == 0) ? "PASS" : "FAIL");
+    return (failures == 0) ? 0 : 1;
+#endif
+}
+
+#if SOUND_LEVEL_ENABLE
+
+/* The samples through IMAI_enqueue_block() as ml_task.c feeds it. Returns
+ * the number of reports or -1 on error. */
+static int run(const int16_t *pcm, size_t count, uint32_t period_ms, float reference, int with_meter,
+               sound_level_report_t *reports, int max_reports, uint64_t *cycles)
+{
+    float samples[BLOCK_SAMPLES];
+    float scores[IMAI_DATA_OUT_COUNT];
+    sound_level_config_t config;
+    int reported = 0;
+
+    if (IMAI_init() != IMAI_RET_SUCCESS)
+    {
+        return -1;
+    }
+    activity_gate_init();
+    sound_level_default_config(&config);
+    config.reference_db_spl = reference;
+    config.input_gain = DIGITAL_BOOST_FACTOR;
+    config.period_ms = period_ms;
+    if (with_meter && (sound_level_init(&config) != 0))
+    {
+        IMAI_finalize();
+        return -1;
+    }
+
+    for (size_t i = 0; i < count; i += BLOCK_SAMPLES)
+    {
+        int block = (count - i < BLOCK_SAMPLES) ? (int)(count - i) : BLOCK_SAMPLES;
+        uint64_t c0 = read_cycles();
+        int ready;
+
+        sound_level_peak(audio_ingest_block(&pcm[i], samples, block, DIGITAL_BOOST_FACTOR));
+        ready = IMAI_enqueue_block(samples, block);
+        if (cycles != NULL)
+        {
+            *cycles += read_cycles() - c0;
+        }
+        if (ready < 0)
+        {
+            reported = -1;
+            break;
+        }
+        for (int k = 0; k < ready; k++)
+        {
+            IMAI_dequeue(scores);
+        }
+        if ((reported < max_reports) && sound_level_get_report(&reports[reported]))
+        {
+            reported++;
+        }
+    }
+
+    sound_level_deinit();
+    IMAI_finalize();
+    return reported;
+}
+
+
+static int check(const char *what, double measured, double expected, double tolerance)
+{
+    const double error = measured - expected;
+    const int pass = fabs(error) <= tolerance;
+
+    printf("%-26s %9.2f %9.2f %+7.2f%s\n", what, expected, measured, error, pass ? "" : "  FAIL");
+    return pass ? 0 : 1;
+}
+
+
+/* Payloads of a recording, and the cycles per hop of the meter. Returns the
+ * number of failures or -1 on error. */
+static int run_recording(const char *path, float reference)
+{
+    static sound_level_report_t reports[MAX_REPORTS];
+    wav_t wav;
+    int16_t *pcm;
+    uint64_t best_with = UINT64_MAX;
+    uint64_t best_without = UINT64_MAX;
+    uint32_t hops;
+    int count = 0;
+
+    if (wav_load(path, &wav) != 0)
+    {
+        return -1;
+    }
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    if (pcm == NULL)
+    {
+        wav_free(&wav);
+        return -1;
+    }
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+    hops = (wav.frames >= FEATURE_BUS_FFT_LEN) ? (wav.frames - FEATURE_BUS_FFT_LEN) / SOUND_LEVEL_HOP + 1 : 0;
+
+    printf("Recording:                 %s\n", path);
+    /* The fastest pass, the host is not quiet enough for the mean */
+    for (int r = 0; (r < TIMING_PASSES) && (count >= 0); r++)
+    {
+        uint64_t with = 0;
+        uint64_t without = 0;
+
+        count = run(pcm, wav.frames, 1000, reference, 1, reports, MAX_REPORTS, &with);
+        if (run(pcm, wav.frames, 1000, reference, 0, NULL, 0, &without) < 0)
+        {
+            count = -1;
+        }
+        best_with = (with < best_with) ? with : best_with;
+        best_without = (without < best_without) ? without : best_without;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        char payload[SOUND_LEVEL_PAYLOAD_MAX];
+
+        sound_level_format(&reports[i], payload, sizeof(payload));
+        printf("  %s\n", payload);
+    }
+    if ((count >= 0) && (hops > 0))
+    {
+        printf("Cycles per hop:            %.0f with the meter, %.0f without (%+.1f%%)\n",
+            (double)best_with / hops, (double)best_without / hops,
+            100.0 * ((double)best_with - (double)best_without) / (double)best_without);
+    }
+
+    free(pcm);
+    wav_free(&wav);
+    return (count >= 0) ? 0 : -1;
+}
+
+#endif /* SOUND_LEVEL_ENABLE */
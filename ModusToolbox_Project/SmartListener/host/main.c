@@ -0,0 +1,270 @@
+/*
+ * main.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Host (Linux) driver for the portable parts of the SmartListener firmware.
+ *
+ *   smartlistener_host replay <file.wav> [--speed N] [--work-us N]
+ *                             [--pipeline] [--model-us N] [--sweep]
+ *       Replays a recording through the ping-pong capture engine at N times
+ *       real time. --work-us simulates the processing time of each block and
+ *       can be used to check the no-drop guarantee. --pipeline runs the ML
+ *       task processing under the deadline monitor, --model-us adds the cost
+ *       of a model invocation and --sweep doubles the speed until deadlines
+ *       are missed.
+ *
+ *   smartlistener_host bench-enqueue <file.wav> [--repeat N]
+ *       Times the per-sample IMAI_enqueue() path against IMAI_enqueue_block().
+ *
+ *   smartlistener_host bench-ingest <file.wav> [--repeat N]
+ *       Cycles per block of the old sample conversion loop and of
+ *       audio_ingest_block().
+ *
+ *   smartlistener_host gate-eval [--energy X] [--flux X] [--hangover N] ...
+ *       Runs all recorded sessions with the activity gate and reports the
+ *       model invocations saved and the changes against the exported
+ *       predictions.
+ *
+ *   smartlistener_host ring-stress [--samples N] [--size N] [--lossy]
+ *       Hammers the capture SPSC ring from a producer and a consumer thread.
+ *
+ *   smartlistener_host stereo-eval <file.wav> [--noise X]
+ *       Checks each channel of the stereo front-end against the mono
+ *       front-end and reports the channel selection of each mix mode. Needs
+ *       -DSTEREO_FRONTEND_ENABLE=1 in CFLAGS.
+ *
+ *   smartlistener_host bench-resample [--repeat N]
+ *       Passband SNR, aliasing and throughput of the resampler from 8, 22.05,
+ *       32, 44.1 and 48 kHz to 16 kHz.
+ *
+ *   smartlistener_host clip-eval <file.wav> [--drop N]
+ *       Round trip of the pre-roll event clips through the IMA-ADPCM
+ *       recorder, the MQTT chunker and the chunk decoder.
+ *
+ *   smartlistener_host bench-window <file.wav> [--repeat N]
+ *       Bytes moved and cycles per hop of the copying window chain against
+ *       the mirrored ring read in place.
+ *
+ *   smartlistener_host q15-eval [--gain X] [--max-error X] [--mean-error X] ...
+ *       Log-mel error of the fixed-point front-end against the float
+ *       preprocessor track of every session, and its cycles per frame. Needs
+ *       -DFRONTEND_Q15_ENABLE=1 in CFLAGS.
+ *
+ *   smartlistener_host bench-mel <file.wav> [--repeat N]
+ *       Cycles per frame of mel_log_f32() and of its magnitude, mel, clip
+ *       and log passes.
+ *
+ *   smartlistener_host bench-features [--frames N] [--repeat N]
+ *       Bytes moved, cycles and RAM per inference of the copied 50x30 model
+ *       input against the mirrored feature history read in place.
+ *
+ *   smartlistener_host stream-eval [--track DIR] [--golden FILE] [--max-error X] ...
+ *       Runs the network of every session window by window and as a stream
+ *       that reuses cached convolution columns, and checks both against the
+ *       exported scores and the golden vectors of the model.
+ *
+ *   smartlistener_host frontend-check [<file.wav>] [--model FILE] [--sampler FILE]
+ *       Compares the front-end tables generated by frontend.hpp with the
+ *       ones baked into model.c and sampler.c, and the log-mel frames of
+ *       a recording through both.
+ *
+ *   smartlistener_host bus-eval <file.wav> [--consumers N] [--repeat N]
+ *       Runs a recording with 0 to N mock consumers on the feature bus,
+ *       checks the frames they get and the cycles per hop.
+ *
+ *   smartlistener_host level-cal [<file.wav>] [--reference DB] [--tolerance DB]
+ *       Checks the A-weighted sound level meter against reference tones,
+ *       and prints the level reports of a recording.
+ *
+ *   smartlistener_host stage-profile <file.wav> [--repeat N]
+ *       Prints the per-stage timing of the model pipeline for a recording,
+ *       build with -DSTAGE_PROFILER_ENABLE=1.
+ *
+ *   smartlistener_host model-eval [--data DIR] [--pred DIR] [--max-error X] [--verbose]
+ *       Runs every session from the audio to the scores through model.c and
+ *       the reference interpreter, compares them with the exported
+ *       predictions and prints the time per window.
+ *
+ *   smartlistener_host quantize [--data DIR] [--pred DIR] [--bounds FILE] [--write-bounds FILE]
+ *                               [--output FILE] [--min-agreement X] [--verbose]
+ *       Calibrates the activation ranges of the model over every session,
+ *       quantizes it to int8, reports the per-class accuracy against the
+ *       exported predictions and writes models/model_int8.c.
+ *
+ *   smartlistener_host cascade [--data DIR] [--pred DIR] [--hidden N] [--epochs N]
+ *                              [--min-recall X] [--curve FILE] [--output FILE] [--verbose]
+ *       Trains the first stage of the two-stage cascade on the session
+ *       windows, prints its recall-vs-CPU curve, picks the threshold that
+ *       keeps every confident fire and glass_breaking window and writes
+ *       models/model_cascade.c.
+ *
+ *   smartlistener_host layer-profile <file.wav> [--repeat N] [--output FILE] [--estimate FILE]
+ *       Writes the per-operator latency, arena high-water mark and output
+ *       statistics of the model runner for a recording in the table shape of
+ *       code_generation_report.md and compares the latency with the
+ *       estimate, build with -DLAYER_PROFILER_ENABLE=1.
+ *
+ *   smartlistener_host memory-plan [--model FILE] [--print] [--data DIR] [--pred DIR] [--max-error X]
+ *       Plans the RAM buffers of models/model.c by lifetime, so the
+ *       front-end scratch shares the model arena, reports the saving and
+ *       checks the layout of models/model.c against the plan. Built with
+ *       -DMEMORY_POISON_ENABLE=1, runs model-eval with every dead buffer
+ *       poisoned.
+ *
+ *   smartlistener_host arena-calibrate [--device BYTES] [--margin PERCENT] [--budget BYTES] [--output FILE] [--check]
+ *       Sizes models/model_arena.h from the arena bytes TFLM used on the
+ *       device (--device, printed with MODEL_ARENA_LOG_ENABLE) plus the
+ *       margin, or keeps the budget without them. Runs every session
+ *       through the host interpreter and rejects a device number below its
+ *       peak. Fails without writing if the arena would exceed the budget,
+ *       with --check also if the current arena is smaller.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "commands.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void usage(void);
+
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        usage();
+        return 1;
+    }
+
+    if (strcmp(argv[1], "replay") == 0)
+    {
+        return replay_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "bench-enqueue") == 0)
+    {
+        return bench_enqueue_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "bench-ingest") == 0)
+    {
+        return bench_ingest_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "gate-eval") == 0)
+    {
+        return gate_eval_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "ring-stress") == 0)
+    {
+        return ring_stress_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "stereo-eval") == 0)
+    {
+        return stereo_eval_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "bench-resample") == 0)
+    {
+        return bench_resample_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "clip-eval") == 0)
+    {
+        return clip_eval_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "bench-window") == 0)
+    {
+        return bench_window_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "q15-eval") == 0)
+    {
+        return q15_eval_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "bench-mel") == 0)
+    {
+        return bench_mel_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "bench-features") == 0)
+    {
+        return bench_features_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "stream-eval") == 0)
+    {
+        return stream_eval_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "frontend-check") == 0)
+    {
+        return frontend_check_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "bus-eval") == 0)
+    {
+        return bus_eval_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "level-cal") == 0)
+    {
+        return level_cal_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "stage-profile") == 0)
+    {
+        return stage_profile_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "model-eval") == 0)
+    {
+        return model_eval_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "quantize") == 0)
+    {
+        return quantize_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "cascade") == 0)
+    {
+        return cascade_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "layer-profile") == 0)
+    {
+        return layer_profile_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "memory-plan") == 0)
+    {
+        return memory_plan_main(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "arena-calibrate") == 0)
+    {
+        return arena_calibrate_main(argc - 2, argv + 2);
+    }
+
+    usage();
+    return 1;
+}
+
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: smartlistener_host replay <file.wav> [--speed N] [--work-us N]\n"
+        "                                 [--pipeline] [--model-us N] [--sweep]\n"
+        "       smartlistener_host bench-enqueue <file.wav> [--repeat N]\n"
+        "       smartlistener_host bench-ingest <file.wav> [--repeat N]\n"
+        "       smartlistener_host gate-eval [--energy X] [--flux X] [--hangover N] [--verbose]\n"
+        "       smartlistener_host ring-stress [--samples N] [--size N] [--lossy]\n"
+        "       smartlistener_host stereo-eval <file.wav> [--noise X]\n"
+        "       smartlistener_host bench-resample [--repeat N]\n"
+        "       smartlistener_host clip-eval <file.wav> [--drop N]\n"
+        "       smartlistener_host bench-window <file.wav> [--repeat N]\n"
+        "       smartlistener_host q15-eval [--gain X] [--max-error X] [--p99-error X] [--mean-error X] [--verbose]\n"
+        "       smartlistener_host bench-mel <file.wav> [--repeat N]\n"
+        "       smartlistener_host bench-features [--frames N] [--repeat N]\n"
+        "       smartlistener_host stream-eval [--track DIR] [--golden FILE] [--max-error X] ...\n"
+        "       smartlistener_host frontend-check [<file.wav>] [--model FILE] [--sampler FILE]\n"
+        "       smartlistener_host bus-eval <file.wav> [--consumers N] [--repeat N]\n"
+        "       smartlistener_host level-cal [<file.wav>] [--reference DB] [--tolerance DB]\n"
+        "       smartlistener_host stage-profile <file.wav> [--repeat N]\n"
+        "       smartlistener_host model-eval [--max-error X] [--verbose]\n"
+        "       smartlistener_host quantize [--bounds FILE] [--output FILE] [--min-agreement X] ...\n"
+        "       smartlistener_host cascade [--min-recall X] [--curve FILE] [--output FILE] ...\n"
+        "       smartlistener_host layer-profile <file.wav> [--repeat N] [--output FILE] [--estimate FILE]\n"
+        "       smartlistener_host memory-plan [--model FILE] [--print] [--max-error X] ...\n"
+        "       smartlistener_host arena-calibrate [--device BYTES] [--margin PERCENT] [--budget BYTES] [--output FILE] [--check]\n");
+}
@@ -0,0 +1,507 @@
+/*
+ * memory_plan.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Lifetime-based static memory plan of the RAM buffers of models/model.c.
+ * Each frame goes through the same steps: front-end, activity gate, feature
+ * bus, feature enqueue, and for every sixth frame the network. The scratch
+ * of the front-end (_K8, _K9, _K10, _K8Q) is dead by the time the network
+ * runs, and the model arena (_K13) is dead between two invocations except
+ * for the persistent allocations TFLM keeps at its end. The planner places
+ * the longest-lived buffers first, then every buffer at the lowest offset
+ * that does not overlap a buffer alive in the same step, like the greedy
+ * planner of TFLM does for tensors. The persistent buffers come out at the
+ * start of _state and the front-end scratch at the start of the arena, in
+ * the part TFLM plans its activations into.
+ *
+ * The plan is computed for the four builds (interpreter or not, float or
+ * q15 front-end), checked against the #define lines and the _state sizes of
+ * models/model.c, and the RAM saved against separate buffers is reported.
+ * Built with MEMORY_POISON_ENABLE=1, models/model.c fills every buffer with
+ * NaN when its lifetime ends, and the command then runs model-eval over
+ * every session: a buffer read after the plan gave its bytes away changes
+ * the scores.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "commands.h"
+#include "memory_poison.h"
+#include "models/model_arena.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define DEFAULT_MODEL_FILE              "../source/models/model.c"
+
+/* Alignment of every buffer, as the DEEPCRAFT layout of model.c */
+#define PLAN_ALIGNMENT                  (8u)
+
+/* Bits of a build */
+#define VARIANT_ARENA                   (1u << 0)   /* TFLM interpreter, _K13 in _state */
+#define VARIANT_Q15                     (1u << 1)   /* FRONTEND_Q15_ENABLE */
+#define NUM_VARIANTS                    (4)
+
+#define LINE_MAX_LENGTH                 (512)
+#define EXPRESSION_MAX                  (96)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Steps of a frame in _IMAI_process_block() and IMAI_dequeue() */
+typedef enum {
+    PHASE_FRONTEND = 0,             /* _IMAI_frontend_frame() or stereo_frontend_frame() */
+    PHASE_GATE,                     /* activity_gate_update() */
+    PHASE_BUS,                      /* feature_bus_publish() */
+    PHASE_FEATURES,                 /* fixwin_enqueue_mirrored() into _K12 */
+    PHASE_MODEL,                    /* _IMAI_model_window() */
+    NUM_PHASES
+} plan_phase_t;
+
+typedef struct {
+    const char *name;
+    const char *type;
+    uint32_t bytes;
+    plan_phase_t first;             /* Written first */
+    plan_phase_t last;              /* Read last */
+    uint32_t needs;                 /* VARIANT_* bits the build must have */
+    uint32_t excludes;              /* VARIANT_* bits the build must not have */
+    const char *comment;
+} plan_buffer_t;
+
+/* Buffers alive in every step are persistent, they keep data across frames */
+static const plan_buffer_t plan_buffers[] = {
+    { "_K12", "int8_t", 12064, PHASE_FRONTEND, PHASE_MODEL, 0, 0,
+      "s8[12064] (12064 bytes), mirrored f32[50,30] feature history" },
+    { "_K5", "int8_t", 48, PHASE_FRONTEND, PHASE_MODEL, 0, 0,
+      "s8[48] (48 bytes)" },
+    { "_K17", "int8_t", 8, PHASE_FRONTEND, PHASE_MODEL, VARIANT_ARENA, 0,
+      "s8[8] (8 bytes), not with MODEL_STREAMING_ENABLE or MODEL_INT8_ENABLE" },
+    { "_K13", "uint8_t", MODEL_ARENA_SIZE, PHASE_MODEL, PHASE_MODEL, VARIANT_ARENA, 0,
+      "u8[MODEL_ARENA_SIZE], not with MODEL_STREAMING_ENABLE or MODEL_INT8_ENABLE" },
+    { "_K10", "float", 120, PHASE_FRONTEND, PHASE_FEATURES, 0, 0,
+      "f32[30] (120 bytes), log-mel frame" },
+    { "_K8", "float", 2048, PHASE_FRONTEND, PHASE_BUS, 0, VARIANT_Q15,
+      "f32[512] (2048 bytes), magnitudes of the feature bus" },
+    { "_K9", "float", 2048, PHASE_FRONTEND, PHASE_FRONTEND, 0, VARIANT_Q15,
+      "f32[512] (2048 bytes)" },
+    { "_K8Q", "int16_t", 3072, PHASE_FRONTEND, PHASE_FRONTEND, VARIANT_Q15, 0,
+      "s16[1536] (3072 bytes), scratch of frontend_q15_frame()" },
+};
+
+#define NUM_BUFFERS                     ((int)(sizeof(plan_buffers) / sizeof(plan_buffers[0])))
+
+/* _K13 in plan_buffers */
+#define ARENA_BUFFER                    (3)
+
+typedef struct {
+    int used[NUM_BUFFERS];          /* Buffer is part of the build */
+    uint32_t offset[NUM_BUFFERS];   /* From the start of _state */
+    uint32_t size;                  /* Bytes of _state */
+    uint32_t separate;              /* Bytes of the same buffers without aliasing */
+    uint32_t work;                  /* Start of the first scratch buffer */
+} plan_t;
+
+static const char *const variant_names[NUM_VARIANTS] = {
+    "no arena (streaming, int8)",
+    "TFLM arena",
+    "no arena, q15 front-end",
+    "TFLM arena, q15 front-end"
+};
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void plan_variant(uint32_t variant, plan_t *plan);
+static int persistent(int index);
+static int overlap_in_time(int a, int b);
+static uint32_t align_up(uint32_t value);
+static void expression(const plan_t *plan, int index, char *text, size_t size);
+static void state_size(const plan_t *plan, char *text, size_t size);
+static int check_model(const char *path, const plan_t *plans);
+static int find_define(const char *path, const char *name, const char *text);
+static void print_defines(const plan_t *plans);
+
+
+/*******************************************************************************
+* Function Name: memory_plan_main
+********************************************************************************
+* Summary:
+*    smartlistener_host memory-plan [--model FILE] [--print] [model-eval options]
+*
+*******************************************************************************/
+int memory_plan_main(int argc, char *argv[])
+{
+    const char *model_path = DEFAULT_MODEL_FILE;
+    char *eval_argv[8];
+    int eval_argc = 0;
+    int print = 0;
+    plan_t plans[NUM_VARIANTS];
+    int result = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--model") == 0) && (i + 1 < argc))
+        {
+            model_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--print") == 0)
+        {
+            print = 1;
+        }
+        else if (((strcmp(argv[i], "--data") == 0) || (strcmp(argv[i], "--pred") == 0) ||
+                  (strcmp(argv[i], "--max-error") == 0)) && (i + 1 < argc) && (eval_argc + 2 <= 8))
+        {
+            eval_argv[eval_argc++] = argv[i];
+            eval_argv[eval_argc++] = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host memory-plan [--model FILE] [--print] [--data DIR] [--pred DIR] "
+                            "[--max-error X]\n");
+            return 1;
+        }
+    }
+
+    printf("%-40s %8s %8s %8s %8s\n", "build", "separate", "planned", "saved", "work");
+    for (uint32_t v = 0; v < NUM_VARIANTS; v++)
+    {
+        plan_variant(v, &plans[v]);
+        printf("%-40s %8lu %8lu %8lu %8lu\n", variant_names[v], (unsigned long)plans[v].separate,
+               (unsigned long)plans[v].size, (unsigned long)(plans[v].separate - plans[v].size),
+               (unsigned long)(plans[v].size - plans[v].work));
+    }
+    for (uint32_t v = 0; v < NUM_VARIANTS; v++)
+    {
+        printf("%s:\n", variant_names[v]);
+        for (int b = 0; b < NUM_BUFFERS; b++)
+        {
+            if (plans[v].used[b])
+            {
+                printf("  %-5s 0x%05lx %6lu bytes, steps %d to %d\n", plan_buffers[b].name,
+                       (unsigned long)plans[v].offset[b], (unsigned long)plan_buffers[b].bytes,
+                       plan_buffers[b].first, plan_buffers[b].last);
+            }
+        }
+    }
+
+    /* One set of defines serves every build: the persistent offsets and the
+     * scratch offsets from the work area must not depend on the build */
+    for (uint32_t v = 1; v < NUM_VARIANTS; v++)
+    {
+        for (int b = 0; b < NUM_BUFFERS; b++)
+        {
+            for (uint32_t w = 0; w < v; w++)
+            {
+                char a[EXPRESSION_MAX];
+                char c[EXPRESSION_MAX];
+
+                if (!plans[v].used[b] || !plans[w].used[b])
+                {
+                    continue;
+                }
+                expression(&plans[v], b, a, sizeof(a));
+                expression(&plans[w], b, c, sizeof(c));
+                if (strcmp(a, c) != 0)
+                {
+                    printf("%s is at %s in the %s build and at %s in the %s build\n", plan_buffers[b].name, a,
+                           variant_names[v], c, variant_names[w]);
+                    result = 1;
+                }
+            }
+        }
+    }
+
+    if (check_model(model_path, plans) != 0)
+    {
+        result = 1;
+        print = 1;
+    }
+    if (print)
+    {
+        print_defines(plans);
+    }
+
+    #if MEMORY_POISON_ENABLE
+    if (result == 0)
+    {
+        const uint32_t poisoned = memory_poison_count();
+
+        printf("Poison check:              model-eval over every session, dead buffers filled with 0x%08lx\n",
+               (unsigned long)MEMORY_POISON_WORD);
+        fflush(stdout);
+        result = model_eval_main(eval_argc, eval_argv);
+        printf("Poisoned:                  %lu buffers\n", (unsigned long)(memory_poison_count() - poisoned));
+        if (memory_poison_count() == poisoned)
+        {
+            result = 1;
+        }
+    }
+    #else
+    (void)eval_argv;
+    printf("Poison check:              skipped, rebuild with -DMEMORY_POISON_ENABLE=1 in CFLAGS\n");
+    #endif
+
+    printf("Result:                    %s\n", (result == 0) ? "PASS" : "FAIL");
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: plan_variant
+********************************************************************************
+* Summary:
+*    Plans the buffers of one build: longest lifetime first, then largest
+*    first, each at the lowest aligned offset free for its whole lifetime.
+*
+*******************************************************************************/
+static void plan_variant(uint32_t variant, plan_t *plan)
+{
+    int order[NUM_BUFFERS];
+    int count = 0;
+
+    memset(plan, 0, sizeof(*plan));
+    for (int b = 0; b < NUM_BUFFERS; b++)
+    {
+        plan->used[b] = ((variant & plan_buffers[b].needs) == plan_buffers[b].needs) &&
+                        ((variant & plan_buffers[b].excludes) == 0);
+        if (plan->used[b])
+        {
+            order[count++] = b;
+            plan->separate += align_up(plan_buffers[b].bytes);
+        }
+    }
+    /* Insertion sort, stable so equal buffers keep the order of the table */
+    for (int i = 1; i < count; i++)
+    {
+        const int b = order[i];
+        const int span = plan_buffers[b].last - plan_buffers[b].first;
+        int j = i;
+
+        while ((j > 0) && ((plan_buffers[order[j - 1]].last - plan_buffers[order[j - 1]].first < span) ||
+                           ((plan_buffers[order[j - 1]].last - plan_buffers[order[j - 1]].first == span) &&
+                            (plan_buffers[order[j - 1]].bytes < plan_buffers[b].bytes))))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = b;
+    }
+
+    plan->work = UINT32_MAX;
+    for (int i = 0; i < count; i++)
+    {
+        const int b = order[i];
+        uint32_t offset = 0;
+        int moved = 1;
+
+        /* Move past every placed buffer it collides with until none is left */
+        while (moved)
+        {
+            moved = 0;
+            for (int k = 0; k < i; k++)
+            {
+                const int p = order[k];
+
+                if (overlap_in_time(b, p) && (offset < plan->offset[p] + plan_buffers[p].bytes) &&
+                    (plan->offset[p] < offset + plan_buffers[b].bytes))
+                {
+                    offset = align_up(plan->offset[p] + plan_buffers[p].bytes);
+                    moved = 1;
+                }
+            }
+        }
+        plan->offset[b] = offset;
+        if (offset + plan_buffers[b].bytes > plan->size)
+        {
+            plan->size = align_up(offset + plan_buffers[b].bytes);
+        }
+        if (!persistent(b) && (offset < plan->work))
+        {
+            plan->work = offset;
+        }
+    }
+    if (plan->work == UINT32_MAX)
+    {
+        plan->work = plan->size;
+    }
+}
+
+
+/* Alive in every step of a frame */
+static int persistent(int index)
+{
+    return (plan_buffers[index].first == PHASE_FRONTEND) && (plan_buffers[index].last == PHASE_MODEL);
+}
+
+
+static int overlap_in_time(int a, int b)
+{
+    return (plan_buffers[a].first <= plan_buffers[b].last) && (plan_buffers[b].first <= plan_buffers[a].last);
+}
+
+
+static uint32_t align_up(uint32_t value)
+{
+    return (value + PLAN_ALIGNMENT - 1) & ~(PLAN_ALIGNMENT - 1);
+}
+
+
+/* Address of a buffer as models/model.c writes it */
+static void expression(const plan_t *plan, int index, char *text, size_t size)
+{
+    if (persistent(index))
+    {
+        snprintf(text, size, "((%s *)(_state + 0x%08lx))", plan_buffers[index].type,
+                 (unsigned long)plan->offset[index]);
+    }
+    else
+    {
+        snprintf(text, size, "((%s *)(_WORK + 0x%08lx))", plan_buffers[index].type,
+                 (unsigned long)(plan->offset[index] - plan->work));
+    }
+}
+
+
+/* Size of _state as models/model.c writes it, the arena ends it when it is
+ * larger than the front-end scratch */
+static void state_size(const plan_t *plan, char *text, size_t size)
+{
+    if (plan->used[ARENA_BUFFER] && (plan->offset[ARENA_BUFFER] + MODEL_ARENA_SIZE == plan->size))
+    {
+        snprintf(text, size, "%lu + MODEL_ARENA_SIZE", (unsigned long)plan->offset[ARENA_BUFFER]);
+    }
+    else
+    {
+        snprintf(text, size, "%lu", (unsigned long)plan->size);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: check_model
+********************************************************************************
+* Summary:
+*    Checks that models/model.c declares _state with the planned size of
+*    every build and places _WORK and every buffer where the plan does.
+*
+*******************************************************************************/
+static int check_model(const char *path, const plan_t *plans)
+{
+    int failures = 0;
+
+    for (uint32_t v = 0; v < NUM_VARIANTS; v++)
+    {
+        char text[EXPRESSION_MAX];
+        int found;
+
+        char size[EXPRESSION_MAX / 2];
+
+        state_size(&plans[v], size, sizeof(size));
+        snprintf(text, sizeof(text), "static ALIGNED(16) int8_t _state[%s];", size);
+        found = find_define(path, NULL, text);
+        if (found < 0)
+        {
+            return -1;
+        }
+        if (found == 0)
+        {
+            printf("%s: no _state[%s] for the %s build\n", path, size, variant_names[v]);
+            failures++;
+        }
+        snprintf(text, sizeof(text), "(_state + 0x%08lx)", (unsigned long)plans[v].work);
+        if (find_define(path, "_WORK", text) == 0)
+        {
+            printf("%s: _WORK is not at %s for the %s build\n", path, text, variant_names[v]);
+            failures++;
+        }
+        for (int b = 0; b < NUM_BUFFERS; b++)
+        {
+            if (plans[v].used[b])
+            {
+                expression(&plans[v], b, text, sizeof(text));
+                if (find_define(path, plan_buffers[b].name, text) == 0)
+                {
+                    printf("%s: %s is not at %s\n", path, plan_buffers[b].name, text);
+                    failures++;
+                }
+            }
+        }
+    }
+    if (failures == 0)
+    {
+        printf("Model:                     %s matches the plan\n", path);
+    }
+    return (failures == 0) ? 0 : -1;
+}
+
+
+/* 1 if a "#define <name> ..." line (any line for NULL) contains text, 0 if
+ * none does, -1 if the file cannot be read */
+static int find_define(const char *path, const char *name, const char *text)
+{
+    FILE *file = fopen(path, "r");
+    char line[LINE_MAX_LENGTH];
+    char prefix[64];
+    int found = 0;
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+    snprintf(prefix, sizeof(prefix), "#define %s ", (name != NULL) ? name : "");
+    while (!found && (fgets(line, sizeof(line), file) != NULL))
+    {
+        if (((name == NULL) || (strncmp(line, prefix, strlen(prefix)) == 0)) && (strstr(line, text) != NULL))
+        {
+            found = 1;
+        }
+    }
+    fclose(file);
+    return found;
+}
+
+
+/* The lines of models/model.c for the plan */
+static void print_defines(const plan_t *plans)
+{
+    const plan_t *arena = &plans[VARIANT_ARENA];
+    const plan_t *no_arena = &plans[0];
+    char size[EXPRESSION_MAX / 2];
+
+    state_size(arena, size, sizeof(size));
+    printf("\n#if MODEL_STREAMING_ENABLE || MODEL_INT8_ENABLE\n"
+           "#if FRONTEND_Q15_ENABLE\n"
+           "static ALIGNED(16) int8_t _state[%lu];\n"
+           "#else\n"
+           "static ALIGNED(16) int8_t _state[%lu];\n"
+           "#endif\n"
+           "#else\n"
+           "static ALIGNED(16) int8_t _state[%s];\n"
+           "#endif\n\n",
+           (unsigned long)plans[VARIANT_Q15].size, (unsigned long)no_arena->size, size);
+    printf("#if MODEL_STREAMING_ENABLE || MODEL_INT8_ENABLE\n"
+           "#define _WORK            (_state + 0x%08lx)\n"
+           "#else\n"
+           "#define _WORK            (_state + 0x%08lx)\n"
+           "#endif\n",
+           (unsigned long)no_arena->work, (unsigned long)arena->work);
+    for (int b = 0; b < NUM_BUFFERS; b++)
+    {
+        const plan_t *plan = arena->used[b] ? arena : &plans[VARIANT_ARENA | VARIANT_Q15];
+        char text[EXPRESSION_MAX];
+        char define[32];
+
+        expression(plan, b, text, sizeof(text));
+        snprintf(define, sizeof(define), "#define %s", plan_buffers[b].name);
+        printf("%-25s%-37s// %s\n", define, text, plan_buffers[b].comment);
+    }
+    printf("\n");
+}
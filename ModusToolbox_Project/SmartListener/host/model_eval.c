@@ -0,0 +1,249 @@
+/*
+ * model_eval.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Runs every recorded session through the unchanged models/model.c, from
+ * the audio samples to the scores, with the host reference interpreter of
+ * shims/mtb_ml_model.c in place of TFLM. The activity gate is disabled so
+ * every window reaches the network. The scores are compared with the
+ * predictions DEEPCRAFT Studio exported for the same recordings, and the
+ * time spent in the interpreter and in the whole pipeline is reported.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "sessions.h"
+#include "wav.h"
+#include "activity_gate.h"
+#include "mtb_ml_model.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* The exported scores have 5 decimals, the front-end adds float rounding */
+#define DEFAULT_MAX_ERROR               (1e-4f)
+
+/* Audio per model window: 6 hops of 20 ms */
+#define WINDOW_AUDIO_S                  (0.12)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    size_t sessions;
+    size_t windows;
+    size_t top_changes;             /* Windows whose top class differs from the reference */
+    double error_sum;
+    float max_error;
+    uint64_t pipeline_ns;           /* session_play(), from IMAI_init() to the last IMAI_dequeue() */
+} model_tally_t;
+
+/* Tallies of the walk and of the session being played */
+typedef struct {
+    int verbose;
+    model_tally_t per_class[SESSION_NUM_CLASSES];
+    model_tally_t total;
+    uint64_t model_runs;
+    uint64_t model_ns;
+    const session_t *session;
+    model_tally_t tally;
+} model_walk_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+static void check_window(size_t window, const float *scores, void *context);
+static void add_tally(model_tally_t *sum, const model_tally_t *tally);
+
+
+/*******************************************************************************
+* Function Name: model_eval_main
+********************************************************************************
+* Summary:
+*    smartlistener_host model-eval [--data DIR] [--pred DIR] [--max-error X]
+*        [--verbose]
+*
+*******************************************************************************/
+int model_eval_main(int argc, char *argv[])
+{
+    const char *data_dir = SESSION_DEFAULT_DATA_DIR;
+    const char *pred_dir = SESSION_DEFAULT_PRED_DIR;
+    float max_error = DEFAULT_MAX_ERROR;
+    activity_gate_config_t config;
+    model_walk_t walk = { 0 };
+    const model_tally_t *total = &walk.total;
+    const mtb_ml_model_t *model;
+    int result;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--data") == 0) && (i + 1 < argc))
+        {
+            data_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--pred") == 0) && (i + 1 < argc))
+        {
+            pred_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--max-error") == 0) && (i + 1 < argc))
+        {
+            max_error = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--verbose") == 0)
+        {
+            walk.verbose = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host model-eval [--data DIR] [--pred DIR] [--max-error X] [--verbose]\n");
+            return 1;
+        }
+    }
+
+    activity_gate_get_config(&config);
+    config.enabled = 0;
+    activity_gate_set_config(&config);
+    activity_gate_init();
+
+    if (session_walk(data_dir, pred_dir, 1, run_session, &walk) < 0)
+    {
+        return 1;
+    }
+
+    if (total->windows == 0)
+    {
+        fprintf(stderr, "No session could be evaluated\n");
+        IMAI_finalize();
+        return 1;
+    }
+
+    printf("%-16s %8s %8s %11s %11s %9s\n", "Session label", "Sessions", "Windows", "Max error", "Mean error",
+        "Top diff");
+    for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+    {
+        const model_tally_t *tally = &walk.per_class[c];
+
+        if (tally->windows > 0)
+        {
+            printf("%-16s %8zu %8zu %11.2e %11.2e %9zu\n", session_class_name(c), tally->sessions,
+                tally->windows, tally->max_error, tally->error_sum / tally->windows, tally->top_changes);
+        }
+    }
+    printf("%-16s %8zu %8zu %11.2e %11.2e %9zu\n", "all", total->sessions, total->windows, total->max_error,
+        total->error_sum / total->windows, total->top_changes);
+    model = mtb_ml_model_host_object();
+    if ((model != NULL) && (walk.model_runs > 0))
+    {
+        printf("Model:                     %d bytes, activations %d of %d arena bytes\n", model->model_size,
+            model->arena_size, mtb_ml_model_host_bin()->arena_size);
+        printf("Interpreter:               %.1f us per window, %.0f windows/s (%.0fx real time)\n",
+            (double)walk.model_ns / walk.model_runs / 1e3, 1e9 * walk.model_runs / (double)walk.model_ns,
+            1e9 * walk.model_runs * WINDOW_AUDIO_S / (double)walk.model_ns);
+    }
+    else
+    {
+        /* MODEL_STREAMING_ENABLE and MODEL_INT8_ENABLE run stream_model.c
+         * or quant_model.c instead */
+        printf("Interpreter:               not used by this build\n");
+    }
+    printf("Pipeline:                  %.1f us per window, %.0fx real time\n",
+        (double)total->pipeline_ns / total->windows / 1e3,
+        1e9 * total->windows * WINDOW_AUDIO_S / (double)total->pipeline_ns);
+
+    result = (total->max_error <= max_error) && (total->top_changes == 0);
+    printf("Result:                    %s (max error %g, no top class change)\n", result ? "PASS" : "FAIL", max_error);
+    IMAI_finalize();
+    return result ? 0 : 1;
+}
+
+
+/*******************************************************************************
+* Function Name: run_session
+********************************************************************************
+* Summary:
+*    Feeds one recording to the model in capture sized blocks at unit gain,
+*    like gate-eval, and compares every window with the reference scores.
+*
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    model_walk_t *walk = context;
+    model_tally_t *tally = &walk->tally;
+    size_t windows;
+    uint64_t start;
+    uint64_t runs;
+    uint64_t ns;
+
+    (void) index;
+    memset(tally, 0, sizeof(*tally));
+    walk->session = session;
+    start = host_now_ns();
+    if (session_play(wav, 1.0f, check_window, walk, &windows) != 0)
+    {
+        return;
+    }
+    tally->pipeline_ns = host_now_ns() - start;
+
+    if (windows != session->windows)
+    {
+        fprintf(stderr, "%s: %zu windows, %zu reference predictions\n", session->name, windows, session->windows);
+    }
+    tally->windows = (windows < session->windows) ? windows : session->windows;
+    if (walk->verbose)
+    {
+        printf("%s %-16s windows %3zu max error %.2e top diff %zu\n", session->name,
+            session_class_name(session->label), tally->windows, tally->max_error, tally->top_changes);
+    }
+
+    /* IMAI_init() restarts the counters of the shim */
+    mtb_ml_model_host_run_time(&runs, &ns);
+    walk->model_runs += runs;
+    walk->model_ns += ns;
+    if (session->label >= 0)
+    {
+        add_tally(&walk->per_class[session->label], tally);
+    }
+    add_tally(&walk->total, tally);
+}
+
+
+static void check_window(size_t window, const float *scores, void *context)
+{
+    model_walk_t *walk = context;
+    const session_t *session = walk->session;
+    const float *reference;
+    float error = 0.0f;
+
+    if (window >= session->windows)
+    {
+        return;
+    }
+    reference = session->predictions[window];
+    for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+    {
+        error = fmaxf(error, fabsf(scores[c] - reference[c]));
+    }
+    walk->tally.error_sum += error;
+    walk->tally.max_error = fmaxf(walk->tally.max_error, error);
+    walk->tally.top_changes += (session_argmax(scores) != session_argmax(reference));
+}
+
+
+static void add_tally(model_tally_t *sum, const model_tally_t *tally)
+{
+    sum->sessions++;
+    sum->windows += tally->windows;
+    sum->top_changes += tally->top_changes;
+    sum->error_sum += tally->error_sum;
+    sum->max_error = fmaxf(sum->max_error, tally->max_error);
+    sum->pipeline_ns += tally->pipeline_ns;
+}
@@ -0,0 +1,370 @@
+/*
+ * q15_eval.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Parity of the fixed-point front-end (source/frontend_q15.c) with the float
+ * one. Every session of ML_Model/Data_preparation is converted to q15 the way
+ * audio_ingest_block_q15() does on the device, framed like the model input
+ * window (512 samples, hop 320) and run through frontend_q15_frame(). Each
+ * log-mel frame is compared with the row of the PreprocessorTrack file that
+ * the float sampler.c produced for the same recording. The track is computed
+ * without the digital boost, so the default gain is 1.
+ *
+ * It prints the mean, p99 and maximum absolute error, in natural log units,
+ * per session label and per mel band, and fails when any of them exceeds its
+ * bound. The maximum is large by nature: one LSB of the arm_rfft_q15() output
+ * is about 42 dB below a full scale frame, so bins further below the loudest
+ * bin of the frame are lost in its quantization noise, and a band made of such
+ * bins can be off by several units. The mean and the p99 carry the accuracy
+ * of the front-end, the maximum only catches gross errors. It also prints the
+ * cycles per frame of frontend_q15_frame() and of IMAI_enqueue_block() fed one
+ * hop at a time (q15 conversion, window enqueue, front-end, activity gate and
+ * the model stand-in). The fixed-point front-end is only built with
+ * FRONTEND_Q15_ENABLE, so the command needs a host built with it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "sessions.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "frontend_q15.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Model input window */
+#define WINDOW_LEN                      (FRONTEND_Q15_FFT_LEN)
+#define FRAME_HOP                       (320)
+#define BANDS                           (FRONTEND_Q15_MEL_BANDS)
+
+#if BANDS != SESSION_TRACK_BANDS
+#error "The q15 front-end and the PreprocessorTrack files have different mel bands"
+#endif
+
+/* Default bounds, in natural log units of the mel energies */
+#define DEFAULT_MAX_ERROR               (5.5f)
+#define DEFAULT_P99_ERROR               (0.20f)
+#define DEFAULT_MEAN_ERROR              (0.02f)
+
+/* Error histogram for the p99: ERROR_BIN wide bins up to ERROR_BINS * ERROR_BIN */
+#define ERROR_BIN                       (0.001f)
+#define ERROR_BINS                      (4000)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint64_t count;
+    double sum;
+    float max;
+    uint32_t histogram[ERROR_BINS + 1];
+} error_stats_t;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t q15_cycles;
+    uint64_t model_cycles;
+    uint64_t model_frames;
+} cost_stats_t;
+
+/* What run_session() needs besides the session */
+typedef struct {
+    const char *track_dir;
+    float gain;
+    int verbose;
+    cost_stats_t cost;
+} q15_walk_t;
+
+#if FRONTEND_Q15_ENABLE
+static error_stats_t per_class[SESSION_NUM_CLASSES];
+static error_stats_t per_band[BANDS];
+static error_stats_t total;
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if FRONTEND_Q15_ENABLE
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+static void time_model_frontend(const int16_t *pcm, size_t count, float gain, cost_stats_t *cost);
+static void add_error(error_stats_t *stats, float error);
+static float percentile(const error_stats_t *stats, float fraction);
+static void print_stats(const char *name, const error_stats_t *stats);
+#endif
+
+
+/*******************************************************************************
+* Function Name: q15_eval_main
+********************************************************************************
+* Summary:
+*    smartlistener_host q15-eval [--data DIR] [--pred DIR] [--track DIR]
+*        [--gain X] [--max-error X] [--p99-error X] [--mean-error X] [--verbose]
+*
+*******************************************************************************/
+int q15_eval_main(int argc, char *argv[])
+{
+#if !FRONTEND_Q15_ENABLE
+    (void)argc;
+    (void)argv;
+    fprintf(stderr, "Built without the q15 front-end, rebuild with -DFRONTEND_Q15_ENABLE=1 in CFLAGS\n");
+    return 1;
+#else
+    const char *data_dir = SESSION_DEFAULT_DATA_DIR;
+    const char *pred_dir = SESSION_DEFAULT_PRED_DIR;
+    q15_walk_t walk = { .track_dir = SESSION_DEFAULT_TRACK_DIR, .gain = 1.0f };
+    const cost_stats_t *cost = &walk.cost;
+    float max_error = DEFAULT_MAX_ERROR;
+    float p99_error = DEFAULT_P99_ERROR;
+    float mean_error = DEFAULT_MEAN_ERROR;
+    int pass;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--data") == 0) && (i + 1 < argc))
+        {
+            data_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--pred") == 0) && (i + 1 < argc))
+        {
+            pred_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--track") == 0) && (i + 1 < argc))
+        {
+            walk.track_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--gain") == 0) && (i + 1 < argc))
+        {
+            walk.gain = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--max-error") == 0) && (i + 1 < argc))
+        {
+            max_error = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--p99-error") == 0) && (i + 1 < argc))
+        {
+            p99_error = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--mean-error") == 0) && (i + 1 < argc))
+        {
+            mean_error = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--verbose") == 0)
+        {
+            walk.verbose = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host q15-eval [--data DIR] [--pred DIR] [--track DIR] "
+                "[--gain X] [--max-error X] [--p99-error X] [--mean-error X] [--verbose]\n");
+            return 1;
+        }
+    }
+
+    /* IMAI_init() also hands the model tables to frontend_q15_init() */
+    if ((IMAI_init() != IMAI_RET_SUCCESS) || (session_walk(data_dir, pred_dir, 1, run_session, &walk) < 0))
+    {
+        return 1;
+    }
+    IMAI_finalize();
+
+    if (total.count == 0)
+    {
+        fprintf(stderr, "No frames compared\n");
+        return 1;
+    }
+
+    printf("Absolute log-mel error of the q15 front-end against the float track (gain %.2f)\n", walk.gain);
+    printf("%-16s %10s %10s %10s %10s\n", "Session label", "Values", "Mean", "p99", "Max");
+    for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+    {
+        if (per_class[c].count > 0)
+        {
+            print_stats(session_class_name(c), &per_class[c]);
+        }
+    }
+    print_stats("all", &total);
+    if (walk.verbose)
+    {
+        for (int b = 0; b < BANDS; b++)
+        {
+            char name[16];
+            snprintf(name, sizeof(name), "band %d", b);
+            print_stats(name, &per_band[b]);
+        }
+    }
+
+    printf("Cycles per frame:          frontend_q15_frame() %6.0f  IMAI_enqueue_block() %6.0f\n",
+        (double)cost->q15_cycles / cost->frames,
+        (cost->model_frames > 0) ? (double)cost->model_cycles / cost->model_frames : 0.0);
+    printf("Front-end scratch:         q15 %u bytes  float %u bytes\n",
+        (unsigned)FRONTEND_Q15_SCRATCH_SIZE, (unsigned)(2 * WINDOW_LEN * sizeof(float)));
+
+    pass = (total.max <= max_error) && (percentile(&total, 0.99f) <= p99_error) &&
+           (total.sum / total.count <= mean_error);
+    printf("Bounds:                    max %.3f  p99 %.3f  mean %.4f (%s)\n",
+        max_error, p99_error, mean_error, pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+#endif
+}
+
+#if FRONTEND_Q15_ENABLE
+
+/*******************************************************************************
+* Function Name: run_session
+********************************************************************************
+* Summary:
+*    Runs one recording through frontend_q15_frame() and compares every frame
+*    with its row of the PreprocessorTrack file.
+*
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    q15_walk_t *walk = context;
+    float *track;
+    size_t track_frames;
+    int16_t *pcm;
+    int16_t *q15;
+    int16_t scratch[FRONTEND_Q15_SCRATCH_SIZE / sizeof(int16_t)];
+    float log_mel[BANDS];
+    error_stats_t session_stats;
+
+    (void) index;
+    track = session_load_track(walk->track_dir, session->name, &track_frames);
+    if (track == NULL)
+    {
+        return;
+    }
+
+    pcm = malloc(wav->frames * sizeof(int16_t));
+    q15 = malloc(wav->frames * sizeof(int16_t));
+    if ((pcm == NULL) || (q15 == NULL))
+    {
+        free(pcm);
+        free(q15);
+        free(track);
+        return;
+    }
+    for (size_t i = 0; i < wav->frames; i++)
+    {
+        pcm[i] = wav->samples[i * wav->channels];
+    }
+    audio_ingest_block_q15(pcm, q15, wav->frames, walk->gain);
+    time_model_frontend(pcm, wav->frames, walk->gain, &walk->cost);
+
+    memset(&session_stats, 0, sizeof(session_stats));
+    for (size_t frame = 0; (frame < track_frames) && (frame * FRAME_HOP + WINDOW_LEN <= wav->frames); frame++)
+    {
+        const float *reference = &track[frame * BANDS];
+        uint64_t c0;
+
+        c0 = read_cycles();
+        frontend_q15_frame(&q15[frame * FRAME_HOP], scratch, log_mel);
+        walk->cost.q15_cycles += read_cycles() - c0;
+        walk->cost.frames++;
+
+        for (int b = 0; b < BANDS; b++)
+        {
+            float error = fabsf(log_mel[b] - reference[b]);
+
+            add_error(&total, error);
+            add_error(&per_band[b], error);
+            add_error(&session_stats, error);
+            if (session->label >= 0)
+            {
+                add_error(&per_class[session->label], error);
+            }
+        }
+    }
+
+    if (walk->verbose)
+    {
+        print_stats(session->name, &session_stats);
+    }
+
+    free(pcm);
+    free(q15);
+    free(track);
+}
+
+
+/* The front-end of model.c, fed one hop at a time after the first window */
+static void time_model_frontend(const int16_t *pcm, size_t count, float gain, cost_stats_t *cost)
+{
+    float samples[WINDOW_LEN];
+    float scores[IMAI_DATA_OUT_COUNT];
+    size_t next = 0;
+    size_t n = WINDOW_LEN;
+
+    if (IMAI_init() != IMAI_RET_SUCCESS)
+    {
+        return;
+    }
+    while (next + n <= count)
+    {
+        uint64_t c0;
+        int ready;
+
+        audio_ingest_block(&pcm[next], samples, n, gain);
+        c0 = read_cycles();
+        ready = IMAI_enqueue_block(samples, (int)n);
+        cost->model_cycles += read_cycles() - c0;
+        cost->model_frames++;
+        while (ready-- > 0)
+        {
+            IMAI_dequeue(scores);
+        }
+        next += n;
+        n = FRAME_HOP;
+    }
+}
+
+
+static void add_error(error_stats_t *stats, float error)
+{
+    int bin = (int)(error / ERROR_BIN);
+
+    stats->count++;
+    stats->sum += error;
+    stats->max = (error > stats->max) ? error : stats->max;
+    stats->histogram[(bin < ERROR_BINS) ? bin : ERROR_BINS]++;
+}
+
+
+/* Upper edge of the histogram bin that holds the given fraction of the values */
+static float percentile(const error_stats_t *stats, float fraction)
+{
+    uint64_t target = (uint64_t)ceil(fraction * stats->count);
+    uint64_t seen = 0;
+
+    for (int bin = 0; bin <= ERROR_BINS; bin++)
+    {
+        seen += stats->histogram[bin];
+        if (seen >= target)
+        {
+            return (bin < ERROR_BINS) ? (bin + 1) * ERROR_BIN : stats->max;
+        }
+    }
+    return stats->max;
+}
+
+
+static void print_stats(const char *name, const error_stats_t *stats)
+{
+    if (stats->count == 0)
+    {
+        return;
+    }
+    printf("%-16s %10llu %10.4f %10.3f %10.3f\n", name, (unsigned long long)stats->count,
+        stats->sum / stats->count, percentile(stats, 0.99f), stats->max);
+}
+
+#endif /* FRONTEND_Q15_ENABLE */
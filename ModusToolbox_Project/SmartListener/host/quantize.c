@@ -0,0 +1,1251 @@
+/*
+ * quantize.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Builds the int8 network of quant_model.c from the float model of
+ * models/model.c. Every recorded session goes through model.c and the host
+ * reference interpreter once, with the activity gate disabled, and the
+ * range of every activation tensor is collected after each operator, the
+ * host counterpart of the API_QBOUNDS pass of the DEEPCRAFT runner. A
+ * bounds file of that runner (make bounds in the PreprocessorTrack
+ * .factory directory) can replace any of these ranges, its "features" line
+ * is the model input.
+ *
+ * The network is then quantized: symmetric int8 weights with one scale per
+ * output channel, asymmetric int8 activations with one scale and zero point
+ * per tensor, int32 biases and Q31 requantization multipliers, and the
+ * sessions are run a second time with quant_model_run() on every window the
+ * interpreter sees. The report compares both with the predictions DEEPCRAFT
+ * Studio exported, per class of the reference top score, with the flash,
+ * RAM and time of each network. --output writes the network as C for the
+ * MODEL_INT8_ENABLE build.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "commands.h"
+#include "sessions.h"
+#include "generator.h"
+#include "wav.h"
+#include "activity_gate.h"
+#include "mtb_ml_model.h"
+#include "tflite_model.h"
+#include "quant_model.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define MAX_TENSORS                     (64)
+#define MAX_OPERATORS                   (32)
+#define MAX_LAYERS                      (16)
+#define MAX_INPUT                       (QUANT_MODEL_ACTIVATION_SIZE)
+
+/* Share of the windows whose int8 top class must match the reference */
+#define DEFAULT_MIN_AGREEMENT           (0.95)
+
+/* Static buffers of quant_model.c: activations, LSTM gates, cell and hidden state */
+#define QUANTIZE_RAM_SIZE               (2 * QUANT_MODEL_ACTIVATION_SIZE + \
+                                         QUANT_MODEL_MAX_UNITS * ((LSTM_GATES + 1) * sizeof(float) + 1))
+
+/* Audio per model window: 6 hops of 20 ms */
+#define WINDOW_AUDIO_S                  (0.12)
+
+/* Inputs of UNIDIRECTIONAL_SEQUENCE_LSTM */
+#define LSTM_GATES                      (4)
+#define LSTM_INPUT_WEIGHTS              (1)
+#define LSTM_RECURRENT_WEIGHTS          (5)
+#define LSTM_BIAS                       (12)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    float min;
+    float max;
+} tensor_range_t;
+
+typedef struct {
+    float scale;
+    int32_t zero_point;
+} tensor_quant_t;
+
+/* Writable arrays behind a quant_layer_t and their element counts */
+typedef struct {
+    int8_t *weights;
+    int8_t *recurrent_weights;
+    int32_t *bias;
+    int32_t *multiplier;
+    int8_t *shift;
+    float *scale;
+    float *recurrent_scale;
+    float *float_bias;
+    int weight_count;
+    int recurrent_count;
+    int channel_count;              /* bias, multiplier, shift */
+    int scale_count;                /* scale, recurrent_scale */
+    int float_bias_count;
+} layer_data_t;
+
+typedef struct {
+    size_t windows;
+    size_t float_agree;             /* Top class of the interpreter matches the reference */
+    size_t int8_agree;
+    size_t events;                  /* Reference top score >= SESSION_EVENT_SCORE */
+    size_t float_hits;              /* Events whose top class each network finds */
+    size_t int8_hits;
+    double error_sum;               /* Int8 against the reference, max over the classes */
+    float max_error;
+} class_tally_t;
+
+/* Counters of the two walks over the sessions */
+typedef struct {
+    int verbose;
+    size_t sessions;                /* Pass 1 */
+    size_t windows;
+    class_tally_t per_class[SESSION_NUM_CLASSES];
+    uint64_t float_runs;            /* Pass 2 */
+    uint64_t float_ns;
+    float (*scores)[IMAI_DATA_OUT_COUNT];   /* Interpreter scores of the session being played */
+} quantize_walk_t;
+
+/* What the operator hook does */
+typedef enum {
+    PASS_CALIBRATE = 0,
+    PASS_EVALUATE
+} quantize_pass_t;
+
+static tflite_model_t graph;
+static tflite_operator_t operators[MAX_OPERATORS];
+static tensor_range_t ranges[MAX_TENSORS];
+
+static quant_model_t network;
+static quant_layer_t layers[MAX_LAYERS];
+static layer_data_t layer_data[MAX_LAYERS];
+
+static quantize_pass_t pass;
+static float window[MAX_INPUT];
+static float (*int8_scores)[IMAI_DATA_OUT_COUNT];
+static size_t int8_capacity;
+static size_t int8_count;
+static uint64_t int8_ns;
+static uint64_t int8_runs;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void operator_hook(int op, void *context);
+static void calibrate_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+static void evaluate_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+static void keep_scores(size_t window, const float *scores, void *context);
+static int read_bounds(const char *path);
+static int write_bounds(const char *path);
+static int build_network(void);
+static int add_conv(const tflite_operator_t *op, int *cols, int *channels, tensor_quant_t *quant);
+static int add_lstm(const tflite_operator_t *op, int cols, int channels, tensor_quant_t *quant);
+static int add_mean(const tflite_operator_t *op, int cols, int channels, tensor_quant_t *quant);
+static int add_dense(const tflite_operator_t *op, int channels, const tensor_quant_t *quant);
+static const float *float_tensor(int index, int32_t elements);
+static tensor_quant_t choose_quant(const tensor_range_t *range);
+static float quantize_rows(const float *values, int columns, int8_t *quantized);
+static void quantize_multiplier(double value, int32_t *multiplier, int8_t *shift);
+static int32_t sum_row(const int8_t *values, int count);
+static void free_network(void);
+static uint32_t network_readonly_size(void);
+static uint32_t network_macs(void);
+static int write_network(const char *path, size_t sessions, size_t windows);
+static void print_class_row(const char *name, const class_tally_t *tally);
+
+
+/*******************************************************************************
+* Function Name: quantize_main
+********************************************************************************
+* Summary:
+*    smartlistener_host quantize [--data DIR] [--pred DIR] [--bounds FILE]
+*        [--write-bounds FILE] [--output FILE] [--min-agreement X] [--verbose]
+*
+*******************************************************************************/
+int quantize_main(int argc, char *argv[])
+{
+    const char *data_dir = SESSION_DEFAULT_DATA_DIR;
+    const char *pred_dir = SESSION_DEFAULT_PRED_DIR;
+    const char *bounds_path = NULL;
+    const char *write_bounds_path = NULL;
+    const char *output_path = NULL;
+    double min_agreement = DEFAULT_MIN_AGREEMENT;
+    activity_gate_config_t config;
+    quantize_walk_t walk = { 0 };
+    class_tally_t total = { 0 };
+    const mtb_ml_model_t *model;
+    uint32_t readonly;
+    int result;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--data") == 0) && (i + 1 < argc))
+        {
+            data_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--pred") == 0) && (i + 1 < argc))
+        {
+            pred_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--bounds") == 0) && (i + 1 < argc))
+        {
+            bounds_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--write-bounds") == 0) && (i + 1 < argc))
+        {
+            write_bounds_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+        {
+            output_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--min-agreement") == 0) && (i + 1 < argc))
+        {
+            min_agreement = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--verbose") == 0)
+        {
+            walk.verbose = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host quantize [--data DIR] [--pred DIR] [--bounds FILE]\n"
+                            "           [--write-bounds FILE] [--output FILE] [--min-agreement X] [--verbose]\n");
+            return 1;
+        }
+    }
+
+    activity_gate_get_config(&config);
+    config.enabled = 0;
+    activity_gate_set_config(&config);
+    activity_gate_init();
+
+    if ((IMAI_init() != IMAI_RET_SUCCESS) ||
+        (generator_load_graph(&graph, NULL, 0, operators, MAX_OPERATORS) != 0) || (graph.tensor_count > MAX_TENSORS))
+    {
+        fprintf(stderr, "The model of model.c does not run on the host interpreter\n");
+        IMAI_finalize();
+        return 1;
+    }
+
+    /* Pass 1: activation ranges over every session */
+    for (int t = 0; t < MAX_TENSORS; t++)
+    {
+        ranges[t].min = FLT_MAX;
+        ranges[t].max = -FLT_MAX;
+    }
+    pass = PASS_CALIBRATE;
+    mtb_ml_model_host_set_hook(operator_hook, NULL);
+    if ((session_walk(data_dir, pred_dir, 1, calibrate_session, &walk) < 0) || (walk.windows == 0))
+    {
+        fprintf(stderr, "No session could be calibrated\n");
+        mtb_ml_model_host_set_hook(NULL, NULL);
+        IMAI_finalize();
+        return 1;
+    }
+    if (((bounds_path != NULL) && (read_bounds(bounds_path) != 0)) ||
+        ((write_bounds_path != NULL) && (write_bounds(write_bounds_path) != 0)))
+    {
+        mtb_ml_model_host_set_hook(NULL, NULL);
+        IMAI_finalize();
+        return 1;
+    }
+
+    if ((build_network() != 0) || (quant_model_init(&network) != 0))
+    {
+        fprintf(stderr, "The model cannot be lowered to quant_model.c layers\n");
+        free_network();
+        mtb_ml_model_host_set_hook(NULL, NULL);
+        IMAI_finalize();
+        return 1;
+    }
+
+    /* Pass 2: the int8 network on the windows of the interpreter */
+    pass = PASS_EVALUATE;
+    session_walk(data_dir, pred_dir, 1, evaluate_session, &walk);
+    mtb_ml_model_host_set_hook(NULL, NULL);
+
+    for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+    {
+        const class_tally_t *tally = &walk.per_class[c];
+
+        total.windows += tally->windows;
+        total.float_agree += tally->float_agree;
+        total.int8_agree += tally->int8_agree;
+        total.events += tally->events;
+        total.float_hits += tally->float_hits;
+        total.int8_hits += tally->int8_hits;
+        total.error_sum += tally->error_sum;
+        total.max_error = fmaxf(total.max_error, tally->max_error);
+    }
+    if ((total.windows == 0) || (int8_runs == 0) || (walk.float_runs == 0))
+    {
+        fprintf(stderr, "No session could be evaluated\n");
+        free_network();
+        IMAI_finalize();
+        return 1;
+    }
+
+    printf("Calibration:               %zu windows of %zu sessions%s%s\n", walk.windows, walk.sessions,
+           (bounds_path != NULL) ? ", ranges of " : "", (bounds_path != NULL) ? bounds_path : "");
+    printf("%-16s %8s %8s %8s %7s %7s %8s %8s %10s %10s\n", "Reference top", "Windows", "Float %", "Int8 %", "Delta",
+           "Events", "Float %", "Int8 %", "Max error", "Mean error");
+    printf("%-16s %8s %17s %7s %7s %17s\n", "", "", "top-1 agreement", "", "", "event recall");
+    for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+    {
+        if (walk.per_class[c].windows > 0)
+        {
+            print_class_row(session_class_name(c), &walk.per_class[c]);
+        }
+    }
+    print_class_row("all", &total);
+
+    model = mtb_ml_model_host_object();
+    readonly = network_readonly_size();
+    printf("Flash:                     float %d bytes, int8 %lu bytes (%.1fx less)\n", model->model_size,
+           (unsigned long)readonly, (double)model->model_size / readonly);
+    printf("RAM:                       float %d arena bytes (%d used), int8 %lu bytes\n",
+           mtb_ml_model_host_bin()->arena_size, model->arena_size, (unsigned long)QUANTIZE_RAM_SIZE);
+    printf("MACs:                      %lu per window, int8 x int8 in the int8 network\n",
+           (unsigned long)network_macs());
+    printf("Float interpreter:         %.1f us per window\n", (double)walk.float_ns / walk.float_runs / 1e3);
+    printf("Int8 network:              %.1f us per window (%.2fx the interpreter, %.0fx real time)\n",
+           (double)int8_ns / int8_runs / 1e3, ((double)int8_ns / int8_runs) / ((double)walk.float_ns / walk.float_runs),
+           1e9 * int8_runs * WINDOW_AUDIO_S / (double)int8_ns);
+
+    if (output_path != NULL)
+    {
+        if (write_network(output_path, walk.sessions, walk.windows) != 0)
+        {
+            free_network();
+            IMAI_finalize();
+            return 1;
+        }
+        printf("Written:                   %s\n", output_path);
+    }
+
+    result = ((double)total.int8_agree >= min_agreement * total.windows);
+    printf("Result:                    %s (int8 top-1 agreement %.1f %%, at least %.1f %%)\n",
+           result ? "PASS" : "FAIL", 100.0 * total.int8_agree / total.windows, 100.0 * min_agreement);
+    free_network();
+    IMAI_finalize();
+    return result ? 0 : 1;
+}
+
+
+/* Pass 1 widens the range of every activation the operator reads or writes,
+ * pass 2 keeps the input window and runs the int8 network after the last
+ * operator */
+static void operator_hook(int op, void *context)
+{
+    const tflite_operator_t *current = &operators[op];
+    const float *data;
+    int32_t elements;
+
+    (void) context;
+    if (pass == PASS_CALIBRATE)
+    {
+        for (int k = 0; k < current->input_count + current->output_count; k++)
+        {
+            const int index = (k < current->input_count) ? current->inputs[k] : current->outputs[k - current->input_count];
+
+            data = mtb_ml_model_host_tensor(index, &elements);
+            for (int32_t i = 0; (data != NULL) && (i < elements); i++)
+            {
+                ranges[index].min = fminf(ranges[index].min, data[i]);
+                ranges[index].max = fmaxf(ranges[index].max, data[i]);
+            }
+        }
+        return;
+    }
+
+    if (op == 0)
+    {
+        data = mtb_ml_model_host_tensor(graph.input, &elements);
+        if ((data != NULL) && (elements <= MAX_INPUT))
+        {
+            memcpy(window, data, elements * sizeof(float));
+        }
+    }
+    if ((op == graph.operator_count - 1) && (int8_count < int8_capacity))
+    {
+        const uint64_t start = host_now_ns();
+
+        quant_model_run(window, int8_scores[int8_count++]);
+        int8_ns += host_now_ns() - start;
+        int8_runs++;
+    }
+}
+
+
+/* Pass 1: plays one recording at unit gain, like model-eval, operator_hook()
+ * widens the ranges */
+static void calibrate_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    quantize_walk_t *walk = context;
+    size_t windows;
+
+    (void) session;
+    (void) index;
+    if (session_play(wav, 1.0f, NULL, NULL, &windows) == 0)
+    {
+        walk->sessions++;
+        walk->windows += windows;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: evaluate_session
+********************************************************************************
+* Summary:
+*    Pass 2: plays one recording again, operator_hook() runs the int8 network
+*    on every window the interpreter sees, and compares both with the
+*    reference per class of the reference top score.
+*
+*******************************************************************************/
+static void evaluate_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    quantize_walk_t *walk = context;
+    size_t windows;
+    size_t session_agree = 0;
+    uint64_t runs;
+    uint64_t ns;
+
+    (void) index;
+    /* A few windows more than the reference, the difference is reported */
+    int8_capacity = session->windows + 16;
+    int8_count = 0;
+    int8_scores = malloc(int8_capacity * sizeof(*int8_scores));
+    walk->scores = malloc(int8_capacity * sizeof(*walk->scores));
+    if ((int8_scores != NULL) && (walk->scores != NULL) &&
+        (session_play(wav, 1.0f, keep_scores, walk, &windows) == 0) && (int8_count == windows))
+    {
+        mtb_ml_model_host_run_time(&runs, &ns);
+        walk->float_runs += runs;
+        walk->float_ns += ns;
+        if (windows != session->windows)
+        {
+            fprintf(stderr, "%s: %zu windows, %zu reference predictions\n", session->name, windows,
+                    session->windows);
+        }
+        windows = (windows < session->windows) ? windows : session->windows;
+        for (size_t w = 0; w < windows; w++)
+        {
+            const float *reference = session->predictions[w];
+            const int top = session_argmax(reference);
+            class_tally_t *tally = &walk->per_class[top];
+            float error = 0.0f;
+
+            for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+            {
+                error = fmaxf(error, fabsf(int8_scores[w][c] - reference[c]));
+            }
+            tally->windows++;
+            tally->float_agree += (session_argmax(walk->scores[w]) == top);
+            tally->int8_agree += (session_argmax(int8_scores[w]) == top);
+            session_agree += (session_argmax(int8_scores[w]) == top);
+            if (reference[top] >= SESSION_EVENT_SCORE)
+            {
+                tally->events++;
+                tally->float_hits += (session_argmax(walk->scores[w]) == top);
+                tally->int8_hits += (session_argmax(int8_scores[w]) == top);
+            }
+            tally->error_sum += error;
+            tally->max_error = fmaxf(tally->max_error, error);
+        }
+        if (walk->verbose)
+        {
+            printf("%s %-16s windows %3zu int8 top-1 %5.1f %%\n", session->name, session_class_name(session->label),
+                   windows, (windows > 0) ? 100.0 * session_agree / windows : 0.0);
+        }
+    }
+    free(walk->scores);
+    walk->scores = NULL;
+    free(int8_scores);
+    int8_scores = NULL;
+}
+
+
+/* Float scores of the first int8_capacity windows */
+static void keep_scores(size_t window, const float *scores, void *context)
+{
+    quantize_walk_t *walk = context;
+
+    if (window < int8_capacity)
+    {
+        memcpy(walk->scores[window], scores, sizeof(walk->scores[0]));
+    }
+}
+
+
+/* Runner bounds file: "# name, data_min, data_max", then one line per range.
+ * "features" is the model input, T<n> tensor n, other names are skipped. */
+static int read_bounds(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[256];
+    int used = 0;
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[64];
+        float min;
+        float max;
+        int index = -1;
+
+        if ((line[0] == '#') || (sscanf(line, " %63[^,], %f, %f", name, &min, &max) != 3) || (min > max))
+        {
+            continue;
+        }
+        if (strcmp(name, "features") == 0)
+        {
+            index = graph.input;
+        }
+        else if ((name[0] == 'T') && (sscanf(name + 1, "%d", &index) == 1) &&
+                 ((index < 0) || (index >= graph.tensor_count)))
+        {
+            index = -1;
+        }
+        if (index >= 0)
+        {
+            ranges[index].min = min;
+            ranges[index].max = max;
+            used++;
+        }
+    }
+    fclose(file);
+    if (used == 0)
+    {
+        fprintf(stderr, "%s has no range of this model\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+
+/* Same format, the input as "features" */
+static int write_bounds(const char *path)
+{
+    FILE *file = generator_open(path);
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+    fprintf(file, "# name, data_min, data_max\n");
+    for (int t = 0; t < graph.tensor_count; t++)
+    {
+        if (ranges[t].min > ranges[t].max)
+        {
+            continue;
+        }
+        if (t == graph.input)
+        {
+            fprintf(file, "features, %.20e, %.20e\n", ranges[t].min, ranges[t].max);
+        }
+        else
+        {
+            fprintf(file, "T%d, %.20e, %.20e\n", t, ranges[t].min, ranges[t].max);
+        }
+    }
+    return generator_close(file, path);
+}
+
+
+/*******************************************************************************
+* Function Name: build_network
+********************************************************************************
+* Summary:
+*    Lowers the float graph to quant_model.c layers, in the order
+*    stream_model.c accepts: CONV_2D and MAX_POOL_2D along time, one LSTM,
+*    MEAN over time, FULLY_CONNECTED and SOFTMAX. RESHAPE only renames.
+*
+* Return:
+*    0 on success, -1 if the graph has another shape
+*
+*******************************************************************************/
+static int build_network(void)
+{
+    tflite_tensor_t input;
+    tensor_quant_t quant;
+    int cols;
+    int channels;
+    int current = graph.input;
+    int stage = 0;                  /* 0 convolutions, 1 LSTM, 2 MEAN, 3 FULLY_CONNECTED, 4 SOFTMAX */
+    uint32_t activation = 0;
+
+    free_network();
+    memset(&network, 0, sizeof(network));
+    if ((tflite_model_get_tensor(&graph, graph.input, &input) != 0) || (input.dims != 3) ||
+        (ranges[graph.input].min > ranges[graph.input].max))
+    {
+        return -1;
+    }
+    cols = input.shape[1];
+    channels = input.shape[2];
+    quant = choose_quant(&ranges[graph.input]);
+    network.input_frames = cols;
+    network.input_bands = channels;
+    network.input_scale = quant.scale;
+    network.input_zero_point = quant.zero_point;
+
+    for (int i = 0; i < graph.operator_count; i++)
+    {
+        const tflite_operator_t *op = &operators[i];
+        quant_layer_t *layer = &layers[network.layer_count];
+        int result = -1;
+
+        /* A chain, every operator reads what the one before wrote */
+        if ((op->input_count < 1) || (op->output_count != 1) || (op->inputs[0] != current))
+        {
+            return -1;
+        }
+        current = op->outputs[0];
+        if ((op->code != TFLITE_OP_RESHAPE) && (op->code != TFLITE_OP_SOFTMAX) && (network.layer_count >= MAX_LAYERS))
+        {
+            return -1;
+        }
+        switch (op->code)
+        {
+            case TFLITE_OP_RESHAPE:
+                result = 0;
+                break;
+            case TFLITE_OP_CONV_2D:
+                result = (stage == 0) ? add_conv(op, &cols, &channels, &quant) : -1;
+                break;
+            case TFLITE_OP_MAX_POOL_2D:
+            {
+                int size = tflite_option_int(&graph, op, TFLITE_POOL_FILTER_W, 1) *
+                           tflite_option_int(&graph, op, TFLITE_POOL_FILTER_H, 1);
+                int stride = tflite_option_int(&graph, op, TFLITE_POOL_STRIDE_W, 1) *
+                             tflite_option_int(&graph, op, TFLITE_POOL_STRIDE_H, 1);
+
+                /* Same scale and zero point in and out */
+                if ((stage == 0) && (size >= 2) && (size == stride) && (cols / size >= 1) &&
+                    (tflite_option_byte(&graph, op, TFLITE_POOL_PADDING, TFLITE_PADDING_SAME) == TFLITE_PADDING_VALID) &&
+                    (tflite_option_byte(&graph, op, TFLITE_POOL_ACTIVATION, TFLITE_ACTIVATION_NONE) == TFLITE_ACTIVATION_NONE))
+                {
+                    memset(layer, 0, sizeof(*layer));
+                    layer->type = QUANT_LAYER_MAX_POOL;
+                    layer->in_cols = cols;
+                    layer->in_channels = channels;
+                    layer->out_cols = cols / size;
+                    layer->out_channels = channels;
+                    layer->taps = size;
+                    layer->stride = size;
+                    cols = layer->out_cols;
+                    result = 0;
+                }
+                break;
+            }
+            case TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM:
+                result = (stage == 0) ? add_lstm(op, cols, channels, &quant) : -1;
+                channels = layer->out_channels;
+                stage = 1;
+                break;
+            case TFLITE_OP_MEAN:
+                result = (stage == 1) ? add_mean(op, cols, channels, &quant) : -1;
+                cols = 1;
+                stage = 2;
+                break;
+            case TFLITE_OP_FULLY_CONNECTED:
+                result = (stage == 2) ? add_dense(op, channels, &quant) : -1;
+                stage = 3;
+                break;
+            case TFLITE_OP_SOFTMAX:
+                result = ((stage == 3) && (tflite_option_float(&graph, op, TFLITE_SOFTMAX_BETA, 1.0f) == 1.0f)) ? 0 : -1;
+                stage = 4;
+                break;
+            default:
+                break;
+        }
+        if (result != 0)
+        {
+            return -1;
+        }
+        if ((op->code != TFLITE_OP_RESHAPE) && (op->code != TFLITE_OP_SOFTMAX))
+        {
+            uint32_t in = (uint32_t)layer->in_cols * layer->in_channels;
+            uint32_t out = (uint32_t)layer->out_cols * layer->out_channels;
+
+            activation = (in > activation) ? in : activation;
+            activation = ((layer->type != QUANT_LAYER_DENSE) && (out > activation)) ? out : activation;
+            network.layer_count++;
+        }
+    }
+    if ((stage != 4) || (current != graph.output))
+    {
+        return -1;
+    }
+    network.layers = layers;
+    network.output_count = layers[network.layer_count - 1].out_channels;
+    network.activation_size = activation;
+    network.readonly_size = network_readonly_size();
+    return 0;
+}
+
+
+/* CONV_2D along time: [1, 1, cols, channels] input, [out, 1, taps, channels]
+ * filter, ReLU or no activation */
+static int add_conv(const tflite_operator_t *op, int *cols, int *channels, tensor_quant_t *quant)
+{
+    quant_layer_t *layer = &layers[network.layer_count];
+    layer_data_t *data = &layer_data[network.layer_count];
+    tflite_tensor_t kernel;
+    tensor_quant_t output;
+    const float *weights;
+    const float *bias;
+    int padding;
+    int activation;
+    int total;
+
+    memset(layer, 0, sizeof(*layer));
+    if ((op->input_count < 3) || (op->inputs[2] < 0) || (tflite_model_get_tensor(&graph, op->inputs[1], &kernel) != 0) ||
+        (kernel.dims != 4) || (kernel.shape[1] != 1) || (kernel.shape[3] != *channels) || (kernel.shape[2] > 255) ||
+        (ranges[op->outputs[0]].min > ranges[op->outputs[0]].max))
+    {
+        return -1;
+    }
+    layer->type = QUANT_LAYER_CONV;
+    layer->in_cols = *cols;
+    layer->in_channels = *channels;
+    layer->out_channels = kernel.shape[0];
+    layer->taps = kernel.shape[2];
+    layer->stride = tflite_option_int(&graph, op, TFLITE_CONV_STRIDE_W, 1);
+    padding = tflite_option_byte(&graph, op, TFLITE_CONV_PADDING, TFLITE_PADDING_SAME);
+    activation = tflite_option_byte(&graph, op, TFLITE_CONV_ACTIVATION, TFLITE_ACTIVATION_NONE);
+    weights = float_tensor(op->inputs[1], tflite_tensor_elements(&kernel));
+    bias = float_tensor(op->inputs[2], layer->out_channels);
+    if ((weights == NULL) || (bias == NULL) || (layer->stride < 1) ||
+        (tflite_option_int(&graph, op, TFLITE_CONV_STRIDE_H, 1) != 1) ||
+        (tflite_option_int(&graph, op, TFLITE_CONV_DILATION_W, 1) != 1) ||
+        ((activation != TFLITE_ACTIVATION_NONE) && (activation != TFLITE_ACTIVATION_RELU)))
+    {
+        return -1;
+    }
+    if (padding == TFLITE_PADDING_SAME)
+    {
+        layer->out_cols = (*cols + layer->stride - 1) / layer->stride;
+        total = (layer->out_cols - 1) * layer->stride + layer->taps - *cols;
+        layer->pad = (total > 0) ? total / 2 : 0;
+    }
+    else
+    {
+        layer->out_cols = (*cols - layer->taps) / layer->stride + 1;
+    }
+    if (layer->out_cols < 1)
+    {
+        return -1;
+    }
+
+    output = choose_quant(&ranges[op->outputs[0]]);
+    layer->input_offset = -quant->zero_point;
+    layer->output_offset = output.zero_point;
+    layer->act_min = (activation == TFLITE_ACTIVATION_RELU) ? output.zero_point : -128;
+    layer->act_max = 127;
+
+    data->weight_count = tflite_tensor_elements(&kernel);
+    data->channel_count = layer->out_channels;
+    data->weights = malloc(data->weight_count);
+    data->bias = malloc(data->channel_count * sizeof(int32_t));
+    data->multiplier = malloc(data->channel_count * sizeof(int32_t));
+    data->shift = malloc(data->channel_count);
+    if ((data->weights == NULL) || (data->bias == NULL) || (data->multiplier == NULL) || (data->shift == NULL))
+    {
+        return -1;
+    }
+    for (int o = 0; o < layer->out_channels; o++)
+    {
+        const int columns = layer->taps * layer->in_channels;
+        const double weight_scale = quantize_rows(&weights[o * columns], columns, &data->weights[o * columns]);
+        const double bias_scale = (double)quant->scale * weight_scale;
+
+        data->bias[o] = (int32_t)lrint(bias[o] / bias_scale) +
+                        layer->input_offset * sum_row(&data->weights[o * columns], columns);
+        quantize_multiplier(bias_scale / output.scale, &data->multiplier[o], &data->shift[o]);
+    }
+    layer->weights = data->weights;
+    layer->bias = data->bias;
+    layer->multiplier = data->multiplier;
+    layer->shift = data->shift;
+
+    *cols = layer->out_cols;
+    *channels = layer->out_channels;
+    *quant = output;
+    return 0;
+}
+
+
+/* UNIDIRECTIONAL_SEQUENCE_LSTM without peepholes, projection or layer norm,
+ * batch major, tanh, as stream_model.c. Rows of the 4 gates are stacked. */
+static int add_lstm(const tflite_operator_t *op, int cols, int channels, tensor_quant_t *quant)
+{
+    quant_layer_t *layer = &layers[network.layer_count];
+    layer_data_t *data = &layer_data[network.layer_count];
+    tflite_tensor_t weights;
+    int units;
+
+    memset(layer, 0, sizeof(*layer));
+    if ((op->input_count < 16) || (tflite_model_get_tensor(&graph, op->inputs[LSTM_INPUT_WEIGHTS], &weights) != 0) ||
+        (weights.dims != 2) || (weights.shape[1] != channels) || (weights.shape[0] > QUANT_MODEL_MAX_UNITS) ||
+        (tflite_option_byte(&graph, op, TFLITE_LSTM_ACTIVATION, TFLITE_ACTIVATION_TANH) != TFLITE_ACTIVATION_TANH) ||
+        (tflite_option_byte(&graph, op, TFLITE_LSTM_TIME_MAJOR, 0) != 0))
+    {
+        return -1;
+    }
+    for (int i = 9; i < op->input_count; i++)
+    {
+        /* Inputs 18 and 19 are the zero initial states */
+        if (((i < LSTM_BIAS) || (i >= LSTM_BIAS + LSTM_GATES)) && (i != 18) && (i != 19) && (op->inputs[i] >= 0))
+        {
+            return -1;
+        }
+    }
+    units = weights.shape[0];
+    layer->type = QUANT_LAYER_LSTM;
+    layer->in_cols = cols;
+    layer->in_channels = channels;
+    layer->out_cols = cols;
+    layer->out_channels = units;
+    layer->cell_clip = tflite_option_float(&graph, op, TFLITE_LSTM_CELL_CLIP, 0.0f);
+
+    data->weight_count = LSTM_GATES * units * channels;
+    data->recurrent_count = LSTM_GATES * units * units;
+    data->scale_count = LSTM_GATES * units;
+    data->float_bias_count = LSTM_GATES * units;
+    data->weights = malloc(data->weight_count);
+    data->recurrent_weights = malloc(data->recurrent_count);
+    data->scale = malloc(data->scale_count * sizeof(float));
+    data->recurrent_scale = malloc(data->scale_count * sizeof(float));
+    data->float_bias = malloc(data->float_bias_count * sizeof(float));
+    if ((data->weights == NULL) || (data->recurrent_weights == NULL) || (data->scale == NULL) ||
+        (data->recurrent_scale == NULL) || (data->float_bias == NULL))
+    {
+        return -1;
+    }
+    for (int g = 0; g < LSTM_GATES; g++)
+    {
+        const float *input_weights = float_tensor(op->inputs[LSTM_INPUT_WEIGHTS + g], units * channels);
+        const float *recurrent_weights = float_tensor(op->inputs[LSTM_RECURRENT_WEIGHTS + g], units * units);
+        const float *bias = float_tensor(op->inputs[LSTM_BIAS + g], units);
+
+        if ((input_weights == NULL) || (recurrent_weights == NULL) || (bias == NULL))
+        {
+            return -1;
+        }
+        for (int u = 0; u < units; u++)
+        {
+            const int row = g * units + u;
+
+            data->scale[row] = quant->scale *
+                               quantize_rows(&input_weights[u * channels], channels, &data->weights[row * channels]);
+            data->recurrent_scale[row] = QUANT_MODEL_HIDDEN_SCALE *
+                               quantize_rows(&recurrent_weights[u * units], units, &data->recurrent_weights[row * units]);
+            data->float_bias[row] = bias[u] - quant->zero_point * data->scale[row] *
+                                    sum_row(&data->weights[row * channels], channels);
+        }
+    }
+    layer->weights = data->weights;
+    layer->recurrent_weights = data->recurrent_weights;
+    layer->scale = data->scale;
+    layer->recurrent_scale = data->recurrent_scale;
+    layer->float_bias = data->float_bias;
+
+    quant->scale = QUANT_MODEL_HIDDEN_SCALE;
+    quant->zero_point = 0;
+    return 0;
+}
+
+
+/* MEAN over time of the [1, cols, channels] LSTM output */
+static int add_mean(const tflite_operator_t *op, int cols, int channels, tensor_quant_t *quant)
+{
+    quant_layer_t *layer = &layers[network.layer_count];
+    layer_data_t *data = &layer_data[network.layer_count];
+    tflite_tensor_t axes;
+    tensor_quant_t output;
+
+    memset(layer, 0, sizeof(*layer));
+    if ((op->input_count < 2) || (tflite_model_get_tensor(&graph, op->inputs[1], &axes) != 0) ||
+        (axes.type != TFLITE_TYPE_INT32) || (axes.data == NULL) || (tflite_tensor_elements(&axes) != 1) ||
+        (*(const int32_t *)axes.data != 1) || (ranges[op->outputs[0]].min > ranges[op->outputs[0]].max))
+    {
+        return -1;
+    }
+    output = choose_quant(&ranges[op->outputs[0]]);
+    layer->type = QUANT_LAYER_MEAN;
+    layer->in_cols = cols;
+    layer->in_channels = channels;
+    layer->out_cols = 1;
+    layer->out_channels = channels;
+    layer->input_offset = -quant->zero_point;
+    layer->output_offset = output.zero_point;
+    layer->act_min = -128;
+    layer->act_max = 127;
+
+    data->scale_count = 1;
+    data->scale = malloc(sizeof(float));
+    if (data->scale == NULL)
+    {
+        return -1;
+    }
+    data->scale[0] = quant->scale / (cols * output.scale);
+    layer->scale = data->scale;
+    *quant = output;
+    return 0;
+}
+
+
+/* FULLY_CONNECTED without activation, float logits for the SOFTMAX */
+static int add_dense(const tflite_operator_t *op, int channels, const tensor_quant_t *quant)
+{
+    quant_layer_t *layer = &layers[network.layer_count];
+    layer_data_t *data = &layer_data[network.layer_count];
+    tflite_tensor_t weights;
+    const float *values;
+    const float *bias;
+    int outputs;
+
+    memset(layer, 0, sizeof(*layer));
+    if ((op->input_count < 3) || (tflite_model_get_tensor(&graph, op->inputs[1], &weights) != 0) ||
+        (weights.dims != 2) || (weights.shape[1] != channels) || (weights.shape[0] > QUANT_MODEL_MAX_OUTPUTS) ||
+        (tflite_option_byte(&graph, op, TFLITE_FC_ACTIVATION, TFLITE_ACTIVATION_NONE) != TFLITE_ACTIVATION_NONE))
+    {
+        return -1;
+    }
+    outputs = weights.shape[0];
+    values = float_tensor(op->inputs[1], outputs * channels);
+    bias = float_tensor(op->inputs[2], outputs);
+    if ((values == NULL) || (bias == NULL))
+    {
+        return -1;
+    }
+    layer->type = QUANT_LAYER_DENSE;
+    layer->in_cols = 1;
+    layer->in_channels = channels;
+    layer->out_cols = 1;
+    layer->out_channels = outputs;
+
+    data->weight_count = outputs * channels;
+    data->scale_count = outputs;
+    data->float_bias_count = outputs;
+    data->weights = malloc(data->weight_count);
+    data->scale = malloc(outputs * sizeof(float));
+    data->float_bias = malloc(outputs * sizeof(float));
+    if ((data->weights == NULL) || (data->scale == NULL) || (data->float_bias == NULL))
+    {
+        return -1;
+    }
+    for (int o = 0; o < outputs; o++)
+    {
+        data->scale[o] = quant->scale * quantize_rows(&values[o * channels], channels, &data->weights[o * channels]);
+        data->float_bias[o] = bias[o] - quant->zero_point * data->scale[o] * sum_row(&data->weights[o * channels], channels);
+    }
+    layer->weights = data->weights;
+    layer->scale = data->scale;
+    layer->float_bias = data->float_bias;
+    return 0;
+}
+
+
+/* Constant float tensor with the given number of elements, NULL otherwise */
+static const float *float_tensor(int index, int32_t elements)
+{
+    tflite_tensor_t tensor;
+
+    if ((index < 0) || (tflite_model_get_tensor(&graph, index, &tensor) != 0) ||
+        (tensor.type != TFLITE_TYPE_FLOAT32) || (tensor.data == NULL) || (tensor.bytes != elements * sizeof(float)))
+    {
+        return NULL;
+    }
+    return (const float *)tensor.data;
+}
+
+
+/* Asymmetric int8 over the range widened to hold 0, so zero padding and ReLU
+ * are exact */
+static tensor_quant_t choose_quant(const tensor_range_t *range)
+{
+    const double min = (range->min < 0.0f) ? range->min : 0.0;
+    const double max = (range->max > 0.0f) ? range->max : 0.0;
+    tensor_quant_t quant;
+    long zero_point;
+
+    quant.scale = (max > min) ? (float)((max - min) / 255.0) : 1.0f;
+    zero_point = lrint(-128.0 - min / quant.scale);
+    quant.zero_point = (zero_point < -128) ? -128 : ((zero_point > 127) ? 127 : (int32_t)zero_point);
+    return quant;
+}
+
+
+/* Symmetric int8 of one row, returns its scale */
+static float quantize_rows(const float *values, int columns, int8_t *quantized)
+{
+    float max = 0.0f;
+    float scale;
+
+    for (int i = 0; i < columns; i++)
+    {
+        max = fmaxf(max, fabsf(values[i]));
+    }
+    scale = (max > 0.0f) ? max / 127.0f : 1.0f;
+    for (int i = 0; i < columns; i++)
+    {
+        long q = lrintf(values[i] / scale);
+
+        quantized[i] = (int8_t)((q > 127) ? 127 : ((q < -127) ? -127 : q));
+    }
+    return scale;
+}
+
+
+/* value = multiplier * 2^(shift - 31), multiplier in [2^30, 2^31) */
+static void quantize_multiplier(double value, int32_t *multiplier, int8_t *shift)
+{
+    int exponent;
+    long long q;
+
+    if (value <= 0.0)
+    {
+        *multiplier = 0;
+        *shift = 0;
+        return;
+    }
+    q = llround(frexp(value, &exponent) * 2147483648.0);
+    if (q == 2147483648LL)
+    {
+        q /= 2;
+        exponent++;
+    }
+    if (exponent < -31)
+    {
+        q = 0;
+        exponent = 0;
+    }
+    /* quant_model.c shifts right by 31 - shift, at least 1 */
+    *multiplier = (int32_t)q;
+    *shift = (int8_t)((exponent > 30) ? 30 : exponent);
+}
+
+
+/* quant_model.c folds input offset * sum of the weights into the biases */
+static int32_t sum_row(const int8_t *values, int count)
+{
+    int32_t sum = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        sum += values[i];
+    }
+    return sum;
+}
+
+
+static void free_network(void)
+{
+    for (int i = 0; i < MAX_LAYERS; i++)
+    {
+        free(layer_data[i].weights);
+        free(layer_data[i].recurrent_weights);
+        free(layer_data[i].bias);
+        free(layer_data[i].multiplier);
+        free(layer_data[i].shift);
+        free(layer_data[i].scale);
+        free(layer_data[i].recurrent_scale);
+        free(layer_data[i].float_bias);
+        memset(&layer_data[i], 0, sizeof(layer_data[i]));
+    }
+}
+
+
+/* Arrays of model_int8.c, the layer descriptors come on top */
+static uint32_t network_readonly_size(void)
+{
+    uint32_t bytes = 0;
+
+    for (int i = 0; i < network.layer_count; i++)
+    {
+        const layer_data_t *data = &layer_data[i];
+
+        bytes += data->weight_count + data->recurrent_count + data->channel_count * (2 * sizeof(int32_t) + 1) +
+                 data->scale_count * sizeof(float) * ((data->recurrent_scale != NULL) ? 2 : 1) +
+                 data->float_bias_count * sizeof(float);
+    }
+    return bytes;
+}
+
+
+/* Multiply-accumulates of one window, the same in both networks */
+static uint32_t network_macs(void)
+{
+    uint32_t macs = 0;
+
+    for (int i = 0; i < network.layer_count; i++)
+    {
+        const quant_layer_t *layer = &layers[i];
+
+        switch (layer->type)
+        {
+            case QUANT_LAYER_CONV:
+                macs += (uint32_t)layer->out_cols * layer->out_channels * layer->taps * layer->in_channels;
+                break;
+            case QUANT_LAYER_LSTM:
+                macs += (uint32_t)layer->in_cols * LSTM_GATES * layer->out_channels *
+                        (layer->in_channels + layer->out_channels);
+                break;
+            case QUANT_LAYER_DENSE:
+                macs += (uint32_t)layer->out_channels * layer->in_channels;
+                break;
+            default:
+                break;
+        }
+    }
+    return macs;
+}
+
+
+/*******************************************************************************
+* Function Name: write_network
+********************************************************************************
+* Summary:
+*    Writes the network as models/model_int8.c.
+*
+*******************************************************************************/
+static int write_network(const char *path, size_t sessions, size_t windows)
+{
+    static const char *const type_names[] = {
+        "QUANT_LAYER_CONV", "QUANT_LAYER_MAX_POOL", "QUANT_LAYER_LSTM", "QUANT_LAYER_MEAN", "QUANT_LAYER_DENSE"
+    };
+    FILE *file = generator_open(path);
+    const mtb_ml_model_t *model = mtb_ml_model_host_object();
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+    fprintf(file, "/*\n"
+                  " * model_int8.c\n"
+                  " *\n"
+                  " * Generated by smartlistener_host quantize from the model of models/model.c\n"
+                  " * and the activation ranges of %zu windows of %zu sessions. Any changes\n"
+                  " * will be lost.\n"
+                  " *\n"
+                  " * Memory    Size\n"
+                  " * Readonly  %lu bytes (Flash), the float model is %d bytes\n"
+                  " * State     %lu bytes (RAM), the buffers of quant_model.c\n"
+                  " */\n\n"
+                  "#include \"quant_model.h\"\n\n"
+                  "#if MODEL_INT8_ENABLE\n\n",
+            windows, sessions, (unsigned long)network.readonly_size, model->model_size,
+            (unsigned long)QUANTIZE_RAM_SIZE);
+
+    for (int i = 0; i < network.layer_count; i++)
+    {
+        const layer_data_t *data = &layer_data[i];
+
+        fprintf(file, "// Layer %d: %s, [%d, %d] to [%d, %d]\n", i, type_names[layers[i].type], layers[i].in_cols,
+                layers[i].in_channels, layers[i].out_cols, layers[i].out_channels);
+        generator_write_int8(file, data->weights, data->weight_count, "_L%d_weights", i);
+        generator_write_int32(file, data->bias, data->channel_count, "_L%d_bias", i);
+        generator_write_int32(file, data->multiplier, data->channel_count, "_L%d_multiplier", i);
+        generator_write_int8(file, data->shift, data->channel_count, "_L%d_shift", i);
+        generator_write_int8(file, data->recurrent_weights, data->recurrent_count, "_L%d_recurrent_weights", i);
+        generator_write_floats(file, data->scale, data->scale_count, "_L%d_scale", i);
+        generator_write_floats(file, data->recurrent_scale, (data->recurrent_scale != NULL) ? data->scale_count : 0,
+                               "_L%d_recurrent_scale", i);
+        generator_write_floats(file, data->float_bias, data->float_bias_count, "_L%d_float_bias", i);
+    }
+
+    fprintf(file, "static const quant_layer_t _layers[%d] = {\n", network.layer_count);
+    for (int i = 0; i < network.layer_count; i++)
+    {
+        const quant_layer_t *layer = &layers[i];
+        const layer_data_t *data = &layer_data[i];
+
+        fprintf(file, "    {\n"
+                      "        .type = %s,\n"
+                      "        .in_cols = %d, .in_channels = %d, .out_cols = %d, .out_channels = %d,\n"
+                      "        .taps = %d, .stride = %d, .pad = %d,\n"
+                      "        .input_offset = %d, .output_offset = %d, .act_min = %d, .act_max = %d,\n",
+                type_names[layer->type], layer->in_cols, layer->in_channels, layer->out_cols, layer->out_channels,
+                layer->taps, layer->stride, layer->pad, layer->input_offset, layer->output_offset, layer->act_min,
+                layer->act_max);
+        if (data->weight_count > 0)
+        {
+            fprintf(file, "        .weights = _L%d_weights,\n", i);
+        }
+        if (data->channel_count > 0)
+        {
+            fprintf(file, "        .bias = _L%d_bias, .multiplier = _L%d_multiplier, .shift = _L%d_shift,\n", i, i, i);
+        }
+        if (data->recurrent_count > 0)
+        {
+            fprintf(file, "        .recurrent_weights = _L%d_recurrent_weights, .recurrent_scale = _L%d_recurrent_scale,\n",
+                    i, i);
+        }
+        if (data->scale_count > 0)
+        {
+            fprintf(file, "        .scale = _L%d_scale,\n", i);
+        }
+        if (data->float_bias_count > 0)
+        {
+            fprintf(file, "        .float_bias = _L%d_float_bias,\n", i);
+        }
+        fprintf(file, "        .cell_clip = %.8ef,\n"
+                      "    },\n", layer->cell_clip);
+    }
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "const quant_model_t model_int8 = {\n"
+                  "    .layers = _layers,\n"
+                  "    .layer_count = %d,\n"
+                  "    .input_frames = %d,\n"
+                  "    .input_bands = %d,\n"
+                  "    .input_scale = %.8ef,\n"
+                  "    .input_zero_point = %d,\n"
+                  "    .output_count = %d,\n"
+                  "    .activation_size = %lu,\n"
+                  "    .readonly_size = %lu,\n"
+                  "};\n\n"
+                  "#endif /* MODEL_INT8_ENABLE */\n",
+            network.layer_count, network.input_frames, network.input_bands, network.input_scale,
+            network.input_zero_point, network.output_count, (unsigned long)network.activation_size,
+            (unsigned long)network.readonly_size);
+
+    return generator_close(file, path);
+}
+
+
+static void print_class_row(const char *name, const class_tally_t *tally)
+{
+    const double float_agree = 100.0 * tally->float_agree / tally->windows;
+    const double int8_agree = 100.0 * tally->int8_agree / tally->windows;
+
+    printf("%-16s %8zu %8.1f %8.1f %7.1f %7zu ", name, tally->windows, float_agree, int8_agree,
+           int8_agree - float_agree, tally->events);
+    if (tally->events > 0)
+    {
+        printf("%8.1f %8.1f", 100.0 * tally->float_hits / tally->events, 100.0 * tally->int8_hits / tally->events);
+    }
+    else
+    {
+        printf("%8s %8s", "-", "-");
+    }
+    printf(" %10.2e %10.2e\n", tally->max_error, tally->error_sum / tally->windows);
+}
@@ -0,0 +1,255 @@
+/*
+ * replay.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Replays a recording through the ping-pong capture engine. With
+ * --pipeline the blocks also go through the ML task processing (ingest,
+ * IMAI_enqueue_block(), IMAI_dequeue()) under the deadline monitor, and
+ * --sweep doubles the replay speed until the pipeline falls behind to find
+ * its breaking point.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "commands.h"
+#include "audio_capture_wav.h"
+#include "audio_ingest.h"
+#include "activity_gate.h"
+#include "deadline_monitor.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same input gain as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+
+/* Highest speed tried by --sweep */
+#define REPLAY_MAX_SPEED                (1024.0f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    int pipeline;                   /* Run the ML task processing */
+    long work_us;                   /* Extra busy time per block */
+    long model_us;                  /* Busy time per model output, stands in for the model */
+} replay_options_t;
+
+typedef struct {
+    audio_capture_stats_t capture;
+    deadline_stats_t block;
+    deadline_stats_t output;
+} replay_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int replay_run(const char *path, float speed, const replay_options_t *options, replay_result_t *result);
+static int replay_missed(const replay_result_t *result);
+static void print_deadline(const char *name, const deadline_stats_t *stats);
+static void busy_wait_us(long us);
+
+
+/*******************************************************************************
+* Function Name: replay_main
+********************************************************************************
+* Summary:
+*    smartlistener_host replay <file.wav> [--speed N] [--work-us N]
+*                              [--pipeline] [--model-us N] [--sweep]
+*
+*    Consumes a WAV recording through the capture engine and reports the
+*    capture counters and, with --pipeline, the deadline monitor.
+*
+*******************************************************************************/
+int replay_main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    float speed = 1.0f;
+    int sweep = 0;
+    replay_options_t options = { 0, 0, 0 };
+    replay_result_t result;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--speed") == 0) && (i + 1 < argc))
+        {
+            speed = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--work-us") == 0) && (i + 1 < argc))
+        {
+            options.work_us = atol(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--model-us") == 0) && (i + 1 < argc))
+        {
+            options.model_us = atol(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--pipeline") == 0)
+        {
+            options.pipeline = 1;
+        }
+        else if (strcmp(argv[i], "--sweep") == 0)
+        {
+            sweep = 1;
+            options.pipeline = 1;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if ((path == NULL) || (speed <= 0.0f))
+    {
+        fprintf(stderr, "usage: smartlistener_host replay <file.wav> [--speed N] [--work-us N]\n"
+                        "                                 [--pipeline] [--model-us N] [--sweep]\n");
+        return 1;
+    }
+
+    if (!sweep)
+    {
+        if (replay_run(path, speed, &options, &result) != 0)
+        {
+            return 1;
+        }
+
+        printf("Blocks captured:          %lu\n", (unsigned long)result.capture.blocks_captured);
+        printf("Blocks delivered:         %lu\n", (unsigned long)result.capture.blocks_delivered);
+        printf("Overruns:                 %lu\n", (unsigned long)result.capture.overruns);
+        printf("Audio buffer utilization: %.3f\n", audio_capture_utilization(&result.capture));
+        if (options.pipeline)
+        {
+            print_deadline("Block deadline:  ", &result.block);
+            print_deadline("Output deadline: ", &result.output);
+        }
+        return 0;
+    }
+
+    /* Double the speed until the pipeline falls behind */
+    printf("%8s %9s %9s %10s %10s %8s %10s %10s %8s\n", "speed", "blocks", "overruns",
+        "block p99", "worst", "missed", "output p99", "worst", "missed");
+    for (; speed <= REPLAY_MAX_SPEED; speed *= 2.0f)
+    {
+        if (replay_run(path, speed, &options, &result) != 0)
+        {
+            return 1;
+        }
+        printf("%7.1fx %9lu %9lu %8luus %8luus %8lu %8luus %8luus %8lu\n", speed,
+            (unsigned long)result.capture.blocks_captured, (unsigned long)result.capture.overruns,
+            (unsigned long)result.block.p99_us, (unsigned long)result.block.worst_us,
+            (unsigned long)result.block.missed, (unsigned long)result.output.p99_us,
+            (unsigned long)result.output.worst_us, (unsigned long)result.output.missed);
+        if (replay_missed(&result))
+        {
+            printf("Breaking point: %.1fx real time (deadlines %luus per block, %luus per output)\n",
+                speed, (unsigned long)result.block.period_us, (unsigned long)result.output.period_us);
+            return 0;
+        }
+    }
+    printf("No deadline missed up to %.0fx real time\n", REPLAY_MAX_SPEED);
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: replay_run
+********************************************************************************
+* Summary:
+*    Replays the recording once at the given speed. The capture port delivers
+*    a block every block period divided by speed and the deadlines of the
+*    monitor are scaled the same way.
+*
+*******************************************************************************/
+static int replay_run(const char *path, float speed, const replay_options_t *options, replay_result_t *result)
+{
+    const int16_t *block;
+    float samples[AUDIO_CAPTURE_BLOCK_SIZE];
+#if AUDIO_CAPTURE_CHANNELS == 2
+    float samples_right[AUDIO_CAPTURE_BLOCK_SIZE];
+#endif
+    float scores[IMAI_DATA_OUT_COUNT];
+    int outputs;
+    int status;
+
+    if ((audio_capture_wav_open(path, speed) != 0) ||
+        (audio_capture_init() != AUDIO_CAPTURE_SUCCESS))
+    {
+        return 1;
+    }
+    IMAI_init();
+    activity_gate_init();
+    deadline_monitor_init(speed);
+    if (audio_capture_start() != AUDIO_CAPTURE_SUCCESS)
+    {
+        audio_capture_wav_close();
+        return 1;
+    }
+
+    while ((status = audio_capture_read(&block, AUDIO_CAPTURE_WAIT_FOREVER)) == AUDIO_CAPTURE_SUCCESS)
+    {
+        /* The ping-pong engine holds at most one other block */
+        deadline_monitor_block_begin(0);
+        busy_wait_us(options->work_us);
+        if (options->pipeline)
+        {
+#if AUDIO_CAPTURE_CHANNELS == 2
+            audio_ingest_stereo_block(block, samples, samples_right, AUDIO_CAPTURE_BLOCK_SIZE, DIGITAL_BOOST_FACTOR);
+            outputs = IMAI_enqueue_block_stereo(samples, samples_right, AUDIO_CAPTURE_BLOCK_SIZE);
+#else
+            audio_ingest_block(block, samples, AUDIO_CAPTURE_BLOCK_SIZE, DIGITAL_BOOST_FACTOR);
+            outputs = IMAI_enqueue_block(samples, AUDIO_CAPTURE_BLOCK_SIZE);
+#endif
+            while ((outputs-- > 0) && (IMAI_dequeue(scores) == IMAI_RET_SUCCESS))
+            {
+                busy_wait_us(options->model_us);
+                deadline_monitor_output();
+            }
+        }
+        deadline_monitor_block_end();
+        audio_capture_release();
+    }
+
+    audio_capture_get_stats(&result->capture);
+    deadline_monitor_get_stats(DEADLINE_BLOCK, &result->block);
+    deadline_monitor_get_stats(DEADLINE_OUTPUT, &result->output);
+    audio_capture_wav_close();
+
+    return (status == AUDIO_CAPTURE_STREAMEND) ? 0 : 1;
+}
+
+
+/* The pipeline is behind when more than 1% of the blocks are lost or the
+ * p99 of either channel is over its deadline. Isolated misses caused by the
+ * host scheduler do not count. */
+static int replay_missed(const replay_result_t *result)
+{
+    return (result->capture.overruns * 100 > result->capture.blocks_captured) ||
+           (result->block.p99_us > result->block.period_us) ||
+           (result->output.p99_us > result->output.period_us);
+}
+
+
+static void print_deadline(const char *name, const deadline_stats_t *stats)
+{
+    printf("%s p99 %luus, mean %luus, worst %luus of %luus, missed %lu/%lu\n", name,
+        (unsigned long)stats->p99_us, (unsigned long)stats->mean_us, (unsigned long)stats->worst_us,
+        (unsigned long)stats->period_us, (unsigned long)stats->missed, (unsigned long)stats->count);
+}
+
+
+static void busy_wait_us(long us)
+{
+    struct timespec start;
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ((now.tv_sec - start.tv_sec) * 1000000L + (now.tv_nsec - start.tv_nsec) / 1000L < us);
+}
@@ -0,0 +1,267 @@
+/*
+ * ring_stress.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Stress test of the SPSC sample ring (pcm_ring.c). A producer and a
+ * consumer pthread move a numbered sample sequence through a small ring in
+ * randomly sized chunks and with random pauses, and the consumer checks
+ * that every sample arrives once and in order. With --lossy the producer
+ * drops what does not fit instead of retrying, as the Capture Task does,
+ * and the test checks that read plus dropped samples add up. --channels 2
+ * moves stereo frames, and every gap must then start and end on a frame.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "commands.h"
+#include "pcm_ring.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define STRESS_MAX_CHUNK                (1024)
+#define STRESS_DEFAULT_SAMPLES          (20000000u)
+#define STRESS_DEFAULT_RING_SIZE        (1024u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    pcm_ring_t ring;
+    uint32_t samples;               /* Samples the producer generates */
+    uint32_t channels;              /* Samples per frame */
+    int lossy;
+    volatile int producer_done;
+    uint32_t produced;              /* Samples offered to the ring */
+    uint32_t consumed;
+    uint32_t errors;                /* Out of order samples */
+    uint32_t gaps;                  /* Sequence jumps caused by drops (lossy) */
+    uint32_t split;                 /* Gaps that split a frame */
+} stress_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void *producer_thread(void *arg);
+static void *consumer_thread(void *arg);
+static uint32_t next_random(uint32_t *state);
+static void random_pause(uint32_t *state);
+
+
+/*******************************************************************************
+* Function Name: ring_stress_main
+********************************************************************************
+* Summary:
+*    smartlistener_host ring-stress [--samples N] [--size N] [--channels N]
+*        [--lossy]
+*
+*******************************************************************************/
+int ring_stress_main(int argc, char *argv[])
+{
+    static stress_t stress;
+    int16_t *buffer;
+    uint32_t size = STRESS_DEFAULT_RING_SIZE;
+    pthread_t producer;
+    pthread_t consumer;
+    uint64_t start;
+    double seconds;
+    int ok;
+
+    memset(&stress, 0, sizeof(stress));
+    stress.samples = STRESS_DEFAULT_SAMPLES;
+    stress.channels = 1;
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--samples") == 0) && (i + 1 < argc))
+        {
+            stress.samples = strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "--size") == 0) && (i + 1 < argc))
+        {
+            size = strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "--channels") == 0) && (i + 1 < argc))
+        {
+            stress.channels = strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--lossy") == 0)
+        {
+            stress.lossy = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host ring-stress [--samples N] [--size N] [--channels N] [--lossy]\n");
+            return 1;
+        }
+    }
+    /* The 16-bit sequence wraps on a frame */
+    if ((stress.channels != 1) && (stress.channels != 2))
+    {
+        fprintf(stderr, "Channels must be 1 or 2\n");
+        return 1;
+    }
+    stress.samples -= stress.samples % stress.channels;
+
+    buffer = malloc(size * sizeof(int16_t));
+    if ((buffer == NULL) || (pcm_ring_init(&stress.ring, buffer, size, stress.channels) != 0))
+    {
+        fprintf(stderr, "Ring size must be a power of two and hold whole frames\n");
+        free(buffer);
+        return 1;
+    }
+
+    start = host_now_ns();
+    pthread_create(&consumer, NULL, consumer_thread, &stress);
+    pthread_create(&producer, NULL, producer_thread, &stress);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    seconds = (host_now_ns() - start) / 1e9;
+
+    ok = (stress.errors == 0) && (stress.split == 0) &&
+         (stress.consumed + pcm_ring_dropped(&stress.ring) == stress.produced) &&
+         (pcm_ring_high_water(&stress.ring) <= size) &&
+         (stress.lossy || (stress.consumed == stress.samples));
+
+    printf("Ring size:                 %lu samples, %lu per frame\n", (unsigned long)size,
+        (unsigned long)stress.channels);
+    printf("Produced:                  %lu\n", (unsigned long)stress.produced);
+    printf("Consumed:                  %lu\n", (unsigned long)stress.consumed);
+    printf("Dropped:                   %lu (%lu gaps, %lu splitting a frame)\n",
+        (unsigned long)pcm_ring_dropped(&stress.ring), (unsigned long)stress.gaps, (unsigned long)stress.split);
+    printf("High-water mark:           %lu\n", (unsigned long)pcm_ring_high_water(&stress.ring));
+    printf("Order errors:              %lu\n", (unsigned long)stress.errors);
+    printf("Throughput:                %.1f Msamples/s\n", stress.consumed / seconds / 1e6);
+    printf("Result:                    %s\n", ok ? "PASS" : "FAIL");
+
+    free(buffer);
+    return ok ? 0 : 1;
+}
+
+
+/* Writes the sequence 0, 1, 2, ... (as int16) in random chunks of whole frames */
+static void *producer_thread(void *arg)
+{
+    stress_t *stress = arg;
+    int16_t chunk[STRESS_MAX_CHUNK];
+    uint32_t random_state = 0x12345678u;
+    uint32_t sequence = 0;
+
+    while (sequence < stress->samples)
+    {
+        uint32_t count = stress->channels * (1 + next_random(&random_state) % (STRESS_MAX_CHUNK / stress->channels));
+        uint32_t done = 0;
+
+        if (count > stress->samples - sequence)
+        {
+            count = stress->samples - sequence;
+        }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            chunk[i] = (int16_t)(sequence + i);
+        }
+
+        done = pcm_ring_write(&stress->ring, chunk, count);
+        if (stress->lossy)
+        {
+            pcm_ring_drop(&stress->ring, count - done);
+        }
+        else
+        {
+            while (done < count)
+            {
+                sched_yield();
+                done += pcm_ring_write(&stress->ring, chunk + done, count - done);
+            }
+        }
+        sequence += count;
+        stress->produced += count;
+        random_pause(&random_state);
+    }
+
+    __atomic_store_n(&stress->producer_done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+
+/* Reads in random chunks and checks the sequence */
+static void *consumer_thread(void *arg)
+{
+    stress_t *stress = arg;
+    int16_t chunk[STRESS_MAX_CHUNK];
+    uint32_t random_state = 0x9E3779B9u;
+    uint16_t expected = 0;
+
+    while (1)
+    {
+        int done = __atomic_load_n(&stress->producer_done, __ATOMIC_ACQUIRE);
+        uint32_t count = pcm_ring_read(&stress->ring, chunk, 1 + next_random(&random_state) % STRESS_MAX_CHUNK);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if ((uint16_t) chunk[i] != expected)
+            {
+                if (stress->lossy)
+                {
+                    stress->gaps++;
+                    stress->split += ((expected % stress->channels) != 0) ||
+                                     (((uint16_t) chunk[i] % stress->channels) != 0);
+                }
+                else
+                {
+                    stress->errors++;
+                }
+            }
+            expected = (uint16_t) chunk[i] + 1;
+        }
+        stress->consumed += count;
+
+        if (count == 0)
+        {
+            /* The producer finished before this empty read, nothing is left */
+            if (done)
+            {
+                break;
+            }
+            sched_yield();
+        }
+        random_pause(&random_state);
+    }
+    return NULL;
+}
+
+
+/* xorshift32 */
+static uint32_t next_random(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+/* Occasionally gives up the CPU for a while to let the ring fill or drain */
+static void random_pause(uint32_t *state)
+{
+    uint32_t r = next_random(state) % 1024;
+
+    if (r == 0)
+    {
+        struct timespec pause = { 0, 200000 };
+        nanosleep(&pause, NULL);
+    }
+    else if (r < 64)
+    {
+        sched_yield();
+    }
+}
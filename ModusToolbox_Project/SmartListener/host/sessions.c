@@ -0,0 +1,527 @@
+/*
+ * sessions.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Access to the recorded sessions (Data_preparation/<session>) and to the
+ * model predictions DEEPCRAFT Studio exported for them
+ * (Output/<model>/Predictions/sessions/<session>/<model>.data), the walk
+ * over all of them, the playback of a recording through model.c and the
+ * preprocessor tracks (SmartListener_Model/PreprocessorTrack/<session>).
+ */
+
+#include "sessions.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio_capture.h"
+#include "audio_ingest.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define LINE_MAX_LEN                    (512)
+
+/* Track rows carry time, duration and SESSION_TRACK_BANDS values */
+#define TRACK_LINE_MAX_LEN              (1024)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const char *class_names[SESSION_NUM_CLASSES] =
+{
+    "unlabelled", "baby_crying", "fire", "dog", "footsteps", "glass_breaking", "unknown"
+};
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int compare_names(const void *a, const void *b);
+static int find_prediction_file(const char *dir, char *path, size_t size);
+static int load_predictions(const char *path, session_t *session);
+static int load_label(const char *path);
+
+
+/*******************************************************************************
+* Function Name: session_list
+********************************************************************************
+* Summary:
+*    Lists the sessions that have a prediction directory, sorted by name.
+*
+* Parameters:
+*    pred_dir       Predictions/sessions directory
+*    list           Filled with the session names
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int session_list(const char *pred_dir, session_list_t *list)
+{
+    DIR *dir = opendir(pred_dir);
+    struct dirent *entry;
+    size_t capacity = 0;
+
+    memset(list, 0, sizeof(*list));
+    if (dir == NULL)
+    {
+        fprintf(stderr, "%s: cannot open directory\n", pred_dir);
+        return -1;
+    }
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if ((entry->d_name[0] == '.') || (strlen(entry->d_name) >= SESSION_NAME_MAX))
+        {
+            continue;
+        }
+        if (list->count == capacity)
+        {
+            void *names;
+            capacity = capacity ? capacity * 2 : 64;
+            names = realloc(list->names, capacity * SESSION_NAME_MAX);
+            if (names == NULL)
+            {
+                closedir(dir);
+                session_list_free(list);
+                return -1;
+            }
+            list->names = names;
+        }
+        strcpy(list->names[list->count++], entry->d_name);
+    }
+    closedir(dir);
+
+    qsort(list->names, list->count, SESSION_NAME_MAX, compare_names);
+    return 0;
+}
+
+
+void session_list_free(session_list_t *list)
+{
+    free(list->names);
+    memset(list, 0, sizeof(*list));
+}
+
+
+/*******************************************************************************
+* Function Name: session_load
+********************************************************************************
+* Summary:
+*    Locates the recording of a session and loads its label and reference
+*    predictions. The recording itself is loaded with wav_load().
+*
+* Parameters:
+*    data_dir       Data_preparation directory
+*    pred_dir       Predictions/sessions directory
+*    name           Session name
+*    session        Filled on success, release with session_free()
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int session_load(const char *data_dir, const char *pred_dir, const char *name, session_t *session)
+{
+    char path[SESSION_PATH_MAX];
+
+    memset(session, 0, sizeof(*session));
+    snprintf(session->name, sizeof(session->name), "%s", name);
+    snprintf(session->wav_path, sizeof(session->wav_path), "%s/%s/Wave-File-Data.wav", data_dir, name);
+
+    snprintf(path, sizeof(path), "%s/%s/Live-Labeling.label", data_dir, name);
+    session->label = load_label(path);
+
+    snprintf(path, sizeof(path), "%s/%s", pred_dir, name);
+    if ((find_prediction_file(path, path, sizeof(path)) != 0) ||
+        (load_predictions(path, session) != 0))
+    {
+        fprintf(stderr, "%s: no prediction file\n", name);
+        return -1;
+    }
+    return 0;
+}
+
+
+void session_free(session_t *session)
+{
+    free(session->predictions);
+    memset(session, 0, sizeof(*session));
+}
+
+
+/* Index of the highest score */
+int session_argmax(const float *scores)
+{
+    int best = 0;
+
+    for (int i = 1; i < SESSION_NUM_CLASSES; i++)
+    {
+        if (scores[i] > scores[best])
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+
+const char *session_class_name(int index)
+{
+    return ((index >= 0) && (index < SESSION_NUM_CLASSES)) ? class_names[index] : "?";
+}
+
+
+/* Classes ml_task.c publishes, everything but "unlabelled" and "unknown" */
+int session_is_event(int label)
+{
+    return (label != 0) && (label != SESSION_NUM_CLASSES - 1);
+}
+
+
+/*******************************************************************************
+* Function Name: session_walk
+********************************************************************************
+* Summary:
+*    Loads every session of the prediction directory in name order, with its
+*    recording if asked, and hands it to visit. Sessions that do not load
+*    are skipped.
+*
+* Parameters:
+*    data_dir       Data_preparation directory
+*    pred_dir       Predictions/sessions directory
+*    load_wav       Non-zero to load the recording too
+*    visit          Called for every session
+*    context        Passed to visit
+*
+* Return:
+*    Number of sessions listed, -1 on error
+*
+*******************************************************************************/
+int session_walk(const char *data_dir, const char *pred_dir, int load_wav, session_visit_t visit, void *context)
+{
+    session_list_t list;
+    int count;
+
+    if (session_list(pred_dir, &list) != 0)
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < list.count; i++)
+    {
+        session_t session;
+        wav_t wav;
+
+        if (session_load(data_dir, pred_dir, list.names[i], &session) != 0)
+        {
+            continue;
+        }
+        if (!load_wav)
+        {
+            visit(&session, NULL, i, context);
+        }
+        else if (wav_load(session.wav_path, &wav) == 0)
+        {
+            visit(&session, &wav, i, context);
+            wav_free(&wav);
+        }
+        session_free(&session);
+    }
+    count = (int)list.count;
+    session_list_free(&list);
+    return count;
+}
+
+
+/*******************************************************************************
+* Function Name: session_play
+********************************************************************************
+* Summary:
+*    Restarts the model with IMAI_init() and feeds channel 0 of a recording
+*    through audio_ingest_block() and IMAI_enqueue_block() in capture sized
+*    blocks, like ml_task.c. A block is shorter than the 6 frame stride of
+*    the model, so it completes at most one window.
+*
+* Parameters:
+*    wav            Recording
+*    gain           Gain of audio_ingest_block()
+*    window         Called with the scores of every window, or NULL
+*    context        Passed to window
+*    windows        Set to the number of windows
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int session_play(const wav_t *wav, float gain, session_window_t window, void *context, size_t *windows)
+{
+    float block[AUDIO_CAPTURE_BLOCK_SIZE];
+    int16_t pcm[AUDIO_CAPTURE_BLOCK_SIZE];
+    float scores[IMAI_DATA_OUT_COUNT];
+
+    *windows = 0;
+    if (IMAI_init() != IMAI_RET_SUCCESS)
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < wav->frames; i += AUDIO_CAPTURE_BLOCK_SIZE)
+    {
+        int n = (wav->frames - i < AUDIO_CAPTURE_BLOCK_SIZE) ? (int)(wav->frames - i) : AUDIO_CAPTURE_BLOCK_SIZE;
+        int ready;
+
+        for (int k = 0; k < n; k++)
+        {
+            pcm[k] = wav->samples[(i + k) * wav->channels];
+        }
+        audio_ingest_block(pcm, block, n, gain);
+
+        ready = IMAI_enqueue_block(block, n);
+        if (ready < 0)
+        {
+            return -1;
+        }
+        while (ready-- > 0)
+        {
+            IMAI_dequeue(scores);
+            if (window != NULL)
+            {
+                window(*windows, scores, context);
+            }
+            (*windows)++;
+        }
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: session_load_track
+********************************************************************************
+* Summary:
+*    Loads the log-mel frames DEEPCRAFT Studio computed for a session, the
+*    model input before windowing.
+*
+* Parameters:
+*    track_dir      PreprocessorTrack directory
+*    name           Session name
+*    frames         Set to the number of frames
+*
+* Return:
+*    float[frames][SESSION_TRACK_BANDS] to free(), NULL on error
+*
+*******************************************************************************/
+float *session_load_track(const char *track_dir, const char *name, size_t *frames)
+{
+    char path[SESSION_PATH_MAX + SESSION_NAME_MAX];
+    char line[TRACK_LINE_MAX_LEN];
+    float *values = NULL;
+    size_t capacity = 0;
+    FILE *file;
+
+    *frames = 0;
+    snprintf(path, sizeof(path), "%s/%s/Wave-File-Data_Preprocessor.data", track_dir, name);
+    file = fopen(path, "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "%s: no preprocessor track\n", name);
+        return NULL;
+    }
+
+    /* Header line, then "time, duration, f0, ..., f29" per frame */
+    fgets(line, sizeof(line), file);
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char *next = line;
+        int fields = 0;
+
+        if (*frames == capacity)
+        {
+            float *grown;
+
+            capacity = (capacity == 0) ? 256 : 2 * capacity;
+            grown = realloc(values, capacity * SESSION_TRACK_BANDS * sizeof(float));
+            if (grown == NULL)
+            {
+                free(values);
+                fclose(file);
+                return NULL;
+            }
+            values = grown;
+        }
+        strtod(next, &next);
+        strtod(next + 1, &next);
+        while ((fields < SESSION_TRACK_BANDS) && (*next == ','))
+        {
+            values[*frames * SESSION_TRACK_BANDS + fields++] = strtof(next + 1, &next);
+        }
+        if (fields != SESSION_TRACK_BANDS)
+        {
+            break;
+        }
+        (*frames)++;
+    }
+    fclose(file);
+    return values;
+}
+
+
+/*******************************************************************************
+* Function Name: session_load_golden
+********************************************************************************
+* Summary:
+*    Loads the golden vectors of the model, the network test output, as the
+*    reference scores of SESSION_GOLDEN_NAME. The file has the format of a
+*    prediction file.
+*
+* Parameters:
+*    path           Network test output file
+*    session        Filled on success, release with session_free()
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int session_load_golden(const char *path, session_t *session)
+{
+    memset(session, 0, sizeof(*session));
+    snprintf(session->name, sizeof(session->name), "%s", SESSION_GOLDEN_NAME);
+    session->label = -1;
+    if ((load_predictions(path, session) != 0) || (session->windows == 0))
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        session_free(session);
+        return -1;
+    }
+    return 0;
+}
+
+
+static int compare_names(const void *a, const void *b)
+{
+    return strcmp((const char *) a, (const char *) b);
+}
+
+
+/* Finds the first *.data file in dir */
+static int find_prediction_file(const char *dir, char *path, size_t size)
+{
+    DIR *handle = opendir(dir);
+    struct dirent *entry;
+    char found[SESSION_PATH_MAX] = "";
+
+    if (handle == NULL)
+    {
+        return -1;
+    }
+    while ((entry = readdir(handle)) != NULL)
+    {
+        size_t len = strlen(entry->d_name);
+        if ((len > 5) && (strcmp(entry->d_name + len - 5, ".data") == 0) &&
+            (snprintf(found, sizeof(found), "%s/%s", dir, entry->d_name) < (int)sizeof(found)))
+        {
+            break;
+        }
+        found[0] = '\0';
+    }
+    closedir(handle);
+
+    if (found[0] == '\0')
+    {
+        return -1;
+    }
+    snprintf(path, size, "%s", found);
+    return 0;
+}
+
+
+/* Parses "Time,Duration,pred_0,...,pred_6" rows */
+static int load_predictions(const char *path, session_t *session)
+{
+    FILE *file = fopen(path, "r");
+    char line[LINE_MAX_LEN];
+    size_t capacity = 0;
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+
+    /* Skip the header */
+    if (fgets(line, sizeof(line), file) == NULL)
+    {
+        fclose(file);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        float time, duration;
+        float *row;
+
+        if (session->windows == capacity)
+        {
+            void *rows;
+            capacity = capacity ? capacity * 2 : 64;
+            rows = realloc(session->predictions, capacity * sizeof(session->predictions[0]));
+            if (rows == NULL)
+            {
+                fclose(file);
+                return -1;
+            }
+            session->predictions = rows;
+        }
+
+        row = session->predictions[session->windows];
+        if (sscanf(line, "%f,%f,%f,%f,%f,%f,%f,%f,%f", &time, &duration,
+            &row[0], &row[1], &row[2], &row[3], &row[4], &row[5], &row[6]) == 9)
+        {
+            session->windows++;
+        }
+    }
+    fclose(file);
+    return 0;
+}
+
+
+/* Returns the class of the first label in a Live-Labeling.label file */
+static int load_label(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[LINE_MAX_LEN];
+    int label = -1;
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+
+    /* Header, then "Time,Length,Label,Confidence,Comment" */
+    if ((fgets(line, sizeof(line), file) != NULL) && (fgets(line, sizeof(line), file) != NULL))
+    {
+        char *name = strchr(line, ',');
+        name = name ? strchr(name + 1, ',') : NULL;
+        if (name != NULL)
+        {
+            char *end = strchr(++name, ',');
+            if (end != NULL)
+            {
+                *end = '\0';
+            }
+            for (int i = 0; i < SESSION_NUM_CLASSES; i++)
+            {
+                if (strcmp(name, class_names[i]) == 0)
+                {
+                    label = i;
+                }
+            }
+        }
+    }
+    fclose(file);
+    return label;
+}
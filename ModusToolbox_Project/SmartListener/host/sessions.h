@@ -0,0 +1,81 @@
+/*
+ * sessions.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef HOST_SESSIONS_H_
+#define HOST_SESSIONS_H_
+
+#include <stddef.h>
+
+#include "wav.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Default locations, relative to the host directory */
+#define SESSION_DEFAULT_DATA_DIR        "../../../ML_Model/Data_preparation"
+#define SESSION_DEFAULT_PRED_DIR        "../../../ML_Model/Output/conv1dlstm-medium-balanced-3/Predictions/sessions"
+#define SESSION_DEFAULT_TRACK_DIR       "../../../ML_Model/SmartListener_Model/PreprocessorTrack"
+#define SESSION_DEFAULT_GOLDEN_FILE     "../../../ML_Model/Output/conv1dlstm-medium-balanced-3/" \
+                                        "conv1dlstm-medium-balanced-3_preprocessor_and_network_test_output.data"
+
+/* The golden vectors of the model are the scores of this session */
+#define SESSION_GOLDEN_NAME             "Session-2025-05-02--20-04-43"
+
+/* Score columns of the prediction files, same order as IMAI_DATA_OUT_SYMBOLS */
+#define SESSION_NUM_CLASSES             (7)
+
+/* Log-mel bands per frame of a preprocessor track */
+#define SESSION_TRACK_BANDS             (30)
+
+/* Same confidence threshold ml_task.c applies before debouncing a label */
+#define SESSION_EVENT_SCORE             (0.90f)
+
+#define SESSION_NAME_MAX                (128)
+#define SESSION_PATH_MAX                (512)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* One recording of ML_Model/Data_preparation and the reference model output */
+typedef struct {
+    char name[SESSION_NAME_MAX];
+    char wav_path[SESSION_PATH_MAX];
+    int label;                                      /* Class of the first label, -1 if unknown */
+    size_t windows;                                 /* Rows of the prediction file */
+    float (*predictions)[SESSION_NUM_CLASSES];      /* Reference scores per model window */
+} session_t;
+
+typedef struct {
+    size_t count;
+    char (*names)[SESSION_NAME_MAX];
+} session_list_t;
+
+/* Called by session_walk() for every session that loads, index is its
+ * position in the sorted list. wav is NULL unless the walk loads it. */
+typedef void (*session_visit_t)(const session_t *session, const wav_t *wav, size_t index, void *context);
+
+/* Called by session_play() with the scores of every model window */
+typedef void (*session_window_t)(size_t window, const float *scores, void *context);
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int session_list(const char *pred_dir, session_list_t *list);
+void session_list_free(session_list_t *list);
+int session_load(const char *data_dir, const char *pred_dir, const char *name, session_t *session);
+void session_free(session_t *session);
+int session_argmax(const float *scores);
+const char *session_class_name(int index);
+int session_is_event(int label);
+int session_walk(const char *data_dir, const char *pred_dir, int load_wav, session_visit_t visit, void *context);
+int session_play(const wav_t *wav, float gain, session_window_t window, void *context, size_t *windows);
+float *session_load_track(const char *track_dir, const char *name, size_t *frames);
+int session_load_golden(const char *path, session_t *session);
+
+
+#endif /* HOST_SESSIONS_H_ */
@@ -0,0 +1,797 @@
+/*
+ * arm_math.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Portable implementation of the CMSIS-DSP subset declared in arm_math.h.
+ *
+ * On x86 hosts with AVX2 the float FFT butterflies and split step,
+ * arm_cmplx_mag_f32(), arm_add_f32(), arm_mult_f32(), arm_scale_f32() and
+ * arm_clip_f32() run 8 lanes wide, arm_dot_prod_q7() 32. Every float lane does the same multiplies and
+ * adds in the same order as the scalar code, without FMA, so the results
+ * are bit-identical to it. arm_vlog_f32() stays on logf() and
+ * arm_dot_prod_f32() sums in order like the Cortex-M4 CMSIS kernel: a
+ * vector log or a reordered sum would change the log-mel features that the
+ * host checks compare bit for bit.
+ */
+
+#include "arm_math.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ARM_SHIM_AVX2                   (1)
+#else
+#define ARM_SHIM_AVX2                   (0)
+#endif
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Index from which the scalar loop finishes: the AVX2 kernel returns where
+ * it stopped, without AVX2 the loop starts at scalar_start */
+#if ARM_SHIM_AVX2
+#define SIMD_DONE(avx2_call, scalar_start)  (avx2_supported() ? (avx2_call) : (scalar_start))
+#else
+#define SIMD_DONE(avx2_call, scalar_start)  (scalar_start)
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* exp(-2*pi*i*k/ARM_SHIM_MAX_FFT_LEN) for k < ARM_SHIM_MAX_FFT_LEN/2, as (cos, sin) pairs */
+static float32_t twiddle[ARM_SHIM_MAX_FFT_LEN];
+static int twiddle_ready = 0;
+
+/* The twiddles of every radix-2 stage in a row, stage len from offset
+ * 2 * (len/2 - 1): k < len/2 of exp(-2*pi*i*k/len). The split step of an
+ * fftLen real FFT uses the fftLen stage. */
+static float32_t stage_twiddle[2 * ARM_SHIM_MAX_FFT_LEN];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void twiddle_init(void);
+static void cfft_f32(float32_t *buf, int n);
+static void cfft_q15(q15_t *buf, int n);
+static q15_t saturate_q15(int32_t x);
+
+#if ARM_SHIM_AVX2
+static int avx2_supported(void);
+static int butterflies_avx2(float32_t *buf, int n, int len);
+static int split_avx2(const float32_t *z, float32_t *pOut, int half);
+static uint32_t cmplx_mag_avx2(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+static uint32_t add_avx2(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+static uint32_t mult_avx2(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+static uint32_t scale_avx2(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize);
+static uint32_t clip_avx2(const float32_t *pSrc, float32_t *pDst, float32_t low, float32_t high, uint32_t numSamples);
+static uint32_t dot_prod_q7_avx2(const q7_t *pSrcA, const q7_t *pSrcB, uint32_t blockSize, q31_t *sum);
+#endif
+
+
+/*******************************************************************************
+* Function Name: arm_rfft_fast_init_f32
+********************************************************************************
+* Summary:
+*    Initializes a real FFT instance for a power of two length.
+*
+* Parameters:
+*    S              Instance to initialize
+*    fftLen         Number of real input samples
+*
+* Return:
+*    ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+*
+*******************************************************************************/
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+    if ((fftLen < 4) || (fftLen > ARM_SHIM_MAX_FFT_LEN) || (fftLen & (fftLen - 1)))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    S->fftLenRFFT = fftLen;
+    twiddle_init();
+    return ARM_MATH_SUCCESS;
+}
+
+
+arm_status arm_rfft_fast_init_512_f32(arm_rfft_fast_instance_f32 *S)
+{
+    return arm_rfft_fast_init_f32(S, 512);
+}
+
+
+/*******************************************************************************
+* Function Name: arm_rfft_fast_f32
+********************************************************************************
+* Summary:
+*    Forward real FFT in the CMSIS packed format: pOut[0] is the DC bin,
+*    pOut[1] the Nyquist bin and pOut[2k], pOut[2k+1] the real and imaginary
+*    parts of bin k. Computed as an N/2 point complex FFT followed by the
+*    usual split step. Only the forward transform is supported.
+*
+* Parameters:
+*    S              Initialized instance
+*    p              Real input, fftLen samples
+*    pOut           Packed output, fftLen values
+*    ifftFlag       Must be 0
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag)
+{
+    float32_t z[ARM_SHIM_MAX_FFT_LEN];
+    int n = S->fftLenRFFT;
+    int half = n / 2;
+    int step = ARM_SHIM_MAX_FFT_LEN / n;
+
+    (void) ifftFlag;
+
+    memcpy(z, p, n * sizeof(float32_t));
+    cfft_f32(z, half);
+
+    pOut[0] = z[0] + z[1];
+    pOut[1] = z[0] - z[1];
+    for (int k = SIMD_DONE(split_avx2(z, pOut, half), 1); k < half; k++)
+    {
+        float32_t ar = z[2 * k];
+        float32_t ai = z[2 * k + 1];
+        float32_t br = z[2 * (half - k)];
+        float32_t bi = -z[2 * (half - k) + 1];
+        float32_t er = 0.5f * (ar + br);
+        float32_t ei = 0.5f * (ai + bi);
+        float32_t or_ = 0.5f * (ai - bi);
+        float32_t oi = -0.5f * (ar - br);
+        float32_t wr = twiddle[2 * k * step];
+        float32_t wi = twiddle[2 * k * step + 1];
+
+        pOut[2 * k] = er + wr * or_ - wi * oi;
+        pOut[2 * k + 1] = ei + wr * oi + wi * or_;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: arm_cfft_init_f32
+********************************************************************************
+* Summary:
+*    Initializes a complex FFT instance for a power of two length.
+*
+* Parameters:
+*    S              Instance to initialize
+*    fftLen         Number of complex points
+*
+* Return:
+*    ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+*
+*******************************************************************************/
+arm_status arm_cfft_init_f32(arm_cfft_instance_f32 *S, uint16_t fftLen)
+{
+    if ((fftLen < 2) || (fftLen > ARM_SHIM_MAX_FFT_LEN) || (fftLen & (fftLen - 1)))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    S->fftLen = fftLen;
+    twiddle_init();
+    return ARM_MATH_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: arm_cfft_f32
+********************************************************************************
+* Summary:
+*    In-place forward complex FFT of interleaved (re, im) values, output in
+*    natural order. The inverse transform and bit reversed output are not
+*    supported.
+*
+* Parameters:
+*    S              Initialized instance
+*    p1             Interleaved complex data, 2*fftLen values
+*    ifftFlag       Must be 0
+*    bitReverseFlag Must be 1
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+    (void) ifftFlag;
+    (void) bitReverseFlag;
+
+    cfft_f32(p1, S->fftLen);
+}
+
+
+void arm_add_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = SIMD_DONE(add_avx2(pSrcA, pSrcB, pDst, blockSize), 0); i < blockSize; i++)
+    {
+        pDst[i] = pSrcA[i] + pSrcB[i];
+    }
+}
+
+
+void arm_mult_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = SIMD_DONE(mult_avx2(pSrcA, pSrcB, pDst, blockSize), 0); i < blockSize; i++)
+    {
+        pDst[i] = pSrcA[i] * pSrcB[i];
+    }
+}
+
+
+void arm_scale_f32(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = SIMD_DONE(scale_avx2(pSrc, scale, pDst, blockSize), 0); i < blockSize; i++)
+    {
+        pDst[i] = pSrc[i] * scale;
+    }
+}
+
+
+void arm_clip_f32(const float32_t *pSrc, float32_t *pDst, float32_t low, float32_t high, uint32_t numSamples)
+{
+    for (uint32_t i = SIMD_DONE(clip_avx2(pSrc, pDst, low, high, numSamples), 0); i < numSamples; i++)
+    {
+        float32_t x = pSrc[i];
+        pDst[i] = (x < low) ? low : ((x > high) ? high : x);
+    }
+}
+
+
+void arm_vlog_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = logf(pSrc[i]);
+    }
+}
+
+
+void arm_dot_prod_f32(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result)
+{
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        sum += pSrcA[i] * pSrcB[i];
+    }
+    *result = sum;
+}
+
+
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+    for (uint32_t i = SIMD_DONE(cmplx_mag_avx2(pSrc, pDst, numSamples), 0); i < numSamples; i++)
+    {
+        float32_t re = pSrc[2 * i];
+        float32_t im = pSrc[2 * i + 1];
+        pDst[i] = sqrtf(re * re + im * im);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: arm_rfft_init_q15
+********************************************************************************
+* Summary:
+*    Initializes a fixed-point real FFT instance. Only the forward transform
+*    with bit reversal is supported.
+*
+* Parameters:
+*    S              Instance to initialize
+*    fftLenReal     Number of real input samples
+*    ifftFlagR      Must be 0
+*    bitReverseFlag Must be 1
+*
+* Return:
+*    ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+*
+*******************************************************************************/
+arm_status arm_rfft_init_q15(arm_rfft_instance_q15 *S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag)
+{
+    if ((fftLenReal < 4) || (fftLenReal > ARM_SHIM_MAX_FFT_LEN) || (fftLenReal & (fftLenReal - 1)) ||
+        (ifftFlagR != 0) || (bitReverseFlag != 1))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    S->fftLenReal = fftLenReal;
+    twiddle_init();
+    return ARM_MATH_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: arm_rfft_q15
+********************************************************************************
+* Summary:
+*    Forward fixed-point real FFT in the CMSIS output format: bin k is
+*    pDst[2k], pDst[2k+1] for k = 0..fftLenReal/2, scaled down by
+*    fftLenReal/2 (9.7 format for 512 points). Like the device it is an N/2
+*    point complex FFT that halves the data in every radix-2 stage followed
+*    by a split step, all in integer arithmetic, so the rounding noise is of
+*    the same order. The shim does not write the mirrored upper half.
+*
+* Parameters:
+*    S              Initialized instance
+*    pSrc           Real input, fftLenReal samples, used as scratch
+*    pDst           Output, fftLenReal + 2 values
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void arm_rfft_q15(const arm_rfft_instance_q15 *S, q15_t *pSrc, q15_t *pDst)
+{
+    int n = S->fftLenReal;
+    int half = n / 2;
+    int step = ARM_SHIM_MAX_FFT_LEN / n;
+
+    cfft_q15(pSrc, half);
+
+    pDst[0] = saturate_q15(pSrc[0] + pSrc[1]);
+    pDst[1] = 0;
+    pDst[n] = saturate_q15(pSrc[0] - pSrc[1]);
+    pDst[n + 1] = 0;
+    for (int k = 1; k < half; k++)
+    {
+        int32_t ar = pSrc[2 * k];
+        int32_t ai = pSrc[2 * k + 1];
+        int32_t br = pSrc[2 * (half - k)];
+        int32_t bi = -pSrc[2 * (half - k) + 1];
+        /* X[k] = ((A + B) + W^k * -j(A - B)) / 2 with A = Z[k], B = conj(Z[N/2-k]) */
+        int32_t wr = (int32_t) lrint(twiddle[2 * k * step] * 32767.0);
+        int32_t wi = (int32_t) lrint(twiddle[2 * k * step + 1] * 32767.0);
+        int64_t er = ar + br;
+        int64_t ei = ai + bi;
+        int64_t or_ = ai - bi;
+        int64_t oi = br - ar;
+
+        pDst[2 * k] = saturate_q15((int32_t)((er * 32768 + wr * or_ - wi * oi) >> 16));
+        pDst[2 * k + 1] = saturate_q15((int32_t)((ei * 32768 + wr * oi + wi * or_) >> 16));
+    }
+}
+
+
+/* Input 1.15, output 2.14 like the device */
+void arm_cmplx_mag_q15(const q15_t *pSrc, q15_t *pDst, uint32_t numSamples)
+{
+    for (uint32_t i = 0; i < numSamples; i++)
+    {
+        int32_t re = pSrc[2 * i];
+        int32_t im = pSrc[2 * i + 1];
+        pDst[i] = saturate_q15((int32_t) sqrt((double)(re * re + im * im)) >> 1);
+    }
+}
+
+
+void arm_mult_q15(const q15_t *pSrcA, const q15_t *pSrcB, q15_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = saturate_q15(((int32_t) pSrcA[i] * pSrcB[i]) >> 15);
+    }
+}
+
+
+void arm_shift_q15(const q15_t *pSrc, int8_t shiftBits, q15_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        int32_t x = pSrc[i];
+        pDst[i] = saturate_q15((shiftBits >= 0) ? (x * (1 << shiftBits)) : (x >> -shiftBits));
+    }
+}
+
+
+void arm_scale_q15(const q15_t *pSrc, q15_t scaleFract, int8_t shift, q15_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = saturate_q15(((int32_t) pSrc[i] * scaleFract) >> (15 - shift));
+    }
+}
+
+
+/* Integer sum, the order does not matter. No saturation. */
+void arm_dot_prod_q7(const q7_t *pSrcA, const q7_t *pSrcB, uint32_t blockSize, q31_t *result)
+{
+    q31_t sum = 0;
+
+    for (uint32_t i = SIMD_DONE(dot_prod_q7_avx2(pSrcA, pSrcB, blockSize, &sum), 0); i < blockSize; i++)
+    {
+        sum += (q31_t) pSrcA[i] * pSrcB[i];
+    }
+    *result = sum;
+}
+
+
+/* 34.30 result, no saturation */
+void arm_dot_prod_q15(const q15_t *pSrcA, const q15_t *pSrcB, uint32_t blockSize, q63_t *result)
+{
+    q63_t sum = 0;
+
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        sum += (q31_t) pSrcA[i] * pSrcB[i];
+    }
+    *result = sum;
+}
+
+
+void arm_absmax_q15(const q15_t *pSrc, uint32_t blockSize, q15_t *pResult, uint32_t *pIndex)
+{
+    int32_t peak = -1;
+
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        int32_t x = (pSrc[i] < 0) ? -pSrc[i] : pSrc[i];
+        if (x > peak)
+        {
+            peak = x;
+            *pIndex = i;
+        }
+    }
+    *pResult = saturate_q15(peak);
+}
+
+
+/* Truncates towards zero like CMSIS without ARM_MATH_ROUNDING */
+void arm_float_to_q15(const float32_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        float32_t x = pSrc[i] * 32768.0f;
+        pDst[i] = (x >= 32767.0f) ? 32767 : ((x <= -32768.0f) ? -32768 : (q15_t) x);
+    }
+}
+
+
+/* exp(-2*pi*i*k/ARM_SHIM_MAX_FFT_LEN), computed once */
+static void twiddle_init(void)
+{
+    if (!twiddle_ready)
+    {
+        for (int k = 0; k < ARM_SHIM_MAX_FFT_LEN / 2; k++)
+        {
+            double angle = -2.0 * M_PI * k / ARM_SHIM_MAX_FFT_LEN;
+            twiddle[2 * k] = (float32_t) cos(angle);
+            twiddle[2 * k + 1] = (float32_t) sin(angle);
+        }
+        for (int len = 2; len <= ARM_SHIM_MAX_FFT_LEN; len <<= 1)
+        {
+            for (int k = 0; k < len / 2; k++)
+            {
+                stage_twiddle[2 * (len / 2 - 1 + k)] = twiddle[2 * k * (ARM_SHIM_MAX_FFT_LEN / len)];
+                stage_twiddle[2 * (len / 2 - 1 + k) + 1] = twiddle[2 * k * (ARM_SHIM_MAX_FFT_LEN / len) + 1];
+            }
+        }
+        twiddle_ready = 1;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cfft_f32
+********************************************************************************
+* Summary:
+*    In-place iterative radix-2 forward complex FFT of n interleaved
+*    (re, im) values.
+*
+* Parameters:
+*    buf            Interleaved complex data, 2*n values
+*    n              Number of complex points, power of two
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+static void cfft_f32(float32_t *buf, int n)
+{
+    for (int i = 1, j = 0; i < n; i++)
+    {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            float32_t tr = buf[2 * i];
+            float32_t ti = buf[2 * i + 1];
+            buf[2 * i] = buf[2 * j];
+            buf[2 * i + 1] = buf[2 * j + 1];
+            buf[2 * j] = tr;
+            buf[2 * j + 1] = ti;
+        }
+    }
+
+    for (int len = 2; len <= n; len <<= 1)
+    {
+        int step = ARM_SHIM_MAX_FFT_LEN / len;
+        if (SIMD_DONE(butterflies_avx2(buf, n, len), 0))
+        {
+            continue;
+        }
+        for (int i = 0; i < n; i += len)
+        {
+            for (int k = 0; k < len / 2; k++)
+            {
+                float32_t wr = twiddle[2 * k * step];
+                float32_t wi = twiddle[2 * k * step + 1];
+                float32_t *a = &buf[2 * (i + k)];
+                float32_t *b = &buf[2 * (i + k + len / 2)];
+                float32_t xr = b[0] * wr - b[1] * wi;
+                float32_t xi = b[0] * wi + b[1] * wr;
+                b[0] = a[0] - xr;
+                b[1] = a[1] - xi;
+                a[0] += xr;
+                a[1] += xi;
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cfft_q15
+********************************************************************************
+* Summary:
+*    In-place radix-2 forward complex FFT of n interleaved q15 (re, im)
+*    values. Every stage halves the data, so the output is the transform
+*    divided by n and cannot overflow.
+*
+* Parameters:
+*    buf            Interleaved complex data, 2*n values
+*    n              Number of complex points, power of two
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+static void cfft_q15(q15_t *buf, int n)
+{
+    for (int i = 1, j = 0; i < n; i++)
+    {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            q15_t tr = buf[2 * i];
+            q15_t ti = buf[2 * i + 1];
+            buf[2 * i] = buf[2 * j];
+            buf[2 * i + 1] = buf[2 * j + 1];
+            buf[2 * j] = tr;
+            buf[2 * j + 1] = ti;
+        }
+    }
+
+    for (int len = 2; len <= n; len <<= 1)
+    {
+        int step = ARM_SHIM_MAX_FFT_LEN / len;
+        for (int i = 0; i < n; i += len)
+        {
+            for (int k = 0; k < len / 2; k++)
+            {
+                int32_t wr = (int32_t) lrint(twiddle[2 * k * step] * 32767.0);
+                int32_t wi = (int32_t) lrint(twiddle[2 * k * step + 1] * 32767.0);
+                q15_t *a = &buf[2 * (i + k)];
+                q15_t *b = &buf[2 * (i + k + len / 2)];
+                /* b * w in Q15, then everything halved */
+                int32_t xr = (b[0] * wr - b[1] * wi) >> 15;
+                int32_t xi = (b[0] * wi + b[1] * wr) >> 15;
+                int32_t ar = a[0];
+                int32_t ai = a[1];
+
+                a[0] = (q15_t)((ar + xr) >> 1);
+                a[1] = (q15_t)((ai + xi) >> 1);
+                b[0] = (q15_t)((ar - xr) >> 1);
+                b[1] = (q15_t)((ai - xi) >> 1);
+            }
+        }
+    }
+}
+
+
+static q15_t saturate_q15(int32_t x)
+{
+    return (q15_t)((x > 32767) ? 32767 : ((x < -32768) ? -32768 : x));
+}
+
+
+#if ARM_SHIM_AVX2
+static int avx2_supported(void)
+{
+    static int supported = -1;
+
+    if (supported < 0)
+    {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("avx2");
+    }
+    return supported;
+}
+
+
+/* One radix-2 stage of cfft_f32(), 4 butterflies per register. Returns 0
+ * for the first two stages, which have fewer than 4 butterflies per group. */
+__attribute__((target("avx2")))
+static int butterflies_avx2(float32_t *buf, int n, int len)
+{
+    const float32_t *w = &stage_twiddle[2 * (len / 2 - 1)];
+
+    if (len < 8)
+    {
+        return 0;
+    }
+    for (int i = 0; i < n; i += len)
+    {
+        for (int k = 0; k < len / 2; k += 4)
+        {
+            float32_t *a = &buf[2 * (i + k)];
+            float32_t *b = &buf[2 * (i + k + len / 2)];
+            const __m256 vw = _mm256_loadu_ps(&w[2 * k]);
+            const __m256 va = _mm256_loadu_ps(a);
+            const __m256 vb = _mm256_loadu_ps(b);
+            /* (br * wr - bi * wi, bi * wr + br * wi) */
+            const __m256 x = _mm256_addsub_ps(_mm256_mul_ps(vb, _mm256_moveldup_ps(vw)),
+                                              _mm256_mul_ps(_mm256_permute_ps(vb, 0xB1), _mm256_movehdup_ps(vw)));
+
+            _mm256_storeu_ps(b, _mm256_sub_ps(va, x));
+            _mm256_storeu_ps(a, _mm256_add_ps(va, x));
+        }
+    }
+    return 1;
+}
+
+
+/* Split step of arm_rfft_fast_f32() for 4 bins at a time from k = 1,
+ * returns the first bin left to the scalar loop */
+__attribute__((target("avx2")))
+static int split_avx2(const float32_t *z, float32_t *pOut, int half)
+{
+    const float32_t *w = &stage_twiddle[2 * (half - 1)];
+    const __m256 conj = _mm256_setr_ps(1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f);
+    const __m256 odd = _mm256_setr_ps(0.5f, -0.5f, 0.5f, -0.5f, 0.5f, -0.5f, 0.5f, -0.5f);
+    const __m256 one_half = _mm256_set1_ps(0.5f);
+    int k;
+
+    for (k = 1; k + 3 < half; k += 4)
+    {
+        const __m256 va = _mm256_loadu_ps(&z[2 * k]);
+        /* conj(Z[half-k]) for k..k+3, the complex values reversed */
+        const __m256 vb = _mm256_mul_ps(_mm256_castpd_ps(_mm256_permute4x64_pd(
+                              _mm256_castps_pd(_mm256_loadu_ps(&z[2 * (half - k - 3)])), 0x1B)), conj);
+        const __m256 vw = _mm256_loadu_ps(&w[2 * k]);
+        const __m256 e = _mm256_mul_ps(one_half, _mm256_add_ps(va, vb));
+        /* (0.5 * (ai - bi), -0.5 * (ar - br)) */
+        const __m256 o = _mm256_mul_ps(odd, _mm256_permute_ps(_mm256_sub_ps(va, vb), 0xB1));
+        const __m256 t = _mm256_add_ps(e, _mm256_mul_ps(_mm256_moveldup_ps(vw), o));
+
+        _mm256_storeu_ps(&pOut[2 * k], _mm256_addsub_ps(t, _mm256_mul_ps(_mm256_movehdup_ps(vw),
+                                                                         _mm256_permute_ps(o, 0xB1))));
+    }
+    return k;
+}
+
+
+__attribute__((target("avx2")))
+static uint32_t cmplx_mag_avx2(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+    uint32_t i;
+
+    for (i = 0; i + 8 <= numSamples; i += 8)
+    {
+        const __m256 lo = _mm256_loadu_ps(&pSrc[2 * i]);
+        const __m256 hi = _mm256_loadu_ps(&pSrc[2 * i + 8]);
+        /* re * re + im * im per complex value, back in order */
+        const __m256 sum = _mm256_hadd_ps(_mm256_mul_ps(lo, lo), _mm256_mul_ps(hi, hi));
+
+        _mm256_storeu_ps(&pDst[i], _mm256_sqrt_ps(_mm256_castpd_ps(
+                                       _mm256_permute4x64_pd(_mm256_castps_pd(sum), 0xD8))));
+    }
+    return i;
+}
+
+
+__attribute__((target("avx2")))
+static uint32_t add_avx2(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+    uint32_t i;
+
+    for (i = 0; i + 8 <= blockSize; i += 8)
+    {
+        _mm256_storeu_ps(&pDst[i], _mm256_add_ps(_mm256_loadu_ps(&pSrcA[i]), _mm256_loadu_ps(&pSrcB[i])));
+    }
+    return i;
+}
+
+
+__attribute__((target("avx2")))
+static uint32_t mult_avx2(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+    uint32_t i;
+
+    for (i = 0; i + 8 <= blockSize; i += 8)
+    {
+        _mm256_storeu_ps(&pDst[i], _mm256_mul_ps(_mm256_loadu_ps(&pSrcA[i]), _mm256_loadu_ps(&pSrcB[i])));
+    }
+    return i;
+}
+
+
+__attribute__((target("avx2")))
+static uint32_t scale_avx2(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize)
+{
+    const __m256 factor = _mm256_set1_ps(scale);
+    uint32_t i;
+
+    for (i = 0; i + 8 <= blockSize; i += 8)
+    {
+        _mm256_storeu_ps(&pDst[i], _mm256_mul_ps(_mm256_loadu_ps(&pSrc[i]), factor));
+    }
+    return i;
+}
+
+
+/* Blends instead of min/max so a NaN passes through like in the scalar loop */
+__attribute__((target("avx2")))
+static uint32_t clip_avx2(const float32_t *pSrc, float32_t *pDst, float32_t low, float32_t high, uint32_t numSamples)
+{
+    const __m256 vlow = _mm256_set1_ps(low);
+    const __m256 vhigh = _mm256_set1_ps(high);
+    uint32_t i;
+
+    for (i = 0; i + 8 <= numSamples; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(&pSrc[i]);
+        const __m256 y = _mm256_blendv_ps(x, vhigh, _mm256_cmp_ps(x, vhigh, _CMP_GT_OQ));
+
+        _mm256_storeu_ps(&pDst[i], _mm256_blendv_ps(y, vlow, _mm256_cmp_ps(x, vlow, _CMP_LT_OQ)));
+    }
+    return i;
+}
+
+
+/* 16 products per madd, sign extended to 16 bits first */
+__attribute__((target("avx2")))
+static uint32_t dot_prod_q7_avx2(const q7_t *pSrcA, const q7_t *pSrcB, uint32_t blockSize, q31_t *sum)
+{
+    __m256i acc = _mm256_setzero_si256();
+    __m128i half;
+    uint32_t i;
+
+    for (i = 0; i + 32 <= blockSize; i += 32)
+    {
+        const __m256i a = _mm256_loadu_si256((const __m256i *)&pSrcA[i]);
+        const __m256i b = _mm256_loadu_si256((const __m256i *)&pSrcB[i]);
+
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm256_castsi256_si128(a)),
+                                                      _mm256_cvtepi8_epi16(_mm256_castsi256_si128(b))));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm256_extracti128_si256(a, 1)),
+                                                      _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b, 1))));
+    }
+    half = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+    *sum += _mm_cvtsi128_si32(half);
+    return i;
+}
+#endif
@@ -0,0 +1,96 @@
+/*
+ * arm_math.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Host stand-in for the subset of CMSIS-DSP used by the firmware. The
+ * functions follow the CMSIS signatures and output formats, but are plain
+ * portable C, so results match the device up to float rounding.
+ */
+
+#ifndef HOST_SHIMS_ARM_MATH_H_
+#define HOST_SHIMS_ARM_MATH_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+typedef float float32_t;
+typedef int8_t q7_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+
+typedef enum
+{
+    ARM_MATH_SUCCESS        =  0,
+    ARM_MATH_ARGUMENT_ERROR = -1,
+} arm_status;
+
+/* Largest transform supported by the shim */
+#define ARM_SHIM_MAX_FFT_LEN        (4096)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Real FFT instance. Only the length is used by the shim, the size is kept
+ * below the 48 bytes the generated model code reserves for it. */
+typedef struct
+{
+    uint16_t fftLenRFFT;
+} arm_rfft_fast_instance_f32;
+
+/* Complex FFT instance, only the length is used by the shim */
+typedef struct
+{
+    uint16_t fftLen;
+} arm_cfft_instance_f32;
+
+/* Fixed-point real FFT instance, only the length is used by the shim */
+typedef struct
+{
+    uint32_t fftLenReal;
+} arm_rfft_instance_q15;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen);
+arm_status arm_rfft_fast_init_512_f32(arm_rfft_fast_instance_f32 *S);
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+arm_status arm_cfft_init_f32(arm_cfft_instance_f32 *S, uint16_t fftLen);
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+
+void arm_add_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+void arm_mult_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+void arm_scale_f32(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize);
+void arm_clip_f32(const float32_t *pSrc, float32_t *pDst, float32_t low, float32_t high, uint32_t numSamples);
+void arm_vlog_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_dot_prod_f32(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result);
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+
+arm_status arm_rfft_init_q15(arm_rfft_instance_q15 *S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag);
+void arm_rfft_q15(const arm_rfft_instance_q15 *S, q15_t *pSrc, q15_t *pDst);
+void arm_cmplx_mag_q15(const q15_t *pSrc, q15_t *pDst, uint32_t numSamples);
+void arm_mult_q15(const q15_t *pSrcA, const q15_t *pSrcB, q15_t *pDst, uint32_t blockSize);
+void arm_shift_q15(const q15_t *pSrc, int8_t shiftBits, q15_t *pDst, uint32_t blockSize);
+void arm_scale_q15(const q15_t *pSrc, q15_t scaleFract, int8_t shift, q15_t *pDst, uint32_t blockSize);
+void arm_dot_prod_q15(const q15_t *pSrcA, const q15_t *pSrcB, uint32_t blockSize, q63_t *result);
+void arm_absmax_q15(const q15_t *pSrc, uint32_t blockSize, q15_t *pResult, uint32_t *pIndex);
+void arm_float_to_q15(const float32_t *pSrc, q15_t *pDst, uint32_t blockSize);
+
+void arm_dot_prod_q7(const q7_t *pSrcA, const q7_t *pSrcB, uint32_t blockSize, q31_t *result);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SHIMS_ARM_MATH_H_ */
@@ -0,0 +1,1071 @@
+/*
+ * mtb_ml_model.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Reference interpreter for the host build. mtb_ml_model_init() reads the
+ * model flatbuffer that model.c passes (_K14) with tflite_model.c, checks
+ * that every operator is one it knows, and plans the activations into the
+ * tensor arena that model.c passes (_K13) the way the TFLM greedy planner
+ * does: largest tensor first, at the lowest offset that does not overlap a
+ * tensor alive at the same time. mtb_ml_model_run() copies the input into
+ * its tensor and runs the operators in order, so the unchanged model.c
+ * computes real scores on a workstation.
+ *
+ * The weights of CONV_2D, FULLY_CONNECTED and the LSTM are packed once at
+ * init with the output channels innermost, and every dot product is run
+ * for all output channels at once, 8 lanes wide with AVX2 when the CPU has
+ * it. Each lane still sums its inputs in order, without FMA, exactly like
+ * arm_dot_prod_f32() on each channel, so the scores do not depend on the
+ * kernel.
+ *
+ * Supported operators: CONV_2D, MAX_POOL_2D, RESHAPE, FULLY_CONNECTED,
+ * SOFTMAX, MEAN and UNIDIRECTIONAL_SEQUENCE_LSTM (no CIFG, peephole,
+ * projection or layer norm), float32 only. Tensors that no operator writes
+ * and that are not the model input (the LSTM states) start from zero on
+ * every run, like the Keras model the exported predictions come from.
+ */
+
+#include "mtb_ml_model.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tflite_model.h"
+#include "layer_profiler.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define MODEL_MAX_TENSORS           (64)
+#define MODEL_MAX_OPERATORS         (32)
+#define MODEL_MAX_LSTM_UNITS        (256)
+
+/* Output channels of a packed weight tensor */
+#define MODEL_MAX_LANES             (256)
+
+/* Alignment of the tensors in the arena, as TFLM */
+#define ARENA_ALIGNMENT             (16)
+
+#define LSTM_GATES                  (4)
+
+/* Inputs of UNIDIRECTIONAL_SEQUENCE_LSTM */
+#define LSTM_INPUT_WEIGHTS          (1)     /* Input, forget, cell, output gate */
+#define LSTM_RECURRENT_WEIGHTS      (5)
+#define LSTM_PEEPHOLE_WEIGHTS       (9)
+#define LSTM_BIAS                   (12)
+#define LSTM_PROJECTION_WEIGHTS     (16)
+#define LSTM_LAYER_NORM             (20)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    tflite_tensor_t info;
+    float *data;                    /* Constant data, or the place in the arena */
+    int first_op;                   /* Lifetime of an activation, -1 if unused */
+    int last_op;
+    int produced;                   /* Written by an operator */
+    uint32_t offset;
+    uint32_t bytes;                 /* Rounded up to ARENA_ALIGNMENT */
+    float *packed;                  /* Weights with the output channels innermost */
+} host_tensor_t;
+
+static mtb_ml_model_t model_object;
+static mtb_ml_model_bin_t model_bin;
+static int model_bin_valid;
+static uint8_t *model_arena;
+static int model_arena_size;
+static int arena_needed;            /* Bytes the plan needs, also when the arena is too small */
+
+static tflite_model_t flatbuffer;
+static host_tensor_t tensors[MODEL_MAX_TENSORS];
+static tflite_operator_t operators[MODEL_MAX_OPERATORS];
+
+static uint64_t run_count;
+static uint64_t run_ns;
+
+static mtb_ml_model_host_hook_t run_hook;
+static void *run_hook_context;
+
+static int arena_watch;
+static uint32_t arena_high_water;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int load_graph(void);
+static int check_operator(const tflite_operator_t *op);
+static int plan_arena(uint8_t *arena, int arena_size);
+static int pack_weights(int index);
+static void free_weights(void);
+static void lanes_dot(const float *x, const float *w, int n, int lanes, float *dot);
+static void run_operator(const tflite_operator_t *op);
+static void conv_2d(const tflite_operator_t *op);
+static void max_pool_2d(const tflite_operator_t *op);
+static void fully_connected(const tflite_operator_t *op);
+static void softmax(const tflite_operator_t *op);
+static void mean(const tflite_operator_t *op);
+static void lstm(const tflite_operator_t *op);
+static int padding_before(int padding, int in, int filter, int stride, int dilation, int out);
+static float activate(int activation, float x);
+static uint64_t now_ns(void);
+static void paint_arena(uint32_t bytes);
+static uint32_t painted_high_water(uint32_t bytes);
+
+#if defined(__x86_64__) || defined(__i386__)
+static void lanes_dot_avx2(const float *x, const float *w, int n, int lanes, float *dot);
+static int avx2_supported(void);
+#endif
+
+
+/*******************************************************************************
+* Function Name: mtb_ml_model_init
+********************************************************************************
+* Summary:
+*    Loads the graph of the model flatbuffer and plans its activations into
+*    the tensor arena.
+*
+* Parameters:
+*    bin            Model flatbuffer
+*    buffer         Tensor arena
+*    object         Set to the model object
+*
+* Return:
+*    CY_RSLT_SUCCESS, MTB_ML_RESULT_BAD_ARG, MTB_ML_RESULT_BAD_MODEL or
+*    MTB_ML_RESULT_ARENA_TOO_SMALL
+*
+*******************************************************************************/
+cy_rslt_t mtb_ml_model_init(const mtb_ml_model_bin_t *bin, const mtb_ml_model_buffer_t *buffer, mtb_ml_model_t **object)
+{
+    int32_t outputs;
+
+    if ((bin == NULL) || (buffer == NULL) || (object == NULL))
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+    model_bin = *bin;
+    model_bin_valid = 1;
+
+    free_weights();
+    memset(&model_object, 0, sizeof(model_object));
+    arena_needed = 0;
+    run_count = 0;
+    run_ns = 0;
+    if ((tflite_model_open(&flatbuffer, bin->model_bin, bin->model_size) != 0) || (load_graph() != 0))
+    {
+        fprintf(stderr, "mtb_ml_model: %s is not a supported float model\n", bin->name);
+        return MTB_ML_RESULT_BAD_MODEL;
+    }
+    outputs = tflite_tensor_elements(&tensors[flatbuffer.output].info);
+    if ((outputs <= 0) || (outputs > MTB_ML_MODEL_OUTPUT_SIZE))
+    {
+        fprintf(stderr, "mtb_ml_model: %ld outputs, the shim holds %d\n", (long)outputs, MTB_ML_MODEL_OUTPUT_SIZE);
+        return MTB_ML_RESULT_BAD_MODEL;
+    }
+    if (plan_arena(buffer->tensor_arena, buffer->tensor_arena_size) != 0)
+    {
+        fprintf(stderr, "mtb_ml_model: the activations need %d bytes, the arena has %d\n",
+                arena_needed, buffer->tensor_arena_size);
+        return MTB_ML_RESULT_ARENA_TOO_SMALL;
+    }
+
+    model_object.output = model_object.output_buffer;
+    model_object.output_size = (int)outputs;
+    model_object.input_size = (int)tflite_tensor_elements(&tensors[flatbuffer.input].info);
+    model_object.model_size = bin->model_size;
+    model_object.profiling = MTB_ML_PROFILE_DISABLE;
+    /* The host interpreter keeps nothing else in the arena */
+    model_object.arena_size = arena_needed;
+    model_arena = buffer->tensor_arena;
+    model_arena_size = buffer->tensor_arena_size;
+    *object = &model_object;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: mtb_ml_model_run
+********************************************************************************
+* Summary:
+*    Runs the network on one input and leaves the scores in object->output.
+*
+* Parameters:
+*    object         Model object of mtb_ml_model_init()
+*    input          Model input, object->input_size values
+*
+* Return:
+*    CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t mtb_ml_model_run(mtb_ml_model_t *object, float *input)
+{
+    const uint64_t start = now_ns();
+    uint64_t hook_ns = 0;
+
+    if (arena_watch)
+    {
+        paint_arena((uint32_t)model_arena_size);
+    }
+    memcpy(tensors[flatbuffer.input].data, input, object->input_size * sizeof(float));
+    for (int i = 0; i < flatbuffer.operator_count; i++)
+    {
+        run_operator(&operators[i]);
+        if ((object->profiling & MTB_ML_PROFILE_ENABLE_LAYER) != 0)
+        {
+            LAYER_PROFILER_LAYER(tflite_operator_name(operators[i].code), tensors[operators[i].outputs[0]].data,
+                                 (uint32_t)tflite_tensor_elements(&tensors[operators[i].outputs[0]].info));
+        }
+        if (run_hook != NULL)
+        {
+            const uint64_t hook_start = now_ns();
+
+            run_hook(i, run_hook_context);
+            hook_ns += now_ns() - hook_start;
+        }
+    }
+    memcpy(object->output, tensors[flatbuffer.output].data, object->output_size * sizeof(float));
+    if (arena_watch)
+    {
+        const uint32_t high_water = painted_high_water((uint32_t)model_arena_size);
+
+        arena_high_water = (high_water > arena_high_water) ? high_water : arena_high_water;
+    }
+    run_count++;
+    run_ns += now_ns() - start - hook_ns;
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t mtb_ml_model_deinit(mtb_ml_model_t *object)
+{
+    (void) object;
+    free_weights();
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: mtb_ml_model_profile_config
+********************************************************************************
+* Summary:
+*    Sets the profiling of mtb_ml_model_run(). With MTB_ML_PROFILE_ENABLE_LAYER
+*    every operator is marked for the layer profiler, the other flags are
+*    kept for mtb_ml_model_profile_log().
+*
+* Parameters:
+*    object         Model object of mtb_ml_model_init()
+*    config         Flags of mtb_ml_profile_config_t
+*
+* Return:
+*    CY_RSLT_SUCCESS or MTB_ML_RESULT_BAD_ARG
+*
+*******************************************************************************/
+cy_rslt_t mtb_ml_model_profile_config(mtb_ml_model_t *object, mtb_ml_profile_config_t config)
+{
+    if (object == NULL)
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+    object->profiling = config;
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* The runs since mtb_ml_model_init() and their mean time */
+cy_rslt_t mtb_ml_model_profile_log(mtb_ml_model_t *object)
+{
+    if (object == NULL)
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+    if (object->profiling != MTB_ML_PROFILE_DISABLE)
+    {
+        printf("PROFILE_INFO, %s runs: %llu, mean ns per run: %llu\r\n", model_bin.name,
+               (unsigned long long)run_count, (unsigned long long)((run_count > 0) ? run_ns / run_count : 0));
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+const mtb_ml_model_bin_t *mtb_ml_model_host_bin(void)
+{
+    return model_bin_valid ? &model_bin : NULL;
+}
+
+
+const mtb_ml_model_t *mtb_ml_model_host_object(void)
+{
+    return (model_object.output != NULL) ? &model_object : NULL;
+}
+
+
+void mtb_ml_model_host_run_time(uint64_t *runs, uint64_t *ns)
+{
+    *runs = run_count;
+    *ns = run_ns;
+}
+
+
+int mtb_ml_model_host_arena_needed(void)
+{
+    return arena_needed;
+}
+
+
+void mtb_ml_model_host_watch_arena(int enable)
+{
+    arena_watch = enable;
+    if (enable)
+    {
+        arena_high_water = 0;
+    }
+}
+
+
+int mtb_ml_model_host_arena_high_water(void)
+{
+    return (int)arena_high_water;
+}
+
+
+void mtb_ml_model_host_set_hook(mtb_ml_model_host_hook_t hook, void *context)
+{
+    run_hook = hook;
+    run_hook_context = context;
+}
+
+
+const float *mtb_ml_model_host_tensor(int index, int32_t *elements)
+{
+    if ((model_object.output == NULL) || (index < 0) || (index >= flatbuffer.tensor_count) ||
+        (tensors[index].info.data != NULL) || (tensors[index].first_op < 0))
+    {
+        return NULL;
+    }
+    *elements = tflite_tensor_elements(&tensors[index].info);
+    return tensors[index].data;
+}
+
+
+/* Tensors, operators and the lifetime of every activation */
+static int load_graph(void)
+{
+    if ((flatbuffer.tensor_count > MODEL_MAX_TENSORS) || (flatbuffer.operator_count > MODEL_MAX_OPERATORS))
+    {
+        return -1;
+    }
+    for (int t = 0; t < flatbuffer.tensor_count; t++)
+    {
+        host_tensor_t *tensor = &tensors[t];
+
+        memset(tensor, 0, sizeof(*tensor));
+        if (tflite_model_get_tensor(&flatbuffer, t, &tensor->info) != 0)
+        {
+            return -1;
+        }
+        tensor->data = (float *)tensor->info.data;
+        tensor->first_op = -1;
+        tensor->last_op = -1;
+    }
+    /* The input is written before the first operator */
+    tensors[flatbuffer.input].first_op = 0;
+
+    for (int i = 0; i < flatbuffer.operator_count; i++)
+    {
+        tflite_operator_t *op = &operators[i];
+
+        if ((tflite_model_get_operator(&flatbuffer, i, op) != 0) || (check_operator(op) != 0))
+        {
+            return -1;
+        }
+        if ((op->code == TFLITE_OP_CONV_2D) || (op->code == TFLITE_OP_FULLY_CONNECTED))
+        {
+            if ((op->inputs[1] >= flatbuffer.tensor_count) || (pack_weights(op->inputs[1]) != 0))
+            {
+                return -1;
+            }
+        }
+        else if (op->code == TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM)
+        {
+            for (int g = 0; g < 2 * LSTM_GATES; g++)
+            {
+                if ((op->inputs[LSTM_INPUT_WEIGHTS + g] >= flatbuffer.tensor_count) ||
+                    (pack_weights(op->inputs[LSTM_INPUT_WEIGHTS + g]) != 0))
+                {
+                    return -1;
+                }
+            }
+        }
+        for (int k = 0; k < op->input_count + op->output_count; k++)
+        {
+            int index = (k < op->input_count) ? op->inputs[k] : op->outputs[k - op->input_count];
+            host_tensor_t *tensor;
+
+            if (index < 0)
+            {
+                continue;
+            }
+            if (index >= flatbuffer.tensor_count)
+            {
+                return -1;
+            }
+            tensor = &tensors[index];
+            if (tensor->info.data != NULL)
+            {
+                continue;
+            }
+            if (tensor->info.type != TFLITE_TYPE_FLOAT32)
+            {
+                return -1;
+            }
+            if (tensor->first_op < 0)
+            {
+                tensor->first_op = i;
+            }
+            tensor->last_op = i;
+            tensor->produced |= (k >= op->input_count);
+        }
+    }
+    /* The output is read after the last operator */
+    tensors[flatbuffer.output].last_op = flatbuffer.operator_count;
+    return 0;
+}
+
+
+static int check_operator(const tflite_operator_t *op)
+{
+    switch (op->code)
+    {
+        case TFLITE_OP_CONV_2D:
+        case TFLITE_OP_MAX_POOL_2D:
+        case TFLITE_OP_RESHAPE:
+        case TFLITE_OP_FULLY_CONNECTED:
+        case TFLITE_OP_SOFTMAX:
+        case TFLITE_OP_MEAN:
+            return (op->output_count == 1) ? 0 : -1;
+
+        case TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM:
+            if ((op->input_count < LSTM_BIAS + LSTM_GATES) || (op->inputs[LSTM_INPUT_WEIGHTS] < 0))
+            {
+                return -1;
+            }
+            for (int k = LSTM_PEEPHOLE_WEIGHTS; k < op->input_count; k++)
+            {
+                int optional = ((k >= LSTM_PEEPHOLE_WEIGHTS) && (k < LSTM_BIAS)) ||
+                               ((k >= LSTM_PROJECTION_WEIGHTS) && (k < LSTM_PROJECTION_WEIGHTS + 2)) ||
+                               (k >= LSTM_LAYER_NORM);
+                if (optional && (op->inputs[k] >= 0))
+                {
+                    return -1;
+                }
+            }
+            return 0;
+
+        default:
+            return -1;
+    }
+}
+
+
+/* Greedy placement, largest first. Fails if the arena is too small, the
+ * space needed is left in arena_needed. */
+static int plan_arena(uint8_t *arena, int arena_size)
+{
+    int order[MODEL_MAX_TENSORS];
+    int count = 0;
+    uint32_t used = 0;
+
+    for (int t = 0; t < flatbuffer.tensor_count; t++)
+    {
+        host_tensor_t *tensor = &tensors[t];
+
+        if ((tensor->info.data == NULL) && (tensor->first_op >= 0))
+        {
+            int k = count++;
+
+            tensor->bytes = ((uint32_t)tflite_tensor_elements(&tensor->info) * sizeof(float) + ARENA_ALIGNMENT - 1) &
+                            ~(uint32_t)(ARENA_ALIGNMENT - 1);
+            /* Insertion sort, largest first, ties in tensor order */
+            while ((k > 0) && (tensors[order[k - 1]].bytes < tensor->bytes))
+            {
+                order[k] = order[k - 1];
+                k--;
+            }
+            order[k] = t;
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        host_tensor_t *tensor = &tensors[order[i]];
+        uint32_t offset = 0;
+        int moved = 1;
+
+        /* Move past every placed tensor that overlaps in time and space
+         * until none does */
+        while (moved)
+        {
+            moved = 0;
+            for (int j = 0; j < i; j++)
+            {
+                const host_tensor_t *placed = &tensors[order[j]];
+
+                if ((placed->first_op <= tensor->last_op) && (tensor->first_op <= placed->last_op) &&
+                    (offset < placed->offset + placed->bytes) && (placed->offset < offset + tensor->bytes))
+                {
+                    offset = placed->offset + placed->bytes;
+                    moved = 1;
+                }
+            }
+        }
+        tensor->offset = offset;
+        used = (offset + tensor->bytes > used) ? offset + tensor->bytes : used;
+    }
+
+    arena_needed = (int)used;
+    if ((arena == NULL) || (used > (uint32_t)arena_size))
+    {
+        return -1;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        tensors[order[i]].data = (float *)(arena + tensors[order[i]].offset);
+    }
+    return 0;
+}
+
+
+/* [outputs][...] constant to [...][outputs] */
+static int pack_weights(int index)
+{
+    host_tensor_t *tensor = &tensors[index];
+    int32_t rows;
+    int32_t columns;
+
+    if ((index < 0) || (tensor->info.data == NULL) || (tensor->info.type != TFLITE_TYPE_FLOAT32) ||
+        (tensor->info.dims < 2))
+    {
+        return -1;
+    }
+    if (tensor->packed != NULL)
+    {
+        return 0;
+    }
+    rows = tensor->info.shape[0];
+    columns = tflite_tensor_elements(&tensor->info) / rows;
+    if ((rows > MODEL_MAX_LANES) || (columns <= 0))
+    {
+        return -1;
+    }
+    tensor->packed = malloc((size_t)rows * columns * sizeof(float));
+    if (tensor->packed == NULL)
+    {
+        return -1;
+    }
+    for (int32_t r = 0; r < rows; r++)
+    {
+        for (int32_t c = 0; c < columns; c++)
+        {
+            tensor->packed[c * rows + r] = tensor->data[r * columns + c];
+        }
+    }
+    return 0;
+}
+
+
+static void free_weights(void)
+{
+    for (int t = 0; t < MODEL_MAX_TENSORS; t++)
+    {
+        free(tensors[t].packed);
+        tensors[t].packed = NULL;
+    }
+}
+
+
+static void run_operator(const tflite_operator_t *op)
+{
+    /* Tensors nothing writes (LSTM states) start from zero */
+    for (int k = 0; k < op->input_count; k++)
+    {
+        int index = op->inputs[k];
+
+        if ((index >= 0) && (index != flatbuffer.input) && (tensors[index].info.data == NULL) &&
+            !tensors[index].produced)
+        {
+            memset(tensors[index].data, 0, tensors[index].bytes);
+        }
+    }
+
+    switch (op->code)
+    {
+        case TFLITE_OP_CONV_2D:
+            conv_2d(op);
+            break;
+        case TFLITE_OP_MAX_POOL_2D:
+            max_pool_2d(op);
+            break;
+        case TFLITE_OP_RESHAPE:
+            memcpy(tensors[op->outputs[0]].data, tensors[op->inputs[0]].data,
+                   tflite_tensor_elements(&tensors[op->outputs[0]].info) * sizeof(float));
+            break;
+        case TFLITE_OP_FULLY_CONNECTED:
+            fully_connected(op);
+            break;
+        case TFLITE_OP_SOFTMAX:
+            softmax(op);
+            break;
+        case TFLITE_OP_MEAN:
+            mean(op);
+            break;
+        case TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM:
+            lstm(op);
+            break;
+        default:
+            break;
+    }
+}
+
+
+/* NHWC input, [out channels][height][width][in channels] filter */
+static void conv_2d(const tflite_operator_t *op)
+{
+    const host_tensor_t *input = &tensors[op->inputs[0]];
+    const host_tensor_t *filter = &tensors[op->inputs[1]];
+    const float *bias = ((op->input_count > 2) && (op->inputs[2] >= 0)) ? tensors[op->inputs[2]].data : NULL;
+    const host_tensor_t *output = &tensors[op->outputs[0]];
+    const int in_h = input->info.shape[1];
+    const int in_w = input->info.shape[2];
+    const int in_c = input->info.shape[3];
+    const int out_c = filter->info.shape[0];
+    const int k_h = filter->info.shape[1];
+    const int k_w = filter->info.shape[2];
+    const int out_h = output->info.shape[1];
+    const int out_w = output->info.shape[2];
+    const int padding = tflite_option_byte(&flatbuffer, op, TFLITE_CONV_PADDING, TFLITE_PADDING_SAME);
+    const int stride_w = tflite_option_int(&flatbuffer, op, TFLITE_CONV_STRIDE_W, 1);
+    const int stride_h = tflite_option_int(&flatbuffer, op, TFLITE_CONV_STRIDE_H, 1);
+    const int dilation_w = tflite_option_int(&flatbuffer, op, TFLITE_CONV_DILATION_W, 1);
+    const int dilation_h = tflite_option_int(&flatbuffer, op, TFLITE_CONV_DILATION_H, 1);
+    const int activation = tflite_option_byte(&flatbuffer, op, TFLITE_CONV_ACTIVATION, TFLITE_ACTIVATION_NONE);
+    const int pad_h = padding_before(padding, in_h, k_h, stride_h, dilation_h, out_h);
+    const int pad_w = padding_before(padding, in_w, k_w, stride_w, dilation_w, out_w);
+
+    float dot[MODEL_MAX_LANES];
+
+    for (int y = 0; y < out_h; y++)
+    {
+        for (int x = 0; x < out_w; x++)
+        {
+            float *out = &output->data[(y * out_w + x) * out_c];
+
+            for (int o = 0; o < out_c; o++)
+            {
+                out[o] = (bias != NULL) ? bias[o] : 0.0f;
+            }
+            for (int ky = 0; ky < k_h; ky++)
+            {
+                const int iy = y * stride_h - pad_h + ky * dilation_h;
+
+                if ((iy < 0) || (iy >= in_h))
+                {
+                    continue;
+                }
+                for (int kx = 0; kx < k_w; kx++)
+                {
+                    const int ix = x * stride_w - pad_w + kx * dilation_w;
+
+                    if ((ix < 0) || (ix >= in_w))
+                    {
+                        continue;
+                    }
+                    lanes_dot(&input->data[(iy * in_w + ix) * in_c], &filter->packed[(ky * k_w + kx) * in_c * out_c],
+                              in_c, out_c, dot);
+                    for (int o = 0; o < out_c; o++)
+                    {
+                        out[o] += dot[o];
+                    }
+                }
+            }
+            for (int o = 0; o < out_c; o++)
+            {
+                out[o] = activate(activation, out[o]);
+            }
+        }
+    }
+}
+
+
+static void max_pool_2d(const tflite_operator_t *op)
+{
+    const host_tensor_t *input = &tensors[op->inputs[0]];
+    const host_tensor_t *output = &tensors[op->outputs[0]];
+    const int in_h = input->info.shape[1];
+    const int in_w = input->info.shape[2];
+    const int channels = input->info.shape[3];
+    const int out_h = output->info.shape[1];
+    const int out_w = output->info.shape[2];
+    const int padding = tflite_option_byte(&flatbuffer, op, TFLITE_POOL_PADDING, TFLITE_PADDING_SAME);
+    const int stride_w = tflite_option_int(&flatbuffer, op, TFLITE_POOL_STRIDE_W, 1);
+    const int stride_h = tflite_option_int(&flatbuffer, op, TFLITE_POOL_STRIDE_H, 1);
+    const int filter_w = tflite_option_int(&flatbuffer, op, TFLITE_POOL_FILTER_W, 1);
+    const int filter_h = tflite_option_int(&flatbuffer, op, TFLITE_POOL_FILTER_H, 1);
+    const int activation = tflite_option_byte(&flatbuffer, op, TFLITE_POOL_ACTIVATION, TFLITE_ACTIVATION_NONE);
+    const int pad_h = padding_before(padding, in_h, filter_h, stride_h, 1, out_h);
+    const int pad_w = padding_before(padding, in_w, filter_w, stride_w, 1, out_w);
+
+    for (int y = 0; y < out_h; y++)
+    {
+        for (int x = 0; x < out_w; x++)
+        {
+            for (int c = 0; c < channels; c++)
+            {
+                float max = -FLT_MAX;
+
+                /* Padded positions do not take part */
+                for (int ky = 0; ky < filter_h; ky++)
+                {
+                    const int iy = y * stride_h - pad_h + ky;
+
+                    for (int kx = 0; kx < filter_w; kx++)
+                    {
+                        const int ix = x * stride_w - pad_w + kx;
+
+                        if ((iy >= 0) && (iy < in_h) && (ix >= 0) && (ix < in_w) &&
+                            (input->data[(iy * in_w + ix) * channels + c] > max))
+                        {
+                            max = input->data[(iy * in_w + ix) * channels + c];
+                        }
+                    }
+                }
+                output->data[(y * out_w + x) * channels + c] = activate(activation, max);
+            }
+        }
+    }
+}
+
+
+/* [outputs][inputs] weights, the input is flattened to [batches][inputs] */
+static void fully_connected(const tflite_operator_t *op)
+{
+    const host_tensor_t *input = &tensors[op->inputs[0]];
+    const host_tensor_t *weights = &tensors[op->inputs[1]];
+    const float *bias = ((op->input_count > 2) && (op->inputs[2] >= 0)) ? tensors[op->inputs[2]].data : NULL;
+    float *output = tensors[op->outputs[0]].data;
+    const int outputs = weights->info.shape[0];
+    const int inputs = weights->info.shape[1];
+    const int batches = tflite_tensor_elements(&input->info) / inputs;
+    const int activation = tflite_option_byte(&flatbuffer, op, TFLITE_FC_ACTIVATION, TFLITE_ACTIVATION_NONE);
+
+    float dot[MODEL_MAX_LANES];
+
+    for (int b = 0; b < batches; b++)
+    {
+        lanes_dot(&input->data[b * inputs], weights->packed, inputs, outputs, dot);
+        for (int o = 0; o < outputs; o++)
+        {
+            output[b * outputs + o] = activate(activation, dot[o] + ((bias != NULL) ? bias[o] : 0.0f));
+        }
+    }
+}
+
+
+/* Over the last dimension */
+static void softmax(const tflite_operator_t *op)
+{
+    const host_tensor_t *input = &tensors[op->inputs[0]];
+    float *output = tensors[op->outputs[0]].data;
+    const int depth = input->info.shape[input->info.dims - 1];
+    const int rows = tflite_tensor_elements(&input->info) / depth;
+    const float beta = tflite_option_float(&flatbuffer, op, TFLITE_SOFTMAX_BETA, 1.0f);
+
+    for (int r = 0; r < rows; r++)
+    {
+        const float *x = &input->data[r * depth];
+        float *y = &output[r * depth];
+        float max = x[0];
+        float sum = 0.0f;
+
+        for (int i = 1; i < depth; i++)
+        {
+            max = (x[i] > max) ? x[i] : max;
+        }
+        for (int i = 0; i < depth; i++)
+        {
+            y[i] = expf((x[i] - max) * beta);
+            sum += y[i];
+        }
+        for (int i = 0; i < depth; i++)
+        {
+            y[i] /= sum;
+        }
+    }
+}
+
+
+/* Mean over the axes of the second input, with or without keep_dims the
+ * kept elements are in the same order */
+static void mean(const tflite_operator_t *op)
+{
+    const host_tensor_t *input = &tensors[op->inputs[0]];
+    const host_tensor_t *axes = &tensors[op->inputs[1]];
+    float *output = tensors[op->outputs[0]].data;
+    const int dims = input->info.dims;
+    const int32_t elements = tflite_tensor_elements(&input->info);
+    const int32_t outputs = tflite_tensor_elements(&tensors[op->outputs[0]].info);
+    const int32_t *axis = (const int32_t *)axes->info.data;
+    const int axis_count = tflite_tensor_elements(&axes->info);
+    int reduced[TFLITE_MAX_DIMS] = { 0 };
+
+    for (int a = 0; a < axis_count; a++)
+    {
+        reduced[(axis[a] < 0) ? axis[a] + dims : axis[a]] = 1;
+    }
+    memset(output, 0, outputs * sizeof(float));
+    for (int32_t i = 0; i < elements; i++)
+    {
+        int32_t rest = i;
+        int32_t out = 0;
+        int32_t scale = 1;
+
+        /* Drop the reduced coordinates of element i */
+        for (int d = dims - 1; d >= 0; d--)
+        {
+            const int32_t coordinate = rest % input->info.shape[d];
+
+            rest /= input->info.shape[d];
+            if (!reduced[d])
+            {
+                out += coordinate * scale;
+                scale *= input->info.shape[d];
+            }
+        }
+        output[out] += input->data[i];
+    }
+    for (int32_t o = 0; o < outputs; o++)
+    {
+        output[o] /= (float)(elements / outputs);
+    }
+}
+
+
+/* TFLite UNIDIRECTIONAL_SEQUENCE_LSTM: input, forget, cell and output gate */
+static void lstm(const tflite_operator_t *op)
+{
+    const host_tensor_t *input = &tensors[op->inputs[0]];
+    float *output = tensors[op->outputs[0]].data;
+    const int time_major = tflite_option_byte(&flatbuffer, op, TFLITE_LSTM_TIME_MAJOR, 0);
+    const int activation = tflite_option_byte(&flatbuffer, op, TFLITE_LSTM_ACTIVATION, TFLITE_ACTIVATION_TANH);
+    const float cell_clip = tflite_option_float(&flatbuffer, op, TFLITE_LSTM_CELL_CLIP, 0.0f);
+    const int batches = input->info.shape[time_major ? 1 : 0];
+    const int steps = input->info.shape[time_major ? 0 : 1];
+    const int inputs = input->info.shape[2];
+    const int units = tensors[op->inputs[LSTM_INPUT_WEIGHTS]].info.shape[0];
+    const float *input_weights[LSTM_GATES];
+    const float *recurrent_weights[LSTM_GATES];
+    const float *bias[LSTM_GATES];
+    float gates[LSTM_GATES][MODEL_MAX_LSTM_UNITS];
+    float dot_state[MODEL_MAX_LSTM_UNITS];
+    float state[MODEL_MAX_LSTM_UNITS];
+    float cell[MODEL_MAX_LSTM_UNITS];
+
+    if ((units > MODEL_MAX_LSTM_UNITS) || (units > MODEL_MAX_LANES))
+    {
+        return;
+    }
+    for (int g = 0; g < LSTM_GATES; g++)
+    {
+        input_weights[g] = tensors[op->inputs[LSTM_INPUT_WEIGHTS + g]].packed;
+        recurrent_weights[g] = tensors[op->inputs[LSTM_RECURRENT_WEIGHTS + g]].packed;
+        bias[g] = (op->inputs[LSTM_BIAS + g] >= 0) ? tensors[op->inputs[LSTM_BIAS + g]].data : NULL;
+    }
+
+    for (int b = 0; b < batches; b++)
+    {
+        /* The state tensors are zero, see run_operator() */
+        memset(state, 0, units * sizeof(float));
+        memset(cell, 0, units * sizeof(float));
+        for (int t = 0; t < steps; t++)
+        {
+            const int row = time_major ? (t * batches + b) : (b * steps + t);
+            const float *x = &input->data[row * inputs];
+
+            for (int g = 0; g < LSTM_GATES; g++)
+            {
+                lanes_dot(x, input_weights[g], inputs, units, gates[g]);
+                lanes_dot(state, recurrent_weights[g], units, units, dot_state);
+                for (int u = 0; u < units; u++)
+                {
+                    gates[g][u] = ((bias[g] != NULL) ? bias[g][u] : 0.0f) + gates[g][u] + dot_state[u];
+                }
+            }
+            for (int u = 0; u < units; u++)
+            {
+                const float in_gate = 1.0f / (1.0f + expf(-gates[0][u]));
+                const float forget_gate = 1.0f / (1.0f + expf(-gates[1][u]));
+                const float out_gate = 1.0f / (1.0f + expf(-gates[3][u]));
+
+                cell[u] = forget_gate * cell[u] + in_gate * activate(activation, gates[2][u]);
+                if (cell_clip > 0.0f)
+                {
+                    cell[u] = (cell[u] > cell_clip) ? cell_clip : ((cell[u] < -cell_clip) ? -cell_clip : cell[u]);
+                }
+                state[u] = out_gate * activate(activation, cell[u]);
+            }
+            memcpy(&output[row * units], state, units * sizeof(float));
+        }
+    }
+}
+
+
+/* dot[l] = x[0] * w[l] + x[1] * w[lanes + l] + ... summed in order from 0,
+ * the arm_dot_prod_f32() of every output channel */
+static void lanes_dot(const float *x, const float *w, int n, int lanes, float *dot)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (((lanes & 7) == 0) && avx2_supported())
+    {
+        lanes_dot_avx2(x, w, n, lanes, dot);
+        return;
+    }
+#endif
+    for (int l = 0; l < lanes; l++)
+    {
+        dot[l] = 0.0f;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        for (int l = 0; l < lanes; l++)
+        {
+            dot[l] += x[i] * w[i * lanes + l];
+        }
+    }
+}
+
+
+/* Zero rows or columns before the first one of the input */
+static int padding_before(int padding, int in, int filter, int stride, int dilation, int out)
+{
+    int total;
+
+    if (padding != TFLITE_PADDING_SAME)
+    {
+        return 0;
+    }
+    total = (out - 1) * stride + (filter - 1) * dilation + 1 - in;
+    return (total > 0) ? total / 2 : 0;
+}
+
+
+static float activate(int activation, float x)
+{
+    switch (activation)
+    {
+        case TFLITE_ACTIVATION_RELU:
+            return (x > 0.0f) ? x : 0.0f;
+        case TFLITE_ACTIVATION_RELU_N1_TO_1:
+            return (x > 1.0f) ? 1.0f : ((x < -1.0f) ? -1.0f : x);
+        case TFLITE_ACTIVATION_RELU6:
+            return (x > 6.0f) ? 6.0f : ((x > 0.0f) ? x : 0.0f);
+        case TFLITE_ACTIVATION_TANH:
+            return tanhf(x);
+        default:
+            return x;
+    }
+}
+
+
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+
+/* The same paint as the layer profiler, so both can watch one run */
+static void paint_arena(uint32_t bytes)
+{
+    const uint32_t paint = LAYER_PROFILER_PAINT;
+
+    for (uint32_t i = 0; i + sizeof(paint) <= bytes; i += sizeof(paint))
+    {
+        memcpy(&model_arena[i], &paint, sizeof(paint));
+    }
+}
+
+
+/* End of the highest word that lost its paint */
+static uint32_t painted_high_water(uint32_t bytes)
+{
+    const uint32_t paint = LAYER_PROFILER_PAINT;
+    uint32_t end = bytes & ~(uint32_t)(sizeof(paint) - 1);
+
+    while (end > 0)
+    {
+        uint32_t word;
+
+        memcpy(&word, &model_arena[end - sizeof(paint)], sizeof(word));
+        if (word != paint)
+        {
+            break;
+        }
+        end -= sizeof(paint);
+    }
+    return end;
+}
+
+
+#if defined(__x86_64__) || defined(__i386__)
+/* 8 lanes per register, up to 4 registers per pass over the inputs. Multiply
+ * and add are separate instructions, like the scalar loop. */
+__attribute__((target("avx2")))
+static void lanes_dot_avx2(const float *x, const float *w, int n, int lanes, float *dot)
+{
+    for (int l = 0; l < lanes; l += 32)
+    {
+        const int registers = (lanes - l >= 32) ? 4 : (lanes - l) / 8;
+        __m256 sum[4] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+        for (int i = 0; i < n; i++)
+        {
+            const __m256 xi = _mm256_set1_ps(x[i]);
+            const float *row = &w[i * lanes + l];
+
+            for (int r = 0; r < registers; r++)
+            {
+                sum[r] = _mm256_add_ps(sum[r], _mm256_mul_ps(xi, _mm256_loadu_ps(&row[8 * r])));
+            }
+        }
+        for (int r = 0; r < registers; r++)
+        {
+            _mm256_storeu_ps(&dot[l + 8 * r], sum[r]);
+        }
+    }
+}
+
+
+static int avx2_supported(void)
+{
+    static int supported = -1;
+
+    if (supported < 0)
+    {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("avx2");
+    }
+    return supported;
+}
+#endif
@@ -0,0 +1,113 @@
+/*
+ * mtb_ml_model.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Host stand-in for the ModusToolbox ML middleware interface used by the
+ * generated model code, backed by the reference interpreter of
+ * mtb_ml_model.c.
+ */
+
+#ifndef HOST_SHIMS_MTB_ML_MODEL_H_
+#define HOST_SHIMS_MTB_ML_MODEL_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS             ((cy_rslt_t)0x00000000U)
+#define MTB_ML_RESULT_BAD_ARG       ((cy_rslt_t)0x00000001U)
+#define MTB_ML_RESULT_BAD_MODEL     ((cy_rslt_t)0x00000002U)
+#define MTB_ML_RESULT_ARENA_TOO_SMALL ((cy_rslt_t)0x00000003U)
+
+/* Number of model outputs (scores) */
+#define MTB_ML_MODEL_OUTPUT_SIZE    (7)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Profiling of mtb_ml_model_profile_config(), same values as the middleware */
+typedef enum
+{
+    MTB_ML_PROFILE_DISABLE                  = 0,
+    MTB_ML_PROFILE_ENABLE_MODEL             = 1,
+    MTB_ML_PROFILE_ENABLE_LAYER             = 2,
+    MTB_ML_PROFILE_ENABLE_MODEL_PER_FRAME   = 4,
+    MTB_ML_PROFILE_ENABLE_LAYER_PER_FRAME   = 8,
+    MTB_ML_LOG_ENABLE_MODEL_LOG             = 16
+} mtb_ml_profile_config_t;
+
+typedef struct
+{
+    char *name;
+    uint8_t *model_bin;
+    unsigned int model_size;
+    int arena_size;
+} mtb_ml_model_bin_t;
+
+typedef struct
+{
+    uint8_t *tensor_arena;
+    int tensor_arena_size;
+} mtb_ml_model_buffer_t;
+
+typedef struct
+{
+    float *output;
+    int input_size;
+    int output_size;
+    int model_size;
+    int arena_size;                 /* Arena bytes in use after mtb_ml_model_init(), arena_used_bytes() of TFLM */
+    mtb_ml_profile_config_t profiling;
+    float output_buffer[MTB_ML_MODEL_OUTPUT_SIZE];
+} mtb_ml_model_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_rslt_t mtb_ml_model_init(const mtb_ml_model_bin_t *bin, const mtb_ml_model_buffer_t *buffer, mtb_ml_model_t **object);
+cy_rslt_t mtb_ml_model_run(mtb_ml_model_t *object, float *input);
+cy_rslt_t mtb_ml_model_deinit(mtb_ml_model_t *object);
+
+/* With MTB_ML_PROFILE_ENABLE_LAYER, mtb_ml_model_run() marks every operator
+ * for the layer profiler. The log prints the runs and their mean time. */
+cy_rslt_t mtb_ml_model_profile_config(mtb_ml_model_t *object, mtb_ml_profile_config_t config);
+cy_rslt_t mtb_ml_model_profile_log(mtb_ml_model_t *object);
+
+/* Host only: the model flatbuffer of the last mtb_ml_model_init(), NULL before */
+const mtb_ml_model_bin_t *mtb_ml_model_host_bin(void);
+
+/* Host only: mtb_ml_model_run() calls and their total time since the last
+ * mtb_ml_model_init() */
+void mtb_ml_model_host_run_time(uint64_t *runs, uint64_t *ns);
+
+/* Host only: the model object of the last mtb_ml_model_init(), NULL before */
+const mtb_ml_model_t *mtb_ml_model_host_object(void);
+
+/* Host only: bytes the activations need, as planned by the last
+ * mtb_ml_model_init(), also when the arena was too small for them */
+int mtb_ml_model_host_arena_needed(void);
+
+/* Host only: with enable set, mtb_ml_model_run() paints the arena before
+ * every run and measures the highest byte the operators wrote. The mark is
+ * the highest since the last call with enable set, 0 before any run. */
+void mtb_ml_model_host_watch_arena(int enable);
+int mtb_ml_model_host_arena_high_water(void);
+
+/* Host only: called after every operator of mtb_ml_model_run() with its index,
+ * NULL for none. Its time is not counted by mtb_ml_model_host_run_time(). */
+typedef void (*mtb_ml_model_host_hook_t)(int op, void *context);
+void mtb_ml_model_host_set_hook(mtb_ml_model_host_hook_t hook, void *context);
+
+/* Host only: data of an activation tensor as the operators left it, valid in
+ * the hook of an operator that reads or writes it. NULL for a constant or an
+ * unused tensor. */
+const float *mtb_ml_model_host_tensor(int index, int32_t *elements);
+
+
+#endif /* HOST_SHIMS_MTB_ML_MODEL_H_ */
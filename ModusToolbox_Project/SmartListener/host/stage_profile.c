@@ -0,0 +1,163 @@
+/*
+ * stage_profile.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Runs a recording through the model with the stage profiler compiled in
+ * (STAGE_PROFILER_ENABLE=1) and prints the dumps the device sends on the
+ * UART and MQTT, in nanoseconds from CLOCK_MONOTONIC. The stages must
+ * account for the time spent in IMAI_enqueue_block(): the coverage is the
+ * sum of the stages over the wall time of the calls.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_ingest.h"
+#include "activity_gate.h"
+#include "frontend_q15.h"
+#include "stage_profiler.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define BLOCK_SAMPLES                   (1600)
+
+/* Coverage below which time is spent outside the profiled stages */
+#define MIN_COVERAGE                    (0.90)
+
+
+/*******************************************************************************
+* Function Name: stage_profile_main
+********************************************************************************
+* Summary:
+*    smartlistener_host stage-profile <file.wav> [--repeat N]
+*
+*******************************************************************************/
+int stage_profile_main(int argc, char *argv[])
+{
+    const char *wav_path = NULL;
+    int repeat = 1;
+    wav_t wav;
+    int16_t *pcm;
+    float *samples;
+    float scores[IMAI_DATA_OUT_COUNT];
+    char payload[STAGE_PROFILER_PAYLOAD_MAX];
+    uint64_t wall_ns = 0;
+    uint64_t staged_ns = 0;
+    int length;
+    int result = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else if (argv[i][0] != '-')
+        {
+            wav_path = argv[i];
+        }
+        else
+        {
+            wav_path = NULL;
+            break;
+        }
+    }
+    if ((wav_path == NULL) || (repeat < 1))
+    {
+        fprintf(stderr, "usage: smartlistener_host stage-profile <file.wav> [--repeat N]\n");
+        return 1;
+    }
+    #if !STAGE_PROFILER_ENABLE
+    fprintf(stderr, "Built without the stage profiler, rebuild with -DSTAGE_PROFILER_ENABLE=1 in CFLAGS\n");
+    return 1;
+    #endif
+
+    if (wav_load(wav_path, &wav) != 0)
+    {
+        return 1;
+    }
+    pcm = malloc(wav.frames * sizeof(int16_t));
+    samples = malloc(wav.frames * sizeof(float));
+    if ((pcm == NULL) || (samples == NULL))
+    {
+        free(pcm);
+        free(samples);
+        wav_free(&wav);
+        return 1;
+    }
+    /* Channel 0, converted the same way ml_task.c does */
+    for (size_t i = 0; i < wav.frames; i++)
+    {
+        pcm[i] = wav.samples[i * wav.channels];
+    }
+    audio_ingest_block(pcm, samples, wav.frames, DIGITAL_BOOST_FACTOR);
+
+    stage_profiler_reset();
+    for (int r = 0; (r < repeat) && (result == 0); r++)
+    {
+        if (IMAI_init() != IMAI_RET_SUCCESS)
+        {
+            result = 1;
+            break;
+        }
+        activity_gate_init();
+        for (size_t i = 0; i < wav.frames; i += BLOCK_SAMPLES)
+        {
+            int block = (wav.frames - i < BLOCK_SAMPLES) ? (int)(wav.frames - i) : BLOCK_SAMPLES;
+            uint64_t t0 = host_now_ns();
+            int ready = IMAI_enqueue_block(&samples[i], block);
+
+            wall_ns += host_now_ns() - t0;
+            if (ready < 0)
+            {
+                result = 1;
+                break;
+            }
+            for (int k = 0; k < ready; k++)
+            {
+                IMAI_dequeue(scores);
+            }
+        }
+        IMAI_finalize();
+    }
+
+    if (result == 0)
+    {
+        for (int i = 0; i < STAGE_PROFILER_NUM_STAGES; i++)
+        {
+            stage_profiler_stats_t stats;
+
+            stage_profiler_get_stats((stage_profiler_stage_t)i, &stats);
+            staged_ns += stats.total;
+        }
+
+        printf("Recording:                 %s (%d passes)\n", wav_path, repeat);
+        printf("UART dump:\n");
+        stage_profiler_print();
+        length = stage_profiler_format(payload, sizeof(payload));
+        printf("MQTT payload (%d bytes):\n  %s\n", length, payload);
+        printf("Coverage:                  %.1f%% of %.2f ms in IMAI_enqueue_block()\n",
+            (wall_ns > 0) ? 100.0 * (double)staged_ns / (double)wall_ns : 0.0, (double)wall_ns / 1e6);
+        if ((length >= (int)sizeof(payload)) || ((double)staged_ns < MIN_COVERAGE * (double)wall_ns))
+        {
+            result = 1;
+        }
+        printf("Result:                    %s\n", (result == 0) ? "PASS" : "FAIL");
+    }
+
+    free(pcm);
+    free(samples);
+    wav_free(&wav);
+    return result;
+}
@@ -0,0 +1,320 @@
+/*
+ * stereo_eval.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Checks the stereo front-end (stereo_frontend.c) on a recording. A mono
+ * recording is turned into a stereo one by copying it to both channels,
+ * --noise then adds white noise to the left channel so the SNR based
+ * channel selection has something to choose. The command
+ *  - runs the mono front-end (IMAI_enqueue_block()) on each channel and
+ *    compares its log-mel frames, taken from the feature bus, with the ones
+ *    of the stereo front-end set to that channel,
+ *  - runs IMAI_enqueue_block_stereo() with every mix mode and reports the
+ *    channel selection and the time per block against the mono path.
+ * Needs STEREO_FRONTEND_ENABLE, the default mono build has no stereo
+ * front-end.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "wav.h"
+#include "audio_capture.h"
+#include "audio_ingest.h"
+#include "activity_gate.h"
+#include "stereo_frontend.h"
+#include "feature_bus.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Same constants as ml_task.c and the model front-end */
+#define DIGITAL_BOOST_FACTOR            10.0f
+#define FRAME_HOP                       (320)
+
+/* Largest log-mel difference accepted against the mono front-end */
+#define LOG_MEL_TOLERANCE               (1e-3f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Log-mel frames of one run, filled by the feature bus */
+typedef struct {
+    float *frames;
+    size_t count;
+    size_t capacity;
+} mel_track_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if STEREO_FRONTEND_ENABLE
+static int compare_channels(const float *left, const float *right, size_t frames);
+static int record_run(mel_track_t *track, const float *left, const float *right, size_t frames);
+static void record_frame(const feature_frame_t *frame, void *context);
+static void run_pipeline(const float *left, const float *right, size_t frames);
+static float gaussian(uint32_t *state);
+#endif
+
+
+/*******************************************************************************
+* Function Name: stereo_eval_main
+********************************************************************************
+* Summary:
+*    smartlistener_host stereo-eval <file.wav> [--noise X]
+*
+*    X is the RMS of the noise added to the left channel, relative to full
+*    scale before the digital boost.
+*
+*******************************************************************************/
+int stereo_eval_main(int argc, char *argv[])
+{
+#if !STEREO_FRONTEND_ENABLE
+    (void)argc;
+    (void)argv;
+    fprintf(stderr, "Built without the stereo front-end, rebuild with -DSTEREO_FRONTEND_ENABLE=1 in CFLAGS\n");
+    return 1;
+#else
+    const char *path = NULL;
+    float noise = 0.0f;
+    uint32_t random_state = 0x2545F491u;
+    wav_t wav;
+    int16_t *pcm;
+    float *left;
+    float *right;
+    size_t frames;
+    int ok;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--noise") == 0) && (i + 1 < argc))
+        {
+            noise = atof(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if (path == NULL)
+    {
+        fprintf(stderr, "usage: smartlistener_host stereo-eval <file.wav> [--noise X]\n");
+        return 1;
+    }
+    if (wav_load(path, &wav) != 0)
+    {
+        return 1;
+    }
+
+    /* Interleaved stereo as captured by CYHAL_PDM_PCM_MODE_STEREO */
+    frames = wav.frames - wav.frames % AUDIO_CAPTURE_BLOCK_SIZE;
+    pcm = malloc(2 * frames * sizeof(int16_t));
+    left = malloc(frames * sizeof(float));
+    right = malloc(frames * sizeof(float));
+    if ((pcm == NULL) || (left == NULL) || (right == NULL) || (frames == 0))
+    {
+        fprintf(stderr, "Recording is shorter than one block\n");
+        free(pcm);
+        free(left);
+        free(right);
+        wav_free(&wav);
+        return 1;
+    }
+    for (size_t i = 0; i < frames; i++)
+    {
+        float sample = wav.samples[i * wav.channels] + gaussian(&random_state) * noise * 32768.0f;
+
+        sample = (sample > 32767.0f) ? 32767.0f : ((sample < -32768.0f) ? -32768.0f : sample);
+        pcm[2 * i] = (int16_t) lrintf(sample);
+        pcm[2 * i + 1] = wav.samples[i * wav.channels + (wav.channels > 1)];
+    }
+    for (size_t i = 0; i < frames; i += AUDIO_CAPTURE_BLOCK_SIZE)
+    {
+        audio_ingest_stereo_block(&pcm[2 * i], &left[i], &right[i], AUDIO_CAPTURE_BLOCK_SIZE, DIGITAL_BOOST_FACTOR);
+    }
+
+    printf("Recording:                 %s\n", path);
+    printf("Channels:                  %d (left noise RMS %.4f)\n", wav.channels, noise);
+
+    ok = compare_channels(left, right, frames);
+    run_pipeline(left, right, frames);
+
+    free(pcm);
+    free(left);
+    free(right);
+    wav_free(&wav);
+    return ok ? 0 : 1;
+#endif
+}
+
+#if STEREO_FRONTEND_ENABLE
+
+
+/* Each channel of the stereo front-end against the mono front-end on that channel */
+static int compare_channels(const float *left, const float *right, size_t frames)
+{
+    static const stereo_mix_t mixes[2] = { STEREO_MIX_LEFT, STEREO_MIX_RIGHT };
+    const float *channel[2] = { left, right };
+    size_t capacity = frames / FRAME_HOP + 1;
+    mel_track_t mono = { malloc(capacity * FEATURE_BUS_MEL_BANDS * sizeof(float)), 0, capacity };
+    mel_track_t stereo = { malloc(capacity * FEATURE_BUS_MEL_BANDS * sizeof(float)), 0, capacity };
+    float worst = 0.0f;
+    size_t count = 0;
+
+    if ((mono.frames == NULL) || (stereo.frames == NULL))
+    {
+        fprintf(stderr, "Out of memory\n");
+        free(mono.frames);
+        free(stereo.frames);
+        return 0;
+    }
+
+    for (int c = 0; c < 2; c++)
+    {
+        /* The mono front-end on this channel alone is the reference */
+        stereo_frontend_set_mix(mixes[c]);
+        if ((record_run(&mono, channel[c], NULL, frames) != 0) ||
+            (record_run(&stereo, left, right, frames) != 0) ||
+            (stereo.count != mono.count))
+        {
+            fprintf(stderr, "Stereo front-end made %zu frames, the mono one %zu\n", stereo.count, mono.count);
+            worst = INFINITY;
+            break;
+        }
+        for (size_t k = 0; k < mono.count * FEATURE_BUS_MEL_BANDS; k++)
+        {
+            worst = fmaxf(worst, fabsf(stereo.frames[k] - mono.frames[k]));
+        }
+        count += mono.count;
+    }
+    stereo_frontend_set_mix(STEREO_MIX_BEST_SNR);
+    free(mono.frames);
+    free(stereo.frames);
+
+    printf("Frames:                    %zu (both channels)\n", count);
+    printf("Max log-mel difference:    %.2e against the mono front-end (%s)\n", worst,
+        (worst <= LOG_MEL_TOLERANCE) ? "PASS" : "FAIL");
+    return worst <= LOG_MEL_TOLERANCE;
+}
+
+
+/* Runs the mono (right == NULL) or stereo pipeline and keeps its log-mel frames */
+static int record_run(mel_track_t *track, const float *left, const float *right, size_t frames)
+{
+    int id;
+
+    IMAI_init();
+    activity_gate_init();
+    track->count = 0;
+    id = feature_bus_subscribe(record_frame, track, FEATURE_BUS_LOG_MEL);
+    if (id < 0)
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < frames; i += AUDIO_CAPTURE_BLOCK_SIZE)
+    {
+        if (right == NULL)
+        {
+            IMAI_enqueue_block(&left[i], AUDIO_CAPTURE_BLOCK_SIZE);
+        }
+        else
+        {
+            IMAI_enqueue_block_stereo(&left[i], &right[i], AUDIO_CAPTURE_BLOCK_SIZE);
+        }
+    }
+    feature_bus_unsubscribe(id);
+    return 0;
+}
+
+
+/* Feature bus consumer, appends the log-mel frame to a mel_track_t */
+static void record_frame(const feature_frame_t *frame, void *context)
+{
+    mel_track_t *track = context;
+
+    if (track->count < track->capacity)
+    {
+        memcpy(&track->frames[track->count * FEATURE_BUS_MEL_BANDS], frame->log_mel,
+            FEATURE_BUS_MEL_BANDS * sizeof(float));
+        track->count++;
+    }
+}
+
+
+/* Stereo pipeline with each mix mode, and the mono pipeline for reference */
+static void run_pipeline(const float *left, const float *right, size_t frames)
+{
+    static const char *mix_names[] = { "best SNR", "average", "left", "right" };
+    float scores[IMAI_DATA_OUT_COUNT];
+    stereo_frontend_stats_t stats;
+    uint64_t start;
+    double mono_us;
+    double stereo_us;
+    int outputs;
+
+    IMAI_init();
+    activity_gate_init();
+    outputs = 0;
+    start = host_now_ns();
+    for (size_t i = 0; i < frames; i += AUDIO_CAPTURE_BLOCK_SIZE)
+    {
+        int ready = IMAI_enqueue_block(&left[i], AUDIO_CAPTURE_BLOCK_SIZE);
+        while ((ready-- > 0) && (IMAI_dequeue(scores) == IMAI_RET_SUCCESS))
+        {
+            outputs++;
+        }
+    }
+    mono_us = (host_now_ns() - start) / 1000.0 / (frames / AUDIO_CAPTURE_BLOCK_SIZE);
+    printf("Mono pipeline:             %d outputs, %.1f us/block\n", outputs, mono_us);
+
+    for (int mix = STEREO_MIX_BEST_SNR; mix <= STEREO_MIX_RIGHT; mix++)
+    {
+        IMAI_init();
+        activity_gate_init();
+        stereo_frontend_set_mix((stereo_mix_t) mix);
+        outputs = 0;
+        start = host_now_ns();
+        for (size_t i = 0; i < frames; i += AUDIO_CAPTURE_BLOCK_SIZE)
+        {
+            int ready = IMAI_enqueue_block_stereo(&left[i], &right[i], AUDIO_CAPTURE_BLOCK_SIZE);
+            while ((ready-- > 0) && (IMAI_dequeue(scores) == IMAI_RET_SUCCESS))
+            {
+                outputs++;
+            }
+        }
+        stereo_us = (host_now_ns() - start) / 1000.0 / (frames / AUDIO_CAPTURE_BLOCK_SIZE);
+        stereo_frontend_get_stats(&stats);
+        printf("Stereo, %-9s          %d outputs, %.1f us/block (%.2fx mono), right channel %.1f%% of %lu frames, %lu switches\n",
+            mix_names[mix], outputs, stereo_us, stereo_us / mono_us,
+            100.0 * stats.right_frames / (stats.frames ? stats.frames : 1),
+            (unsigned long)stats.frames, (unsigned long)stats.switches);
+    }
+    stereo_frontend_set_mix(STEREO_MIX_BEST_SNR);
+}
+
+
+/* Approximately normal, unit variance (sum of 4 uniforms) */
+static float gaussian(uint32_t *state)
+{
+    float sum = 0.0f;
+
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t x = *state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        *state = x;
+        sum += (float)x / 4294967296.0f - 0.5f;
+    }
+    return sum * 1.7320508f;
+}
+
+#endif /* STEREO_FRONTEND_ENABLE */
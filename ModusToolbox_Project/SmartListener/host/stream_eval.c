@@ -0,0 +1,264 @@
+/*
+ * stream_eval.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Checks the streaming execution of stream_model.c. The network is run on
+ * the 50-frame windows (stride 6) of the preprocessor track of every
+ * session, once from scratch per window (batch) and once as a stream that
+ * reuses the cached convolution columns. The two must agree exactly, and
+ * both must match the scores DEEPCRAFT Studio exported for the session. The
+ * golden vectors of the model (the network test output) are the scores of
+ * the first session, they are compared as well.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "commands.h"
+#include "sessions.h"
+#include "stream_model.h"
+#include "mtb_ml_model.h"
+#include "models/model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Model input window */
+#define WINDOW_FRAMES                   (50)
+#define WINDOW_STRIDE                   (6)
+#define BANDS                           (SESSION_TRACK_BANDS)
+
+/* The exported scores have 5 decimals */
+#define DEFAULT_MAX_ERROR               (1e-4f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint64_t windows;
+    uint64_t batch_cycles;
+    uint64_t stream_cycles;
+    uint64_t conv_macs;             /* Of the streamed windows */
+    uint64_t conv_batch_macs;
+    uint64_t stream_mismatches;     /* Windows where stream and batch differ */
+    uint64_t top_mismatches;        /* Windows with another top class than the reference */
+    float max_error;                /* Against the exported scores */
+} eval_stats_t;
+
+/* What run_session() needs besides the session */
+typedef struct {
+    const char *track_dir;
+    int verbose;
+    eval_stats_t stats;
+} eval_walk_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context);
+
+
+/*******************************************************************************
+* Function Name: stream_eval_main
+********************************************************************************
+* Summary:
+*    smartlistener_host stream-eval [--data DIR] [--pred DIR] [--track DIR]
+*        [--golden FILE] [--max-error X] [--verbose]
+*
+*******************************************************************************/
+int stream_eval_main(int argc, char *argv[])
+{
+    const char *data_dir = SESSION_DEFAULT_DATA_DIR;
+    const char *pred_dir = SESSION_DEFAULT_PRED_DIR;
+    const char *golden_path = SESSION_DEFAULT_GOLDEN_FILE;
+    float max_error = DEFAULT_MAX_ERROR;
+    eval_walk_t walk = { .track_dir = SESSION_DEFAULT_TRACK_DIR };
+    eval_walk_t golden_walk;
+    const eval_stats_t *golden = &golden_walk.stats;
+    const eval_stats_t *total = &walk.stats;
+    session_t golden_session;
+    int sessions;
+    int pass;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--data") == 0) && (i + 1 < argc))
+        {
+            data_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--pred") == 0) && (i + 1 < argc))
+        {
+            pred_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--track") == 0) && (i + 1 < argc))
+        {
+            walk.track_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--golden") == 0) && (i + 1 < argc))
+        {
+            golden_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--max-error") == 0) && (i + 1 < argc))
+        {
+            max_error = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--verbose") == 0)
+        {
+            walk.verbose = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: smartlistener_host stream-eval [--data DIR] [--pred DIR] [--track DIR] "
+                "[--golden FILE] [--max-error X] [--verbose]\n");
+            return 1;
+        }
+    }
+
+    /* IMAI_init() hands the model flatbuffer to the middleware, or to
+     * stream_model_init() with MODEL_STREAMING_ENABLE */
+    if (IMAI_init() != IMAI_RET_SUCCESS)
+    {
+        return 1;
+    }
+#if !MODEL_STREAMING_ENABLE
+    if ((mtb_ml_model_host_bin() == NULL) ||
+        (stream_model_init(mtb_ml_model_host_bin()->model_bin, mtb_ml_model_host_bin()->model_size, WINDOW_STRIDE) != 0))
+    {
+        fprintf(stderr, "The model is not supported by stream_model.c\n");
+        return 1;
+    }
+#endif
+
+    golden_walk = walk;
+    golden_walk.verbose = 0;
+    if (session_load_golden(golden_path, &golden_session) != 0)
+    {
+        return 1;
+    }
+    run_session(&golden_session, NULL, 0, &golden_walk);
+    session_free(&golden_session);
+    if (golden->windows == 0)
+    {
+        return 1;
+    }
+
+    sessions = session_walk(data_dir, pred_dir, 0, run_session, &walk);
+    IMAI_finalize();
+    if ((sessions < 0) || (total->windows == 0))
+    {
+        fprintf(stderr, "No windows compared\n");
+        return 1;
+    }
+
+    printf("Golden vectors:            %llu windows, max error %.2g\n",
+        (unsigned long long)golden->windows, golden->max_error);
+    printf("Sessions:                  %d, %llu windows, max error %.2g, %llu top class changes\n",
+        sessions, (unsigned long long)total->windows, total->max_error, (unsigned long long)total->top_mismatches);
+    printf("Stream against batch:      %llu of %llu windows differ\n",
+        (unsigned long long)(total->stream_mismatches + golden->stream_mismatches),
+        (unsigned long long)(total->windows + golden->windows));
+    printf("Cycles per window:         batch %8.0f  stream %8.0f  (%.2fx)\n",
+        (double)total->batch_cycles / total->windows, (double)total->stream_cycles / total->windows,
+        (double)total->batch_cycles / total->stream_cycles);
+    printf("CONV_2D MACs per window:   batch %8.0f  stream %8.0f  (%.2fx)\n",
+        (double)total->conv_batch_macs / total->windows, (double)total->conv_macs / total->windows,
+        (double)total->conv_batch_macs / total->conv_macs);
+
+    pass = (golden->max_error <= max_error) && (total->max_error <= max_error) &&
+           (golden->stream_mismatches == 0) && (total->stream_mismatches == 0) && (golden->windows > 0);
+    printf("Result:                    %s (max error %.2g)\n", pass ? "PASS" : "FAIL", max_error);
+    return pass ? 0 : 1;
+}
+
+
+/*******************************************************************************
+* Function Name: run_session
+********************************************************************************
+* Summary:
+*    Runs the windows of one preprocessor track in batch and in streaming
+*    mode and compares them with each other and with the reference scores.
+*    The batch runs come first and are interleaved with nothing, so the
+*    streaming runs have to rebuild their caches from the first window.
+*
+*******************************************************************************/
+static void run_session(const session_t *session, const wav_t *wav, size_t index, void *context)
+{
+    eval_walk_t *walk = context;
+    eval_stats_t *stats = &walk->stats;
+    const float (*reference)[SESSION_NUM_CLASSES] = (const float (*)[SESSION_NUM_CLASSES])session->predictions;
+    float *frames;
+    float (*batch)[SESSION_NUM_CLASSES];
+    size_t frame_count;
+    size_t windows;
+    float session_error = 0.0f;
+    stream_model_stats_t before;
+    stream_model_stats_t after;
+
+    (void) wav;
+    (void) index;
+    frames = session_load_track(walk->track_dir, session->name, &frame_count);
+    if (frames == NULL)
+    {
+        return;
+    }
+    windows = (frame_count >= WINDOW_FRAMES) ? (frame_count - WINDOW_FRAMES) / WINDOW_STRIDE + 1 : 0;
+    windows = (windows < session->windows) ? windows : session->windows;
+    batch = malloc((windows + 1) * sizeof(batch[0]));
+    if (batch == NULL)
+    {
+        free(frames);
+        return;
+    }
+
+    for (size_t w = 0; w < windows; w++)
+    {
+        uint64_t c0 = read_cycles();
+
+        stream_model_reset();
+        stream_model_run(&frames[w * WINDOW_STRIDE * BANDS], 0, batch[w]);
+        stats->batch_cycles += read_cycles() - c0;
+    }
+
+    stream_model_reset();
+    stream_model_get_stats(&before);
+    for (size_t w = 0; w < windows; w++)
+    {
+        float scores[SESSION_NUM_CLASSES];
+        uint64_t c0 = read_cycles();
+
+        stream_model_run(&frames[w * WINDOW_STRIDE * BANDS], (uint32_t)w, scores);
+        stats->stream_cycles += read_cycles() - c0;
+
+        if (memcmp(scores, batch[w], sizeof(scores)) != 0)
+        {
+            stats->stream_mismatches++;
+        }
+        for (int c = 0; c < SESSION_NUM_CLASSES; c++)
+        {
+            float error = fabsf(scores[c] - reference[w][c]);
+            session_error = (error > session_error) ? error : session_error;
+        }
+        if (session_argmax(scores) != session_argmax(reference[w]))
+        {
+            stats->top_mismatches++;
+        }
+        stats->windows++;
+    }
+    stream_model_get_stats(&after);
+    stats->conv_macs += after.conv_macs - before.conv_macs;
+    stats->conv_batch_macs += after.conv_batch_macs - before.conv_batch_macs;
+    stats->max_error = (session_error > stats->max_error) ? session_error : stats->max_error;
+
+    if (walk->verbose)
+    {
+        printf("%-32s %4zu windows, max error %.2g\n", session->name, windows, session_error);
+    }
+
+    free(batch);
+    free(frames);
+}
@@ -0,0 +1,86 @@
+/*
+ * tone.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Sine test signals of the benches (bench-resample, level-cal, clip-eval).
+ * The phase of sample i is that of i / rate seconds, so a tone written in
+ * pieces, or compared from an offset, is the same tone.
+ */
+
+#include "tone.h"
+
+#include <math.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+
+/*******************************************************************************
+* Function Name: tone_fill
+********************************************************************************
+* Summary:
+*    Writes a sine to pcm[first] ... pcm[first + count - 1], rounded and
+*    clamped to int16.
+*
+* Parameters:
+*    pcm            Samples
+*    first          First sample written
+*    count          Number of samples written
+*    hz             Tone frequency
+*    amplitude      Peak, 32768 is full scale
+*    rate           Sample rate in Hz
+*
+*******************************************************************************/
+void tone_fill(int16_t *pcm, size_t first, size_t count, double hz, double amplitude, double rate)
+{
+    for (size_t i = first; i < first + count; i++)
+    {
+        double sample = amplitude * sin(2.0 * M_PI * hz * (double)i / rate);
+
+        sample = (sample > 32767.0) ? 32767.0 : sample;
+        sample = (sample < -32768.0) ? -32768.0 : sample;
+        pcm[i] = (int16_t)lrint(sample);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: tone_snr_db
+********************************************************************************
+* Summary:
+*    SNR of pcm[first] ... pcm[first + count - 1] against the ideal sine
+*    tone_fill() rounds.
+*
+* Parameters:
+*    pcm            Samples
+*    first          First sample compared
+*    count          Number of samples compared
+*    hz             Tone frequency
+*    amplitude      Peak, 32768 is full scale
+*    rate           Sample rate in Hz
+*
+* Return:
+*    SNR in dB
+*
+*******************************************************************************/
+double tone_snr_db(const int16_t *pcm, size_t first, size_t count, double hz, double amplitude, double rate)
+{
+    double signal = 0.0;
+    double error = 0.0;
+
+    for (size_t i = first; i < first + count; i++)
+    {
+        double ideal = amplitude * sin(2.0 * M_PI * hz * (double)i / rate);
+
+        signal += ideal * ideal;
+        error += (pcm[i] - ideal) * (pcm[i] - ideal);
+    }
+    return 10.0 * log10(signal / (error + 1e-9));
+}
@@ -0,0 +1,22 @@
+/*
+ * tone.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef HOST_TONE_H_
+#define HOST_TONE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void tone_fill(int16_t *pcm, size_t first, size_t count, double hz, double amplitude, double rate);
+double tone_snr_db(const int16_t *pcm, size_t first, size_t count, double hz, double amplitude, double rate);
+
+
+#endif /* HOST_TONE_H_ */
@@ -0,0 +1,151 @@
+/*
+ * wav.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Minimal RIFF/WAVE reader for the 16-bit PCM recordings in
+ * ML_Model/Data_preparation.
+ */
+
+#include "wav.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define WAV_FORMAT_PCM                  1
+#define WAV_FORMAT_EXTENSIBLE           0xFFFE
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t read_u32(const uint8_t *p);
+static uint16_t read_u16(const uint8_t *p);
+
+
+/*******************************************************************************
+* Function Name: wav_load
+********************************************************************************
+* Summary:
+*    Loads a 16-bit PCM WAV file into memory.
+*
+* Parameters:
+*    path           File to load
+*    wav            Filled with the format and the samples on success
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int wav_load(const char *path, wav_t *wav)
+{
+    FILE *file;
+    uint8_t header[12];
+    uint8_t chunk[8];
+    uint8_t fmt[16];
+    uint32_t chunk_size;
+    int have_fmt = 0;
+    int bits = 0;
+    int format = 0;
+
+    memset(wav, 0, sizeof(*wav));
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open '%s'\n", path);
+        return -1;
+    }
+
+    if ((fread(header, 1, sizeof(header), file) != sizeof(header)) ||
+        (memcmp(header, "RIFF", 4) != 0) || (memcmp(header + 8, "WAVE", 4) != 0))
+    {
+        fprintf(stderr, "'%s' is not a WAV file\n", path);
+        fclose(file);
+        return -1;
+    }
+
+    while (fread(chunk, 1, sizeof(chunk), file) == sizeof(chunk))
+    {
+        chunk_size = read_u32(chunk + 4);
+
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            if ((chunk_size < sizeof(fmt)) || (fread(fmt, 1, sizeof(fmt), file) != sizeof(fmt)))
+            {
+                break;
+            }
+            format = read_u16(fmt);
+            wav->channels = read_u16(fmt + 2);
+            wav->sample_rate = read_u32(fmt + 4);
+            bits = read_u16(fmt + 14);
+            have_fmt = 1;
+            fseek(file, chunk_size - sizeof(fmt) + (chunk_size & 1), SEEK_CUR);
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if (!have_fmt || ((format != WAV_FORMAT_PCM) && (format != WAV_FORMAT_EXTENSIBLE)) ||
+                (bits != 16) || (wav->channels < 1))
+            {
+                fprintf(stderr, "'%s': only 16-bit PCM is supported\n", path);
+                break;
+            }
+
+            wav->frames = chunk_size / (2 * wav->channels);
+            wav->samples = malloc(wav->frames * wav->channels * sizeof(int16_t) + 1);
+            if (wav->samples == NULL)
+            {
+                break;
+            }
+            /* Tolerate truncated recordings */
+            wav->frames = fread(wav->samples, 2 * wav->channels, wav->frames, file);
+            fclose(file);
+            return 0;
+        }
+        else
+        {
+            fseek(file, chunk_size + (chunk_size & 1), SEEK_CUR);
+        }
+    }
+
+    fclose(file);
+    wav_free(wav);
+    return -1;
+}
+
+
+/*******************************************************************************
+* Function Name: wav_free
+********************************************************************************
+* Summary:
+*    Releases the samples loaded by wav_load().
+*
+* Parameters:
+*    wav            Recording to release
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void wav_free(wav_t *wav)
+{
+    free(wav->samples);
+    memset(wav, 0, sizeof(*wav));
+}
+
+
+static uint32_t read_u32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+static uint16_t read_u16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
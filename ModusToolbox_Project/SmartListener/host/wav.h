@@ -0,0 +1,33 @@
+/*
+ * wav.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef HOST_WAV_H_
+#define HOST_WAV_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* 16-bit PCM recording loaded in memory */
+typedef struct {
+    int sample_rate;
+    int channels;
+    size_t frames;                  /* Samples per channel */
+    int16_t *samples;               /* Interleaved samples */
+} wav_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int wav_load(const char *path, wav_t *wav);
+void wav_free(wav_t *wav);
+
+
+#endif /* HOST_WAV_H_ */
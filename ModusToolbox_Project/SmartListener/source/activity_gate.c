@@ -0,0 +1,221 @@
+/*
+ * activity_gate.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Skips model invocations while the room is quiet. Every log-mel frame is
+ * compared against adaptive floors of its mean energy and of its spectral
+ * flux (positive change against the previous frame). A frame above either
+ * floor opens the gate for a hang-over period; while the gate is closed the
+ * model window is answered with a synthetic "unlabelled" score vector.
+ *
+ * The floors describe the room, not the model state, so IMAI_init() does
+ * not reset them.
+ *
+ * The gate is off by default. On the recorded sessions it cuts the model
+ * invocations only 1.28x without losing a confident event window (see
+ * gate-eval), so it is enabled with activity_gate_set_config() where that
+ * saving is worth it. While it is off the frames are not classified at all.
+ */
+
+#include "activity_gate.h"
+
+#include <string.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Maximum number of mel bands per frame */
+#define ACTIVITY_GATE_MAX_BANDS             (64)
+
+/* Per-frame smoothing factors of the floors. The floors fall quickly to the
+ * quietest level seen and rise slowly (about 6 s time constant at 50 frames
+ * per second), so a long event cannot pull the floor up to itself. */
+#define FLOOR_FALL_RATE                     (0.2f)
+#define FLOOR_RISE_RATE                     (0.003f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static activity_gate_config_t gate_config =
+{
+    .enabled          = 0,
+    .energy_threshold = ACTIVITY_GATE_ENERGY_THRESHOLD,
+    .flux_threshold   = ACTIVITY_GATE_FLUX_THRESHOLD,
+    .hangover_frames  = ACTIVITY_GATE_HANGOVER_FRAMES,
+};
+
+static activity_gate_stats_t gate_stats;
+
+static float previous_frame[ACTIVITY_GATE_MAX_BANDS];
+static float energy_floor;
+static float flux_floor;
+static uint32_t hangover;
+static uint32_t warmup = ACTIVITY_GATE_WARMUP_FRAMES;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static inline float track_floor(float floor, float value);
+
+
+/*******************************************************************************
+* Function Name: activity_gate_init
+********************************************************************************
+* Summary:
+*    Resets the floors and counters. The configuration is kept.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void activity_gate_init(void)
+{
+    memset(&gate_stats, 0, sizeof(gate_stats));
+    memset(previous_frame, 0, sizeof(previous_frame));
+    energy_floor = 0.0f;
+    flux_floor = 0.0f;
+    hangover = 0;
+    warmup = ACTIVITY_GATE_WARMUP_FRAMES;
+}
+
+
+void activity_gate_get_config(activity_gate_config_t *config)
+{
+    *config = gate_config;
+}
+
+
+void activity_gate_set_config(const activity_gate_config_t *config)
+{
+    /* The floors did not follow the room while the gate was off */
+    if (config->enabled && !gate_config.enabled)
+    {
+        activity_gate_init();
+    }
+    gate_config = *config;
+}
+
+
+void activity_gate_get_stats(activity_gate_stats_t *stats)
+{
+    *stats = gate_stats;
+}
+
+
+/*******************************************************************************
+* Function Name: activity_gate_update
+********************************************************************************
+* Summary:
+*    Classifies one log-mel frame as active or quiet and updates the floors
+*    and the hang-over counter. Does nothing while the gate is disabled.
+*
+* Parameters:
+*    log_mel        Log-mel frame
+*    count          Number of mel bands, at most ACTIVITY_GATE_MAX_BANDS
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void activity_gate_update(const float *log_mel, int count)
+{
+    float energy = 0.0f;
+    float flux = 0.0f;
+    int active;
+
+    if (!gate_config.enabled)
+    {
+        return;
+    }
+    if (count > ACTIVITY_GATE_MAX_BANDS)
+    {
+        count = ACTIVITY_GATE_MAX_BANDS;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        float delta = log_mel[i] - previous_frame[i];
+        energy += log_mel[i];
+        if (delta > 0.0f)
+        {
+            flux += delta;
+        }
+        previous_frame[i] = log_mel[i];
+    }
+    energy /= count;
+    flux /= count;
+
+    if (gate_stats.frames == 0)
+    {
+        /* First frame: start the floors at the current level, the flux
+         * against the zeroed previous frame is meaningless */
+        energy_floor = energy;
+        flux = 0.0f;
+    }
+
+    active = (energy > energy_floor + gate_config.energy_threshold) ||
+             (flux > flux_floor + gate_config.flux_threshold);
+
+    energy_floor = track_floor(energy_floor, energy);
+    flux_floor = track_floor(flux_floor, flux);
+
+    gate_stats.frames++;
+    if (active)
+    {
+        gate_stats.active_frames++;
+        hangover = gate_config.hangover_frames;
+    }
+    else if (hangover > 0)
+    {
+        hangover--;
+    }
+    if (warmup > 0)
+    {
+        warmup--;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: activity_gate_skip_window
+********************************************************************************
+* Summary:
+*    Decides whether the model has to run on the current window. If not, the
+*    scores are set to a confident ACTIVITY_GATE_IDLE_LABEL result.
+*
+* Parameters:
+*    scores         Model output, written only when the window is skipped
+*    count          Number of scores
+*
+* Return:
+*    1 if the window was skipped, 0 if the model has to run
+*
+*******************************************************************************/
+int activity_gate_skip_window(float *scores, int count)
+{
+    gate_stats.windows++;
+
+    if (!gate_config.enabled || (warmup > 0) || (hangover > 0))
+    {
+        return 0;
+    }
+
+    memset(scores, 0, count * sizeof(float));
+    scores[ACTIVITY_GATE_IDLE_LABEL] = 1.0f;
+    gate_stats.skipped_windows++;
+    return 1;
+}
+
+
+/* Asymmetric exponential tracker, follows decreases quickly and increases slowly */
+static inline float track_floor(float floor, float value)
+{
+    float rate = (value < floor) ? FLOOR_FALL_RATE : FLOOR_RISE_RATE;
+    return floor + rate * (value - floor);
+}
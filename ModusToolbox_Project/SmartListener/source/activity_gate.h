@@ -0,0 +1,66 @@
+/*
+ * activity_gate.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_ACTIVITY_GATE_H_
+#define SOURCE_ACTIVITY_GATE_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Energy above the adaptive noise floor that marks a frame as active.
+ * Natural log of the mel magnitude, averaged over the mel bands. */
+#define ACTIVITY_GATE_ENERGY_THRESHOLD      (1.0f)
+
+/* Spectral flux above its adaptive floor that marks a frame as active */
+#define ACTIVITY_GATE_FLUX_THRESHOLD        (0.5f)
+
+/* Frames the gate stays open after the last active frame. One model window
+ * (50 frames) is not enough: gate-eval lost confident dog windows whose
+ * bark started quietly before the active frame. With 75 it loses none. */
+#define ACTIVITY_GATE_HANGOVER_FRAMES       (75)
+
+/* Frames after a reset during which the gate stays open while the noise
+ * floor settles */
+#define ACTIVITY_GATE_WARMUP_FRAMES         (25)
+
+/* Score vector index reported for windows skipped by the gate */
+#define ACTIVITY_GATE_IDLE_LABEL            (0)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    int enabled;                    /* 0 runs the model on every window, the default */
+    float energy_threshold;         /* See ACTIVITY_GATE_ENERGY_THRESHOLD */
+    float flux_threshold;           /* See ACTIVITY_GATE_FLUX_THRESHOLD */
+    uint32_t hangover_frames;       /* See ACTIVITY_GATE_HANGOVER_FRAMES */
+} activity_gate_config_t;
+
+typedef struct {
+    uint32_t frames;                /* Feature frames seen */
+    uint32_t active_frames;         /* Frames above the noise floor */
+    uint32_t windows;               /* Model windows */
+    uint32_t skipped_windows;       /* Windows answered without running the model */
+} activity_gate_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void activity_gate_init(void);
+void activity_gate_get_config(activity_gate_config_t *config);
+void activity_gate_set_config(const activity_gate_config_t *config);
+void activity_gate_get_stats(activity_gate_stats_t *stats);
+
+/* Called by the model for every log-mel frame and every model window */
+void activity_gate_update(const float *log_mel, int count);
+int activity_gate_skip_window(float *scores, int count);
+
+
+#endif /* SOURCE_ACTIVITY_GATE_H_ */
@@ -0,0 +1,202 @@
+/*
+ * adpcm.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * IMA-ADPCM (DVI4) codec as used in WAV files: 4-bit codes, 89 entry step
+ * table, nibbles packed low first. The encoder mirrors the decoder exactly,
+ * so a stream decoded from a known state reproduces the encoder's
+ * predictor sample by sample.
+ */
+
+#include "adpcm.h"
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const int8_t index_table[16] =
+{
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const int16_t step_table[89] =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static inline uint8_t encode_sample(int32_t *predictor, int32_t *index, int32_t sample);
+static inline int32_t decode_sample(int32_t *predictor, int32_t *index, uint8_t code);
+
+
+/*******************************************************************************
+* Function Name: adpcm_init
+********************************************************************************
+* Summary:
+*    Resets a coder to silence and the smallest step.
+*
+* Parameters:
+*    state          Coder state to reset
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void adpcm_init(adpcm_state_t *state)
+{
+    state->predictor = 0;
+    state->index = 0;
+}
+
+
+/*******************************************************************************
+* Function Name: adpcm_encode
+********************************************************************************
+* Summary:
+*    Encodes count samples to count / 2 bytes. An odd count leaves the high
+*    nibble of the last byte zero.
+*
+* Parameters:
+*    state          Encoder state, updated
+*    src            Input samples
+*    count          Number of samples to encode
+*    stride         Distance between two input samples
+*    dst            Output, (count + 1) / 2 bytes
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void adpcm_encode(adpcm_state_t *state, const int16_t *src, size_t count, size_t stride, uint8_t *dst)
+{
+    int32_t predictor = state->predictor;
+    int32_t index = state->index;
+    size_t i;
+
+    for (i = 0; i + 1 < count; i += 2)
+    {
+        uint8_t low = encode_sample(&predictor, &index, src[i * stride]);
+        uint8_t high = encode_sample(&predictor, &index, src[(i + 1) * stride]);
+        *dst++ = (uint8_t)(low | (high << 4));
+    }
+    if (i < count)
+    {
+        *dst = encode_sample(&predictor, &index, src[i * stride]);
+    }
+
+    state->predictor = (int16_t) predictor;
+    state->index = (uint8_t) index;
+}
+
+
+/*******************************************************************************
+* Function Name: adpcm_decode
+********************************************************************************
+* Summary:
+*    Decodes count samples from (count + 1) / 2 bytes.
+*
+* Parameters:
+*    state          Decoder state, updated
+*    src            Packed codes
+*    count          Number of samples to decode
+*    dst            Output samples
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void adpcm_decode(adpcm_state_t *state, const uint8_t *src, size_t count, int16_t *dst)
+{
+    int32_t predictor = state->predictor;
+    int32_t index = state->index;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint8_t code = (i & 1) ? (src[i >> 1] >> 4) : (src[i >> 1] & 0x0F);
+        dst[i] = (int16_t) decode_sample(&predictor, &index, code);
+    }
+
+    state->predictor = (int16_t) predictor;
+    state->index = (uint8_t) index;
+}
+
+
+/* Quantizes the prediction error to a sign and three magnitude bits and
+ * updates the predictor with the value the decoder will reconstruct */
+static inline uint8_t encode_sample(int32_t *predictor, int32_t *index, int32_t sample)
+{
+    int32_t step = step_table[*index];
+    int32_t diff = sample - *predictor;
+    int32_t delta = step >> 3;
+    uint8_t code = 0;
+
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step)
+    {
+        code |= 4;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 2;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 1;
+        delta += step;
+    }
+
+    *predictor += (code & 8) ? -delta : delta;
+    *predictor = (*predictor > 32767) ? 32767 : ((*predictor < -32768) ? -32768 : *predictor);
+    *index += index_table[code];
+    *index = (*index < 0) ? 0 : ((*index > 88) ? 88 : *index);
+    return code;
+}
+
+
+static inline int32_t decode_sample(int32_t *predictor, int32_t *index, uint8_t code)
+{
+    int32_t step = step_table[*index];
+    int32_t delta = step >> 3;
+
+    if (code & 4)
+    {
+        delta += step;
+    }
+    if (code & 2)
+    {
+        delta += step >> 1;
+    }
+    if (code & 1)
+    {
+        delta += step >> 2;
+    }
+
+    *predictor += (code & 8) ? -delta : delta;
+    *predictor = (*predictor > 32767) ? 32767 : ((*predictor < -32768) ? -32768 : *predictor);
+    *index += index_table[code];
+    *index = (*index < 0) ? 0 : ((*index > 88) ? 88 : *index);
+    return *predictor;
+}
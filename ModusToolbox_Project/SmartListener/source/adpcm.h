@@ -0,0 +1,35 @@
+/*
+ * adpcm.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_ADPCM_H_
+#define SOURCE_ADPCM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* IMA-ADPCM coder state: the last reconstructed sample and the step index */
+typedef struct {
+    int16_t predictor;
+    uint8_t index;
+} adpcm_state_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void adpcm_init(adpcm_state_t *state);
+
+/* 4 bits per sample, two samples per byte, first sample in the low nibble.
+ * stride is the distance between two input samples, 1 for mono. */
+void adpcm_encode(adpcm_state_t *state, const int16_t *src, size_t count, size_t stride, uint8_t *dst);
+void adpcm_decode(adpcm_state_t *state, const uint8_t *src, size_t count, int16_t *dst);
+
+
+#endif /* SOURCE_ADPCM_H_ */
@@ -0,0 +1,256 @@
+/*
+ * audio_capture.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Ping-pong audio capture. The PDM/PCM DMA fills one block while the
+ * consumer processes the other one, so a long model invocation no longer
+ * stalls the microphone. The platform specific parts (PDM/PCM setup, the
+ * completion interrupt and the wakeup of the consumer) live in the port,
+ * see audio_capture_pdm.c.
+ */
+
+#include "audio_capture.h"
+
+#include <string.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define NO_BLOCK                        (-1)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static int16_t capture_blocks[AUDIO_CAPTURE_NUM_BLOCKS][AUDIO_CAPTURE_BLOCK_SAMPLES] __attribute__((aligned(4)));
+
+/* Block currently filled by the port */
+static volatile int fill_index = NO_BLOCK;
+/* Block filled and waiting for the consumer */
+static volatile int ready_index = NO_BLOCK;
+/* Block currently owned by the consumer */
+static volatile int held_index = NO_BLOCK;
+/* Set when the port failed to restart a read */
+static volatile int capture_error = 0;
+
+static audio_capture_stats_t capture_stats;
+
+
+/*******************************************************************************
+* Function Name: audio_capture_init
+********************************************************************************
+* Summary:
+*    Resets the capture state and initializes the platform port.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS or AUDIO_CAPTURE_ERROR
+*
+*******************************************************************************/
+int audio_capture_init(void)
+{
+    fill_index = NO_BLOCK;
+    ready_index = NO_BLOCK;
+    held_index = NO_BLOCK;
+    capture_error = 0;
+    memset(&capture_stats, 0, sizeof(capture_stats));
+
+    return audio_capture_port_init();
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_start
+********************************************************************************
+* Summary:
+*    Starts the port and queues the first asynchronous read.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS or AUDIO_CAPTURE_ERROR
+*
+*******************************************************************************/
+int audio_capture_start(void)
+{
+    if (audio_capture_port_start() != AUDIO_CAPTURE_SUCCESS)
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+
+    fill_index = 0;
+    return audio_capture_port_read_async(capture_blocks[0], AUDIO_CAPTURE_BLOCK_SAMPLES);
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_on_block_complete
+********************************************************************************
+* Summary:
+*    Called by the port (from interrupt context on the device) when the block
+*    being filled is complete. Hands the block to the consumer and restarts
+*    the read into the other half. If the consumer still owns the other half
+*    the new block is dropped and counted as an overrun.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void audio_capture_on_block_complete(void)
+{
+    uint32_t state;
+    int completed;
+    int next;
+
+    state = audio_capture_port_lock();
+    completed = fill_index;
+    next = (completed + 1) % AUDIO_CAPTURE_NUM_BLOCKS;
+    capture_stats.blocks_captured++;
+
+    if ((next == ready_index) || (next == held_index))
+    {
+        /* Consumer is late, refill the same block */
+        capture_stats.overruns++;
+        next = completed;
+    }
+    else
+    {
+        ready_index = completed;
+    }
+    fill_index = next;
+    audio_capture_port_unlock(state);
+
+    if (audio_capture_port_read_async(capture_blocks[next], AUDIO_CAPTURE_BLOCK_SAMPLES) != AUDIO_CAPTURE_SUCCESS)
+    {
+        capture_error = 1;
+    }
+
+    if (next != completed)
+    {
+        audio_capture_port_notify();
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_read
+********************************************************************************
+* Summary:
+*    Waits for the next captured block and takes ownership of it. The block
+*    stays valid until audio_capture_release() is called.
+*
+* Parameters:
+*    block          Set to the captured AUDIO_CAPTURE_BLOCK_SAMPLES samples
+*    timeout_ms     Maximum time to wait or AUDIO_CAPTURE_WAIT_FOREVER
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS, AUDIO_CAPTURE_TIMEOUT, AUDIO_CAPTURE_ERROR or
+*    AUDIO_CAPTURE_STREAMEND (host replay only)
+*
+*******************************************************************************/
+int audio_capture_read(const int16_t **block, uint32_t timeout_ms)
+{
+    uint32_t state;
+    int result;
+
+    while (1)
+    {
+        if (capture_error)
+        {
+            return AUDIO_CAPTURE_ERROR;
+        }
+
+        state = audio_capture_port_lock();
+        if (ready_index != NO_BLOCK)
+        {
+            held_index = ready_index;
+            ready_index = NO_BLOCK;
+            capture_stats.blocks_delivered++;
+            audio_capture_port_unlock(state);
+
+            *block = capture_blocks[held_index];
+            return AUDIO_CAPTURE_SUCCESS;
+        }
+        audio_capture_port_unlock(state);
+
+        result = audio_capture_port_wait(timeout_ms);
+        if (result != AUDIO_CAPTURE_SUCCESS)
+        {
+            return result;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_release
+********************************************************************************
+* Summary:
+*    Returns the block obtained by audio_capture_read() to the capture engine.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void audio_capture_release(void)
+{
+    uint32_t state = audio_capture_port_lock();
+    held_index = NO_BLOCK;
+    audio_capture_port_unlock(state);
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_get_stats
+********************************************************************************
+* Summary:
+*    Takes a consistent snapshot of the capture counters.
+*
+* Parameters:
+*    stats          Destination of the snapshot
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void audio_capture_get_stats(audio_capture_stats_t *stats)
+{
+    uint32_t state = audio_capture_port_lock();
+    *stats = capture_stats;
+    audio_capture_port_unlock(state);
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_utilization
+********************************************************************************
+* Summary:
+*    Fraction of the captured audio that reached the consumer. 1.0 means no
+*    samples were dropped.
+*
+* Parameters:
+*    stats          Counters from audio_capture_get_stats()
+*
+* Return:
+*    Utilization in the range [0,1]
+*
+*******************************************************************************/
+float audio_capture_utilization(const audio_capture_stats_t *stats)
+{
+    if (stats->blocks_captured == 0)
+    {
+        return 1.0f;
+    }
+    return (stats->blocks_captured - stats->overruns) / (float)stats->blocks_captured;
+}
@@ -0,0 +1,81 @@
+/*
+ * audio_capture.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_AUDIO_CAPTURE_H_
+#define SOURCE_AUDIO_CAPTURE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Desired sample rate. Typical values: 8/16/22.05/32/44.1/48 kHz */
+#define SAMPLE_RATE_HZ                  16000
+
+/* Specifies the dynamic range in bits.
+ * PCM word length, see the A/D specific documentation for valid ranges. */
+#define AUIDO_BITS_PER_SAMPLE           16
+
+/* Number of channels. 1 captures the left microphone, 2 captures both
+ * microphones interleaved (left, right) for the stereo front-end. */
+#define AUDIO_CAPTURE_CHANNELS          1
+
+/* Number of frames in each capture block (one half of the ping-pong buffer).
+ * A block holds AUDIO_CAPTURE_BLOCK_SIZE * AUDIO_CAPTURE_CHANNELS samples. */
+#define AUDIO_CAPTURE_BLOCK_SIZE        512
+#define AUDIO_CAPTURE_BLOCK_SAMPLES     (AUDIO_CAPTURE_BLOCK_SIZE * AUDIO_CAPTURE_CHANNELS)
+
+/* Number of capture blocks. One is filled by the PDM/PCM DMA while the other
+ * is processed by the consumer. */
+#define AUDIO_CAPTURE_NUM_BLOCKS        2
+
+/* Pass as timeout_ms to audio_capture_read() to wait for the next block forever */
+#define AUDIO_CAPTURE_WAIT_FOREVER      (0xFFFFFFFFu)
+
+/* Return codes */
+#define AUDIO_CAPTURE_SUCCESS           (0)
+#define AUDIO_CAPTURE_TIMEOUT           (-1)
+#define AUDIO_CAPTURE_ERROR             (-2)
+#define AUDIO_CAPTURE_STREAMEND         (-3)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Capture counters, see audio_capture_get_stats() */
+typedef struct {
+    uint32_t blocks_captured;       /* Blocks completed by the PDM/PCM DMA */
+    uint32_t blocks_delivered;      /* Blocks handed to the consumer */
+    uint32_t overruns;              /* Blocks dropped because both halves were busy */
+} audio_capture_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int audio_capture_init(void);
+int audio_capture_start(void);
+int audio_capture_read(const int16_t **block, uint32_t timeout_ms);
+void audio_capture_release(void);
+void audio_capture_get_stats(audio_capture_stats_t *stats);
+float audio_capture_utilization(const audio_capture_stats_t *stats);
+
+/* Completion handler, called by the port when a block has been filled */
+void audio_capture_on_block_complete(void);
+
+/* Platform port. Implemented by audio_capture_pdm.c on the device and by
+ * the WAV replay stand-in in the host build. */
+int audio_capture_port_init(void);
+int audio_capture_port_start(void);
+int audio_capture_port_read_async(int16_t *block, size_t count);
+void audio_capture_port_notify(void);
+int audio_capture_port_wait(uint32_t timeout_ms);
+uint32_t audio_capture_port_lock(void);
+void audio_capture_port_unlock(uint32_t state);
+
+
+#endif /* SOURCE_AUDIO_CAPTURE_H_ */
@@ -0,0 +1,344 @@
+/*
+ * audio_capture_pdm.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * PDM/PCM port of the ping-pong capture engine. Blocks are transferred by
+ * DMA with cyhal_pdm_pcm_read_async() and the ASYNC_COMPLETE event hands
+ * them over to audio_capture.c.
+ */
+
+#include "audio_capture.h"
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Audio Subsystem Clock. Typical values depends on the desire sample rate:
+- 8/16/48kHz    : 24.576 MHz
+- 22.05/44.1kHz : 22.579 MHz */
+#if (SAMPLE_RATE_HZ % 8000) == 0
+#define AUDIO_SYS_CLOCK_HZ          24576000
+#else
+#define AUDIO_SYS_CLOCK_HZ          22579200
+#endif
+
+/* Decimation Rate of the PDM/PCM block. Typical value is 64 */
+#define DECIMATION_RATE             64
+
+/* Microphone sensitivity
+ * PGA in 0.5 dB increment, for example a value of 5 would mean +2.5 dB. */
+#define MICROPHONE_GAIN             20
+
+/* PDM/PCM Pins */
+#define PDM_DATA                    P10_5
+#define PDM_CLK                     P10_4
+
+/* Interrupt priority of the PDM/PCM async complete event */
+#define PDM_PCM_INTR_PRIORITY       (2)
+
+/* Return AUDIO_CAPTURE_ERROR from the calling function if a HAL call failed */
+#define CHECK_RESULT(result)                                \
+                     do                                     \
+                     {                                      \
+                         if ((result) != CY_RSLT_SUCCESS)   \
+                         {                                  \
+                             return AUDIO_CAPTURE_ERROR;    \
+                         }                                  \
+                     } while(0)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static cyhal_pdm_pcm_t pdm_pcm;
+
+/* Given by the completion interrupt, taken by the consumer task */
+static SemaphoreHandle_t block_ready_semaphore;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void pdm_pcm_event_handler(void *callback_arg, cyhal_pdm_pcm_event_t event);
+static void pdm_frequency_fix();
+
+
+/*******************************************************************************
+* Function Name: audio_capture_port_init
+********************************************************************************
+* Summary:
+*    This function initializes and configures the PDM mic and the DMA used by
+*    the asynchronous reads.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS or AUDIO_CAPTURE_ERROR
+*
+*******************************************************************************/
+int audio_capture_port_init(void)
+{
+    cy_rslt_t result;
+    cyhal_clock_t audio_clock;
+    cyhal_clock_t pll_clock;
+
+    const cyhal_pdm_pcm_cfg_t pdm_pcm_cfg =
+    {
+        .sample_rate     = SAMPLE_RATE_HZ,              /* Sample rate in Hz */
+        .decimation_rate = DECIMATION_RATE,             /* Decimation Rate of the PDM/PCM block */
+#if AUDIO_CAPTURE_CHANNELS == 2
+        .mode            = CYHAL_PDM_PCM_MODE_STEREO,   /* Both microphones, interleaved */
+#else
+        .mode            = CYHAL_PDM_PCM_MODE_LEFT,     /* Microphone to use (Channel) */
+#endif
+        .word_length     = AUIDO_BITS_PER_SAMPLE,       /* Bits per sample */
+        .left_gain       = MICROPHONE_GAIN,             /* Left channel gain dB ("volume") */
+        .right_gain      = MICROPHONE_GAIN,             /* Right channel gain dB ("volume") */
+    };
+
+    block_ready_semaphore = xSemaphoreCreateBinary();
+    if (block_ready_semaphore == NULL)
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+
+    /* Initialize the PLL */
+    result = cyhal_clock_reserve(&pll_clock, &CYHAL_CLOCK_PLL[1]);
+    CHECK_RESULT(result);
+    result = cyhal_clock_set_frequency(&pll_clock, AUDIO_SYS_CLOCK_HZ, NULL);
+    CHECK_RESULT(result);
+    result = cyhal_clock_set_enabled(&pll_clock, true, true);
+    CHECK_RESULT(result);
+
+    /* Initialize the audio subsystem clock (CLK_HF[1])
+     * The CLK_HF[1] is the root clock for the I2S and PDM/PCM blocks */
+    result = cyhal_clock_reserve(&audio_clock, &CYHAL_CLOCK_HF[1]);
+    CHECK_RESULT(result);
+
+    /* Source the audio subsystem clock from PLL */
+    result = cyhal_clock_set_source(&audio_clock, &pll_clock);
+    CHECK_RESULT(result);
+    result = cyhal_clock_set_enabled(&audio_clock, true, true);
+    CHECK_RESULT(result);
+
+    /* Initialize the pulse-density modulation to pulse-code modulation (PDM/PCM) converter. */
+    result = cyhal_pdm_pcm_init(&pdm_pcm, PDM_DATA, PDM_CLK, &audio_clock, &pdm_pcm_cfg);
+    CHECK_RESULT(result);
+
+    /* Move the samples with DMA and get notified when a block is complete */
+    result = cyhal_pdm_pcm_set_async_mode(&pdm_pcm, CYHAL_ASYNC_DMA, CYHAL_DMA_PRIORITY_DEFAULT);
+    CHECK_RESULT(result);
+    cyhal_pdm_pcm_register_callback(&pdm_pcm, pdm_pcm_event_handler, NULL);
+    cyhal_pdm_pcm_enable_event(&pdm_pcm, CYHAL_PDM_PCM_ASYNC_COMPLETE, PDM_PCM_INTR_PRIORITY, true);
+
+    /* Clear PDM/PCM RX FIFO */
+    result = cyhal_pdm_pcm_clear(&pdm_pcm);
+    CHECK_RESULT(result);
+
+    /* The dividers cyhal_pdm_pcm_init() picks put the PDM clock outside the
+     * range of the microphone. Rewrite them for AUDIO_SYS_CLOCK_HZ / 16
+     * (1.536 MHz at 24.576 MHz) with a sinc decimation rate that keeps
+     * SAMPLE_RATE_HZ. */
+    pdm_frequency_fix();
+
+    return AUDIO_CAPTURE_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_port_start
+********************************************************************************
+* Summary:
+*    Starts the PDM/PCM converter.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS or AUDIO_CAPTURE_ERROR
+*
+*******************************************************************************/
+int audio_capture_port_start(void)
+{
+    if (cyhal_pdm_pcm_start(&pdm_pcm) != CY_RSLT_SUCCESS)
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+    return AUDIO_CAPTURE_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_port_read_async
+********************************************************************************
+* Summary:
+*    Queues a DMA transfer of count samples into block. Completion is
+*    signalled by the CYHAL_PDM_PCM_ASYNC_COMPLETE event.
+*
+* Parameters:
+*    block          Destination of the samples
+*    count          Number of samples to read, all channels
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS or AUDIO_CAPTURE_ERROR
+*
+*******************************************************************************/
+int audio_capture_port_read_async(int16_t *block, size_t count)
+{
+    if (cyhal_pdm_pcm_read_async(&pdm_pcm, (void *) block, count) != CY_RSLT_SUCCESS)
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+    return AUDIO_CAPTURE_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_port_notify
+********************************************************************************
+* Summary:
+*    Wakes up the consumer task. Called from the PDM/PCM interrupt.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void audio_capture_port_notify(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xSemaphoreGiveFromISR(block_ready_semaphore, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_port_wait
+********************************************************************************
+* Summary:
+*    Blocks the calling task until the next block is complete.
+*
+* Parameters:
+*    timeout_ms     Maximum time to wait or AUDIO_CAPTURE_WAIT_FOREVER
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS or AUDIO_CAPTURE_TIMEOUT
+*
+*******************************************************************************/
+int audio_capture_port_wait(uint32_t timeout_ms)
+{
+    TickType_t ticks = (timeout_ms == AUDIO_CAPTURE_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+
+    if (xSemaphoreTake(block_ready_semaphore, ticks) != pdTRUE)
+    {
+        return AUDIO_CAPTURE_TIMEOUT;
+    }
+    return AUDIO_CAPTURE_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_port_lock
+********************************************************************************
+* Summary:
+*    Enters a critical section shared by the consumer task and the PDM/PCM
+*    interrupt.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    State to pass to audio_capture_port_unlock()
+*
+*******************************************************************************/
+uint32_t audio_capture_port_lock(void)
+{
+    return cyhal_system_critical_section_enter();
+}
+
+
+/*******************************************************************************
+* Function Name: audio_capture_port_unlock
+********************************************************************************
+* Summary:
+*    Leaves the critical section entered by audio_capture_port_lock().
+*
+* Parameters:
+*    state          Value returned by audio_capture_port_lock()
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void audio_capture_port_unlock(uint32_t state)
+{
+    cyhal_system_critical_section_exit(state);
+}
+
+
+/*******************************************************************************
+* Function Name: pdm_pcm_event_handler
+********************************************************************************
+* Summary:
+*    PDM/PCM interrupt callback. Forwards completed DMA transfers to the
+*    capture engine.
+*
+* Parameters:
+*    callback_arg   Unused
+*    event          PDM/PCM event that triggered the interrupt
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+static void pdm_pcm_event_handler(void *callback_arg, cyhal_pdm_pcm_event_t event)
+{
+    (void) callback_arg;
+
+    if (event & CYHAL_PDM_PCM_ASYNC_COMPLETE)
+    {
+        audio_capture_on_block_complete();
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: pdm_frequency_fix
+********************************************************************************
+* Summary:
+*    This function is a workaround to apply correct clock frequency to the mic.
+*    This is to keep the clock frequency in range with mic specification.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*
+*******************************************************************************/
+static void pdm_frequency_fix()
+{
+    static uint32_t* pdm_reg = (uint32_t*)(0x40A00010);
+    uint32_t clk_clock_div_stage_1 = 2;
+    uint32_t mclkq_clock_div_stage_2 = 1;
+    uint32_t cko_clock_div_stage_3 = 8;
+    /* mic_freq / (2*16000) */
+    uint32_t needed_sinc_rate = AUDIO_SYS_CLOCK_HZ / ( clk_clock_div_stage_1 *
+        mclkq_clock_div_stage_2 * cko_clock_div_stage_3 * 2 * SAMPLE_RATE_HZ);
+    uint32_t pdm_data = (clk_clock_div_stage_1 - 1) << 0;
+    pdm_data |= (mclkq_clock_div_stage_2 - 1) << 4;
+    pdm_data |= (cko_clock_div_stage_3 - 1) << 8;
+    pdm_data |= needed_sinc_rate << 16;
+    *pdm_reg = pdm_data;
+}
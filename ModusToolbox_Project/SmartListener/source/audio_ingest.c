@@ -0,0 +1,283 @@
+/*
+ * audio_ingest.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Converts a block of PCM samples to the float input of the model: scale to
+ * [-1,1), apply the digital gain, saturate to [-1,1] and find the peak level
+ * used for gain tuning. The device uses CMSIS-DSP, the host build uses SSE2
+ * or NEON and falls back to plain C otherwise.
+ */
+
+#include "audio_ingest.h"
+
+#include <math.h>
+
+#if defined(COMPONENT_CMSIS_DSP)
+#include "arm_math.h"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* 1 / 2^15, maps a q15 sample into [-1,1) */
+#define Q15_TO_FLOAT_SCALE              (1.0f / 32768.0f)
+
+/* Frames split per pass by audio_ingest_stereo_block() */
+#define STEREO_CHUNK_FRAMES             (128)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if !defined(COMPONENT_CMSIS_DSP)
+/* Plain C kernel, also handles the tail of the SIMD versions */
+static inline float ingest_scalar(const int16_t *src, float *dst, size_t count, float gain, float peak)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float sample = src[i] * Q15_TO_FLOAT_SCALE * gain;
+        sample = (sample > 1.0f) ? 1.0f : ((sample < -1.0f) ? -1.0f : sample);
+        dst[i] = sample;
+        if (fabsf(sample) > peak)
+        {
+            peak = fabsf(sample);
+        }
+    }
+    return peak;
+}
+#endif
+
+
+/*******************************************************************************
+* Function Name: audio_ingest_block
+********************************************************************************
+* Summary:
+*    Converts, boosts and clamps a block of samples and returns its peak
+*    absolute value. Equivalent to
+*        dst[i] = clamp(src[i] / 32768 * gain, -1, 1)
+*        peak   = max(|dst[i]|)
+*
+* Parameters:
+*    src            PCM samples
+*    dst            Model input samples, may not alias src
+*    count          Number of samples
+*    gain           Digital boost factor
+*
+* Return:
+*    Peak absolute value of dst in the range [0,1]
+*
+*******************************************************************************/
+#if defined(COMPONENT_CMSIS_DSP)
+
+float audio_ingest_block(const int16_t *src, float *dst, size_t count, float gain)
+{
+    float32_t peak = 0.0f;
+    uint32_t peak_index;
+
+    if (count == 0)
+    {
+        return 0.0f;
+    }
+
+    /* arm_q15_to_float() already divides by 2^15 */
+    arm_q15_to_float((const q15_t *) src, dst, count);
+    arm_scale_f32(dst, gain, dst, count);
+    arm_clip_f32(dst, dst, -1.0f, 1.0f, count);
+    arm_absmax_f32(dst, count, &peak, &peak_index);
+
+    return peak;
+}
+
+#elif defined(__SSE2__)
+
+float audio_ingest_block(const int16_t *src, float *dst, size_t count, float gain)
+{
+    const __m128 scale = _mm_set1_ps(gain * Q15_TO_FLOAT_SCALE);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minus_one = _mm_set1_ps(-1.0f);
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 peak4 = _mm_setzero_ps();
+    float peak;
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i s16 = _mm_loadu_si128((const __m128i *) &src[i]);
+        /* Sign extend to 32 bit by shifting the samples into the high half */
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s16, s16), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s16, s16), 16);
+        __m128 a = _mm_mul_ps(_mm_cvtepi32_ps(lo), scale);
+        __m128 b = _mm_mul_ps(_mm_cvtepi32_ps(hi), scale);
+
+        a = _mm_max_ps(_mm_min_ps(a, one), minus_one);
+        b = _mm_max_ps(_mm_min_ps(b, one), minus_one);
+        _mm_storeu_ps(&dst[i], a);
+        _mm_storeu_ps(&dst[i + 4], b);
+        peak4 = _mm_max_ps(peak4, _mm_and_ps(a, abs_mask));
+        peak4 = _mm_max_ps(peak4, _mm_and_ps(b, abs_mask));
+    }
+
+    peak4 = _mm_max_ps(peak4, _mm_movehl_ps(peak4, peak4));
+    peak4 = _mm_max_ss(peak4, _mm_shuffle_ps(peak4, peak4, 1));
+    peak = _mm_cvtss_f32(peak4);
+
+    return ingest_scalar(&src[i], &dst[i], count - i, gain, peak);
+}
+
+#elif defined(__ARM_NEON)
+
+float audio_ingest_block(const int16_t *src, float *dst, size_t count, float gain)
+{
+    const float32x4_t scale = vdupq_n_f32(gain * Q15_TO_FLOAT_SCALE);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minus_one = vdupq_n_f32(-1.0f);
+    float32x4_t peak4 = vdupq_n_f32(0.0f);
+    float32x2_t peak2;
+    float peak;
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        int16x8_t s16 = vld1q_s16(&src[i]);
+        float32x4_t a = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(s16))), scale);
+        float32x4_t b = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(s16))), scale);
+
+        a = vmaxq_f32(vminq_f32(a, one), minus_one);
+        b = vmaxq_f32(vminq_f32(b, one), minus_one);
+        vst1q_f32(&dst[i], a);
+        vst1q_f32(&dst[i + 4], b);
+        peak4 = vmaxq_f32(peak4, vabsq_f32(a));
+        peak4 = vmaxq_f32(peak4, vabsq_f32(b));
+    }
+
+    peak2 = vpmax_f32(vget_low_f32(peak4), vget_high_f32(peak4));
+    peak2 = vpmax_f32(peak2, peak2);
+    peak = vget_lane_f32(peak2, 0);
+
+    return ingest_scalar(&src[i], &dst[i], count - i, gain, peak);
+}
+
+#else
+
+float audio_ingest_block(const int16_t *src, float *dst, size_t count, float gain)
+{
+    return ingest_scalar(src, dst, count, gain, 0.0f);
+}
+
+#endif
+
+
+/*******************************************************************************
+* Function Name: audio_ingest_block_q15
+********************************************************************************
+* Summary:
+*    Boosts and saturates a block of samples in q15 for the fixed-point
+*    front-end and returns its peak absolute value. dst holds the same values
+*    as arm_float_to_q15() of the output of audio_ingest_block() for gains
+*    that are a q15 fraction times a power of two, such as 10.
+*
+* Parameters:
+*    src            PCM samples
+*    dst            Model input samples, may alias src
+*    count          Number of samples
+*    gain           Digital boost factor, in [0, 2^15)
+*
+* Return:
+*    Peak absolute value of dst in the range [0,1]
+*
+*******************************************************************************/
+float audio_ingest_block_q15(const int16_t *src, int16_t *dst, size_t count, float gain)
+{
+    int shift = 0;
+    int32_t fract;
+    int16_t peak = 0;
+#if defined(COMPONENT_CMSIS_DSP)
+    uint32_t peak_index;
+#endif
+
+    /* gain = fract / 2^15 * 2^shift with fract < 2^15 */
+    while ((gain >= 1.0f) && (shift < 15))
+    {
+        gain *= 0.5f;
+        shift++;
+    }
+    fract = (int32_t) lrintf(gain * 32768.0f);
+    fract = (fract > 32767) ? 32767 : fract;
+
+    if (count == 0)
+    {
+        return 0.0f;
+    }
+
+#if defined(COMPONENT_CMSIS_DSP)
+    arm_scale_q15((const q15_t *) src, (q15_t) fract, (int8_t) shift, (q15_t *) dst, count);
+    arm_absmax_q15((const q15_t *) dst, count, (q15_t *) &peak, &peak_index);
+#else
+    for (size_t i = 0; i < count; i++)
+    {
+        int32_t sample = (src[i] * fract) >> (15 - shift);
+        sample = (sample > 32767) ? 32767 : ((sample < -32768) ? -32768 : sample);
+        dst[i] = (int16_t) sample;
+        sample = (sample < 0) ? -sample : sample;
+        if (sample > peak)
+        {
+            peak = (sample > 32767) ? 32767 : (int16_t) sample;
+        }
+    }
+#endif
+
+    return peak * Q15_TO_FLOAT_SCALE;
+}
+
+
+/*******************************************************************************
+* Function Name: audio_ingest_stereo_block
+********************************************************************************
+* Summary:
+*    Splits a block of interleaved stereo samples (left, right) and converts
+*    each channel like audio_ingest_block().
+*
+* Parameters:
+*    src            Interleaved PCM samples, 2 * frames values
+*    left           Model input samples of the left channel
+*    right          Model input samples of the right channel
+*    frames         Number of samples per channel
+*    gain           Digital boost factor
+*
+* Return:
+*    Peak absolute value of both channels in the range [0,1]
+*
+*******************************************************************************/
+float audio_ingest_stereo_block(const int16_t *src, float *left, float *right, size_t frames, float gain)
+{
+    int16_t split[2][STEREO_CHUNK_FRAMES];
+    float peak = 0.0f;
+    float channel_peak;
+
+    while (frames > 0)
+    {
+        size_t n = (frames < STEREO_CHUNK_FRAMES) ? frames : STEREO_CHUNK_FRAMES;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            split[0][i] = src[2 * i];
+            split[1][i] = src[2 * i + 1];
+        }
+        channel_peak = audio_ingest_block(split[0], left, n, gain);
+        peak = (channel_peak > peak) ? channel_peak : peak;
+        channel_peak = audio_ingest_block(split[1], right, n, gain);
+        peak = (channel_peak > peak) ? channel_peak : peak;
+
+        src += 2 * n;
+        left += n;
+        right += n;
+        frames -= n;
+    }
+    return peak;
+}
@@ -0,0 +1,23 @@
+/*
+ * audio_ingest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_AUDIO_INGEST_H_
+#define SOURCE_AUDIO_INGEST_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+float audio_ingest_block(const int16_t *src, float *dst, size_t count, float gain);
+float audio_ingest_block_q15(const int16_t *src, int16_t *dst, size_t count, float gain);
+float audio_ingest_stereo_block(const int16_t *src, float *left, float *right, size_t frames, float gain);
+
+
+#endif /* SOURCE_AUDIO_INGEST_H_ */
@@ -0,0 +1,217 @@
+/*
+ * capture_task.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * High-priority task that moves every block completed by the PDM/PCM DMA
+ * into a lock-free SPSC ring (pcm_ring.c) and hands the DMA buffer straight
+ * back. The ML Inference Task drains the ring at its own pace, so inference
+ * jitter is absorbed by the ring instead of stalling the microphone.
+ */
+
+#include "capture_task.h"
+#include "pcm_ring.h"
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <stdio.h>
+#include <assert.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Frames captured during the worst stall */
+#define CAPTURE_STALL_FRAMES            ((uint32_t)((uint64_t)CAPTURE_WORST_STALL_US * SAMPLE_RATE_HZ / 1000000u))
+
+static_assert(CAPTURE_RING_FRAMES >= CAPTURE_STALL_FRAMES + AUDIO_CAPTURE_BLOCK_SIZE,
+              "The capture ring does not cover the worst stall of the inference task");
+static_assert((CAPTURE_RING_FRAMES & (CAPTURE_RING_FRAMES - 1)) == 0, "CAPTURE_RING_FRAMES must be a power of two");
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static int16_t ring_buffer[CAPTURE_RING_SIZE] __attribute__((aligned(4)));
+static pcm_ring_t capture_ring;
+
+/* Task draining the ring, woken up after every block */
+static TaskHandle_t consumer_task_handle;
+
+/* Set when the capture stopped, reported to the consumer */
+static volatile int capture_failed = 0;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void capture_task(void *pvParameters);
+
+
+/*******************************************************************************
+* Function Name: capture_task_start
+********************************************************************************
+* Summary:
+*    Initializes the audio capture and the ring and creates the Capture
+*    Task. The calling task becomes the consumer of the ring.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS or AUDIO_CAPTURE_ERROR
+*
+*******************************************************************************/
+int capture_task_start(void)
+{
+    if (pcm_ring_init(&capture_ring, ring_buffer, CAPTURE_RING_SIZE, AUDIO_CAPTURE_CHANNELS) != 0)
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+    consumer_task_handle = xTaskGetCurrentTaskHandle();
+
+    if (audio_capture_init() != AUDIO_CAPTURE_SUCCESS)
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+
+    if (pdPASS != xTaskCreate(capture_task, "Capture task", CAPTURE_TASK_STACK_SIZE,
+                              NULL, CAPTURE_TASK_PRIORITY, NULL))
+    {
+        return AUDIO_CAPTURE_ERROR;
+    }
+    return AUDIO_CAPTURE_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: capture_task_read
+********************************************************************************
+* Summary:
+*    Reads count samples from the ring, waiting for the Capture Task if not
+*    enough are available. Must be called from the task that called
+*    capture_task_start().
+*
+* Parameters:
+*    dst            Destination of the samples
+*    count          Number of samples to read
+*    timeout_ms     Maximum time to wait or AUDIO_CAPTURE_WAIT_FOREVER
+*
+* Return:
+*    AUDIO_CAPTURE_SUCCESS, AUDIO_CAPTURE_TIMEOUT or AUDIO_CAPTURE_ERROR if
+*    the capture stopped. On failure the samples read so far are consumed.
+*
+*******************************************************************************/
+int capture_task_read(int16_t *dst, uint32_t count, uint32_t timeout_ms)
+{
+    TickType_t ticks = (timeout_ms == AUDIO_CAPTURE_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    uint32_t done = 0;
+
+    while (1)
+    {
+        done += pcm_ring_read(&capture_ring, dst + done, count - done);
+        if (done == count)
+        {
+            return AUDIO_CAPTURE_SUCCESS;
+        }
+        if (capture_failed)
+        {
+            return AUDIO_CAPTURE_ERROR;
+        }
+        if (ulTaskNotifyTake(pdTRUE, ticks) == 0)
+        {
+            return AUDIO_CAPTURE_TIMEOUT;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: capture_task_backlog
+********************************************************************************
+* Summary:
+*    Number of samples waiting in the ring. Cheaper than
+*    capture_task_get_stats() when only the depth is needed.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    Samples available to capture_task_read()
+*
+*******************************************************************************/
+uint32_t capture_task_backlog(void)
+{
+    return pcm_ring_depth(&capture_ring);
+}
+
+
+/*******************************************************************************
+* Function Name: capture_task_get_stats
+********************************************************************************
+* Summary:
+*    Snapshot of the ring occupancy and of the capture counters.
+*
+* Parameters:
+*    stats          Destination of the snapshot
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void capture_task_get_stats(capture_task_stats_t *stats)
+{
+    stats->ring_size = CAPTURE_RING_SIZE;
+    stats->ring_depth = pcm_ring_depth(&capture_ring);
+    stats->ring_high_water = pcm_ring_high_water(&capture_ring);
+    stats->ring_dropped = pcm_ring_dropped(&capture_ring);
+    audio_capture_get_stats(&stats->capture);
+}
+
+
+/*******************************************************************************
+* Function Name: capture_task
+********************************************************************************
+* Summary:
+*    Starts the PDM/PCM capture and copies every completed block into the
+*    ring. Frames that do not fit are dropped whole and counted, the task
+*    never waits for the consumer. If the capture fails the consumer is woken up
+*    with the error and the task exits.
+*
+* Parameters:
+*    void *pvParameters : Task parameter defined during task creation (unused)
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+static void capture_task(void *pvParameters)
+{
+    const int16_t *block;
+    uint32_t written;
+
+    (void) pvParameters;
+
+    if (audio_capture_start() == AUDIO_CAPTURE_SUCCESS)
+    {
+        while (audio_capture_read(&block, AUDIO_CAPTURE_WAIT_FOREVER) == AUDIO_CAPTURE_SUCCESS)
+        {
+            written = pcm_ring_write(&capture_ring, block, AUDIO_CAPTURE_BLOCK_SAMPLES);
+            audio_capture_release();
+
+            if (written < AUDIO_CAPTURE_BLOCK_SAMPLES)
+            {
+                pcm_ring_drop(&capture_ring, AUDIO_CAPTURE_BLOCK_SAMPLES - written);
+            }
+            xTaskNotifyGive(consumer_task_handle);
+        }
+    }
+
+    printf("Capture task: audio capture failed\r\n");
+    capture_failed = 1;
+    xTaskNotifyGive(consumer_task_handle);
+    vTaskDelete(NULL);
+}
@@ -0,0 +1,56 @@
+/*
+ * capture_task.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_CAPTURE_TASK_H_
+#define SOURCE_CAPTURE_TASK_H_
+
+#include <stdint.h>
+
+#include "audio_capture.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Task parameters for the Capture Task. It runs above the ML Inference Task
+ * so a long model invocation never delays the microphone. */
+#define CAPTURE_TASK_PRIORITY           (4)
+#define CAPTURE_TASK_STACK_SIZE         (1024 * 1)
+
+/* Longest time the inference task leaves the ring undrained: the worst
+ * block time of the deadline monitor ("Block time: worst" with LOG_ENABLE),
+ * a 24 ms model invocation plus the front-end. replay --pipeline
+ * --model-us 24000 measures up to 42 ms. */
+#define CAPTURE_WORST_STALL_US          (42000u)
+
+/* Frames buffered between the capture and the inference task (power of
+ * two). They hold the audio of the worst stall plus the block captured in
+ * the meantime, 1184 frames, rounded up. 2048 frames are 128 ms at 16 kHz. */
+#define CAPTURE_RING_FRAMES             (2048)
+#define CAPTURE_RING_SIZE               (CAPTURE_RING_FRAMES * AUDIO_CAPTURE_CHANNELS)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint32_t ring_size;             /* CAPTURE_RING_SIZE */
+    uint32_t ring_depth;            /* Samples waiting for the consumer */
+    uint32_t ring_high_water;       /* Largest depth seen */
+    uint32_t ring_dropped;          /* Samples lost because the ring was full */
+    audio_capture_stats_t capture;  /* DMA block counters */
+} capture_task_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int capture_task_start(void);
+int capture_task_read(int16_t *dst, uint32_t count, uint32_t timeout_ms);
+uint32_t capture_task_backlog(void);
+void capture_task_get_stats(capture_task_stats_t *stats);
+
+
+#endif /* SOURCE_CAPTURE_TASK_H_ */
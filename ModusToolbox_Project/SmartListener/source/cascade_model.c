@@ -0,0 +1,197 @@
+/*
+ * cascade_model.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * First stage of a two-stage cascade in front of the conv1dlstm network.
+ * Every model window is reduced to the mean and the peak of each mel band
+ * over its 50 frames, and a single hidden layer of a few ReLU units turns
+ * those into one candidate score. Windows below the threshold are answered
+ * with a confident "unlabelled" score vector, like the activity gate does,
+ * the others run the full network. So do the hangover_windows windows after
+ * a candidate, an event whose score dips for a window or two is not cut.
+ *
+ * smartlistener_host cascade trains the stage on the recorded sessions and
+ * picks the threshold from its recall-vs-CPU curve, the highest one that
+ * still escalates every confident fire and glass_breaking window. The
+ * stage costs about 3500 operations per window against the 569440 MACs of
+ * the network.
+ */
+
+#include "cascade_model.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const cascade_model_t *stage;
+
+static cascade_model_config_t cascade_config =
+{
+    .enabled          = 1,
+    .threshold        = 0.0f,
+    .hangover_windows = CASCADE_MODEL_HANGOVER_WINDOWS,
+};
+
+static cascade_model_stats_t cascade_stats;
+static uint32_t hangover;
+
+/* Band means followed by band peaks */
+static float features[CASCADE_MODEL_BAND_FEATURES * CASCADE_MODEL_MAX_BANDS];
+
+
+/*******************************************************************************
+* Function Name: cascade_model_init
+********************************************************************************
+* Summary:
+*    Checks that the first stage fits the buffers of the runtime, makes it the
+*    one cascade_model_score() uses and resets the counters and the
+*    hang-over. A new stage also sets the configured threshold and hang-over
+*    to its defaults, the same stage keeps them.
+*
+* Parameters:
+*    model          First stage generated by smartlistener_host cascade
+*
+* Return:
+*    0 on success, -1 if the stage is not supported
+*
+*******************************************************************************/
+int cascade_model_init(const cascade_model_t *model)
+{
+    memset(&cascade_stats, 0, sizeof(cascade_stats));
+    hangover = 0;
+    if ((model == NULL) || (model->frames == 0) || (model->bands == 0) ||
+        (model->bands > CASCADE_MODEL_MAX_BANDS) || (model->hidden == 0) ||
+        (model->hidden > CASCADE_MODEL_MAX_HIDDEN))
+    {
+        stage = NULL;
+        return -1;
+    }
+    if (model != stage)
+    {
+        cascade_config.threshold = model->threshold;
+        cascade_config.hangover_windows = model->hangover;
+    }
+    stage = model;
+    return 0;
+}
+
+
+void cascade_model_get_config(cascade_model_config_t *config)
+{
+    *config = cascade_config;
+}
+
+
+void cascade_model_set_config(const cascade_model_config_t *config)
+{
+    cascade_config = *config;
+}
+
+
+void cascade_model_get_stats(cascade_model_stats_t *stats)
+{
+    *stats = cascade_stats;
+}
+
+
+/*******************************************************************************
+* Function Name: cascade_model_score
+********************************************************************************
+* Summary:
+*    Runs the first stage on one window: band means and peaks over the
+*    frames, the ReLU hidden layer and the output unit.
+*
+* Parameters:
+*    window         Features, float[frames][bands]
+*
+* Return:
+*    Candidate score, a logit
+*
+*******************************************************************************/
+float cascade_model_score(const float *window)
+{
+    const int bands = stage->bands;
+    const int inputs = CASCADE_MODEL_BAND_FEATURES * bands;
+    float *means = features;
+    float *peaks = &features[bands];
+    float score = stage->output_bias;
+
+    memcpy(means, window, bands * sizeof(float));
+    memcpy(peaks, window, bands * sizeof(float));
+    for (int f = 1; f < stage->frames; f++)
+    {
+        const float *frame = &window[f * bands];
+
+        arm_add_f32(means, frame, means, bands);
+        for (int b = 0; b < bands; b++)
+        {
+            peaks[b] = fmaxf(peaks[b], frame[b]);
+        }
+    }
+    arm_scale_f32(means, 1.0f / stage->frames, means, bands);
+
+    for (int h = 0; h < stage->hidden; h++)
+    {
+        float unit;
+
+        arm_dot_prod_f32(&stage->weights[h * inputs], features, inputs, &unit);
+        unit += stage->bias[h];
+        if (unit > 0.0f)
+        {
+            score += stage->output_weights[h] * unit;
+        }
+    }
+    return score;
+}
+
+
+/*******************************************************************************
+* Function Name: cascade_model_skip_window
+********************************************************************************
+* Summary:
+*    Decides whether the full network has to run on the current window: a
+*    candidate or one of the hangover_windows after a candidate. If not, the
+*    scores are set to a confident CASCADE_MODEL_IDLE_LABEL result.
+*
+* Parameters:
+*    window         Features, float[frames][bands]
+*    scores         Model output, written only when the window is skipped
+*    count          Number of scores
+*
+* Return:
+*    1 if the window was skipped, 0 if the full network has to run
+*
+*******************************************************************************/
+int cascade_model_skip_window(const float *window, float *scores, int count)
+{
+    if (!cascade_config.enabled || (stage == NULL))
+    {
+        return 0;
+    }
+
+    cascade_stats.windows++;
+    if (cascade_model_score(window) >= cascade_config.threshold)
+    {
+        cascade_stats.candidates++;
+        cascade_stats.escalated++;
+        hangover = cascade_config.hangover_windows;
+        return 0;
+    }
+    if (hangover > 0)
+    {
+        hangover--;
+        cascade_stats.escalated++;
+        return 0;
+    }
+
+    memset(scores, 0, count * sizeof(float));
+    scores[CASCADE_MODEL_IDLE_LABEL] = 1.0f;
+    return 1;
+}
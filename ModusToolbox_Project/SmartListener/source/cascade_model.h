@@ -0,0 +1,84 @@
+/*
+ * cascade_model.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_CASCADE_MODEL_H_
+#define SOURCE_CASCADE_MODEL_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* 1 runs the first stage of models/model_cascade.c on every model window and
+ * the full network only on the windows it marks as candidate events, see
+ * cascade_model.c */
+#ifndef CASCADE_MODEL_ENABLE
+#define CASCADE_MODEL_ENABLE                (0)
+#endif
+
+/* Largest supported first stage */
+#define CASCADE_MODEL_MAX_BANDS             (64)
+#define CASCADE_MODEL_MAX_HIDDEN            (16)
+
+/* Inputs of the hidden layer per band: mean and peak over the window */
+#define CASCADE_MODEL_BAND_FEATURES         (2)
+
+/* Windows after a candidate that also run the full network. The windows
+ * overlap by 44 of 50 frames, 8 windows are about one second. */
+#define CASCADE_MODEL_HANGOVER_WINDOWS      (8)
+
+/* Score vector index reported for windows answered by the first stage */
+#define CASCADE_MODEL_IDLE_LABEL            (0)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* First stage generated by smartlistener_host cascade. The input
+ * normalization is folded into the hidden layer. */
+typedef struct {
+    uint16_t frames;                /* Input window [frames][bands] */
+    uint16_t bands;
+    uint16_t hidden;                /* ReLU units */
+    const float *weights;           /* [hidden][band means, band peaks] */
+    const float *bias;              /* [hidden] */
+    const float *output_weights;    /* [hidden] */
+    float output_bias;
+    float threshold;                /* Default candidate score, see cascade_model_config_t */
+    uint16_t hangover;              /* Default hang-over windows the threshold was tuned with */
+    uint32_t macs;                  /* Multiply-accumulates per window, band sums included */
+} cascade_model_t;
+
+typedef struct {
+    int enabled;                    /* 0 escalates every window */
+    float threshold;                /* Windows scoring below this are background */
+    uint32_t hangover_windows;      /* See CASCADE_MODEL_HANGOVER_WINDOWS */
+} cascade_model_config_t;
+
+typedef struct {
+    uint32_t windows;               /* Windows the first stage scored */
+    uint32_t escalated;             /* Windows passed on to the full network */
+    uint32_t candidates;            /* Of those, windows at or above the threshold */
+} cascade_model_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int cascade_model_init(const cascade_model_t *model);
+void cascade_model_get_config(cascade_model_config_t *config);
+void cascade_model_set_config(const cascade_model_config_t *config);
+void cascade_model_get_stats(cascade_model_stats_t *stats);
+
+/* Candidate score of one float[frames][bands] window, higher is more likely an event */
+float cascade_model_score(const float *window);
+int cascade_model_skip_window(const float *window, float *scores, int count);
+
+/* First stage of models/model_cascade.c, there with CASCADE_MODEL_ENABLE only */
+extern const cascade_model_t model_cascade;
+
+
+#endif /* SOURCE_CASCADE_MODEL_H_ */
@@ -0,0 +1,251 @@
+/*
+ * deadline_monitor.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Checks that the pipeline keeps up with the microphone. Every capture
+ * block is timestamped when the ML Inference Task picks it up and when it
+ * is done with it, every model output when it is dequeued. The block
+ * processing time is compared with the 32 ms block period and the latency
+ * from the audio being captured to the scores being dequeued with the
+ * 120 ms output period. Worst case, mean and p99 (from a fixed histogram)
+ * are kept for both, together with the number of missed deadlines.
+ *
+ * Timestamps come from the DWT cycle counter on the device and from
+ * CLOCK_MONOTONIC in the host build. The counters are written by the ML
+ * Inference Task only; readers in other tasks may see a snapshot that is
+ * one measurement behind.
+ */
+
+#include "deadline_monitor.h"
+
+#include <string.h>
+
+#if defined(COMPONENT_CM4)
+#include "cyhal.h"
+#else
+#include <time.h>
+#endif
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint32_t period_us;
+    uint32_t bin_us;
+    uint32_t count;
+    uint32_t missed;
+    uint32_t last_us;
+    uint32_t worst_us;
+    uint64_t total_us;
+    uint32_t histogram[DEADLINE_HISTOGRAM_BINS];
+} deadline_channel_state_t;
+
+static deadline_channel_state_t channels[DEADLINE_NUM_CHANNELS];
+
+/* Timestamps of the block being processed */
+static uint32_t block_begin_ticks;
+static uint32_t block_captured_ticks;
+static uint32_t ticks_per_us = 1;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t now_ticks(void);
+static void channel_init(deadline_channel_state_t *channel, uint32_t period_us);
+static void channel_record(deadline_channel_state_t *channel, uint32_t elapsed_ticks);
+
+
+/*******************************************************************************
+* Function Name: deadline_monitor_init
+********************************************************************************
+* Summary:
+*    Clears the counters and starts the time base.
+*
+* Parameters:
+*    speed          Replay speed relative to real time, the deadlines are
+*                   divided by it. 1.0 on the device.
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void deadline_monitor_init(float speed)
+{
+    if (speed <= 0.0f)
+    {
+        speed = 1.0f;
+    }
+
+#if defined(COMPONENT_CM4)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    ticks_per_us = SystemCoreClock / 1000000u;
+#else
+    ticks_per_us = 1;
+#endif
+
+    channel_init(&channels[DEADLINE_BLOCK], (uint32_t)(DEADLINE_BLOCK_PERIOD_US / speed));
+    channel_init(&channels[DEADLINE_OUTPUT], (uint32_t)(DEADLINE_OUTPUT_PERIOD_US / speed));
+    block_begin_ticks = now_ticks();
+    block_captured_ticks = block_begin_ticks;
+}
+
+
+/*******************************************************************************
+* Function Name: deadline_monitor_get_stats
+********************************************************************************
+* Summary:
+*    Returns the counters of one channel.
+*
+* Parameters:
+*    channel        DEADLINE_BLOCK or DEADLINE_OUTPUT
+*    stats          Destination of the counters
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void deadline_monitor_get_stats(deadline_channel_t channel, deadline_stats_t *stats)
+{
+    const deadline_channel_state_t *state = &channels[channel];
+    uint32_t rank;
+    uint32_t seen = 0;
+    int bin;
+
+    stats->period_us = state->period_us;
+    stats->count = state->count;
+    stats->missed = state->missed;
+    stats->last_us = state->last_us;
+    stats->worst_us = state->worst_us;
+    stats->mean_us = (state->count > 0) ? (uint32_t)(state->total_us / state->count) : 0;
+
+    /* Smallest bin edge below which at least 99% of the measurements fall */
+    rank = state->count - state->count / 100;
+    for (bin = 0; bin < DEADLINE_HISTOGRAM_BINS - 1; bin++)
+    {
+        seen += state->histogram[bin];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+    stats->p99_us = (bin < DEADLINE_HISTOGRAM_BINS - 1) ? (bin + 1) * state->bin_us : state->worst_us;
+    if (stats->p99_us > state->worst_us)
+    {
+        stats->p99_us = state->worst_us;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: deadline_monitor_block_begin
+********************************************************************************
+* Summary:
+*    Timestamps a capture block handed to the ML Inference Task.
+*
+* Parameters:
+*    backlog_samples    Samples captured after the block that are already
+*                       waiting, used to date the capture of the block
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void deadline_monitor_block_begin(uint32_t backlog_samples)
+{
+    block_begin_ticks = now_ticks();
+    block_captured_ticks = block_begin_ticks -
+        (uint32_t)((uint64_t)backlog_samples * 1000000u / SAMPLE_RATE_HZ) * ticks_per_us;
+}
+
+
+/*******************************************************************************
+* Function Name: deadline_monitor_block_end
+********************************************************************************
+* Summary:
+*    Records the processing time of the block since
+*    deadline_monitor_block_begin().
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void deadline_monitor_block_end(void)
+{
+    channel_record(&channels[DEADLINE_BLOCK], now_ticks() - block_begin_ticks);
+}
+
+
+/*******************************************************************************
+* Function Name: deadline_monitor_output
+********************************************************************************
+* Summary:
+*    Records the latency of a dequeued model output, from the capture of
+*    the block that completed its window.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void deadline_monitor_output(void)
+{
+    channel_record(&channels[DEADLINE_OUTPUT], now_ticks() - block_captured_ticks);
+}
+
+
+static uint32_t now_ticks(void)
+{
+#if defined(COMPONENT_CM4)
+    return DWT->CYCCNT;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000u + (uint64_t)now.tv_nsec / 1000u);
+#endif
+}
+
+
+static void channel_init(deadline_channel_state_t *channel, uint32_t period_us)
+{
+    memset(channel, 0, sizeof(*channel));
+    channel->period_us = period_us;
+    channel->bin_us = (2 * period_us + DEADLINE_HISTOGRAM_BINS - 1) / DEADLINE_HISTOGRAM_BINS;
+    if (channel->bin_us == 0)
+    {
+        channel->bin_us = 1;
+    }
+}
+
+
+static void channel_record(deadline_channel_state_t *channel, uint32_t elapsed_ticks)
+{
+    uint32_t elapsed_us = elapsed_ticks / ticks_per_us;
+    uint32_t bin = elapsed_us / channel->bin_us;
+
+    if (bin >= DEADLINE_HISTOGRAM_BINS)
+    {
+        bin = DEADLINE_HISTOGRAM_BINS - 1;
+    }
+    channel->histogram[bin]++;
+    channel->count++;
+    channel->total_us += elapsed_us;
+    channel->last_us = elapsed_us;
+    if (elapsed_us > channel->worst_us)
+    {
+        channel->worst_us = elapsed_us;
+    }
+    if (elapsed_us > channel->period_us)
+    {
+        channel->missed++;
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * deadline_monitor.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_DEADLINE_MONITOR_H_
+#define SOURCE_DEADLINE_MONITOR_H_
+
+#include <stdint.h>
+
+#include "audio_capture.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Time budget to process one capture block: 512 samples at 16 kHz = 32 ms */
+#define DEADLINE_BLOCK_PERIOD_US        ((uint32_t)(AUDIO_CAPTURE_BLOCK_SIZE * 1000000ull / SAMPLE_RATE_HZ))
+
+/* Time budget from the audio completing a model window to its scores being
+ * dequeued. The model hops 6 feature frames of 20 ms = 120 ms. */
+#define DEADLINE_OUTPUT_PERIOD_US       (120000u)
+
+/* Resolution of the latency histograms. The bins cover two periods, the
+ * last bin also holds everything above. */
+#define DEADLINE_HISTOGRAM_BINS         (64)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef enum {
+    DEADLINE_BLOCK = 0,             /* Processing time of one capture block */
+    DEADLINE_OUTPUT,                /* Capture to IMAI_dequeue() latency */
+    DEADLINE_NUM_CHANNELS
+} deadline_channel_t;
+
+typedef struct {
+    uint32_t period_us;             /* Deadline the measurements are compared to */
+    uint32_t count;                 /* Measurements */
+    uint32_t missed;                /* Measurements above period_us */
+    uint32_t last_us;
+    uint32_t mean_us;
+    uint32_t p99_us;                /* Upper edge of the 99th percentile bin */
+    uint32_t worst_us;
+} deadline_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void deadline_monitor_init(float speed);
+void deadline_monitor_get_stats(deadline_channel_t channel, deadline_stats_t *stats);
+
+/* Called by the ML Inference Task */
+void deadline_monitor_block_begin(uint32_t backlog_samples);
+void deadline_monitor_block_end(void);
+void deadline_monitor_output(void);
+
+
+#endif /* SOURCE_DEADLINE_MONITOR_H_ */
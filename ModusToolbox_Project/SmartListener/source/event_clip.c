@@ -0,0 +1,376 @@
+/*
+ * event_clip.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Pre-roll audio for confirmed events. The ML task keeps the last
+ * EVENT_CLIP_SECONDS of model input in a ring of IMA-ADPCM blocks (4 bits
+ * per sample), a confirmed event freezes a copy and the publisher task
+ * sends it in chunks on a companion MQTT topic.
+ *
+ * Every chunk is self-contained: a 36 byte little-endian header
+ *
+ *     0  "SLC1"
+ *     4  clip id           u16
+ *     6  chunk index       u16
+ *     8  chunk count       u16
+ *    10  samples per block u16
+ *    12  sample rate       u32
+ *    16  first block       u16
+ *    18  blocks in chunk   u16
+ *    20  label             char[16], zero terminated
+ *
+ * followed by whole blocks of {predictor s16, step index u8, 0, 128 bytes
+ * of codes}. A lost chunk leaves a gap but does not corrupt the others.
+ */
+
+#include "event_clip.h"
+
+#include <string.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define CHUNK_MAGIC                     "SLC1"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void encode_block(event_clip_recorder_t *recorder);
+static inline void put_u16(uint8_t *dst, uint16_t value);
+static inline void put_u32(uint8_t *dst, uint32_t value);
+static inline uint16_t get_u16(const uint8_t *src);
+static inline uint32_t get_u32(const uint8_t *src);
+
+
+/*******************************************************************************
+* Function Name: event_clip_recorder_init
+********************************************************************************
+* Summary:
+*    Starts an empty pre-roll.
+*
+* Parameters:
+*    recorder       Recorder to initialize
+*    sample_rate    Rate of the samples passed to event_clip_recorder_write()
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void event_clip_recorder_init(event_clip_recorder_t *recorder, uint32_t sample_rate)
+{
+    recorder->sample_rate = sample_rate;
+    recorder->next_block = 0;
+    recorder->block_count = 0;
+    recorder->pending_count = 0;
+    adpcm_init(&recorder->state);
+}
+
+
+/*******************************************************************************
+* Function Name: event_clip_recorder_write
+********************************************************************************
+* Summary:
+*    Appends samples to the pre-roll, overwriting the oldest block once the
+*    ring is full.
+*
+* Parameters:
+*    recorder       Initialized recorder
+*    src            Samples
+*    count          Number of samples
+*    stride         Distance between two samples, e.g. 2 for the left
+*                   channel of an interleaved stereo block
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void event_clip_recorder_write(event_clip_recorder_t *recorder, const int16_t *src, size_t count, size_t stride)
+{
+    while (count > 0)
+    {
+        size_t n = EVENT_CLIP_BLOCK_SAMPLES - recorder->pending_count;
+
+        n = (count < n) ? count : n;
+        for (size_t i = 0; i < n; i++)
+        {
+            recorder->pending[recorder->pending_count + i] = src[i * stride];
+        }
+        recorder->pending_count += n;
+        src += n * stride;
+        count -= n;
+
+        if (recorder->pending_count == EVENT_CLIP_BLOCK_SAMPLES)
+        {
+            encode_block(recorder);
+            recorder->pending_count = 0;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: event_clip_capture
+********************************************************************************
+* Summary:
+*    Copies the complete blocks of the pre-roll into clip, oldest first, and
+*    marks the clip busy. Called from the task that writes the recorder.
+*
+* Parameters:
+*    recorder       Recorder holding the pre-roll
+*    clip           Destination, must not be busy
+*    id             Clip identifier carried in every chunk
+*    label          Event label carried in every chunk
+*
+* Return:
+*    0 on success, -1 if the clip is still being uploaded
+*
+*******************************************************************************/
+int event_clip_capture(const event_clip_recorder_t *recorder, event_clip_t *clip, uint16_t id, const char *label)
+{
+    uint32_t oldest;
+
+    if (atomic_load_explicit(&clip->busy, memory_order_acquire))
+    {
+        return -1;
+    }
+
+    oldest = (recorder->next_block + EVENT_CLIP_BLOCKS - recorder->block_count) % EVENT_CLIP_BLOCKS;
+    for (uint32_t i = 0; i < recorder->block_count; i++)
+    {
+        memcpy(clip->blocks[i], recorder->blocks[(oldest + i) % EVENT_CLIP_BLOCKS], EVENT_CLIP_BLOCK_BYTES);
+    }
+
+    clip->id = id;
+    clip->sample_rate = recorder->sample_rate;
+    clip->block_count = (uint16_t) recorder->block_count;
+    strncpy(clip->label, label, EVENT_CLIP_LABEL_LEN - 1);
+    clip->label[EVENT_CLIP_LABEL_LEN - 1] = '\0';
+
+    /* Hand the copy over to the publisher */
+    atomic_store_explicit(&clip->busy, 1, memory_order_release);
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: event_clip_init
+********************************************************************************
+* Summary:
+*    Marks a clip free.
+*
+* Parameters:
+*    clip           Clip to initialize
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void event_clip_init(event_clip_t *clip)
+{
+    atomic_init(&clip->busy, 0);
+    clip->block_count = 0;
+}
+
+
+/*******************************************************************************
+* Function Name: event_clip_chunk_count
+********************************************************************************
+* Summary:
+*    Number of chunks needed to send a captured clip.
+*
+* Parameters:
+*    clip           Captured clip
+*
+* Return:
+*    Number of chunks, 0 for an empty clip
+*
+*******************************************************************************/
+uint16_t event_clip_chunk_count(const event_clip_t *clip)
+{
+    return (uint16_t)((clip->block_count + EVENT_CLIP_CHUNK_BLOCKS - 1) / EVENT_CLIP_CHUNK_BLOCKS);
+}
+
+
+/*******************************************************************************
+* Function Name: event_clip_chunk
+********************************************************************************
+* Summary:
+*    Formats one chunk of a captured clip as an MQTT payload.
+*
+* Parameters:
+*    clip           Captured clip
+*    index          Chunk index, below event_clip_chunk_count()
+*    dst            Payload buffer
+*    size           Size of dst, EVENT_CLIP_CHUNK_BYTES is always enough
+*
+* Return:
+*    Payload length, 0 if index is out of range or dst is too small
+*
+*******************************************************************************/
+size_t event_clip_chunk(const event_clip_t *clip, uint16_t index, uint8_t *dst, size_t size)
+{
+    uint16_t chunk_count = event_clip_chunk_count(clip);
+    uint32_t first_block = (uint32_t) index * EVENT_CLIP_CHUNK_BLOCKS;
+    uint32_t block_count;
+    size_t length;
+
+    if (index >= chunk_count)
+    {
+        return 0;
+    }
+    block_count = clip->block_count - first_block;
+    block_count = (block_count > EVENT_CLIP_CHUNK_BLOCKS) ? EVENT_CLIP_CHUNK_BLOCKS : block_count;
+    length = EVENT_CLIP_CHUNK_HEADER + block_count * EVENT_CLIP_BLOCK_BYTES;
+    if (size < length)
+    {
+        return 0;
+    }
+
+    memcpy(dst, CHUNK_MAGIC, 4);
+    put_u16(&dst[4], clip->id);
+    put_u16(&dst[6], index);
+    put_u16(&dst[8], chunk_count);
+    put_u16(&dst[10], EVENT_CLIP_BLOCK_SAMPLES);
+    put_u32(&dst[12], clip->sample_rate);
+    put_u16(&dst[16], (uint16_t) first_block);
+    put_u16(&dst[18], (uint16_t) block_count);
+    memcpy(&dst[20], clip->label, EVENT_CLIP_LABEL_LEN);
+    memcpy(&dst[EVENT_CLIP_CHUNK_HEADER], clip->blocks[first_block], block_count * EVENT_CLIP_BLOCK_BYTES);
+
+    return length;
+}
+
+
+/*******************************************************************************
+* Function Name: event_clip_release
+********************************************************************************
+* Summary:
+*    Frees a clip after its last chunk was sent.
+*
+* Parameters:
+*    clip           Captured clip
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void event_clip_release(event_clip_t *clip)
+{
+    atomic_store_explicit(&clip->busy, 0, memory_order_release);
+}
+
+
+/*******************************************************************************
+* Function Name: event_clip_parse_chunk
+********************************************************************************
+* Summary:
+*    Checks and decodes a received chunk. Used by the host tools and as the
+*    reference for the backend.
+*
+* Parameters:
+*    chunk          Payload
+*    size           Payload length
+*    info           Header fields
+*    dst            Decoded samples, EVENT_CLIP_CHUNK_BLOCKS *
+*                   EVENT_CLIP_BLOCK_SAMPLES, or NULL to parse the header only
+*
+* Return:
+*    0 on success, -1 if the payload is malformed
+*
+*******************************************************************************/
+int event_clip_parse_chunk(const uint8_t *chunk, size_t size, event_clip_chunk_info_t *info, int16_t *dst)
+{
+    uint16_t block_samples;
+    uint16_t first_block;
+    uint16_t block_count;
+    size_t block_bytes;
+
+    if ((size < EVENT_CLIP_CHUNK_HEADER) || (memcmp(chunk, CHUNK_MAGIC, 4) != 0))
+    {
+        return -1;
+    }
+
+    block_samples = get_u16(&chunk[10]);
+    first_block = get_u16(&chunk[16]);
+    block_count = get_u16(&chunk[18]);
+    block_bytes = EVENT_CLIP_BLOCK_HEADER + block_samples / 2;
+    if ((block_samples != EVENT_CLIP_BLOCK_SAMPLES) || (block_count > EVENT_CLIP_CHUNK_BLOCKS) ||
+        (size != EVENT_CLIP_CHUNK_HEADER + block_count * block_bytes))
+    {
+        return -1;
+    }
+
+    info->clip_id = get_u16(&chunk[4]);
+    info->chunk_index = get_u16(&chunk[6]);
+    info->chunk_count = get_u16(&chunk[8]);
+    info->sample_rate = get_u32(&chunk[12]);
+    info->first_sample = (uint32_t) first_block * block_samples;
+    info->sample_count = (uint32_t) block_count * block_samples;
+    memcpy(info->label, &chunk[20], EVENT_CLIP_LABEL_LEN);
+    info->label[EVENT_CLIP_LABEL_LEN - 1] = '\0';
+
+    if (dst != NULL)
+    {
+        for (uint16_t b = 0; b < block_count; b++)
+        {
+            const uint8_t *block = &chunk[EVENT_CLIP_CHUNK_HEADER + b * block_bytes];
+            adpcm_state_t state;
+
+            state.predictor = (int16_t) get_u16(block);
+            state.index = block[2];
+            if (state.index > 88)
+            {
+                return -1;
+            }
+            adpcm_decode(&state, &block[EVENT_CLIP_BLOCK_HEADER], block_samples, &dst[b * block_samples]);
+        }
+    }
+    return 0;
+}
+
+
+/* Encodes the pending samples into the next ring slot. The block header
+ * holds the coder state before the first sample. */
+static void encode_block(event_clip_recorder_t *recorder)
+{
+    uint8_t *block = recorder->blocks[recorder->next_block];
+
+    put_u16(block, (uint16_t) recorder->state.predictor);
+    block[2] = recorder->state.index;
+    block[3] = 0;
+    adpcm_encode(&recorder->state, recorder->pending, EVENT_CLIP_BLOCK_SAMPLES, 1, &block[EVENT_CLIP_BLOCK_HEADER]);
+    recorder->next_block = (recorder->next_block + 1) % EVENT_CLIP_BLOCKS;
+    if (recorder->block_count < EVENT_CLIP_BLOCKS)
+    {
+        recorder->block_count++;
+    }
+}
+
+
+static inline void put_u16(uint8_t *dst, uint16_t value)
+{
+    dst[0] = (uint8_t) value;
+    dst[1] = (uint8_t)(value >> 8);
+}
+
+
+static inline void put_u32(uint8_t *dst, uint32_t value)
+{
+    put_u16(dst, (uint16_t) value);
+    put_u16(&dst[2], (uint16_t)(value >> 16));
+}
+
+
+static inline uint16_t get_u16(const uint8_t *src)
+{
+    return (uint16_t)(src[0] | (src[1] << 8));
+}
+
+
+static inline uint32_t get_u32(const uint8_t *src)
+{
+    return get_u16(src) | ((uint32_t) get_u16(&src[2]) << 16);
+}
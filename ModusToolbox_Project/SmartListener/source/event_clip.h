@@ -0,0 +1,94 @@
+/*
+ * event_clip.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_EVENT_CLIP_H_
+#define SOURCE_EVENT_CLIP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "adpcm.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Length of the pre-roll kept at 16 kHz */
+#define EVENT_CLIP_SECONDS              (2)
+
+/* Samples per ADPCM block. Each block starts with the coder state, so it
+ * decodes on its own. */
+#define EVENT_CLIP_BLOCK_SAMPLES        (256)
+#define EVENT_CLIP_BLOCK_HEADER         (4)
+#define EVENT_CLIP_BLOCK_BYTES          (EVENT_CLIP_BLOCK_HEADER + EVENT_CLIP_BLOCK_SAMPLES / 2)
+#define EVENT_CLIP_BLOCKS               (EVENT_CLIP_SECONDS * 16000 / EVENT_CLIP_BLOCK_SAMPLES)
+
+/* Largest MQTT payload of one chunk. A chunk holds a header and whole blocks. */
+#define EVENT_CLIP_CHUNK_BYTES          (1024)
+#define EVENT_CLIP_CHUNK_HEADER         (36)
+#define EVENT_CLIP_CHUNK_BLOCKS         ((EVENT_CLIP_CHUNK_BYTES - EVENT_CLIP_CHUNK_HEADER) / EVENT_CLIP_BLOCK_BYTES)
+
+/* Label text carried in every chunk, including the terminating zero */
+#define EVENT_CLIP_LABEL_LEN            (16)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Pre-roll ring, written by the ML task */
+typedef struct {
+    uint32_t sample_rate;
+    uint32_t next_block;            /* Ring slot of the next block */
+    uint32_t block_count;           /* Complete blocks in the ring */
+    adpcm_state_t state;
+    uint32_t pending_count;
+    int16_t pending[EVENT_CLIP_BLOCK_SAMPLES];
+    uint8_t blocks[EVENT_CLIP_BLOCKS][EVENT_CLIP_BLOCK_BYTES];
+} event_clip_recorder_t;
+
+/* Frozen copy of the pre-roll, oldest block first. busy is set by
+ * event_clip_capture() and cleared by event_clip_release() once the
+ * publisher has sent every chunk. */
+typedef struct {
+    atomic_bool busy;
+    uint16_t id;
+    uint32_t sample_rate;
+    uint16_t block_count;
+    char label[EVENT_CLIP_LABEL_LEN];
+    uint8_t blocks[EVENT_CLIP_BLOCKS][EVENT_CLIP_BLOCK_BYTES];
+} event_clip_t;
+
+/* Fields of a received chunk */
+typedef struct {
+    uint16_t clip_id;
+    uint16_t chunk_index;
+    uint16_t chunk_count;
+    uint32_t sample_rate;
+    uint32_t first_sample;          /* Offset of the chunk in the clip */
+    uint32_t sample_count;
+    char label[EVENT_CLIP_LABEL_LEN];
+} event_clip_chunk_info_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* Recorder, ML task */
+void event_clip_recorder_init(event_clip_recorder_t *recorder, uint32_t sample_rate);
+void event_clip_recorder_write(event_clip_recorder_t *recorder, const int16_t *src, size_t count, size_t stride);
+int event_clip_capture(const event_clip_recorder_t *recorder, event_clip_t *clip, uint16_t id, const char *label);
+
+/* Upload, publisher task */
+void event_clip_init(event_clip_t *clip);
+uint16_t event_clip_chunk_count(const event_clip_t *clip);
+size_t event_clip_chunk(const event_clip_t *clip, uint16_t index, uint8_t *dst, size_t size);
+void event_clip_release(event_clip_t *clip);
+
+/* Receiver */
+int event_clip_parse_chunk(const uint8_t *chunk, size_t size, event_clip_chunk_info_t *info, int16_t *dst);
+
+
+#endif /* SOURCE_EVENT_CLIP_H_ */
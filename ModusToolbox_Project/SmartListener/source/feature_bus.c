@@ -0,0 +1,161 @@
+/*
+ * feature_bus.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Hands the front-end output of every hop to any number of consumers (level
+ * meter, tonal detector, a second model) so none of them recomputes the FFT
+ * of IMAI_dequeue(). The model publishes the magnitude spectrum its mel
+ * filterbank read and the log-mel frame once per hop, and the bus calls the
+ * consumers in registration order with read-only pointers. The magnitudes are
+ * only handed out if a consumer asked for them.
+ *
+ * The callbacks run in the task that feeds the model (the ML task), between
+ * two front-end hops, so they must be short. Consumers register before that
+ * task starts or from it: the table is not locked.
+ */
+
+#include "feature_bus.h"
+
+#include <stddef.h>
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    feature_bus_callback_t callback;    /* NULL for a free entry */
+    void *context;
+    uint32_t flags;
+} subscriber_t;
+
+static subscriber_t subscribers[FEATURE_BUS_MAX_SUBSCRIBERS];
+static uint32_t hop;
+static feature_bus_stats_t bus_stats;
+
+
+/*******************************************************************************
+* Function Name: feature_bus_subscribe
+********************************************************************************
+* Summary:
+*    Registers a consumer of the front-end frames.
+*
+* Parameters:
+*    callback       Called once per hop
+*    context        Passed to the callback
+*    flags          FEATURE_BUS_LOG_MEL or FEATURE_BUS_MAGNITUDE
+*
+* Return:
+*    Subscription id for feature_bus_unsubscribe(), -1 if the bus is full
+*
+*******************************************************************************/
+int feature_bus_subscribe(feature_bus_callback_t callback, void *context, uint32_t flags)
+{
+    if (callback == NULL)
+    {
+        return -1;
+    }
+    for (int i = 0; i < FEATURE_BUS_MAX_SUBSCRIBERS; i++)
+    {
+        if (subscribers[i].callback == NULL)
+        {
+            subscribers[i].context = context;
+            subscribers[i].flags = flags;
+            subscribers[i].callback = callback;
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+/*******************************************************************************
+* Function Name: feature_bus_unsubscribe
+********************************************************************************
+* Summary:
+*    Removes a consumer registered by feature_bus_subscribe().
+*
+* Parameters:
+*    id             Subscription id
+*
+*******************************************************************************/
+void feature_bus_unsubscribe(int id)
+{
+    if ((id >= 0) && (id < FEATURE_BUS_MAX_SUBSCRIBERS))
+    {
+        subscribers[id].callback = NULL;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: feature_bus_get_stats
+********************************************************************************
+* Summary:
+*    Returns the frames published and delivered since start-up.
+*
+* Parameters:
+*    stats          Filled with the counters
+*
+*******************************************************************************/
+void feature_bus_get_stats(feature_bus_stats_t *stats)
+{
+    *stats = bus_stats;
+}
+
+
+/*******************************************************************************
+* Function Name: feature_bus_reset
+********************************************************************************
+* Summary:
+*    Restarts the hop count, called by IMAI_init(). The consumers stay
+*    registered.
+*
+*******************************************************************************/
+void feature_bus_reset(void)
+{
+    hop = 0;
+}
+
+
+/*******************************************************************************
+* Function Name: feature_bus_publish
+********************************************************************************
+* Summary:
+*    Delivers one front-end hop to the registered consumers.
+*
+* Parameters:
+*    magnitude      FEATURE_BUS_BINS magnitudes of the hop, or NULL if the
+*                   front-end has none
+*    log_mel        FEATURE_BUS_MEL_BANDS log-mel energies
+*
+*******************************************************************************/
+void feature_bus_publish(const float *magnitude, const float *log_mel)
+{
+    feature_frame_t frame = { hop++, NULL, log_mel };
+
+    bus_stats.hops++;
+    for (int i = 0; i < FEATURE_BUS_MAX_SUBSCRIBERS; i++)
+    {
+        if ((subscribers[i].callback != NULL) && (subscribers[i].flags & FEATURE_BUS_MAGNITUDE))
+        {
+            frame.magnitude = magnitude;
+        }
+    }
+    if (frame.magnitude != NULL)
+    {
+        bus_stats.magnitude_hops++;
+    }
+
+    for (int i = 0; i < FEATURE_BUS_MAX_SUBSCRIBERS; i++)
+    {
+        const subscriber_t *subscriber = &subscribers[i];
+
+        if (subscriber->callback != NULL)
+        {
+            subscriber->callback(&frame, subscriber->context);
+            bus_stats.deliveries++;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * feature_bus.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_FEATURE_BUS_H_
+#define SOURCE_FEATURE_BUS_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Largest number of registered consumers */
+#define FEATURE_BUS_MAX_SUBSCRIBERS         (8)
+
+/* Frame geometry of the model front-end */
+#define FEATURE_BUS_FFT_LEN                 (512)
+#define FEATURE_BUS_BINS                    (FEATURE_BUS_FFT_LEN / 2 + 1)
+#define FEATURE_BUS_MEL_BANDS               (30)
+
+/* Subscription flags */
+#define FEATURE_BUS_LOG_MEL                 (0x0)   /* The log-mel frame only */
+#define FEATURE_BUS_MAGNITUDE               (0x1)   /* Also the magnitude spectrum */
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* One hop of the front-end. The arrays belong to the bus and are only valid
+ * during the callback. */
+typedef struct {
+    uint32_t hop;                   /* Hops since IMAI_init() */
+    const float *magnitude;         /* FEATURE_BUS_BINS bins, NULL if no subscriber asked for
+                                     * it and with the q15 or stereo front-end */
+    const float *log_mel;           /* FEATURE_BUS_MEL_BANDS natural log mel energies */
+} feature_frame_t;
+
+typedef void (*feature_bus_callback_t)(const feature_frame_t *frame, void *context);
+
+typedef struct {
+    uint32_t hops;                  /* Frames published */
+    uint32_t magnitude_hops;        /* Frames the magnitude spectrum was handed out for */
+    uint32_t deliveries;            /* Callbacks made */
+} feature_bus_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int feature_bus_subscribe(feature_bus_callback_t callback, void *context, uint32_t flags);
+void feature_bus_unsubscribe(int id);
+void feature_bus_get_stats(feature_bus_stats_t *stats);
+
+/* Called by the model for every front-end hop */
+void feature_bus_reset(void);
+void feature_bus_publish(const float *magnitude, const float *log_mel);
+
+
+#endif /* SOURCE_FEATURE_BUS_H_ */
@@ -0,0 +1,91 @@
+/*
+ * frontend.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * C entry points of the frontend.hpp configuration used by the model, for
+ * models/model.c and the rest of the C code. Only built with
+ * FRONTEND_CONSTEXPR_ENABLE, which also needs C++17 (FRONTEND_CONSTEXPR in
+ * the Makefile sets both).
+ */
+
+#include "frontend.h"
+
+#if FRONTEND_CONSTEXPR_ENABLE
+
+#include "frontend.hpp"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+using Frontend = frontend::LogMelFrontend<FRONTEND_FFT_LEN, FRONTEND_HOP, FRONTEND_MEL_BANDS, FRONTEND_SAMPLE_RATE>;
+
+static_assert(Frontend::clip_floor == 0.00031f, "Clip floor of the generated model code");
+
+
+/*******************************************************************************
+* Function Name: frontend_init
+********************************************************************************
+* Summary:
+*    Initializes the real FFT of the front-end.
+*
+* Parameters:
+*    rfft           arm_rfft_fast_instance_f32 to initialize
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int frontend_init(void *rfft)
+{
+    return Frontend::init(static_cast<arm_rfft_fast_instance_f32 *>(rfft));
+}
+
+
+/*******************************************************************************
+* Function Name: frontend_frame
+********************************************************************************
+* Summary:
+*    Computes the log-mel frame of one window: Hann window, real FFT,
+*    magnitude, mel filterbank, clip and natural log.
+*
+* Parameters:
+*    rfft           FFT instance set up by frontend_init()
+*    samples        FRONTEND_FFT_LEN samples
+*    scratch_a      FRONTEND_FFT_LEN floats, used by the FFT as scratch
+*    scratch_b      FRONTEND_FFT_LEN floats
+*    log_mel        FRONTEND_MEL_BANDS log-mel energies
+*
+*******************************************************************************/
+void frontend_frame(void *rfft, const float *samples, float *scratch_a, float *scratch_b, float *log_mel)
+{
+    Frontend::frame(static_cast<arm_rfft_fast_instance_f32 *>(rfft), samples, scratch_a, scratch_b, log_mel);
+}
+
+
+const float *frontend_window(void)
+{
+    return Frontend::window.data();
+}
+
+
+const int16_t *frontend_filter_points(void)
+{
+    return Frontend::filter_points.data();
+}
+
+
+const float *frontend_filter_coefs(void)
+{
+    return Frontend::filter_coefs.data();
+}
+
+
+int frontend_filter_coef_count(void)
+{
+    return Frontend::filter_coef_count;
+}
+
+#endif /* FRONTEND_CONSTEXPR_ENABLE */
@@ -0,0 +1,53 @@
+/*
+ * frontend.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_FRONTEND_H_
+#define SOURCE_FRONTEND_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to take the front-end tables of models/model.c from frontend.hpp
+ * instead of the arrays baked into it, and to run the float front-end
+ * through frontend_frame(). The result is the same bit for bit. frontend.cpp
+ * is empty without it; FRONTEND_CONSTEXPR=1 in the Makefile sets it
+ * together with the C++17 it needs. */
+#ifndef FRONTEND_CONSTEXPR_ENABLE
+#define FRONTEND_CONSTEXPR_ENABLE           (0)
+#endif
+
+/* Configuration of frontend.cpp */
+#define FRONTEND_FFT_LEN                    (512)
+#define FRONTEND_HOP                        (320)
+#define FRONTEND_MEL_BANDS                  (30)
+#define FRONTEND_SAMPLE_RATE                (16000)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int frontend_init(void *rfft);
+void frontend_frame(void *rfft, const float *samples, float *scratch_a, float *scratch_b, float *log_mel);
+
+/* Tables generated at compile time */
+const float *frontend_window(void);
+const int16_t *frontend_filter_points(void);
+const float *frontend_filter_coefs(void);
+int frontend_filter_coef_count(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOURCE_FRONTEND_H_ */
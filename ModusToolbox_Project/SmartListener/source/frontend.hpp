@@ -0,0 +1,326 @@
+/*
+ * frontend.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Log-mel front-end specialised at compile time. The FFT size, hop, number
+ * of mel bands, sample rate, mel range and clip floor are template
+ * parameters, and the Hann window, the mel filter edges and the filter
+ * coefficients are computed by constexpr functions, so every configuration
+ * gets its own tables in flash and its own loop bounds. A configuration the
+ * kernels cannot run (FFT size, filters narrower than one FFT bin, a mel
+ * range past Nyquist) fails to compile.
+ *
+ * The tables are computed the way the DEEPCRAFT generator computes them:
+ * symmetric Hann window in double, filter edges at
+ * floor((fft_size + 1) * hz / sample_rate) of mel-spaced frequencies, and
+ * triangle coefficients i / c0 and 1 - i / c1 with float divisions. The
+ * 512/320/30 configuration gives the _K18, _K23 and _K24 arrays of
+ * models/model.c bit for bit, `smartlistener_host frontend-check` compares
+ * them.
+ *
+ * A frame runs on arm_mult_f32(), arm_rfft_fast_f32() and mel_log_f32():
+ * CMSIS-DSP on the device, the arm_math shim and the AVX2 mel kernel on a
+ * Linux host.
+ */
+
+#ifndef SOURCE_FRONTEND_HPP_
+#define SOURCE_FRONTEND_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+
+#include "arm_math.h"
+#include "mel_log.h"
+
+
+namespace frontend
+{
+
+/*******************************************************************************
+* Compile-time math
+********************************************************************************/
+namespace detail
+{
+
+constexpr double pi = 3.14159265358979323846;
+constexpr double ln2 = 0.693147180559945309417;
+constexpr double ln10 = 2.30258509299404568402;
+
+/* Taylor series, |x| <= pi / 4 */
+constexpr double sin_reduced(double x)
+{
+    double term = x;
+    double sum = x;
+
+    for (int k = 1; k < 12; k++)
+    {
+        term *= -x * x / ((2 * k) * (2 * k + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cos_reduced(double x)
+{
+    double term = 1.0;
+    double sum = 1.0;
+
+    for (int k = 1; k < 12; k++)
+    {
+        term *= -x * x / ((2 * k - 1) * (2 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+/* x >= 0 */
+constexpr double cos(double x)
+{
+    const long quadrant = static_cast<long>(x / (pi / 2) + 0.5);
+    const double r = x - quadrant * (pi / 2);
+
+    switch (quadrant % 4)
+    {
+        case 0:
+            return cos_reduced(r);
+        case 1:
+            return -sin_reduced(r);
+        case 2:
+            return -cos_reduced(r);
+        default:
+            return sin_reduced(r);
+    }
+}
+
+/* x > 0 */
+constexpr double log(double x)
+{
+    int exponent = 0;
+    double sum = 0.0;
+
+    while (x > 1.41421356237309504880)
+    {
+        x /= 2;
+        exponent++;
+    }
+    while (x < 0.70710678118654752440)
+    {
+        x *= 2;
+        exponent--;
+    }
+    /* log(x) = 2 atanh((x - 1) / (x + 1)), |s| < 0.18 */
+    const double s = (x - 1) / (x + 1);
+    double term = s;
+
+    for (int k = 1; k < 40; k += 2)
+    {
+        sum += term / k;
+        term *= s * s;
+    }
+    return 2 * sum + exponent * ln2;
+}
+
+constexpr double exp(double x)
+{
+    const long exponent = static_cast<long>((x < 0) ? (x / ln2 - 0.5) : (x / ln2 + 0.5));
+    const double r = x - exponent * ln2;
+    double term = 1.0;
+    double sum = 1.0;
+
+    for (int k = 1; k < 24; k++)
+    {
+        term *= r / k;
+        sum += term;
+    }
+    for (long k = 0; k < exponent; k++)
+    {
+        sum *= 2;
+    }
+    for (long k = 0; k > exponent; k--)
+    {
+        sum /= 2;
+    }
+    return sum;
+}
+
+constexpr double hz_to_mel(double hz)
+{
+    return 2595.0 * log(1.0 + hz / 700.0) / ln10;
+}
+
+constexpr double mel_to_hz(double mel)
+{
+    return 700.0 * (exp(mel / 2595.0 * ln10) - 1.0);
+}
+
+/*******************************************************************************
+* Table generators
+********************************************************************************/
+/* Symmetric Hann window */
+template <int Size>
+constexpr std::array<float, Size> make_window()
+{
+    std::array<float, Size> window{};
+
+    for (int n = 0; n < Size; n++)
+    {
+        window[n] = static_cast<float>(0.5 - 0.5 * cos(2.0 * pi * n / (Size - 1)));
+    }
+    return window;
+}
+
+/* FFT bin of the MelCount + 2 filter edges */
+template <int FftSize, int MelCount, int SampleRate, int LowHz, int HighHz>
+constexpr std::array<int16_t, MelCount + 2> make_filter_points()
+{
+    std::array<int16_t, MelCount + 2> points{};
+    const double low = hz_to_mel(LowHz);
+    const double high = hz_to_mel(HighHz);
+
+    for (int i = 0; i < MelCount + 2; i++)
+    {
+        const double hz = mel_to_hz(low + (high - low) * i / (MelCount + 1));
+
+        points[i] = static_cast<int16_t>((FftSize + 1) * hz / SampleRate);
+    }
+    return points;
+}
+
+template <std::size_t Points>
+constexpr bool filter_points_increasing(const std::array<int16_t, Points> &points)
+{
+    for (std::size_t i = 1; i < Points; i++)
+    {
+        if (points[i] <= points[i - 1])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Every filter has coefficients from its first to its last edge, both included */
+template <std::size_t Points>
+constexpr int count_filter_coefs(const std::array<int16_t, Points> &points)
+{
+    int count = 0;
+
+    for (std::size_t j = 0; j + 2 < Points; j++)
+    {
+        count += points[j + 2] - points[j] + 1;
+    }
+    return count;
+}
+
+template <int Count, std::size_t Points>
+constexpr std::array<float, Count> make_filter_coefs(const std::array<int16_t, Points> &points)
+{
+    std::array<float, Count> coefs{};
+    int k = 0;
+
+    for (std::size_t j = 0; j + 2 < Points; j++)
+    {
+        const int rising = points[j + 1] - points[j];
+        const int falling = points[j + 2] - points[j + 1];
+
+        for (int i = 0; i <= rising; i++)
+        {
+            coefs[k++] = static_cast<float>(i) / static_cast<float>(rising);
+        }
+        for (int i = 1; i <= falling; i++)
+        {
+            const float rate = static_cast<float>(i) / static_cast<float>(falling);
+
+            coefs[k++] = static_cast<float>(1.0 - static_cast<double>(rate));
+        }
+    }
+    return coefs;
+}
+
+} /* namespace detail */
+
+
+/*******************************************************************************
+* Front-end
+********************************************************************************/
+template <int FftSize, int Hop, int MelCount, int SampleRate,
+          int LowHz = 200, int HighHz = 7000, typename ClipFloor = std::ratio<31, 100000>>
+class LogMelFrontend
+{
+public:
+    static constexpr int fft_size = FftSize;
+    static constexpr int hop = Hop;
+    static constexpr int mel_count = MelCount;
+    static constexpr int sample_rate = SampleRate;
+    static constexpr int bins = FftSize / 2 + 1;
+    static constexpr float clip_floor = static_cast<float>(static_cast<double>(ClipFloor::num) / ClipFloor::den);
+
+    static constexpr std::array<float, FftSize> window = detail::make_window<FftSize>();
+    static constexpr std::array<int16_t, MelCount + 2> filter_points =
+        detail::make_filter_points<FftSize, MelCount, SampleRate, LowHz, HighHz>();
+    static constexpr int filter_coef_count = detail::count_filter_coefs(filter_points);
+    static constexpr std::array<float, filter_coef_count> filter_coefs =
+        detail::make_filter_coefs<filter_coef_count>(filter_points);
+
+    static_assert((FftSize >= 32) && (FftSize <= 4096) && ((FftSize & (FftSize - 1)) == 0),
+                  "arm_rfft_fast_f32() needs a power of two from 32 to 4096");
+    static_assert((Hop > 0) && (Hop <= FftSize), "The hop must be within one window");
+    static_assert((MelCount > 0) && (0 <= LowHz) && (LowHz < HighHz) && (2 * HighHz <= SampleRate),
+                  "The mel range must be below Nyquist");
+    static_assert(clip_floor > 0.0f, "The clip floor must be above 0 for the log");
+    static_assert(detail::filter_points_increasing(filter_points),
+                  "Mel filters narrower than one FFT bin, use fewer bands or a larger FFT");
+    static_assert(filter_points[MelCount + 1] < bins, "Mel filters past the last FFT bin");
+
+    /*
+    * Initializes the real FFT of the configuration. The 512-point transform
+    * only links its own twiddle tables.
+    *
+    *  @param rfft FFT instance
+    *  @return 0 or -1 if CMSIS-DSP rejects the length
+    */
+    static int init(arm_rfft_fast_instance_f32 *rfft)
+    {
+        arm_status status;
+
+        if constexpr (FftSize == 512)
+        {
+            status = arm_rfft_fast_init_512_f32(rfft);
+        }
+        else
+        {
+            status = arm_rfft_fast_init_f32(rfft, FftSize);
+        }
+        return (status == ARM_MATH_SUCCESS) ? 0 : -1;
+    }
+
+    /*
+    * Computes the log-mel frame of one window.
+    *
+    *  @param rfft FFT instance set up by init()
+    *  @param samples Window, float[FftSize]
+    *  @param scratch_a Windowed samples, float[FftSize], used by the FFT and the mel kernel as scratch
+    *  @param scratch_b Packed spectrum, float[FftSize]
+    *  @param output Log-mel frame, float[MelCount]
+    */
+    static void frame(arm_rfft_fast_instance_f32 *rfft, const float *samples, float *scratch_a, float *scratch_b,
+                      float *output)
+    {
+        arm_mult_f32(samples, window.data(), scratch_a, FftSize);
+        arm_rfft_fast_f32(rfft, scratch_a, scratch_b, 0);
+        mel_log_f32(scratch_b, scratch_a, FftSize, filter_points.data(), filter_coefs.data(), MelCount,
+                    clip_floor, output);
+    }
+};
+
+/* The configuration of the conv1dlstm model */
+using ModelFrontend = LogMelFrontend<512, 320, 30, 16000>;
+
+} /* namespace frontend */
+
+
+#endif /* SOURCE_FRONTEND_HPP_ */
@@ -0,0 +1,200 @@
+/*
+ * frontend_q15.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Fixed-point version of the model front-end: Hann window, 512-point real
+ * FFT, magnitude, 30 band mel filterbank, clip and natural log. The frame is
+ * q15 (the boosted PDM samples as they are), the FFT and magnitude are
+ * arm_rfft_q15() and arm_cmplx_mag_q15(), and the mel energies are 64-bit
+ * dot products of the q15 filter coefficients with the magnitudes. Only the
+ * log is taken in float, from a 256 entry table, since the model input is
+ * float.
+ *
+ * arm_rfft_q15() scales its output down by 256 and keeps 16 bits, so quiet
+ * frames would lose most of their resolution. The frame is therefore
+ * normalized first (block floating point): it is shifted left until its
+ * peak uses the q15 range, and the shift is taken out again in the log
+ * domain, where it is an offset.
+ *
+ * The tables come from the generated model code through IMAI_init(), like
+ * the ones of the stereo front-end. Only built with FRONTEND_Q15_ENABLE.
+ */
+
+#include "frontend_q15.h"
+
+#include <math.h>
+
+#include "arm_math.h"
+
+#if FRONTEND_Q15_ENABLE
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* A mel dot product is sum(coef * mag) with q15 coefficients and 2.14
+ * magnitudes of an FFT output divided by 256, so the mel energy of the float
+ * front-end is the sum times 2^-(MEL_SUM_SHIFT + frame shift) */
+#define MEL_SUM_SHIFT                   (21)
+
+/* Entries of the ln(1 + x) table, x in [0, 1) */
+#define LOG_TABLE_BITS                  (8)
+#define LOG_TABLE_SIZE                  (1 << LOG_TABLE_BITS)
+
+#define LN2                             (0.69314718f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static arm_rfft_instance_q15 rfft_instance;
+
+static const int16_t *filter_points;
+static q15_t hann_window[FRONTEND_Q15_FFT_LEN];
+static q15_t filter_coefs[FRONTEND_Q15_MEL_COEFS_MAX];
+
+static float log_table[LOG_TABLE_SIZE + 1];
+static float log_floor;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static float log_q63(q63_t x);
+static int leading_zeros(uint32_t x);
+
+
+/*******************************************************************************
+* Function Name: frontend_q15_init
+********************************************************************************
+* Summary:
+*    Converts the window and filterbank of the generated model front-end to
+*    q15 and prepares the FFT and the log table.
+*
+* Parameters:
+*    window         FRONTEND_Q15_FFT_LEN Hann coefficients
+*    mel_points     FFT bin of every filter edge, FRONTEND_Q15_MEL_BANDS + 2 values
+*    mel_coefs      Coefficients of all filters, one after the other
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int frontend_q15_init(const float *window, const int16_t *mel_points, const float *mel_coefs)
+{
+    int coef_count = 0;
+
+    for (int i = 0; i < FRONTEND_Q15_MEL_BANDS; i++)
+    {
+        coef_count += mel_points[i + 2] - mel_points[i] + 1;
+    }
+    if (coef_count > FRONTEND_Q15_MEL_COEFS_MAX)
+    {
+        return -1;
+    }
+
+    if (arm_rfft_init_q15(&rfft_instance, FRONTEND_Q15_FFT_LEN, 0, 1) != ARM_MATH_SUCCESS)
+    {
+        return -1;
+    }
+
+    /* Both tables are in [0, 1], 1.0 saturates to 0x7FFF */
+    arm_float_to_q15(window, hann_window, FRONTEND_Q15_FFT_LEN);
+    arm_float_to_q15(mel_coefs, filter_coefs, coef_count);
+    filter_points = mel_points;
+
+    for (int i = 0; i <= LOG_TABLE_SIZE; i++)
+    {
+        log_table[i] = logf(1.0f + (float)i / LOG_TABLE_SIZE);
+    }
+    log_floor = logf(FRONTEND_Q15_MEL_FLOOR);
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: frontend_q15_frame
+********************************************************************************
+* Summary:
+*    Computes one log-mel frame from FRONTEND_Q15_FFT_LEN q15 samples. The
+*    result is in the units of the float front-end.
+*
+* Parameters:
+*    frame          Input samples, not modified
+*    scratch        FRONTEND_Q15_SCRATCH_SIZE bytes, 4 byte aligned
+*    log_mel        FRONTEND_Q15_MEL_BANDS values
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void frontend_q15_frame(const int16_t *frame, int16_t *scratch, float *log_mel)
+{
+    q15_t *windowed = scratch;
+    q15_t *spectrum = scratch + FRONTEND_Q15_FFT_LEN;
+    /* The windowed frame is consumed by the FFT */
+    q15_t *magnitude = scratch;
+    const q15_t *coefs = filter_coefs;
+    q15_t peak;
+    uint32_t peak_index;
+    int shift;
+
+    /* Shift until the peak is in [2^14, 2^15) */
+    arm_absmax_q15(frame, FRONTEND_Q15_FFT_LEN, &peak, &peak_index);
+    if (peak == 0)
+    {
+        for (int i = 0; i < FRONTEND_Q15_MEL_BANDS; i++)
+        {
+            log_mel[i] = log_floor;
+        }
+        return;
+    }
+    shift = leading_zeros((uint32_t) peak) - 17;
+    shift = (shift < 0) ? 0 : shift;
+
+    arm_shift_q15(frame, (int8_t) shift, windowed, FRONTEND_Q15_FFT_LEN);
+    arm_mult_q15(windowed, hann_window, windowed, FRONTEND_Q15_FFT_LEN);
+    arm_rfft_q15(&rfft_instance, windowed, spectrum);
+    arm_cmplx_mag_q15(spectrum, magnitude, FRONTEND_Q15_BINS);
+
+    for (int i = 0; i < FRONTEND_Q15_MEL_BANDS; i++)
+    {
+        int n0 = filter_points[i];
+        int len = filter_points[i + 2] - n0 + 1;
+        q63_t sum;
+        float value;
+
+        arm_dot_prod_q15(&magnitude[n0], coefs, len, &sum);
+        coefs += len;
+
+        value = (sum > 0) ? log_q63(sum) - (MEL_SUM_SHIFT + shift) * LN2 : log_floor;
+        log_mel[i] = (value < log_floor) ? log_floor : value;
+    }
+}
+
+
+/* ln(x) for x > 0: exponent from the leading one, mantissa from the table */
+static float log_q63(q63_t x)
+{
+    uint64_t bits = (uint64_t) x;
+    uint32_t high = (uint32_t)(bits >> 32);
+    int exponent = (high != 0) ? 63 - leading_zeros(high) : 31 - leading_zeros((uint32_t) bits);
+    /* 32 bits below the leading one */
+    uint32_t fraction = (uint32_t)((bits << (63 - exponent)) >> 31);
+    uint32_t index = fraction >> (32 - LOG_TABLE_BITS);
+    float weight = (float)(fraction << LOG_TABLE_BITS) * (1.0f / 4294967296.0f);
+
+    return exponent * LN2 + log_table[index] + (log_table[index + 1] - log_table[index]) * weight;
+}
+
+
+static int leading_zeros(uint32_t x)
+{
+#if defined(COMPONENT_CMSIS_DSP)
+    return __CLZ(x);
+#else
+    return (x == 0) ? 32 : __builtin_clz(x);
+#endif
+}
+
+#endif /* FRONTEND_Q15_ENABLE */
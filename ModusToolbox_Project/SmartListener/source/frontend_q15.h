@@ -0,0 +1,45 @@
+/*
+ * frontend_q15.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_FRONTEND_Q15_H_
+#define SOURCE_FRONTEND_Q15_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the model front-end in fixed point. The input window then
+ * holds q15 samples and ml_task.c feeds IMAI_enqueue_block_q15(). Mono only. */
+#ifndef FRONTEND_Q15_ENABLE
+#define FRONTEND_Q15_ENABLE                 (0)
+#endif
+
+/* Frame geometry of the model front-end */
+#define FRONTEND_Q15_FFT_LEN                (512)
+#define FRONTEND_Q15_BINS                   (FRONTEND_Q15_FFT_LEN / 2 + 1)
+#define FRONTEND_Q15_MEL_BANDS              (30)
+
+/* Clip and log of the model front-end */
+#define FRONTEND_Q15_MEL_FLOOR              (0.00031f)
+
+/* Largest number of mel filter coefficients */
+#define FRONTEND_Q15_MEL_COEFS_MAX          (512)
+
+/* Scratch memory of frontend_q15_frame(): the windowed frame and the real
+ * FFT output, which CMSIS writes for all FRONTEND_Q15_FFT_LEN bins */
+#define FRONTEND_Q15_SCRATCH_SIZE           (3 * FRONTEND_Q15_FFT_LEN * sizeof(int16_t))
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int frontend_q15_init(const float *window, const int16_t *mel_points, const float *mel_coefs);
+void frontend_q15_frame(const int16_t *frame, int16_t *scratch, float *log_mel);
+
+
+#endif /* SOURCE_FRONTEND_Q15_H_ */
@@ -0,0 +1,486 @@
+/*
+ * layer_profiler.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Per-operator profile of the model runner. The runner calls
+ * LAYER_PROFILER_BEGIN() with its arena before an invocation,
+ * LAYER_PROFILER_LAYER() with the output of every operator it ran and
+ * LAYER_PROFILER_END() with the scores. models/model.c marks the begin and
+ * the end around mtb_ml_model_run(), and LAYER_PROFILER_ATTACH() turns on
+ * the layer profiling of the ML middleware with mtb_ml_model_profile_config().
+ * The reference interpreter of the host build then marks every operator.
+ * The TFLM interpreter of the device times its operators with its own
+ * MicroProfiler, which layer_profiler_print() prints with
+ * mtb_ml_model_profile_log() after the report, and the report has the
+ * whole invocation as one INVOKE row.
+ *
+ * Each mark charges the time since the previous one to its operator, then
+ * finds the highest arena word that no longer holds the paint the arena got
+ * at the start of the invocation, and takes the min, max, mean and the
+ * non-finite count of the output. The clock is read again afterwards, so
+ * the scans are not charged to the next operator.
+ *
+ * layer_profiler_format() writes the same Memory usage and Latency tables as
+ * the code_generation_report.md of the ML configurator, with the measured
+ * numbers, followed by a table of the per-operator details.
+ *
+ * Timestamps come from the DWT cycle counter on the device and from
+ * CLOCK_MONOTONIC in the host build.
+ */
+
+#include "layer_profiler.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(COMPONENT_CM4)
+#include "cyhal.h"
+#else
+#include <time.h>
+#endif
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Latency column and clock named in the report */
+#if defined(COMPONENT_CM4)
+#define REPORT_TICKS                        "Cycles"
+#define REPORT_CLOCK                        "DWT cycles"
+#else
+#define REPORT_TICKS                        "ns"
+#define REPORT_CLOCK                        "CLOCK_MONOTONIC ns"
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t last;
+    uint64_t total;
+    uint32_t high_water;
+    float output_min;
+    float output_max;
+    double output_sum;
+    uint32_t output_elements;
+    uint32_t output_non_finite;
+} layer_state_t;
+
+static layer_state_t layers[LAYER_PROFILER_MAX_LAYERS];
+static int layer_count;
+
+/* Current invocation */
+static mtb_ml_model_t *profiled_model;
+static const char *runner_name = "";
+static uint32_t *arena_words;
+static uint32_t arena_bytes;
+static uint32_t model_bytes;
+static uint32_t invocations;
+static int layer_index;
+static uint32_t high_water_words;
+static uint32_t last_ticks;
+
+static char report[LAYER_PROFILER_REPORT_MAX];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t now_ticks(void);
+static const char *group_digits(uint64_t value, char *text, size_t size);
+static int append(char *buffer, size_t size, int length, const char *format, ...)
+    __attribute__((format(printf, 4, 5)));
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_reset
+********************************************************************************
+* Summary:
+*    Clears the measurements of all operators and starts the time base.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void layer_profiler_reset(void)
+{
+    memset(layers, 0, sizeof(layers));
+    for (int i = 0; i < LAYER_PROFILER_MAX_LAYERS; i++)
+    {
+        layers[i].min = UINT32_MAX;
+        layers[i].output_min = FLT_MAX;
+        layers[i].output_max = -FLT_MAX;
+    }
+    layer_count = 0;
+    invocations = 0;
+#if defined(COMPONENT_CM4)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    last_ticks = now_ticks();
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_unit
+********************************************************************************
+* Summary:
+*    Returns the unit of the ticks, "cycles" on the device and "ns" on the
+*    host.
+*
+*******************************************************************************/
+const char *layer_profiler_unit(void)
+{
+#if defined(COMPONENT_CM4)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+
+uint32_t layer_profiler_invocations(void)
+{
+    return invocations;
+}
+
+
+int layer_profiler_layer_count(void)
+{
+    return layer_count;
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_get_stats
+********************************************************************************
+* Summary:
+*    Returns the measurements of one operator since the last reset.
+*
+* Parameters:
+*    layer          Operator, 0 to layer_profiler_layer_count() - 1 in the
+*                   order the runner marks them
+*    stats          Filled with the statistics, all 0 if the operator never ran
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void layer_profiler_get_stats(int layer, layer_profiler_stats_t *stats)
+{
+    const layer_state_t *state = &layers[layer];
+
+    memset(stats, 0, sizeof(*stats));
+    if ((layer < 0) || (layer >= layer_count) || (state->count == 0))
+    {
+        return;
+    }
+    stats->name = state->name;
+    stats->count = state->count;
+    stats->min = state->min;
+    stats->max = state->max;
+    stats->total = state->total;
+    stats->mean = (uint32_t)(state->total / state->count);
+    stats->last = state->last;
+    stats->arena_high_water = state->high_water;
+    stats->output_elements = state->output_elements;
+    stats->output_non_finite = state->output_non_finite;
+    if (state->output_elements > 0)
+    {
+        stats->output_min = state->output_min;
+        stats->output_max = state->output_max;
+        stats->output_mean = (float)(state->output_sum / ((double)state->output_elements * state->count));
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_format
+********************************************************************************
+* Summary:
+*    Formats the measurements as a markdown report. The Memory usage and
+*    Latency tables have the rows and columns of code_generation_report.md:
+*    the model memory, the arena high-water mark as scratch memory and the
+*    mean ticks per invocation of every operator. A Layers table adds the
+*    spread of the ticks, the high-water mark after every operator and the
+*    output statistics.
+*
+* Parameters:
+*    buffer         Report, LAYER_PROFILER_REPORT_MAX bytes are always enough
+*    size           Size of the buffer
+*
+* Return:
+*    Length of the report, as snprintf()
+*
+*******************************************************************************/
+int layer_profiler_format(char *buffer, size_t size)
+{
+    uint32_t scratch = 0;
+    uint64_t total = 0;
+    char text[4][24];
+    int length = 0;
+
+    for (int i = 0; i < layer_count; i++)
+    {
+        layer_profiler_stats_t stats;
+
+        layer_profiler_get_stats(i, &stats);
+        total += stats.mean;
+        scratch = (stats.arena_high_water > scratch) ? stats.arena_high_water : scratch;
+    }
+
+    length = append(buffer, size, length, "# Model performance and validation report\n"
+                    "**Runner:** %s, arena %s bytes  \n"
+                    "**Invocations:** %lu, %s\n\n",
+                    runner_name, group_digits(arena_bytes, text[0], sizeof(text[0])),
+                    (unsigned long)invocations, REPORT_CLOCK);
+    length = append(buffer, size, length, "### Memory usage\n"
+                    "| Model | Model memory | Scratch memory |\n"
+                    "| :--- | :--- | :--- |\n"
+                    "| float | %s | %s |\n\n",
+                    group_digits(model_bytes, text[0], sizeof(text[0])), group_digits(scratch, text[1], sizeof(text[1])));
+
+    length = append(buffer, size, length, "### Latency\n"
+                    "| Layer | %s |\n"
+                    "| :--- | :--- |\n", REPORT_TICKS);
+    for (int i = 0; i < layer_count; i++)
+    {
+        layer_profiler_stats_t stats;
+
+        layer_profiler_get_stats(i, &stats);
+        length = append(buffer, size, length, "| %s | %s |\n", stats.name, group_digits(stats.mean, text[0], sizeof(text[0])));
+    }
+    length = append(buffer, size, length, "| **TOTAL** | **%s** |\n\n", group_digits(total, text[0], sizeof(text[0])));
+
+    length = append(buffer, size, length, "### Layers\n"
+                    "| Layer | Min | Max | Last | Arena high-water | Output min | Output max | Output mean | Non-finite |\n"
+                    "| :--- | :--- | :--- | :--- | :--- | :--- | :--- | :--- | :--- |\n");
+    for (int i = 0; i < layer_count; i++)
+    {
+        layer_profiler_stats_t stats;
+
+        layer_profiler_get_stats(i, &stats);
+        length = append(buffer, size, length, "| %s | %s | %s | %s | %s | %.4g | %.4g | %.4g | %lu |\n", stats.name,
+                        group_digits(stats.min, text[0], sizeof(text[0])), group_digits(stats.max, text[1], sizeof(text[1])),
+                        group_digits(stats.last, text[2], sizeof(text[2])),
+                        group_digits(stats.arena_high_water, text[3], sizeof(text[3])), (double)stats.output_min,
+                        (double)stats.output_max, (double)stats.output_mean, (unsigned long)stats.output_non_finite);
+    }
+    return length;
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_print
+********************************************************************************
+* Summary:
+*    Prints the report of layer_profiler_format() on the UART.
+*
+*******************************************************************************/
+void layer_profiler_print(void)
+{
+    const char *line = report;
+
+    layer_profiler_format(report, sizeof(report));
+    while (*line != '\0')
+    {
+        const char *end = strchr(line, '\n');
+        const int count = (end != NULL) ? (int)(end - line) : (int)strlen(line);
+
+        printf("%.*s\r\n", count, line);
+        line += count + ((end != NULL) ? 1 : 0);
+    }
+    if (profiled_model != NULL)
+    {
+        mtb_ml_model_profile_log(profiled_model);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_attach
+********************************************************************************
+* Summary:
+*    Turns on the layer profiling of the ML middleware for a model object,
+*    layer_profiler_print() then also prints its log.
+*
+* Parameters:
+*    model          Model object of mtb_ml_model_init()
+*
+*******************************************************************************/
+void layer_profiler_attach(mtb_ml_model_t *model)
+{
+    profiled_model = model;
+    mtb_ml_model_profile_config(model, MTB_ML_PROFILE_ENABLE_LAYER);
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_begin
+********************************************************************************
+* Summary:
+*    Starts an invocation: paints the arena with LAYER_PROFILER_PAINT and
+*    starts timing the first operator.
+*
+* Parameters:
+*    runner         Name of the runner in the report, e.g. "tflm"
+*    arena          Activations of the runner, 4-byte aligned, NULL for none
+*    arena_size     Bytes of the arena
+*    model_size     Bytes of the weights or of the flatbuffer
+*
+*******************************************************************************/
+void layer_profiler_begin(const char *runner, void *arena, uint32_t arena_size, uint32_t model_size)
+{
+    runner_name = runner;
+    arena_words = (uint32_t *)arena;
+    arena_bytes = (arena != NULL) ? arena_size : 0;
+    model_bytes = model_size;
+    for (uint32_t w = 0; w < arena_bytes / sizeof(uint32_t); w++)
+    {
+        arena_words[w] = LAYER_PROFILER_PAINT;
+    }
+    high_water_words = 0;
+    layer_index = 0;
+    invocations++;
+    last_ticks = now_ticks();
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_layer
+********************************************************************************
+* Summary:
+*    Charges the time since the previous mark to the next operator of the
+*    invocation, and records the arena high-water mark and the statistics of
+*    its output.
+*
+* Parameters:
+*    name           Operator name, must stay valid
+*    output         Output of the operator
+*    count          Floats of the output
+*
+*******************************************************************************/
+void layer_profiler_layer(const char *name, const float *output, uint32_t count)
+{
+    const uint32_t ticks = now_ticks() - last_ticks;
+    layer_state_t *state;
+    uint32_t w = arena_bytes / sizeof(uint32_t);
+
+    if (layer_index >= LAYER_PROFILER_MAX_LAYERS)
+    {
+        last_ticks = now_ticks();
+        return;
+    }
+    state = &layers[layer_index++];
+    layer_count = (layer_index > layer_count) ? layer_index : layer_count;
+
+    state->name = name;
+    state->count++;
+    state->total += ticks;
+    state->last = ticks;
+    state->min = (ticks < state->min) ? ticks : state->min;
+    state->max = (ticks > state->max) ? ticks : state->max;
+
+    /* Written words only grow during an invocation, scan down to the last mark */
+    while ((w > high_water_words) && (arena_words[w - 1] == LAYER_PROFILER_PAINT))
+    {
+        w--;
+    }
+    high_water_words = (w > high_water_words) ? w : high_water_words;
+    if (high_water_words * sizeof(uint32_t) > state->high_water)
+    {
+        state->high_water = high_water_words * sizeof(uint32_t);
+    }
+
+    state->output_elements = count;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!isfinite(output[i]))
+        {
+            state->output_non_finite++;
+            continue;
+        }
+        state->output_min = (output[i] < state->output_min) ? output[i] : state->output_min;
+        state->output_max = (output[i] > state->output_max) ? output[i] : state->output_max;
+        state->output_sum += output[i];
+    }
+    last_ticks = now_ticks();
+}
+
+
+/*******************************************************************************
+* Function Name: layer_profiler_end
+********************************************************************************
+* Summary:
+*    Ends an invocation. If the runner marked no operator, the whole
+*    invocation is charged to one INVOKE operator with the scores as output.
+*
+* Parameters:
+*    output         Output of the invocation
+*    count          Floats of the output
+*
+*******************************************************************************/
+void layer_profiler_end(const float *output, uint32_t count)
+{
+    if (layer_index == 0)
+    {
+        layer_profiler_layer("INVOKE", output, count);
+    }
+}
+
+
+static uint32_t now_ticks(void)
+{
+#if defined(COMPONENT_CM4)
+    return DWT->CYCCNT;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec);
+#endif
+}
+
+
+/* 1234567 as "1,234,567", like code_generation_report.md */
+static const char *group_digits(uint64_t value, char *text, size_t size)
+{
+    char digits[24];
+    const int count = snprintf(digits, sizeof(digits), "%llu", (unsigned long long)value);
+    size_t out = 0;
+
+    for (int i = 0; (i < count) && (out + 2 < size); i++)
+    {
+        if ((i > 0) && ((count - i) % 3 == 0))
+        {
+            text[out++] = ',';
+        }
+        text[out++] = digits[i];
+    }
+    text[out] = '\0';
+    return text;
+}
+
+
+/* snprintf() at the end of the report, the length keeps counting when full */
+static int append(char *buffer, size_t size, int length, const char *format, ...)
+{
+    va_list args;
+    int written;
+
+    va_start(args, format);
+    written = vsnprintf(buffer + ((size_t)length < size ? (size_t)length : size),
+                        ((size_t)length < size) ? size - length : 0, format, args);
+    va_end(args);
+    return length + written;
+}
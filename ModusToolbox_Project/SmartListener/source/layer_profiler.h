@@ -0,0 +1,101 @@
+/*
+ * layer_profiler.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_LAYER_PROFILER_H_
+#define SOURCE_LAYER_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mtb_ml_model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to time every operator of the model runner and record the arena
+ * high-water mark and the output tensor statistics after it. With 0 the
+ * marks compile to nothing. */
+#ifndef LAYER_PROFILER_ENABLE
+#define LAYER_PROFILER_ENABLE               (0)
+#endif
+
+/* Largest number of operators per invocation, RESHAPE included */
+#define LAYER_PROFILER_MAX_LAYERS           (32)
+
+/* Network invocations between two reports of ml_task.c, one per model window
+ * the activity gate and the cascade let through */
+#define LAYER_PROFILER_DUMP_INVOCATIONS     (500u)
+
+/* Largest report of layer_profiler_format() for LAYER_PROFILER_MAX_LAYERS */
+#define LAYER_PROFILER_REPORT_MAX           (8192)
+
+/* Word the arena is painted with before every invocation, a signalling NaN
+ * no operator writes */
+#define LAYER_PROFILER_PAINT                (0x7FA5A5A5u)
+
+#if LAYER_PROFILER_ENABLE
+/* Turns on the layer profiling of the ML middleware for the model object */
+#define LAYER_PROFILER_ATTACH(model)        layer_profiler_attach(model)
+/* Paints the arena and starts timing the first operator */
+#define LAYER_PROFILER_BEGIN(runner, arena, arena_size, model_size) \
+                                            layer_profiler_begin(runner, arena, arena_size, model_size)
+/* Ends an operator, its output is float[count] */
+#define LAYER_PROFILER_LAYER(name, output, count) \
+                                            layer_profiler_layer(name, output, count)
+/* Ends an invocation, its output is float[count] */
+#define LAYER_PROFILER_END(output, count)   layer_profiler_end(output, count)
+#else
+#define LAYER_PROFILER_ATTACH(model)        do { } while (0)
+#define LAYER_PROFILER_BEGIN(runner, arena, arena_size, model_size) do { } while (0)
+#define LAYER_PROFILER_LAYER(name, output, count) do { } while (0)
+#define LAYER_PROFILER_END(output, count)   do { } while (0)
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* One operator over all invocations since the last reset. Ticks are CPU
+ * cycles on the device (DWT) and nanoseconds on the host. */
+typedef struct {
+    const char *name;               /* TFLite operator name, e.g. "CONV_2D" */
+    uint32_t count;                 /* Invocations */
+    uint32_t min;
+    uint32_t mean;
+    uint32_t max;
+    uint64_t total;
+    uint32_t last;                  /* Ticks of the last invocation */
+    uint32_t arena_high_water;      /* Bytes of the arena written up to this operator */
+    float output_min;               /* Over every output element of every invocation */
+    float output_max;
+    float output_mean;
+    uint32_t output_elements;       /* Per invocation */
+    uint32_t output_non_finite;     /* NaN or infinite elements, all invocations */
+} layer_profiler_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void layer_profiler_reset(void);
+const char *layer_profiler_unit(void);
+uint32_t layer_profiler_invocations(void);
+int layer_profiler_layer_count(void);
+void layer_profiler_get_stats(int layer, layer_profiler_stats_t *stats);
+
+/* Markdown report in the table shape of code_generation_report.md, and its
+ * UART dump */
+int layer_profiler_format(char *buffer, size_t size);
+void layer_profiler_print(void);
+
+/* Called through the LAYER_PROFILER_ macros */
+void layer_profiler_attach(mtb_ml_model_t *model);
+void layer_profiler_begin(const char *runner, void *arena, uint32_t arena_size, uint32_t model_size);
+void layer_profiler_layer(const char *name, const float *output, uint32_t count);
+void layer_profiler_end(const float *output, uint32_t count);
+
+
+#endif /* SOURCE_LAYER_PROFILER_H_ */
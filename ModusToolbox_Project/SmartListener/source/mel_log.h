@@ -0,0 +1,29 @@
+/*
+ * mel_log.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_MEL_LOG_H_
+#define SOURCE_MEL_LOG_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void mel_log_f32(const float *spectrum, float *scratch, int fft_len, const int16_t *filter_points,
+                 const float *filter_coefs, int num_filter, float floor, float *output);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOURCE_MEL_LOG_H_ */
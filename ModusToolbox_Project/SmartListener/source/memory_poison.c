@@ -0,0 +1,63 @@
+/*
+ * memory_poison.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Poisoning of dead buffers for the memory plan of models/model.c. The
+ * front-end scratch and the model arena share one working area, and
+ * models/model.c calls MEMORY_POISON() on every buffer at the end of its
+ * lifetime. A step that still reads a buffer after that point, which the
+ * plan may already have given to another buffer, reads NaN instead of stale
+ * data that happens to be right.
+ */
+
+#include "memory_poison.h"
+
+#include <stddef.h>
+#include <string.h>
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static uint32_t poison_count;
+
+
+/*******************************************************************************
+* Function Name: memory_poison
+********************************************************************************
+* Summary:
+*    Fills a buffer with MEMORY_POISON_WORD.
+*
+* Parameters:
+*    buffer         Buffer whose lifetime ended, NULL for none
+*    bytes          Size of the buffer, a trailing partial word gets the
+*                   low bytes of the pattern
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void memory_poison(void *buffer, uint32_t bytes)
+{
+    const uint32_t word = MEMORY_POISON_WORD;
+    uint8_t *bytes_out = (uint8_t *)buffer;
+
+    if (buffer == NULL)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i + sizeof(word) <= bytes; i += sizeof(word))
+    {
+        memcpy(&bytes_out[i], &word, sizeof(word));
+    }
+    memcpy(&bytes_out[bytes - bytes % sizeof(word)], &word, bytes % sizeof(word));
+    poison_count++;
+}
+
+
+uint32_t memory_poison_count(void)
+{
+    return poison_count;
+}
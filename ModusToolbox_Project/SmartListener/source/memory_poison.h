@@ -0,0 +1,44 @@
+/*
+ * memory_poison.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_MEMORY_POISON_H_
+#define SOURCE_MEMORY_POISON_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to overwrite every planned buffer of models/model.c when its
+ * lifetime ends, so a buffer read after the memory plan gave its bytes to
+ * another one yields NaN scores. Meant for the host, see memory-plan. With 0
+ * the calls compile to nothing. */
+#ifndef MEMORY_POISON_ENABLE
+#define MEMORY_POISON_ENABLE                (0)
+#endif
+
+/* Word a dead buffer is filled with, a NaN that no computation produces */
+#define MEMORY_POISON_WORD                  (0x7FBADBADu)
+
+#if MEMORY_POISON_ENABLE
+#define MEMORY_POISON(buffer, bytes)        memory_poison(buffer, bytes)
+#else
+#define MEMORY_POISON(buffer, bytes)        do { } while (0)
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* Called through MEMORY_POISON(), NULL is ignored */
+void memory_poison(void *buffer, uint32_t bytes);
+
+/* Buffers poisoned since start-up */
+uint32_t memory_poison_count(void);
+
+
+#endif /* SOURCE_MEMORY_POISON_H_ */
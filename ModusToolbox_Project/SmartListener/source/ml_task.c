@@ -15,25 +15,22 @@
 #include <models/model.h>
 
 #include "publisher_task.h"
+#include "capture_task.h"
+#include "audio_ingest.h"
+#include "activity_gate.h"
+#include "cascade_model.h"
+#include "deadline_monitor.h"
+#include "resampler.h"
+#include "event_clip.h"
+#include "frontend_q15.h"
+#include "stereo_frontend.h"
+#include "sound_level.h"
+#include "stage_profiler.h"
+#include "layer_profiler.h"
 
 /*******************************************************************************
 * Macros
 ********************************************************************************/
-/* Desired sample rate. Typical values: 8/16/22.05/32/44.1/48 kHz */
-#define SAMPLE_RATE_HZ              16000
-
-/* Audio Subsystem Clock. Typical values depends on the desire sample rate:
-- 8/16/48kHz    : 24.576 MHz
-- 22.05/44.1kHz : 22.579 MHz */
-#define AUDIO_SYS_CLOCK_HZ          24576000
-
-/* Decimation Rate of the PDM/PCM block. Typical value is 64 */
-#define DECIMATION_RATE             64
-
-/* Microphone sensitivity
- * PGA in 0.5 dB increment, for example a value of 5 would mean +2.5 dB. */
-#define MICROPHONE_GAIN             20
-
 /* Multiplication factor of the input signal.
  * This should ideally be 1. Higher values will have a negative impact on
  * the sampling dynamic range. However, it can be used as a last resort 
@@ -43,20 +40,6 @@
  * deployment of your own ML model set this to 1.0. */
 #define DIGITAL_BOOST_FACTOR            10.0f
 
-/* Specifies the dynamic range in bits.
- * PCM word length, see the A/D specific documentation for valid ranges. */
-#define AUIDO_BITS_PER_SAMPLE       16
-
-/* PDM/PCM Pins */
-#define PDM_DATA                    P10_5
-#define PDM_CLK                     P10_4
-
-/* Size of audio buffer */
-#define AUDIO_BUFFER_SIZE           512
-
-/* Converts given audio sample into range [-1,1] */
-#define SAMPLE_NORMALIZE(sample)        (((float) (sample)) / (float) (1 << (AUIDO_BITS_PER_SAMPLE - 1)))
-
 /* DEEPCRAFT compatibility defines to support all versions of code generation APIs */
 #ifndef IPWIN_RET_SUCCESS
 #define IPWIN_RET_SUCCESS (0)
@@ -72,6 +55,39 @@
 #endif
 /* End DEEPCFRAT compatibility defines */
 
+/* Sample rate the model was trained at. When SAMPLE_RATE_HZ differs, the
+ * captured blocks are resampled to this rate before they reach the model. */
+#define MODEL_SAMPLE_RATE_HZ            16000
+
+#if SAMPLE_RATE_HZ != MODEL_SAMPLE_RATE_HZ
+#define ML_TASK_RESAMPLE                1
+#if AUDIO_CAPTURE_CHANNELS == 2
+#error "The stereo front-end requires SAMPLE_RATE_HZ == MODEL_SAMPLE_RATE_HZ"
+#endif
+/* Largest number of model rate samples produced from one capture block */
+#define ML_TASK_BLOCK_SIZE              RESAMPLER_MAX_OUTPUT(AUDIO_CAPTURE_BLOCK_SIZE, SAMPLE_RATE_HZ, MODEL_SAMPLE_RATE_HZ)
+#else
+#define ML_TASK_RESAMPLE                0
+#define ML_TASK_BLOCK_SIZE              AUDIO_CAPTURE_BLOCK_SIZE
+#endif
+
+/* The fixed-point front-end takes the boosted samples in q15 */
+#if FRONTEND_Q15_ENABLE
+#if AUDIO_CAPTURE_CHANNELS == 2
+#error "The fixed-point front-end (FRONTEND_Q15_ENABLE) is mono only"
+#endif
+typedef int16_t model_sample_t;
+#else
+typedef float model_sample_t;
+#endif
+
+#if (AUDIO_CAPTURE_CHANNELS == 2) && !STEREO_FRONTEND_ENABLE
+#error "Stereo capture needs the stereo front-end (STEREO_FRONTEND_ENABLE)"
+#endif
+
+/* Hop of the model front-end in samples (stride of its 512-sample window) */
+#define MODEL_FRAME_HOP                 320
+
 #define LOG_ENABLE 0
 
 #define DEBOUNCE_THRESHOLD 3
@@ -80,6 +96,28 @@ static int last_seen_label = -1;
 static int debounce_counter = 0;
 static int confirmed_label = -1;
 
+#if ML_TASK_RESAMPLE == 1
+/* Capture rate to model rate, holds the coefficients and the input history */
+static resampler_t resampler;
+#endif
+
+/* Pre-roll of the model input, and the copy uploaded with a confirmed event */
+static event_clip_recorder_t clip_recorder;
+static event_clip_t event_clip;
+static uint16_t event_clip_id = 0;
+
+#if SOUND_LEVEL_ENABLE
+/* Last sound level report, and its payload while it is being published */
+static sound_level_report_t level_report;
+static char level_payload[SOUND_LEVEL_PAYLOAD_MAX];
+#endif
+
+#if STAGE_PROFILER_ENABLE
+/* Model outputs since the last stage profile dump, and its payload */
+static uint32_t profile_outputs = 0;
+static char profile_payload[STAGE_PROFILER_PAYLOAD_MAX];
+#endif
+
 extern QueueHandle_t publisher_task_q;
 
 
@@ -87,27 +125,46 @@ extern QueueHandle_t publisher_task_q;
 * Function Prototypes
 *******************************************************************************/
 //static void init_board(void);
-static void init_audio(cyhal_pdm_pcm_t* pdm_pcm);
 static void halt_error(int code);
-static void pdm_frequency_fix();
 
 
 void ml_inference_task(void *pvParameters)
 {   
-    int16_t audio_buffer[AUDIO_BUFFER_SIZE] = {0};
+    int16_t audio_buffer[AUDIO_CAPTURE_BLOCK_SAMPLES];
+    model_sample_t audio_samples[ML_TASK_BLOCK_SIZE];
+    #if ML_TASK_RESAMPLE == 1
+    int16_t resampled_buffer[ML_TASK_BLOCK_SIZE];
+    #endif
+    size_t block_size = AUDIO_CAPTURE_BLOCK_SIZE;
+    #if AUDIO_CAPTURE_CHANNELS == 2
+    float audio_samples_right[AUDIO_CAPTURE_BLOCK_SIZE];
+    #endif
     float label_scores[IMAI_DATA_OUT_COUNT];
     char *label_text[] = IMAI_DATA_OUT_SYMBOLS;
     publisher_data_t publisher_q_data;
+    #if SOUND_LEVEL_ENABLE
+    sound_level_config_t level_config;
+    #endif
 
     cy_rslt_t result;
-    size_t audio_count;
-    cyhal_pdm_pcm_t pdm_pcm;
+    int output_count;
+    #if LOG_ENABLE == 1
+    capture_task_stats_t capture_stats;
+    activity_gate_stats_t gate_stats;
+    #if CASCADE_MODEL_ENABLE
+    cascade_model_stats_t cascade_stats;
+    #endif
+    deadline_stats_t block_deadline;
+    deadline_stats_t output_deadline;
+    uint32_t ingest_cycles = 0;
+    uint32_t clip_cycles = 0;
+    uint32_t enqueue_cycles = 0;
+    uint64_t frontend_cycles = 0;
+    uint64_t frontend_samples = 0;
+    #endif
     int16_t best_label = 0;
-    float sample = 0.0f;
-    float sample_abs = 0.0f;
     float max_score = 0.0f;
     float sample_max = 0;
-    float sample_max_slow = 0;
 
     /* Basic board setup */
     //init_board();
@@ -116,55 +173,155 @@ void ml_inference_task(void *pvParameters)
     result = IMAI_init();
     halt_error(result);
 
-    /* Initialize audio sampling */
-    init_audio(&pdm_pcm);
+    /* A-weighted level meter on the spectrum of the model front-end. The q15
+     * and stereo front-ends publish no magnitudes, no level is reported. */
+    #if SOUND_LEVEL_ENABLE
+    sound_level_default_config(&level_config);
+    level_config.input_gain = DIGITAL_BOOST_FACTOR;
+    result = sound_level_init(&level_config);
+    halt_error(result);
+    #endif
+
+    #if STAGE_PROFILER_ENABLE
+    stage_profiler_reset();
+    #endif
+
+    #if LAYER_PROFILER_ENABLE
+    layer_profiler_reset();
+    #endif
+
+    #if ML_TASK_RESAMPLE == 1
+    result = resampler_init(&resampler, SAMPLE_RATE_HZ, MODEL_SAMPLE_RATE_HZ);
+    halt_error(result);
+    #endif
+
+    event_clip_recorder_init(&clip_recorder, MODEL_SAMPLE_RATE_HZ);
+    event_clip_init(&event_clip);
+
+    /* Start the deadline monitor. This also enables the DWT cycle counter
+     * used to time the ingest stage. */
+    deadline_monitor_init(1.0f);
 
     vTaskDelay(pdMS_TO_TICKS(2000));
 
+    /* Start audio sampling. The Capture Task runs at a higher priority and
+     * buffers the samples in a ring this task drains. */
+    result = capture_task_start();
+    halt_error(result);
+
     while(1)
     {
-        /* Initialize the audio_buffer to zeroes and read data
-         * from the pdm mic into it */
-        audio_count = AUDIO_BUFFER_SIZE;
-        memset(audio_buffer, 0, AUDIO_BUFFER_SIZE * sizeof(uint16_t));
-        result = cyhal_pdm_pcm_read(&pdm_pcm, (void *) audio_buffer, &audio_count);
+        /* Wait for the next block from the Capture Task. Capture continues
+         * into the ring while we process it. */
+        result = capture_task_read(audio_buffer, AUDIO_CAPTURE_BLOCK_SAMPLES, AUDIO_CAPTURE_WAIT_FOREVER);
         halt_error(result);
-
-        sample_max_slow -= 0.0005;
-        sample_max = 0;
-        for(int i = 0; i < audio_count; i++)
+        deadline_monitor_block_begin(capture_task_backlog() / AUDIO_CAPTURE_CHANNELS);
+
+        /* Convert, boost and clamp the block for the model. The peak goes
+         * into the sound level reports, a peak of 0 dBFS there means the
+         * boosted input clipped */
+        #if LOG_ENABLE == 1
+        ingest_cycles = DWT->CYCCNT;
+        #endif
+        #if AUDIO_CAPTURE_CHANNELS == 2
+        sample_max = audio_ingest_stereo_block(audio_buffer, audio_samples, audio_samples_right,
+                                               AUDIO_CAPTURE_BLOCK_SIZE, DIGITAL_BOOST_FACTOR);
+        #elif ML_TASK_RESAMPLE == 1
+        /* Bring the block to the model rate first. The number of samples
+         * produced varies from block to block by one. */
+        block_size = resampler_process(&resampler, audio_buffer, AUDIO_CAPTURE_BLOCK_SIZE, resampled_buffer);
+        #if FRONTEND_Q15_ENABLE
+        sample_max = audio_ingest_block_q15(resampled_buffer, audio_samples, block_size, DIGITAL_BOOST_FACTOR);
+        #else
+        sample_max = audio_ingest_block(resampled_buffer, audio_samples, block_size, DIGITAL_BOOST_FACTOR);
+        #endif
+        #elif FRONTEND_Q15_ENABLE
+        sample_max = audio_ingest_block_q15(audio_buffer, audio_samples, AUDIO_CAPTURE_BLOCK_SIZE, DIGITAL_BOOST_FACTOR);
+        #else
+        sample_max = audio_ingest_block(audio_buffer, audio_samples, AUDIO_CAPTURE_BLOCK_SIZE, DIGITAL_BOOST_FACTOR);
+        #endif
+        #if LOG_ENABLE == 1
+        ingest_cycles = DWT->CYCCNT - ingest_cycles;
+        clip_cycles = DWT->CYCCNT;
+        #endif
+
+        /* Keep the pre-roll of the model input (left channel in stereo) */
+        #if AUDIO_CAPTURE_CHANNELS == 2
+        event_clip_recorder_write(&clip_recorder, audio_buffer, AUDIO_CAPTURE_BLOCK_SIZE, 2);
+        #elif ML_TASK_RESAMPLE == 1
+        event_clip_recorder_write(&clip_recorder, resampled_buffer, block_size, 1);
+        #else
+        event_clip_recorder_write(&clip_recorder, audio_buffer, AUDIO_CAPTURE_BLOCK_SIZE, 1);
+        #endif
+        #if LOG_ENABLE == 1
+        clip_cycles = DWT->CYCCNT - clip_cycles;
+        #endif
+
+        #if SOUND_LEVEL_ENABLE
+        sound_level_peak(sample_max);
+        #else
+        (void)sample_max;
+        #endif
+
+        /* Pass the whole block to the model. The front-end only runs when a
+         * hop boundary is crossed, the return value is the number of score
+         * vectors ready to be dequeued. In stereo both channels get their
+         * own FFT and the better one (see stereo_frontend.c) feeds the model. */
+        #if LOG_ENABLE == 1
+        enqueue_cycles = DWT->CYCCNT;
+        #endif
+        #if AUDIO_CAPTURE_CHANNELS == 2
+        output_count = IMAI_enqueue_block_stereo(audio_samples, audio_samples_right, block_size);
+        #elif FRONTEND_Q15_ENABLE
+        output_count = IMAI_enqueue_block_q15(audio_samples, block_size);
+        #else
+        output_count = IMAI_enqueue_block(audio_samples, block_size);
+        #endif
+        halt_error(output_count < 0 ? output_count : 0);
+        #if LOG_ENABLE == 1
+        enqueue_cycles = DWT->CYCCNT - enqueue_cycles;
+        /* A block that completed no model window only ran the front-end */
+        if (output_count == 0)
         {
-            /* Convert integer sample to float and pass it to the model */
-            sample = SAMPLE_NORMALIZE(audio_buffer[i]) * DIGITAL_BOOST_FACTOR;
-            if (sample > 1.0)
-            {
-                sample = 1.0;
-            }
-            else if (sample < -1.0)
-            {
-                sample = -1.0;
-            }
-            result = IMAI_enqueue(&sample);
-            halt_error(result);
-
-            /* Used to tune gain control. sample_max should be near 1.0 
-             * when shouting directly into the microphone */
-            sample_abs = fabs(sample);
-            if(sample_abs > sample_max)
-            {
-                sample_max = sample_abs;
-            }
+            frontend_cycles += enqueue_cycles;
+            frontend_samples += block_size;
+        }
+        #endif
 
-            if(sample_max > sample_max_slow)
-            {
-                sample_max_slow = sample_max;
-            }
+        while(output_count-- > 0)
+        {
             /* Check if there is any model output to process */
             best_label = 0;
             max_score = -1000.0f;
             switch(IMAI_dequeue(label_scores))
             {
                 case IMAI_RET_SUCCESS:      /* We have data, display it */
+                    deadline_monitor_output();
+
+                    #if STAGE_PROFILER_ENABLE
+                    /* Dump the stage timing on the UART and MQTT, then
+                     * start over so every dump covers one period */
+                    if (++profile_outputs == STAGE_PROFILER_DUMP_OUTPUTS)
+                    {
+                        profile_outputs = 0;
+                        stage_profiler_print();
+                        stage_profiler_format(profile_payload, sizeof(profile_payload));
+                        publisher_q_data.cmd = PUBLISH_MQTT_PROFILE;
+                        publisher_q_data.data = profile_payload;
+                        xQueueSend(publisher_task_q, &publisher_q_data, 0);
+                        stage_profiler_reset();
+                    }
+                    #endif
+
+                    #if LAYER_PROFILER_ENABLE
+                    /* Print the per-operator report on the UART, then
+                     * start over so every report covers one period */
+                    if (layer_profiler_invocations() >= LAYER_PROFILER_DUMP_INVOCATIONS)
+                    {
+                        layer_profiler_print();
+                        layer_profiler_reset();
+                    }
+                    #endif
 
                     #if LOG_ENABLE == 1
                     printf("---------------------------------------\r\n\n");
@@ -213,6 +370,20 @@ void ml_inference_task(void *pvParameters)
                                 publisher_q_data.data = (char *)label_text[confirmed_label];
                                 xQueueSend(publisher_task_q, &publisher_q_data, 0);
 
+                                /* Followed by the pre-roll, unless the previous
+                                 * clip is still being uploaded */
+                                if (event_clip_capture(&clip_recorder, &event_clip, event_clip_id,
+                                                       label_text[confirmed_label]) == 0)
+                                {
+                                    event_clip_id++;
+                                    publisher_q_data.cmd = PUBLISH_MQTT_CLIP;
+                                    publisher_q_data.data = (char *) &event_clip;
+                                    if (xQueueSend(publisher_task_q, &publisher_q_data, 0) != pdTRUE)
+                                    {
+                                        event_clip_release(&event_clip);
+                                    }
+                                }
+
                                 //vTaskDelay(pdMS_TO_TICKS(5000));
                             }
                             else
@@ -224,8 +395,43 @@ void ml_inference_task(void *pvParameters)
                     /* Else the best label is "unlabeled" */
                     #if LOG_ENABLE == 1
                     printf("\r\n");
-                    printf("Volume: %.4f    (%.2f)\r\n", sample_max, sample_max_slow);
-                    printf("Audio buffer utilization: %.3f\r\n", audio_count / (float)AUDIO_BUFFER_SIZE);
+                    printf("Sound level: LAeq %.1f dB(A), LAFmax %.1f dB(A), peak %.1f dBFS over %.0f s\r\n",
+                        level_report.laeq, level_report.lafmax, level_report.peak_dbfs, level_report.period_s);
+                    capture_task_get_stats(&capture_stats);
+                    printf("Audio buffer utilization: %.3f (overruns: %lu)\r\n",
+                        audio_capture_utilization(&capture_stats.capture), (unsigned long)capture_stats.capture.overruns);
+                    printf("Capture ring: depth %lu, high-water %lu of %lu, dropped %lu\r\n",
+                        (unsigned long)capture_stats.ring_depth, (unsigned long)capture_stats.ring_high_water,
+                        (unsigned long)capture_stats.ring_size, (unsigned long)capture_stats.ring_dropped);
+                    printf("Ingest cycles per block: %lu (%lu samples)\r\n", (unsigned long)ingest_cycles,
+                        (unsigned long)block_size);
+                    printf("Pre-roll encode cycles per block: %lu\r\n", (unsigned long)clip_cycles);
+                    printf("Front-end cycles per hop: %lu\r\n", (unsigned long)((frontend_samples > 0) ?
+                        frontend_cycles * MODEL_FRAME_HOP / frontend_samples : 0));
+                    activity_gate_get_stats(&gate_stats);
+                    printf("Model windows skipped by the activity gate: %lu/%lu\r\n",
+                        (unsigned long)gate_stats.skipped_windows, (unsigned long)gate_stats.windows);
+                    #if CASCADE_MODEL_ENABLE
+                    cascade_model_get_stats(&cascade_stats);
+                    printf("Model windows escalated by the cascade: %lu/%lu\r\n",
+                        (unsigned long)cascade_stats.escalated, (unsigned long)cascade_stats.windows);
+                    #endif
+                    deadline_monitor_get_stats(DEADLINE_BLOCK, &block_deadline);
+                    deadline_monitor_get_stats(DEADLINE_OUTPUT, &output_deadline);
+                    printf("Block time:  p99 %lu us, worst %lu us of %lu us, missed %lu/%lu\r\n",
+                        (unsigned long)block_deadline.p99_us, (unsigned long)block_deadline.worst_us,
+                        (unsigned long)block_deadline.period_us, (unsigned long)block_deadline.missed,
+                        (unsigned long)block_deadline.count);
+                    if (block_deadline.worst_us > CAPTURE_WORST_STALL_US)
+                    {
+                        /* capture_task.h sizes the ring for a shorter stall */
+                        printf("Block time exceeds the %lu us stall the capture ring is sized for\r\n",
+                            (unsigned long)CAPTURE_WORST_STALL_US);
+                    }
+                    printf("Output time: p99 %lu us, worst %lu us of %lu us, missed %lu/%lu\r\n",
+                        (unsigned long)output_deadline.p99_us, (unsigned long)output_deadline.worst_us,
+                        (unsigned long)output_deadline.period_us, (unsigned long)output_deadline.missed,
+                        (unsigned long)output_deadline.count);
                     printf("---------------------------------------\r\n\n");
                     #endif
                     break;
@@ -236,78 +442,24 @@ void ml_inference_task(void *pvParameters)
                     break;
             }
         }
+
+        /* Publish the level of every completed period. The payload is
+         * only overwritten by the next report, one period later. */
+        #if SOUND_LEVEL_ENABLE
+        if (sound_level_get_report(&level_report))
+        {
+            sound_level_format(&level_report, level_payload, sizeof(level_payload));
+            publisher_q_data.cmd = PUBLISH_MQTT_LEVEL;
+            publisher_q_data.data = level_payload;
+            xQueueSend(publisher_task_q, &publisher_q_data, 0);
+        }
+        #endif
+        deadline_monitor_block_end();
     }
 }
 
 
 
-/*******************************************************************************
-* Function Name: init_audio
-********************************************************************************
-* Summary:
-*    This function initializes and configures the PDM mic. It starts an  
-*    asynchronous read which triggers an interrupt when completed.
-*
-* Parameters:
-*   pdm_pcm        Pointer to the cyhal_pdm_pcm_t structure
-*
-* Return:
-*     void
-*
-*
-*******************************************************************************/
-static void init_audio(cyhal_pdm_pcm_t* pdm_pcm)
-{
-    cy_rslt_t result;
-    cyhal_clock_t audio_clock;
-    cyhal_clock_t pll_clock;
-
-    const cyhal_pdm_pcm_cfg_t pdm_pcm_cfg =
-    {
-        .sample_rate     = SAMPLE_RATE_HZ,              /* Sample rate in Hz */
-        .decimation_rate = DECIMATION_RATE,             /* Decimation Rate of the PDM/PCM block */
-        .mode            = CYHAL_PDM_PCM_MODE_LEFT,     /* Microphone to use (Channel) */
-        .word_length     = AUIDO_BITS_PER_SAMPLE,       /* Bits per sample */
-        .left_gain       = MICROPHONE_GAIN,             /* Left channel gain dB ("volume") */
-        .right_gain      = MICROPHONE_GAIN,             /* Right channel gain dB ("volume") */
-    };
-
-    /* Initialize the PLL */
-    result = cyhal_clock_reserve(&pll_clock, &CYHAL_CLOCK_PLL[1]);
-    halt_error(result);
-    result = cyhal_clock_set_frequency(&pll_clock, AUDIO_SYS_CLOCK_HZ, NULL);
-    halt_error(result);
-    result = cyhal_clock_set_enabled(&pll_clock, true, true);
-    halt_error(result);
-
-    /* Initialize the audio subsystem clock (CLK_HF[1])
-     * The CLK_HF[1] is the root clock for the I2S and PDM/PCM blocks */
-    result = cyhal_clock_reserve(&audio_clock, &CYHAL_CLOCK_HF[1]);
-    halt_error(result);
-
-    /* Source the audio subsystem clock from PLL */
-    result = cyhal_clock_set_source(&audio_clock, &pll_clock);
-    halt_error(result);
-    result = cyhal_clock_set_enabled(&audio_clock, true, true);
-    halt_error(result);
-
-    /* Initialize the pulse-density modulation to pulse-code modulation (PDM/PCM) converter. */
-    result = cyhal_pdm_pcm_init(pdm_pcm, PDM_DATA, PDM_CLK, &audio_clock, &pdm_pcm_cfg);
-    halt_error(result);
-
-    /* Clear PDM/PCM RX FIFO */
-    result = cyhal_pdm_pcm_clear(pdm_pcm);
-    halt_error(result);
-
-    /* Workaround to fix PDM clock, see comment above. */
-    pdm_frequency_fix();
-
-    /* Start PDM/PCM */
-    result = cyhal_pdm_pcm_start(pdm_pcm);
-    halt_error(result);
-}
-
-
 /*******************************************************************************
 * Function Name: halt_error
 ********************************************************************************
@@ -332,37 +484,3 @@ static void halt_error(int code)
         }
     }
 }
-
-
-/*******************************************************************************
-* Function Name: pdm_frequency_fix
-********************************************************************************
-* Summary:
-*    This function is a workaround to apply correct clock frequency to the mic.
-*    This is to keep the clock frequency in range with mic specification.
-*
-* Parameters:
-*    void
-*
-* Return:
-*    void
-*
-*
-*******************************************************************************/
-static void pdm_frequency_fix()
-{
-    static uint32_t* pdm_reg = (uint32_t*)(0x40A00010);
-    uint32_t clk_clock_div_stage_1 = 2;
-    uint32_t mclkq_clock_div_stage_2 = 1;
-    uint32_t cko_clock_div_stage_3 = 8;
-    /* mic_freq / (2*16000) */
-    uint32_t needed_sinc_rate = AUDIO_SYS_CLOCK_HZ / ( clk_clock_div_stage_1 * 
-        mclkq_clock_div_stage_2 * cko_clock_div_stage_3 * 2 * SAMPLE_RATE_HZ);
-    uint32_t pdm_data = (clk_clock_div_stage_1 - 1) << 0;
-    pdm_data |= (mclkq_clock_div_stage_2 - 1) << 4;
-    pdm_data |= (cko_clock_div_stage_3 - 1) << 8;
-    pdm_data |= needed_sinc_rate << 16;
-    *pdm_reg = pdm_data;
-}
-
-
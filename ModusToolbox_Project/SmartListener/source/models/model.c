@@ -7,9 +7,10 @@
 * Model ID  21a29acf-8810-41e0-974f-29806e7fd7f8
 * 
 * Memory    Size                      Efficiency
-* Buffers   14360 bytes (RAM)         86 %
-* State     24904 bytes (RAM)         100 %
-* Readonly  245824 bytes (Flash)      100 %
+* Buffers   16384 bytes (RAM)         100 %   (MODEL_ARENA_SIZE, front-end scratch shares the arena, 4216 or 3192 with FRONTEND_Q15_ENABLE without the arena)
+* State     16280 bytes (RAM)         100 %   (14232 with FRONTEND_Q15_ENABLE, 4160 more with STEREO_FRONTEND_ENABLE, 8 less with MODEL_STREAMING_ENABLE or MODEL_INT8_ENABLE)
+* Other     the score queue here, the front-end, feature bus and sound level statics in their own files (README, memory table)
+* Readonly  245824 bytes (Flash)      100 %   (66600 with MODEL_INT8_ENABLE, see models/model_int8.c)
 * 
 * Exported functions:
 * 
@@ -23,6 +24,25 @@
 *  @return IPWIN_RET_SUCCESS (0) or IPWIN_RET_NODATA (-1), IPWIN_RET_ERROR (-2), IPWIN_RET_STREAMEND (-3)
 *  int IMAI_enqueue(const float *data_in);
 * 
+*  @description: Write a block of samples to model and run the model for every complete window.
+*  @param data_in Input samples. Input float[count].
+*  @param count Number of samples in data_in.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*  int IMAI_enqueue_block(const float *data_in, int count);
+* 
+*  @description: Write a block of q15 samples to model, FRONTEND_Q15_ENABLE only.
+*  @param data_in Input samples. Input q15[count].
+*  @param count Number of samples in data_in.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*  int IMAI_enqueue_block_q15(const int16_t *data_in, int count);
+* 
+*  @description: Write a block of stereo samples to model, STEREO_FRONTEND_ENABLE only. Each channel goes through its own FFT and the two are combined into one feature frame.
+*  @param left Left channel samples. Input float[count].
+*  @param right Right channel samples. Input float[count].
+*  @param count Number of samples per channel.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*  int IMAI_enqueue_block_stereo(const float *left, const float *right, int count);
+* 
 *  @description: Closes and flushes streams, free any heap allocated memory.
 *  void IMAI_finalize(void);
 * 
@@ -49,17 +69,87 @@
 #include "mtb_ml_model.h"
 
 #include "model.h"
+#include "activity_gate.h"
+#include "stereo_frontend.h"
+#include "frontend_q15.h"
+#include "mel_log.h"
+#include "stream_model.h"
+#include "quant_model.h"
+#include "cascade_model.h"
+#include "frontend.h"
+#include "feature_bus.h"
+
+#if STEREO_FRONTEND_ENABLE && FRONTEND_Q15_ENABLE
+#error "The fixed-point front-end is mono only, STEREO_FRONTEND_ENABLE requires FRONTEND_Q15_ENABLE == 0"
+#endif
+#include "stage_profiler.h"
+#include "layer_profiler.h"
+#include "memory_poison.h"
+#include "model_arena.h"
 
 #ifdef __GNUC__
 #define ALIGNED(x) __attribute__((aligned(x)))
 #else
 #define ALIGNED(x) __declspec(align(x))
 #endif
-// Working memory
-static ALIGNED(16) int8_t _buffer[14360];
-static ALIGNED(16) int8_t _state[24904];
+// Working memory, planned by host/memory_plan.c (smartlistener_host memory-plan).
+// The persistent buffers come first, then _WORK, where the front-end scratch
+// of a frame shares its bytes with the head of the arena. TFLM plans the
+// activations of an invocation into the head and keeps its persistent
+// allocations at the end, so the head is dead between two invocations.
+#if MODEL_STREAMING_ENABLE || MODEL_INT8_ENABLE
+// No arena, stream_model.c keeps its own layer caches, quant_model.c its int8 buffers
+#if FRONTEND_Q15_ENABLE
+static ALIGNED(16) int8_t _state[15304];
+#else
+static ALIGNED(16) int8_t _state[16328];
+#endif
+#define _WORK            (_state + 0x00002f50)
+#else
+// MODEL_ARENA_SIZE is set by host/arena_calibrate.c (smartlistener_host arena-calibrate)
+// from the arena bytes TFLM reports on the device, IMAI_init() checks them
+static ALIGNED(16) int8_t _state[12120 + MODEL_ARENA_SIZE];
+#define _WORK            (_state + 0x00002f58)
+#endif
+
+// Bytes of _WORK the front-end scratch uses
+#if FRONTEND_Q15_ENABLE
+#define _WORK_SCRATCH    (3192)
+#else
+#define _WORK_SCRATCH    (4216)
+#endif
+
+#if !(MODEL_STREAMING_ENABLE || MODEL_INT8_ENABLE)
+static_assert(MODEL_ARENA_SIZE <= MODEL_ARENA_BUDGET, "The model arena exceeds its SRAM budget, see models/model_arena.h");
+static_assert(MODEL_ARENA_SIZE >= _WORK_SCRATCH, "The front-end scratch does not fit in the model arena");
+static_assert(MODEL_ARENA_SIZE % 16 == 0, "The model arena must keep the tensor alignment");
+#define _WORK_PEAK       ((MODEL_ARENA_PEAK > _WORK_SCRATCH) ? MODEL_ARENA_PEAK : _WORK_SCRATCH)
+#else
+#define _WORK_PEAK       _WORK_SCRATCH
+#endif
+
+// Score vectors produced by IMAI_enqueue_block(), waiting for IMAI_dequeue()
+static float _scores[IMAI_DATA_OUT_QUEUE_LEN][IMAI_DATA_OUT_COUNT];
+static int _scores_read;
+static int _scores_count;
+
+// Model windows dequeued since IMAI_init(), run or skipped
+static uint32_t _window_index;
+
+// Input windows of the front-end, mono/left and right channel. Each sample is
+// written twice, so every 512-sample window is contiguous in memory and the
+// front-end reads it in place (see fixwin_enqueue_mirrored()).
+#if FRONTEND_Q15_ENABLE
+static ALIGNED(16) int8_t _input_state[2112];
+#else
+static ALIGNED(16) int8_t _input_state[4160];
+#endif
+#if STEREO_FRONTEND_ENABLE
+static ALIGNED(16) int8_t _stereo_state[4160];
+#endif
 
 // Parameters
+#if !MODEL_INT8_ENABLE
 static const uint32_t _K14[] = {
     0x0000001c, 0x334c4654, 0x00200014, 0x0018001c, 0x00100014, 0x0000000c, 0x00040008, 0x00000014, 
     0x0000001c, 0x000000a4, 0x000000fc, 0x0003933c, 0x0003934c, 0x0003b050, 0x00000003, 0x00000001, 
@@ -7623,7 +7713,10 @@ static const uint32_t _K14[] = {
     0xfffffff4, 0x00000003, 0x03000000, 0x000c000c, 0x0000000b, 0x00040000, 0x0000000c, 0x00000016, 
     0x16000000
 };
+#endif
 
+// Front-end tables, generated by frontend.hpp with FRONTEND_CONSTEXPR_ENABLE
+#if !FRONTEND_CONSTEXPR_ENABLE
 static const uint32_t _K18[] = {
     0x00000000, 0x381e87c4, 0x391e863b, 0x39b25423, 0x3a1e8019, 0x3a77a0f6, 0x3ab2449b, 0x3af29a52, 
     0x3b1e6790, 0x3b487014, 0x3b776514, 0x3b95a260, 0x3bb2068a, 0x3bd0ddef, 0x3bf2275e, 0x3c0af0c6, 
@@ -7754,27 +7847,35 @@ static const uint32_t _K24[] = {
     0x3f52d2d3, 0x3f43c3c4, 0x3f34b4b4, 0x3f25a5a6, 0x3f169696, 0x3f078788, 0x3ef0f0f0, 0x3ed2d2d2, 
     0x3eb4b4b4, 0x3e969696, 0x3e70f0f0, 0x3e34b4b4, 0x3df0f0f0, 0x3d70f0f0, 0x00000000
 };
+#endif
 
 // Memory mapped buffers
-#define _K14             ((uint8_t *)_K14)                   // u8[241924] (241924 bytes)
+#define _K14             ((uint8_t *)_K14)                   // u8[241924] (241924 bytes), not with MODEL_INT8_ENABLE
+#if FRONTEND_CONSTEXPR_ENABLE
+#define _K18             (frontend_window())                 // f32[512] (2048 bytes)
+#define _K23             (frontend_filter_points())          // s16[32] (64 bytes)
+#define _K24             (frontend_filter_coefs())           // f32[447] (1788 bytes)
+#else
 #define _K18             ((float *)_K18)                     // f32[512] (2048 bytes)
 #define _K23             ((int16_t *)_K23)                   // s16[32] (64 bytes)
 #define _K24             ((float *)_K24)                     // f32[447] (1788 bytes)
-#define _K12             ((int8_t *)(_state + 0x00000900))   // s8[6208] (6208 bytes)
-#define _K13             ((uint8_t *)(_state + 0x00002148))  // u8[16384] (16384 bytes)
-#define _K17             ((int8_t *)(_state + 0x00002140))   // s8[8] (8 bytes)
-#define _K2              ((int8_t *)(_state + 0x00000000))   // s8[2256] (2256 bytes)
-#define _K5              ((int8_t *)(_state + 0x000008d0))   // s8[48] (48 bytes)
-#define _K1              ((float *)(_buffer + 0x00000000))   // f32[512] (2048 bytes)
-#define _K10             ((float *)(_buffer + 0x00000078))   // f32[30] (120 bytes)
-#define _K11             ((float *)(_buffer + 0x00000000))   // f32[50,30] (6000 bytes)
-#define _K22             ((float *)(_buffer + 0x00000000))   // f32[257] (1028 bytes)
-#define _K27             ((float *)(_buffer + 0x00000404))   // f32[30] (120 bytes)
-#define _K28             ((float *)(_buffer + 0x00000000))   // f32[30] (120 bytes)
-#define _K3              ((float *)(_buffer + 0x00000800))   // f32[512] (2048 bytes)
-#define _K4              ((float *)(_buffer + 0x00001000))   // f32[257,2] (2056 bytes)
-#define _K8              ((float *)(_buffer + 0x00001808))   // f32[1026] (4104 bytes)
-#define _K9              ((float *)(_buffer + 0x00002810))   // f32[1026] (4104 bytes)
+#endif
+#define _K12             ((int8_t *)(_state + 0x00000000))   // s8[12064] (12064 bytes), mirrored f32[50,30] feature history
+#define _K13             ((uint8_t *)(_WORK + 0x00000000))   // u8[MODEL_ARENA_SIZE], not with MODEL_STREAMING_ENABLE or MODEL_INT8_ENABLE
+#define _K17             ((int8_t *)(_state + 0x00002f50))   // s8[8] (8 bytes), not with MODEL_STREAMING_ENABLE or MODEL_INT8_ENABLE
+#define _K2              ((int8_t *)_input_state)            // s8[4160] (4160 bytes), s8[2112] with FRONTEND_Q15_ENABLE
+#define _K5              ((int8_t *)(_state + 0x00002f20))   // s8[48] (48 bytes)
+#define _K10             ((float *)(_WORK + 0x00000000))     // f32[30] (120 bytes), log-mel frame, dead after fixwin_enqueue_mirrored()
+#if !FRONTEND_Q15_ENABLE
+#define _K8              ((float *)(_WORK + 0x00000078))     // f32[512] (2048 bytes), magnitudes of the feature bus, dead after feature_bus_publish()
+#define _K9              ((float *)(_WORK + 0x00000878))     // f32[512] (2048 bytes), dead after the front-end
+#endif
+#if STEREO_FRONTEND_ENABLE
+#define _K2R             ((int8_t *)_stereo_state)           // s8[4160] (4160 bytes)
+#endif
+#if FRONTEND_Q15_ENABLE
+#define _K8Q             ((int16_t *)(_WORK + 0x00000078))   // s16[1536] (3072 bytes), scratch of frontend_q15_frame()
+#endif
 
 #define IPWIN_RET_SUCCESS 0
 #define IPWIN_RET_NODATA -1
@@ -7840,6 +7941,36 @@ static inline int cbuffer_enqueue(cbuffer_t *buf, const void *data, int data_siz
 	return CBUFFER_SUCCESS;
 }
 
+// Writes given data to a mirrored buffer, whose memory is 2 * size bytes.
+// Every byte is written a second time "size" bytes further, so the data at
+// any read offset is contiguous up to "size" bytes (see cbuffer_readptr()).
+// Returns CBUFFER_SUCCESS or CBUFFER_NOMEM if out of memory.
+static inline int cbuffer_enqueue_mirrored(cbuffer_t *buf, const void *data, int data_size) {
+	int free = cbuffer_get_free(buf);
+
+	// Out of memory?
+	if (free < data_size)
+		return CBUFFER_NOMEM;
+
+	// Is the data split in the end?
+	int first_size = data_size;
+	if (buf->write + data_size > buf->size)
+		first_size = buf->size - buf->write;
+
+	memcpy(buf->buf + buf->write, data, first_size);
+	memcpy(buf->buf + buf->write + buf->size, data, first_size);
+	if (data_size > first_size) {
+		memcpy(buf->buf, ((char *)data) + first_size, data_size - first_size);
+		memcpy(buf->buf + buf->size, ((char *)data) + first_size, data_size - first_size);
+	}
+	buf->write += data_size;
+	if (buf->write >= buf->size)
+		buf->write -= buf->size;
+
+	buf->used += data_size;
+	return CBUFFER_SUCCESS;
+}
+
 // Advances the read pointer by given count.
 // Returns CBUFFER_SUCCESS on success or CBUFFER_NOMEM if count is more than available data
 static inline int cbuffer_advance(cbuffer_t *buf, int count) {
@@ -7950,6 +8081,31 @@ static inline int fixwin_dequeue(void* restrict handle, void* restrict dst, int
 	return IPWIN_RET_NODATA;
 }
 
+/*
+* Try to dequeue a window of a mirrored handle without copying it.
+*
+* @param handle Pointer to a handle initialized with fixwin_init_mirrored().
+* @param window Set to the first item of the window. It stays valid until the next enqueue.
+* @param stride_count Number of items (of size handle->input_size) to stride window.
+* @return IPWIN_RET_SUCCESS (0) or IPWIN_RET_NODATA (-1) is no data is available.
+*/
+static inline int fixwin_dequeue_inplace(void* restrict handle, const void** window, int count, int stride_count)
+{
+	fixwin_t* fep = (fixwin_t*)handle;
+
+	const int stride_bytes = stride_count * fep->input_size;
+	const int size = count * fep->input_size;
+	if (cbuffer_get_used(&fep->data_buffer) >= size) {
+		*window = cbuffer_readptr(&fep->data_buffer, 0, NULL);
+
+		if (cbuffer_advance(&fep->data_buffer, stride_bytes) != 0)
+			return IPWIN_RET_ERROR;
+
+		return IPWIN_RET_SUCCESS;
+	}
+	return IPWIN_RET_NODATA;
+}
+
 static inline void hannmul_cmsis_f32(const float* restrict a, const float* restrict b, float* restrict result, int d0, int d1)
 {
 	for (int j = 0; j < d1; j++) {
@@ -7963,93 +8119,24 @@ static inline void hannmul_cmsis_f32(const float* restrict a, const float* restr
 
 static_assert (sizeof(arm_rfft_fast_instance_f32) <= 48, "Data structure 'arm_rfft_fast_instance_f32' is too big");
 
-// input array (any shape >= 1D)
-// output array (shape = input.shape.replace(axis, n).insert(0,2))
-// d0 = input.shape.step(axis)
-// d1 = input.shape.size(axis)
-// d2 = input.shape.slot(axis)
-static inline void rfft_cmsis_f32(
-    void* handle,
-    const float* restrict input,
-    float* restrict output,
-    int d0, int d1, int d2, float* restrict temp_a, float* restrict temp_b)
-{
-    int step = d0 * 2;
-    int a0 = d0 * d1;
-    int a1 = a0 + step;
-
-    for (int k = 0; k < d2; k++)
-    {
-        int m0 = k * a0;
-        int m1 = k * a1;
-        for (int i = 0; i < d0; i++)
-        {
-            int as = m0 + i;
-            for (int j = 0; j < d1; j++)
-            {
-                temp_a[j] = input[as];
-                as += d0;
-            }
-
-            arm_rfft_fast_f32((arm_rfft_fast_instance_f32*)handle, temp_a, temp_b, 0);
-         
-            int index =  i * 2 + m1;
-            output[index] = temp_b[0];
-            output[index + 1] = 0;
-            index += step;
-            for (int j = 2; j < d1; j += 2)
-            {
-                output[index] = temp_b[j];
-                output[index + 1] = temp_b[j + 1];
-                index += step;
-            }
-            output[index] = temp_b[1];
-            output[index + 1] = 0;
-        }
-    }
-}
-
-static inline void norm_cmsis_cmplx_f32(const float* restrict input, int d2, float* restrict output)
-{
-	arm_cmplx_mag_f32(input, output, d2);
-}
-
-// input array (any shape >= 1D)
-// output array (same shape as input array except with 0 replaced with num_filter)
-// size = input.shape.size(0)
-// slot = input.shape.slot(0)
-static inline void mel_cmsis_f32(
-	const float* restrict input,
+// Log mel spectrum of a real frame, output float[num_filter].
+// The frame is read from temp_a, which arm_rfft_fast_f32 uses as scratch, and
+// magnitude, filterbank, clip at min and log of the packed output in temp_b
+// are done by mel_log_f32(), with temp_a as the magnitude array, see mel_log.c.
+static inline void rfft_mel_log_cmsis_f32(
+	void* handle,
+	float* restrict temp_a,
+	float* restrict temp_b,
+	int d1,
 	const short* restrict filter_points,
 	const float* restrict filter_coefs,
-	int size,
-	int slot, 
-	int num_filter, 
+	int num_filter,
+	float min,
 	float* restrict output)
-{	
-	for (int k = 0; k < slot; k++) {
-		const float *ip = input + k * size;
-		const float* coefs = filter_coefs;
-		for (int i = 0; i < num_filter; i++) {
-			
-			short n0 = filter_points[i];
-			short n2 = filter_points[i + 2];
-			short len = n2 - n0 + 1;
-			arm_dot_prod_f32(ip + n0, coefs, len, output++);
-			coefs += len;
-		}
-	}
-}
-
-static inline void clip_cmsis_f32(const float* restrict input, int count, float min, float max, float* restrict output)
 {
-	arm_clip_f32(input, output, min, max, count);
-}
-
-static inline void log_cmsis_f32(const float* restrict x, int count, float scale, float* restrict result)
-{
-	arm_vlog_f32(x, result, count);
-	arm_scale_f32(result, scale, result, count);
+	arm_rfft_fast_f32((arm_rfft_fast_instance_f32*)handle, temp_a, temp_b, 0);
+	STAGE_PROFILER_MARK(STAGE_PROFILER_RFFT);
+	mel_log_f32(temp_b, temp_a, d1, filter_points, filter_coefs, num_filter, min, output);
 }
 
 /**
@@ -8069,10 +8156,24 @@ static inline int fixwin_enqueue(void* restrict handle, const void* restrict dat
 	return IPWIN_RET_SUCCESS;
 }
 
+static inline int fixwin_enqueue_mirrored(void* restrict handle, const void* restrict data)
+{
+	fixwin_t* fep = (fixwin_t*)handle;
+
+	if (cbuffer_enqueue_mirrored(&fep->data_buffer, data, fep->input_size) != 0)
+		return IPWIN_RET_ERROR;
+
+	return IPWIN_RET_SUCCESS;
+}
+
 static inline void mtb_model_f32(const void* handle, const float* restrict src, int src_count, float* restrict dst, int dst_count)
 {
 	mtb_ml_model_t* model = *(mtb_ml_model_t**)handle;
+	// TFLM keeps its own structures at the end of the arena, only the head
+	// the activations are planned into is painted
+	LAYER_PROFILER_BEGIN("tflm", _K13, MODEL_ARENA_PEAK, model->model_size);
 	mtb_ml_model_run(model, (float*)src);
+	LAYER_PROFILER_END(model->output, model->output_size);
 	memcpy(dst, model->output, dst_count * sizeof(float));
 }
 
@@ -8102,6 +8203,21 @@ static inline void fixwin_init(void* restrict handle, int input_size, int count)
 	cbuffer_init(&fep->data_buffer, mem, data_buffer);
 }
 
+/**
+* Initializes a fixwin sampler handle over a mirrored buffer, which is filled
+* with fixwin_enqueue_mirrored() and read with fixwin_dequeue_inplace().
+*
+* @param handle Pointer to a preallocated memory area of sizeof(fixwin_t) + 2 * input_size * count bytes.
+*
+* @param input_size Number of bytes to enqueue.
+* @param count Number of items (of size input_size) in each window
+*/
+static inline void fixwin_init_mirrored(void* restrict handle, int input_size, int count)
+{
+	// Same layout, cbuffer_enqueue_mirrored() uses the memory past data_buffer.size
+	fixwin_init(handle, input_size, count);
+}
+
 static inline int rfft_cmsis_init_512_f32(void* handle)
 {
     if (arm_rfft_fast_init_512_f32((arm_rfft_fast_instance_f32*)handle) != ARM_MATH_SUCCESS) {
@@ -8119,6 +8235,7 @@ int mtb_init(const void *handle, uint8_t* model_bin, unsigned int model_size, ui
 	mtb_ml_model_buffer_t buffer = { arena_buffer, arena_size };
 	if (mtb_ml_model_init(&model, &buffer, model_obj) != CY_RSLT_SUCCESS)
 		return IPWIN_RET_ERROR;
+	LAYER_PROFILER_ATTACH(*model_obj);
 
 	return 0;
 }
@@ -8129,6 +8246,101 @@ int mtb_init(const void *handle, uint8_t* model_bin, unsigned int model_size, ui
 #define __RETURN_ERROR_BREAK_EMPTY_END(_exp) {  int __ret = (_exp); if(__ret == -1 || __ret == -3) break; if(__ret < 0) return __ret; }
 #define __RETURN_ERROR_CANCEL_EMPTY(_exp) {  int __ret = (_exp); if(__ret == -1) return 0; if(__ret < 0) return __ret; }
 #define __BREAK_ERROR(_exp) {  int __ret = (_exp); if(__ret < 0) break; }
+#define __RETURN_ERROR_CONTINUE_EMPTY(_exp) {  int __ret = (_exp); if(__ret == -1) continue; if(__ret < 0) return __ret; }
+
+#if FRONTEND_Q15_ENABLE
+#define _INPUT_SAMPLE_SIZE 2
+#else
+#define _INPUT_SAMPLE_SIZE 4
+#endif
+
+/*
+* Computes the log-mel frame _K10 of one 512-sample input window.
+* 
+*  @param window Window read in place from _K2, float[512] or q15[512] with FRONTEND_Q15_ENABLE
+*/
+static inline void _IMAI_frontend_frame(const void *window) {
+#if FRONTEND_Q15_ENABLE
+    frontend_q15_frame((const int16_t *)window, _K8Q, _K10);
+    STAGE_PROFILER_MARK(STAGE_PROFILER_FRONTEND);
+#elif FRONTEND_CONSTEXPR_ENABLE
+    frontend_frame(_K5, (const float *)window, _K8, _K9, _K10);
+    STAGE_PROFILER_MARK(STAGE_PROFILER_FRONTEND);
+#else
+    hannmul_cmsis_f32((const float *)window, _K18, _K8, 512, 1);
+    STAGE_PROFILER_MARK(STAGE_PROFILER_HANN);
+    rfft_mel_log_cmsis_f32(_K5, _K8, _K9, 512, _K23, _K24, 30, 0.00031f, _K10);
+    STAGE_PROFILER_MARK(STAGE_PROFILER_MEL_LOG);
+#endif
+#if FRONTEND_Q15_ENABLE
+    MEMORY_POISON(_K8Q, 3072);
+#else
+    MEMORY_POISON(_K9, 2048);
+#endif
+}
+
+/*
+* Returns the magnitude spectrum of the last frame for the feature bus, the
+* 257 bins mel_log_f32() left in _K8 for the mel filterbank.
+* 
+*  @param stereo Frame of the stereo front-end
+*  @return _K8, or NULL with the q15 and stereo front-ends
+*/
+static inline const float *_IMAI_frame_magnitude(int stereo) {
+#if FRONTEND_Q15_ENABLE
+    (void)stereo;
+    return NULL;
+#else
+    return stereo ? NULL : _K8;
+#endif
+}
+
+/*
+* Ends the lifetime of the magnitudes the feature bus read. The q15 spectrum
+* lives in _K8Q, which _IMAI_frontend_frame() poisons whole, and the stereo
+* front-end keeps its spectra in its own buffers.
+* 
+*  @param stereo Frame of the stereo front-end
+*/
+static inline void _IMAI_frame_magnitude_done(int stereo) {
+#if FRONTEND_Q15_ENABLE
+    (void)stereo;
+#else
+    if (!stereo)
+        MEMORY_POISON(_K8, 2048);
+#endif
+}
+
+/*
+* Runs the network on one window of _K12 and counts the window.
+* 
+*  @param features Window read in place from _K12, float[50,30]
+*  @param scores Output scores, float[7]. Left alone if skip is set.
+*  @param skip Window is answered by the activity gate
+*/
+static inline void _IMAI_model_window(const void *features, float *scores, int skip) {
+#if CASCADE_MODEL_ENABLE
+    // The first stage answers the background windows the gate let through. It
+    // also scores the windows the gate skipped, so its hang-over sees every window.
+    int cascade_skip = cascade_model_skip_window((const float *)features, scores, 7);
+    skip = skip || cascade_skip;
+#endif
+    if (!skip) {
+        STAGE_PROFILER_START();
+#if MODEL_INT8_ENABLE
+        quant_model_run((const float *)features, scores);
+#elif MODEL_STREAMING_ENABLE
+        stream_model_run((const float *)features, _window_index, scores);
+#else
+        mtb_model_f32(_K17, features, 1500, scores, 7);
+        // Only the head the front-end shares, the end holds the persistent
+        // allocations of TFLM
+        MEMORY_POISON(_K13, _WORK_SCRATCH);
+#endif
+        STAGE_PROFILER_MARK(STAGE_PROFILER_MODEL);
+    }
+    _window_index++;
+}
 
 /*
 * Try read data from model.
@@ -8137,18 +8349,31 @@ int mtb_init(const void *handle, uint8_t* model_bin, unsigned int model_size, ui
 *  @return IPWIN_RET_SUCCESS (0) or IPWIN_RET_NODATA (-1), IPWIN_RET_ERROR (-2), IPWIN_RET_STREAMEND (-3)
 */
 int IMAI_dequeue(float *restrict data_out) {    
+    const void *window;
+    const void *features;
+
+    if (_scores_count > 0) {
+        memcpy(data_out, _scores[_scores_read], sizeof(_scores[0]));
+        _scores_read = (_scores_read + 1) % IMAI_DATA_OUT_QUEUE_LEN;
+        _scores_count--;
+        return 0;
+    }
     while(1) {
-        __RETURN_ERROR_BREAK_EMPTY(fixwin_dequeue(_K2, _K1, 512, 320));
-        hannmul_cmsis_f32(_K1, _K18, _K3, 512, 1);
-        rfft_cmsis_f32(_K5, _K3, _K4, 1, 512, 1, _K8, _K9);
-        norm_cmsis_cmplx_f32(_K4, 257, _K22);
-        mel_cmsis_f32(_K22, _K23, _K24, 257, 1, 30, _K27);
-        clip_cmsis_f32(_K27, 30, 0.00031, 3.40282347E+38, _K28);
-        log_cmsis_f32(_K28, 30, 1, _K10);
-        __RETURN_ERROR_BREAK_EMPTY(fixwin_enqueue(_K12, _K10));
+        STAGE_PROFILER_START();
+        __RETURN_ERROR_BREAK_EMPTY(fixwin_dequeue_inplace(_K2, &window, 512, 320));
+        STAGE_PROFILER_MARK(STAGE_PROFILER_WINDOW);
+        _IMAI_frontend_frame(window);
+        activity_gate_update(_K10, 30);
+        STAGE_PROFILER_MARK(STAGE_PROFILER_GATE);
+        feature_bus_publish(_IMAI_frame_magnitude(0), _K10);
+        _IMAI_frame_magnitude_done(0);
+        STAGE_PROFILER_MARK(STAGE_PROFILER_BUS);
+        __RETURN_ERROR_BREAK_EMPTY(fixwin_enqueue_mirrored(_K12, _K10));
+        MEMORY_POISON(_K10, 120);
+        STAGE_PROFILER_MARK(STAGE_PROFILER_FEATURES);
     }
-    __RETURN_ERROR(fixwin_dequeue(_K12, _K11, 50, 6));
-    mtb_model_f32(_K17, _K11, 1500, data_out, 7);
+    __RETURN_ERROR(fixwin_dequeue_inplace(_K12, &features, 50, 6));
+    _IMAI_model_window(features, data_out, activity_gate_skip_window(data_out, 7));
     return 0;
 }
 
@@ -8159,16 +8384,160 @@ int IMAI_dequeue(float *restrict data_out) {
 *  @return IPWIN_RET_SUCCESS (0) or IPWIN_RET_NODATA (-1), IPWIN_RET_ERROR (-2), IPWIN_RET_STREAMEND (-3)
 */
 int IMAI_enqueue(const float *restrict data_in) {    
-    __RETURN_ERROR(fixwin_enqueue(_K2, data_in));
+#if FRONTEND_Q15_ENABLE
+    int16_t sample;
+    arm_float_to_q15(data_in, &sample, 1);
+    __RETURN_ERROR(fixwin_enqueue_mirrored(_K2, &sample));
+#else
+    __RETURN_ERROR(fixwin_enqueue_mirrored(_K2, data_in));
+#endif
     return 0;
 }
 
+/*
+* Runs the front-end for every complete 512-sample window in the input buffer
+* and the model for every complete 50-frame feature window. Score vectors are
+* queued for IMAI_dequeue().
+* 
+*  @param stereo Non-zero to take the right channel from _K2R and use the stereo front-end
+*  @return Number of queued score vectors or IPWIN_RET_ERROR (-2)
+*/
+static int _IMAI_process_block(int stereo) {
+    const void *window;
+    const void *features;
+
+    while(1) {
+        STAGE_PROFILER_START();
+        __RETURN_ERROR_BREAK_EMPTY(fixwin_dequeue_inplace(_K2, &window, 512, 320));
+#if STEREO_FRONTEND_ENABLE
+        if (stereo) {
+            const void *window_right;
+            __RETURN_ERROR(fixwin_dequeue_inplace(_K2R, &window_right, 512, 320));
+            STAGE_PROFILER_MARK(STAGE_PROFILER_WINDOW);
+            stereo_frontend_frame((const float *)window, (const float *)window_right, _K10);
+            STAGE_PROFILER_MARK(STAGE_PROFILER_FRONTEND);
+        } else
+#endif
+        {
+            STAGE_PROFILER_MARK(STAGE_PROFILER_WINDOW);
+            _IMAI_frontend_frame(window);
+        }
+        activity_gate_update(_K10, 30);
+        STAGE_PROFILER_MARK(STAGE_PROFILER_GATE);
+        feature_bus_publish(_IMAI_frame_magnitude(stereo), _K10);
+        _IMAI_frame_magnitude_done(stereo);
+        STAGE_PROFILER_MARK(STAGE_PROFILER_BUS);
+        __RETURN_ERROR(fixwin_enqueue_mirrored(_K12, _K10));
+        MEMORY_POISON(_K10, 120);
+        STAGE_PROFILER_MARK(STAGE_PROFILER_FEATURES);
+        if (_scores_count == IMAI_DATA_OUT_QUEUE_LEN)
+            return IPWIN_RET_ERROR;
+        __RETURN_ERROR_CONTINUE_EMPTY(fixwin_dequeue_inplace(_K12, &features, 50, 6));
+        float *scores = _scores[(_scores_read + _scores_count) % IMAI_DATA_OUT_QUEUE_LEN];
+        _IMAI_model_window(features, scores, activity_gate_skip_window(scores, 7));
+        _scores_count++;
+    }
+    return _scores_count;
+}
+
+/*
+* Write a block of samples to model and run the model for every complete window.
+* 
+*  @param data_in Input samples. Input float[count].
+*  @param count Number of samples in data_in.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*/
+int IMAI_enqueue_block(const float *restrict data_in, int count) {    
+#if FRONTEND_Q15_ENABLE
+    int16_t samples[64];
+    while(count > 0) {
+        int n = (count < 64) ? count : 64;
+        arm_float_to_q15(data_in, samples, n);
+        __RETURN_ERROR(IMAI_enqueue_block_q15(samples, n));
+        data_in += n;
+        count -= n;
+    }
+    return _scores_count;
+#else
+    cbuffer_t *input = &((fixwin_t*)_K2)->data_buffer;
+    while(count > 0) {
+        // Enqueue as much as fits before the next window has to be consumed
+        int n = cbuffer_get_free(input) / (int)sizeof(float);
+        if (n > count)
+            n = count;
+        if (cbuffer_enqueue_mirrored(input, data_in, n * sizeof(float)) != CBUFFER_SUCCESS)
+            return IPWIN_RET_ERROR;
+        data_in += n;
+        count -= n;
+        __RETURN_ERROR(_IMAI_process_block(0));
+    }
+    return _scores_count;
+#endif
+}
+
+#if FRONTEND_Q15_ENABLE
+/*
+* Write a block of q15 samples to model and run the model for every complete window.
+* 
+*  @param data_in Input samples. Input q15[count].
+*  @param count Number of samples in data_in.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*/
+int IMAI_enqueue_block_q15(const int16_t *restrict data_in, int count) {    
+    cbuffer_t *input = &((fixwin_t*)_K2)->data_buffer;
+    while(count > 0) {
+        // Enqueue as much as fits before the next window has to be consumed
+        int n = cbuffer_get_free(input) / (int)sizeof(int16_t);
+        if (n > count)
+            n = count;
+        if (cbuffer_enqueue_mirrored(input, data_in, n * sizeof(int16_t)) != CBUFFER_SUCCESS)
+            return IPWIN_RET_ERROR;
+        data_in += n;
+        count -= n;
+        __RETURN_ERROR(_IMAI_process_block(0));
+    }
+    return _scores_count;
+}
+#endif
+
+#if STEREO_FRONTEND_ENABLE
+/*
+* Write a block of stereo samples to model, STEREO_FRONTEND_ENABLE only. Each channel goes through its own FFT and the two are combined into one feature frame.
+* 
+*  @param left Left channel samples. Input float[count].
+*  @param right Right channel samples. Input float[count].
+*  @param count Number of samples per channel.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*/
+int IMAI_enqueue_block_stereo(const float *restrict left, const float *restrict right, int count) {    
+    cbuffer_t *input = &((fixwin_t*)_K2)->data_buffer;
+    cbuffer_t *input_right = &((fixwin_t*)_K2R)->data_buffer;
+    while(count > 0) {
+        // Both windows are filled and consumed in lockstep
+        int n = cbuffer_get_free(input) / (int)sizeof(float);
+        if (n > count)
+            n = count;
+        if (cbuffer_enqueue_mirrored(input, left, n * sizeof(float)) != CBUFFER_SUCCESS)
+            return IPWIN_RET_ERROR;
+        if (cbuffer_enqueue_mirrored(input_right, right, n * sizeof(float)) != CBUFFER_SUCCESS)
+            return IPWIN_RET_ERROR;
+        left += n;
+        right += n;
+        count -= n;
+        __RETURN_ERROR(_IMAI_process_block(1));
+    }
+    return _scores_count;
+}
+#endif
+
 /*
 * Closes and flushes streams, free any heap allocated memory.
 * 
 */
 void IMAI_finalize(void) {    
+#if !MODEL_STREAMING_ENABLE && !MODEL_INT8_ENABLE
     mtb_model_free(_K17);
+#endif
 }
 
 /*
@@ -8177,10 +8546,52 @@ void IMAI_finalize(void) {
 *  @return IPWIN_RET_SUCCESS (0) or IPWIN_RET_NODATA (-1), IPWIN_RET_ERROR (-2), IPWIN_RET_STREAMEND (-3)
 */
 int IMAI_init(void) {    
-    fixwin_init(_K2, 4, 512);
+    _scores_read = 0;
+    _scores_count = 0;
+    fixwin_init_mirrored(_K2, _INPUT_SAMPLE_SIZE, 512);
+#if FRONTEND_CONSTEXPR_ENABLE
+    if (frontend_init(_K5) != 0)
+        return IPWIN_RET_ERROR;
+#else
     __RETURN_ERROR(rfft_cmsis_init_512_f32(_K5));
-    fixwin_init(_K12, 120, 50);
-    __RETURN_ERROR(mtb_init(_K17, _K14, 241924, _K13, 16384));
+#endif
+#if FRONTEND_Q15_ENABLE
+    __RETURN_ERROR(frontend_q15_init(_K18, _K23, _K24));
+#endif
+#if STEREO_FRONTEND_ENABLE
+    fixwin_init_mirrored(_K2R, 4, 512);
+    __RETURN_ERROR(stereo_frontend_init(_K18, _K23, _K24));
+#endif
+    // Feature frames are written twice, the model reads its 50-frame input in place
+    fixwin_init_mirrored(_K12, 120, 50);
+    feature_bus_reset();
+    _window_index = 0;
+#if CASCADE_MODEL_ENABLE
+    if (cascade_model_init(&model_cascade) != 0)
+        return IPWIN_RET_ERROR;
+#endif
+#if MODEL_INT8_ENABLE
+    if (quant_model_init(&model_int8) != 0)
+        return IPWIN_RET_ERROR;
+#elif MODEL_STREAMING_ENABLE
+    if (stream_model_init(_K14, 241924, 6) != 0)
+        return IPWIN_RET_ERROR;
+#else
+    __RETURN_ERROR(mtb_init(_K17, _K14, 241924, _K13, MODEL_ARENA_SIZE));
+    {
+        // Arena bytes TFLM uses after AllocateTensors(), its own structures included
+        const mtb_ml_model_t *model = *(mtb_ml_model_t **)_K17;
+#if MODEL_ARENA_LOG_ENABLE
+        printf("Model arena: %d of %d bytes used\r\n", model->arena_size, MODEL_ARENA_SIZE);
+#endif
+        if (model->arena_size > MODEL_ARENA_SIZE)
+        {
+            print_error("[FAILED] The model uses %d arena bytes, models/model_arena.h has %d", model->arena_size,
+                        MODEL_ARENA_SIZE);
+            return IPWIN_RET_ERROR;
+        }
+    }
+#endif
     return 0;
 }
 
@@ -8192,12 +8603,12 @@ static IMAI_api_def _IMAI_api_def = {
     api_type: IMAI_API_TYPE_QUEUE,
     prefix: "IMAI_",
     buffer_mem: {
-        size: 14360,
-        peak_usage: 12312,
+        size: sizeof(_state) - (_WORK - _state),
+        peak_usage: _WORK_PEAK,
     },
     static_mem: {
-        size: 24904,
-        peak_usage: 24904,
+        size: (_WORK - _state) + sizeof(_input_state),
+        peak_usage: (_WORK - _state) + sizeof(_input_state),
     },
     readonly_mem: {
         size: 245824,
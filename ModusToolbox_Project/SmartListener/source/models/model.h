@@ -7,9 +7,10 @@
 * Model ID  21a29acf-8810-41e0-974f-29806e7fd7f8
 * 
 * Memory    Size                      Efficiency
-* Buffers   14360 bytes (RAM)         86 %
-* State     24904 bytes (RAM)         100 %
-* Readonly  245824 bytes (Flash)      100 %
+* Buffers   16384 bytes (RAM)         100 %   (MODEL_ARENA_SIZE, front-end scratch shares the arena, 4216 or 3192 with FRONTEND_Q15_ENABLE without the arena)
+* State     16280 bytes (RAM)         100 %   (14232 with FRONTEND_Q15_ENABLE, 4160 more with STEREO_FRONTEND_ENABLE, 8 less with MODEL_STREAMING_ENABLE or MODEL_INT8_ENABLE)
+* Other     the score queue here, the front-end, feature bus and sound level statics in their own files (README, memory table)
+* Readonly  245824 bytes (Flash)      100 %   (66600 with MODEL_INT8_ENABLE, see models/model_int8.c)
 * 
 * Exported functions:
 * 
@@ -23,6 +24,25 @@
 *  @return IPWIN_RET_SUCCESS (0) or IPWIN_RET_NODATA (-1), IPWIN_RET_ERROR (-2), IPWIN_RET_STREAMEND (-3)
 *  int IMAI_enqueue(const float *data_in);
 * 
+*  @description: Write a block of samples to model and run the model for every complete window.
+*  @param data_in Input samples. Input float[count].
+*  @param count Number of samples in data_in.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*  int IMAI_enqueue_block(const float *data_in, int count);
+* 
+*  @description: Write a block of q15 samples to model, FRONTEND_Q15_ENABLE only.
+*  @param data_in Input samples. Input q15[count].
+*  @param count Number of samples in data_in.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*  int IMAI_enqueue_block_q15(const int16_t *data_in, int count);
+* 
+*  @description: Write a block of stereo samples to model, STEREO_FRONTEND_ENABLE only. Each channel goes through its own FFT and the two are combined into one feature frame.
+*  @param left Left channel samples. Input float[count].
+*  @param right Right channel samples. Input float[count].
+*  @param count Number of samples per channel.
+*  @return Number of score vectors ready for IMAI_dequeue() or IPWIN_RET_ERROR (-2)
+*  int IMAI_enqueue_block_stereo(const float *left, const float *right, int count);
+* 
 *  @description: Closes and flushes streams, free any heap allocated memory.
 *  void IMAI_finalize(void);
 * 
@@ -82,6 +102,9 @@ typedef int64_t q63_t;       // 64-bit fractional data type in Q1.63 format.
 #define IMAI_DATA_OUT_SCALE 1
 #define IMAI_DATA_OUT_SYMBOLS {"unlabelled", "baby_crying", "fire", "dog", "footsteps", "glass_breaking", "unknown"}
 
+// Score vectors IMAI_enqueue_block() can hold until they are dequeued
+#define IMAI_DATA_OUT_QUEUE_LEN (4)
+
 // data_in [1] (4 bytes)
 #define IMAI_DATA_IN_RANK (1)
 #define IMAI_DATA_IN_SHAPE (((int[]){1})
@@ -109,6 +132,9 @@ typedef int64_t q63_t;       // 64-bit fractional data type in Q1.63 format.
 // Exported methods
 int IMAI_dequeue(float *restrict data_out);
 int IMAI_enqueue(const float *restrict data_in);
+int IMAI_enqueue_block(const float *restrict data_in, int count);
+int IMAI_enqueue_block_q15(const int16_t *restrict data_in, int count);
+int IMAI_enqueue_block_stereo(const float *restrict left, const float *restrict right, int count);
 void IMAI_finalize(void);
 int IMAI_init(void);
 
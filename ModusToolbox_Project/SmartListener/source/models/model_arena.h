@@ -0,0 +1,33 @@
+/*
+ * model_arena.h
+ *
+ * Generated by smartlistener_host arena-calibrate from the windows of 320 sessions.
+ * Any changes will be lost.
+ *
+ * Arena     Bytes
+ * Host      12000 (planned 12000, written 12000)
+ * Device    not measured, build with MODEL_ARENA_LOG_ENABLE and pass --device
+ * Size      16384
+ * Budget    16384
+ */
+
+#ifndef SOURCE_MODELS_MODEL_ARENA_H_
+#define SOURCE_MODELS_MODEL_ARENA_H_
+
+/* Tensor arena of the interpreter, passed to mtb_init() */
+#define MODEL_ARENA_SIZE                    (16384)
+
+/* Highest arena byte of the host interpreter over the corpus. TFLM also
+ * keeps its tensor and node structures in the arena. */
+#define MODEL_ARENA_PEAK                    (12000)
+
+/* SRAM set aside for the arena, models/model.c does not build with more */
+#define MODEL_ARENA_BUDGET                  (16384)
+
+/* Set to 1 to print the arena bytes TFLM uses in IMAI_init(), the number
+ * arena-calibrate --device takes */
+#ifndef MODEL_ARENA_LOG_ENABLE
+#define MODEL_ARENA_LOG_ENABLE              (0)
+#endif
+
+#endif /* SOURCE_MODELS_MODEL_ARENA_H_ */
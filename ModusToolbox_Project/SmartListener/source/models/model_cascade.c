@@ -0,0 +1,122 @@
+/*
+ * model_cascade.c
+ *
+ * Generated by smartlistener_host cascade from the windows of 320 sessions.
+ * Any changes will be lost.
+ *
+ * Memory    Size
+ * Readonly  1984 bytes (Flash)
+ * Ops       3488 per window, the network does 569440 MACs
+ */
+
+#include "cascade_model.h"
+
+#if CASCADE_MODEL_ENABLE
+
+static const float _weights[480] = {
+    8.16737950e-01f, 1.77502647e-01f, -2.13095248e-01f, 1.64504513e-01f, 9.17986929e-02f, -3.06010973e-02f,
+    -3.75396281e-01f, -5.98063827e-01f, -2.54279941e-01f, 8.78000408e-02f, -1.17312551e-01f, -1.39711052e-01f,
+    -7.67374709e-02f, 2.29354620e-01f, -4.29896265e-02f, -1.89345285e-01f, -3.08959454e-01f, -1.08754732e-01f,
+    1.01654969e-01f, 1.36135882e-02f, 5.17697483e-02f, 2.82607656e-02f, 1.88589580e-02f, 6.91622421e-02f,
+    -4.22929563e-02f, -1.93587124e-01f, -2.84099411e-02f, 1.19325452e-01f, 2.32587174e-01f, 3.63545090e-01f,
+    1.57184035e-01f, -1.91300094e-01f, -2.73996353e-01f, 3.62621136e-02f, -5.69006130e-02f, 3.89076658e-02f,
+    -1.16184711e-01f, 7.38129439e-03f, -1.10206529e-01f, 1.16339698e-01f, 6.44261315e-02f, -2.64358103e-01f,
+    -1.56072795e-01f, -5.02488874e-02f, -1.48181230e-01f, -9.03542042e-02f, -2.81473279e-01f, -8.66558105e-02f,
+    -6.26312122e-02f, -4.02049161e-02f, -1.86350988e-03f, 9.58655030e-02f, 2.89176047e-01f, 6.25745058e-02f,
+    1.73682734e-01f, -1.45100318e-02f, 1.36207744e-01f, -1.58726424e-01f, 4.66174632e-02f, 1.84448823e-01f,
+    4.12976667e-02f, 3.40224832e-01f, 4.69405442e-01f, 2.55121827e-01f, 3.46055441e-02f, -1.11347519e-01f,
+    -1.11313097e-01f, -2.75734961e-01f, -3.38165343e-01f, -1.96933866e-01f, 1.85466614e-02f, 5.57010584e-02f,
+    1.53952345e-01f, 9.62223262e-02f, 1.27576292e-01f, -8.22007284e-02f, -7.14347810e-02f, 1.14754736e-01f,
+    -6.15395010e-02f, -1.11768849e-01f, -4.79815714e-02f, -7.57457018e-02f, 6.16864823e-02f, 9.08853561e-02f,
+    -2.89999805e-02f, 7.41175376e-03f, -8.36382285e-02f, -1.93384826e-01f, -2.54809260e-01f, -3.56960058e-01f,
+    1.44817993e-01f, 1.55384541e-01f, -4.26234901e-02f, -5.52020334e-02f, -1.59342645e-03f, 9.26062278e-03f,
+    -2.91800443e-02f, -3.57503414e-01f, -2.44589865e-01f, 4.18457650e-02f, 3.35725844e-02f, 4.38193008e-02f,
+    1.99655160e-01f, 1.07961252e-01f, 1.27450479e-02f, -1.33096710e-01f, -2.64554262e-01f, -1.66470304e-01f,
+    -1.85414013e-02f, 4.18748707e-02f, -1.06150575e-01f, -1.29351363e-01f, 8.05420876e-02f, 2.14990675e-01f,
+    1.83134258e-01f, 7.16558397e-02f, -1.01007316e-02f, 8.40729401e-02f, -1.63690627e-01f, -1.33954942e-01f,
+    -3.16492260e-01f, -2.07874522e-01f, -3.24795991e-01f, -4.02596176e-01f, 1.53254181e-01f, -3.39745492e-01f,
+    -1.92370251e-01f, 1.82437211e-01f, -4.16358523e-02f, -2.03187749e-01f, -2.39077467e-03f, -1.47501864e-02f,
+    -2.35579789e-01f, -8.75610337e-02f, -2.30188653e-01f, -3.12486023e-01f, 1.24760188e-01f, 2.02599749e-01f,
+    2.25077525e-01f, 1.97166935e-01f, 6.45785499e-03f, -3.10783740e-02f, -3.26557159e-02f, 8.14835802e-02f,
+    1.44615278e-01f, 2.77174264e-01f, 8.21016058e-02f, 1.93923742e-01f, -1.70153193e-02f, -5.10334969e-02f,
+    6.22710139e-02f, 3.41070265e-01f, 5.23963347e-02f, -2.15880647e-01f, 5.70212193e-02f, -3.24223600e-02f,
+    -1.19854495e-01f, 8.83881375e-02f, -7.63610676e-02f, -8.87907892e-02f, -6.75608963e-02f, 3.67122926e-02f,
+    -1.26093760e-01f, -2.11976990e-01f, -2.75863707e-01f, -2.64055341e-01f, -1.11811750e-01f, 2.28083171e-02f,
+    2.41925254e-01f, 1.41415223e-01f, 3.68869811e-01f, 1.36941805e-01f, -8.70898888e-02f, -1.77736059e-02f,
+    6.82965070e-02f, -1.24376668e-02f, -9.31014940e-02f, 1.25172377e-01f, 3.44461687e-02f, 5.26460148e-02f,
+    4.54659671e-01f, 2.40926892e-01f, 2.03688834e-02f, -1.01706907e-01f, 1.99201286e-01f, 6.60079867e-02f,
+    1.95869818e-01f, 3.37265469e-02f, -3.94940153e-02f, -5.98431677e-02f, 9.81323887e-03f, 1.28143355e-01f,
+    1.82799101e-01f, 1.02112025e-01f, 7.58672059e-02f, 7.77230933e-02f, 6.49080127e-02f, 1.36856139e-02f,
+    -1.22487925e-01f, 9.88444164e-02f, -8.87761189e-07f, 8.57898742e-02f, 1.21779345e-01f, 1.62787765e-01f,
+    1.40483528e-01f, 1.05400585e-01f, 4.04846072e-02f, -6.51060492e-02f, -8.64297152e-02f, 3.49544697e-02f,
+    -2.75633838e-02f, -5.90301827e-02f, -2.46842161e-01f, -2.39127383e-01f, -1.61165565e-01f, -1.12630501e-01f,
+    -8.72816592e-02f, -8.02777614e-03f, 2.95939017e-02f, 3.16709094e-02f, -7.91191533e-02f, 4.19067927e-02f,
+    -5.21796849e-03f, -1.55594841e-01f, 2.95225270e-02f, -2.12268308e-01f, -1.60044357e-01f, -1.76934868e-01f,
+    -6.98573962e-02f, -5.65519333e-02f, -3.28904320e-03f, 3.09211761e-02f, 2.12130528e-02f, 2.58427784e-02f,
+    6.99877068e-02f, -2.36765128e-02f, -9.53232124e-02f, 1.84596353e-03f, -1.84084252e-01f, -9.14169550e-02f,
+    2.92055070e-01f, 3.03665787e-01f, 3.24548930e-01f, 5.38888164e-02f, 1.53741837e-02f, 9.93658230e-02f,
+    -8.71622711e-02f, -1.70095433e-02f, -2.83661574e-01f, 5.90499900e-02f, -1.14171632e-01f, -1.02351606e-01f,
+    2.95664612e-02f, 1.71296492e-01f, -1.70953244e-01f, -4.01963174e-01f, -1.74495116e-01f, -2.10594162e-01f,
+    6.00330308e-02f, -2.03491002e-02f, 1.54848829e-01f, -1.02114759e-01f, -1.94710508e-01f, -7.05071017e-02f,
+    -3.19811851e-02f, -1.85973495e-01f, -1.43243939e-01f, 3.90463285e-02f, 1.75929561e-01f, 1.93290114e-01f,
+    4.57272381e-01f, 2.07641661e-01f, -4.54861261e-02f, -1.75570041e-01f, 1.27024502e-01f, 2.26827972e-02f,
+    -1.36397168e-01f, 2.74415147e-02f, -1.77915528e-01f, 6.88923569e-03f, 2.19125971e-01f, -1.28502309e-01f,
+    1.40963435e-01f, -1.89974084e-02f, -1.60744488e-01f, -2.04513580e-01f, -1.58084914e-01f, -9.27921757e-02f,
+    1.77919254e-01f, 1.31928399e-01f, -2.16311008e-01f, -2.99433079e-02f, 4.24451120e-02f, 2.44668461e-02f,
+    -4.72394601e-02f, 9.29586291e-02f, 1.53564796e-01f, 2.14834418e-02f, 3.07696369e-02f, -1.73491761e-01f,
+    -1.50521398e-01f, -6.47848845e-02f, 2.55791694e-01f, 2.02365994e-01f, -6.39305338e-02f, -1.69675469e-01f,
+    -1.26196787e-01f, -4.01059166e-02f, 6.59889579e-02f, -3.46562974e-02f, -3.36112753e-02f, -9.17724241e-03f,
+    -2.17248306e-01f, -2.66939491e-01f, -4.23643626e-02f, -1.50800332e-01f, -1.61341771e-01f, 1.59535538e-02f,
+    -3.11683342e-02f, 1.12593919e-01f, -2.27183048e-02f, 1.74205258e-01f, 1.45426005e-01f, -7.15787634e-02f,
+    8.90611783e-02f, 2.79979140e-01f, 1.24058984e-01f, 3.20201755e-01f, 2.56266564e-01f, 3.28474969e-01f,
+    8.94480124e-02f, -4.61559035e-02f, -5.89627214e-02f, -4.16712202e-02f, -4.58901897e-02f, -1.39828429e-01f,
+    4.84059192e-02f, -1.26541436e-01f, -1.53672798e-02f, 1.10772081e-01f, -8.04025214e-03f, 5.60155362e-02f,
+    -1.66797768e-02f, 2.54742485e-02f, -6.69275150e-02f, -5.64964339e-02f, 5.39545156e-02f, -2.91628223e-02f,
+    9.72860605e-02f, 5.08187078e-02f, -2.05166429e-01f, 1.60301432e-01f, 1.32532194e-01f, 6.03766739e-02f,
+    -5.60406744e-02f, 4.06966284e-02f, 2.05485523e-02f, 5.30691072e-02f, 1.34172142e-01f, -1.66103363e-01f,
+    3.90785813e-01f, 7.70943910e-02f, 6.12025447e-02f, -3.79677606e-03f, 4.17010158e-01f, 1.99359104e-01f,
+    2.43988093e-02f, 1.25463188e-01f, 4.04333957e-02f, -1.40196336e-02f, 1.18332347e-02f, -9.99406204e-02f,
+    2.62635976e-01f, 1.03776991e-01f, 2.72583347e-02f, -7.10690841e-02f, 3.69126052e-02f, -8.81069899e-02f,
+    -1.19838834e-01f, -6.92266375e-02f, 9.96840671e-02f, 1.54061452e-01f, 7.46247917e-02f, 6.56692982e-02f,
+    1.38802946e-01f, -2.63980813e-02f, 6.69523776e-02f, 3.60976569e-02f, -2.84808613e-02f, 7.84622282e-02f,
+    -2.05114439e-01f, -1.32744849e-01f, -5.81619479e-02f, -9.09603015e-03f, -6.81716353e-02f, 6.45085275e-02f,
+    -3.22916955e-01f, -8.35799351e-02f, -1.40280932e-01f, -1.51108861e-01f, -2.07011461e-01f, -3.13094109e-02f,
+    -8.03189799e-02f, 3.61243039e-02f, -7.64041906e-03f, 2.27861870e-02f, 1.46563649e-01f, -1.21102989e-01f,
+    -1.17280371e-01f, -1.25165358e-01f, -3.13315392e-02f, 1.62134375e-02f, -6.72338605e-02f, 1.71845019e-01f,
+    2.45113075e-01f, 2.89101936e-02f, -8.42541903e-02f, -7.52636567e-02f, -1.88577116e-01f, 1.04345135e-01f,
+    -9.52515066e-01f, -2.26886034e-01f, 2.22743586e-01f, 1.60316542e-01f, 5.64610474e-02f, 1.60063654e-01f,
+    -1.07770592e-01f, 1.61197394e-01f, 1.21787459e-01f, 1.53668463e-01f, -6.40853271e-02f, -1.20590270e-01f,
+    -7.11322278e-02f, -2.89798319e-01f, -1.68771464e-02f, 1.24947958e-01f, 3.12753394e-02f, -6.49587661e-02f,
+    -8.32926109e-02f, 1.79521069e-01f, 1.28957346e-01f, 9.77645442e-02f, -3.94694284e-02f, 2.14738883e-02f,
+    -9.52101052e-02f, 3.11407298e-02f, 2.81132221e-01f, 1.08039282e-01f, -5.87734878e-02f, -1.15504086e-01f,
+    -2.79061466e-01f, -6.55353665e-02f, 6.43651038e-02f, -2.82580331e-02f, 1.54696345e-01f, 8.91631544e-02f,
+    1.56806093e-02f, -9.56077769e-04f, 1.14201857e-02f, 2.56077070e-02f, -3.63869481e-02f, -1.33888647e-02f,
+    8.65371078e-02f, 1.72264744e-02f, 6.84282109e-02f, 1.21539600e-01f, 2.61273503e-01f, 2.13015035e-01f,
+    -1.28289266e-02f, -1.85730029e-02f, 2.88383048e-02f, 5.64700109e-04f, -1.59419224e-01f, 7.91896973e-03f,
+    -2.32806519e-01f, -6.74507841e-02f, 3.59820612e-02f, -1.08121894e-02f, -1.57336563e-01f, -1.97414681e-01f,
+};
+
+static const float _bias[8] = {
+    3.76698226e-02f, -5.70330024e-01f, -5.83952427e-01f, 2.43294811e+00f, 4.99483615e-01f, 2.10565019e+00f,
+    3.41019535e+00f, -1.36366153e+00f,
+};
+
+static const float _output_weights[8] = {
+    1.74456859e+00f, -2.02884316e+00f, -1.49249220e+00f, -2.39014649e+00f, 1.30925679e+00f, 8.81664693e-01f,
+    -1.41778302e+00f, 1.10077953e+00f,
+};
+
+const cascade_model_t model_cascade = {
+    .frames = 50,
+    .bands = 30,
+    .hidden = 8,
+    .weights = _weights,
+    .bias = _bias,
+    .output_weights = _output_weights,
+    .output_bias = -1.000858784e+00f,
+    .threshold = -2.420570135e+00f,
+    .hangover = 8,
+    .macs = 3488,
+};
+
+#endif /* CASCADE_MODEL_ENABLE */
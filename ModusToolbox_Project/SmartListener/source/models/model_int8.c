@@ -0,0 +1,4022 @@
+/*
+ * model_int8.c
+ *
+ * Generated by smartlistener_host quantize from the model of models/model.c
+ * and the activation ranges of 10880 windows of 320 sessions. Any changes
+ * will be lost.
+ *
+ * Memory    Size
+ * Readonly  62700 bytes (Flash), the float model is 241924 bytes
+ * State     4416 bytes (RAM), the buffers of quant_model.c
+ */
+
+#include "quant_model.h"
+
+#if MODEL_INT8_ENABLE
+
+// Layer 0: QUANT_LAYER_CONV, [50, 30] to [25, 16]
+static const int8_t _L0_weights[1440] = {
+    -82, -35, -10, -22, -30, 25, -56, 47, -101, -68, -29, 39, 114, -71, -10, 73,
+    94, 7, 85, -51, 47, 33, 83, -89, -110, -112, 41, 11, 25, -115, 25, 98,
+    119, 41, 77, 116, -87, 116, -66, -61, 104, -6, 84, -73, 5, -19, -61, -27,
+    30, -65, 106, 86, 71, -81, -73, 12, -89, -10, -16, -92, 50, -85, 6, 37,
+    124, 43, -81, -96, -105, -96, -10, -52, 58, 127, -14, -91, -16, 10, -51, -8,
+    -86, 120, -10, -64, 20, -71, 60, 94, -103, 36, -113, 80, 47, 65, -63, 26,
+    -44, -44, 71, 47, -74, 15, -97, 127, 38, 119, 81, 21, -22, -15, 0, 49,
+    100, -81, -118, -24, 0, 53, -105, -44, -69, 120, -124, 63, -109, -101, 41, 114,
+    50, -89, 8, -111, -61, 51, 93, 108, 106, -3, -70, -75, -18, 36, -17, -14,
+    -65, 63, -74, 1, 11, -121, 30, -47, 53, -47, -29, 32, 22, -63, 31, 85,
+    23, 120, 78, -46, 85, 12, -2, 79, -17, -47, 9, -36, -108, 40, 78, 89,
+    -26, -76, -51, 48, 3, -1, -108, 106, 96, -38, -48, -20, -103, 29, -4, -4,
+    67, 20, -101, 25, -2, -55, -101, 117, -6, 41, -71, -2, -35, 43, 119, 0,
+    72, 52, 38, 93, -109, 21, -93, -91, 12, -66, -127, 60, 20, -12, -54, 111,
+    -70, 53, 43, -110, -55, -98, -64, -30, 26, 21, 73, 110, -16, -14, -59, 34,
+    62, -85, -40, 100, 56, 101, -36, 117, -17, 92, 60, -62, -41, -100, -82, 2,
+    -27, -47, 102, 15, -16, 106, -96, -14, -24, 54, -64, -70, 72, 25, 99, 28,
+    99, -33, 81, -66, 71, -113, 3, 40, -51, -84, 118, -112, 21, 89, 60, 53,
+    -8, -84, 114, 111, -101, -85, -52, -93, -119, 109, -19, 9, -26, 22, 107, 3,
+    127, -34, -74, -94, 114, -65, 21, 51, 2, 41, 12, -35, 101, 2, 52, 0,
+    -78, 32, -54, -61, 41, 9, 40, 11, -22, -33, -39, 67, 62, 110, 22, -22,
+    78, 50, 59, 9, 76, -96, 59, 30, -33, -102, -10, -52, -72, -38, -81, -42,
+    84, 77, -75, 5, -69, 74, 5, -74, 31, -47, 29, 1, 52, 109, -25, -11,
+    67, 67, -84, -20, -14, 27, -34, -35, 97, -26, 4, -85, -49, 24, -98, 77,
+    44, -27, -46, -84, -107, -49, 61, 21, -111, 97, -98, -81, -14, -103, -95, 69,
+    -62, 63, -37, -14, 4, -127, 65, -57, -3, 69, 74, 78, -35, -92, 26, -67,
+    -9, 19, 13, 36, -98, 23, -7, 103, -83, 13, 95, 47, -90, -109, -87, 64,
+    -80, 58, 72, 8, -53, 0, 60, -83, 72, -117, -51, -105, -16, 110, 59, -50,
+    -84, 105, -100, 87, -114, 38, -104, 30, 115, 10, 120, 27, -5, 103, 100, -33,
+    63, 31, -29, -13, 61, -30, -31, 3, 11, -15, -58, -23, -112, -57, 75, -81,
+    -49, 25, 95, 2, 88, 124, 56, -79, 79, 52, -37, -50, -108, -44, -102, -44,
+    2, -107, -53, -61, 124, 44, 59, 113, -2, -117, 82, -114, -84, -10, -114, -127,
+    81, 87, -121, 56, -20, 60, 74, 110, -71, -52, 118, -23, -47, 5, 5, -116,
+    -11, -13, -32, 121, -72, -24, -112, 52, -52, 84, 68, 13, 11, 23, 57, 126,
+    -91, -72, 41, -91, 66, 25, -55, -12, 15, 103, -64, 82, 79, -60, 44, 7,
+    -5, 100, -21, 20, 14, -18, -108, 22, 127, -16, -82, -118, -72, 124, -50, -117,
+    86, -92, 49, -101, -109, -115, -12, -42, -14, -50, 80, 16, -87, -27, -61, 11,
+    100, 26, 7, 77, 17, 93, -80, -38, 123, -21, 88, 60, -50, -74, -33, -37,
+    74, 68, 50, 34, 43, 89, 49, -50, 86, 20, 14, 16, 1, -4, 19, -30,
+    81, -38, 2, -52, -28, 1, -74, 28, 31, -93, -23, -4, 79, 5, 97, -14,
+    -19, -45, 12, -82, 91, -27, -68, 10, 21, -61, 27, -46, -26, -41, -41, -58,
+    -44, -3, -44, 49, 92, 55, 98, -97, 44, -14, 76, 86, -18, 24, -79, -13,
+    -7, 57, 14, 85, 127, -49, 78, -16, -34, -107, -100, -49, -37, -74, 13, -4,
+    76, 6, 41, -35, -78, -22, 30, -55, 21, -76, -35, 54, -41, 5, -72, -91,
+    100, 5, 13, 2, -20, -88, 53, -61, -53, -42, 71, -16, 37, -52, 49, 51,
+    101, -104, -61, 106, -65, 27, -38, 91, 32, -50, -96, 60, -33, 74, 6, 19,
+    6, -127, -36, 1, 31, 24, 62, 99, 93, -22, -112, 47, -12, 50, 78, 35,
+    -18, 36, -80, -33, 69, -83, 35, -58, 88, 93, 81, -73, 79, 37, -59, -48,
+    -61, -110, -37, 23, -21, -10, 61, -110, 83, 5, -61, -117, -73, -59, -23, 116,
+    83, -16, -6, -8, 64, -44, -87, 80, 22, 98, -91, 41, -92, 68, -59, -60,
+    -25, 98, 30, 71, 87, -83, 57, 97, 89, -41, -18, 53, -73, -20, 119, 84,
+    81, -34, 27, -71, 59, -54, 119, 75, -72, -31, -86, -3, -82, -43, -19, 0,
+    9, 4, -118, 106, 51, -94, -62, 91, -91, -95, -53, 37, -78, -24, -111, -107,
+    -66, 22, 125, -106, 116, 51, 40, -1, -28, 49, 26, -114, 39, 100, -53, 26,
+    91, -37, -55, 85, -127, 36, -11, 65, -53, -38, -11, -106, 47, 52, 27, 122,
+    -57, 82, 62, 117, -45, -103, -102, -107, -107, -36, -99, -99, 101, -119, 21, 59,
+    36, -39, 60, 17, 85, -26, -49, -116, 21, -73, -74, -127, 118, 118, -102, -1,
+    29, -28, -55, -77, 110, -77, -116, -46, -59, 24, 38, 84, 122, 27, -62, -118,
+    -85, 91, 101, -51, 80, -52, 86, 86, -95, -98, 65, -19, -8, 11, 74, -122,
+    -8, -2, -49, -4, 43, 32, 30, -63, 65, 73, -56, -50, 16, -6, 100, 23,
+    -106, 123, 3, -61, 10, 91, -36, 124, -121, 8, 21, 43, -105, -1, 87, -83,
+    -12, -106, 44, -102, 89, 38, -19, -24, 30, 117, 81, 49, -113, -119, 48, -46,
+    5, -65, -5, 87, 96, 119, -28, 49, -26, -117, -22, 50, -94, 98, 76, -86,
+    19, -68, -121, -38, 2, -12, 99, 98, -14, -3, 122, -17, -127, 17, -8, -108,
+    -94, 122, -70, 68, -31, -70, -5, -2, -29, -100, -18, 65, -94, -35, 97, 46,
+    46, 24, 49, 75, 85, -35, 95, -82, -73, -80, -60, 60, 46, 118, -24, -93,
+    -16, 36, -54, 1, 59, -37, -74, -66, 55, 2, 3, 72, 65, -35, 112, -41,
+    70, -117, -108, 116, -61, -58, -3, 6, 107, -27, 68, 108, 63, 54, 87, 67,
+    61, 35, -57, 69, -112, 64, 67, -120, 12, -89, 91, 67, -89, -51, -23, -25,
+    38, 7, 71, -36, -49, -94, 127, 115, -26, 33, -97, 75, -32, 1, -50, -114,
+    -102, -95, 90, 94, 120, 36, -45, -65, -93, 62, 18, -100, -97, -105, -100, 124,
+    80, 98, 3, 34, -76, 115, 104, -43, -17, 47, -120, -47, -109, 67, -64, -80,
+    -48, -89, 78, -94, -52, -19, 62, 0, 115, -72, -47, -16, 96, 68, 14, -72,
+    9, 79, 25, 101, -59, 20, -84, -45, 92, -45, -67, -110, 70, -91, 113, 14,
+    8, -65, 73, 80, -76, -93, -61, 71, -19, 127, 17, 3, -60, -50, 59, -19,
+    80, -95, 63, 32, 19, -47, -70, -55, -94, -32, 13, 78, 78, -63, 51, 78,
+    62, -47, 60, -94, -36, 56, 110, -13, -47, -23, 109, 91, -70, -57, 65, -58,
+    -80, -38, 87, 8, -39, -19, 51, -91, -23, 32, -16, 32, 74, -64, -63, 7,
+    4, -64, -45, -70, -75, 83, -65, 80, -9, 43, 93, -95, 87, 62, 73, 25,
+    72, -112, 43, 59, -22, -74, -85, 79, 74, 37, -127, -35, -10, -72, 3, -105,
+    34, 7, -66, 108, 82, 11, -115, 79, 96, 35, 116, 65, 59, -61, 7, 15,
+    78, 38, -79, 39, 89, 67, -120, 46, 73, 37, -11, -125, 75, 82, 94, -81,
+    -22, 50, 76, -66, 89, -56, -58, -84, 58, 53, -76, -8, 83, -7, -7, 4,
+    -115, -77, -22, -125, -101, 71, -83, 85, -31, 27, 50, -65, 0, 57, 1, 66,
+    103, 88, -105, -88, 59, -54, 74, -85, 5, -51, 71, 45, -13, 71, 51, -1,
+    -55, -80, 78, 32, 34, 126, -23, -36, 22, 53, -60, -102, 28, -42, 51, -21,
+    3, 94, 126, -78, 61, -67, 85, 44, 29, 77, 104, 113, 73, 1, 9, 95,
+    -24, -73, 42, -41, -62, 43, -29, 102, 24, 68, 25, 48, 0, -42, 64, -51,
+    -24, 127, -107, -50, 37, -27, -67, 64, 103, 59, 63, 54, 54, -42, -24, -81,
+    -24, -75, -67, -38, -32, 66, -63, 51, 50, -14, -67, 79, 41, 89, 111, -77,
+};
+
+static const int32_t _L0_bias[16] = {
+    -2056, -748, -464, 103, -7360, -3990, 2524, -6434,
+    2855, -5143, -2385, -1057, 2280, 81, 5326, 10385,
+};
+
+static const int32_t _L0_multiplier[16] = {
+    1614919263, 2035085262, 1209624202, 1201338079, 1327150969, 2076874038, 1628257323, 1969240200,
+    1472247526, 1783464035, 1640723743, 1543943785, 1757803583, 1088996080, 1917932224, 1720034507,
+};
+
+static const int8_t _L0_shift[16] = {
+    -8, -8, -7, -8, -9, -8, -8, -9, -8, -9, -8, -7, -8, -7, -9, -10,
+};
+
+// Layer 1: QUANT_LAYER_CONV, [25, 16] to [25, 32]
+static const int8_t _L1_weights[1536] = {
+    89, -72, -55, -76, -47, 118, 13, 54, 115, -34, -49, 106, 25, 86, 10, 7,
+    -83, -93, 55, 80, 23, -65, 3, 107, 113, 28, -16, -79, -31, -102, 103, 44,
+    -55, 101, 55, 17, 41, 19, 127, 57, 110, 1, -55, 20, 99, -50, -41, 41,
+    -116, -69, -118, -27, 20, -66, -116, -55, -127, -70, -57, 49, -7, -104, -114, 16,
+    -34, 118, -34, 52, 17, -63, -66, 56, -6, 65, -105, -53, -103, -120, -115, 43,
+    19, 55, 77, 9, -54, 26, -15, -87, -10, -12, 117, -37, -26, 16, 3, 20,
+    35, 69, -57, 115, -26, 103, 7, -70, -104, 117, 50, -34, -83, 76, 23, 110,
+    84, 29, -18, -25, 53, 51, -40, -13, -1, 16, 100, 69, 4, 45, -89, 15,
+    47, 10, 38, 22, -113, -88, -115, -11, -111, 127, -17, 118, 57, -45, -81, 92,
+    51, 5, -15, 18, 16, -103, 95, 93, -100, -67, 116, -18, 33, -90, 63, -30,
+    -58, -27, 10, 48, -106, -77, -8, -31, 66, -80, 80, -123, 66, 81, 123, -127,
+    7, -109, 25, -51, 52, 48, 116, -46, -87, -114, 65, -37, 67, -91, -18, -124,
+    -58, -110, 70, -80, -20, -6, 110, -16, 35, -41, -43, -74, 10, 70, 82, 109,
+    21, 18, 74, -104, -23, 93, 121, -84, -116, -62, 68, -83, 73, 16, -83, 79,
+    63, -79, -43, 60, 99, -81, 127, -64, 31, -39, 107, 82, -60, -117, 108, 40,
+    65, -68, 1, 5, 98, 80, -88, -70, 127, 26, -101, 78, -71, -31, -52, 64,
+    22, -63, 92, -25, 81, -104, 81, -109, -52, 28, -5, -65, 92, -50, -43, -95,
+    -100, 59, -85, 80, -106, -71, -16, 84, -55, -90, -57, 11, 92, 66, -19, 45,
+    26, 58, -33, -107, 60, 78, -20, 67, -106, 28, 105, 83, -12, -36, 74, 127,
+    61, -33, 60, -96, -72, -113, -77, 99, 78, -74, -55, 97, 90, -32, -81, -35,
+    72, 58, -17, 107, 6, -29, 75, -6, -18, -70, 33, 101, -98, 64, -43, 45,
+    53, 1, 59, 92, 111, -71, -111, -13, -72, 32, -106, 71, -54, 67, -69, -70,
+    38, 58, 51, 13, 112, 114, -29, -120, -57, 29, -34, 6, 46, 38, 74, -79,
+    -4, -127, 79, -9, 54, 35, 85, 76, -19, 47, -64, -38, 83, 68, 115, -14,
+    -28, 46, 9, 37, 94, 126, -68, -91, -71, 106, -83, -91, 96, -103, 50, -89,
+    124, -20, 87, -91, 44, -42, -19, 109, 89, -86, -78, -113, -57, -30, 30, 6,
+    127, -91, 73, -123, 97, -120, 2, -61, 61, 57, -60, -16, 36, 4, -55, -109,
+    -93, -87, 73, 62, -92, -17, -52, 50, 59, 76, 87, 48, -49, -72, 77, 56,
+    92, 127, 107, 42, 51, 84, 19, 108, 33, 116, 18, 22, -100, -75, 122, 62,
+    1, -24, -102, 93, -74, 95, -56, 116, 55, 104, 116, -89, 87, -120, 56, -81,
+    -89, 42, 87, -81, -85, -93, 63, -29, 77, -35, -13, 108, 121, 81, 54, -63,
+    94, 36, 81, 43, 36, -73, 70, -50, -127, -106, -69, 80, -67, 35, -110, 11,
+    -96, 11, -99, -87, 64, -87, 79, -111, 34, -58, -108, 53, -17, 8, 96, -95,
+    -89, 51, 24, -68, -74, -68, -70, -17, 11, -87, -93, 1, -31, -6, -95, -57,
+    -90, 70, 127, 88, -8, -3, -91, -41, 84, -84, -74, 60, 2, 80, -50, -71,
+    -45, 60, 40, 5, -96, 35, -7, 53, -38, 114, 121, -84, 75, -56, -46, -68,
+    57, 81, -37, 55, -85, 100, 17, 10, 94, 78, -112, 111, 69, 45, 94, 60,
+    64, 92, -19, 115, -112, 2, 62, 119, 3, 127, -117, -64, -73, 112, 96, -28,
+    -46, -38, -22, 5, -61, 34, 29, 24, -48, -56, -98, 95, -46, -37, 98, 45,
+    48, 94, 83, 62, -40, -59, 37, 60, -119, 109, -63, 33, 50, 2, -106, -6,
+    -44, -32, -116, -11, -33, -8, 40, -127, -85, -60, 26, -81, -82, -106, 113, 88,
+    95, 98, 85, 15, 7, -46, -93, -101, -76, 3, 75, 27, -30, 43, 73, -96,
+    34, -93, 114, 18, 24, -37, -120, 16, -27, 16, -70, -37, -17, 100, 108, -46,
+    83, 75, 91, -23, 79, -28, -110, 123, 48, 75, -100, -97, -8, -127, -122, 53,
+    -91, 68, 82, 85, 88, 89, -79, -85, 126, 19, 29, -15, 48, -31, -62, 28,
+    -103, -99, -106, -87, -41, 116, -38, -107, -43, -121, 101, -59, 106, -82, -42, -40,
+    6, 100, 26, 98, -10, -91, 27, 50, 113, -7, -127, 78, 34, 55, -111, -34,
+    -102, -4, 77, 66, 120, 59, -77, -13, -69, -79, -73, -18, -105, -18, -24, -48,
+    -52, -26, -55, -36, 70, 32, 122, -54, -31, -32, -111, 76, 25, -40, -83, -123,
+    -20, 60, 127, -25, -50, 59, 69, 94, -108, 72, 27, -42, -95, -47, 36, -31,
+    48, 6, 58, 127, -119, 73, -115, -41, 20, 46, -28, 50, 74, -11, 21, 19,
+    119, -3, -27, -119, -81, -100, -27, 58, -122, -117, 21, -5, -33, 106, -96, -82,
+    112, -69, 120, 78, -47, 36, -78, -37, 63, -102, -118, 114, 65, 38, 124, 115,
+    -27, 85, 76, -69, 33, 88, 38, 83, 116, -127, 98, 89, 76, 75, 112, 114,
+    -109, -1, 103, -43, 8, 27, -89, -63, 62, 61, -115, 27, -14, 78, 121, -71,
+    90, 43, -33, 27, -95, -127, 104, 6, 35, -112, -34, 27, -24, 85, 57, -70,
+    83, -44, 76, 74, 28, -119, -91, 18, 74, 53, 43, 79, -56, -78, -23, -13,
+    32, 77, -49, 99, -93, 45, -46, 60, 17, 96, 59, 110, 48, -72, -89, 40,
+    127, 109, -72, 109, 77, -62, 29, -50, 21, 86, -99, -88, 85, -93, 35, 50,
+    11, 26, -55, 60, -39, 17, 62, 4, -90, -23, 50, 67, 112, -105, -49, 46,
+    6, -29, -110, 121, 57, -110, -127, 66, -126, 54, 4, -88, -89, -81, 103, -45,
+    80, 108, 36, 46, 76, 103, -6, 51, 125, -99, 77, -60, -100, -108, -6, -24,
+    54, -71, -59, -74, -2, 120, -41, -37, -3, -43, 49, 79, 3, -74, 76, -35,
+    -113, -39, -7, 107, 82, 84, -5, -32, -86, 84, -77, -111, 54, -126, -101, -124,
+    -118, 79, 119, -56, 18, -2, 100, -61, -44, -114, 118, -126, -35, -124, -35, -85,
+    51, 89, -71, 25, -38, 100, -24, -122, -70, -127, 124, -103, -36, -87, -33, -111,
+    84, 15, -59, 125, -71, -104, 4, 86, -69, -117, -11, 14, 69, 3, -74, 120,
+    -6, -108, 59, 115, -58, 127, -34, -104, -113, 47, -88, 63, -112, -80, -17, -77,
+    85, -92, -72, 59, -87, -55, -47, 16, -8, -56, 39, -39, 87, -82, -8, 90,
+    -48, 33, -112, 114, -105, -116, -28, 24, -90, 5, -78, -17, -92, 42, 113, -60,
+    -115, 55, -32, -83, 42, -40, 127, -58, 32, 81, -64, 112, 20, 34, -11, -47,
+    -55, -102, 22, -92, -30, -108, 86, -63, 64, -56, -49, 116, 68, -35, 104, -45,
+    54, -127, 44, 99, 60, 124, -103, 126, 7, 9, -59, -19, 58, -117, 117, 91,
+    -67, 55, -71, -122, 74, 15, 97, -85, -62, -22, 82, 98, -17, 119, -42, -42,
+    -16, -89, -98, -76, 27, 57, 84, -30, -59, 21, -106, 82, 65, -120, -17, 87,
+    -60, 103, 104, 43, 112, -32, -60, 61, 47, -17, -76, 127, 42, 78, 60, 17,
+    -16, 15, 26, -21, 50, -87, 19, 73, -57, -48, -108, -76, 43, 31, 88, 84,
+    -36, -22, 66, -15, -14, -91, 25, -36, 8, -23, 115, 21, 63, 42, -18, 3,
+    -29, 50, -109, 115, -83, -105, -104, 44, 4, 104, -47, 98, -16, -79, -90, -1,
+    99, -80, -8, -10, -35, 11, 73, 104, -58, 11, -18, -100, -7, 16, -35, -93,
+    -14, -11, 20, -21, 12, 24, 76, -56, 122, 9, -54, 127, -31, 64, -110, -49,
+    -105, -80, 43, 44, -57, 48, -68, -106, 99, 115, 63, -82, 8, 70, 93, 65,
+    68, 28, -51, -35, 60, 34, 12, -118, 102, 95, -29, 28, -74, 111, 92, -82,
+    85, 64, -127, 56, -44, -100, 76, 14, 53, -83, 98, 14, -19, 107, 64, 0,
+    -67, 22, -41, -118, -21, -59, 127, -43, 52, 101, -24, -70, 18, -85, 126, 70,
+    79, 83, 40, 74, -22, 82, -39, 82, -113, 41, 84, 24, -96, -106, 79, 105,
+    111, 54, -114, 68, -91, 20, -83, 70, -6, -71, 30, -114, 26, -61, -42, -15,
+    121, -111, 14, -111, 43, -45, -11, -29, 19, 47, -46, 120, 30, 35, -52, -47,
+    123, -61, -107, -9, 49, 88, -105, 103, -4, 17, -29, -17, 8, -4, 33, -117,
+    -123, 72, -81, 101, 12, -58, -101, 106, 127, -102, -66, -104, -53, -109, -116, -117,
+    -71, -19, 47, -78, -115, -118, -18, 24, -77, 115, 2, -12, 123, -1, -57, -46,
+    67, 66, 86, 81, 100, 127, 9, 3, -97, -11, 81, 111, -74, 126, -16, -15,
+    126, 80, 48, 80, 22, -85, 52, -7, 1, 70, -42, -88, 32, -45, -87, 32,
+    65, -43, -109, -46, 64, -50, 13, -19, -80, -55, 52, -87, 52, 58, -69, 35,
+    99, -9, 118, 44, 14, -99, -84, -13, -81, -109, 84, -63, -127, -106, -105, -21,
+    37, 36, 58, 8, -75, -85, -37, 79, -81, 2, -106, -80, 24, -32, 78, 122,
+};
+
+static const int32_t _L1_bias[32] = {
+    110592, -154624, 69248, -50304, 35840, -40192, 62592, 70016,
+    -36480, 144768, -49152, -77568, 114432, -32512, 37632, -95488,
+    4608, 98048, 8320, 88576, -19584, -154752, -69248, -68736,
+    23808, 83584, -34560, 83072, 21376, -85376, 68096, -93312,
+};
+
+static const int32_t _L1_multiplier[32] = {
+    1349066638, 1379093168, 1359542295, 1374582869, 1406450036, 1367967915, 1466564123, 1439345968,
+    1365957510, 1373376153, 1474186942, 1443467437, 1427476672, 1417518404, 1336132198, 1217334634,
+    1326600421, 1364195054, 1333208474, 1414764252, 1322416054, 1273587820, 1357604550, 1392671585,
+    1406144709, 1530899646, 1462454288, 1423171732, 1377324107, 1285811836, 1343383734, 1365711435,
+};
+
+static const int8_t _L1_shift[32] = {
+    -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+    -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+};
+
+// Layer 2: QUANT_LAYER_CONV, [25, 32] to [25, 32]
+static const int8_t _L2_weights[3072] = {
+    -73, 31, -92, -21, 68, -22, 115, 51, 2, -49, 44, -3, -43, 46, -4, -88,
+    -17, -123, 21, 19, -9, -116, -63, 13, 57, -20, -112, -123, -99, 13, -60, 90,
+    40, -66, -19, 47, 29, 23, 76, -47, -62, -75, -98, -86, 30, 10, -99, 93,
+    111, -55, 84, -45, -31, -42, -102, -52, 41, 51, 18, 14, -24, -76, -25, -33,
+    -70, -22, 85, -59, -18, 84, -52, -32, 9, 13, 22, -110, 7, -11, -52, -58,
+    -85, 16, -118, -127, 65, 65, 109, 41, 10, 113, -116, 32, -55, -6, -95, -68,
+    104, 41, -51, -99, 112, -70, 74, -106, 88, 54, -87, -31, -34, 122, -18, -75,
+    -65, -49, -102, 3, 68, 53, 101, -42, -95, -115, -50, 81, -64, -39, -53, 35,
+    -88, 38, -22, -97, 70, 57, 7, -80, 44, -22, -23, -70, 26, -79, 71, -64,
+    45, 90, -93, -77, -40, -33, -100, -42, -10, -5, 15, 57, -20, 34, 54, 27,
+    48, 81, 80, -96, -21, 17, 95, 103, -26, -96, -28, -56, 106, 101, 4, 121,
+    96, 119, -9, -40, -15, 108, 55, -39, 18, 111, -127, 20, 111, 54, 112, -31,
+    -85, 33, -9, -95, 1, 13, -95, 56, 37, -115, -64, -9, -75, 17, -63, -17,
+    69, -54, -127, -106, 89, -24, -23, 73, 2, 29, -56, 38, -18, 62, -111, -71,
+    -71, -23, -71, 85, 51, -43, -30, 100, -84, -117, 83, -61, 11, 74, 51, -69,
+    12, 106, 41, 66, -14, -97, -23, -1, -67, -49, 20, 74, 86, -89, -62, -20,
+    100, -58, -7, -126, -88, 45, 44, -80, -12, 98, -17, -36, -47, 20, -41, -98,
+    -85, -16, 23, -99, -42, 114, -102, -56, -30, 47, -53, 98, 74, 21, -7, 61,
+    -64, -118, -98, 82, -6, 13, -121, 55, -123, 100, 21, 59, 32, 96, -12, -118,
+    -17, -34, 45, 19, -96, 121, 126, 48, 124, -59, -71, -7, -68, 35, -38, 120,
+    85, -34, 57, 9, -70, 33, -76, 74, 5, -103, 86, -71, -33, 103, 60, -54,
+    28, 48, 86, -81, -102, 48, 99, -79, 40, 39, 40, -61, 127, -13, -31, -63,
+    94, 49, -105, -56, 3, 72, -111, -40, 55, -26, 78, 119, -84, -77, 85, -20,
+    -18, 111, 102, -89, 22, -35, -1, -89, 85, 28, 85, -80, -108, 125, -69, 25,
+    26, 38, -96, 74, 27, 71, -47, -111, -88, -71, -36, -76, -6, -41, 73, 99,
+    -62, -81, 62, -95, 111, 100, -88, -86, 22, -19, 21, 61, -39, 102, 75, -14,
+    -15, 87, -65, -25, -119, 111, 84, -35, 59, -69, -69, 118, 27, 101, 88, -89,
+    28, -44, 87, 72, 38, -104, -11, 37, 1, -44, 108, -17, -2, 102, 100, -127,
+    -47, -11, 44, -9, -56, -35, -90, 105, 98, 18, -2, -64, -10, 70, 94, 42,
+    39, -112, 102, 15, -105, -79, -102, -1, -23, 3, 108, -58, -61, 79, 39, 22,
+    -93, 67, 51, 72, -53, 27, 11, -36, 17, -49, 78, -36, 17, -16, -93, 55,
+    70, -74, 96, -74, 112, -46, -33, -74, -4, -24, 40, 43, 85, -47, -58, 32,
+    52, -75, 11, -120, 80, -82, 76, 108, -35, -14, 94, 77, 59, 45, 39, -71,
+    57, -42, 65, 11, 110, -11, -116, -16, 35, 15, 37, 7, 115, -99, -53, -83,
+    -99, 127, 68, -56, -105, 69, 21, -79, -97, 12, -5, -76, 97, 77, 89, -28,
+    -38, -62, 59, -98, -76, 92, -73, 40, -58, 25, 95, -109, -18, -42, -75, -111,
+    40, -86, -105, -51, 80, -51, 111, 24, -31, -79, 41, 17, -114, 122, 97, -56,
+    105, -45, -78, 88, 127, 91, -105, -112, -6, -24, -15, 73, -100, 1, 38, -74,
+    -65, 7, 96, -84, -91, -87, -66, -38, 16, -108, 59, -2, -26, 58, -43, -45,
+    -58, 43, -47, -67, -69, -21, 123, -112, 107, -9, 1, -113, 94, 78, 52, -107,
+    -123, 35, -81, 9, 119, -96, -89, 73, -38, 63, -9, 87, -100, 92, -18, -5,
+    -56, 39, -52, 56, 40, 21, 50, 77, 81, 109, -100, -101, -96, 98, -39, 116,
+    -69, 70, 14, 45, 19, -81, 62, -75, -80, 98, 91, 9, 24, 40, 19, -22,
+    -34, -123, -5, 93, -40, -67, 3, -100, -7, -47, 66, -95, -16, -74, -127, 41,
+    104, -25, 34, -8, 72, 40, 97, 59, 87, 75, -98, -47, 18, -71, 77, 47,
+    -50, 3, 10, -98, 68, -47, 81, -70, -13, 58, 39, -53, 116, 84, 87, -55,
+    -104, 41, -9, -23, -34, -4, -52, -108, 112, -76, 125, 38, -91, -22, -37, 66,
+    58, -58, 63, 49, -107, -54, 70, 106, 31, 45, 2, 38, 60, -29, 39, 110,
+    -92, -38, 94, 28, 106, -62, 48, 61, 99, -41, -86, 116, 12, 98, -88, 80,
+    -94, -98, 103, 127, -97, 108, -17, -25, -37, -48, 89, 12, -20, 119, 35, -56,
+    -78, 70, 44, 44, 69, 58, -76, 68, 124, 55, -24, 5, 21, -59, -87, -86,
+    -52, -111, 20, 33, -85, -12, -49, -105, -61, -46, -109, -88, -20, 118, -11, -69,
+    -121, -110, 94, -32, -113, 11, -94, -13, 89, 75, 96, -59, 77, 121, 75, 0,
+    78, 41, -6, -67, 89, 30, -35, -39, 46, 81, -86, -39, 106, -37, -56, 5,
+    47, -105, 42, 123, 98, -110, -4, 12, -31, 47, 7, 66, 10, 100, -26, 25,
+    1, -4, -123, -18, 14, -17, -106, 104, 82, 43, -109, -47, -34, 66, 42, 30,
+    -19, -1, -8, 110, -94, 9, 18, 76, 51, -40, 99, -104, 60, -80, 65, -17,
+    -1, 41, -100, -116, 55, 47, -65, -37, -55, -79, -44, -110, 47, 1, -21, -103,
+    -47, -19, -19, 127, 37, 34, -58, -13, -57, 4, 111, -112, -96, -83, -66, -51,
+    -97, -9, 57, -32, -118, -49, 104, -72, -79, 60, 36, 74, -43, 18, 85, 42,
+    51, 71, 24, -58, -14, 122, 100, 27, 112, -33, -37, -85, 27, 65, 0, -13,
+    42, -120, 62, -83, -44, -54, 119, -35, 14, -30, 41, 92, -72, 55, 68, -77,
+    60, -104, -31, -76, 80, -119, -64, -46, -63, 4, 21, 86, 31, 82, -40, 44,
+    -24, -101, -44, 64, -91, -85, 14, -65, 66, -127, -24, 48, -77, 59, 75, -53,
+    -50, 64, -88, -45, 20, -24, 15, 81, 85, -108, -42, -26, -52, 80, -45, -52,
+    -40, -57, -101, -29, -120, 24, 77, -7, 102, -99, -3, 58, -111, -34, 52, -88,
+    -62, 54, 37, -98, -30, -74, -56, -77, 43, 101, 106, 27, -86, -89, -4, 85,
+    23, 5, -79, 28, -74, 74, 0, 88, -14, 93, -69, -60, -64, 29, -13, -32,
+    21, -102, 54, -64, 83, -57, -47, -70, -6, 16, -78, -100, -69, 127, 63, 22,
+    -17, 58, -112, 42, -1, 69, -64, -59, -58, -4, -111, -17, 73, 57, 25, -60,
+    -19, -38, 83, 23, 5, -60, 13, -64, -88, -16, -13, -50, -47, -104, 38, 21,
+    66, 63, -55, 33, -111, -69, 93, -16, -109, -69, 36, -117, 116, -114, -67, 27,
+    -69, -103, 39, 121, -54, 53, -91, 58, -51, 0, -52, 94, 114, -42, -30, 115,
+    68, -103, -78, -110, -92, 13, 83, 11, -109, 49, 10, -112, -108, -40, -33, 78,
+    91, 103, 91, 127, -54, 34, 50, 37, 50, -41, 61, -85, 19, 34, 28, 80,
+    105, 35, -123, -101, -64, -85, 25, 8, 75, -9, -83, -68, 107, -91, -25, -68,
+    -51, -60, -3, 86, 106, -22, 93, 4, 9, 27, -14, -19, -95, -114, 44, -70,
+    44, 65, -73, 2, 29, -79, -67, -113, -121, -18, -38, 69, -78, 104, -44, 8,
+    58, -40, -61, 110, -127, -43, -62, -92, 71, -57, 81, -31, 30, -91, 28, 66,
+    35, 31, -19, 24, -78, -93, -104, 91, -97, -111, 63, 15, -91, -25, 67, 83,
+    97, 37, -31, 30, -17, -95, -49, -18, -15, -2, 82, -107, -54, 106, -13, 91,
+    -69, -111, -63, -94, 58, 99, 94, 121, 124, -40, 48, 82, -102, 46, -14, 93,
+    68, 47, -93, 37, -67, -99, 39, 50, 72, -88, 89, -85, 59, -51, -113, -26,
+    -16, 46, -69, -59, 100, 36, -7, -93, 14, 82, -65, -30, 58, -77, 22, -69,
+    59, -62, -87, 81, 81, -2, -42, -105, -125, 111, -39, 43, -82, 21, 90, -36,
+    1, -53, 57, -101, -10, -116, -88, 63, 66, -68, -7, -21, 38, -48, 2, 42,
+    -67, 17, -40, -16, 110, -26, -83, 80, -89, 45, -87, 4, -116, 65, -70, 123,
+    117, -110, 79, -83, -125, 52, 49, -48, -127, -26, 69, -71, -81, -18, -16, -104,
+    109, 28, 44, -89, -5, -23, 40, 75, -14, -49, -56, 64, -109, -29, 40, 41,
+    -13, 86, -30, 103, 59, -84, 22, 28, -120, 77, -76, -124, 74, 70, 4, -66,
+    -96, -35, -108, -104, 85, 57, 13, 6, -20, -27, -82, -51, 66, -46, -85, -80,
+    -32, -101, -14, 26, 20, -14, -64, 103, -25, -78, -73, -13, -124, -24, -14, 7,
+    68, 29, -100, 21, 44, 51, 47, -118, 88, -38, 100, -55, -121, 103, -66, -94,
+    -10, -90, 24, -8, -80, 122, -83, -81, 102, 51, -35, -64, -26, -7, 55, -112,
+    -40, 127, -48, 0, -31, -100, -56, 47, -82, 93, -115, -15, 116, -39, 38, -27,
+    -5, -49, 63, 54, -39, 1, 125, -93, -54, 100, -58, -40, -68, 89, 62, -20,
+    -45, 5, 83, -27, 38, -112, -96, -18, -90, -33, 95, 43, -7, -9, -41, 14,
+    -41, -43, 78, 127, 68, -37, -7, 38, 62, -31, 50, 91, 111, 13, -35, -53,
+    -55, -108, 89, 19, 28, -64, -33, 104, -13, -6, 111, -99, -23, 5, 33, 86,
+    -23, 59, 48, 88, -69, -22, 13, 44, 104, -79, 51, 83, 38, -3, -20, -89,
+    -66, -50, 79, 95, 73, -17, -39, -79, 99, 95, -35, -32, -8, -16, 59, -44,
+    -102, 61, 80, -92, 11, 8, -62, -67, -6, 82, 55, -103, -103, -77, 62, -28,
+    23, 17, -105, -127, -116, 45, -103, 124, -5, 70, -86, 27, -19, 11, 80, -15,
+    101, -86, 3, -87, 84, -58, 108, 94, 49, -23, 23, 113, 119, 113, 95, 74,
+    -101, -37, 24, 53, -76, 109, -89, 88, -116, -68, -42, -115, 104, -114, 73, -18,
+    -68, -67, 21, 51, 16, 48, 46, -52, -108, -51, -62, 31, 110, -65, -55, 22,
+    101, -29, -14, 77, -41, -66, -18, -63, -35, -94, -41, 12, 76, -4, -93, -114,
+    -32, 20, -60, -42, 26, 3, -92, 87, -57, 63, -108, 12, 30, 104, -36, 104,
+    77, -113, 54, 76, 67, -24, 99, 17, -77, -101, -34, -16, -80, -127, 20, -79,
+    34, 78, -47, -86, -66, -43, 89, 80, -29, -60, 51, -70, -90, -80, -17, -90,
+    110, 49, -74, -108, 114, -66, -5, 73, -106, 117, -106, 4, 107, 6, 39, 72,
+    12, -55, -110, 104, -120, 64, 18, 0, 36, 73, 45, 96, 90, -93, -34, -29,
+    -60, -39, -99, 23, 84, -71, 83, 54, 23, 28, -14, -21, 55, -93, 15, -19,
+    11, -81, -9, 112, -82, 11, -9, -104, 55, -101, 17, 31, -46, -6, 0, 72,
+    19, -72, -81, -43, 77, 15, 73, -75, 30, 48, 0, 125, 90, -78, 33, -60,
+    21, 19, -1, -72, -73, 36, 26, -50, -7, 78, 82, -59, 76, 25, -70, 47,
+    -58, 59, 57, -80, -127, 53, 4, 107, 15, -49, 107, -12, 107, 25, -99, 43,
+    -4, -33, -101, 97, 103, -75, 61, -81, 69, 55, -9, -124, 4, 56, 12, 64,
+    17, 1, 121, 71, 49, -71, -54, 67, 76, 64, -28, -99, -110, -48, 0, 29,
+    15, 3, -36, 116, 58, 108, 5, -59, -104, -109, 60, -43, -99, 110, 55, -81,
+    39, -57, -19, -90, 62, 45, 127, 80, -28, 53, -27, -33, 25, 75, 96, -55,
+    45, -66, -16, -57, -70, 10, -76, -61, 63, 99, 95, -62, 30, -46, 60, 64,
+    -2, 3, -28, -14, 50, -5, 111, 11, 66, 13, -97, -59, -45, -57, 75, 94,
+    42, -78, 63, -98, -85, 57, -76, 89, 35, 59, 19, 57, -71, -78, 92, -96,
+    39, 5, 46, 64, 21, -84, 23, 31, -17, -62, -92, 50, 18, -18, 16, -52,
+    81, -40, 87, 51, -27, -42, -69, 86, -44, 23, 51, -118, -70, 1, 39, 55,
+    64, -75, -20, -49, -56, -3, 25, -36, 35, -68, 7, 26, 0, -91, -49, -31,
+    -66, 87, -15, 13, -12, -5, 99, 116, -56, 33, 33, -64, 98, -8, -49, 10,
+    80, -86, -69, 0, 74, 89, 32, -92, -102, -42, 61, -117, -33, 94, 62, 26,
+    -81, -19, -43, 90, 103, 72, 88, -99, -32, 28, 72, 75, 78, 76, 35, -108,
+    -97, 99, -94, -105, -40, 76, -71, 20, 21, 6, -84, -41, 72, 2, -20, -112,
+    55, 99, 110, -59, -91, 49, 63, -46, 92, 114, -26, 42, -13, 87, -127, -9,
+    -40, 85, -118, 117, -50, 95, 69, 49, -92, 7, -71, -69, -59, 72, 11, 68,
+    108, 127, -64, -107, -12, 101, -72, 37, -48, -102, -37, -43, 73, 60, -99, 61,
+    78, -93, -97, -22, 19, 30, 72, 44, 64, 86, 122, 84, -9, 68, 82, 105,
+    -88, -108, -74, 83, -99, 9, 37, -48, -76, -8, 99, -63, -83, -51, -25, 118,
+    4, 80, 56, -106, 54, 86, -37, 29, -46, 90, -20, -87, 38, -88, 100, -105,
+    -81, -102, -73, -37, 107, 0, -54, 90, 83, 39, -40, -9, -68, -22, 7, -38,
+    40, 82, -98, 92, 107, -113, 127, -42, -124, 70, -58, 107, -64, -47, -77, -30,
+    68, 7, 80, -5, 76, 29, 75, 74, -45, 127, -22, -21, -59, -17, -57, 31,
+    23, 80, 87, -36, 57, -21, 105, -68, 77, -84, -14, 109, 27, 70, 70, 72,
+    38, 28, 75, 114, -64, 57, -118, 73, 64, 124, -88, 52, -71, -117, -70, 31,
+    44, 25, 11, 115, 108, -15, 98, 58, 10, 111, -59, -22, -1, 66, -46, 44,
+    -8, -101, -86, -62, 1, 65, 33, 104, -89, 85, 1, 35, -92, -96, 14, 82,
+    6, -6, 79, 114, 94, 104, 116, -67, 66, 21, -110, 93, 88, -67, -87, 103,
+    -16, -44, 62, 26, 118, 107, 62, -94, 73, -111, -31, 107, -32, 58, -40, 38,
+    -82, -37, -5, 126, -22, -70, -65, 51, -41, 115, -73, -75, 62, 96, -21, -78,
+    -57, -45, 107, 31, -20, -7, -111, 65, -124, 99, -89, -72, 31, 0, -86, -113,
+    5, -74, -89, 90, -1, 110, 92, 70, 96, 127, 82, -1, -67, 8, -17, -18,
+    -110, -83, -1, -1, -8, 65, 105, 39, -34, 34, -70, -106, 5, -74, -25, -88,
+    24, -25, 4, 39, 39, -97, -37, 28, -119, 76, -89, 24, -63, -40, -105, 43,
+    19, -19, 60, -87, -71, -62, -65, 11, -42, 31, 69, 66, -31, 85, 84, 71,
+    -68, 13, 21, -51, -63, -46, 22, 38, 84, 35, -45, 47, -56, -28, 36, 90,
+    -114, -17, 47, 22, -73, -75, -39, 50, 100, -52, -2, 89, 22, 2, -19, -17,
+    -14, 103, -57, 21, 86, -54, 43, 78, 78, 73, -7, 60, 99, 88, 86, 74,
+    127, -59, 119, 53, -18, 31, 69, 115, 58, -18, -92, 92, 23, 36, 27, 40,
+    -85, 62, 28, 103, -101, -53, 12, 44, -16, -42, -57, 90, 53, -56, 115, 3,
+    -6, -47, -64, 23, 91, 17, 111, -16, -80, 51, 7, -48, 89, -70, -5, -99,
+    67, -119, 30, 64, -4, 86, 101, 74, 91, -48, 63, 40, 97, 76, -47, -11,
+    -16, 19, 91, -1, 5, -48, 40, -63, -34, -22, 26, 67, -63, -84, 104, 10,
+    73, -82, -24, 88, -84, -83, 43, 127, 48, -30, -40, 87, -86, -79, -21, -55,
+    -72, -69, -45, 12, -69, -81, 61, -25, 34, 99, -110, 27, -19, 40, -46, -18,
+    51, -107, 20, -78, 95, 42, -94, -58, 3, 65, -59, -82, -86, 25, 113, -49,
+    93, -82, 88, -88, 43, -81, -5, -108, 50, 73, -99, 30, 54, 108, 108, 19,
+    -49, 31, 78, -11, 24, 60, 45, -66, 14, -50, -73, 67, -31, 12, 107, 31,
+    83, -61, -15, -58, -8, -29, -94, 9, -6, 19, 4, 57, -83, 17, 94, -78,
+    -34, -59, 63, -8, -7, 32, 127, 18, 32, 22, 23, 20, 68, -41, 33, 106,
+    22, -80, -102, -27, 5, -66, -86, 39, -13, 108, 80, 27, 62, -23, -84, 60,
+    -59, -41, -95, -67, -15, 33, 55, 50, 64, 39, -47, 73, -49, -117, -110, -84,
+    29, -90, 57, 119, -106, 1, -108, 112, 96, -56, 91, 118, -15, -67, 26, 66,
+    72, -91, -77, -97, 110, 44, 61, 90, -67, -119, -127, -41, 8, -70, 63, -50,
+    10, -45, -77, 37, -79, -38, -70, -124, 37, -15, 21, 74, -88, -7, -23, 124,
+    106, -46, 68, 68, -72, 13, -92, -67, 57, 21, 60, 55, -31, 88, -121, 81,
+    90, 13, 51, 17, 107, 73, 54, 30, -22, -4, 65, -70, -6, -90, 75, -63,
+    73, -32, 40, -118, 90, 94, -25, -86, 2, -54, 105, -47, 17, -49, 43, 97,
+    100, 112, -50, -34, -109, 119, -18, -113, 45, 73, 121, 23, -26, -53, 6, -25,
+    -44, -91, -44, -96, -98, 44, 67, -123, 63, 57, -14, -79, 107, 40, -27, 111,
+    46, -90, 75, 41, 25, -69, 30, 40, 127, 90, -97, -116, -61, -59, -60, 70,
+    -69, -7, 44, 74, -79, -97, -13, 75, 32, -42, 24, 89, -81, -3, -74, -117,
+    -51, 123, 98, 28, 63, -101, -78, 41, -126, -88, 61, -32, -106, -122, -25, -61,
+    -6, 32, -97, 91, -82, -71, 34, -13, 22, 23, -1, -81, 58, -110, -19, 11,
+    84, 63, 122, -13, -75, -30, 6, 2, -68, -71, 4, 107, 14, 93, 91, -69,
+    -25, 71, -26, -23, -55, 94, 106, 0, -37, 15, -99, 43, -44, 18, -110, 12,
+    -78, 94, -5, -95, 58, -59, -87, -21, 45, 6, -90, -104, -32, -44, 82, -76,
+    -93, -1, -55, 91, 111, -63, -23, 70, -50, 2, 54, 36, -42, -32, 77, 0,
+    -16, -48, 90, -40, 127, -94, 84, 33, 52, -33, 117, 102, -78, -80, -100, -65,
+    16, -37, 16, 46, 5, 15, 93, -69, -41, 9, 71, -55, 87, 44, 82, 61,
+    24, 18, -22, -42, -81, -23, -8, 81, 14, -65, -24, 86, -9, 84, 17, 100,
+    44, -59, -4, -42, -63, -65, 74, -34, 51, 58, -68, 24, -92, 89, -79, -31,
+    80, 127, -71, -58, -41, 40, -103, -100, 5, -22, -73, 61, 34, -109, -24, -42,
+    107, -14, 50, -14, 23, -21, 57, -42, -75, 16, -69, -37, -77, 45, 60, 75,
+    37, -48, -12, 58, 53, 61, 84, 46, -102, 6, -102, -74, 40, 1, -53, -3,
+};
+
+static const int32_t _L2_bias[32] = {
+    4763, -8359, 3016, 15020, 12374, 2593, 12597, 3878,
+    3642, 820, 3978, 974, 2677, 16729, 5568, 6897,
+    -16505, 2991, -21930, -257, -15922, -1613, 9351, -1654,
+    -3239, -6067, -12979, -14947, -6850, -5738, -3000, -8237,
+};
+
+static const int32_t _L2_multiplier[32] = {
+    1948440206, 1903344351, 1125739612, 1444762428, 1250738490, 2034381076, 1809975663, 1982476614,
+    1544821772, 1853320358, 2040383430, 1312268534, 1941445859, 1254243176, 1260512782, 1471805555,
+    1893209345, 1812872376, 1706449609, 1437866512, 1743127427, 1372436406, 1330366454, 1183537704,
+    1668072212, 1213572662, 1421917021, 1762414201, 1310359199, 2119864931, 1914477620, 1679395717,
+};
+
+static const int8_t _L2_shift[32] = {
+    -8, -8, -7, -8, -8, -8, -8, -7, -8, -8, -8, -7, -8, -8, -7, -7,
+    -8, -8, -8, -8, -9, -8, -7, -8, -8, -7, -8, -9, -7, -8, -8, -7,
+};
+
+// Layer 3: QUANT_LAYER_MAX_POOL, [25, 32] to [12, 32]
+// Layer 4: QUANT_LAYER_CONV, [12, 32] to [12, 64]
+static const int8_t _L4_weights[6144] = {
+    -30, -3, -28, 5, -95, -84, -20, -22, -28, -45, 21, 16, -3, -126, 88, 10,
+    127, 26, -63, -14, 115, 19, 73, 83, 80, -55, 110, 66, -10, -69, 116, 89,
+    -56, 99, -78, -98, 10, 13, -39, 100, 78, -96, -93, -63, -66, -54, 112, -76,
+    -22, 16, -81, -122, -72, 98, 92, 66, 6, -105, -11, -41, -51, -28, 49, -126,
+    -111, -107, 72, 33, -119, 107, 96, -20, -31, -74, -10, -100, 17, 104, -40, 37,
+    83, -114, -41, -84, -78, -115, -42, 105, -59, -9, -41, -82, 96, 66, -120, 56,
+    49, 51, 81, 101, 5, 108, 12, -80, 17, -48, -60, -105, -74, 47, -13, 32,
+    -66, 13, -7, -43, -25, 16, 24, -82, -92, 14, 25, -95, 90, 22, -30, 22,
+    -42, -80, 23, 64, 99, -64, 25, -97, -58, 63, 11, -35, -8, 49, 28, -52,
+    48, -21, 48, -13, 77, -8, -70, 35, 96, 45, 52, -37, 3, 19, 110, -84,
+    26, -41, 36, -36, -42, 9, 15, -95, 59, 24, 85, -106, -98, 62, -12, 92,
+    94, 127, 15, 78, 14, 37, 22, -76, -34, -37, -111, 41, 71, -50, 72, -15,
+    53, 5, -70, -31, -21, -46, 115, 76, -66, 13, -22, -60, -22, -9, 45, 34,
+    14, 55, -127, 82, -47, -29, 76, 90, 44, -108, -36, -104, 107, 98, 94, 23,
+    -68, -19, -20, -117, -43, -52, -38, -78, 108, 6, -18, -93, -109, 53, 55, -85,
+    55, -113, 107, 123, -101, 115, 102, 69, -70, 35, -72, 104, 114, 28, 68, 22,
+    -79, -75, -102, 84, 4, -82, 67, -57, -46, 109, 22, -6, -34, -2, 51, -84,
+    76, -16, -106, -67, 53, 106, -70, -1, -102, 120, -92, 6, 65, -15, 74, -4,
+    -76, 15, -51, -4, -62, 118, -33, 104, 61, 73, -114, -60, -62, -23, 98, -16,
+    58, -38, -100, 108, -7, -26, -10, -8, -116, -99, -106, 46, -34, -9, -81, -31,
+    48, 50, 103, -109, -67, -59, -28, -68, 81, -46, -19, 99, -71, -55, -46, 1,
+    -5, -89, 55, -32, 54, 41, 37, -54, 63, -72, 50, -36, -88, 96, -14, 73,
+    -101, -90, 28, -114, 99, -31, -108, 111, -85, 111, 78, -94, 117, -55, -69, -110,
+    55, -104, 71, -57, -98, -8, 52, 105, -24, -43, 104, -102, 127, 33, 91, -100,
+    -122, -104, 37, 125, -22, -91, -6, 108, 60, -1, 5, -19, 15, 88, -95, 41,
+    -119, 121, 32, -29, -34, -39, 97, -101, 20, -46, -72, -59, 88, 11, 85, 64,
+    -127, 98, 20, -102, -18, -94, 70, -94, -89, -116, -38, 35, -97, 100, 2, 122,
+    -71, 75, -87, 34, 75, 47, -30, -105, -107, 90, 88, -109, -22, 21, 4, 2,
+    -38, -52, -37, 66, 123, 87, 60, 80, -76, 65, 68, -89, -52, -45, 32, -33,
+    -26, 60, -66, -102, -28, -114, 4, 72, -53, 76, -20, 113, 54, 73, -48, -93,
+    -94, -76, 72, -51, 81, 67, -112, -7, 3, 18, -92, -77, 58, 104, -59, -62,
+    -48, 83, 75, 89, -53, 34, 73, 35, 4, 86, 111, 44, -2, 33, -126, -30,
+    -26, 63, -82, -87, -41, -111, 3, -74, 2, 10, 3, -30, -102, -114, -77, -121,
+    43, 75, 4, -20, -100, -19, 101, -71, 95, -85, 14, -70, -34, -78, 70, -45,
+    89, -107, -122, -57, 4, -56, -50, -53, 127, -54, 70, 102, -51, 89, 42, -15,
+    -41, 91, 83, 0, 32, 30, 54, 21, -35, 33, -2, 30, 20, -48, 3, 101,
+    91, 99, 95, 87, -49, 6, -31, -27, -9, 12, 59, -23, -32, -32, 35, -43,
+    -75, -30, -38, -38, 58, -67, -96, -96, 105, 9, 91, 52, -70, 47, -56, -104,
+    -50, 81, 1, 44, -52, 125, -112, -121, 17, -75, 64, 112, 21, 52, 50, -103,
+    14, -47, 106, -88, -54, 108, -75, -65, 80, -72, -87, 47, -81, -72, 86, 108,
+    114, 100, -61, 7, -3, -70, -53, -11, -122, -8, -123, 100, 41, -80, 5, 52,
+    98, 127, -62, 15, 39, -68, -13, -119, 46, 32, 18, -103, -11, -117, -111, -2,
+    -9, -74, 55, 44, 45, -26, 19, 109, -88, -60, -59, -55, 77, 35, 28, 44,
+    -82, 12, 21, -25, 105, 59, -68, -46, 77, 22, -84, -44, -54, 16, 115, -57,
+    -114, -68, -51, -29, -3, 84, -46, 123, 14, -72, -24, -37, 99, 43, 123, 55,
+    4, 2, -98, -103, -101, 103, 36, -30, 91, 8, 93, 83, 114, 68, 59, 47,
+    -77, -97, 15, 13, 20, -58, -10, 73, 18, 62, -43, 38, 78, 55, 127, -52,
+    -16, -7, 66, -14, 56, -59, 37, -104, -88, 98, -26, -56, 10, 95, 34, -33,
+    64, 70, -58, 30, -30, 21, -35, -55, 108, -43, -60, 127, 54, -65, 68, -96,
+    56, -81, 117, 47, 54, 37, -85, 86, -48, 85, -42, -72, -56, 116, 69, -105,
+    56, -39, -100, 93, 20, -24, -68, 15, 15, 104, -99, 54, -64, 109, 17, 12,
+    -60, -76, -64, 107, -109, 93, 41, -6, 67, -47, 76, 32, -60, -16, -102, 56,
+    59, -71, 76, 86, -92, -5, 74, 0, 101, 84, 0, -5, 70, 22, 96, -14,
+    6, -26, -82, 71, 54, -56, -60, 20, -28, 95, 90, 45, 55, 83, 104, -66,
+    27, -38, -91, 46, 90, -11, -118, 34, 58, 89, -7, 27, 12, -18, 77, 72,
+    82, 59, 49, -123, -36, -71, 68, -48, -125, -34, 5, -64, 54, 89, 103, 77,
+    -14, -98, 68, -108, 90, -1, -39, 21, 127, -10, 60, -31, 41, 48, -88, -34,
+    74, 93, 26, 47, -7, -94, -104, -49, 56, 10, -78, 47, -96, 71, 81, -99,
+    -101, 110, -57, 15, -19, -1, 85, -48, -84, -23, 114, -41, -104, -82, -42, 89,
+    101, 99, 15, 62, 101, 3, -9, -66, -3, 6, 0, 25, 38, 116, 56, 121,
+    97, -95, 18, -108, -77, 116, -30, 86, 109, 89, 20, -35, -82, 84, -48, -104,
+    79, -82, -26, 26, 20, 21, -68, 98, 38, -81, 47, 52, 4, -13, -88, 9,
+    -75, -110, -57, -86, 93, 37, -72, -52, 111, -4, -35, 10, 103, 98, -78, 125,
+    -56, -80, 65, 64, -28, -99, 56, 87, -64, -41, 67, -49, -103, 72, 70, -53,
+    85, -111, 47, 61, 52, 71, -57, -127, 15, -11, -122, 48, 22, 70, 107, -64,
+    -59, 27, 89, -93, 116, -54, 1, 53, 13, 1, -2, 66, -58, -41, -60, 91,
+    -68, 16, 93, -57, 15, 64, 72, -23, 108, -89, -38, -101, -15, 112, -71, -93,
+    72, -18, -81, -73, 62, -96, 87, 62, -24, 88, 50, 70, -58, -51, -94, 81,
+    127, -102, -87, -65, -33, 87, 79, 65, 93, 13, -83, -93, -91, 42, -103, 98,
+    49, 83, 0, 60, -71, -79, -26, -11, 67, -24, 56, -54, -38, -27, 29, -26,
+    74, -104, 39, -59, -68, 11, 47, 48, 85, -102, -8, -116, -90, 105, -2, -9,
+    4, 116, -54, -93, -51, -54, -5, 99, -65, -73, 62, -59, 26, -101, 68, 77,
+    11, -41, -55, 86, -111, 119, -111, 76, -105, -64, 69, 60, -73, -105, 12, 36,
+    -1, -35, 104, 44, -59, -76, 122, 97, 33, 114, -3, 46, 77, 104, -27, 6,
+    110, 104, 88, -93, 112, 87, -48, -36, -67, -106, -26, -58, -74, -92, 38, 60,
+    25, 67, 111, 86, -102, 58, -67, -15, 18, -10, -41, 56, 71, -37, 37, -1,
+    3, -48, 24, -63, 81, 98, 28, 77, -50, -10, 56, -47, 1, 106, 127, -17,
+    -4, -87, -112, 63, 81, 35, -92, -108, -115, -39, -97, -51, -112, 60, 56, -61,
+    -46, 22, 84, -112, 13, -12, -6, -120, -32, 79, 45, -53, -91, -90, 95, -120,
+    -11, 36, 74, -68, -25, 85, -14, 72, 100, -38, -9, 44, 23, 45, 1, 74,
+    -105, 24, 79, -48, 115, 35, -28, 26, -61, 80, 34, 14, 114, -27, 26, 88,
+    36, -13, 62, -70, -15, 125, 56, 91, 111, -60, 85, 42, -51, 87, -63, -61,
+    -72, -55, 118, 8, 101, -27, 95, 103, -81, 56, 1, 81, -19, 75, 86, 97,
+    -33, 82, 127, 80, 59, 14, 82, -58, -14, -58, -102, -56, 68, -34, 52, -16,
+    41, 99, 77, 54, -95, 12, 82, 29, 97, 102, 30, 58, 40, 69, -24, 28,
+    -104, -39, 94, -104, -41, -57, 24, 49, 30, -114, -63, 84, 110, -16, 85, -15,
+    117, 25, 109, -19, -66, -101, 48, 109, -58, -81, -93, 7, -20, 115, -111, 50,
+    -105, 116, -24, 30, 7, 49, 29, 2, 77, 110, 54, -41, 93, -8, 101, -21,
+    27, -9, 92, -30, -70, -50, -45, -51, -93, 53, -127, 62, 121, -59, 50, 84,
+    115, 12, -126, 74, 116, -62, 90, 51, 126, -114, -105, 72, 71, 17, -101, 24,
+    -32, -31, -111, 11, 96, -67, 81, 23, 87, -95, -98, 114, 55, -68, -98, 93,
+    -57, 44, 92, 16, 36, 79, 65, -52, -40, -35, 36, -60, 100, -100, -67, -113,
+    105, -35, 101, 23, -82, -55, -97, -55, 103, 59, 84, -30, -112, 66, -34, -86,
+    -82, 62, 105, -116, -12, 92, 12, -34, -103, -13, 57, -104, 4, 93, -62, 32,
+    -84, -61, 37, -122, -13, 26, 36, 83, -106, 92, -53, 127, -100, -18, -81, -69,
+    -35, -84, -68, 64, 1, 97, -65, 105, -72, -80, -12, -63, 86, 11, -53, -22,
+    -4, 40, 78, -108, 61, 74, -127, 37, 91, 64, -77, -48, -45, 64, 53, 22,
+    100, 100, -66, -89, -112, -80, -51, -42, 77, 23, -86, -89, 44, 86, -97, 6,
+    7, 62, 42, -50, -102, 114, -45, 30, 102, 70, -82, 28, 28, -105, -50, -16,
+    121, 114, 124, 31, -19, 37, 0, 44, 90, -95, 59, 58, -12, -17, -28, 46,
+    88, -40, -23, -5, -57, -19, 3, 42, -20, 30, -94, 9, 101, -27, -49, -94,
+    114, -5, -15, -85, -102, 71, 52, -53, 92, 114, -108, -42, 13, -113, -88, -116,
+    13, -55, 93, 84, 29, -42, -29, 21, -80, -118, -32, -77, -92, 101, -56, 21,
+    92, 71, -35, -75, 70, 40, 6, 67, -51, 16, 56, -54, 45, 9, 63, -83,
+    30, -8, 12, -65, 50, -96, 54, -35, -93, -114, -73, 47, 83, 95, 72, -37,
+    -20, -75, -14, 95, -89, 88, -44, 49, -127, 101, -73, 70, 72, 13, 94, -52,
+    -21, -24, 88, -76, -46, 16, -97, -116, 30, 3, -8, 8, -104, 42, 1, -63,
+    -106, 3, -82, -27, 102, 67, -76, 5, 24, 111, 104, 8, -77, -96, -69, 91,
+    -100, -71, 88, 68, -8, 21, 111, -116, -65, -16, -93, -14, 14, 51, -53, 7,
+    -124, 62, 29, -48, 104, -111, 106, -58, -122, -70, -95, 45, 97, 65, -92, 66,
+    -97, 92, -17, -72, 93, -54, 119, -119, 32, 127, -31, -98, 26, 85, -63, 121,
+    46, 114, -37, 55, 40, 32, -12, 87, 8, -116, 52, 82, 11, 119, -85, -112,
+    -112, -66, 34, 53, 89, -37, -52, 26, -126, 61, 91, 81, -92, 75, 60, -73,
+    -39, 112, 11, 24, 58, -38, 111, -92, 102, 44, -1, 59, 97, -114, -10, -94,
+    81, -49, -112, 97, 84, 81, -68, 96, 17, -90, 56, 101, -70, 77, 52, 1,
+    -67, 98, 36, -32, -24, -24, 63, -15, 107, -39, -42, -74, -88, 102, -17, 102,
+    -112, -2, 86, 81, -80, -77, 95, 94, 29, 112, -65, 127, 71, -83, 80, 78,
+    75, 62, 85, -36, 57, 60, -9, -51, -8, 20, -102, 120, 91, -30, -79, 29,
+    -103, -13, 76, -72, -10, -90, 24, 90, -84, 103, -102, -10, 66, 31, 29, 47,
+    -54, 118, -100, 89, -40, 74, 12, 37, 45, -87, 42, 115, 76, 12, 8, -86,
+    -86, 48, -95, -32, 93, 12, 11, -12, -84, 53, -57, -49, 88, 84, -80, 6,
+    -116, 79, -13, -30, 48, 83, 104, 97, 81, 83, 22, 28, 120, -4, 120, -101,
+    21, 88, -86, 6, 8, -111, 106, -90, 73, -26, 40, 52, 20, 84, 95, 127,
+    -90, 117, 59, -34, -41, -1, 87, 55, -43, -9, 12, -77, 33, 44, 27, 17,
+    -27, 41, 47, 108, 41, 83, 10, -112, -75, -64, -98, -110, 76, 114, -24, -50,
+    -107, -87, 10, -16, -19, -88, -30, 30, -73, 43, 95, 112, -62, -125, 43, -124,
+    85, 8, -112, 26, 7, -35, 37, 18, 124, 71, 79, -85, -1, 46, 35, 20,
+    -113, 92, 95, -64, 95, -84, 14, 100, -78, 36, 6, 91, 79, 4, 4, 55,
+    94, -57, 58, 12, 10, -76, -28, 91, -86, 61, 69, -17, 84, 0, 46, 105,
+    112, -97, 53, 78, 112, 76, -49, 0, -85, -15, -94, 94, 15, -120, -95, 106,
+    30, 72, 81, -6, -29, -31, -110, 86, -85, 87, 55, -118, 45, 23, 127, -9,
+    -97, 51, 30, -53, -81, -43, -21, 17, -65, -58, 13, 68, -76, -113, 76, 74,
+    -38, -47, -45, 18, 8, 58, -39, 63, 80, 20, 104, -127, 77, 53, -65, 39,
+    -35, -34, 40, 34, -22, -67, -60, -72, 28, -57, 22, 61, -89, 78, 20, 12,
+    -90, -73, -18, 6, 97, 62, 38, -52, -3, 108, -36, 94, -80, 16, 37, 64,
+    -62, 94, -90, 29, 90, -8, 24, 79, -62, -67, -4, -77, -9, -100, -3, 88,
+    -84, 88, -46, -16, 18, -46, -72, -37, -66, 8, 82, 18, -116, -15, 51, -20,
+    -93, 120, 81, -58, -71, -1, 69, -49, -65, -15, -30, 27, 21, 1, -23, 46,
+    -32, -43, -118, 3, -97, 12, 93, -127, 68, -106, -13, 95, -80, 80, -34, 27,
+    -29, 104, -115, -102, -42, -16, -85, 83, -71, 63, -35, 23, -1, -105, 44, -71,
+    -102, 42, 0, -63, 37, 99, 43, -60, -30, 0, -5, -77, 1, -12, -41, -19,
+    -92, 39, 79, 12, 81, 20, -29, 27, 72, 1, 74, 81, 53, 6, 77, 82,
+    -117, 22, 78, -91, 99, 31, -91, -73, -70, 0, 58, 15, 91, 89, -51, -82,
+    -11, 114, -83, -60, -62, 24, 98, -17, -14, 61, 39, -72, 3, -65, 56, -61,
+    -27, 127, -107, 81, -52, 3, -48, -57, 95, -26, -78, -65, 79, 126, -56, 12,
+    77, -63, -27, -103, 98, 88, -110, 10, -52, -107, -109, -111, -57, -73, -56, 26,
+    26, 76, -54, -10, -40, 107, 5, 36, 39, -31, -105, 90, 124, 33, 5, 125,
+    -58, 118, 111, 67, 21, -90, -90, 51, -102, -20, 46, -3, 30, -75, 21, -48,
+    -95, 69, -44, 67, -14, 51, -6, -46, 0, -46, -30, -26, 98, -82, 66, 96,
+    112, 67, 73, 103, -83, -108, 107, 19, 23, -83, 52, 115, -8, -124, 52, 70,
+    124, -26, -78, -13, -26, -87, -98, 84, -42, -29, -92, -69, -59, 66, 127, -101,
+    73, -79, -97, -7, -81, -27, 17, -75, 31, -13, -89, -89, 25, -75, -107, -56,
+    33, 99, 72, 68, 83, 10, -53, -21, 117, 11, -90, -21, -62, -45, -23, 60,
+    -70, -98, -103, -32, 75, 12, 33, 52, -120, -57, -58, 36, 11, -15, -104, -96,
+    -109, 122, -2, -50, -33, 100, -74, 4, 3, 116, -41, -62, -10, -53, -105, -93,
+    15, -20, 40, -61, -110, -63, -61, -125, 65, -92, 55, -106, -70, 94, 31, 106,
+    57, 10, 89, 21, 97, 122, -16, -21, 107, -116, 74, 122, -114, 43, 35, 78,
+    94, 1, 18, 15, 62, -127, 104, -76, 74, 42, 86, -99, 25, -119, -28, 115,
+    41, -106, -96, -41, 120, 119, -118, -32, 8, 32, -116, -30, 9, -85, 83, -79,
+    -41, 121, 8, -15, -80, -101, 121, 92, 3, 120, -86, -12, 1, 110, -70, 107,
+    -87, 89, -43, 87, -35, -18, 107, 80, 2, -106, 7, 47, -115, 10, -118, -46,
+    -71, 113, -109, 24, -7, -78, 20, -74, 87, 42, -52, 89, -108, -33, -92, 111,
+    127, -61, 30, 4, -51, 69, 101, -38, 104, 5, 48, -92, -37, 60, 33, 31,
+    -61, -12, 63, 65, 116, -88, -101, -60, 54, 6, -15, -81, -47, -30, -47, -24,
+    93, 37, 86, -67, -21, -96, 30, -51, 58, 94, -16, 60, -29, 43, 62, 12,
+    -43, 17, 98, 2, -87, 73, 50, -78, -5, -72, -14, 0, 32, 16, 87, 62,
+    -36, 25, 2, 89, -26, -55, 2, 4, -73, -76, 62, 17, 14, -90, -111, -107,
+    -83, 18, 36, -76, -6, 106, -125, -28, -20, -64, -67, 7, -66, -99, 17, -98,
+    -83, 27, -19, 18, -103, 100, 52, -61, 108, -83, -26, -103, -4, -100, 29, 79,
+    -31, -27, 65, 21, -6, -92, 91, -34, 109, 46, -19, -78, 112, 88, 98, 75,
+    -48, 64, 58, 76, -48, -62, -59, -28, 29, -39, -120, 127, 86, -63, 82, -34,
+    48, -81, 50, 41, -62, 99, 67, -77, -29, -64, 95, -6, 126, -33, -62, -11,
+    24, 113, -62, -11, -42, -39, 18, 24, 113, 79, -71, 34, 22, 2, 42, -49,
+    124, -109, 119, 14, -85, 36, 30, 20, -107, -55, -13, -86, 73, 12, 116, 89,
+    115, 24, 78, -97, 30, -20, -123, -84, -78, 78, -38, -60, 66, 10, -13, 76,
+    65, 95, -77, 86, 20, 58, 55, 43, 91, 82, 94, 54, 8, 43, -64, -50,
+    -43, 9, 109, -11, -75, 31, -64, -65, 94, -63, -88, -9, 30, -65, -40, -38,
+    -32, 115, -68, 37, -62, 84, -127, -24, 8, -87, -33, -25, 78, 28, -103, 19,
+    -75, 69, 22, 61, 69, -36, -5, -66, -53, 51, -95, -9, 40, 94, 36, -18,
+    -6, -19, 16, -95, 33, 99, 1, -72, 105, 56, -14, 29, -23, -3, 63, -52,
+    18, -36, -120, -75, -102, 95, -62, -1, 99, 54, -87, -6, -100, -105, 100, -78,
+    68, 66, 110, 107, -72, -12, -84, 63, 45, 9, -101, 100, 127, -100, -102, -124,
+    75, 47, 85, 59, 113, -4, -59, 63, 89, 20, -21, -104, 74, -102, -91, -31,
+    100, -51, 74, 31, 55, -24, 87, 52, -80, 66, 49, -89, 120, -17, -34, 75,
+    -23, 10, 104, -18, -18, -41, 19, -49, -76, 42, -65, -3, -108, -12, -75, 35,
+    75, 22, -10, 28, 43, 85, -56, -93, 90, 92, -82, 78, -13, -116, -82, 1,
+    -116, 79, -44, 81, -6, -74, -21, 127, -64, 94, -62, -35, 79, -58, 14, -49,
+    -67, 73, 103, 10, -43, -109, 63, 70, 50, -64, 94, -63, 55, -15, 89, 60,
+    -86, 100, 80, 1, -6, 20, 24, 116, -24, -19, -59, 59, 113, 31, -72, 83,
+    57, -72, 108, 15, -14, 27, 100, 30, -45, 26, 117, -67, -20, -51, 25, -46,
+    23, -33, -89, 122, 29, -6, 48, -12, 123, 50, 9, 34, 41, 115, 106, -82,
+    -87, 61, -57, 60, -49, -23, 9, -83, -7, 6, -90, 77, -48, -51, 45, -99,
+    -32, 54, 65, -110, 13, 82, -79, -8, 86, 39, 86, 75, 25, -116, -119, -33,
+    -38, -54, 91, 46, -57, 43, -45, -4, 127, -61, 34, -94, -42, 44, -11, -13,
+    -58, -108, -110, -41, 3, 47, -98, -74, -89, 109, 57, 16, -90, 61, -38, 74,
+    67, 67, -21, 109, 109, -39, -87, 100, -54, -3, 82, 6, 84, -23, 88, 58,
+    22, 21, -64, 40, 50, -7, -21, -51, 18, -18, 2, -72, 26, -65, -117, -57,
+    47, -26, -72, 0, -45, -4, 6, -2, 63, 12, 80, -88, -25, 17, 31, -85,
+    -6, 5, 13, -54, -109, 16, 100, -68, -66, -12, 44, 101, 51, -44, -123, -87,
+    53, 124, 77, 5, 39, 41, -18, 8, 117, -56, -112, -22, -93, -52, 39, 45,
+    34, -127, 97, -90, -108, 69, -9, 38, 68, 116, -7, -101, 30, 92, -113, 2,
+    34, 93, 53, 53, 105, -10, 85, 36, -73, 102, -124, -71, -21, -34, 60, -20,
+    -13, 40, 104, 104, 119, -95, -22, -22, -45, 48, 49, -26, -95, 28, 52, 112,
+    -37, 56, -15, 46, 49, 105, 85, 66, 53, -14, -93, -46, -19, -64, -27, 28,
+    -92, -74, 77, 101, 17, -27, 69, 127, 61, -85, 5, 30, 43, 22, 22, 32,
+    -101, 59, -5, 115, 7, 109, 28, 41, -61, 102, -74, -102, 72, -44, -67, -74,
+    57, 42, 62, 100, 43, -43, -71, -56, -102, -26, 79, -111, 76, 55, 106, -93,
+    7, 104, -17, -111, -11, -26, -107, 51, -34, 40, 84, -30, -101, 79, 51, 69,
+    71, 81, -54, 17, 40, -68, 74, 55, 93, 74, 23, -10, -12, 2, 87, -33,
+    8, -104, 65, 89, -98, -104, -65, 42, 20, 14, 6, 15, -83, 8, -119, -30,
+    1, 2, 87, 45, -51, 67, 93, 9, -81, -87, 96, 27, -59, -38, 103, -63,
+    -11, 53, 19, 41, -97, 98, -43, -66, -42, 26, 13, 31, -39, 17, -38, -36,
+    -62, -21, -72, -59, -60, 20, 57, 127, 51, 55, 2, -40, 25, 53, -54, 54,
+    83, -51, -55, 51, -56, 27, 59, 57, -2, 71, 59, -71, -14, -65, 33, 9,
+    45, 53, -79, -38, -76, 83, -4, 96, 65, -88, -30, -48, 37, 21, 108, 83,
+    77, 7, 65, 71, -20, 43, -60, 36, -37, 74, 48, -95, -63, 89, -36, -1,
+    -75, 117, 46, 52, -43, -63, 43, 22, 50, 102, 31, -86, 18, 41, -64, 105,
+    30, 4, -13, 75, 61, 74, 104, -35, 30, -20, -51, -46, 24, 8, 100, 52,
+    34, 26, 17, 83, 20, 117, 96, 120, 89, 78, -6, 60, 78, 19, 64, -8,
+    69, -31, 73, -70, 83, -55, 84, 31, 44, 26, -103, -81, -13, -26, -72, -10,
+    16, 127, -11, -86, 96, -123, 96, -71, 83, -30, 18, -30, -99, -30, 56, -5,
+    40, 25, -33, 18, 67, 51, 74, -46, -82, -65, 20, -9, 76, -112, -18, 80,
+    90, -108, -8, -17, 11, 38, -99, -24, -67, 104, -107, -103, 31, -94, 112, 25,
+    89, -2, -25, -73, -38, 102, -89, 127, -26, -74, 81, 126, -116, 52, -71, 53,
+    -73, -64, 63, -48, -74, -84, -89, -13, -4, 36, 50, 95, 15, -32, 14, -20,
+    52, -16, 104, 70, 55, -24, -21, 2, -108, 72, 33, -39, -70, 44, -111, -59,
+    69, -110, 71, 40, 59, -47, -38, 20, -30, -63, 19, -71, 116, 19, -116, 8,
+    -10, 49, 39, 43, -2, 35, -88, 8, 99, -124, 111, -107, -55, 27, -105, 30,
+    -90, 6, -36, -109, 114, 23, 41, 26, -39, -77, -59, 60, -115, 84, 19, -116,
+    -26, 3, -10, 94, 8, -104, -53, 73, -40, 43, 30, -58, 78, -94, 47, 112,
+    -36, 32, 15, -110, 92, 93, 27, 61, 7, -121, 93, 96, 74, 113, -23, -76,
+    116, 8, -91, -69, 49, 33, 48, -83, 28, -34, -35, 43, 19, -48, 98, -83,
+    67, -26, 105, -28, -121, -86, 127, -83, 111, 3, 112, 46, 64, 110, 113, 48,
+    -74, -86, 58, 109, 59, 57, -56, -93, -28, -1, 1, 82, -89, 97, 46, -9,
+    -6, 12, 85, 85, 90, 47, -74, -46, 58, 43, -37, 51, 55, 9, 23, -57,
+    32, 112, 15, 36, -71, -17, -105, 57, -36, 17, 103, -104, -48, 6, 7, 8,
+    -83, -93, -25, -20, 3, -108, -105, -24, -100, 72, -29, -16, -94, -60, -23, -45,
+    80, -93, -13, 95, 6, 10, -2, -95, 10, 14, 7, 84, -60, -12, -43, 65,
+    95, 43, -25, -52, 65, 5, 1, -58, 42, 4, -15, 79, 43, 9, -58, -54,
+    -81, -2, -77, 18, -78, -81, -40, 51, -6, -27, 60, 56, -8, -127, 37, -5,
+    17, 51, 22, -61, -64, 109, 10, -1, -37, -10, -8, -41, -31, -12, 81, 68,
+    68, 13, 6, 40, 45, 94, 54, 67, -34, -121, 14, -8, -14, -52, -11, 6,
+    60, -3, 0, 75, -117, 11, -108, -83, -9, 42, 37, -86, -55, 11, 17, -124,
+    -106, -127, 43, 74, -17, -6, -57, 45, 42, -47, -19, 27, 22, 22, 89, -94,
+    -66, 64, 44, -5, 55, 55, 3, -72, -58, -59, -12, 34, 58, -100, 7, 54,
+    106, 48, 75, -56, 93, -66, -22, -107, -51, 33, -77, -28, -107, 36, -8, 35,
+    95, 110, 92, -14, -47, -67, -34, 25, 53, 75, -61, -45, 15, -28, 103, -6,
+    -104, 76, 54, -101, -77, 74, 47, -23, -40, 38, -63, 37, 15, 79, 30, 8,
+    35, -34, -66, -109, 67, 100, 117, -24, 26, -91, -13, -87, -6, -19, 55, 46,
+    98, 60, -87, -81, -102, -36, 54, 104, 11, -29, 67, 63, 49, -21, -6, 107,
+    -70, 127, 37, -55, -1, 34, 102, -26, 67, 69, -72, -62, 99, -93, 113, 88,
+    23, -47, -3, 90, -51, -28, -78, -24, -86, 5, -77, -90, 95, -77, 76, 116,
+    -88, 13, -124, 105, -53, -35, -23, 52, -75, -26, 91, -62, 40, -20, -17, 23,
+    -36, -70, 104, -68, -87, 30, -13, -41, 45, 112, 37, -11, -64, -71, 105, -127,
+    41, 77, -25, -109, 19, -8, -23, 64, 119, 15, 12, 20, -114, -88, -18, -38,
+    100, 66, -14, -88, 29, 42, -4, -91, -35, -108, -107, 49, -69, 92, 91, 17,
+    -116, 35, 22, 93, -46, -118, -10, -29, -56, -24, 127, -78, -66, -63, 39, 51,
+    32, -8, 61, 79, -90, -34, 59, 48, 3, 56, 54, -87, 106, 39, -58, -118,
+    -33, -97, 81, 0, -44, -87, -87, 69, -105, 74, 110, -15, -78, 40, -1, 35,
+    29, -104, -38, -11, 45, -9, -55, -31, 70, 91, -82, -66, 60, -7, -82, 37,
+    94, -13, -24, 97, -38, 14, 33, 96, 81, -69, 16, -69, 28, -19, -70, 90,
+    -78, 98, 59, -16, 31, -60, -77, 69, 66, 50, 60, 24, 69, -25, 110, -47,
+    72, 9, 74, -107, -8, -43, 5, 115, 86, -65, -25, 120, -114, -76, -26, 91,
+    9, 64, -2, -91, 11, -15, 33, 64, 82, -64, 76, 90, 13, 127, 63, -23,
+    60, -99, 44, -115, 74, -92, -8, 24, 11, 100, -108, -21, -78, -19, 54, -51,
+    -92, -98, -28, 67, 5, -103, -96, -105, 47, -46, 79, -37, -12, 104, -26, -19,
+    99, 99, -85, -94, 48, -21, -85, -127, 61, -38, -26, -18, 71, -60, 88, -37,
+    -107, -1, 102, 37, 58, -33, -105, -48, 82, 53, 29, 41, -24, -109, 56, -96,
+    96, -29, 106, 37, -83, 10, 41, -2, -90, -7, 108, -34, 29, -85, 5, 47,
+    -84, 63, 0, -68, -23, 26, -89, 62, -38, -30, 49, 12, -20, -107, -110, 64,
+    75, 4, -29, -44, -89, -61, 68, 98, -68, 73, 26, 30, -8, 42, 11, 59,
+    -35, 74, 87, 4, 46, 18, 40, 84, -109, 54, -101, -97, 36, -52, -44, 0,
+    -50, 16, -73, 80, 36, 24, -92, -74, 94, -25, 19, 126, -70, 21, -56, -49,
+    115, 5, 4, -110, -12, 18, -42, 8, -59, 3, 81, 35, 24, 100, 102, 69,
+    79, 31, 53, -45, -101, -5, -127, 75, -84, -110, 65, -4, 47, -88, -106, 55,
+    39, -109, 57, -31, -54, -25, 87, -5, 19, -78, 9, -19, 15, 19, 37, 67,
+    64, 73, 90, -86, 119, -35, -127, 17, 76, 122, -16, -10, 88, -73, 100, 32,
+    -100, 37, -62, -61, -36, 56, -106, 101, -112, 11, 74, -20, 68, 81, -104, -50,
+    -31, 41, 0, 43, -36, 56, 38, 74, 44, 76, 121, -16, -63, -57, -28, -105,
+    110, 78, 11, 32, -114, -6, -38, -11, -16, 76, 84, -96, -102, -118, 13, -105,
+    -95, 63, 84, -13, 12, -80, -56, 68, 75, 2, -9, -65, 8, -25, -36, 84,
+    82, 73, 56, 108, 5, 97, -44, -101, 120, -7, -1, -38, -106, 51, 78, 33,
+    -79, -68, 12, -64, -21, 66, 73, -92, 49, 107, 61, -49, 109, -46, -79, 42,
+    -105, 109, -46, -98, 83, 82, 83, 8, -107, -79, 106, 20, 75, -44, 74, 75,
+    -48, -18, -19, -47, -7, 45, -33, 22, -77, -93, 81, -118, -40, -127, 32, -94,
+    -99, -86, 84, 32, -92, -40, -68, 36, 105, 45, 78, 43, -21, 92, 21, 56,
+    -84, -51, 65, -79, 124, -59, -26, -35, -69, -13, 84, -86, 12, -14, 8, -18,
+    -30, 27, -81, 11, 57, 116, -2, 54, 85, -27, 71, -97, 6, -48, 84, 31,
+    34, 93, -64, -17, -35, 36, -27, 39, 70, -124, 54, 63, 77, -7, 103, -20,
+    71, 29, -80, 51, 24, 12, -67, -41, -54, 11, 88, 104, -88, 3, 79, -62,
+    -108, -50, 92, -19, -112, 33, -21, 63, -36, 35, 60, 104, 62, -59, 26, 0,
+    -56, 96, -112, -110, 46, -97, -67, -13, 9, 102, -21, 61, -2, -39, -108, 54,
+    -45, -58, -1, -89, -30, 79, -101, -39, 25, -127, 70, 116, -14, 75, -64, 16,
+    -117, -78, 38, 43, -89, -71, 22, 4, 13, -105, 36, -22, 80, -95, 70, -67,
+    16, -54, 45, 84, 44, 47, -42, 56, -80, -78, -66, -21, 93, -6, -44, 89,
+    52, -44, 83, -112, 2, -102, -79, 1, 31, 96, -24, 86, -57, -86, 74, 38,
+    15, 46, 91, 90, -41, 13, 64, 60, -120, 81, 27, 95, 87, -90, 86, 28,
+    -2, -10, 55, -6, 0, 49, 44, -20, -8, -59, -115, 69, 85, -29, -93, -25,
+    46, -3, -39, -63, -105, 40, -79, 1, -127, 12, -3, 52, -39, -66, -80, 0,
+    62, -66, -43, 95, -76, 76, -41, 33, -60, 24, 9, 25, -4, -100, 71, 95,
+    24, -117, 82, -43, 14, -30, 79, 83, 55, 100, -104, -79, -50, 55, -74, -113,
+    71, -59, -82, 90, 9, -70, 91, -69, -14, -23, -81, -60, -11, -90, -38, -120,
+    43, 114, -102, 90, -58, -93, 79, 108, 21, 57, 15, -31, -10, 23, 99, -71,
+    -51, 104, -42, -75, 52, -50, 25, 48, 74, 96, 63, -59, -32, -65, -118, 38,
+    -107, 87, -77, -26, -121, 15, -2, 105, 48, -120, -76, 68, 29, -6, -82, 92,
+    20, 16, 13, -19, 89, -127, 18, -96, -16, 112, -69, 14, 97, 10, -10, 126,
+    -53, -109, 116, -1, 4, 125, -99, 126, 23, 38, -97, 26, -39, 13, -117, 19,
+    -12, -47, 116, -74, 109, 21, -34, -50, -65, -47, 44, -91, -77, -4, 61, 32,
+    43, 45, -105, -59, 85, -37, -102, -59, 127, 103, -7, 22, 50, -108, -48, -91,
+    -35, 61, 107, 85, -102, 79, 104, 20, -97, -110, 25, -73, 2, -54, -92, 67,
+    -101, 56, -62, -103, 117, 108, 12, -4, 39, -33, -19, 20, 15, 55, -56, -5,
+    13, 108, -50, 15, 51, 10, -82, 34, 71, 63, -77, 63, 40, -100, -124, 96,
+    -10, -72, -74, -60, 115, -19, 95, 4, -40, -71, -110, 76, 69, -22, -58, 51,
+    27, 15, 19, -94, -91, -35, -10, -84, 95, -24, -61, -63, 55, -78, 59, -96,
+    -1, 7, 38, -1, -84, -127, -94, -26, -91, -35, 37, 76, 113, 48, -105, 12,
+    -92, 43, -80, 38, 76, -13, 9, 88, -50, 5, -23, 52, -68, -2, 65, -104,
+    -41, -85, 68, -64, -65, -45, 83, 71, 38, 13, 81, 1, -53, 2, -74, -83,
+    -22, 32, -113, -30, -66, 103, 26, -24, 103, -60, -115, -57, 57, 45, -60, 102,
+    -92, -31, -69, 68, 6, -59, 96, -44, 9, 100, 67, -54, -31, -37, -46, 79,
+    67, -48, -45, -9, -108, 12, 74, -58, 90, 118, 87, -9, 67, 81, 59, 83,
+    1, -15, 106, -38, 31, 5, -83, 59, -104, -93, 33, 64, 76, -4, 37, -65,
+    99, 76, -110, 118, 123, -102, 77, 74, 95, 114, 62, -96, 2, 59, -5, 14,
+    -30, -41, -122, 112, 48, 63, -68, 40, 41, -25, -80, -73, 110, -13, -49, 83,
+    -36, 49, 13, -89, -55, -22, 89, 0, 47, -77, 112, -44, -127, 81, 15, -52,
+    -35, 34, 49, -45, -2, 33, -17, 59, -99, -5, 75, 24, -20, -32, 33, 48,
+    -22, -51, -9, -83, 59, -48, 27, -45, -50, -92, 78, -68, 58, 59, 103, 65,
+    -61, 24, 4, 19, -63, 21, -60, 116, 16, 100, -76, 36, 81, -15, 44, 22,
+    -23, 105, 44, 44, -38, -106, 57, -9, 3, 67, 94, -20, -40, 90, 78, 8,
+    -63, -88, 112, 74, -76, -11, -93, 102, 74, -114, -10, 127, -83, -22, 107, 86,
+    86, 115, 25, -61, -50, 65, -52, -70, -50, 6, 76, -5, 41, 96, -75, 45,
+    -51, -100, 14, 89, 21, 72, -12, -66, -36, 80, -45, 24, -48, -106, -72, -82,
+    -35, 65, -88, 5, 82, 33, 9, -121, -69, 108, -74, 91, 52, -67, 86, 91,
+    69, 40, -25, -24, 12, -11, 55, 94, 81, 83, -90, 9, 66, 49, 61, 93,
+    -73, -127, 1, -113, -118, 21, -106, 20, 20, 49, 95, -57, 88, -26, -125, -52,
+    86, -35, -44, 27, 7, 98, 63, -72, 37, 127, 50, -21, -77, 8, 13, 28,
+    111, -80, -118, -49, 34, -16, -102, -98, -18, 99, -98, 52, -30, 29, 126, -68,
+    -27, -28, -60, 100, -127, -35, -75, -73, 60, 102, -104, -68, 51, 114, 94, 93,
+    -21, 34, -10, -51, 65, -8, -89, -59, 108, 45, -72, 35, 110, 63, 2, -47,
+    -93, 10, -46, 86, -80, -69, -91, 37, -76, 93, 119, 61, 127, -21, 71, -113,
+    -49, 94, -106, 120, 11, -71, 100, -2, -10, -11, 20, -56, -109, -36, 57, -81,
+    95, -25, 125, -84, 29, 107, -24, 52, -105, 51, -6, 75, 125, -95, 61, -73,
+    88, 22, -68, 122, 94, -5, 35, -101, -66, 72, -58, -45, 21, 69, -1, 96,
+    79, -36, -11, 57, -104, -84, -27, 106, -21, 95, 4, 70, -105, -14, 23, 74,
+    -15, -82, -96, -53, -6, -96, -8, 42, -26, -11, -48, -60, -58, -42, 49, -103,
+    39, -71, -68, -37, -40, 16, 10, -63, -48, -126, -46, 66, -13, -47, 41, -25,
+    91, 55, 112, 74, 111, 49, 25, -127, -72, -100, -91, 8, -61, 52, 66, -91,
+    -41, -102, -97, -37, 111, 66, 85, -36, -113, -36, -111, -35, 48, 45, -7, -42,
+    51, -12, -105, -80, -47, -83, 40, -68, 59, 74, 86, 93, 54, -45, 97, -117,
+    -74, 4, 127, -37, -36, -15, 121, -70, -68, 110, -33, 75, 51, -100, 61, -118,
+    115, 21, -51, 111, -110, -85, -60, 28, -6, 110, -25, 36, 95, 4, -7, 41,
+    -49, 100, -35, -48, 35, -38, -6, 2, 88, 37, 113, -88, -2, 100, -36, 47,
+    80, 11, 22, -90, 30, -92, 60, 112, 50, 7, 50, -35, 48, 125, 105, 35,
+    32, 103, -22, -11, -27, 46, 115, 113, -28, -113, 72, 45, -64, -94, -111, -115,
+    36, 96, 61, 41, -117, -97, -34, -24, -11, -113, -74, -85, 54, 109, 107, 42,
+    35, 62, -15, -16, 94, -64, -103, -47, 43, 24, -60, 116, -2, 101, 37, 9,
+    19, -38, 95, 102, 22, -88, 30, -8, 76, -101, 58, 79, -52, 99, -16, -96,
+    -108, -44, -8, 47, -90, 93, 52, -20, 52, 42, 31, 58, -94, -18, 59, 122,
+    55, -7, -62, -86, -81, 33, -118, 97, 0, 48, -85, -16, -96, -21, -109, 108,
+    -26, -120, 11, 6, 54, -62, 51, 53, 25, -25, -9, 82, -77, 11, -44, 127,
+    83, 56, 20, -48, -53, 29, 69, 106, 53, -90, -70, 86, 63, 102, -115, -51,
+    -63, -51, -25, -16, 5, -88, -6, -75, 22, -62, -72, -31, -86, -49, 33, -78,
+    -71, -101, 100, 121, 94, -88, -107, 48, 47, -4, -37, 55, -5, -34, 15, -47,
+    37, 0, -87, 1, 49, 5, 89, -29, -19, 54, -91, -100, 63, 95, -9, -94,
+    104, -22, 54, -78, -101, 66, 7, 82, -30, 70, -91, -53, 78, -88, 36, -31,
+    37, 1, 36, 12, 63, -41, -46, -25, -28, -91, -17, 79, -99, 127, -47, 70,
+    -16, 101, 96, -15, 100, 43, 93, -3, 67, 123, 116, 21, -28, -64, 62, 68,
+    85, 117, -24, -17, 113, -30, 81, -98, 88, 52, -20, -93, 116, 92, -8, 59,
+    76, -72, -23, 107, 93, 7, -5, 17, -111, -96, 90, -18, -42, 18, 42, -70,
+    81, 127, -95, 77, 79, 96, 11, 114, -38, -97, 15, 51, 3, 47, 43, -49,
+    -2, 50, -63, 125, 114, -75, -49, 108, -9, 15, -81, -51, -106, 44, -46, -25,
+    -77, -13, -117, -77, 66, -9, 107, 23, -13, 74, 10, -12, -40, -24, 56, 75,
+    -26, 64, 23, -14, -78, -63, -16, 26, 81, 18, 23, 16, -54, 118, 65, -72,
+    14, 87, 56, -76, -79, -22, 80, -28, -80, 72, 35, 33, 117, 39, -111, 102,
+    81, -58, -28, 110, 19, 36, 85, -106, 10, -103, 18, 63, 33, -73, 100, 4,
+    -110, 18, 8, 35, -115, 41, 122, 84, -61, -31, -107, -64, 37, -74, 41, -18,
+    -32, -93, -88, 76, 77, -105, -31, -40, 119, 12, -15, -59, 110, 127, -78, 115,
+    -15, 53, -81, 10, -90, -43, -85, -67, 56, -9, 9, -69, -20, 115, 106, -88,
+    -70, 107, -7, -104, 92, 12, -82, 102, -14, 84, 33, -99, 120, -31, -56, -72,
+    -31, -76, 58, -41, 98, -54, 22, -55, -41, 15, 85, 68, -79, -92, -50, 23,
+    -11, -88, -31, 63, 84, 73, -19, 55, -19, 26, -80, 79, -26, -69, 75, -13,
+    109, 88, 54, 66, 85, -34, 24, -41, 34, -34, 55, 79, 56, -99, 92, 52,
+    -85, -33, 43, -68, -112, -21, 17, -6, -10, -90, 32, 55, 73, -94, 20, 92,
+    11, 98, 106, 20, -64, 127, -39, -90, -52, -60, -106, 11, 21, -92, -40, -66,
+    -41, -38, -56, -57, -17, -37, -14, -33, -14, 57, -93, 67, -87, -64, 20, -52,
+};
+
+static const int32_t _L4_bias[64] = {
+    -104320, 46208, 11648, -102784, -41472, -50304, -57728, 87040,
+    140416, 104960, 21504, -40320, 49664, 196224, 171136, -90368,
+    7552, -45696, 44544, 179328, 80128, 134656, -23424, -47744,
+    36864, -237184, 62080, -51584, 95488, 37120, 13440, 120832,
+    -23808, 92928, 77184, 91392, 207616, -57344, 103168, -68224,
+    -35200, 97920, -68736, 106752, -117504, 28544, 75392, -10496,
+    -45696, 19968, -35456, -16256, -129664, 119424, 122496, -2816,
+    75648, -143744, 113280, 67328, 13568, 138240, 16384, -41728,
+};
+
+static const int32_t _L4_multiplier[64] = {
+    1948231965, 1151031798, 2095407245, 1112259724, 1084914243, 2106960447, 2055600611, 1089162423,
+    1118025382, 2016537478, 1997784082, 1157405040, 2145601206, 2119984491, 1965045306, 1109697767,
+    2108631738, 1140624119, 2091613858, 2063122137, 2099489442, 1087167551, 1250537338, 1131745372,
+    1980644501, 2028570120, 1903912375, 1152791859, 2081400185, 1197763010, 2087729655, 1083976430,
+    1162562705, 2087300532, 2097262213, 1272139967, 2057468260, 1976279835, 2060259814, 1174023148,
+    1118703737, 1088313176, 2042563681, 1166103691, 1115048107, 1102601273, 2081314892, 2126615044,
+    1113499335, 1093361105, 1994935053, 2010687857, 1092301284, 2101382658, 1122941691, 2002459442,
+    1976192497, 1113376714, 1092521880, 1106879010, 1090838419, 1078838196, 2138402852, 1112230066,
+};
+
+static const int8_t _L4_shift[64] = {
+    -10, -9, -10, -9, -9, -10, -10, -9, -9, -10, -10, -9, -10, -10, -10, -9,
+    -10, -9, -10, -10, -10, -9, -9, -9, -10, -10, -10, -9, -10, -9, -10, -9,
+    -9, -10, -10, -9, -10, -10, -10, -9, -9, -9, -10, -9, -9, -9, -10, -10,
+    -9, -9, -10, -10, -9, -10, -9, -10, -10, -9, -9, -9, -9, -9, -10, -9,
+};
+
+// Layer 5: QUANT_LAYER_CONV, [12, 64] to [12, 64]
+static const int8_t _L5_weights[12288] = {
+    104, 53, 40, 16, 28, -122, -95, -107, 4, 31, 105, -90, 56, -48, -44, 115,
+    101, -108, 21, -35, 119, 55, -85, 32, -74, 85, -90, 38, 32, -30, -33, 23,
+    -3, 43, 19, 20, -61, -43, 100, 119, 37, -94, -10, -34, 107, -116, -45, 25,
+    115, -75, -107, 70, -71, -93, -8, 65, -67, -111, -57, 60, 78, -92, 102, -18,
+    -32, 57, -101, -107, -47, -48, 123, -82, -78, 109, 19, -66, -21, -1, -114, -112,
+    86, 101, 66, 29, -77, -68, -89, -45, -62, -71, -3, -60, -38, -39, 118, -27,
+    -93, 81, 37, -63, 32, 127, 58, 87, -30, -77, -37, -72, 93, 92, -33, -48,
+    -25, -28, 101, -35, 88, -115, -120, 12, -113, 41, 72, -78, -50, -28, -45, -21,
+    98, -100, -27, 58, -61, -27, -46, 6, 51, -67, -87, 73, -108, -117, -91, 124,
+    97, -83, 52, -94, 76, -15, 33, 25, -41, -59, 54, -51, -89, 107, 106, 19,
+    -77, 78, -24, -51, 40, -96, 43, -61, -43, -20, -22, -106, 122, 21, -34, 36,
+    -2, -121, -9, 85, 105, -26, -24, -89, 5, -110, -33, 21, 76, -82, 16, -38,
+    101, 87, 71, 91, 98, -4, -11, 45, 107, -87, -15, -64, 29, 12, -85, -45,
+    83, 2, 61, -73, 24, 60, 26, -61, 45, -121, 13, 48, 29, 18, -121, -112,
+    -112, -10, -33, 102, 4, 110, -79, -113, 118, -110, 54, 108, 12, -82, -44, 67,
+    78, 73, 93, -73, 52, 46, -88, 51, -4, 30, -62, 6, 72, -98, 43, 80,
+    -88, 59, -28, -62, 94, -36, 17, -42, -3, -31, -40, -73, -50, 13, 31, -123,
+    83, -35, -86, -22, -60, -102, 107, 36, 4, 20, 16, 88, -73, -4, -12, -67,
+    69, -113, -58, -41, 57, -5, 90, -78, -100, 24, 36, -69, 2, -18, -6, 62,
+    -36, -86, -82, -5, 13, -20, 87, 100, -73, 102, -115, 1, 56, 44, -27, -36,
+    -87, -47, 4, -110, -102, 60, 121, 119, -15, 67, -53, -123, 127, 41, -112, 89,
+    -27, 101, 26, 15, -17, -84, -52, -30, -1, -24, 49, 27, 87, 15, -107, 42,
+    84, 75, -40, 98, 29, -59, -82, 82, -73, -10, -83, -95, -6, -121, 57, 114,
+    69, -60, -99, -106, -68, -75, -99, -97, 85, 117, -18, 14, -16, 67, -89, -52,
+    -70, -49, -43, 10, -40, 45, 35, -67, -23, 73, 36, 42, -9, -10, -77, -26,
+    -113, 98, -16, 66, 50, -29, -80, -104, 9, 42, 55, -63, 79, 41, -15, -36,
+    -7, 30, 46, -73, -22, -92, 4, -92, -86, 50, -42, 43, -26, -14, -48, 70,
+    55, -57, 0, -69, 63, -85, 0, -35, -69, -26, -93, 20, 31, 52, 57, -11,
+    -57, -6, 73, 68, -43, 59, -66, 96, -4, -55, -9, -36, 49, -74, -62, 58,
+    26, 30, 0, -34, -4, 40, 94, 19, -14, -59, -25, -88, -40, -10, -21, 46,
+    -78, -82, -15, -77, -78, 79, 89, -127, 35, 52, 108, 65, -6, 74, -4, -95,
+    -46, 17, -18, -99, -60, -34, -7, -49, -67, -41, 3, -32, -88, -63, 40, 31,
+    58, 40, 96, -112, 0, 5, 42, 85, -74, -79, -7, 24, 39, 4, 36, 7,
+    46, 14, -79, -69, -28, 84, -54, -20, -64, 45, 99, 31, -73, -32, 47, 55,
+    63, 70, 12, 112, -76, 47, 75, -109, -82, 17, 18, 74, -101, 23, -12, -44,
+    19, -100, 24, 53, 77, -29, 28, 39, 17, -31, -36, 62, 84, 12, -55, 6,
+    -22, -111, -97, -9, 91, 91, 77, 44, 21, -62, -84, -125, 72, 44, 92, 18,
+    -86, 98, 38, 66, 2, 11, -15, 37, -97, 86, 33, -123, -1, -100, 68, 87,
+    -78, 94, -59, 40, 85, 104, 61, 87, 91, -50, 48, 73, -101, -46, -4, -21,
+    -17, -15, 69, -51, 92, 121, -89, -65, -7, 2, -105, 54, -15, -111, -93, -18,
+    76, -46, -82, 29, 120, 2, 91, 52, -95, 55, 42, 104, -89, -126, -102, -44,
+    -64, 71, -108, -111, -106, 95, -77, 109, -110, -96, 69, -23, 10, -79, 45, -101,
+    36, -124, -21, -85, -102, -83, 79, -11, 81, 51, -34, -83, 116, 45, -95, -32,
+    3, 91, 30, 77, -59, -30, 48, 93, 41, 78, -85, 119, -54, -28, 107, -20,
+    -92, 98, 102, 15, -14, 59, -31, -114, 79, 100, 53, 103, 72, -45, 61, -13,
+    72, 86, 103, -120, -81, -126, -77, 127, 79, 5, -71, -106, 70, -127, 5, -5,
+    -72, 84, -32, -40, -39, -43, -19, -105, -70, 48, 43, 111, 52, -4, 13, 26,
+    89, -58, -119, 86, -1, 107, -45, -109, -126, -77, -42, 8, 80, 87, -54, 42,
+    -116, 104, -6, -40, -52, -26, -38, 81, -39, -68, 78, -125, 99, 25, -65, -56,
+    9, -5, -56, -20, -95, -68, 52, 110, 104, -87, -23, 27, 88, -70, -51, 86,
+    -71, 81, 107, -80, -46, -8, 104, -100, 55, 96, 32, -10, 101, 114, 109, 88,
+    78, 120, 86, -49, -117, -23, 3, 30, -56, 54, -89, 6, 85, -108, 69, 20,
+    -12, -44, 76, -26, 87, 72, -50, 108, 66, -5, 28, -29, -3, 8, -1, 48,
+    24, -28, 5, -87, 27, -39, -84, -95, -15, -10, 1, -18, 72, 76, 7, 77,
+    -94, -11, 9, 101, -113, -71, 4, -30, 15, -108, -99, 93, -102, -98, -68, -62,
+    100, 60, -84, 76, 26, 50, 29, 88, 78, 91, -37, -35, -56, 58, 13, -38,
+    -93, -72, -97, 32, -26, 44, -16, 31, -41, -78, -13, -80, -65, 110, -118, 69,
+    -127, -1, -70, 38, 22, 50, 94, 13, -2, -105, 27, -7, 39, -56, 11, 53,
+    -18, -105, -77, 42, -91, -31, 12, 75, -30, 25, -38, 89, 97, 60, 67, 80,
+    -8, 65, -19, -106, -94, -46, 55, 33, 99, 68, -68, 84, 33, -42, 35, 8,
+    -56, -76, 66, 73, 104, -74, 46, -58, -61, 13, 15, 92, -78, 23, 25, -58,
+    36, -84, -51, -97, -62, -49, -36, -28, -36, 102, 63, 99, 56, 50, 99, 96,
+    -68, -15, 112, 26, -59, 79, -55, 88, -73, 98, 39, -86, 81, -17, 102, -101,
+    -59, 95, 52, 8, -76, -69, 71, -102, 45, 73, -81, -63, -44, -97, 6, -20,
+    70, 63, 79, -98, -50, 25, 112, -73, -39, -59, 66, -82, -21, -72, 78, 106,
+    -29, 107, -63, -21, 13, 23, 127, 2, 28, 32, -75, 115, 28, -59, 52, -117,
+    -5, -73, -4, 34, -108, 70, 110, 68, -33, -30, 70, -92, 75, -77, 8, 91,
+    -66, -54, -76, -16, 23, -52, -97, -14, -90, 83, 46, -56, 71, 58, -2, 86,
+    26, 88, 70, 93, 34, 45, 45, 71, -100, 61, 82, 24, 81, -8, 6, -23,
+    -47, 36, -45, -42, 61, 62, 17, -16, 58, 107, 114, -65, -116, 80, -94, 41,
+    18, 3, -67, -35, 93, 0, -92, 121, -99, 22, 111, -71, 115, 14, 36, 75,
+    -41, 56, -80, 79, 113, 9, 97, 83, -105, -104, -43, 43, 118, 32, -46, 99,
+    78, 52, -38, -69, -118, -11, -13, -72, 7, 117, 25, 107, 120, 29, -77, 1,
+    122, 7, -126, -99, 81, -14, -43, 95, 28, 83, -7, -85, -28, -1, -107, 103,
+    60, -31, -49, 39, -95, -4, -115, 66, -86, 105, -118, 19, 15, 111, -106, -12,
+    36, -26, 28, -41, -36, 106, -104, 81, -67, 111, 54, 115, -70, 104, 65, -82,
+    -32, 94, -82, 103, -33, 66, -11, 116, -94, 48, 114, -88, -51, 68, 122, -95,
+    11, -5, -30, -30, 84, 69, -74, -72, -56, 43, -94, 49, 109, -7, -93, 22,
+    -113, -9, 101, 71, 117, -45, -45, -43, 91, 83, -16, 86, -32, 25, 47, 29,
+    -12, 81, 56, -38, -37, 63, -20, -9, -102, -8, 19, 11, 111, -36, 22, -68,
+    -82, -116, 58, 3, 63, -7, -99, -89, -17, -74, -74, 5, 16, -10, 65, 28,
+    -52, -47, -89, -56, -9, -38, -127, -112, 79, 28, 8, 13, -9, -34, 81, 90,
+    89, 16, 47, 79, 86, 93, 101, 15, 57, 91, 103, 106, -31, -3, -23, 107,
+    -68, 86, -107, -14, -25, 103, -6, 72, -23, -34, 92, 12, -5, 25, -110, -95,
+    -54, 81, -46, -127, 11, 0, -11, 7, 77, -81, -14, -9, -44, 62, 30, 31,
+    34, -46, -25, -81, 60, -59, 104, -69, 36, -101, -8, 75, 20, -89, -41, -10,
+    23, 64, -34, 12, 83, 80, 45, 31, 43, 0, 0, -56, 87, -66, 88, 8,
+    -10, -96, 76, 12, -47, 8, 2, -101, -38, -35, -65, -14, -16, -24, -18, -53,
+    78, -9, -32, -46, 97, 82, -62, 81, -108, -24, 52, 78, -3, -18, -86, 13,
+    24, 25, -23, -14, -86, -45, 121, 78, 64, -77, -21, 16, 36, 81, 50, -77,
+    -66, -34, -81, 43, -65, 34, -46, 25, -80, -65, 122, -6, 75, -67, -72, 56,
+    67, 84, -65, 71, 80, 27, 50, 1, -41, 45, 62, -35, -48, -8, 29, 1,
+    -16, 19, 43, 66, 59, -81, -54, 82, -23, -6, -45, 22, 17, 85, -22, -52,
+    -21, -59, 66, 110, 87, -50, -96, -89, 82, -72, 85, 87, -58, 6, 85, 70,
+    -2, -40, 4, -30, -81, -52, 45, -78, -86, 12, -32, 20, -82, 93, -31, 80,
+    96, -72, -5, 22, -87, 34, 59, 22, -33, 45, 102, 6, -56, 98, 49, 49,
+    -28, 22, -65, 58, -46, 51, 39, -23, -95, -43, -73, 76, 14, 44, -106, -71,
+    -110, -55, -12, -77, -1, 92, -82, -5, -97, -82, -24, 43, -4, 92, 57, -78,
+    -84, -81, -15, 16, 71, -19, 46, -84, -8, 30, 34, 83, 53, -45, -39, 57,
+    35, 66, -46, -14, -9, -77, -1, -8, 4, -8, -31, 81, 33, 96, 28, -40,
+    -14, -18, 68, 10, 101, 61, 25, 22, 67, -21, 78, -43, 9, 65, -7, 32,
+    26, -73, 65, -85, -50, -51, -83, -42, 101, -2, 32, 10, -108, -100, 58, 106,
+    -43, -83, 77, 84, -22, 62, -59, -97, -30, -59, -38, 69, -98, -83, 69, 19,
+    76, 51, -55, 14, 90, -20, -56, 80, -26, 19, 59, -13, 119, -86, 70, -96,
+    -67, 52, 4, 72, -26, -10, -127, -2, -81, -79, 20, 46, -67, -16, 81, -89,
+    -21, 66, 102, 1, -47, -65, 77, 29, 64, -47, 60, -48, 67, -70, 23, 8,
+    -102, -86, 67, 34, -94, 71, -83, -72, -107, -1, 11, 11, -74, 72, 51, 41,
+    -91, 56, 82, -32, 53, 81, -31, 32, -80, 103, 11, 24, 85, -67, -48, 23,
+    114, -120, 23, -90, -67, 43, -49, -103, 24, 1, 93, -38, 48, -79, -39, -82,
+    48, -104, 11, -14, -21, 103, 53, -118, 79, -80, -20, 66, 21, -27, -86, -8,
+    59, -51, -42, 12, 125, 19, 102, 23, -74, -97, -22, -13, 40, 43, -43, -100,
+    38, 54, -60, 24, -33, -12, -29, 91, -63, -75, -66, 22, 59, -20, -99, 82,
+    16, 41, 22, 107, -66, 23, 52, 26, 103, 17, -60, 58, 120, 79, 28, 49,
+    105, 73, -106, -106, -101, 55, -82, -88, -7, -56, 91, -7, 36, -15, -84, 82,
+    87, -1, 43, 54, 101, -45, 97, 2, -72, -21, -11, -5, -28, -7, -90, -8,
+    53, -71, -19, 56, -102, -36, 36, -99, 52, 71, 108, -18, 4, -39, 23, -100,
+    0, 15, -54, -32, -38, 93, 123, 60, -40, 24, 45, 16, -112, 86, -49, 53,
+    -31, -23, -41, 66, -78, 109, -76, -45, 17, 109, -40, -16, 17, 53, -24, -36,
+    43, -41, 107, 69, 107, 36, -60, -98, -50, -40, -64, 79, -82, 18, 19, -84,
+    65, -51, -8, 109, 52, -14, -69, 72, 67, -127, 86, -89, 69, 74, -109, -76,
+    85, 20, -66, -54, -60, 22, -43, 59, 35, 93, 39, -80, -14, -4, -53, -21,
+    -57, -26, -68, -82, 7, 38, -43, -41, 30, 35, -81, 64, -83, 22, 8, 53,
+    -53, 39, -33, 47, 8, 93, -1, -55, -79, 52, -82, -25, 0, 84, -10, 92,
+    -66, 30, -4, -19, -11, 48, -24, 61, 50, -4, -73, 83, 52, 54, 14, 50,
+    43, -101, -69, 81, -74, -35, -26, -63, -67, 43, -77, -67, -56, 71, -26, 17,
+    -10, 50, -48, -42, -35, 9, -48, 47, 55, -15, -51, -70, 86, -39, 15, -72,
+    -28, -5, 47, -64, -96, -4, -8, 26, 64, -69, -28, -58, -33, 113, -67, 45,
+    77, -71, 25, 66, -40, -81, 80, 60, -20, -8, 98, -16, -72, -83, -43, -47,
+    50, -76, -53, 123, 18, 73, -84, 14, -64, -43, -24, -12, 5, -34, -15, 80,
+    41, 25, -127, 27, -55, -71, -67, -64, 27, 19, -10, -55, -30, -2, 13, -13,
+    -46, -87, 31, 68, 33, -15, 5, 80, 54, -69, -53, 75, 15, 119, -98, -77,
+    12, 5, -46, 16, -64, -66, 13, -65, -82, -12, -55, -4, -1, 55, -52, 39,
+    -1, 83, 30, -36, 101, -86, 5, -38, -41, -12, 62, -104, 43, 19, -22, -39,
+    89, -102, 90, -75, -37, 99, -56, 107, -81, 6, 112, 8, -94, 50, -33, -70,
+    -73, 22, -50, -31, -58, -35, -69, 20, 57, -25, 71, 24, 74, 74, 38, -37,
+    -54, 57, -103, -64, -79, -61, -116, -61, 47, -14, 6, 9, -35, -16, 73, 101,
+    -57, -61, -54, 25, -89, -56, 108, -60, -54, 37, 80, -7, 73, 16, 16, 28,
+    -3, 83, -75, -62, 97, -101, -33, 4, -27, 71, 43, 103, 91, -59, -58, 98,
+    -45, 93, 8, 20, -61, 75, 18, -67, 75, -116, 42, -127, 24, 72, 60, 47,
+    -57, 64, -112, -40, 61, 100, -116, -26, -106, 54, 56, -75, 65, 27, -97, -47,
+    53, -86, -79, 28, -98, 35, 8, -66, 77, 60, 32, -14, -110, 87, -50, 88,
+    -109, 46, 2, -76, 124, -102, 58, 15, 28, 124, 75, 87, -113, 79, 42, 95,
+    83, -2, -18, -80, -49, 115, 31, -88, 86, 42, -66, -34, -44, 69, -71, 7,
+    71, -7, -67, 61, 52, 85, -41, 65, -25, -12, 10, 59, 22, -81, -95, 28,
+    -61, -22, 17, 0, -48, -87, 64, 82, 57, -37, 100, -115, 35, -25, -94, 59,
+    -55, -102, 48, 28, 113, -96, -19, 90, 6, 49, -21, -49, 0, 38, -98, -31,
+    39, -85, -39, 99, 83, -92, -70, 7, 36, 70, -27, 59, 6, -102, -81, -22,
+    -70, -12, 85, 6, -68, 43, 98, -84, 50, -85, 69, -23, -103, -61, 99, 6,
+    -88, 79, -80, 82, 4, 92, -97, -104, -53, -116, 5, 56, -12, -76, -95, 6,
+    85, 104, -107, 89, 11, 27, 31, -106, 99, 100, -7, -92, -44, -33, 40, 55,
+    -52, 96, 38, -102, 65, -88, -64, -39, 120, 125, -21, -99, 105, -99, -92, -31,
+    4, -14, 110, -81, -25, -87, -36, -115, -59, 37, -8, 92, -10, -49, 91, -97,
+    76, -126, 24, 83, -99, -31, 36, 54, 101, 91, 54, 10, -91, 69, 20, -82,
+    -9, -69, -66, 107, 113, 38, -127, -35, -39, -23, -83, 75, -16, 21, -80, -94,
+    -50, 58, -63, -25, 82, -102, 113, 63, 39, -60, 111, -48, -64, 17, -106, 82,
+    -20, -118, 28, 27, 102, 58, -66, 102, 87, -1, 52, 52, -13, 49, 97, 69,
+    46, 32, -53, 82, -73, -63, 28, 5, 91, -47, 88, 79, -63, -19, 22, -101,
+    -7, 101, 3, -30, 104, 68, -36, -71, 53, 96, 2, -41, 54, 56, 11, 21,
+    -61, 66, 93, 20, 58, -71, -1, 58, -43, -83, -90, 40, -19, 37, 65, 12,
+    76, -45, 98, -46, 36, -74, -73, -14, 61, 105, 109, -45, -11, -100, 28, -58,
+    -14, 28, 60, 14, -89, -51, 95, -32, 93, -41, -57, -109, -64, -104, -62, 27,
+    -60, -82, -39, -54, 94, -45, 111, -45, 11, -83, 66, -48, 77, 12, 0, 12,
+    -127, 108, 40, 106, -36, -3, -92, -1, 9, 117, 90, 39, 59, 91, -4, -6,
+    -14, 57, 16, -58, 14, 64, 119, -94, -90, -94, 8, -2, -52, -60, 85, 37,
+    1, -94, 78, -80, -19, -2, 51, -73, -11, -76, -77, 81, 97, 104, 66, -76,
+    -75, -87, 16, 42, 62, -2, -107, -9, 49, 36, 65, -113, -35, 53, -77, 27,
+    -61, -44, -21, 92, 27, 93, 8, -71, -112, 35, -61, 43, 28, 5, -97, -77,
+    -71, -81, 59, -106, -13, -81, -4, 68, 1, -60, 32, -17, -101, 45, 17, 16,
+    -76, 11, 94, -116, 72, -12, -31, -70, -47, -10, 6, -33, -72, -28, 83, 95,
+    14, 99, 16, -45, 45, 75, -60, 6, 107, 23, 68, 8, -57, 27, 102, 53,
+    -17, 121, -22, 21, 71, -64, -63, -6, 106, -68, 71, 35, -13, 75, 8, -36,
+    -31, -77, 97, -39, 53, 50, 42, -82, 40, -90, -116, 63, 37, 16, -40, -92,
+    -76, -88, -77, 58, 17, -32, -48, -38, 19, 27, -12, 14, -2, 40, -5, 66,
+    102, 23, 127, -70, 68, 50, 87, -66, 79, -24, 101, -109, 64, 34, -59, -7,
+    -17, -21, 18, -88, -66, -4, 96, 69, 13, -94, -76, 16, -46, -114, -51, -59,
+    82, 25, -5, -57, 85, 37, 29, 35, 98, 44, -72, -66, 1, 8, -7, -88,
+    12, 101, 66, -36, -67, 86, -78, -43, -63, -98, -73, -84, 62, -1, -62, -71,
+    58, 32, 106, -44, 72, 25, 8, -78, -18, -44, 101, 77, -112, 21, 20, -26,
+    35, 97, 60, -31, -13, 75, 56, 41, -66, -2, 57, -30, -87, 19, -90, 96,
+    -25, 81, 97, -47, 6, -1, -3, 67, -4, 34, -33, -101, 46, -97, 23, -97,
+    -72, -52, -70, 6, 74, -83, -65, -11, 23, -52, -76, -21, 23, 101, 23, 7,
+    -16, 55, -11, -76, -76, 88, -64, -38, -20, -62, 106, -81, -12, -1, 95, 29,
+    35, -88, 85, -117, 60, -66, -72, 52, 88, 36, 42, -13, 58, 95, 108, 22,
+    77, 7, -10, 1, -79, 39, 79, 5, -94, 70, -16, -31, 21, -89, -107, -64,
+    35, -119, -53, -62, 40, -34, 16, 58, -104, 17, -120, -39, -1, -74, 103, 57,
+    -39, 79, -63, -62, 44, -101, -35, 22, 83, 69, -60, -11, 8, 110, -84, -103,
+    -33, 19, -91, 15, 8, -107, -82, -97, -20, 40, -10, 61, 44, 97, 113, 11,
+    -36, -60, 90, -60, 109, 101, -32, 37, 44, 72, 8, -81, -88, 0, -87, 60,
+    -44, -2, -95, 83, -45, 6, 72, 0, -127, 24, 61, -16, 79, 111, -60, 14,
+    72, -21, 83, -33, -20, -81, 85, 98, -43, -23, 90, -98, -6, -96, -92, 0,
+    -21, -30, -68, 87, 44, -63, -12, 66, 11, 100, 53, -73, -49, -85, -41, -35,
+    -93, -92, -3, -67, -30, -74, 26, 27, 55, 38, -94, 61, -5, -85, -74, 40,
+    -84, -20, -11, -34, -60, 67, 96, 10, 29, 69, -17, -68, -23, 66, 22, 74,
+    39, 60, -61, 79, -19, 9, 40, -59, 28, -72, 48, 36, 75, -63, -20, -99,
+    -67, -24, 2, -83, 94, -15, 5, 53, 21, -12, -69, 26, 91, 67, 34, 21,
+    0, -76, -84, -59, 84, -92, -86, -16, -73, -70, 42, -19, 2, -49, -96, 84,
+    17, 80, -53, -24, -46, 56, 33, -60, 84, 62, -42, 66, -63, 89, -54, 48,
+    59, -16, 35, -70, -47, -16, 36, -30, 0, 40, -33, 10, -43, 15, 48, 15,
+    5, -14, -31, -78, -82, 19, 16, 13, -74, 22, 53, -55, 69, -23, -55, 38,
+    -30, -63, -77, 56, 15, 32, -36, 103, -29, -78, -32, -9, 85, 35, 62, -80,
+    35, -17, 14, -6, -19, -20, 127, -29, 26, 2, 33, 41, -3, 14, 88, 8,
+    9, 92, -1, -88, -25, -62, 14, 36, 61, -39, 48, 67, -15, 78, 0, 60,
+    73, 45, -87, -48, -89, 65, -79, 86, 79, 53, 3, 95, 47, 2, 50, -18,
+    -38, -63, 26, -70, -16, 8, 70, -60, -100, -7, -67, 40, 8, -35, 34, -81,
+    79, -110, -88, -77, 24, 99, 127, -69, -101, 10, 66, 98, -106, 109, -51, 11,
+    83, -97, 66, -1, -77, -85, 57, 109, -46, -4, 105, 50, 10, 97, -75, -45,
+    40, -19, 48, 69, -70, 16, -105, 48, -8, 13, -61, 19, -57, 82, -86, 98,
+    42, -46, 65, 114, -41, 48, 42, 86, 87, -78, -39, -14, 32, 41, -98, 21,
+    -109, 39, -14, 49, 86, 32, 22, -108, 39, 48, -82, 44, -17, 70, 42, 48,
+    30, 80, -15, -43, 81, 10, -84, 120, -3, 7, 103, 25, -117, -67, -43, 91,
+    73, -52, 55, 113, -9, 96, 74, 108, 85, 0, -58, 0, 56, 93, 10, 38,
+    48, 77, -64, 64, -73, -13, 80, 6, -67, -27, -30, -85, -92, 32, 1, -42,
+    -29, -35, -22, -20, 72, 15, -67, -87, 47, -51, 86, 13, -64, -89, 52, -67,
+    -38, -21, -63, -22, -6, 17, 4, 92, 125, 73, -82, -35, -59, 43, -3, 39,
+    107, -33, -58, -50, -18, -54, 6, 42, 56, -8, 124, 72, -89, 56, 29, -32,
+    39, 77, -45, -63, 55, 102, 32, 54, 17, -106, -38, 9, -80, -42, 87, 35,
+    114, 104, -19, -7, 14, -6, 73, 72, -89, -11, -33, 16, 115, 71, -108, -68,
+    -86, 36, 109, -47, -92, 73, -73, 67, 55, 49, -73, -22, 17, 6, -3, 9,
+    75, 95, -51, 11, 35, 50, 23, -2, 34, 65, -87, -11, -113, -22, 35, -26,
+    104, -83, -7, -49, 54, 40, 119, 79, -74, -87, 3, 95, -66, 72, -112, -62,
+    3, -15, 68, -34, 107, 111, -117, 49, -21, -88, -45, -83, -53, -51, -122, -80,
+    66, -62, -18, -23, 1, -96, 116, 98, -123, 70, -65, -33, 15, -99, -80, -82,
+    -12, -1, 15, -86, 78, 33, 113, -92, 9, -86, 95, 113, 39, 37, 12, -76,
+    30, 103, 32, -86, 42, 30, -39, -108, -81, 39, -67, -39, -89, -52, -32, -1,
+    97, 90, 21, -104, 38, -12, 43, 85, 0, 98, -127, -52, 60, -46, 74, -65,
+    20, -78, -48, 103, 10, -117, -32, 91, -66, 71, 36, 66, -46, 79, 60, -109,
+    -90, -12, 62, -31, -87, 36, -78, -14, -31, -30, -81, 60, 71, -50, 58, -28,
+    30, -82, -31, 89, -55, 1, 113, -56, 41, 12, 46, -29, 21, -7, 44, 10,
+    -40, -14, 51, 38, -22, 11, 97, 88, -54, 73, -36, -56, -15, 61, 111, -65,
+    16, -63, -91, 9, -43, -57, 57, 91, -41, -45, 91, -95, 14, -45, -30, -86,
+    -28, -57, 87, 89, 115, 37, -104, 3, 22, -82, 110, 4, 7, -84, 4, 81,
+    -29, 46, 82, -100, 40, 49, -106, 20, 17, -76, 36, 2, 78, 54, 92, 16,
+    79, 27, -75, 38, -17, 62, 21, -1, 11, -25, -11, 87, -85, -27, -62, 57,
+    117, 83, 20, -48, 47, 22, 33, -107, -35, 36, 54, 41, 93, -11, 99, 36,
+    -52, 103, -50, -18, 22, -86, 38, 56, -29, 46, -98, 111, 3, 53, 83, 15,
+    -28, 68, -54, 2, -56, -76, -66, -94, 109, -45, -94, -93, 16, -27, 8, 60,
+    46, 0, -62, -58, 22, 62, -26, 41, 12, 83, 78, 92, -95, 40, -51, -36,
+    72, -48, -58, 15, -7, 120, -63, -84, 78, -42, 57, 80, -29, 63, -72, 12,
+    46, 74, -89, -59, 12, -99, 60, 12, 91, -9, -100, 45, 77, -84, 55, 90,
+    -127, -33, 30, -24, 15, 46, -37, -42, -98, -90, -19, 69, -100, -66, 84, 25,
+    56, -16, -58, -114, 85, -46, -48, 88, -56, -53, 38, 0, 42, 57, 82, 42,
+    -40, 90, -93, -43, -51, 62, -72, 13, 13, -64, 45, -55, -113, -22, -55, -91,
+    -62, -44, -78, -9, 40, 62, -5, 103, 62, 85, 55, -55, -39, -97, 54, -42,
+    -65, -82, 55, 6, -66, 35, 84, -76, 46, 21, 53, -6, 48, 34, 52, 57,
+    75, -51, 91, -95, 6, -98, 42, 58, -42, -64, -18, -81, -1, 23, -72, -71,
+    88, -56, 95, 70, 91, 13, 34, -18, -35, -74, -22, 56, -47, 89, -86, -1,
+    72, 21, -82, -79, -52, -41, 41, 73, 24, 63, 14, 110, -33, -89, 5, 58,
+    -32, -76, 90, 42, -61, 6, -10, 87, 19, 29, 59, 82, 19, -107, 49, -35,
+    65, -10, -2, -127, 10, 56, -51, -16, 93, 39, 70, 28, -110, 94, -14, -28,
+    36, 54, 40, 34, 47, 96, 42, 86, -115, -55, 1, 104, 18, -44, -63, 20,
+    89, 16, 85, -38, 51, 66, 11, -41, 91, -89, -101, -69, -44, -35, -34, -66,
+    -75, -29, -66, 58, 107, -91, 54, -13, 6, -48, 24, 76, 85, -70, -45, -14,
+    9, 87, 103, 37, -18, -14, -47, 32, -87, -79, 19, -91, 80, 80, -53, 31,
+    -88, -33, 66, -127, -110, -92, 84, 102, -91, -24, 84, 82, -33, 120, 26, 28,
+    65, -36, -12, 26, -77, 87, 24, 50, -18, -3, 79, 92, -28, -99, 36, 44,
+    108, -81, 41, 55, 77, 37, -52, -60, 52, -80, 104, -97, -28, -60, 106, 50,
+    37, 70, 67, -67, -54, -87, 49, 38, -15, 117, -47, -15, 79, -73, -43, 67,
+    102, 99, 43, -14, -110, 111, -73, 94, 21, 61, 41, 102, -113, -57, -88, -50,
+    -24, -94, -14, -31, 18, 21, 87, -21, 118, -18, -40, -33, -102, 60, -95, 26,
+    108, 7, -94, -37, -62, -66, -36, 26, -123, 72, -29, 48, -97, -32, 63, -70,
+    -22, -44, 47, 121, 42, 107, -71, -41, 81, -111, -68, 96, 78, 68, 50, 98,
+    45, -8, -68, 3, 28, 29, -48, 60, -5, -61, -18, -52, 69, -88, 105, -88,
+    6, -66, -16, 25, 46, -84, 65, 30, 45, -85, -61, -80, -64, 37, -4, 112,
+    106, -84, 93, 6, 19, 90, 28, -57, -12, -107, -66, -54, 52, 24, -69, -49,
+    -58, -4, -22, 41, -122, 15, -52, -89, -14, 0, 74, 4, 92, -91, -95, 25,
+    26, -89, 30, 5, 94, -67, -70, -62, -12, 40, -20, 17, 29, 44, -79, 35,
+    -88, 84, 91, 6, -67, -10, -29, 93, 84, -9, -16, 19, -102, 7, 98, -30,
+    -82, 47, 5, 102, 83, -23, -36, 38, 91, 36, -59, -43, -89, -46, 89, -78,
+    -54, -76, 10, -67, -65, 94, 84, -66, -6, -30, -17, 98, 73, 59, -80, -65,
+    78, 13, 3, 21, 48, -91, 77, 48, 45, -58, -37, -12, 124, -87, -80, -52,
+    67, -99, -62, 113, 23, 48, -19, -31, -9, 98, -7, -71, -75, 22, 101, 73,
+    64, -49, -28, 49, -4, 13, -45, 12, 99, -113, 112, 46, 0, -34, 61, -56,
+    -115, 29, 29, -9, -27, -4, -25, 72, 48, -60, -60, -34, 68, -105, 67, -81,
+    91, 17, -12, 50, 74, -55, -55, 18, -65, 90, -85, 82, 116, -44, -28, -24,
+    15, 31, -50, 127, -21, 104, -55, 33, 122, 0, 114, -74, -61, 70, 94, 60,
+    39, -114, 86, -44, -78, -24, 91, 43, 65, -46, -82, -99, -53, 37, 41, 35,
+    57, 43, 45, 50, 72, -40, -91, -103, 59, -22, 53, -67, -52, 58, 73, 90,
+    -80, 72, 23, -79, -3, 79, -40, -71, 56, -25, -100, -29, -15, -50, -50, -21,
+    -32, -43, -62, 48, 17, -38, -87, 77, -7, -67, -79, -51, -47, -59, -62, -65,
+    49, 9, 7, 58, 21, 15, -92, -46, 62, -50, -51, -63, 55, 18, 3, -32,
+    89, 28, -34, -36, -90, 30, -106, -45, -40, -79, 16, 4, 18, -63, -22, 10,
+    46, 30, -34, 107, 113, 98, 43, 94, -23, -21, -28, 6, 20, -40, 30, 3,
+    54, -78, 9, -43, -25, -35, -59, 61, 85, 17, -60, -85, 31, -7, 85, -13,
+    25, 80, -63, -76, 34, -35, -113, -4, 69, 46, -26, 73, -45, -68, 84, -73,
+    53, 3, 71, -3, 8, 86, -55, 60, 10, -52, -57, 21, -92, -16, 40, 17,
+    52, 45, -19, -27, 127, 45, -75, -73, 102, 5, -76, 40, 65, 20, 86, -7,
+    8, -85, -65, -18, 74, -17, 51, 82, -3, 87, 33, -45, 32, -64, -55, 43,
+    -38, -59, -26, 77, -78, 43, -12, -49, -61, -50, -30, 94, -45, 58, 94, -51,
+    27, 34, 37, 41, -13, -122, 60, 20, -82, 86, -83, -32, 34, -37, 93, 9,
+    -7, 75, 71, -45, -109, -26, -116, -126, -2, -58, -116, 97, -80, -57, 101, -101,
+    61, -119, -99, -34, -23, 36, 11, 85, -39, 66, 79, 34, 67, 52, 73, -96,
+    -90, 63, 10, 9, -55, -120, -47, 115, 41, -78, -42, -114, -124, -23, -18, -44,
+    -26, 45, -51, -20, 55, -50, -35, -52, 80, -113, -84, -79, 22, -127, -99, 105,
+    -77, 20, 35, -36, -46, -34, -9, 68, 64, -81, -78, 16, 102, -52, 118, -51,
+    -47, 8, 48, 65, -63, 20, -74, 85, 11, -88, 50, -47, -50, 79, 56, -19,
+    69, -75, 27, -114, -56, -86, -88, -33, 16, 87, 51, 43, -113, -12, -103, 88,
+    -87, -13, -21, 18, 122, 87, -92, 78, -72, 104, 12, 15, 69, 37, -97, 111,
+    10, 16, -24, -57, 31, 72, 7, 30, -47, -38, 36, -39, 52, 70, -115, -50,
+    -16, 22, 23, -14, -70, 46, -7, 20, 84, -62, -17, 89, 9, 115, 54, 0,
+    15, -38, 40, -29, 45, 26, 57, -44, 19, 105, -56, 111, -32, -122, -52, -87,
+    102, -62, 121, 55, -98, 42, -10, 9, 34, -18, -13, -104, 83, 122, -93, -111,
+    -91, 72, -35, 59, -5, 75, -117, -25, -5, 56, -60, 52, -90, -41, 41, -5,
+    -65, 87, 69, 80, 85, 18, -87, -76, -4, -84, 30, -31, 113, 1, -110, 74,
+    59, -49, -102, 16, -4, -16, 47, -40, -7, 18, -110, -7, 46, -76, -67, -36,
+    100, 33, 67, -48, -127, 22, -82, -61, -61, 50, -92, -123, -37, -104, 85, -118,
+    7, 64, -10, -27, 91, 2, -60, -6, -98, -61, 101, -76, 49, 23, 58, 52,
+    -24, -29, -84, -17, 32, 104, 81, -29, 109, 63, -66, -12, 64, -53, -70, -14,
+    117, 120, 27, -111, -68, 84, -9, -31, -95, 9, 66, 58, -94, 101, -76, 38,
+    -118, 75, 12, 83, 71, 16, -2, 51, 10, 5, -15, 68, 26, 17, -25, 46,
+    -50, 59, -60, -43, -117, 86, -79, 38, -61, 53, -54, -77, -42, -12, 76, 112,
+    38, 62, 16, 80, 40, 90, -102, -57, -70, 104, 57, 103, -8, -5, -28, 57,
+    53, -106, -80, -95, 20, -38, -54, 126, 44, 5, -17, -45, 2, 78, -65, -34,
+    -43, -104, -41, 65, -27, 79, -9, -96, -21, 81, 90, 27, -64, 61, -11, -14,
+    84, -32, 4, -68, -50, 42, -71, -100, 83, 72, -53, 23, -71, 85, -29, 23,
+    -94, 8, 60, -81, 58, 33, -96, 43, -80, -12, -111, -101, -65, -43, 79, 80,
+    -64, 64, 16, -23, -48, 48, -85, -65, 7, 24, -58, 109, -88, 75, -106, 7,
+    -21, -69, -81, 31, 37, -16, 29, -54, 91, -90, -71, -33, 17, 47, 38, 5,
+    115, 15, -96, -36, 38, -63, -2, 70, -6, 76, 16, -110, 126, -98, -45, -24,
+    102, -113, 25, 2, -6, 75, 95, -106, 59, 54, 10, 97, 51, 115, 54, -97,
+    26, 94, -54, -81, -39, -83, 47, -54, 88, -95, 10, -33, -108, -100, -70, -37,
+    -60, -90, 67, 127, 78, -26, 43, 76, -50, -61, 38, 91, 59, -15, -95, -76,
+    -52, 71, -25, -112, 56, -37, -38, -84, -15, -107, 45, -86, 45, 45, -17, -50,
+    78, 10, -105, 73, -76, 14, 6, 30, 45, 100, -80, 104, -91, 124, 18, 78,
+    7, -54, 90, 58, 68, -109, -2, 33, 43, -106, 106, 59, -28, -18, 1, 68,
+    32, -77, -44, 87, -5, 80, 61, -35, 36, 55, 1, 20, -55, 87, 62, -14,
+    -10, 4, 127, -21, 45, -39, -17, 103, 81, -58, -72, 1, -18, 34, -105, -71,
+    47, 3, 51, -87, -77, 39, -23, -34, 95, 125, 71, -95, -68, -9, 84, 11,
+    -91, 13, 27, -77, 10, -2, 28, 2, -107, -72, -107, 12, -57, -55, 55, 121,
+    7, 58, -70, 69, 41, -33, 69, -35, 9, -15, 4, 41, -97, -64, 116, -72,
+    -42, 72, 42, -2, -11, -89, -27, -1, -83, -1, -119, -69, -92, -16, -91, -18,
+    68, -42, -60, -84, 15, 116, 1, 7, -83, 52, -75, 77, 92, -106, 32, 22,
+    -8, 37, -83, -34, -71, 58, -35, 112, -89, 107, -56, -8, 88, 1, -37, 90,
+    46, 21, 4, -81, 92, 62, -47, -100, -76, -64, -100, -27, -49, -99, 97, -11,
+    18, 35, -83, -18, 35, 117, -57, -66, 63, 41, -16, -41, -112, -48, -6, -26,
+    40, 104, 0, -46, 41, 58, 92, 4, 59, 87, -91, 42, -81, -39, 77, 80,
+    -70, 81, 21, 52, -2, 77, -94, -107, 32, 33, -122, 92, 93, -23, 78, -24,
+    42, 62, -25, 27, 69, -34, 7, -52, -23, -75, 70, 89, -82, 43, 5, 41,
+    -16, -28, -10, -48, 72, 99, 55, -35, 83, 109, -59, 22, -22, 88, -11, 74,
+    -92, -82, -41, -114, -85, 23, 91, -43, -14, -24, 54, 9, -17, 48, -102, 81,
+    61, -38, 10, -82, 61, -9, -70, 21, 18, -6, -1, 81, -45, 95, 52, 55,
+    -44, -67, 116, 7, 17, -9, 88, -64, -42, 41, -25, -9, 42, -20, 106, -110,
+    -71, 41, 34, 39, -37, 70, -3, 51, -59, -65, -61, -63, 1, -40, -87, -47,
+    15, 104, 90, -103, -58, 87, 36, 108, 52, -30, 46, -88, -4, 8, 30, 79,
+    58, 20, -78, 20, 73, 18, 54, 18, 24, -19, -28, -39, 36, 68, -89, -3,
+    -89, 99, 87, 106, -87, 42, 27, 35, -81, -89, -88, 81, 79, -75, -21, -108,
+    -60, -1, 108, -53, 127, 56, -1, -52, 47, -34, -82, 3, 68, -39, 30, -41,
+    -18, 85, -63, 36, 28, -17, -69, 43, 69, -91, -37, 36, -29, -75, -8, 60,
+    -3, -4, -86, -83, -1, 59, -29, 78, 99, 26, -90, -96, -87, -3, 85, -54,
+    -77, -44, -94, -3, 60, -96, -54, 43, -25, -76, -45, 35, 46, -20, 38, 41,
+    18, -42, 56, -91, -36, -14, -1, -20, 60, -82, -111, 24, -19, 37, 106, -9,
+    61, 64, 42, 85, 58, -18, 117, 27, -73, 28, 47, 36, 106, -64, 109, -5,
+    -50, -103, -102, 85, 15, 97, 39, 96, 121, 65, -65, 93, -70, 32, 48, 81,
+    91, 43, -24, 53, -108, 33, 34, -74, -34, 127, -77, 23, -78, 100, 48, -44,
+    -59, -25, 39, 42, -12, -108, -49, 16, 107, 83, 99, 90, -56, -30, -67, 82,
+    -60, 21, -65, 53, 21, -3, 109, 97, 68, 26, 38, -125, -82, 113, -98, 26,
+    91, 9, 15, 43, 69, 104, 85, 9, 27, -86, -59, -34, 7, 29, 74, -68,
+    -45, 60, -81, -100, -38, 87, -13, -60, 103, -19, 69, -76, 101, -4, -117, -59,
+    -100, -39, 16, 60, -75, 24, -112, 20, 49, 26, 9, -50, 4, -29, -87, 26,
+    67, -15, -10, 94, 98, -27, -23, 27, -100, 32, 21, 80, -95, -120, 1, -32,
+    -7, -22, 83, 10, -122, 15, -19, 50, -92, -17, 103, -43, -30, 94, 117, 14,
+    -30, 28, 67, 57, 14, 14, -68, -76, 38, 47, 25, -36, 13, 63, 29, -69,
+    29, 73, 7, 28, 2, 37, 70, -54, -56, 30, 14, -32, -76, -61, 39, -62,
+    65, -61, 72, -39, -29, 43, -31, 25, -24, -89, -57, -4, -44, -27, 83, -59,
+    69, -32, 74, -85, -27, -20, 28, 45, -48, 16, -92, 41, -26, -88, -74, -53,
+    45, 71, 38, 62, -53, 7, 46, 107, 56, -51, 72, -27, 90, 53, 89, 47,
+    -5, 70, -70, -41, 71, 71, 29, -29, 0, -68, -13, -5, 35, -5, 104, -66,
+    5, 86, -31, 127, 106, -79, 74, -45, -69, -67, -18, 58, -28, 17, 109, 43,
+    93, -39, -41, 95, -43, 58, 43, 88, 72, -84, -61, -79, 23, -90, 61, 42,
+    32, -78, 28, 106, 59, -87, -37, 61, 12, 20, 17, 40, 86, -8, -18, 20,
+    13, -56, 20, -90, -97, -26, -41, 47, 58, 84, -90, 26, 19, -2, -80, 10,
+    -58, -62, 73, 66, 108, 34, -13, 43, 39, -70, -56, -47, 41, -55, -63, 63,
+    -59, -84, -77, 56, -56, 64, 18, 12, 16, -12, -95, 24, 2, 96, 60, 22,
+    14, 21, -76, 112, 51, 82, -2, 14, 46, -54, -17, -26, -18, 59, 16, -77,
+    -8, 97, -37, -105, 63, 76, -46, 23, -13, -72, -19, -92, -71, 88, -108, -62,
+    -20, -44, -29, -31, 58, -21, -1, -18, -30, 40, 17, -23, -66, -66, -62, 4,
+    22, -17, -22, -59, -38, 19, -33, -91, 60, 127, 8, 24, -26, -53, 20, -26,
+    57, -112, -92, 99, -16, 44, 17, 38, -3, 85, -5, -62, 44, -24, -14, -72,
+    15, 80, -81, -99, -87, -52, -52, 21, -12, 82, 47, 66, -20, -10, -12, 106,
+    -102, -4, -38, 68, 80, 88, -95, 7, -14, 85, -51, -60, 122, 2, -83, -102,
+    54, -55, 16, 71, 61, 41, -11, 39, 81, 44, -78, 29, 25, 70, 2, 21,
+    91, 20, 33, -33, 9, 13, 70, 6, 9, -45, -89, 95, -15, -80, -115, 43,
+    52, -85, 92, 51, -86, -3, 102, -76, -15, 69, -10, -42, -74, 84, 83, -44,
+    20, 82, 76, -100, -89, 84, -86, 90, 113, -95, -77, 55, 99, -62, 56, 97,
+    -12, -111, -10, 78, -14, 24, -84, -73, -1, -4, 80, -13, -22, 99, -75, 10,
+    106, -113, -39, 41, -93, -49, 17, -110, -101, 42, -35, 52, -71, -123, 106, -46,
+    -13, -40, -64, -68, 28, 104, -71, -60, 49, 127, -31, -55, 97, 7, -83, 31,
+    -86, 19, 32, 97, 103, -45, -76, 27, -50, -29, 34, -5, 92, -59, -57, 61,
+    18, 24, -97, 98, 81, -40, -66, 86, -67, 41, -86, 7, -66, -70, -12, 106,
+    -93, 44, -55, -20, -77, -3, 89, 77, 108, -114, -7, -75, 67, 2, 21, 54,
+    -86, -117, 87, -28, -39, 26, 62, -92, 70, -57, 17, 33, 43, -31, -97, 97,
+    -40, 59, -83, -62, 41, 60, 50, -1, 39, -16, 74, -56, 97, 30, 6, -34,
+    -6, 40, 99, -6, 113, -2, -114, -54, 64, -38, -116, -66, -41, -64, -121, -33,
+    95, 60, -66, 14, 50, -49, -91, -126, 102, -36, 69, 97, 74, -90, 18, 41,
+    77, -94, 105, 26, -57, -24, 63, -9, -11, -67, -102, 94, -28, 63, 9, 80,
+    74, 63, 7, 74, -93, -27, -58, 82, 96, 55, 57, -62, 84, 97, -104, 22,
+    -34, 19, 19, 67, -57, -83, -95, 21, 84, 97, 13, -87, 10, -44, 39, -58,
+    17, -12, 0, -50, 59, -29, -34, -65, 78, 38, 82, 64, -74, 59, -30, 98,
+    29, -42, 88, 59, -27, -38, 54, 74, -48, 61, -82, -5, -54, -108, -81, 92,
+    -99, 70, -81, -47, 108, 83, -46, 60, -21, 113, -5, -24, 92, 42, 63, -74,
+    88, 40, -4, 3, 49, 3, -71, -89, -1, -102, 115, 48, 12, 7, -73, 12,
+    105, 4, 88, 37, -79, -2, -30, 8, 55, 118, 74, -16, 28, 26, -82, -38,
+    -47, 56, -54, -20, -66, 7, 32, 78, -47, -94, 30, -103, 95, 42, 47, 55,
+    104, -56, -68, -38, 44, 18, -12, -54, 55, 18, 75, -35, 85, 45, 84, 41,
+    32, -84, 85, -101, 22, -90, -77, -6, 1, -79, 118, -42, 68, -50, -41, 30,
+    57, -41, 54, 104, 65, 52, -64, 41, 44, 16, 36, 53, 42, -118, -8, -98,
+    97, -29, -87, -90, -5, -15, -77, 12, -23, 41, 93, 51, 30, 30, -89, -102,
+    -83, 31, -81, 50, -83, 14, 74, 2, -82, 42, -4, 13, 36, -44, -95, 24,
+    127, 18, 19, 91, 44, 51, 109, -19, 12, -93, -17, 82, -29, 108, 121, -1,
+    70, 5, -46, -14, 12, 34, -40, -42, -53, -34, -49, 103, 74, -30, 114, -103,
+    -28, -37, 30, 65, 29, -19, -71, 68, 47, 69, 127, 15, 90, 121, -32, -103,
+    16, -47, 23, -48, -3, -24, -94, 66, 48, 101, 23, 113, -118, -26, -85, 56,
+    17, -70, -46, -39, -17, 38, -58, 37, 34, 100, 3, 39, -50, 23, 51, 73,
+    -100, -6, 0, 68, -65, -50, -12, -35, -47, 27, 20, -99, -37, 112, 123, -14,
+    -56, -39, -111, 69, 55, 37, -33, 5, 109, -107, -100, 102, 81, -75, 114, 103,
+    -82, 77, -71, -26, 71, 97, -76, -100, -31, 39, -118, 76, -118, -9, 11, -24,
+    -118, -66, 18, -81, 73, -40, 11, -14, 35, -36, 30, -100, -59, 32, 35, 102,
+    -92, -14, 19, -84, 116, -66, -99, 10, -16, -55, -83, -61, 4, 33, -30, 7,
+    43, -23, -59, 10, 60, 80, -98, 6, -25, 11, -4, 80, -10, 54, -56, 70,
+    112, -22, 83, 54, -109, 33, 69, -10, -1, 77, 65, -7, -24, -34, -56, 102,
+    -53, 19, -16, 6, 72, -67, -82, -67, -28, 49, -96, -59, -6, -2, 82, 94,
+    -83, -57, 85, 6, -3, 62, 8, 35, -47, 71, 88, -84, -19, 77, -26, -49,
+    59, 39, -70, 102, -58, 90, 58, -56, -103, -21, 26, 94, -33, 58, 42, 13,
+    78, 16, -59, 58, 27, -52, -58, 39, 4, -116, -24, -21, 20, 83, 62, 50,
+    -118, -3, 85, -121, 60, -55, -5, -33, -49, -25, 89, 65, -38, -64, -40, 70,
+    118, -86, -84, -29, 18, -54, -82, -39, 17, -3, -122, 65, 15, 15, -33, 8,
+    41, 11, -89, -72, 92, -48, 58, -80, 1, -90, -101, -13, 78, 43, -89, 46,
+    -22, 99, -80, -82, -72, -55, 62, -65, 83, -25, 65, -66, -32, 110, -67, -21,
+    78, 76, -55, 59, 78, -6, -48, 43, -37, 48, 6, -72, -84, -42, 78, -117,
+    91, 21, 43, -4, 31, -41, -35, 95, 85, 18, -55, -48, -39, 81, -32, 54,
+    -19, 111, -29, -27, 42, 78, -97, -19, -10, 86, -97, 21, 56, -26, 54, 100,
+    -30, -69, 37, 66, 77, -59, -83, -2, 45, -118, 113, 127, 28, -70, -93, 22,
+    19, 81, -35, -57, 48, 13, 16, -19, 24, -80, 81, 92, 101, -41, 8, 72,
+    -23, -58, -43, 15, -22, -91, -95, 28, -97, 42, -67, 112, -106, -100, -103, -17,
+    -4, -74, 81, 113, -64, 39, 83, -51, -4, -88, 88, 55, -9, -56, -97, 37,
+    31, 17, -54, 12, 82, -85, 62, -32, -67, 59, -102, 18, -102, 5, -48, -118,
+    55, 59, -29, -76, -29, 55, -86, -124, 10, 48, -88, 18, 32, 9, -74, 23,
+    -87, 39, 88, 95, -63, -83, 61, -5, 30, 47, -36, 105, 40, 15, 119, -80,
+    -31, 0, 62, 31, -73, 83, -15, -82, -72, -41, -51, -65, -96, 106, -87, -86,
+    -60, 81, 7, 116, -53, 79, 43, -81, 17, 89, 72, 64, -112, -94, -68, -49,
+    22, 52, -73, 20, 93, 112, 1, 5, 106, -113, 22, -96, 41, 49, -87, 40,
+    -75, 15, 101, -97, 55, 16, 104, -73, 30, -111, -110, 87, 123, 106, 67, 99,
+    97, -59, -4, 93, -26, -101, -81, 22, -22, -90, 109, 7, -11, 85, -99, 79,
+    -89, 43, -4, 27, -67, 7, 28, 58, -72, 88, -112, 101, 40, -81, 48, -19,
+    -43, -1, -101, -76, -15, 119, -74, -76, -127, 24, 104, -70, 31, 111, 40, -100,
+    -72, 93, 27, -62, 60, 23, 80, 56, 18, 64, 103, -101, 104, -67, -87, -82,
+    -88, 59, 52, 53, 40, 88, 15, 92, 52, -74, -50, 56, 106, -69, -40, -85,
+    13, -110, -94, 42, -71, 69, -77, 8, -60, -54, -8, -43, -18, 2, 45, -72,
+    -86, 19, -40, -58, 83, 34, -94, -107, 58, 45, -14, 67, 38, -84, -95, -9,
+    -117, 55, 23, 98, 67, -60, 125, 89, 100, -32, 52, -127, 25, 32, -86, -108,
+    65, -26, -30, 41, 21, 19, 59, -16, -60, 35, 18, -31, 97, -35, 9, -44,
+    -61, -100, -79, 36, -109, -2, 4, 2, 42, 32, -43, -93, -8, -87, -101, 30,
+    -45, 104, -42, 127, 73, 100, 9, 87, 122, -85, 109, 72, -106, 69, 35, 9,
+    94, -40, -82, -15, 38, 96, 37, -76, -23, 18, 6, 78, -46, 36, -17, -73,
+    37, -81, 11, 34, 56, 57, -70, -69, -84, 19, -113, -120, 19, -75, 109, 64,
+    11, 56, -50, 83, 76, 64, 61, 97, -55, -38, 7, 76, -103, 115, 54, 81,
+    29, 71, -70, -84, 21, 98, -92, -57, -6, -93, 53, -75, 38, 76, 69, 22,
+    -41, -63, 50, -21, -14, 64, 89, -109, 60, 34, 58, 60, 68, -13, -83, -20,
+    -70, 45, -76, 45, 42, 56, -17, 32, 68, -37, -41, -45, -50, -21, -93, -80,
+    -70, 15, 29, 84, 22, -1, -51, 68, -28, -8, -31, 20, 34, 50, -10, -7,
+    102, -38, -29, 40, -36, -73, 42, 21, 46, 13, -76, -42, -105, -6, -24, -17,
+    3, 25, 55, -27, -64, 1, 17, -127, -3, -58, 79, 61, 48, -32, -42, 13,
+    80, 84, -79, 19, -83, -11, 58, -13, 28, -21, -16, -58, 1, -14, 13, -55,
+    -10, -60, -32, 67, 21, -9, 52, 79, -41, 17, 0, 66, -78, -40, -68, -16,
+    85, -57, 79, 74, -11, -12, -51, 69, 35, -32, 71, 24, -94, -8, 62, -24,
+    -5, 34, -1, 83, -52, -19, 68, -57, 45, 5, -26, 44, -16, -10, 89, 42,
+    57, 46, 31, -76, 68, 37, 7, 100, -61, 93, 27, -82, 2, 46, 74, 52,
+    -48, 80, 8, -36, -79, 70, 88, 59, 73, 65, -74, -19, 24, 85, 78, 1,
+    21, -75, -4, 7, -69, -48, 92, -66, -76, -33, -15, 7, -83, -59, -61, 87,
+    -73, 18, 4, -114, 90, -56, 60, -36, -11, 26, 94, 68, 39, 1, 22, 96,
+    82, 65, -81, -80, -29, 2, -64, -127, -80, -59, 79, -39, -28, -70, 31, -8,
+    35, 82, 34, -88, -90, 73, 23, -38, -9, 99, 64, 84, 4, -51, -24, -38,
+    -92, 77, 25, -90, -71, -57, -63, -92, -85, -20, 2, 31, 78, -30, 60, -55,
+    -49, -65, -55, 73, -88, 79, 69, 45, 58, 88, 39, 33, 46, 77, -69, -47,
+    27, 16, 86, -80, 116, 75, 78, -57, -95, 31, 57, 49, 46, 60, -80, 47,
+    54, -67, -4, 39, -54, -4, 85, -30, -53, -73, 8, 47, -65, -49, 75, -38,
+    -83, -107, 51, 33, 64, -10, 25, -78, -65, 66, 4, 103, -44, -66, 18, -81,
+    -17, -42, 57, -55, 42, -21, 27, 76, 90, -74, -3, 21, 74, -98, -1, 98,
+    -104, -29, -35, 9, -100, 58, 12, 46, -45, 35, -14, -80, -6, -22, -81, -33,
+    11, 52, 11, 24, 3, -33, 87, -36, 76, -81, 77, 117, -41, -58, -102, 53,
+    -84, 63, 74, -1, -10, -35, 49, 28, 69, 24, 62, -9, 19, -78, 13, -112,
+    -45, -90, 28, -28, -61, 79, -65, 54, 26, 114, -33, -42, -24, -10, 50, -32,
+    41, -93, -43, 8, 55, -22, 20, -37, -24, -111, 78, -123, 39, -57, 38, -63,
+    55, 85, -83, -4, -21, 45, -64, -89, 7, 72, 123, -33, -127, 103, 23, -6,
+    -70, -34, 39, 44, -33, -41, -90, -33, 100, -74, 3, -43, 115, -92, 3, -34,
+    -39, 84, -56, -25, 84, 36, 42, 37, -28, 13, 88, 78, -53, -74, 69, -27,
+    -59, 99, 48, -63, 14, -33, 96, -13, 104, 45, 38, -39, -83, -64, 20, -69,
+    -118, -38, -68, 44, 70, -76, 56, -32, -46, -24, -79, 8, 70, -52, 80, -76,
+    37, 85, 91, 44, -58, -59, 66, 33, 127, -39, -109, -40, 43, 84, -94, -35,
+    48, 6, -16, -62, 76, -85, 8, 9, -35, 19, -120, -120, 58, -74, 69, 97,
+    13, -19, 69, -19, 88, 70, 50, 111, -15, -71, 98, 33, -67, -108, -65, -69,
+    -18, 74, -3, 10, 21, 15, -17, -14, -86, 41, 43, 0, -43, 64, -100, 126,
+    -22, -45, 32, -24, 28, 37, -52, -97, 10, -91, 54, 119, -6, -54, 84, 19,
+    14, -37, -12, -54, -19, 85, -3, 63, -43, -52, 6, 73, 59, -104, 61, -91,
+    -43, 60, 62, 5, -8, 71, 78, 91, -95, -33, 93, 29, 94, -58, -21, -58,
+    49, -28, -14, -36, -15, -94, 23, 103, -44, 103, -50, -3, 75, -67, -84, 40,
+    60, -79, 114, 81, 22, -30, 38, 25, -100, 17, -89, 77, 31, 61, -62, 72,
+    2, 96, 5, -95, 37, 32, 24, 79, -93, 35, -52, 22, 78, 54, -64, 88,
+    -19, 47, -7, -17, -82, 92, -40, -4, -51, -52, 125, -64, -5, -25, 79, -62,
+    5, 9, 84, 13, -14, -21, -117, 123, -10, 42, 68, -117, 34, -62, 56, 69,
+    3, 49, -68, -21, -62, -21, -19, 88, 102, 126, 91, 93, 111, 22, 63, -1,
+    31, 30, -114, 9, 110, -47, 120, 39, -98, 103, 40, 15, -86, -6, 47, 6,
+    76, -97, -92, 69, 17, 78, 50, 127, 29, -91, 82, 13, -94, -94, 11, -74,
+    71, 65, -103, 30, -81, 107, -33, 127, -51, -25, -89, -15, -108, -19, 53, 18,
+    69, -53, 100, -19, 88, 35, -83, 95, 54, 39, -42, 54, 35, -60, 48, -64,
+    -24, 5, 58, 95, -26, -4, 82, -122, 23, -78, 68, -34, -19, 68, 36, -33,
+    49, -97, 70, -41, -19, -18, 68, 91, 9, 62, -39, 9, -7, 88, -25, 43,
+    -78, -29, -38, 69, -10, 19, -73, 43, 15, -5, -50, 62, 106, 68, 96, -56,
+    -57, -91, 52, 27, -32, -32, -42, 15, 70, -56, -105, -22, 62, -59, 100, 89,
+    -78, -53, -69, 18, -99, -13, 80, -41, 18, 38, 29, -66, -68, -101, -92, 67,
+    -70, -26, -78, 66, 75, 88, 63, 30, 77, -97, -90, -74, -33, 60, -6, -59,
+    124, 44, -8, 25, 35, 65, 24, 51, 94, -62, 37, -24, -15, 51, -32, 25,
+    9, -72, -37, -19, 1, 30, -3, 112, -85, 84, -44, 22, -75, -14, 53, -47,
+    -46, 84, -12, 37, 58, 106, 25, 3, -73, -39, 63, 51, -24, 60, -85, 98,
+    3, 41, -57, 34, -29, 80, -29, 118, 69, -7, -78, 33, -42, 44, 45, -127,
+    110, 20, -43, 32, -92, -77, -29, -79, -49, -62, -73, -24, -36, 42, 61, 18,
+    -25, 27, -55, 15, 32, -41, -18, -39, -49, 33, 96, -36, -55, 103, 8, 96,
+    -35, -72, -45, -30, 6, -31, -57, 34, 35, -10, -31, 19, 54, 3, 53, -42,
+    -64, 25, 12, 22, 64, -73, 60, 27, 21, 18, -97, 32, -121, 55, 68, -38,
+    60, -13, 16, -60, 85, -35, -72, 0, -10, -16, 58, 41, 75, 67, 93, 109,
+    20, -95, 32, 63, -29, -82, -30, -49, -44, 12, -57, -68, 44, 5, -91, 25,
+    -11, -35, -33, 56, -73, 64, -86, -127, -41, -39, 39, -8, -13, -90, -82, 73,
+    -72, -22, -2, -126, -99, -58, -66, -20, 79, 47, 34, 21, -32, -15, -26, -111,
+    21, -41, -13, -39, 67, 80, -57, -11, -64, -21, -91, -87, 65, 36, -31, 97,
+    75, 84, 58, -41, -49, -8, 66, 3, 3, -66, -113, 15, 8, -16, -32, -67,
+    -57, -59, 50, -54, 56, 71, 15, -72, -48, -33, 105, 83, 28, 28, 41, -29,
+    28, -19, 41, -2, 100, -8, 58, 70, -91, 85, 18, -39, -69, 53, -56, -54,
+    86, 0, -51, -68, -35, 26, 100, 101, 102, -62, -80, -3, 125, 24, 47, 17,
+    -91, 101, 75, 47, 8, -56, -42, -92, -55, -40, 61, 34, -84, 15, -42, -39,
+    -15, -95, 99, 105, 19, 49, 74, 25, -46, 45, 55, -71, 19, 8, -81, -63,
+    84, -70, -82, -11, -10, 99, 46, -19, -105, 33, 105, -43, 71, -7, 4, 45,
+    3, 24, 112, -32, -62, 65, -10, -121, -70, -96, -69, 23, 25, 27, 9, 116,
+    -8, 63, 49, 45, 86, -78, -26, 86, 63, -39, -15, 87, -4, 23, -67, -111,
+    93, -29, -57, -10, -50, -9, -67, 106, -85, -57, 81, -13, -64, 85, 23, -53,
+    -127, -53, 27, 26, 111, 62, -63, 98, 85, -109, -60, -73, 9, -75, 44, 22,
+    107, 91, -41, 101, 49, -112, -22, -97, 48, -71, 17, -105, -103, 37, -86, -53,
+    9, 17, 90, -18, 0, 45, 96, -117, 69, -93, -46, 3, 29, 77, 74, -104,
+    101, 32, -90, -64, 19, 35, -100, 47, 69, -64, 58, -88, 93, -81, 36, -42,
+    -33, 2, -21, -6, 100, 8, 88, 43, 46, 88, 28, 70, -74, 67, 46, -56,
+    46, 69, -67, 1, 2, -98, 42, 11, 21, 0, -90, -89, -105, 12, -29, -89,
+    38, -30, 93, -96, -39, -68, 1, -26, 3, 83, 47, 50, 112, -77, 126, -80,
+    -72, -7, -68, -43, 40, 36, 31, -88, 50, 73, -98, -28, -30, -6, -22, 29,
+    -59, -84, -5, -34, 117, -15, -88, 74, -69, -67, 3, 60, 73, 82, 61, 105,
+    -121, 12, -92, -103, -46, 33, -98, -60, -4, 55, 36, -3, -113, -52, 72, -93,
+    9, -77, -84, 22, -54, 32, 13, -102, 36, -36, -52, 94, -31, -62, -26, 37,
+    65, 9, 48, 60, 109, 30, 2, 57, -91, 28, -64, 33, 82, 58, 98, -9,
+    -24, -43, 81, 2, -71, -38, 33, -16, -19, -43, -1, -79, -5, -12, -31, 77,
+    91, 51, 54, 39, -69, 50, 98, -29, -104, 63, -17, 89, -75, -57, -57, 62,
+    -54, 87, 13, -102, 31, 89, -14, 53, -49, -39, 23, -88, 73, -45, -76, -34,
+    -17, 106, 127, -7, 6, -36, 44, 38, -102, -25, -20, 95, 30, 69, 56, -56,
+    47, -45, -63, 17, -2, -53, 41, 33, 67, -15, -37, 66, 45, -61, -18, 73,
+    -96, -84, -46, -20, 81, -57, -19, -90, -103, -105, 0, -36, 18, -17, -90, -94,
+    -80, -66, -38, 34, 112, -20, -42, 88, 17, 28, 60, 92, -48, 12, 79, 8,
+    -79, -113, 33, -90, 61, -12, -36, 47, 25, -97, -100, -30, 118, 54, -34, 10,
+    71, -81, 108, -79, -24, 7, 45, -98, 50, 59, -18, 27, -77, -74, 55, 18,
+    3, -26, 52, -79, 81, 67, 113, 28, -31, -72, -20, 50, -54, 99, 5, -54,
+    -5, 74, -13, -41, -14, 45, 25, -91, 74, 61, 57, 50, 82, 80, -91, 113,
+    -35, 26, 77, 46, 15, -21, -66, 116, 3, -6, 37, -101, 73, 7, -73, -11,
+    64, -49, 22, 46, -92, 41, 30, 43, 99, 23, -69, 9, 5, 50, -103, 96,
+    -97, 101, 5, -26, 64, 52, 112, -46, -16, -71, -1, 44, -108, -90, -108, -109,
+    -74, 43, 99, 39, 66, 19, 50, 12, -62, -74, 13, -11, 85, -39, -24, 75,
+    35, 24, -102, 33, 21, -15, -2, 123, -43, -12, -28, 20, 46, 38, -55, -39,
+    41, -43, -85, -105, 81, 115, -101, -14, -78, 7, -96, -25, 67, -90, 80, -32,
+    -50, -87, -35, 77, -69, -127, -19, 96, 80, -22, -49, 50, -83, -108, -17, 102,
+    -33, -32, -8, 68, -101, -59, 113, -101, 87, 33, 20, 82, -19, -33, -123, 40,
+    -86, 61, 76, 48, 85, 40, 89, 51, 56, -53, 23, 50, -64, 49, -46, 50,
+    94, -76, -95, -71, 2, -63, 49, -101, -117, 66, 70, -76, -62, -95, -6, 2,
+    89, 61, -92, -44, 15, 2, -9, -22, -88, -11, -99, 6, 16, -88, 104, 27,
+    -48, 73, 99, 95, -63, -1, -106, -91, 25, 15, -37, -98, 47, -44, -61, 105,
+    51, 90, 101, -39, -108, -9, -64, 31, -77, 93, -106, -83, 41, 77, 47, -81,
+    60, -96, 13, 86, 10, 7, 117, 5, 43, -41, 68, -46, 16, 68, 54, 73,
+    117, 96, 78, -61, 107, 35, 110, -47, 92, 84, -33, -66, 63, 78, -12, 54,
+    120, -37, -8, 83, 43, -43, -74, -87, 97, -67, -40, -127, -78, 14, -74, 55,
+    83, 52, 59, 122, -112, 66, 2, -102, -37, -69, -90, -80, 79, 0, -111, -96,
+    -64, 84, 5, -118, -114, -64, 91, 85, 55, 14, 87, -84, -88, 86, -40, 33,
+    42, -8, 107, -104, -27, 38, 82, 8, 84, -26, -35, 69, -4, 66, -46, -69,
+    99, -68, -51, 58, -105, 78, -16, 18, -8, 32, -7, -104, -23, -95, -13, 20,
+    43, 33, -73, 4, 97, -85, -89, 4, -77, 39, -109, 45, -46, 91, 102, -8,
+    44, -119, 117, -9, 100, -93, -14, 67, 53, -67, 24, 77, -26, -93, 100, 122,
+    97, -104, 15, 104, -93, 114, -45, 53, -105, 111, 29, -51, -95, 84, -26, 98,
+    58, -79, -68, -120, 29, 80, -41, 35, 100, -13, 59, -84, -121, 52, -10, -20,
+    -23, 42, 42, 18, 106, -37, -46, -75, 124, 45, -3, -22, -44, 118, -14, 67,
+    -25, -34, 2, -20, -38, -13, -67, 93, 70, -127, 14, -95, -63, -42, -37, -5,
+    111, -35, -71, 95, -9, 5, 82, -117, -23, -113, 126, -3, -86, 113, -29, 17,
+    1, 79, 105, 48, -2, 119, -27, 36, 4, -29, -92, -96, 19, -31, 10, 111,
+    37, -119, 12, 71, -86, 14, -41, -35, -9, -55, 108, -18, -58, -26, -91, 10,
+    -62, -65, -36, 31, 78, -29, 84, -2, 20, 15, 61, -61, -2, -2, 19, -84,
+    14, 113, -51, 88, -110, 40, 45, -44, 21, 96, 83, 111, -33, 108, -110, -41,
+    56, 117, -115, 73, 25, 6, -39, -75, 66, 28, 80, 50, -49, 27, -20, -100,
+    84, 99, 93, -75, 95, 52, 88, -45, 23, -92, 65, 80, 56, 64, 14, -77,
+    -45, -27, 13, -31, 17, 39, -55, 107, -70, 94, -27, -24, 78, -35, -71, -16,
+    -59, 87, -41, -70, 49, 70, -111, -94, 43, -83, 99, 76, -75, 91, 55, 20,
+    -107, -42, 108, 54, 9, 96, -74, 47, 69, -30, 65, -54, 24, -42, 24, -61,
+    -53, 49, -80, -111, -21, -39, -87, 53, -57, -3, -82, -18, -45, -8, 28, -24,
+    -103, 5, 80, 101, 84, -60, -63, 26, 10, 75, -64, -75, -43, 41, -124, -66,
+    -72, 53, 92, -127, 21, -45, -4, -71, -63, 103, 33, -71, 67, -113, -25, 77,
+    51, 9, -31, 90, 113, 75, -83, 104, -16, -29, -8, 108, -36, -57, -34, -16,
+    -38, -29, -49, 86, 3, 34, -33, -114, 71, -88, 52, 91, -82, 18, -64, 23,
+    48, -75, 85, -32, -32, -33, 59, 30, 43, -86, -127, 96, 8, -24, -74, -63,
+    24, 0, -73, 2, 87, 95, 14, -31, 38, 21, -31, -53, 36, -39, -38, -8,
+    28, -98, -27, -96, -53, -58, -63, -59, -88, -39, -70, 85, -40, 26, 5, -65,
+    -74, -91, 4, 63, 9, 68, 104, 77, -70, -90, 33, 56, 70, -18, -76, 86,
+    17, 32, -15, 45, -47, 0, 81, -46, -97, 24, -1, 84, 48, 39, 56, 10,
+    -102, -26, 85, 40, -52, -100, 31, -96, -21, 19, 36, -6, -10, -47, 4, -36,
+    -15, -31, -63, 96, 47, 111, 25, -118, 13, 11, -65, 46, -17, 94, -127, -44,
+    -17, 3, 33, 50, 62, 46, -23, -72, -48, 96, -81, -69, 99, 11, 64, -81,
+    -31, -14, -7, 34, 40, 102, -15, 43, 127, 89, 22, -10, -23, 50, -32, -47,
+    49, -10, -58, -67, 33, 11, 72, -55, 110, 32, -43, 73, -12, -59, -110, -5,
+    37, -113, -41, -100, -84, -5, 17, -79, 97, -7, 36, 84, -126, 101, -65, -108,
+    -70, 46, 41, -53, 47, -63, -45, 23, -20, 52, -111, -6, 101, -5, -89, -57,
+    -60, 21, 80, -53, -10, 86, -75, 95, 38, 72, -84, -59, -92, 75, 49, 41,
+    -91, -60, -9, 101, -56, -39, -83, 13, 32, 43, -54, -73, 20, -88, -21, 10,
+    -18, -104, 65, -45, -72, -104, 22, -93, -85, 57, -59, -75, 49, 89, -50, -11,
+    -70, 32, 76, -74, -111, -28, 81, 50, 65, -61, -49, 112, 50, -32, 40, -36,
+    0, -90, 78, 87, 2, 58, -55, -6, 83, -35, -28, -90, 52, -21, -26, -72,
+    49, 101, -112, -34, 52, 69, 17, -77, 114, -91, 56, 38, -18, 88, 82, 43,
+    54, 65, -1, 16, 88, 100, 116, -86, -8, -87, 49, -41, -44, 35, -2, -83,
+    -61, 117, 14, 38, -61, -21, 3, -43, 28, 7, 74, 32, 74, 24, 6, -6,
+    61, 74, -74, 68, 48, -54, -36, -66, -77, 86, 4, 92, -36, 8, 11, 40,
+    60, 72, -73, -5, -100, -58, 46, -21, -56, 74, -76, 13, 20, 116, -47, -96,
+    -79, 99, 74, -69, 14, -57, -60, -28, -33, -1, -13, -42, 83, -109, 54, 55,
+    19, 29, 55, 23, 25, -41, 46, 18, -23, -21, 80, 74, 0, 47, -73, -41,
+    -32, -81, -34, -7, 20, -63, -47, 59, -44, -58, 49, 20, -47, 53, -44, -36,
+    4, -23, -68, 101, 64, 65, 46, -127, -94, -74, -51, -56, 81, 90, -19, -97,
+    68, -58, -107, 8, -83, -57, 85, 56, -48, -78, -61, -35, -97, -73, 52, -58,
+    -12, 101, -93, 4, -58, -51, 36, 67, 83, 27, -62, 75, 114, 94, 108, -14,
+    -8, -69, -45, 32, -49, 104, 62, -60, -15, 84, -5, 105, -1, 28, 124, 9,
+    -61, 20, 51, -58, -63, -5, 7, -27, 12, -73, 70, -48, 1, 20, 90, -25,
+    84, 24, -64, 45, 44, 47, -14, -37, -64, 85, -72, 57, 75, 88, -30, 60,
+    -62, -23, 68, 78, -13, -75, 99, 98, -54, -73, -38, 58, 18, 18, 109, 29,
+    -22, -39, 34, 53, -26, -29, -65, 90, 3, 82, -5, 45, -67, 73, -16, -8,
+    58, 118, -101, 3, 43, -90, 3, -29, -59, 75, -75, 59, 25, 107, -22, -82,
+    -74, 11, -127, -108, 3, -15, 44, 51, 66, -91, 88, -67, 73, 31, 22, -80,
+    34, -81, -14, 25, -90, -58, -19, -47, -63, -12, 120, 14, 56, 127, -2, -35,
+    105, 72, -79, -93, -67, -56, -26, -78, 21, 33, 76, 43, -72, 57, 49, -105,
+    -38, -72, -121, -53, 74, 72, -20, -1, 93, -29, -31, 79, 85, 52, 54, 45,
+    -105, -66, -21, 20, -18, -108, 80, 75, -32, 14, 81, 56, -37, 51, 20, 77,
+    27, 32, -44, 34, -69, -14, 25, -15, 5, -75, -100, -42, -60, 26, 32, 62,
+    -27, 82, -70, -55, -33, 98, 1, -3, 29, 54, -89, -54, -21, 101, -65, 20,
+    -72, -70, 56, 95, 52, -41, 71, 24, -100, 102, -40, 55, -16, -47, 100, 42,
+    8, 16, -53, -61, 81, -23, 41, 73, -56, 35, 73, 33, 77, 70, 69, 60,
+    55, 50, -70, 68, -54, 30, -6, 84, 82, -74, -107, 87, -89, 100, 5, 80,
+    42, -4, -102, -36, -86, 73, 88, -114, 87, -79, 114, 7, 103, -12, -20, -73,
+    -65, 26, -22, 10, -39, 44, -76, -71, -50, 86, 43, 55, -44, 91, 54, -9,
+    66, -112, -15, 81, -79, 70, 106, -124, 45, 71, 12, 41, -14, -74, -54, -99,
+    59, 79, 50, -45, 77, -90, -20, -26, 39, 63, -55, -74, -28, 112, 36, 35,
+    -1, -16, -55, 127, -91, -26, -102, -5, 59, -45, 67, 45, -60, -6, -7, 83,
+    24, -84, 19, -52, -4, 20, 47, -111, 29, -24, -1, -58, -49, 51, -93, 72,
+    46, -52, -61, -12, 46, -73, -84, 31, 6, 58, 113, -7, 50, 88, -99, -23,
+    61, 86, -45, -109, -52, 67, 97, 33, -76, -46, -86, 80, 63, -70, -4, -8,
+    -18, -87, -101, 103, -80, 119, 79, 83, 45, 79, -40, 26, -91, -48, 41, -62,
+    -46, 51, 20, -2, 53, 41, -53, -52, 38, 22, 20, 34, 78, -2, -18, -44,
+    26, -48, -10, 46, -85, -3, -66, 4, 83, -42, 8, 92, -61, -114, 58, 94,
+    51, -29, 15, 62, 37, -16, 67, 66, 51, 76, -46, -26, 72, -48, -80, 12,
+    -37, 104, -101, -111, -106, 91, -108, 97, -25, -51, -51, -53, -85, 16, 86, -107,
+    -48, 114, -61, -118, -84, 66, 94, -29, -17, 48, -123, -19, 25, -75, -18, 9,
+    45, 61, -110, -84, 102, 25, -75, -60, 68, -91, -5, -101, -24, -58, -127, -70,
+    13, 7, -35, 38, 71, 39, 79, 58, 4, 40, 114, -86, 91, -100, -42, -83,
+    112, -81, 46, 72, 54, -29, 34, -15, -98, 47, -50, 113, -33, -20, -106, -85,
+    -20, 110, -69, 57, 49, -14, 84, -35, -51, -83, 20, -38, 46, 44, -35, 98,
+    35, -12, 24, -96, 105, -96, 84, -80, -16, -1, -47, -47, 109, -106, 64, 11,
+    47, -76, 16, -1, -55, 66, 49, 67, -80, 18, 58, 94, -71, 48, -87, 13,
+    2, 64, 52, 17, 59, -42, -87, -20, 47, 0, 63, 102, -31, 65, 101, 76,
+    -63, 94, 86, 26, 71, -30, -81, -61, -32, -37, 64, -42, 98, 59, 13, -27,
+    18, -69, 31, 37, -10, 86, -86, -37, 32, -58, -39, -16, 9, -44, 46, 73,
+    -19, 3, 71, -91, 26, -50, 34, -75, -21, 39, 68, 37, -2, -11, -103, 33,
+    -39, -77, 21, 40, -19, -72, 44, -53, 3, 52, -102, 75, -115, 72, 18, 9,
+    -49, -75, 62, 18, -29, 29, 77, 33, 22, -66, -1, 46, -50, -68, -25, -39,
+    -29, -5, -110, 22, -22, -54, 0, -54, 30, -14, 85, 19, -9, -57, -13, -15,
+    35, -60, -38, -5, 3, 13, -66, 60, -51, 3, -44, 62, -55, -9, -31, -40,
+    47, -4, -29, -16, -60, 35, -17, 114, 43, 60, -63, -11, 1, 100, 73, -96,
+    51, 71, 44, -54, -89, 75, 8, 127, -23, -92, -92, 41, 105, 63, -69, 68,
+    91, 30, -63, -19, -79, -54, 60, 15, -16, -16, 85, -47, 33, -60, -58, -1,
+    93, -27, 44, 66, 49, -57, -20, 104, 70, -30, 4, -94, 56, 31, -52, 98,
+    -79, -95, -50, -37, -42, 51, -54, -54, -51, 95, 56, 79, 19, -98, 84, -42,
+    -75, 42, -35, 70, -51, 14, 38, -85, 101, 89, 66, 36, -84, -36, -67, 104,
+    -13, 7, -56, 57, 30, -58, 83, -21, -62, -31, 22, -20, -6, 54, -66, 73,
+    65, -41, 114, 57, -87, 70, -90, 14, 22, -30, 21, 61, -46, 28, -75, -4,
+    -53, 69, 38, 93, 30, 89, -77, 41, 75, -75, -37, 5, 62, 29, 65, -104,
+    109, 45, 52, 52, 33, -50, 50, 0, -20, 24, -9, -27, 69, -18, 10, -5,
+    91, 56, -97, 95, 9, -68, 106, -10, 49, 11, 9, 66, 50, 37, 24, -20,
+    -89, -105, 47, -54, -108, -93, 24, 71, -34, -36, 1, 57, 114, 77, -104, 88,
+    75, -68, 53, 18, -87, 78, -13, -16, 20, -50, -33, -68, -34, -127, -28, 75,
+    -58, 53, 20, 37, 41, -27, -22, -114, 14, 94, 30, 57, -96, 75, 7, -93,
+    -42, -81, 54, -59, -108, -56, 49, 100, 76, -10, 10, -8, -18, 75, 68, -34,
+    28, 39, -82, -51, -36, -74, 12, 17, -87, 58, -60, 48, 90, -39, 69, 10,
+    -75, -14, 57, -28, -18, 89, -58, -50, -12, 46, -9, 77, 22, -45, 86, 12,
+    -45, 4, -64, 7, 37, 6, 99, -92, 62, 73, -1, -85, 44, -45, -63, 56,
+    40, 58, 45, 13, 72, -41, -91, -45, 54, 7, 60, 72, -4, -61, -62, -54,
+    105, 67, 21, 39, -106, 60, -51, -88, 15, 76, 8, -93, -48, 87, 15, -73,
+    41, 22, 27, -92, -74, 51, 47, -99, -50, 1, -38, 86, 121, -47, -85, 84,
+    -49, -57, 84, -2, -87, -37, 69, 3, -69, -20, 50, 85, 16, -17, -40, -79,
+    -40, -77, 96, 81, -32, 17, 71, -12, -5, -90, 85, 75, 41, 70, 88, 68,
+    83, -97, 55, 127, -115, -15, -104, -89, 40, 16, -51, -85, 47, 23, -36, 87,
+    -14, -92, -57, 58, -42, -32, -59, 29, -30, -103, -8, 65, -3, -72, -50, -19,
+    -54, -86, 53, 15, -91, 83, 93, 42, -88, -30, -53, 24, 7, 56, 16, 95,
+    -80, 11, -86, 94, 31, -82, 86, 76, -57, -68, 31, 76, 28, 17, 104, -67,
+    105, 76, -26, -105, 127, -30, -30, -106, -102, 60, -50, -68, -88, 110, -105, -100,
+    -24, -21, 82, 66, -86, -57, -70, 91, 0, -81, -91, 10, -74, -13, -15, -102,
+    -14, 93, -21, -28, 75, -1, 63, 56, 27, -97, 105, 98, -41, -85, -14, 102,
+    33, 93, 39, -55, -74, -25, -45, -13, -82, 47, 29, -51, -2, 116, -101, 94,
+    106, 31, -49, 60, 110, 95, -34, 35, -115, 60, -126, 115, 89, -32, -110, 28,
+    16, -3, -86, 96, -76, 6, 19, -44, -16, 10, -35, -73, 96, 28, -101, 20,
+    -79, 42, 14, 80, 91, -44, 93, -83, 53, -43, -29, -16, 45, 18, 70, 12,
+    42, -16, -42, 7, -108, -68, 92, 46, 8, 82, -5, 85, -8, -77, -97, -56,
+    -10, 6, 89, 6, -46, 78, -14, 61, -29, 101, 117, -4, -86, 11, 5, -3,
+    -12, 35, 93, -13, -74, 13, 103, 41, -33, 66, 118, -62, -91, 27, -122, 82,
+    32, 83, 17, 22, -64, -70, -1, 21, 21, 70, -39, -97, -107, 104, 12, 37,
+    100, 105, 100, -77, 55, 100, 18, 86, 73, -63, -71, 102, -104, -77, 95, -44,
+    -62, -59, 95, 57, -62, -59, -22, -5, 65, -74, -12, 43, -92, -65, 78, -77,
+    -1, 30, 58, -4, 7, 6, 103, -68, -92, -99, -5, -41, -95, -56, 95, 9,
+    30, -77, -116, 31, -28, 53, 17, -87, -72, -7, -109, 79, -8, -41, -98, -18,
+    21, 71, -65, 83, 61, 0, 9, -90, 85, 81, -82, 89, -87, 60, 19, 9,
+    -52, 68, 9, -28, -90, -99, 93, 100, -11, -109, 88, -35, 22, 64, 34, -61,
+    -75, 80, 12, 20, 18, -54, 3, -67, 60, -84, 30, -3, 7, 95, -49, 36,
+    34, 47, 65, -85, -42, -4, -85, 35, -10, -82, -102, -88, 100, -41, 45, -26,
+    76, 79, -32, 81, 60, 24, -101, 29, 28, 17, -82, 100, 27, 42, 36, -80,
+    -15, 12, 21, -36, 37, 33, 54, -61, -30, -94, 9, -8, 57, 78, 32, -76,
+    -72, -38, 100, -52, 64, -23, 3, 27, 57, -63, -95, 51, 72, -79, 23, -35,
+    7, 111, -109, -102, -31, -59, 64, 49, 61, -89, 35, 85, 38, -16, 10, -26,
+    47, 42, -1, 4, -39, -22, -72, 18, -25, 13, 80, 74, -70, -70, 127, 40,
+    33, 25, -124, 51, -7, -20, -62, 39, 106, 13, -33, -60, 101, -6, -18, 31,
+    71, 92, 10, 42, 11, 100, 89, 40, 78, 8, 6, -26, 2, 89, 20, 120,
+    -57, 103, 109, 59, -6, -72, 93, 20, 18, -35, 98, -92, -16, -70, 69, 31,
+    44, 86, 97, 11, -117, -79, 46, -40, -59, 85, 64, 11, -77, 64, 62, -102,
+    -125, 23, -98, -57, 99, -18, 92, 65, -44, -65, -2, -32, 37, -7, -71, -17,
+    79, 6, -46, -28, 78, -4, 47, 127, 72, 46, 32, -43, 61, 2, 17, -16,
+    -19, 110, 88, -12, -68, 27, 65, -112, -55, -59, 48, 27, 47, -3, 125, -87,
+    -119, 43, 45, 30, 91, 10, 0, 1, 55, 73, 67, -6, -56, -75, 27, -81,
+    7, 60, -99, 10, -18, -68, 100, -37, 64, 8, -96, -20, -69, 51, -12, 45,
+    -25, 98, 32, -102, -93, 99, 109, -81, 83, -80, 82, -91, 97, 43, 60, -53,
+    10, -106, 8, 34, -58, -85, -46, -45, -22, 32, 29, -114, -105, -44, -55, 28,
+    -63, -55, 15, -57, -90, 78, -29, -104, -126, -58, 84, -115, 60, 104, -109, -28,
+    48, -99, -12, -95, -118, -74, 25, -75, 59, -93, 94, -94, -73, -69, 58, -4,
+    -64, 72, 114, 87, 46, -62, -73, 76, -61, -99, -95, -44, 106, -79, 84, 31,
+    91, -117, -98, -23, -23, -112, 20, 97, -73, 14, -97, 45, 87, -95, 10, -40,
+    -47, -29, 61, 86, 54, -17, -108, 60, 79, 82, 7, -25, -68, 49, 8, -104,
+    -30, 71, 20, 88, 112, -77, 21, -6, 59, -59, 77, -11, -30, 75, 22, 80,
+    -28, 81, 78, 112, -43, -122, 14, 10, 4, -121, 31, -80, 59, 109, 24, -86,
+    92, 33, 51, -98, -83, -112, -118, 9, -38, 18, -44, 4, -60, -39, 64, 126,
+    32, 67, -53, -59, 40, 67, 12, -56, -71, 54, -116, 83, 0, -61, 22, 95,
+    -27, -115, 58, -89, -47, -95, -108, -25, -58, 47, 68, -85, 74, -49, 60, 107,
+    -82, -36, -50, 104, 11, 59, -75, -75, -124, 99, -89, -51, 59, -32, -78, 127,
+    10, 94, -108, 23, -65, 14, -82, -84, -74, -75, -84, -93, -26, 59, -37, 74,
+    95, -57, -37, -81, -105, -95, 87, -126, 79, -61, 93, -20, 86, 55, 25, -43,
+    89, 64, -17, -86, 3, 29, -100, 67, 74, -26, 47, 1, -87, -45, -47, 9,
+    45, -77, 18, 38, 5, 46, -38, -107, 54, 44, 29, 45, 90, 32, 91, -50,
+    -102, -77, 21, 31, -28, 60, -6, -72, 55, 85, -59, 87, 68, -48, -21, -29,
+    44, 77, 97, -32, -82, 79, -70, 50, -100, 61, -75, 81, -31, 83, -2, -63,
+    3, -127, -84, -98, 108, 15, 88, -92, 24, 58, 28, 9, 9, 42, 4, 50,
+    -5, -47, 38, 57, -13, 86, -90, 89, 34, 28, -78, -18, 120, -79, 64, 87,
+    62, -58, 33, 30, 3, 60, -43, -89, 43, -43, -55, 39, 15, 17, -79, 24,
+    -7, -5, 54, 24, -36, 62, -87, -91, 64, 26, 10, 57, -116, 0, -46, 47,
+    -60, -23, 42, -23, 64, -1, 6, 98, -36, -108, -62, -33, -34, -4, 84, -79,
+    -38, -2, 21, -39, 29, 49, 57, 22, -1, 36, -47, 23, 124, -25, -70, -36,
+    32, -52, -3, 91, 104, 41, 46, -30, 45, -51, -51, -85, -42, -47, -100, 7,
+    99, 58, 99, 17, -56, 4, 97, -78, 17, -76, 70, 97, 89, -38, 65, -71,
+    45, 17, 12, 14, -107, 26, -65, -43, -36, -65, -18, 44, -106, 101, 51, 118,
+    84, -4, 67, 13, -40, -15, -27, -98, 21, -42, -3, 0, -45, 99, -100, -70,
+    -14, 81, 61, 110, -109, -90, 78, -79, -5, -52, 6, 72, 0, -39, -68, -20,
+    -64, 26, 86, 40, 21, 46, -84, 58, -36, 49, -42, -34, 85, -60, -65, 23,
+    -19, -70, -90, -74, 50, 2, -83, -110, -10, -44, -35, -97, 96, 5, 64, -18,
+    15, -10, -36, 28, -56, -28, 32, 34, -127, -33, -48, 4, -65, -63, 79, -72,
+    56, -31, -22, 62, 76, -71, -56, -56, 62, 33, 64, -28, 74, 86, 24, 0,
+    58, -93, 13, -76, -8, 75, -66, -15, -86, 30, -116, -4, -18, -110, -26, -38,
+    36, -31, -81, -49, 81, -64, 43, -30, 28, -82, 54, 40, -70, -74, -70, -24,
+    37, 87, -109, 76, -40, 91, 37, 97, -80, 12, -64, -68, -90, 40, -100, -17,
+    93, -85, 17, 103, -114, 69, 113, -79, 27, 82, -26, 104, 16, -1, 104, -60,
+    -31, -15, 91, -34, -43, 53, -84, 11, 61, 49, 43, 75, 69, 39, -80, -65,
+};
+
+static const int32_t _L5_bias[64] = {
+    34303, 11315, 2102, 19498, -9827, 32555, -25061, -7207,
+    2112, -19927, 16979, 24393, -2229, -16883, -2224, 12516,
+    9028, 1824, 7342, -12217, -14486, 14267, -4779, 7127,
+    27752, -6236, 752, 13809, 9615, -25160, -10473, 23200,
+    23190, -2686, -16459, -1858, -32958, -13914, 6997, -1355,
+    -13839, 7113, 14514, 30866, -15503, -13768, -15196, 6346,
+    -12721, 7381, -756, -10933, -10090, -21923, 24362, 15795,
+    -24939, -9517, -5264, 804, -16091, -3218, -17342, 11491,
+};
+
+static const int32_t _L5_multiplier[64] = {
+    1959991574, 1265101392, 1479490734, 1219642023, 1102781844, 2030189877, 1953191123, 1286734805,
+    1432036454, 2085845870, 1267694689, 1862974139, 1284244752, 1106931018, 1148346202, 1231497769,
+    1760369732, 1727334195, 1307007354, 1292088108, 1497189563, 1170493087, 1314453823, 1422242453,
+    1244813257, 1619791204, 1094442473, 1930939249, 1780267090, 1686758922, 1458916560, 1123987571,
+    1909206210, 1300935590, 1258445581, 1247508549, 1240075422, 1765504578, 1154071828, 1335801571,
+    1128659569, 1132397766, 1247014279, 2032927439, 1334218511, 1407435552, 1366537207, 1935063361,
+    1172570916, 2097807602, 1255987698, 1966904994, 1815123720, 1309124211, 2024243176, 1167884703,
+    1800863833, 2058192065, 1337186999, 1437775297, 1278318500, 1328632039, 1244694552, 1932803111,
+};
+
+static const int8_t _L5_shift[64] = {
+    -9, -8, -8, -8, -8, -9, -9, -8, -8, -9, -8, -9, -8, -8, -8, -8,
+    -9, -9, -8, -8, -8, -8, -8, -8, -8, -9, -8, -9, -9, -9, -8, -8,
+    -9, -8, -8, -8, -8, -9, -8, -8, -8, -8, -8, -9, -8, -8, -8, -9,
+    -8, -9, -8, -9, -9, -8, -9, -8, -9, -9, -8, -8, -8, -8, -8, -9,
+};
+
+// Layer 6: QUANT_LAYER_MAX_POOL, [12, 64] to [6, 64]
+// Layer 7: QUANT_LAYER_LSTM, [6, 64] to [6, 64]
+static const int8_t _L7_weights[16384] = {
+    43, -28, 70, -24, 67, 127, 46, 38, 6, -97, -92, 103, 13, 5, 90, -8,
+    50, 63, 51, 0, -50, -99, 20, 93, 74, -87, -27, 71, -17, 9, 45, -30,
+    -57, 68, -63, 18, 9, -26, -26, -62, -106, 68, 47, -8, -79, -103, 35, 57,
+    26, 68, 54, 36, -26, -97, -88, 5, 45, 71, -100, 17, -52, -55, -45, -29,
+    27, 23, 77, 100, -1, -88, -61, 68, -72, -63, 40, 63, 102, 121, -51, -7,
+    66, -90, -16, -49, -52, 117, -104, 108, 100, 96, 36, 102, 127, 33, 105, 115,
+    18, -7, 42, 47, 113, 110, -101, -106, -42, -1, 22, 98, 13, 98, 26, 116,
+    -55, -54, 80, -77, 23, -28, 84, 122, -37, -114, 8, -11, 86, -15, -103, -68,
+    -33, -37, 98, 46, 62, -45, 35, 84, 71, 15, -63, 96, 75, 47, 55, 57,
+    49, 40, 38, -24, 66, 95, 21, 26, -34, 30, 12, 109, 75, 47, 41, 83,
+    104, 13, 108, 12, 78, 106, -10, 116, 51, 110, 50, 62, 67, 32, 81, -3,
+    -76, -26, 108, 54, 114, -29, -59, 72, -31, 9, 13, -7, 105, 127, 7, -57,
+    -14, 60, -64, 55, 75, 71, -77, 35, 23, -77, -22, -39, 68, 63, -5, -65,
+    79, 49, 28, 79, -25, 109, 70, -91, -21, -56, 80, 44, 5, 41, -98, 38,
+    -92, -86, 41, -14, 127, -22, -5, -23, 116, 107, 34, 26, 80, -48, -105, 101,
+    104, -80, 72, -50, 39, -16, 3, 52, 21, -77, 125, 57, 58, 73, 94, -71,
+    -18, -20, 24, -14, 44, -3, 116, 120, -31, 91, 39, -61, -69, 27, -84, 68,
+    -57, 120, -50, 74, -19, 35, -43, 70, 24, 94, 127, -4, -82, 2, 1, 75,
+    -24, 11, 71, -38, 69, -72, -46, 103, 20, -55, -11, 11, 94, 23, -10, 123,
+    -71, 55, -34, 117, -58, 30, 54, 49, 43, -26, 82, -2, 42, -41, 68, -56,
+    79, -52, 115, 110, 22, 14, 76, 20, 6, 50, -48, -36, -21, -7, 56, 8,
+    33, 88, 90, 28, -77, 44, 17, 28, -23, 12, 2, 56, 69, -69, 53, 109,
+    92, 55, -18, 87, 45, -64, 0, 79, 15, 79, -59, 75, 44, -52, 9, -51,
+    -14, 34, -40, 127, 73, 54, -49, 15, -50, 94, 49, -44, 92, 85, -15, -41,
+    79, 106, 63, 107, 61, -31, 58, 83, 44, -16, 16, -27, 0, 39, -13, -58,
+    -49, 37, 45, -31, 84, 58, 81, -13, 3, 0, -39, -81, -35, 90, 31, 3,
+    10, -60, 103, -32, -12, -71, 127, 13, -38, 41, 56, -33, 72, 56, -42, 47,
+    -2, 69, 30, 30, 52, 99, -70, -17, -3, 59, -54, -78, 44, -75, 75, 7,
+    -41, 18, 19, -13, -10, -26, 87, 28, 88, -55, 59, 22, 115, 54, 90, -4,
+    86, -1, -54, 44, 64, 74, -15, 15, 71, -52, -32, -27, 50, 58, 85, -34,
+    115, -48, -18, 29, 13, -9, 74, 11, 83, 100, 7, 64, -27, 127, 40, 29,
+    -29, 118, -34, 100, 65, 66, -3, 96, 32, 13, 63, -23, 44, 80, -27, 51,
+    26, 75, -55, 101, -92, 57, -104, -65, -12, -28, -16, -2, -64, -8, -50, 127,
+    -1, 86, 16, -39, -56, 86, 41, -52, 55, -82, -85, 4, 58, 25, 84, -68,
+    38, -41, -17, 2, -21, 108, -7, -88, 41, 117, 58, 101, 38, -2, -95, -2,
+    -63, 80, -75, -2, -76, -79, -9, 80, 76, 123, -34, 73, 9, 4, 64, 60,
+    21, -25, 57, 80, 45, -5, -25, -70, 71, -3, -20, -28, 1, -51, 56, 1,
+    75, 127, -77, -69, -92, -50, 20, -25, -47, 48, 17, -7, 67, -50, 102, 123,
+    -49, 34, -77, -42, 15, 21, -9, 61, 10, 62, 122, -35, -83, -89, 78, 111,
+    -23, -51, -11, 50, 22, 83, 122, 2, -55, 40, -52, 30, -68, 89, 38, 47,
+    16, 68, 48, 78, 21, 42, 31, -30, -51, 100, 40, 52, 7, 68, 83, -53,
+    8, 127, -5, 38, 116, 55, 77, 17, -25, -66, 17, -6, 30, 42, 73, -29,
+    62, 5, 26, -6, -45, 51, 96, 86, 7, 74, -62, 31, 51, -37, 122, 96,
+    31, 31, 81, 17, -41, 0, 53, 111, -48, 51, 72, 80, 7, -49, 92, 102,
+    14, 87, 56, 14, -59, 71, -14, 27, -92, -30, 33, -9, -77, 114, -48, -50,
+    83, 12, 45, -14, 6, 64, -106, 127, -68, -94, -32, 12, 2, 39, -61, -8,
+    -92, 94, 86, 28, -100, -66, 29, -63, 59, -22, -46, -116, -61, -53, 79, 82,
+    -94, 102, -64, -91, 102, 36, -82, -72, 34, -121, -109, -37, -45, 82, -60, 104,
+    -52, 28, 8, -32, -65, 10, 64, 12, 25, 73, 123, -51, 108, -24, -56, -2,
+    71, 91, -43, -73, 59, 10, 96, 100, 106, 92, 110, 44, -10, 27, -3, 127,
+    -53, -15, -55, -31, 31, -68, -28, 18, -60, -40, -69, 19, -10, 112, 8, 21,
+    -10, -9, 113, -61, 18, 127, -71, 43, 56, 114, 34, 89, 20, -42, -27, 19,
+    38, 2, -25, -22, -5, -19, -24, 121, -61, -3, -26, -23, -18, 14, -43, 84,
+    -64, 28, 89, -17, 94, 80, 92, -17, 108, -66, -21, 30, 44, -46, 32, 98,
+    45, -27, 52, 81, -38, -48, 0, -40, 3, -49, 72, -21, 5, 58, 79, -56,
+    127, 39, -49, 69, 14, -45, -32, 85, 60, 93, 95, 43, 39, 115, 52, 93,
+    123, 113, 96, 67, 62, -57, 4, -64, 50, 48, 0, 63, -63, -31, -23, -4,
+    92, -44, -13, 38, -8, -25, -11, -3, 6, -46, -39, 1, -74, 28, -71, 21,
+    -80, -41, 106, 20, 18, 72, 72, 117, 86, 77, 92, -73, 34, 4, 80, 112,
+    11, -74, 81, 86, 31, 2, -68, 51, 57, 104, 67, 69, 14, 66, 127, 80,
+    -75, 47, -48, 24, -16, -75, 106, 88, 12, -67, 100, -64, 119, -82, 78, 87,
+    114, 56, 101, 85, 9, 39, -59, 18, 96, 62, 56, -67, -49, 38, 61, -67,
+    86, -70, 33, 19, 122, 4, 85, 94, 42, 35, -50, 10, 41, 62, 19, 47,
+    127, 61, -58, 34, -12, 117, 17, 105, 42, 20, 6, -39, -74, -53, 57, 117,
+    50, -13, 31, 93, -65, 50, 53, 82, -47, -61, 30, 116, -26, 62, -41, -22,
+    83, -39, 60, -8, 127, 4, 22, -21, 106, -23, -23, 38, -29, -73, -19, 106,
+    21, -45, -14, 111, -57, 24, -11, 122, 18, -18, -8, 73, -54, -51, 103, -71,
+    30, 35, -70, -43, 22, 90, -20, -21, -72, -4, 96, 90, -24, -55, -7, 98,
+    -24, -15, -34, 99, 114, -70, 79, -58, -26, -48, -42, -79, 35, -28, 30, -11,
+    109, -55, 35, -3, -7, -56, 37, 52, 15, 81, 127, 12, 69, 88, -50, 23,
+    25, 65, -10, -13, -66, 55, 5, -38, 15, -90, 34, 54, -25, 102, 119, 16,
+    35, -9, 46, -8, 101, -50, 37, 48, 63, 93, -91, 15, 15, 117, -20, -28,
+    27, 85, 38, -68, 45, 54, 107, 85, 54, -43, 40, -13, 44, 54, 119, 100,
+    56, -24, -43, 127, -6, 88, 0, 123, 14, -55, 88, -78, 62, -42, -24, 72,
+    -70, 94, -30, -48, 105, 102, 15, 110, -40, -23, -65, -44, 71, 8, 38, 100,
+    117, 73, -9, 81, -6, 117, 111, 3, 88, 15, 107, 93, 91, 19, 103, -71,
+    31, -54, 68, -23, 75, -2, 24, 96, 27, 104, 53, -3, -46, 15, -51, 32,
+    -19, 84, 26, -43, 11, 31, 8, -45, 37, -7, 116, 12, 17, 32, 78, 98,
+    -54, -7, -13, 127, -76, 42, -41, 46, 78, -19, 34, -63, -41, -46, 105, 63,
+    89, 8, -33, -43, -50, 52, -25, -42, 11, 27, -40, 63, -72, -2, 52, 37,
+    41, 6, -45, -6, 92, 124, -46, 9, -5, 24, 69, 10, 43, -12, -40, 74,
+    -33, -58, 103, 15, 109, 58, -45, 17, 5, 47, -31, 3, -15, -65, 41, -4,
+    -1, -18, -9, 127, 81, -49, 120, 63, -24, -10, 8, 63, -24, -38, 10, -44,
+    -22, 117, 43, 97, -42, 23, 27, -63, 38, 59, 55, 46, -27, 44, -4, 82,
+    77, 87, 7, 2, 95, 70, -1, 117, 104, -40, 127, -65, 51, 110, 12, -2,
+    66, 64, 83, -39, -64, 13, 49, -16, -40, -80, 67, -9, -25, -36, -4, 86,
+    -58, 62, 90, 116, 121, -56, -74, 109, 12, 70, 24, 71, 18, 81, 93, -36,
+    -20, 55, 83, -87, -72, -20, 51, 115, -60, 47, 47, -43, -72, 58, -69, 81,
+    -53, -51, 94, -25, -77, 56, 45, -13, -54, 34, 84, -53, 78, 89, 79, -27,
+    31, -15, 120, 7, -1, 48, -50, -51, 74, 13, 18, -35, 63, 97, -29, -2,
+    119, -43, 61, 89, 73, 39, 26, 50, 76, 115, 112, -53, 127, 49, 30, -52,
+    -70, 80, 14, 81, 64, 62, 83, 73, -40, -10, 49, -31, 97, 118, 64, 101,
+    -38, -4, -53, 27, -32, -7, 34, -31, -38, 102, 127, -38, 98, -42, -70, -6,
+    42, 126, 23, -13, 58, 84, 15, 78, -19, -53, 40, -73, 23, 61, 48, 94,
+    -22, 105, 19, 107, 76, -56, -7, 8, 115, -25, 66, -18, 51, -55, -50, 33,
+    -44, -30, 6, 127, 57, 6, 45, 36, 23, 5, -57, 9, -36, -34, -23, 6,
+    79, -60, 98, 21, 99, 46, 89, 49, -9, 2, -17, -79, 74, 88, 15, 23,
+    37, 61, -44, 100, -60, 77, 27, 63, 8, -6, 104, 127, -86, -49, -77, 28,
+    -14, 65, 41, 91, -38, -81, -51, 63, -7, 91, -85, 34, 46, 3, 65, -97,
+    91, 36, 47, 104, -14, 12, -4, 95, -19, -46, -26, -70, -72, -37, 3, 107,
+    13, -41, -16, 46, -18, 104, -25, -60, -53, -42, 42, 42, 87, 125, -9, -48,
+    22, -24, 32, -50, -56, -63, -7, 23, 92, 82, 96, 75, 62, 41, 7, -6,
+    113, 93, 17, 75, 16, 17, 17, 2, 59, 54, 89, 58, -54, 95, 78, 1,
+    47, 11, 108, 67, -1, -42, -15, -47, 11, 12, -39, 97, 97, 41, 127, 19,
+    16, -37, -6, 42, 113, 17, 127, -103, 76, 77, -24, 25, 18, 123, 39, 15,
+    -33, -71, -3, 61, 95, 102, 54, 97, -30, -58, -84, 94, 68, 54, 79, -7,
+    -106, -19, 13, -15, -80, 86, 0, -90, -6, 77, 96, -84, -98, -101, 13, -42,
+    -43, -14, 0, -3, 56, 39, 59, 38, 41, -36, 109, 9, 30, -19, 90, 46,
+    -56, 70, -81, -56, 106, 73, 89, 13, 67, -67, -83, -72, 57, -18, 61, 38,
+    38, 62, -40, 69, -21, 86, 56, 74, 17, -32, 84, -60, 41, 85, -32, 109,
+    35, -30, 6, 0, 92, -5, 59, 21, -42, 110, -7, -46, 40, 25, -33, 127,
+    -50, -51, -8, 36, -37, -38, 32, 17, 47, 12, -66, -15, 77, -17, 93, 64,
+    -40, 98, 62, 76, -4, -89, -21, 59, 56, -69, 4, -46, 14, 101, 87, 79,
+    -22, 87, -31, 75, -38, -50, 58, -16, -74, -23, -21, 79, 91, 12, -63, 18,
+    19, -9, 105, 11, -22, 105, -51, 66, -7, -10, 10, -70, 21, 22, -25, 56,
+    31, 59, 58, -38, 34, 127, 46, 71, 115, 92, 51, 113, -1, 12, 78, 69,
+    -84, 73, 81, 115, 58, -22, 8, 96, -35, 93, 81, -61, 85, -73, -19, 92,
+    88, -58, 93, -53, -64, -69, -96, 105, 50, -16, -58, 38, -32, -88, 41, 61,
+    -46, -82, 103, -45, -87, 64, 76, 94, 79, 103, -1, 98, 31, -60, 115, -65,
+    33, -50, -29, 97, -18, -49, 50, 86, 114, 99, 79, -45, 15, 127, -85, 108,
+    25, 52, -34, -41, -31, 95, -54, -69, 64, -66, 116, -13, 100, 55, 104, -19,
+    114, 94, -45, 32, 70, 69, 1, -83, 89, 92, 104, -81, 39, -16, 73, -14,
+    -79, 28, 123, 83, 64, 119, -5, -6, 100, -68, 75, -16, 127, -20, 107, 67,
+    10, 119, 36, -45, 98, -7, -82, 87, 88, 4, 87, -84, -8, 120, 95, 1,
+    -18, 38, -51, 90, 92, 96, 16, 84, 74, -38, 44, 24, 63, -52, 66, 108,
+    -40, 47, 38, -54, 28, 85, 8, -73, 43, -43, 104, 68, 22, -39, -8, -38,
+    -27, 24, 65, 15, 73, -48, 47, -8, 32, 79, -65, 72, 28, 127, 58, 120,
+    39, 76, 95, 47, 60, 11, -45, 95, 90, -24, 48, -65, -31, 15, -51, -57,
+    -58, 36, -8, 7, 50, 101, -41, 92, 95, -29, -22, 100, -20, -60, -38, 34,
+    -59, -45, -29, -50, 114, 125, 78, 79, 111, 39, 48, 127, -28, 115, -15, -39,
+    114, -52, -2, 2, 50, 19, 70, 34, -59, 44, 83, 40, -58, 1, 43, 44,
+    100, 51, -50, 60, -4, -38, 88, -47, 33, 81, 19, 68, 11, 72, 13, 124,
+    63, 53, -28, 98, 53, -21, 50, 42, -24, 78, 32, -18, 39, 78, -24, 110,
+    16, -64, 19, -84, 70, -51, 12, 48, 10, -9, -65, -26, -53, 72, 104, 1,
+    61, 17, 127, -89, 127, 67, -88, 10, 42, -4, -91, -94, -27, -76, -69, 55,
+    -11, -94, -47, -2, 74, 41, 96, -9, 79, 59, 110, -65, 58, 46, -55, -31,
+    2, 2, 97, 62, 4, 41, -6, 46, 34, 73, -33, 80, -27, 1, 48, 90,
+    127, 1, 55, 85, 100, 78, 111, -80, -8, -75, 55, -28, 101, -65, -97, -54,
+    15, 96, 68, 108, -48, -36, 27, -20, -7, -59, -22, 101, -46, -75, 22, -66,
+    23, -46, -45, 32, 101, 101, 110, -78, -25, 49, -75, 41, -20, 51, -81, 78,
+    35, -30, 104, -6, -7, 39, -48, 10, 74, -36, -78, 108, -13, 7, 44, 54,
+    127, 26, 40, 88, 68, -65, -24, -27, -72, 66, -6, -51, 75, -27, -49, 79,
+    63, 85, 82, 16, -56, -75, -1, -51, -77, 1, -32, 22, -72, -16, -58, 26,
+    -55, -8, 9, -20, 15, -6, 95, 86, -43, -4, -65, -60, 1, 38, 58, 99,
+    40, 67, 45, 50, 66, 89, 46, 29, -62, 94, 41, 127, 14, -47, -73, 87,
+    96, -23, -56, 118, 10, 82, -29, -82, 22, 25, -60, 120, 32, 118, 68, 7,
+    31, 85, 49, -70, 16, -53, 123, 44, 67, 22, -75, -18, -23, 26, -85, 52,
+    91, 14, -28, 4, 114, 25, -62, -55, -8, 80, 59, -25, -63, -91, 29, 77,
+    -56, 89, -53, 65, -75, 84, -93, -73, 110, 98, 3, 44, 75, -25, 0, 21,
+    117, 89, -74, -34, 66, 77, 40, -58, 46, 48, 91, -82, 9, -76, 22, -68,
+    -49, -87, -69, 44, -22, -79, 102, 34, -15, -79, -6, 79, -65, 127, 45, -34,
+    -2, 11, -19, 75, 70, 23, 37, 90, 36, 52, 9, 121, -98, 51, 29, 26,
+    68, 50, 74, 81, 54, -52, 99, 127, -7, 18, -74, 16, 111, 68, 91, -70,
+    -36, -44, -33, 42, 87, 13, 16, 9, -27, 65, -21, -66, 56, 106, 19, 123,
+    -86, -55, -24, 87, -47, -10, 106, -78, -7, -3, 96, 101, 83, -59, -59, 56,
+    94, 52, 109, 0, -98, 26, -96, -59, -108, -31, -70, 14, 56, -51, -47, -49,
+    68, 95, -3, -59, 112, 29, 37, -15, -27, -21, 82, 88, 35, -4, -52, 123,
+    -34, 83, -11, 94, 82, -7, -35, -57, 58, -53, 87, 85, -46, 90, 78, -25,
+    103, -40, 43, -13, -22, 14, -27, 18, -45, -50, 6, 84, 94, 127, 105, -30,
+    27, -48, -46, 50, -44, 78, -70, -62, -44, 86, 89, -75, 70, 42, 30, -50,
+    -47, 102, -8, 0, -1, 20, -33, 6, -39, -53, 61, -51, 69, 127, -7, -56,
+    42, -53, 58, 11, 59, 62, 53, 7, 34, 26, -66, -34, 10, 107, -18, -46,
+    51, -21, -65, 82, 66, 50, -41, -62, -43, 5, 57, 7, -6, 6, -57, -28,
+    93, 61, 36, 66, -71, 24, 85, 32, 20, 41, 88, 89, -28, -32, 127, 68,
+    -43, 2, 43, 4, 81, 66, -54, 118, 76, -30, 113, -64, 68, 30, -63, -45,
+    -25, 117, 78, -32, 87, -56, 68, -21, 119, -18, 60, 36, 61, 83, 3, -60,
+    127, 90, -1, 50, 42, 30, -58, 36, -46, 110, 39, 14, -37, 42, 78, 68,
+    14, -5, 82, 121, 47, -23, 74, -38, 64, 66, 112, 40, 88, 94, -13, -49,
+    83, 77, -13, 106, 37, 73, 61, -24, 125, -27, -45, 118, 112, 85, 48, -8,
+    42, -54, 48, -31, -11, -14, 30, -57, -51, 60, 83, 104, -15, 74, -69, 60,
+    63, 83, 82, 58, 127, 73, 91, 115, 90, -41, -41, 79, 68, 61, 23, 62,
+    54, -3, 83, 33, 88, 43, 22, -27, 91, 45, 62, -12, 23, 6, -13, 67,
+    95, 35, 80, -95, 127, 82, -24, 43, -72, -14, 36, -101, -44, 87, -11, -53,
+    -88, 98, -16, 68, -40, 107, 60, -33, 74, 58, 110, 38, -17, 15, -54, 29,
+    -83, 75, 93, -1, -37, 45, -45, -42, 14, -40, 20, 13, -19, 77, 1, -49,
+    46, 23, 36, -86, 0, 14, 0, -36, -20, -77, -27, 27, 22, -10, 12, -96,
+    -26, -15, 49, 38, -26, 22, -44, -103, 35, -106, 127, 90, -54, 25, 60, -23,
+    73, 102, 76, 52, -45, 27, -37, -1, -15, 25, 124, 114, -70, -89, -94, 33,
+    121, -4, 39, 53, 75, -32, 41, -4, -55, -13, 112, -9, -17, -92, -81, -17,
+    113, 28, -63, 72, 5, 59, 47, 116, -53, 33, -104, -2, 6, -49, -125, -17,
+    -66, 126, 107, 113, -45, 85, 12, -36, -35, 83, -64, 116, 122, 107, 37, -29,
+    119, 126, 3, 61, 94, 85, 101, 51, 54, 15, 89, 21, -57, -65, 118, 95,
+    85, 127, -3, 63, -33, 20, -74, -32, 60, 10, 5, -5, -10, -41, 6, 73,
+    115, 47, 20, 41, 18, -41, -21, 90, 82, -47, -27, -47, -78, -45, -29, 20,
+    -1, -37, 51, 70, -75, 34, -54, 116, -67, 23, 75, 14, -31, -89, -17, 65,
+    26, 46, 94, 50, -83, 22, 80, 47, 28, -62, 117, 55, -43, -33, 5, -11,
+    111, 127, 59, 105, 83, 92, 108, 67, 104, 66, 37, 5, -74, 96, 16, 49,
+    -10, -45, -48, 99, 75, 4, -64, 25, 42, -56, 10, 61, 35, 104, 81, 6,
+    66, -53, -7, 63, -32, 90, 26, -54, 96, -47, 77, 125, 13, 45, 17, 35,
+    90, -9, 94, 38, -59, -2, -20, 96, 120, -44, -39, 108, 61, -53, -86, 98,
+    100, 95, 125, 58, 84, 37, 48, 127, 126, 41, 44, 8, 34, 7, 88, 37,
+    0, 33, 109, 95, -16, -17, 95, 93, 25, 71, 53, 23, 15, 89, 61, -23,
+    23, -49, 98, 93, 103, 66, -25, -33, -41, 3, 14, -38, 58, 117, -38, 114,
+    -8, -70, 50, -18, 100, -70, 60, 74, 59, 47, 97, -83, 116, 100, -12, -82,
+    96, -38, 117, -25, 45, -3, -51, -94, -15, -75, -72, 60, 15, 62, 52, -45,
+    -30, 69, 36, -13, 13, 127, -73, 12, 90, 111, 69, 8, -13, 111, 73, -70,
+    67, -25, 55, 61, 56, -58, -28, 32, 20, 0, 67, 127, -29, 67, -13, -105,
+    109, 56, 61, -108, 17, 87, -57, -9, 43, -81, -82, -37, -69, 30, -5, -69,
+    67, -22, 82, 5, 10, 4, 4, -55, -100, -110, -46, 31, 118, 5, -51, -61,
+    34, 16, -54, 109, -34, 3, 63, -84, -88, 4, 62, -11, 62, -10, 17, 6,
+    57, 109, -24, -55, 94, -75, -114, -28, 26, 58, -92, -100, 110, 84, -82, 78,
+    -53, -14, -73, 37, -57, -53, 0, 11, 83, 86, -127, 87, -3, 74, 48, -43,
+    -82, -44, -85, -84, 1, 38, 73, -7, -76, -45, -47, 19, -72, 16, 69, 39,
+    62, 31, -66, 69, -122, -77, 38, 9, 37, 83, 5, -105, -115, -8, -75, -55,
+    20, -62, -8, -26, -34, 61, 113, 105, 112, 66, 101, -68, 15, 102, -26, -33,
+    59, 14, 57, 54, 75, 34, -35, -2, 29, -84, 51, 40, 88, -65, 92, 127,
+    19, 111, 31, 35, 124, 44, 74, -31, -47, 81, -44, 108, 74, 16, 73, -49,
+    -36, 29, 117, -9, 41, 28, -66, 55, -52, -28, 48, 27, 4, 73, 114, -26,
+    -15, 25, 51, 111, 51, 31, -32, 16, 70, -91, -26, -36, 114, 46, 102, -1,
+    33, 126, 109, 71, 7, 121, 18, 40, 22, 108, -75, 66, 78, -7, 73, 127,
+    -86, 28, 21, 111, -1, -18, -3, -25, 40, 54, 54, -16, 32, -42, 40, 42,
+    97, -31, 2, 25, 37, -82, -45, 15, 98, 25, -10, 56, 67, 102, 30, 45,
+    -42, 49, 95, 125, 94, 3, 52, 74, 64, -22, -62, 99, 44, -46, 51, 125,
+    -18, 24, -2, -3, 36, -2, 107, -49, 97, -17, -40, 48, 7, 11, 2, -46,
+    16, 39, 103, 49, 62, 35, 11, 124, 127, 114, 25, -52, 11, -45, -68, 48,
+    -36, -11, -47, 64, 81, -35, -6, -10, 60, -39, 64, 56, 21, 107, 79, 22,
+    48, 77, 98, 24, -22, 4, -64, 84, 98, -78, -63, -67, 49, 122, 62, -23,
+    -73, -9, -81, 3, 98, 81, -53, -20, -35, 76, 101, 125, -67, 108, -6, -8,
+    -36, -46, 86, 9, 127, 7, -46, 58, -67, -28, 72, -40, 47, 119, 39, 17,
+    75, 106, 18, 28, -33, -41, -58, -27, 101, 114, -16, -70, 122, -44, -37, 71,
+    37, 86, 96, 9, 38, 51, -67, 49, -34, -55, -3, 60, 15, -76, 21, 72,
+    75, 23, -9, 26, -8, 49, 24, 20, -55, 76, 27, 93, 63, -75, -5, 51,
+    76, 58, -53, 127, 95, -52, 77, 1, -4, 60, 124, 102, 57, 111, 75, -95,
+    -22, -3, 16, 8, 78, 58, -44, 103, -53, -28, -36, -26, -49, 112, -42, 99,
+    -15, 125, -65, 10, 108, 39, -14, 127, -53, -47, -49, -77, 42, 91, -61, 9,
+    -13, 66, -47, 116, 78, 78, -63, -17, -92, 92, -57, -56, 4, 108, -82, -12,
+    -71, 115, 12, 65, 100, -57, 49, 38, -42, 84, 78, 24, 111, -23, 39, -67,
+    43, 31, -39, -74, 5, 99, -24, -42, -49, 108, 80, -28, 54, -83, -35, -82,
+    57, 59, 7, -48, 127, 81, 68, -50, -40, -57, -60, 76, 108, 5, 90, 25,
+    -81, 110, 108, 92, -9, -48, -33, 1, -7, 100, 41, 0, 100, 119, 47, 109,
+    -42, 28, 119, -23, 108, -39, 115, -84, 101, -38, -20, 89, 70, 67, 29, 122,
+    100, 20, -46, -54, 75, -52, 83, 99, 49, 55, -60, -17, 105, -19, 20, -77,
+    -19, 54, 125, 113, -78, -27, -80, 71, 4, -35, 33, 46, 51, 79, -58, -27,
+    117, -17, -36, 92, 39, 46, -68, -63, -17, 82, -6, 77, 0, -51, 104, 9,
+    -63, 110, 93, -14, -42, -9, 124, 3, -58, 60, 66, 78, 94, 75, -2, 107,
+    119, 69, 67, -36, -16, 1, -49, 95, 127, 48, -22, 52, 12, 3, 53, -46,
+    103, 30, -70, 37, 104, -29, -43, 9, -11, -65, 45, -8, -9, 127, -6, -37,
+    103, -21, 32, 3, 79, 120, 10, -34, -27, 35, 114, 21, -28, 6, -41, 21,
+    25, 3, 52, 27, -50, 11, -69, 43, 50, 100, 60, -21, 69, 2, 50, 56,
+    116, -15, 76, -30, 0, 96, 40, -69, 15, -19, 34, 97, -13, 13, 16, -19,
+    -85, -5, -41, -16, -23, 17, 18, 81, 81, 72, -50, 102, 86, 34, -43, 69,
+    -62, 69, -79, 26, -19, 57, -19, -16, 98, -4, -65, -73, 36, -26, -3, -34,
+    67, 77, -38, 52, -30, 24, 67, 114, 72, -39, -60, -46, 127, 66, -27, 15,
+    13, 83, -85, 75, 121, 6, 9, -59, -29, 94, -81, 22, -24, 48, 57, 39,
+    79, 15, 92, -43, -33, 114, -48, 35, -21, -4, 25, 93, -33, 110, 94, -55,
+    -69, -32, -7, 16, -67, -55, 110, 4, -38, -70, -34, 58, -63, 14, -57, 127,
+    -10, -43, 63, -61, -69, 71, 64, -6, 5, 82, 40, 55, 84, -20, -30, -54,
+    110, -20, 99, -8, 37, -43, -16, -56, 36, 32, 63, 41, 17, 28, 46, 8,
+    81, -39, 54, 63, 63, -54, 24, 8, 82, -36, -57, -30, -63, -28, -18, 113,
+    -1, 109, 31, 74, 18, 35, -5, 95, -54, -55, 81, -91, -47, 51, -96, 3,
+    61, 80, -7, -7, 18, 41, 36, 46, 114, 95, 38, 17, 93, 127, 56, 97,
+    -48, 122, 2, 68, -7, 95, 19, -40, -45, 7, 21, -65, -53, -77, 78, -39,
+    127, -19, -54, -28, -19, 38, 30, 33, 102, 32, -56, -13, 23, 57, -27, -64,
+    -61, -14, 121, -53, 63, -3, 79, 85, 51, 69, -50, 117, 31, 123, 100, 67,
+    123, -8, 95, 29, 101, 104, 25, 29, 99, 16, 58, 95, 80, -58, 38, -25,
+    -45, -29, 101, -84, 27, 87, 91, 0, -21, -52, -8, -17, 79, 23, 50, -43,
+    71, 59, 14, 53, 93, 31, 51, 19, -60, -82, -18, -62, -32, -91, -38, -51,
+    71, -83, -6, -39, -40, 37, -29, 127, -3, 5, -56, -52, 13, 59, 93, -56,
+    46, -50, -70, -101, 17, -79, -66, -106, -101, 9, -52, 91, -88, -74, -72, -13,
+    -11, -52, 59, 0, -28, -119, 98, -41, 25, 64, -40, 87, 69, 29, 48, 14,
+    -75, -114, 88, -87, 33, 42, -120, 55, 7, 55, 60, -84, 75, 117, 14, -2,
+    -106, -27, 127, -91, -83, -41, 44, -63, 77, -22, -11, -8, 113, -26, 35, 96,
+    -10, 3, 34, 101, -41, 23, -33, 90, -85, -23, -13, -94, 19, 48, -2, -20,
+    122, 116, -50, -67, -119, 76, 82, -78, -45, -53, 18, 46, -77, 28, -56, -104,
+    32, 88, 98, -22, 13, -66, 5, -41, -6, -102, 3, 15, -16, -4, 92, -60,
+    83, -75, -43, 52, -72, 18, 87, 98, 116, 31, 28, 4, 5, -73, 127, 56,
+    37, -63, 49, -17, -14, 26, -62, -29, 69, -44, 116, -6, -62, -77, -104, 46,
+    -11, 9, 54, 63, 32, -54, -37, 75, -35, -6, 12, 68, -95, 48, -40, 102,
+    35, 9, 4, -67, -82, -13, 116, 63, 127, 125, -94, -114, 43, -81, 123, 89,
+    -112, 115, -93, -16, -21, -73, 93, 103, 97, 98, 115, -91, -22, 117, 96, -18,
+    35, 10, -30, -103, -103, -26, -101, 72, -1, -56, -127, 122, -51, 15, 125, 88,
+    76, 48, 108, -110, 28, -79, -93, 3, 17, -84, -55, 50, 102, 35, -39, -50,
+    -50, 108, 13, 13, -40, 2, 25, -5, 57, -43, -21, -92, 33, -102, 42, 79,
+    35, 30, 127, -94, 54, -55, -5, 25, -35, 48, -3, 33, -85, 54, 113, -54,
+    15, 120, 70, 53, -33, 95, -50, -81, -71, -70, 89, 8, 21, 9, 42, 39,
+    71, -77, 101, 50, -67, -7, -2, 67, -20, -63, 81, -52, 89, 68, -51, 14,
+    -49, 85, 120, 55, 44, 127, 60, -23, -66, 113, 50, 45, 46, 71, 56, -25,
+    99, -45, 49, 68, 94, 35, 32, -83, -85, -51, -15, 85, -57, 23, -91, 72,
+    -69, -84, -51, 45, -9, 11, -10, -9, 105, -38, -18, 55, -74, -14, 46, -59,
+    -47, -25, 21, 86, -30, 93, 111, 21, -56, -45, 20, 111, 10, -5, -29, 58,
+    -27, 21, 0, 89, -90, 112, 34, -76, 106, 117, 49, -76, -30, 78, 64, 73,
+    73, -7, -99, 10, -11, 28, 98, 45, 17, 23, -45, 117, -30, -95, 101, 60,
+    39, 80, 68, 87, 46, 41, 89, 70, 22, 16, -54, 48, -110, 67, 90, 127,
+    24, 30, 62, 42, 68, 75, -11, -25, 69, 117, -100, -76, -3, 58, 49, 28,
+    61, 59, 33, 22, -2, -60, 102, 58, 14, -66, -1, 41, 127, -24, 36, 49,
+    -95, -1, -13, -79, -62, 75, -59, -47, -34, 84, 7, 87, -38, -56, 60, -52,
+    -16, 9, 112, 87, -17, -55, 57, -4, -66, -29, 76, -22, 13, 107, 103, -61,
+    -28, -32, 114, 77, 15, 96, -62, -33, 100, -7, 1, 81, 13, 101, -15, -1,
+    86, -113, -81, -96, 50, 88, -68, 25, -103, 9, -44, 37, -100, -38, -54, 82,
+    78, 102, -72, 33, -92, -22, -26, -13, -10, -71, -65, 44, 107, 92, -109, -60,
+    -72, -43, 2, -42, 92, -5, 13, -70, 88, 117, -64, 124, -100, 40, 88, -15,
+    -52, 65, -110, 0, -5, -82, 103, 52, -127, 113, -29, -29, -109, 102, 24, -59,
+    119, -23, -34, 60, -91, 86, 61, -26, 17, 40, -80, 80, -95, -17, -113, 98,
+    3, 95, -47, 55, 60, -43, 105, 77, 32, 64, 71, -17, -64, 12, -18, 103,
+    70, 55, -75, 16, -65, -64, -86, -13, -68, -93, 22, 116, -114, -17, 13, 94,
+    57, -77, 2, -108, -127, -28, -78, -51, -80, -4, -66, 101, -25, 1, -6, 76,
+    55, 112, -44, -55, -47, -38, 8, 2, -61, 11, 52, 9, 44, -5, -39, 53,
+    64, 31, 105, 0, -38, 39, 1, 1, 8, -27, 38, -63, -6, -56, 14, -34,
+    -13, 40, 87, 2, 85, 5, -71, 27, -20, 60, -12, 38, -61, 17, 127, 102,
+    -29, 34, 117, 48, 112, -30, 64, -24, 94, 54, -7, 91, -47, 80, 76, 4,
+    -50, -82, -22, -58, 100, -82, -16, -118, 74, 59, -20, 71, 33, -60, 18, -127,
+    -97, 52, 15, -32, 24, -57, -47, 28, -126, -5, -47, 66, 88, -110, -57, 16,
+    -34, -64, -47, -91, -99, 90, -27, 82, -120, 82, -39, -88, -36, -66, -42, -13,
+    8, 1, -14, -51, -29, 5, 69, -7, -68, 47, -61, 63, -72, 109, 99, 44,
+    115, -43, -36, -14, 44, 88, -60, -63, 58, 30, -44, 120, -75, -6, 66, -83,
+    -20, 112, 19, -9, 127, 102, -34, -39, 125, -31, -95, 58, 110, 87, -89, 110,
+    127, 38, -39, -94, 36, -44, 51, -89, -9, 78, 7, 67, -31, -56, -54, 39,
+    -23, 38, 106, 65, 34, 101, -57, -20, -91, -31, -84, 17, 50, -27, -98, 99,
+    -38, 12, -89, 94, 38, -7, -18, -33, -21, -31, 43, -44, -83, 36, -50, 18,
+    -14, 82, 89, 122, 21, 91, 17, -14, 97, 68, -85, -1, 13, 84, 77, 55,
+    -60, 95, 88, 9, -9, -72, 53, 50, -83, 62, 9, -53, 39, -40, 36, 54,
+    4, 20, 83, -52, -59, -9, 81, 108, 83, 98, 62, 127, 19, -1, 33, 111,
+    42, -16, 102, 37, -95, 115, 74, 47, 105, 74, -91, 114, 52, -127, 82, 102,
+    9, -32, -63, 114, -84, -1, -47, -70, 70, -67, 60, 110, -58, 113, -101, 66,
+    -5, -85, -84, 99, -61, -73, 62, -57, 45, -35, 107, -59, -60, -105, 4, 14,
+    12, -64, -60, 36, -63, -45, -102, -13, -6, -57, 56, 95, 115, 57, -38, 4,
+    19, -61, -60, 87, 51, 95, 76, 87, -20, 69, -91, -4, -71, 69, -84, -59,
+    127, -49, 19, 37, 7, -47, -88, 41, 74, 106, 8, -16, 70, 22, -27, 43,
+    -73, -81, 13, -53, 102, -39, 94, -120, -57, -77, -34, -44, -46, 45, -37, -49,
+    1, 15, -17, 72, 32, -69, -24, 22, 21, 57, 86, 5, 69, -52, 86, 67,
+    112, 56, -80, 80, -93, 127, 82, -74, 18, 117, -69, -71, 12, 49, 107, -56,
+    -5, 78, 64, -35, 84, 5, 59, -15, -68, 36, 1, -53, 24, 10, -70, 101,
+    -40, 87, 119, -96, -70, -92, 67, 84, -87, -20, -52, 76, 89, 74, -115, 113,
+    68, 78, 110, 117, 82, 71, -63, -70, 20, 9, 113, 64, 63, -77, -29, -61,
+    -50, -79, 5, 48, -9, -66, 92, 82, 84, -32, 85, -41, -7, -24, -79, 44,
+    -70, 13, -108, -62, -75, -21, 49, 68, 122, -56, -33, 96, -67, -33, 18, -6,
+    2, 95, -10, 56, -2, 117, 82, 64, -18, 13, 37, 98, 111, -21, 127, -46,
+    55, -34, 25, 58, 91, -17, -4, 18, 43, 21, -3, 38, -60, -72, -68, 21,
+    127, 16, 53, -76, -30, -74, 106, 42, 30, 107, -31, -26, 22, 41, 88, -74,
+    97, -1, 123, 47, 124, 91, -70, 60, 41, 87, -42, 82, 4, 6, 35, 9,
+    -11, -19, 67, -9, -73, 85, -78, -62, -26, 18, 21, -89, 24, -53, -85, -18,
+    -36, -88, -86, 19, 30, 65, 54, 71, 101, 57, 40, 123, -77, -39, 15, -72,
+    38, -120, -42, -20, -55, 49, 96, -51, 82, -47, -35, 43, -56, 77, -11, 74,
+    18, -67, -43, 93, 49, 14, 99, 66, -80, 42, -38, -25, 44, -70, 102, -38,
+    106, -28, -8, -27, 22, 23, -104, -18, -72, -70, 127, -18, 99, -6, 6, -20,
+    95, -29, 64, 119, -21, -38, 113, -72, -50, -2, -82, -56, -67, 60, -28, -19,
+    97, 127, -28, -1, 121, -18, -4, 68, -70, 59, -101, -36, -100, -112, -83, 109,
+    -11, 22, -8, -101, -93, -6, 4, -46, 105, -49, -103, -87, 78, -17, -65, 48,
+    81, -69, -15, -83, -28, 11, 44, 68, -95, -84, 16, 6, 15, 118, 66, 12,
+    -9, -16, 81, 52, 107, 52, 10, -63, -63, -65, -101, 122, 41, -33, -60, 102,
+    -51, 30, -74, -82, -22, -76, -14, -1, -81, -93, -84, 104, -45, 19, 108, -72,
+    -18, 108, 98, 62, 92, 52, -2, 104, -52, -9, -71, 10, -23, -82, -91, -67,
+    1, -4, 14, 105, 18, 3, 90, -24, 67, -77, 81, -37, 43, 112, 68, -41,
+    -50, -7, -49, 50, -50, 1, 34, 83, 65, 34, 127, -35, -50, 41, 76, 122,
+    61, 94, -74, -45, -102, 79, -78, -81, 47, 106, 27, 101, -6, -82, 110, 14,
+    -16, -36, 127, -63, -53, -27, -107, 33, -3, -95, 41, 18, 125, -102, 24, -81,
+    -59, -41, 51, -83, 2, -74, 83, -7, -82, 11, 70, 59, 103, 30, -110, -26,
+    28, -36, -101, 40, 108, 6, 96, -8, -88, 21, 23, -47, -43, 82, -16, 18,
+    127, 21, 32, -58, -10, 63, -49, -67, 38, 100, -3, -32, -7, 76, 8, -89,
+    58, 5, -6, 97, 79, -4, 64, -60, 32, -19, 119, 1, -7, 30, -36, 120,
+    78, -10, 103, -41, -33, -68, -10, 8, 7, 61, -36, 21, -34, 91, 27, 95,
+    98, -38, 14, -24, 43, 76, 39, 9, -42, -59, -35, -20, 46, 66, 42, -63,
+    38, -71, 113, 116, -107, -27, -12, 67, -30, -98, -9, -16, -103, 1, -60, -21,
+    -108, -60, -29, 124, 11, -26, 78, 93, 115, 54, -77, 18, -70, 53, 59, 111,
+    61, 96, -13, 90, 67, 10, -33, -94, 67, 60, 19, -60, 50, 112, -101, -10,
+    -70, 1, -54, -57, 80, -71, 15, -94, 2, -8, -58, 59, 45, 31, -127, 109,
+    -34, -55, -78, 73, -62, -61, 120, -42, 61, 29, 59, 4, 4, 56, 17, 65,
+    -42, 3, 76, 17, 84, 49, 7, 121, 32, 81, 120, 111, 96, -1, 8, 15,
+    -74, 41, -77, 68, -19, 43, 96, -46, 103, 74, -55, 120, -70, 28, 96, 51,
+    -12, -47, -24, -58, 114, 58, 24, 127, -17, 111, -22, 26, 42, 87, 41, 56,
+    127, 119, -16, -22, -107, 29, -82, -23, 29, -37, -17, 78, -106, -87, 110, -10,
+    87, 83, 21, 82, -69, 112, -100, -69, 19, -38, -48, 8, -48, 40, 23, 127,
+    -71, -49, -78, -85, -19, -40, -1, -65, -19, -25, 92, 110, 81, 44, -85, 110,
+    37, 3, -21, -68, 96, -50, 65, 45, -13, -4, -37, -50, 101, -115, -125, -60,
+    -18, -11, -104, -18, 9, -33, -29, -57, -70, 28, -66, -114, -74, 16, 35, 23,
+    87, -115, 30, -40, -64, 127, -13, 90, 88, 57, 81, 106, 33, -49, -78, -36,
+    -17, -43, -44, -51, 30, 123, -54, 59, -11, 124, 24, 78, -20, -40, -50, 84,
+    86, -76, 108, -123, 40, 44, -66, -35, -2, -100, 99, -39, 23, 27, -43, -91,
+    -15, 102, -79, 10, 55, 18, -84, -38, 10, 61, -77, -26, 83, 97, 110, -104,
+    -40, 27, 25, -4, -19, 14, -70, 66, 55, -29, -114, -47, 3, 4, 3, -80,
+    -5, 97, 115, -77, 96, 6, -117, -83, -64, 53, -86, 14, 65, 117, -65, 40,
+    -68, 50, 113, -43, 101, -45, -30, 34, 60, 14, 76, 127, 37, 2, 90, 53,
+    93, -73, -28, 5, -16, -52, -8, 75, 6, 50, 95, 38, 34, -62, -26, -6,
+    8, -13, -68, -61, -38, -45, 13, 45, 127, -18, 0, 104, 45, -50, 123, -8,
+    -2, 79, 74, -39, -94, -54, 105, -47, -102, -24, 11, 46, 22, -32, 103, -72,
+    -20, 23, 23, 56, -29, -90, 94, 5, 39, 37, -111, 80, -93, 124, 12, 47,
+    56, -22, 16, 96, -74, 16, -49, -91, -3, 104, -39, 127, 83, -108, -76, -33,
+    76, 21, 44, -32, 68, -56, -1, -6, 71, 8, 95, 11, 63, 30, -41, -97,
+    -45, 62, 29, -20, -34, 107, -53, 16, -19, -99, -39, -72, 118, -36, 31, 76,
+    118, -69, 19, 29, -51, 55, -27, 81, 10, 54, -44, -28, -72, -53, -16, -30,
+    51, -13, 127, 80, -37, 49, -10, 1, 93, 109, 83, 0, -88, -108, -40, 0,
+    -35, 1, 34, 32, 35, 6, 73, 66, -28, 26, 14, -20, -106, -88, 78, 118,
+    7, 17, 58, 34, 34, 53, 92, 25, 47, 92, -74, 92, -69, -30, -78, 108,
+    8, 95, 33, 5, -96, -26, 86, 9, 86, 102, 71, -28, 40, -28, 30, 27,
+    27, -25, 79, 30, -43, -44, -13, 125, -95, 70, 43, 48, 83, 97, 127, 48,
+    -36, 118, -11, -68, -29, 53, 126, 82, 12, 22, 66, 26, 83, 94, 63, 26,
+    -31, -36, 47, 93, -23, -16, -48, 103, -61, 78, 8, -18, 14, 54, 91, 19,
+    34, -63, 87, 45, 31, -7, -66, -44, 17, 10, 15, -64, 71, 86, 118, 109,
+    -57, -66, 17, 30, -23, 82, 68, 71, -79, 5, -81, 80, 31, 46, 95, 23,
+    54, 89, 64, 79, -85, -92, 63, 23, 98, 106, 78, -104, 92, 3, 127, -39,
+    -110, -14, -29, -65, 13, 47, 10, -2, -63, 0, -31, -6, -48, 47, 41, 23,
+    7, -52, -64, -35, -112, 56, -125, 48, -17, 25, -5, -50, 22, -3, 77, -75,
+    67, -75, -23, -78, 69, -38, -54, -6, -2, -79, -87, -11, 101, -55, -10, 113,
+    -54, 127, 38, 75, 92, 71, -18, 73, 34, -50, 96, 19, 32, 107, -96, -38,
+    -82, -24, 105, 64, 90, 114, 2, -68, 120, -12, 39, 21, 46, 28, -41, -70,
+    49, -64, 22, 85, 125, -64, -20, 7, 124, 75, -104, 41, 9, -81, -53, 38,
+    -28, -29, 23, 31, 104, -28, 97, 36, -24, -35, 108, 64, 100, 71, -41, 94,
+    -60, -23, -74, 127, -70, 100, -50, -10, 37, -28, -58, -78, -82, 101, 109, 12,
+    61, -48, 32, -37, -52, 49, 10, -4, 40, -78, -11, -23, -69, -72, -56, 115,
+    -7, -38, -56, -8, -82, 4, -59, 127, 118, 52, -46, 73, 82, -16, -51, -30,
+    -15, -17, 52, 14, 12, -32, 67, 86, -25, 98, 2, 55, -8, 42, -8, 97,
+    -42, -7, 4, -44, 7, 25, 116, 69, 115, -9, 84, 18, 97, 99, -41, 71,
+    29, -16, 36, 96, -50, -29, 80, 48, -19, 105, -79, 127, 20, 98, 72, 37,
+    -13, 13, 55, -32, 51, 38, -32, 15, 27, 79, -21, -14, 51, 36, 4, 68,
+    -37, -48, 98, 50, 30, 63, -45, -75, -73, 122, 90, 49, -63, -55, -41, -61,
+    -9, -77, -41, 48, 9, -39, 51, -25, 94, -115, 9, 111, -20, -34, 81, -43,
+    77, -46, -70, -38, -2, -66, 13, 19, -45, -83, 48, 24, 1, -46, -59, 51,
+    -55, -19, -68, -64, 68, -24, -5, 27, -88, -39, -16, 127, -50, 54, 64, -9,
+    -67, -40, 89, 27, 65, -36, -4, -58, -4, -70, -71, 42, -73, -29, 127, 31,
+    70, 73, -6, 46, 64, -22, 57, 82, -91, 118, 97, -35, -81, -36, -22, -12,
+    16, -25, 120, -12, -107, 110, 102, 21, -76, 71, 124, 6, 69, -73, 78, 41,
+    50, 20, 22, 59, -21, 60, -105, -48, 40, 6, -94, 53, 2, 65, 32, 104,
+    -15, 48, 62, -24, -12, -21, -51, 34, 42, 76, -47, 87, -79, -62, 72, -5,
+    117, 104, 117, 84, -27, -12, 110, 10, 117, 27, -3, 94, 122, -20, 115, 81,
+    59, -47, 62, 28, -81, 33, 127, 53, -38, 2, 106, -101, -59, 114, 2, -51,
+    -99, 42, -25, -88, 45, 34, -69, 47, -99, -11, -80, 18, 78, 0, -80, -120,
+    31, 72, -9, 101, 100, -14, -38, 101, -51, 55, -10, 81, 2, 45, 75, 1,
+    -110, 47, 23, -53, 4, 30, 80, 15, 66, 20, -99, 54, 21, -29, 8, -66,
+    -69, 27, 74, 68, 92, -49, 23, 2, 60, -82, -59, -97, 114, -15, 44, -17,
+    97, 52, 22, 13, -64, -22, 0, 48, 13, 67, 110, -70, 127, 40, 66, 37,
+    -8, -69, -115, 94, 127, 36, 102, -29, 46, -80, 4, 42, -56, 121, -91, -1,
+    25, -8, 118, 116, 21, -55, 114, -52, 81, 122, 66, 89, -51, -88, -24, 31,
+    59, 53, 44, -64, -67, 81, 44, 31, 23, 21, -83, -60, -86, -72, 36, 49,
+    -79, 55, 97, 1, -100, -80, 87, 18, 126, -51, 75, 22, 57, -37, 63, 55,
+    -43, -53, 38, 85, 76, -45, 51, 111, -86, -43, 118, 18, -79, 26, 61, 97,
+    68, 114, -40, 64, 64, 79, 50, 107, -8, -87, 116, 23, -37, -33, 34, 67,
+    -54, 58, -23, -29, 58, 2, -77, 87, -14, 82, -9, 46, 96, 66, -75, -27,
+    127, 81, -74, -18, 84, 80, 4, -18, 107, 39, 62, 125, 76, 92, -64, -66,
+    -6, 99, -127, -63, -53, -86, -73, 57, -79, 100, 60, -88, 95, 42, -82, 40,
+    51, -73, 72, 113, 48, 118, -53, 80, 118, -55, 43, 49, -71, -66, -4, -8,
+    119, -27, 38, -84, -3, -59, 43, 13, 95, -85, -53, -43, -65, -21, -4, -64,
+    14, -28, 76, -31, -115, -80, -66, 109, -51, -80, 12, 71, -57, 124, 34, 33,
+    3, 9, 24, 61, -98, 39, -103, -22, -59, -111, 26, 87, -59, -7, 90, 51,
+    114, 22, -74, -107, 59, 108, -89, 13, 58, 87, 68, -50, 9, -71, -106, 101,
+    -55, 0, 74, -84, 32, -87, 5, -40, -127, -76, 92, -39, -108, 1, 25, -54,
+    -99, 103, -102, 85, -15, -6, 69, 98, -4, 99, 65, 41, -32, -12, 20, 55,
+    -88, 7, 47, 127, -9, 10, 52, 46, 60, 85, -6, -45, 126, 49, 5, -12,
+    61, -26, 9, 119, 29, -11, 40, -27, 73, 68, 72, -84, 38, -46, 22, 97,
+    -60, 47, -9, 85, 59, 47, -67, -59, 5, -23, 52, -4, 18, -8, 6, -61,
+    -72, 100, -33, -58, 53, -52, -44, 27, 89, 25, 117, 23, 9, 25, 103, -63,
+    9, -94, -31, 100, 0, 84, 81, 127, 39, 49, 37, 83, -81, 36, 95, -52,
+    -42, -20, -33, 95, -105, 42, -24, 42, -13, -10, 27, 68, 21, -71, 64, 99,
+    -24, 13, -77, 106, -49, 50, -40, -61, 5, -26, 61, 1, -58, -79, -32, 29,
+    119, 21, 62, 81, -40, 50, -37, -83, 31, -30, -44, 81, -57, 86, -61, 1,
+    65, 22, -2, -60, 29, -83, -9, 71, -39, -17, 78, 4, 5, 102, -32, 79,
+    -89, 3, 38, 109, 87, 65, 10, -7, -84, 48, 55, -59, 78, -53, -91, -1,
+    -9, 75, 40, 109, 73, 117, -3, -34, 9, 74, 28, 80, 15, 127, -20, -3,
+    80, -50, 35, 39, -80, 81, -93, 6, 29, 10, 12, -34, 73, -37, 108, -36,
+    -35, 52, 122, 101, 62, 106, 43, -127, -107, 15, -44, 6, 31, 35, -12, 66,
+    14, 59, 86, 101, -76, -16, 87, -95, -1, 116, 13, -95, -78, 30, 109, 35,
+    10, -113, 49, 19, 6, 16, -84, 16, -118, -32, -22, -98, -67, -94, 44, 63,
+    13, -96, -97, 108, -15, 65, 106, 125, -73, -56, -54, -87, -57, -106, -54, 90,
+    -50, -17, 88, 4, -103, -86, -3, -127, 104, -122, 22, -4, -67, -31, 57, 57,
+    5, 105, 94, 92, 91, -88, 64, -73, -122, 125, -49, 15, -33, -44, 87, 3,
+    112, -114, -30, 3, 113, 30, 121, 104, -68, -70, 116, 49, -101, 50, -92, -118,
+    31, 91, -40, 2, 73, 56, -51, -46, -13, -36, -48, -10, 84, 73, -11, -82,
+    -69, -35, -11, 75, -87, -84, 75, -12, -63, -61, 55, -41, -23, -48, 75, 6,
+    35, -73, -42, 33, -10, -4, -65, 85, 21, -19, -126, 58, -32, 42, 113, 35,
+    -65, -63, -77, -37, 59, -49, 36, -62, 10, -23, -79, -68, -64, -35, 24, -78,
+    -26, 101, 75, -90, 70, -49, 81, -68, 59, -127, -70, 79, -27, -89, -73, 29,
+    -56, 21, -75, 27, -63, 1, 101, 127, 89, 96, 97, 89, -65, 5, -53, 72,
+    -14, 57, -44, 21, 18, -1, -12, -10, -66, 76, 29, 59, 116, 88, 50, -23,
+    80, 32, 56, -66, 55, 21, 119, -84, 78, 19, 70, 65, -48, 42, 64, 99,
+    33, 13, -26, -53, 0, 36, 44, 3, 49, -47, 122, -26, -44, 37, -24, -40,
+    115, 64, 87, -24, -83, 127, 0, 121, 86, -100, 109, 23, 13, -101, 21, 96,
+    49, 36, 35, 14, -85, -20, 44, -14, 12, 84, 115, -19, -34, 48, -62, -14,
+    103, 100, -16, -5, 94, -23, -76, -58, 41, 72, -75, 100, -78, -46, 109, 89,
+    -59, 37, 56, -72, 63, -66, 26, -77, 32, -103, -19, 21, -39, -123, 15, -84,
+    51, 19, -42, -56, -56, 20, 72, -24, 8, -66, -104, 118, 101, -44, 92, -75,
+    -80, -46, -9, 1, 68, 46, 63, 29, -50, 62, -48, 56, 3, -24, -51, -13,
+    -80, -44, 97, -50, -69, 46, 45, 86, 99, 52, 42, 13, 127, 62, 10, 68,
+    -69, -77, 104, 35, -1, -50, -46, -54, -93, -115, -20, -35, -95, 9, -49, -53,
+    102, 127, 89, -61, 70, 66, 74, -57, 74, 55, 38, 88, -36, -16, 72, 88,
+    -55, 71, -35, -37, -56, 82, 54, -17, -65, -16, 89, -74, -65, 46, -55, 63,
+    -62, -37, 12, 78, 40, 90, 6, -102, -57, 97, 107, -15, 87, 48, 66, 126,
+    -80, -69, -32, -40, -42, -57, -32, -34, -1, 68, -101, 89, 38, 114, 11, 98,
+    33, 27, 105, -18, 34, 43, -8, 4, -65, -50, -96, -20, -127, -25, -13, -19,
+    68, 87, 106, 97, 64, -70, -122, -96, -19, -100, 50, 81, -105, -7, -109, 27,
+    86, 21, 22, 18, 31, -63, -2, 46, 95, -19, 19, 103, -79, 10, -9, -70,
+    58, 70, -57, 10, -43, -23, -15, -2, -50, 59, 8, 67, 43, 65, -25, 108,
+    -56, 55, -92, 97, 110, 55, 115, 76, 126, -35, 92, 10, -32, 123, 28, -61,
+    -82, 24, -40, 21, 87, -29, 30, -64, -41, -40, -58, 41, 127, -64, 63, 113,
+    -60, 15, 74, -29, -3, 44, 83, 1, 36, 65, -81, 63, -56, 43, -3, 67,
+    109, -7, -36, -71, -23, -46, 14, -55, 70, 107, -1, 18, 58, 99, 69, 70,
+    81, 56, -94, 11, 7, 69, -22, 90, -5, 9, -81, 66, 72, 85, -66, 45,
+    -80, -71, -56, -65, 90, 106, -15, 98, -68, -3, 96, -39, 42, 29, -90, 35,
+    67, -8, -41, -61, 33, 77, -96, 36, -86, 100, 73, -90, 3, -2, 31, -17,
+    119, -16, -16, 87, -29, -5, 59, 80, 127, 84, -91, 95, 27, -32, -40, -90,
+    76, 98, 58, 36, -26, 22, 18, -92, 54, -26, -48, 17, 92, 48, 59, 51,
+    -70, 86, 120, -49, -44, 29, -31, 64, 66, -2, -85, 85, 33, 78, -9, -17,
+    -70, -40, -24, 36, 32, 42, -30, 127, 16, -66, 54, -72, -11, 61, 63, -65,
+    -82, -89, 3, 112, -32, -92, 26, -83, -80, 51, 68, 69, -31, -86, 82, -11,
+    -55, -52, -30, -20, 50, 123, -100, 14, -47, 28, 18, -59, 18, -98, 73, 12,
+    -42, -81, 32, 20, -15, -58, -56, 89, 116, 55, -92, 116, 73, 111, -69, 81,
+    124, -49, 6, -66, 110, -30, -14, 5, -27, -58, 63, -48, -48, -46, -94, 65,
+    -85, -21, 28, 26, 117, -32, -33, 19, 77, 35, -20, 127, 59, -5, 27, 63,
+    -26, -107, 91, 113, -88, -9, -79, 81, 103, 11, 102, 52, 32, -94, 15, -52,
+    -70, -46, -68, -73, 84, -13, -16, -74, -86, 78, -27, 116, 15, -109, 17, -103,
+    -85, -24, 88, -34, -7, 87, -93, 53, -71, 87, -54, 61, -29, 33, 88, -118,
+    114, -56, -109, 3, -3, 47, 77, -10, -100, -71, -55, 69, 70, -22, -38, 127,
+    84, 114, 17, 29, 8, -24, 69, 15, 41, -58, -68, -2, -52, -50, 17, -47,
+    -46, 42, -39, -81, -57, 77, 27, -47, 84, -72, 90, -80, -48, 11, 35, 77,
+    7, 69, -108, -115, 47, 26, 108, -83, -69, 127, 31, 110, -8, -94, -88, -21,
+    -91, 15, -13, -81, 0, 27, 98, -12, 94, 75, -22, -12, 109, -94, -64, -34,
+    95, -19, -87, -17, 67, 111, -82, 49, 78, -93, -79, -27, 9, -6, -13, 57,
+    66, -37, 127, -37, 0, 99, -23, -96, -6, 69, 28, -15, 89, -58, 71, -72,
+    76, 117, 97, 22, -40, 38, 3, 5, 103, 4, 7, 49, 15, -44, -37, -70,
+    82, 46, -9, -63, -48, 115, 59, -56, -17, -65, 111, 55, -61, 41, 104, 63,
+    73, 49, -30, 27, -24, -32, 105, -33, -36, 17, -25, 24, 57, -55, 110, -29,
+    -73, -45, -70, 14, -24, 121, -77, -27, -99, 62, 13, -13, 4, 127, 103, 84,
+    116, -29, 51, -101, 72, 89, 21, 40, 20, -67, 116, -22, 123, 101, 45, -64,
+    -85, -21, -66, 87, -20, -57, 41, 45, -54, -55, 38, -95, 126, 79, -19, -79,
+    -100, -40, 45, -23, 9, 46, -86, 44, 51, -31, 2, -10, 80, 18, -22, -77,
+    60, -119, 78, 75, -55, -65, -37, 18, -74, 62, -64, 15, -127, -53, -83, -64,
+    -114, -37, -88, -48, -6, 44, -69, 51, -78, -10, -71, 72, 65, 59, -27, -57,
+    -88, -76, -22, -17, 4, -82, -13, 35, 29, 96, -5, -7, -56, -72, -77, -101,
+    29, -96, -13, 13, 92, -74, -96, 68, -95, -39, 52, 19, 65, -58, -89, 21,
+    -69, -9, 91, 98, 82, -51, -64, 43, -70, -45, 27, 14, 12, -7, -11, -47,
+    -43, -26, -106, -84, -127, 20, -37, -24, 8, 70, 7, 70, -15, -116, -83, -83,
+    89, -51, -37, -39, 66, -106, 63, 105, 46, 3, 33, -33, -71, -87, -71, -55,
+    -122, 59, -79, -70, -56, -8, -123, 113, -79, 13, 4, 30, 55, 52, 99, 20,
+    -58, 86, 91, -18, 24, -84, -121, 109, -109, 81, -114, -88, 27, 17, -24, 7,
+    -79, -17, -56, -105, 112, 24, -120, 0, 61, 90, -98, -118, 27, 70, -20, -76,
+    75, 127, 1, 13, -33, -2, -8, -64, -91, 3, -35, -39, -66, 117, 89, -14,
+    54, 11, -25, 78, -9, -2, 27, -44, -53, -79, -81, -39, 8, 29, -1, 64,
+    57, 90, -12, 63, 92, 54, 71, -58, -54, -47, 22, -83, 85, -102, 19, -127,
+    16, 103, 39, 83, 106, 42, 56, -125, 104, -59, -30, 81, 2, -20, 44, -35,
+    1, -59, 17, 48, 23, 30, -108, -66, -89, 29, -4, 81, 86, -121, -109, -57,
+    12, -41, -71, -66, -94, -14, -28, -127, -58, -29, -28, 46, 96, -21, -75, -70,
+    23, -46, -18, 85, -37, -1, -88, 96, -43, 20, -25, 49, -63, 77, -7, -48,
+    -28, -124, 33, 93, 88, -86, -79, -22, -70, -57, 32, -4, -30, 15, -110, -36,
+    -18, 6, -85, 104, -73, 61, -89, 53, 94, 66, -8, 27, 18, 13, -27, -25,
+    -86, 29, -28, 90, 7, 92, -66, 14, -66, -5, -74, 67, 84, -60, -22, 97,
+    -85, 0, -74, 81, -11, -63, -8, 30, 1, -5, -50, 115, 1, 47, 57, 13,
+    -13, 2, 38, 72, -115, -118, -7, 48, 9, -73, 82, 124, 22, 3, -93, 79,
+    -71, -46, -78, -51, -19, -127, 108, -30, -36, -14, 20, 86, -38, -70, 36, -42,
+    -74, 105, 24, -7, 67, 70, -86, 93, -54, -34, -5, 24, 52, -59, -11, -76,
+    127, -60, -55, -78, -85, 42, -1, -16, 115, 70, 80, 77, -57, 61, 33, 81,
+    90, -17, 31, 118, -121, 35, -3, 71, 23, 65, 45, 43, 32, -29, 52, -71,
+    -45, 73, -54, 68, -16, -101, 93, 23, -6, -94, 104, 19, 42, -67, -16, 76,
+    -5, 82, 79, 10, -68, 61, -87, 88, -64, -101, 10, 59, -72, 34, -58, -69,
+    20, 25, 127, -85, -28, -57, -117, -62, 77, -73, -57, -41, 55, -47, -44, -45,
+    25, 64, 49, 5, -16, -29, 35, 81, 103, -82, -96, 32, 40, -40, -97, -39,
+    1, -96, 117, 76, -68, -92, 49, 86, 18, -73, -17, -46, 77, -89, -62, 15,
+    -11, 42, 67, 15, 40, -89, -89, 127, -85, 114, -115, -112, 40, 64, -104, 35,
+    -61, -96, 53, -65, -65, 31, -102, -71, -26, -85, -78, -70, -23, -17, -85, -94,
+    -74, -15, 4, -61, -65, 103, -47, 87, 119, -20, -12, 37, -57, 64, 15, 10,
+    33, -38, 48, -20, 19, 75, -114, 26, -93, 110, -48, 35, 92, -63, 92, -84,
+    9, -94, -85, 7, -123, 26, -93, -81, 20, -88, 67, 77, -62, 18, 34, -5,
+    100, 14, 27, 77, 48, -2, -38, 45, 54, -79, 70, -93, 59, -111, -105, -75,
+    110, -24, -95, -90, -53, 3, 107, 0, -66, -101, 104, -14, -112, -127, -37, -109,
+    21, 57, 38, 118, -73, -82, 94, 114, 9, -27, 55, 62, 14, 95, -29, -64,
+    -115, -10, -66, 87, -60, 14, 55, 82, 11, 96, 72, 64, -21, 98, -93, 90,
+    -95, 58, -54, -54, -37, 12, 91, 60, 82, 37, -108, 70, -93, -89, -109, -76,
+    -37, 90, 65, -25, -109, 60, 16, -94, 54, -13, -59, 30, 52, 83, -127, 72,
+    76, 63, 34, -109, -37, 61, 15, -46, 76, 65, -74, 102, -110, 91, -23, -77,
+    -98, 94, 67, -3, 48, 59, -80, -70, -73, 116, -36, -55, -93, -36, 19, -83,
+    -32, 84, -55, 21, -32, 45, -104, -10, 31, 9, 93, -47, -66, -65, 84, 45,
+    -68, -41, -127, 2, 21, -105, 31, 33, -87, -67, -41, 25, 55, 14, 53, -21,
+    10, -114, -77, -17, -44, -23, 14, 19, 80, 74, 121, 63, -19, -76, 100, 75,
+    76, 10, -69, 18, 52, -65, 32, -52, 93, 80, -62, 18, -26, 116, -28, 7,
+    55, 87, -88, 20, -101, 95, 127, 62, 15, 49, 114, -48, 78, 40, -26, 57,
+    -73, 46, 92, -69, -60, -79, -30, 24, 22, 25, -82, 87, 59, -103, 3, -24,
+    -68, -94, -32, -69, -108, 72, -96, -33, -33, -12, -76, -123, 29, -104, 4, 58,
+    74, 56, -46, -106, 79, 24, -83, -82, 44, 76, 88, 75, -7, -19, 98, 100,
+    71, -14, 57, 123, 65, -7, 76, 100, 11, 11, -34, 97, 14, 127, -69, -49,
+    -42, 115, 15, -117, -79, 18, 84, -80, 39, -44, 18, 43, 45, -6, -91, 7,
+    36, -35, 98, -87, 88, -20, -45, -76, 28, -110, -76, -31, -86, -97, -37, -25,
+    8, 27, 73, -42, 41, 108, 109, 51, -118, 3, 113, -112, 47, -93, 30, 25,
+    60, 63, -79, -2, -71, 3, 1, -127, 41, -6, 91, -90, 99, -84, 14, -110,
+    -86, 109, -11, 34, -35, 96, -38, -121, -6, -98, -106, -62, 62, 60, 47, -96,
+    -86, -23, -41, 108, -62, 69, 94, -61, 75, 106, -81, -60, 25, 109, 102, -24,
+    86, 58, 48, -19, -99, 57, -98, 9, 49, -51, 36, -31, 76, -32, 79, -86,
+    34, 21, 106, -63, 7, 107, -87, 104, -103, -127, -110, -46, -80, -18, 28, 12,
+    -76, 66, 14, 61, 44, 55, -68, 65, -21, 119, 58, 64, 20, 67, -83, -65,
+    -33, 26, 34, 66, 74, -110, -2, -1, 45, -61, -97, 45, -127, 63, -77, 36,
+    -49, -80, 49, -1, 49, 77, 105, 74, 94, -56, -57, 11, 88, 127, 16, 28,
+    -27, 61, -18, 20, 8, -104, -86, 35, -62, -56, -15, -51, 23, -5, 65, -76,
+    88, 21, -32, 74, 111, 48, -65, 28, 32, -103, -56, 42, -21, 7, 45, 7,
+    -92, -99, -44, -55, -76, 92, -41, -13, -7, -87, 65, 12, 63, -12, 97, -104,
+    -46, 80, -85, 48, -5, -2, 37, -1, 79, 44, -89, 71, -38, -22, 36, -61,
+    48, 86, 17, 127, 68, 76, 62, 3, -93, 22, 60, 90, 74, 6, 97, -51,
+    35, -42, 20, -49, -17, -4, -74, -26, 54, 75, -95, -52, -83, 9, 89, -58,
+    -76, -21, -27, -21, -36, -29, 6, 60, -5, 25, 53, -10, 105, -67, 8, -29,
+    -41, -74, -54, -68, -40, -91, 72, 8, -10, 29, 89, -85, 12, 68, 25, 27,
+    67, 15, -15, -84, 68, -28, 11, -127, -40, -46, 85, -96, 15, -103, -5, -12,
+    57, -1, -127, -42, 18, 19, 89, -43, 12, 77, -74, -29, -18, 20, 17, -49,
+    71, -14, -34, 107, 91, 65, 7, -75, -40, 115, 8, 67, 37, -14, 32, -30,
+    -71, 54, -41, -64, 2, -118, 17, 110, -5, 45, -68, 43, 72, 25, 5, 96,
+    84, -55, 59, -127, 0, 75, -86, 63, -6, 36, 96, -65, -100, 64, -12, 62,
+    -54, 93, 70, -58, -4, 40, -86, 40, -2, -111, -26, -89, -86, -38, 87, 20,
+    41, 54, -58, 28, -89, 59, -83, 68, -69, 104, 45, -2, 70, 58, 83, 16,
+    54, 2, 64, -95, 43, -11, 10, -113, 43, -35, 122, 83, -77, -90, -86, 7,
+    -54, 79, 37, 91, -103, -74, 113, 88, 26, 112, -7, -102, -73, -84, 112, -41,
+    112, 67, -81, -69, -66, 115, -42, 26, -127, 105, -35, 79, -49, -42, -9, -19,
+    51, 89, 24, -43, -38, 91, 119, 19, 9, 45, 48, 48, -49, 96, -49, 114,
+    32, 93, 33, -19, -66, 111, -69, 42, -31, 110, 127, -81, 12, 36, -30, 35,
+    65, 6, 5, 81, 3, -65, 41, 61, -69, 14, -56, 77, -52, -103, -34, -27,
+    59, 97, -32, 86, -59, 3, 22, -80, -49, 40, 71, 27, -35, 26, 73, -59,
+    100, -61, 74, 112, 100, 86, -24, 107, -6, 112, 108, -16, -90, -45, -85, -67,
+    15, 1, -95, -120, -74, -99, 55, -40, -117, -71, 47, -32, 118, 127, 99, -85,
+    -55, -35, 48, -1, 57, -84, 72, 21, -37, 49, -6, -32, 105, 94, -6, 53,
+    15, 75, 106, -73, 25, -23, 84, -86, -106, 30, -37, -96, 83, -76, -53, 55,
+    -71, 69, -11, 90, 17, 21, -106, -55, -8, 44, 26, 62, 50, -88, 41, -11,
+    -60, 90, -49, 66, 25, 60, 15, 106, 53, -63, 49, -111, 125, -46, -99, -47,
+    -54, -33, 34, -117, 54, 107, 24, 75, 45, -23, -72, -127, -31, 118, -5, -90,
+    -62, 47, -79, 67, 7, 42, 98, -13, -96, -32, 8, 93, 68, 3, -41, -84,
+    91, -41, 76, 6, -14, -59, -94, -82, 115, 78, -3, 61, 102, 60, 89, -37,
+    -45, -35, -13, -83, -75, -104, 61, 42, -66, 74, 101, -93, 23, 39, -26, -75,
+    -97, 102, -79, 87, 50, 85, 123, -13, -83, -85, -10, 30, -127, 70, 23, 39,
+    2, -74, 7, -66, -48, -93, -9, -66, 89, -1, -25, 14, -41, -54, -80, 101,
+    101, -20, -55, 120, 107, 66, -11, -83, 7, 92, -74, 49, 39, -38, -38, 31,
+    67, 68, -20, 54, -51, 84, -71, 103, -74, 45, 86, 17, 17, -69, 29, 22,
+    16, 106, -37, 127, 8, 6, -57, 4, 84, 44, -31, 61, -34, -12, -3, -15,
+    -91, -55, -21, 71, 99, -28, -35, -14, 46, 42, -73, -6, -99, -94, 95, 38,
+    -11, 35, 76, 89, 28, 64, 93, 105, 87, -11, 54, -29, 121, -109, -53, 87,
+    28, 1, -109, -76, 4, 73, -82, 31, 20, -66, -15, -108, 49, 58, 76, -91,
+    -78, -6, -80, 67, -78, -75, 103, 50, -94, 54, 8, -58, 111, -60, 127, 35,
+    -82, 35, 22, -42, -13, 31, -84, 3, -107, -80, 55, -66, -5, -95, -14, -1,
+    12, -117, 99, -56, 49, -122, 46, 61, 10, -67, -105, -87, 73, -57, -51, -61,
+    -39, -25, -52, -97, 28, 67, -83, -69, 72, -84, 40, 45, -71, 40, -99, 12,
+    -20, -25, 64, 5, 69, 46, 28, 49, 59, 36, -16, -8, 61, 9, 70, -71,
+    1, -82, 21, 80, -39, 45, -84, 51, -98, -102, -49, -34, -1, 73, -27, -75,
+    -93, 5, -127, 27, -85, -47, -3, 60, 16, 89, -85, 93, -118, 46, 71, 17,
+    44, 91, -93, 34, -115, -83, 32, 88, -108, 76, 98, 76, 127, 106, -48, 32,
+    98, -84, -58, 43, -86, 60, -64, -13, 94, -117, -4, -32, -118, 81, -77, -115,
+    125, -36, -113, 25, -58, 2, -54, -114, -70, -71, -11, -7, 6, -41, -50, 87,
+    72, 35, 0, 119, 79, -25, -33, -43, 83, 117, -36, -42, -107, -36, 106, 53,
+    -46, 26, -39, 30, -70, -16, -62, 111, -57, -122, -116, 50, 59, 79, 116, -87,
+    -102, -50, 48, 17, -34, -105, -71, 90, -127, -54, -33, -61, 81, 56, -52, 62,
+    -109, 23, -54, 94, -34, 67, -46, 17, 50, -34, -73, -66, 94, 9, -16, -1,
+    35, -3, -109, 79, -13, -45, 6, -74, 38, 9, 31, 25, 72, -101, -81, 1,
+    -112, -75, 71, 98, 17, -64, -11, -22, 25, 18, 99, -41, -19, 2, 21, 2,
+    -118, -85, 53, -95, -27, 112, 28, -10, 73, -55, -24, 40, -62, 84, 20, -56,
+    -11, 0, 34, -38, -127, -53, -115, 62, 49, -101, 61, 57, 18, 37, 44, 19,
+    127, -112, -20, -15, -67, 45, -71, -31, 26, 70, 100, 104, -48, -92, -67, 55,
+    10, 86, -14, 72, 123, -11, -88, 52, -9, 0, 101, 42, -22, 13, -58, -21,
+    -80, -13, -28, -102, 13, -101, 53, 57, -23, 34, 14, -72, -39, -109, 49, 89,
+    -54, -38, -88, 25, -116, -24, 74, -10, 8, 7, 125, -31, -122, 59, 35, 75,
+    16, 57, -70, 30, -28, -78, 13, 127, 79, 63, 7, -22, -48, -34, 96, 17,
+    22, -1, 37, -53, 86, 50, -78, -29, -94, -50, -75, -34, 89, 104, 71, 65,
+    75, -66, -85, -59, 100, 46, -14, 39, -108, 81, -127, 36, -6, -31, 45, -49,
+    6, -33, 102, 84, -22, -91, -111, 44, 88, -19, -100, 67, 78, 86, 47, 71,
+    25, -77, 75, 59, 13, 84, 15, -30, -108, -88, -87, -33, -73, 27, 82, -1,
+    -55, -24, -62, 5, 22, 77, 47, -78, 72, 100, -58, 8, 6, -64, -59, 115,
+    38, -53, 100, -127, 1, 98, -127, -116, 82, -76, 57, -18, 82, 53, 54, -75,
+    -30, 62, -46, 47, -58, -100, -89, 23, -85, 33, 90, 70, 50, 103, -33, -58,
+    -66, -67, -113, 35, 95, -65, -103, 39, 81, -84, 82, 64, -72, 100, 78, -50,
+    -42, 3, 119, 115, 112, 73, -18, -65, -69, 16, -88, 102, -80, -100, 26, -10,
+    5, 33, -31, 20, -31, 33, 17, 39, -2, -32, 5, -24, -93, -113, -14, 42,
+    -25, -36, -13, 95, 29, 8, 47, -78, 37, -99, -69, 31, -7, -13, -46, -65,
+    82, -71, -98, -58, 39, 127, -7, -42, -51, 82, -101, -103, 18, -19, -60, 31,
+    -73, -43, 84, -127, -93, -117, 32, 88, -90, 74, -43, 13, 29, -65, -50, 50,
+    -91, 72, 4, 17, 26, 30, 60, -41, 49, -19, 55, 65, 80, 36, 102, -67,
+    52, 6, 77, 63, 124, 62, -89, -72, -78, 50, -33, -54, 73, -94, -21, 95,
+    79, -115, -8, 78, -40, 89, 73, -59, 55, 67, -102, -18, -17, -79, -77, 17,
+    38, 83, -16, 127, 10, 102, -75, 107, 120, -12, -83, 17, 34, -99, 75, 14,
+    20, 98, 20, -21, -20, 110, 65, -73, 19, -34, 32, 7, 90, -96, 50, -59,
+    -119, 62, -86, 124, -70, -11, -77, 3, -70, 47, -79, 90, 97, -38, -54, -1,
+    -33, -52, -63, 14, 27, -5, 60, 15, 41, -107, -43, 15, -93, 44, -77, 74,
+    -91, -103, -30, 14, -99, 69, 26, -107, -69, 28, -3, -24, -20, 31, 107, -27,
+    -58, -17, -89, 99, 29, 71, 41, 17, -17, -44, -54, 124, 1, 93, -97, -37,
+    83, -45, -39, -16, -101, -28, -44, 2, 28, 39, 117, 31, 23, -77, -127, 98,
+    -114, -39, 83, 73, -25, 90, 115, -10, -113, -55, -54, -50, 41, -61, 64, 88,
+    54, 0, 18, -35, -75, -51, -4, 15, -64, 127, -75, 59, -26, 31, -99, -31,
+    102, 126, 69, -81, -98, 60, 12, -77, -68, 107, 115, 73, -56, -60, 105, 119,
+    74, -23, -26, -38, -67, -42, -47, -58, -100, 12, 117, 52, -29, 72, -38, -22,
+    -89, -10, 44, 27, 14, -46, -94, -24, 75, 100, 90, -89, 111, 16, -55, 88,
+    41, 4, 82, -102, 34, -45, -24, -83, 64, -85, 83, -20, -75, -94, 23, 89,
+    17, 45, -70, -13, 57, 22, 21, 84, -49, -28, 83, 73, -21, -20, 34, -70,
+    -98, 45, 86, 118, 7, 19, 79, -75, 21, 59, -70, -66, 105, 6, -38, -125,
+    52, -36, -108, 87, 28, -75, -5, -13, 70, 16, 49, -12, -127, 89, -16, -104,
+    -123, 53, -63, -124, -96, 65, 19, 21, -93, 36, -101, -21, -36, -107, 127, -108,
+    6, 38, -110, -34, 26, -78, 14, 66, -92, 23, -48, -81, -50, 26, -38, 57,
+    7, 28, 123, 28, 41, 11, 11, -9, -8, 6, 104, 62, 38, 65, -91, 72,
+    -59, -82, 55, 23, -99, -17, 65, -63, 56, -25, -88, 46, 40, 65, -50, -9,
+    -114, -117, 79, 71, -105, -51, -50, -44, -20, 121, -71, 8, -111, 106, -54, 104,
+    -43, 4, 7, 12, -58, -72, 96, -19, -44, -109, 35, -13, -118, -127, 106, -33,
+    -15, 31, 9, 83, 125, -48, -42, -3, 91, -109, -3, -13, -2, -36, 7, -116,
+    60, 10, 74, -12, 58, 69, 80, -87, -17, -75, 94, -71, -111, 107, 122, 95,
+    10, -30, 20, -7, 5, 99, -71, 91, 117, 24, 118, -19, -81, -14, -78, 66,
+    -76, 104, 45, -86, 79, 126, -8, 77, 101, -53, 35, -103, -105, 53, -97, 106,
+    -42, 14, -34, 44, 7, -94, 6, -69, 67, -63, 49, -13, -44, -8, 0, -100,
+    127, 85, 5, -15, -84, 24, -54, -54, -7, -28, 31, 34, 49, -55, -58, 38,
+    49, -24, -111, 56, -59, 39, -91, -99, 58, 90, 45, 21, 53, 94, 98, -5,
+    68, -65, -127, -98, 14, 31, 28, 66, -5, 44, 32, -1, -70, 83, 90, 55,
+    36, -43, 16, -76, 14, 89, 116, -125, -117, 55, 62, 75, -16, -7, 48, 28,
+    10, 70, 36, -38, 49, 87, -111, 54, -96, 41, -75, 23, 56, 80, 8, 13,
+    -78, 55, 6, -4, 24, 62, -65, -22, -98, -50, 74, -66, 54, 37, 40, -22,
+    -9, 55, -32, 7, -107, -75, -34, -4, -17, 41, -46, 15, -70, -48, 45, 13,
+    -52, -49, 95, -108, 127, -64, -20, -95, 104, -2, 41, -83, -65, 68, -80, -2,
+    42, 45, 65, 48, -78, 79, -5, -34, 4, -72, -62, -71, -62, -108, 98, 4,
+    39, -17, -123, 27, 61, -21, -84, -58, -46, 122, 63, -59, -105, -15, -18, 38,
+    -26, -24, -97, -27, -86, 76, 111, 20, -103, -127, -55, 68, 13, 40, -4, 86,
+    42, -63, -115, -55, -96, -10, 99, 56, 59, 70, 4, 117, -44, 28, -57, -69,
+    -25, 67, -73, -68, 36, -44, -48, 88, 31, 123, 96, 77, 80, -95, 73, -65,
+    -106, -14, 47, -95, 58, -106, 87, -66, -88, -111, -104, -6, -73, 45, 100, -37,
+    -52, -100, 85, -39, -82, 23, -44, 16, -48, -94, -89, 65, -61, -1, -84, -37,
+    -27, 85, 102, 69, -36, -90, -40, -59, 17, 77, 39, 41, 48, 99, -58, -105,
+    15, 45, 50, 14, -74, 38, -62, -23, -119, -127, 94, 64, 46, -74, -42, 67,
+    33, -70, -78, -21, -84, -71, 71, 62, -40, -83, 25, 22, 104, 51, -98, -44,
+    33, -3, -65, 52, -110, -114, 43, 105, -13, -72, 67, 118, 6, -62, -99, -21,
+    85, 80, -62, -81, 22, -34, -23, -69, -96, -84, 101, -67, 34, 10, 65, -100,
+    127, 73, -74, -6, 90, -2, 10, -72, 74, 123, -43, 92, 42, 5, 43, -3,
+    127, 85, -12, 19, -72, 23, 102, -112, 36, -81, -55, 42, 86, 66, 11, 43,
+    -60, 37, 41, -66, -49, -3, -100, 124, 106, -62, -93, -51, 119, 96, -56, 124,
+    118, 47, -15, -56, 89, 41, -72, -23, -108, 94, -78, 28, -83, -60, 47, -34,
+    -114, 68, 21, 21, -17, -46, -67, -27, -52, 87, -81, -55, 31, -45, -20, 85,
+    -42, 21, -6, 5, -20, 74, 4, -42, 94, -81, 61, -66, -75, -97, -64, -77,
+    -83, 87, -115, 40, -84, -24, -21, -69, 17, -48, -105, -51, -49, -71, 34, -87,
+    -32, 78, -125, -46, -39, -35, 63, 70, 46, -105, 20, -99, 11, -16, -113, -28,
+    81, -63, 101, 69, -116, -107, 45, -22, 89, -35, -73, -50, -73, -127, -117, 23,
+    60, -58, 39, -65, -98, 24, 48, -4, 16, 71, -68, -23, 23, -114, -41, -42,
+    61, -73, -15, -81, -36, -37, 29, -82, -69, -12, -92, 45, 66, -75, -89, -49,
+    -85, 127, -99, 87, 46, 3, -49, -60, -69, -121, 102, 50, 80, 66, -15, -18,
+    47, 45, 40, 111, 9, -15, -55, -89, 32, -56, -38, -16, -11, 7, -95, -47,
+    110, -44, -27, 24, -55, 80, -101, 68, 2, -96, -64, 103, -18, 28, 12, -3,
+    -46, 21, 60, 84, 91, 82, 56, 74, 49, 47, 72, 27, -75, 124, -63, -22,
+    94, 39, -101, 88, -66, 68, 76, -14, 82, 79, 3, -68, -25, -64, 57, 33,
+    69, -78, -79, 52, -35, 84, 1, -29, -41, -55, 127, -59, 54, -47, -35, -93,
+    -30, -43, 100, 52, 23, -123, 32, -24, 108, -113, 73, -88, -59, 110, 36, -31,
+    -65, -104, -30, 84, 123, -90, -116, -95, -90, 18, -25, -86, 52, -37, -21, -12,
+    -55, -46, 93, 90, 81, -26, 57, 98, 19, 103, -67, 0, 100, 0, -127, -104,
+    -11, -114, 57, 94, 33, -26, 14, 34, -8, -97, 73, 15, -115, 103, -93, -115,
+    101, 93, -102, 69, -3, 127, 50, -86, 122, 30, 53, -102, -74, 23, -4, -17,
+    34, -19, 102, 88, 41, -28, -115, -2, 85, -22, -125, 91, 46, 8, 26, -35,
+    -71, -53, -70, 48, -8, -96, -58, -21, 26, 102, -29, -11, -83, -102, -71, -36,
+    108, 77, 49, -35, -109, -103, 94, 80, -108, 35, 28, -77, 81, 72, 60, 13,
+    15, -82, -109, 70, -71, -44, -24, 95, 40, -61, 64, 49, 68, -70, 21, 55,
+    -124, 98, -68, 58, 29, -88, 24, -82, -89, 39, -76, -38, -117, 97, -62, -62,
+    -81, -109, -125, -44, 78, -126, -54, -80, 126, -23, 5, -117, -49, 102, 59, -112,
+    3, 127, 119, 71, -46, 8, 81, 91, 31, 86, 83, -36, 126, -94, 10, -82,
+    -22, 97, -30, -2, -25, -108, 115, 106, -1, -79, 12, 55, 44, 81, 95, -118,
+    -35, -63, 96, -88, 22, -16, -60, -93, 49, -26, -109, -21, -49, 59, 97, -90,
+    -93, -103, 95, 81, 127, 106, -38, 42, 119, -72, -103, 50, 96, -82, -71, -100,
+    49, -124, 111, -71, 105, 126, 106, -53, 30, 55, 116, -93, 80, -26, 60, 56,
+    -78, -39, 31, -65, 34, -24, 88, -3, -21, 39, 93, -18, 88, -47, -12, -22,
+    90, -20, -9, -25, 78, 58, 6, -40, -28, 112, -33, -88, -49, -63, 64, 107,
+    -41, -96, 73, 29, -46, -79, 101, 43, -105, 20, -48, -43, -95, 48, 95, 99,
+    -83, 65, -3, 65, 80, -127, -55, 90, 30, 5, -115, -14, 11, -108, -74, 22,
+    -33, 45, 58, 4, -14, -41, -27, 127, 2, -9, 60, -76, 9, -102, -27, 95,
+    6, 78, 50, -107, 36, 41, 90, -83, -63, -7, 70, -113, -111, 90, 3, 76,
+    60, 43, 61, -77, 29, 8, 69, -47, 58, 127, -41, 2, 24, -7, -58, 18,
+    25, 0, -21, -121, -3, -90, -9, 89, -3, 106, -86, -13, 73, -49, 63, 84,
+    57, -110, -32, -47, -44, -96, -64, 81, -82, 104, -46, -127, 38, -25, 67, 83,
+    -93, 28, -75, 61, -62, -29, 50, 9, -63, -93, 108, -101, 101, 115, -73, 40,
+    -22, 2, -84, -93, -32, 96, -5, 32, -15, 12, -109, -13, -75, -2, 18, -55,
+    119, -88, -86, 55, 8, 45, -5, -104, -13, -53, -17, -90, -74, 3, 15, -109,
+    -113, 94, -58, -47, -65, -77, -97, -71, 93, -28, -116, -57, -23, -58, 50, -92,
+    58, 91, -3, 50, 110, -49, -25, 6, -113, 110, -127, 45, -35, -95, 57, -90,
+    -33, -79, -66, -47, 36, 9, -24, -57, -10, 17, -102, 91, 21, 87, -54, 26,
+    7, 108, -81, -23, 15, -88, 33, 14, -49, 7, 2, 122, -76, 114, 37, 112,
+    88, 92, 32, -82, -94, -96, -7, 55, 86, -49, -48, -24, -36, 49, 38, -46,
+    82, -20, -102, -44, 22, -127, 50, -102, -66, 54, 111, -67, -71, -88, 47, -36,
+    74, 83, 118, 37, 44, -30, 45, -89, -113, -87, 76, 4, -74, 78, 37, 119,
+    -79, -81, -34, 10, 86, -62, 57, -32, -112, -9, -17, -3, -81, -61, 12, -48,
+    2, 91, -115, 54, 47, 0, 13, 24, -22, -65, -74, 27, -88, 94, -77, 38,
+    80, 13, -48, -72, -108, -20, 45, 84, 84, 31, -20, -42, 65, -69, 110, -90,
+    -22, -66, -19, 31, 43, 14, -100, 91, 9, -47, 59, -127, 9, -27, 36, 104,
+    -80, -121, -34, -74, 53, -78, -67, -55, 113, -57, -49, -113, 104, 43, 33, 91,
+    -10, 70, -27, 28, 37, -26, -53, -95, 65, -96, -18, 78, 22, -74, -79, -16,
+    72, -56, 76, -103, 74, -36, -1, -11, -69, 41, -66, 60, -70, -127, -70, -12,
+    -92, -86, -34, 65, 38, -67, 38, -13, 46, -91, 69, -119, 94, 27, 46, -54,
+    44, 48, 42, 41, 103, 105, -34, -23, 31, 70, 3, 46, 67, -46, 67, -5,
+    -79, 33, -38, 54, -93, -17, -18, -53, -50, 2, -15, -1, 98, 61, -15, 52,
+    -23, -24, 14, 52, 78, -12, -86, -58, -56, 49, -4, -32, -6, -66, -2, 21,
+    -5, -84, 76, -14, -68, 7, -115, -26, 26, -33, -17, 62, -49, 93, -67, -99,
+    -80, -85, -114, 11, 28, -5, 78, -22, -65, 78, -77, 119, -127, 67, -18, -29,
+    94, -68, 16, -83, 107, -9, 73, -24, 97, -81, 62, 0, 51, 8, -41, -92,
+    46, -49, -73, 100, -66, 105, -41, 106, -31, 80, 101, -10, 38, 13, 74, -15,
+    33, 102, 29, 12, -77, 115, -85, -71, 26, 100, -45, 126, -1, 53, -2, -8,
+    0, -69, -92, 19, 98, 68, -74, 122, 49, -94, 13, 127, 2, 10, -73, -68,
+    76, -2, -111, -85, 107, 77, -85, 103, 14, -107, -71, -76, -45, -97, 39, -48,
+    58, 59, -48, 71, 57, 103, -49, 103, -66, 113, -60, 97, 75, -6, -107, 127,
+    98, -116, -2, -54, -104, -70, -117, 118, -73, 108, -26, -8, -11, 113, -114, 39,
+    112, -46, -72, -92, 8, -34, 115, -85, -23, -83, 20, 0, 85, 6, -29, 33,
+    18, -7, 64, 18, 54, -51, -37, -43, 62, 79, -21, 113, 41, 127, -48, -20,
+    -59, 109, -40, -53, 112, 50, 101, -41, 9, 112, -17, -38, 119, 4, 57, -2,
+    5, 101, -8, 107, 9, 22, -47, 94, 21, 127, 73, -43, 47, 125, 104, -2,
+    110, 65, -13, 10, -26, 105, 15, 115, 103, -50, 57, 1, 41, 86, -23, -44,
+    -35, -63, -27, 4, 11, -40, -93, 6, -91, 45, -76, 15, -71, -67, 88, 25,
+    -45, 127, -10, 24, 56, 35, 7, 103, 28, -64, 20, -35, -103, 76, 107, -57,
+    45, 66, 43, 47, -17, 96, -59, 87, 95, -74, -90, -5, -50, 112, 11, 106,
+    22, 20, -35, 64, 63, 111, -80, -42, -18, 125, 120, 39, 58, 40, -76, 97,
+    83, 61, 42, -17, 29, 3, 111, -65, 7, 95, -34, -61, -17, -22, 14, 59,
+    101, -72, 95, -22, -53, 100, 59, 14, -31, 59, -12, 71, 25, -38, -24, -19,
+    73, -46, 76, 124, 61, 99, -31, -61, 98, 116, 119, 72, -60, 109, -43, 127,
+    -69, 102, 27, 27, 14, 85, -23, 1, 87, 67, 105, -22, 18, -68, -62, -53,
+    66, -22, 5, 76, 1, -37, 116, 31, 45, 106, 12, 31, 41, -58, 127, -5,
+    54, 95, 39, 69, -44, -25, 15, 80, 103, 96, -34, -12, 28, 109, -55, -63,
+    122, -65, 125, -8, -63, 53, -14, -18, -74, -20, -19, -39, 29, 81, -67, -40,
+    69, -10, 11, -15, 69, 39, 104, -14, -55, -37, -53, -3, 19, 85, 13, -34,
+    -56, -3, -82, -54, 114, 103, -21, -12, -85, 107, 102, 103, 101, -92, -95, 94,
+    44, 43, -88, 23, -57, 75, 13, 107, 50, 75, 24, -5, 23, 69, -19, 100,
+    -52, 127, 86, -79, 65, 105, 31, -35, -89, 5, 4, 112, -89, 1, 14, -25,
+    25, 29, 24, 83, 80, 71, -79, 70, 5, -43, -51, -47, 85, 47, 29, -76,
+    -20, -33, -3, 72, 69, 70, 25, 23, 116, 97, 71, -49, 73, -23, 127, 80,
+    2, -42, -47, 78, 0, -2, 30, -21, -52, -32, 43, -14, -18, 34, -22, 1,
+    102, -61, 32, 20, 0, 46, 81, 97, 92, 97, 63, 28, 78, 23, -40, 71,
+    5, 70, 97, -56, 53, 44, 27, -27, 13, 60, -47, 41, 52, 94, -7, 16,
+    94, 45, -3, 1, 45, -48, -51, 66, 86, -36, 104, -41, 59, -45, -9, 92,
+    127, -2, -32, 66, -16, 62, -58, -43, -43, -75, 81, 65, 112, 41, 94, 29,
+    104, -52, -50, 31, 42, 3, -58, 1, -27, 31, 126, -6, -1, 30, -46, 13,
+    8, -2, 68, 72, 120, -40, 45, -28, 15, 108, -5, 96, -38, 77, 61, -17,
+    127, -35, -49, -58, -2, -16, 86, 114, -61, 59, -26, -64, 59, 41, 93, -24,
+    53, -40, 19, 22, -5, 96, 6, -66, -37, 85, -22, 91, 42, 50, 85, 77,
+    66, -11, -72, 62, 7, 96, -27, 55, 65, 69, 28, 25, 45, 48, 1, -25,
+    22, 87, -8, -61, 10, 22, -19, 87, -74, 64, 27, 26, 22, 77, -40, 56,
+    -14, 96, -39, 111, 127, -41, -14, 44, 102, 81, 42, 22, 69, 31, 38, 50,
+    50, 103, 122, -18, -14, -17, 94, 107, -11, -8, 35, 58, -35, 54, -40, 64,
+    -21, -39, 103, 71, 67, -60, -43, -16, 26, 57, -30, 66, 48, 0, 18, 18,
+    -13, 105, -15, 6, 59, 70, 30, -10, 67, 62, -10, -42, 92, 100, 45, 27,
+    82, -41, 48, 47, -46, 89, 83, 49, 83, -119, 53, -64, 2, 37, -37, 90,
+    56, -53, 14, 21, 5, -84, 7, 5, -64, 30, 94, 59, 77, -87, 101, -34,
+    -29, 46, 17, 53, 28, -4, 27, -20, 51, -121, -53, -105, -22, -28, 40, -97,
+    -44, 104, -112, -38, 10, -88, -19, -41, -58, -11, 54, 127, 87, -11, 38, 77,
+    102, -61, 49, 125, 51, 68, 0, 27, -19, 60, -52, 117, -2, 82, 65, 127,
+    91, -39, 39, 63, 51, 82, -32, 40, 98, 27, 82, 67, 0, -31, 26, 111,
+    16, 87, 112, 25, 123, 17, -38, -54, 115, 47, 103, 37, 33, -24, 99, 100,
+    -10, 78, 116, 61, 106, 95, 120, 63, 54, 41, -28, -28, 97, -72, -61, -3,
+    127, 79, -51, 84, -56, 110, 102, 105, -12, 42, 106, -62, -38, 86, 74, -25,
+    48, 104, 63, 94, 83, 122, -33, -16, 50, -24, 75, 84, -45, -51, 119, -32,
+    -7, 109, 112, 83, -58, 49, 48, 90, 11, 37, 81, 22, 61, -41, 3, 85,
+    34, -41, -33, -63, -7, 58, 52, -16, 38, 107, -31, 19, 55, 92, 45, -66,
+    42, 78, -32, 94, -63, -12, 15, 39, 94, -32, -5, 94, 58, -39, -37, 101,
+    127, -45, -39, -15, 2, 48, 121, 106, 78, 14, 60, 6, 117, 43, 35, -63,
+    -22, 74, 108, 107, 0, -9, -60, -50, -60, 114, 117, 86, 106, 106, 69, 68,
+    19, -56, 67, 13, 45, -52, 9, 105, 113, 6, -53, 106, -29, 43, -22, 37,
+    103, -43, -32, 101, -82, 20, 125, 67, -15, -67, -77, 28, 118, 110, -44, 105,
+    67, 13, 30, 17, -10, -16, 80, -45, -86, -44, -72, 13, 86, 67, 127, 123,
+    -25, 117, -40, 101, -69, 71, -37, 127, -86, 122, -39, 48, -70, 69, 60, 11,
+    4, -61, -50, -18, 70, 126, -69, 107, 57, -25, -22, 14, -45, 67, 127, -12,
+    -63, 82, -45, 90, 83, -42, -19, 102, -67, 54, 75, 10, 64, 49, 54, -41,
+    -17, 103, 21, -68, 121, 127, 118, 85, 126, -55, 106, -54, 67, -12, -65, 117,
+    25, -73, -21, 17, 24, -21, -44, 95, 48, 3, -66, 14, 60, -13, -48, 33,
+    24, 72, 34, -4, -39, -82, 75, -43, 34, -34, -65, -13, -35, -4, -27, 21,
+    90, 36, 7, 100, 31, 43, 9, -49, 40, 3, -51, -58, 100, 97, 60, 37,
+    -10, 19, -38, 66, -23, -69, 102, 37, -42, 21, 93, -14, 38, 101, 127, 61,
+    22, 60, 16, -39, 25, -30, 23, -32, 72, -5, 113, 43, -21, 39, 19, 90,
+    68, -69, 73, 41, -33, -9, 55, -38, -6, -12, -69, 56, 90, -27, 8, 25,
+    0, -30, 85, 50, 81, 26, 1, 14, 16, 22, 6, -1, -34, 7, 34, 100,
+    15, -15, 1, -39, 82, 94, -10, 6, 16, -10, -25, 45, 55, 100, -25, 81,
+    93, 38, 24, 127, -44, 11, 78, 113, -48, -31, 20, 60, 16, 3, 37, -15,
+    -36, 36, 92, 40, 23, -16, -43, 106, 61, -48, -17, 85, 1, 40, 29, -25,
+    -8, 38, 39, 11, 26, 6, 17, -8, -36, -14, 114, 92, -84, 83, -7, 20,
+    -39, 27, 49, -75, -15, 42, 43, -43, -24, 48, -15, -27, -92, -33, 41, -60,
+    102, 75, -66, 75, 38, 33, 8, 86, 35, -86, 71, -32, 98, -49, 70, -40,
+    91, 12, -35, 95, 105, 66, 127, -8, -14, 41, -23, -18, 28, 1, 89, 93,
+    -11, 46, -54, 1, -44, 76, 101, -13, -25, 107, 56, -10, 106, -44, -70, 33,
+    -41, -18, 111, 32, 42, -26, 58, 119, -52, 63, -59, -8, 127, -36, 24, -40,
+    -15, 36, 106, 71, 6, -30, -52, 27, -67, 7, 65, 32, -44, 74, -36, -2,
+    -44, -35, 80, -7, 103, 69, 8, 44, 26, -28, 32, 79, 59, 55, -60, 20,
+    46, -64, 59, -21, 11, -79, 79, -26, 21, 70, -11, 109, -49, 37, 85, 4,
+    40, 14, -28, -19, -46, -20, 97, 60, 116, -5, 12, -10, 32, -59, 112, 27,
+    16, 66, -12, -80, -83, 32, 107, -9, 47, 28, -3, 118, 24, 13, -32, 103,
+    -52, 87, -69, -52, -78, 96, 93, -61, -43, -3, 127, 104, 123, -7, -84, 21,
+    -61, 58, 124, 51, 25, 107, -41, 126, 34, -1, 123, 81, -16, 127, -19, 83,
+    105, 4, 48, 12, -12, 74, -18, 69, 76, -83, 71, 89, 35, -36, -81, 95,
+    63, 55, 79, 73, 36, -11, -15, 118, -32, -40, -3, 78, 112, 71, -15, 47,
+    64, 40, 97, 65, 41, -32, -36, 122, -44, -38, -44, -19, -18, 94, -1, -56,
+    -39, 27, 64, 55, -23, -5, 75, 103, -7, 119, 92, -45, 57, 68, 58, 45,
+    61, 108, 28, 10, 20, 68, -48, -21, 9, 120, -2, 23, -11, 74, 22, -26,
+    -35, 63, 72, 123, 74, 84, -23, -5, -34, -5, 18, 10, 101, 114, 67, 60,
+    109, -26, -5, 99, 88, 77, 11, 127, 21, -59, -5, 82, 89, 97, 76, 52,
+    -69, -67, 109, -15, 29, 33, -76, -54, 22, 88, -76, -18, 100, 59, 95, -75,
+    54, 94, 81, -19, -31, -24, -69, 110, 4, -76, -42, 71, 73, 21, 84, 44,
+    78, 49, 73, 6, 56, -51, 69, -62, 17, -48, 49, -53, 115, 127, -36, -65,
+    16, 87, 53, 102, 52, 22, -42, -25, 42, 62, 47, 106, 16, 13, 60, -72,
+    12, 38, -52, -64, 33, -34, -68, 85, 82, 22, 17, -47, 85, -36, -49, 96,
+    -58, 75, -51, 96, 0, 112, 54, 112, 49, 104, -23, 102, 20, 44, -69, -4,
+    67, -3, 45, -49, -20, 27, 60, 69, -44, 1, 13, 94, 62, -47, -72, 43,
+    -63, 127, -35, -64, -81, -84, 66, 18, 29, 89, 35, -14, -34, 93, 124, -27,
+    10, 95, 105, -101, -2, 60, 49, -23, 123, -14, -22, 48, 22, 11, -10, -27,
+    -31, -49, 104, 107, 69, -80, -37, -21, 74, 39, -79, -16, 64, -70, -21, 127,
+    -38, 82, -17, 6, 106, -84, -53, 0, 89, 0, -83, -19, -86, -97, -70, 17,
+    61, 91, -62, -38, 24, 35, -25, 15, -28, 42, 27, -38, 88, 84, -98, 81,
+    41, -22, 1, -53, -28, -27, -54, -7, 18, -29, -39, -52, 1, -39, -42, -31,
+    -29, -36, -52, 127, -26, 52, 3, -38, 19, 110, 18, 14, 10, 117, 37, 5,
+    67, 97, 90, 1, 7, 13, 90, 71, 92, 93, -9, 9, 30, 55, 80, -25,
+    -24, -38, 49, 9, 2, -55, -4, 44, 34, 48, 21, -43, 70, 47, 49, -37,
+    -33, 6, 78, 0, 44, -35, -13, 45, 90, 27, 85, 76, 127, 30, 2, 29,
+    12, 84, -5, -83, 109, 6, 0, -19, -71, -42, 53, -41, 115, 18, -24, -63,
+    68, -53, 92, 83, -53, -59, 48, 89, 39, -12, -18, -72, 60, -25, 90, 100,
+    17, 54, 101, 5, 108, 124, -24, 16, 87, 37, 49, 99, 85, -54, 120, -6,
+    12, -22, 89, 44, 61, -15, 87, -27, 107, 37, 9, 25, -32, 58, 47, 46,
+    -55, 97, 101, 42, 119, -25, -15, 74, -2, 61, -38, -48, -6, 52, -17, -28,
+    68, 39, 2, 29, 23, 117, 15, 127, 80, 22, 63, 3, 59, 5, -28, -60,
+    104, 88, -70, 11, -32, 68, -24, -11, -52, -19, -58, 6, 84, 25, -3, 16,
+    22, 5, 27, 5, 26, 58, 14, -50, 43, 122, 93, 118, 46, 47, 50, -7,
+    63, -49, -41, 26, 50, 29, 71, 83, 8, -10, 119, -34, -52, -44, 62, 87,
+    11, -57, 127, 82, 92, 119, 41, -13, -40, -8, -64, -17, 60, -1, -51, 117,
+    78, 6, 61, 10, 76, 50, -37, -23, 10, 103, -58, 113, -42, 22, -59, -74,
+    118, 79, 80, 121, 102, 51, 83, 16, 122, -32, 24, 29, 41, 31, -58, 53,
+    3, -31, 46, 6, 104, -29, -14, 11, -45, 75, 17, -15, 13, 106, 25, 60,
+    17, 27, -28, 30, -38, -1, -12, -20, 67, 127, 46, -2, 26, 121, 18, -50,
+    105, 103, 54, 44, 35, -52, 15, 58, -36, 65, -22, 26, 53, 22, -68, 76,
+    38, 25, 21, -46, 96, 95, 0, -64, 97, -55, 9, 44, -11, 60, -6, 67,
+    44, 47, 61, 5, 101, -30, -63, 127, -66, -17, -6, 41, 61, 87, 7, -35,
+    25, 16, 33, 87, -73, 6, 56, -15, 9, -22, -32, 8, -16, 113, 43, 25,
+    71, -31, 22, -39, 47, -66, -68, 50, -10, 79, 41, 96, 59, 2, 101, -14,
+    -7, 95, 125, -19, 105, 88, 86, -72, 82, -73, -62, 89, -16, 65, -36, 119,
+    -67, 49, 109, -60, -80, -73, -70, 36, 102, 127, 3, -112, 84, 93, -5, 9,
+    41, -80, -79, -28, -7, -5, -18, 68, 61, -19, 88, -27, 63, -17, 93, 55,
+    117, -104, 127, -2, 25, 84, 83, 75, 62, -9, -86, -67, 2, 40, 25, 84,
+    -49, 2, -36, 65, 101, 80, 7, -27, 105, 65, -16, 26, 36, 42, -24, -63,
+    -9, 25, 35, 68, -16, 22, 45, -63, 27, -58, 88, 20, -20, 50, -20, -63,
+    -7, 39, 113, 126, -59, 48, -44, -13, -17, 86, -73, 1, 35, 108, 66, 94,
+    41, 15, -31, -8, 93, 33, 106, -65, 127, -25, 87, -21, 24, -23, -21, -43,
+    111, 12, -1, 98, 94, 118, 35, 0, 102, 61, 85, -66, 83, 75, -45, -38,
+    -50, 58, 117, 44, 97, -33, 76, 31, 25, -29, 74, -17, 7, -30, 110, 15,
+    19, 113, -66, -51, -30, -12, -64, 11, -67, -52, 86, 110, 28, 67, -4, -49,
+    55, -44, 82, -33, 127, 110, 30, 5, 37, -31, -72, 57, 64, 27, -52, 32,
+    75, -30, 103, 51, 44, 31, -91, 117, -42, 63, 80, 67, 17, -53, -62, 47,
+    91, 87, 35, 105, 99, -35, -59, -2, -26, 10, -58, 102, 92, 9, -6, -5,
+    23, 46, -71, 51, -42, 76, 72, 69, 22, 127, -10, -35, -81, 77, 32, 58,
+    -46, -43, 8, 61, -7, -1, 4, 100, -86, 46, 62, -50, 59, -67, -36, 79,
+    95, -25, 36, -8, -67, 53, 40, 20, 103, -34, 32, 20, 66, -17, -53, 27,
+    86, 5, 72, 10, 86, 87, -39, 12, 82, -2, 85, -59, -80, 37, 63, 64,
+    48, -2, -64, 53, 21, -46, -21, 58, -38, -57, 55, 30, 4, -20, 19, 6,
+    -10, 10, 31, 74, 127, 27, 47, 110, -46, 26, 71, -7, 80, -24, -17, -7,
+    69, 64, 43, 81, 81, 30, -22, 112, 81, 95, 103, 103, -14, 101, 123, -38,
+    -20, 30, 45, 2, 67, 124, 123, 28, 2, -73, 104, 70, -8, 78, 98, 127,
+    73, 90, 39, -45, -17, 81, -58, -87, 66, 20, 3, -22, 3, -47, 77, 7,
+    26, 111, -69, -52, 69, -47, 58, 100, 50, -85, 24, 1, -46, 35, 124, 100,
+    14, 74, -50, -2, 30, 79, -26, 79, 86, -22, 99, 36, 28, 127, 120, 43,
+    -30, -24, 23, -12, -20, 77, 70, -42, 61, 73, 13, -23, 33, 52, 12, 78,
+    14, 77, 77, 74, -1, -48, 83, -55, -18, -45, -21, -17, 107, 76, 75, 102,
+    -56, -39, 37, -34, 38, 58, 90, -35, -51, 4, 66, 42, 96, -17, -5, 67,
+    -25, 82, 84, 41, 18, -33, 5, 119, -1, -46, 45, -64, 96, 13, 77, 16,
+    28, -67, 79, 69, -39, 112, -61, 60, 22, 100, -68, -31, -12, -35, -74, 17,
+    -18, 127, 14, 51, -22, -47, 44, -12, -28, 25, 79, -49, 78, 58, -50, -31,
+    -10, -7, 67, 27, -76, 113, -36, 69, 93, 11, 3, 74, 56, -20, 103, 4,
+    35, -15, -16, -30, 72, -33, 127, 35, 83, -22, 88, 97, 114, -57, 1, 110,
+    103, 59, 57, 80, 10, 63, -43, 50, -6, -47, 53, 57, -46, 13, 61, -15,
+    -29, -3, 38, -41, 9, 106, 72, 88, -13, -33, -13, 60, 89, 42, 48, 65,
+    27, 37, 19, -42, 122, 116, 34, 11, 63, 27, -51, 110, 74, -16, -45, 11,
+    5, 88, 127, 11, 86, 4, 22, 18, 71, 66, -3, 91, -13, 91, 11, 47,
+    6, -34, 96, 8, 61, 89, -51, -17, -9, 78, -3, -19, 126, 109, 74, -19,
+    72, -13, 103, -26, 9, 93, 111, 85, 104, 35, 8, -61, -30, 101, -10, 73,
+    115, 109, 80, -34, 89, 40, 4, 17, -9, 9, 72, 31, -24, -26, 123, 59,
+    79, 126, -119, -87, -11, 93, -67, 25, 100, 34, -31, 12, 3, 94, 69, 62,
+    -78, -17, -49, 15, 127, 73, 76, 118, -20, -66, 100, 92, -46, 59, -47, 85,
+    -8, 79, 103, -89, 78, 91, 1, 48, 2, -21, 48, 26, 124, 86, 53, 27,
+    78, 27, -56, 4, -16, 98, -8, 25, 79, -54, -48, -34, -3, -71, 67, 64,
+    79, 61, 7, -61, -14, 122, 76, -59, -12, 54, -59, 43, 79, -8, 46, 63,
+    -30, 127, 22, 85, -39, 54, -68, 24, 0, 82, 19, 114, -53, -85, 111, -10,
+    31, 53, -23, 32, -39, -10, 111, 32, -101, 126, 63, -3, -70, -59, -12, 120,
+    67, 110, 63, -44, 120, 94, 29, 86, -47, 39, -6, 52, -52, -24, 74, 86,
+    71, 22, -53, 110, 90, 99, 33, 43, -11, 54, 35, -47, 74, 107, 101, 19,
+    3, 75, 78, 7, 90, -32, 113, -43, -57, -51, 82, 127, 114, 104, 83, 94,
+    88, -31, 121, 7, 31, -63, -29, 99, -36, -10, -46, -43, 11, 34, 89, -22,
+    112, -63, 121, 44, 44, 73, 71, 40, 80, -32, -17, -10, 97, 44, -68, 95,
+    121, 49, 8, 8, 4, -29, -59, 104, 14, 104, 89, 8, -42, -68, 18, 88,
+    74, 5, 72, -15, 7, 116, 96, -24, 47, -46, 127, -50, -19, -53, -59, 84,
+    -56, -56, 6, 65, 97, -8, 56, -3, 51, 79, 23, -1, -7, 81, -59, -40,
+    -53, -60, 13, 41, 21, 59, -14, 15, 83, 65, -54, -37, 89, 32, 118, 62,
+    95, 7, 43, 112, 43, 46, 42, 51, 63, 24, -76, 86, 109, -61, 127, 33,
+    76, 28, 27, 70, 99, 66, -61, 123, -7, -42, 29, 74, 18, -8, -25, 21,
+    -50, -26, 33, 30, 93, -65, -62, 87, 22, 98, -57, 47, 114, 76, 97, 62,
+    99, 92, -39, -92, -22, -6, 96, 93, 17, 94, -9, 29, 9, -13, -3, -5,
+    -3, -53, 117, 76, 91, 5, 77, 108, -59, -10, -22, -74, -69, -61, 98, 8,
+    67, -62, 113, 116, -63, 72, -27, 20, 103, 127, -24, 89, -60, 76, 77, -25,
+    88, 39, 58, 90, 101, -2, 89, -46, -72, -56, 100, -42, 97, 49, -37, 67,
+    14, 20, 33, 58, 85, 18, 14, -76, 27, 91, 26, -79, -82, 16, -53, -37,
+    -20, -64, -41, -22, 7, -65, 60, 72, 11, 75, 109, -42, -24, -32, 16, -10,
+    64, -72, 57, -17, 17, -7, -70, 127, 41, -39, -69, 35, 80, -16, -64, -51,
+    122, -2, -42, -38, 7, 41, -103, 108, 20, -106, -8, -97, 65, 17, 40, -86,
+    -101, 26, -84, 90, -4, 14, 83, 91, 36, -53, -85, -4, -60, 62, 44, 9,
+    5, 92, -83, -103, -9, 20, -102, -5, -89, -121, -1, -127, 123, 95, 74, 96,
+    60, -23, 19, 50, -79, -43, -48, 17, -82, 14, -37, -42, 57, -108, -66, -33,
+    -76, 67, -8, -124, 65, -7, 66, 102, -39, -91, 14, 103, 30, 111, 77, -36,
+    -123, -32, 91, 51, 49, 11, -66, -102, 60, -1, 4, -96, -98, -12, 62, -33,
+    -34, 102, 1, -21, 90, -6, 16, 73, 127, -46, -47, 99, -9, -7, 109, -56,
+    32, 85, 76, -62, 95, 91, -67, 116, -24, 77, -5, 18, 58, -93, 70, -10,
+    2, -57, 77, 85, 8, 33, -49, 45, 23, 54, 91, 27, -24, 58, 46, -45,
+    -26, 62, -33, 73, -50, -64, -9, 82, 59, 31, -34, 40, -45, 34, 37, -8,
+    113, 77, 89, -4, 72, -50, 56, 27, -53, 103, 75, 21, 123, 66, 85, -56,
+    -51, 89, -38, 32, 102, 63, 91, 100, 91, 4, -51, 99, -63, -54, 34, 47,
+    -5, -25, 96, 88, 122, -22, -7, 72, -3, 63, 93, 39, -9, 123, 127, 96,
+    126, 15, 104, 44, -17, 45, -44, 18, 115, 63, 114, -14, 70, 92, 69, 32,
+    7, 24, 85, 35, 6, -12, 58, 118, 37, -42, 27, -34, -25, 116, 91, 32,
+    83, 71, 90, 17, 127, -51, -50, 0, 69, -1, 52, -23, 18, 33, -29, 3,
+    44, 18, -12, 40, -33, -46, -69, -32, -31, -34, 68, -7, 48, 58, -35, 31,
+    -28, 116, 109, 18, -12, 81, -14, 49, 102, 44, -34, 110, 103, 10, 37, 98,
+    -61, 108, 34, 79, -3, 107, 120, -75, 42, -60, 19, 15, 74, 12, 79, 26,
+    -66, -26, 82, 74, -25, -5, -59, -11, 73, 31, -16, -28, 104, -26, -16, 127,
+    28, 72, -15, 32, -42, 77, 43, 87, -69, -22, -41, 46, 88, 61, 89, -23,
+    41, 41, 4, -37, 89, 119, -88, 39, 29, 113, 42, 92, -46, 99, -11, -25,
+    121, -16, 121, 87, 18, 10, -60, -36, -9, 80, 31, 127, -86, 25, 57, 65,
+    75, -40, 4, 21, -14, 89, -81, 82, 43, -23, 95, 42, -1, 61, -79, 5,
+    48, -70, 83, -21, 25, 73, 0, 78, 58, 53, -37, -45, 68, 16, 43, 50,
+    41, 122, 73, -32, 71, 77, 89, -28, -33, -44, 28, 51, 8, 36, -30, 26,
+    34, 120, 25, 91, 53, -20, 31, -9, 85, 38, 101, -67, -6, 88, 80, 100,
+    24, -57, -6, 13, 50, -27, -6, -57, -47, -23, 19, 54, 1, -28, 126, 64,
+    104, -10, 31, 101, 99, 126, 63, 17, 115, -62, -91, 45, 97, 127, 112, 106,
+    10, -44, -21, 97, -72, -48, -32, 16, 118, -56, -42, 32, -61, 35, 36, -68,
+    -45, 127, 9, 54, 11, -54, 82, -8, 60, 120, 91, -68, -17, -28, 98, 73,
+    103, 41, 37, 13, 67, 52, 79, 88, 67, 29, 94, 83, 106, -43, -10, 94,
+    -62, 101, 40, 48, -43, -38, -39, 7, 42, -68, 20, -52, 14, 26, 73, 12,
+    -47, 106, 46, -29, -62, 28, 10, -9, 38, -29, 88, 67, 34, 43, 51, 42,
+    7, 9, -22, 127, -63, 79, 56, -51, 19, 14, 14, 102, -35, -46, -18, 127,
+    -58, 60, -5, 68, 51, 94, 113, -51, -6, 44, 76, -63, 21, 82, 56, -61,
+    -5, 32, 37, -28, -70, 68, 52, 120, -57, 115, -70, 98, 13, 13, 77, 15,
+    34, -19, 68, 34, 19, -37, -26, -9, 108, 106, 73, -8, 62, 82, -41, 57,
+    -41, 121, 42, -41, -13, 84, 29, 120, -40, 94, 107, -10, -2, 66, 53, -62,
+    79, 107, -2, 114, 127, 79, 84, 72, 38, 110, 84, 35, -29, 83, 19, 127,
+    53, 104, -51, -6, 82, -43, 102, -22, 78, 96, 90, -19, 115, -14, 49, 67,
+    49, 12, -26, 52, 49, 44, -41, 72, -14, 10, 26, 31, 84, 126, -44, 67,
+    -39, -21, 116, 102, -32, 17, -25, 68, -20, 7, 103, -35, 73, -85, -5, 9,
+    19, 16, 33, 23, 18, 12, 36, 86, -61, -36, 11, 109, -92, -14, -27, -90,
+    -23, -76, 75, 127, 8, 32, -22, 52, 108, 12, 23, -99, -25, -39, 2, -125,
+    1, 33, -12, 0, 114, 35, 97, -40, -89, 47, 26, 30, -89, 39, 53, -61,
+    79, 39, 81, 3, 63, 4, 28, -65, 79, -26, -79, 3, -2, -54, 31, 124,
+    -33, 89, -22, 37, 127, 109, -63, -49, -54, 123, -16, 57, 13, 117, 1, -6,
+    -10, 64, -8, -35, -58, -61, -69, -28, 90, 89, 92, 17, 76, -52, 39, -50,
+    -45, 15, -31, -7, 3, -9, -58, 45, 106, -6, -67, 7, 27, 97, 68, 42,
+    -24, -76, 39, 72, -45, 38, -24, 4, 124, 116, -20, 43, 37, 127, 81, -16,
+    88, 102, 75, -25, -20, 41, 17, 90, -19, 43, -57, 108, -76, 75, 25, 7,
+    116, 48, 45, 37, 4, 70, -53, 3, 106, -11, -29, -70, 3, 88, 88, -55,
+    101, -61, 19, -41, -34, -49, -80, 43, -76, 101, -44, -4, 120, 105, 1, -4,
+    107, -34, -68, -40, -27, 76, -55, -3, -62, 81, -79, 44, 111, 47, 90, 68,
+    -32, 56, 83, 45, 127, 86, -1, 63, 10, -27, 52, 68, -50, 100, 63, 103,
+    -30, 115, 19, 82, -28, 84, 99, -94, -50, -49, 9, -39, 15, 66, -55, -38,
+    36, 65, 90, -73, 57, -56, -41, -26, -39, 77, -14, 20, 52, -38, -51, -3,
+};
+
+static const int8_t _L7_recurrent_weights[16384] = {
+    -75, -10, -26, -51, -7, 57, 3, -12, -29, -20, 29, 10, 16, 57, -10, -67,
+    -1, 19, 14, -70, -28, -102, 46, 24, -27, 1, 38, -13, -18, 70, -54, 68,
+    20, 3, -34, -127, 50, 72, 7, 16, 17, -46, -26, 23, 2, 70, 29, 47,
+    39, -47, -12, 75, -16, 22, -41, -64, 0, -6, 7, 7, -7, 93, 17, 4,
+    -82, 32, -17, 85, -127, 3, 41, 5, 24, -17, -47, -38, -5, 16, -53, 12,
+    -7, 62, -18, 89, 50, -27, 37, -89, 33, 88, -60, 26, -28, 86, -39, -8,
+    -29, 3, -61, -38, 30, 102, -56, -86, -62, -29, 41, 73, -47, -19, -32, -14,
+    15, 1, -96, 28, 8, 10, -30, -41, 17, 25, 8, -14, -55, -118, 10, 22,
+    -59, -12, -50, -47, -52, 31, 127, -55, -27, 5, -50, 10, -25, 71, -56, 74,
+    41, 20, -43, 6, 49, 57, -38, 19, -5, 1, -53, -20, -13, -59, 26, -16,
+    37, -24, -103, -61, 46, -1, 14, -34, -83, -38, -8, 60, 21, -115, -26, 1,
+    56, -34, -76, 91, -43, 49, 1, 27, 35, 84, 28, 28, 16, 2, -9, -24,
+    -50, -13, -58, -59, 32, 44, -53, -18, -19, -24, 49, 20, 77, -5, 21, 44,
+    -13, -19, 29, 19, -16, 8, -28, 22, 38, -41, -36, -68, 38, -82, -46, -34,
+    -27, -32, 29, -127, -80, -35, 127, -50, -48, 33, 44, -3, 25, -18, -72, -76,
+    29, 22, -62, 24, 7, -28, -18, 66, 73, 41, -49, -27, -20, -59, -36, 15,
+    -1, 2, 9, 22, -49, -17, 6, -15, -6, -19, -52, -58, 33, 35, -31, -16,
+    17, 37, 37, 58, -11, 21, 69, -9, 18, 50, -4, -46, 62, -41, 59, -38,
+    -17, 11, 9, -14, 95, -26, 78, 53, -19, -30, 28, 14, -84, -31, -9, 5,
+    17, -51, -61, 44, 9, 89, -32, -26, -15, 21, -127, -15, -2, -41, -12, -32,
+    91, -56, 25, -23, 42, 70, 24, 22, -42, 25, -4, -84, -17, -49, -21, 42,
+    -38, -6, 29, -7, 69, 28, -76, 52, -14, -5, 2, 3, 27, -79, 38, 42,
+    58, 0, -99, 0, 41, -40, -51, 53, 45, 3, 78, 9, -127, -31, -21, 2,
+    4, -33, -13, 98, 0, 53, -46, 17, -35, -4, -45, 12, -53, 10, -19, 50,
+    33, -31, -51, -40, 48, 59, -9, 2, -29, 35, 50, -59, -20, 62, 14, -27,
+    -127, 69, -7, 9, 20, 54, -88, -48, -52, 34, -53, -8, 22, 2, 7, 35,
+    -52, 73, -11, 6, 59, -41, 87, -62, 16, -11, -35, -46, -2, -74, -68, 23,
+    59, -46, 70, 114, -10, 40, -39, -36, -34, 124, -43, -89, -123, -25, -89, -54,
+    -80, 3, 8, -51, -33, 9, 7, -56, -74, -6, -7, -2, -17, 60, 63, 46,
+    -13, 15, 10, -11, -33, -6, -12, 43, -119, 95, -54, -9, -62, -52, 5, 56,
+    113, -50, -90, 1, 54, -27, 1, 3, -41, 61, 51, -11, -72, -11, -91, 11,
+    -64, -54, -64, 127, 13, 35, -28, 71, -28, -15, -39, -12, -69, -27, -10, 43,
+    3, -24, 34, 96, -17, 106, 33, -101, -49, -38, 72, -127, 49, -38, -53, -13,
+    -30, 30, -79, 10, 10, 52, 7, -26, -25, 3, -28, 11, -45, -1, 68, -67,
+    100, -11, -41, -92, 103, -10, 63, -109, -2, -17, 33, 13, 33, 3, -25, 11,
+    -17, 28, -106, -26, -49, -20, 18, -47, -47, 80, -18, 80, -3, -86, -70, -75,
+    4, -13, -38, -1, -47, 28, 36, -40, -77, 8, 56, -11, -27, 74, -43, -54,
+    -5, 26, -84, -48, 32, -13, -45, -7, 23, 85, -53, -22, 83, -47, -70, 121,
+    89, -11, -7, 35, 49, -3, 59, -17, -64, 3, 53, 102, 39, -108, -52, 17,
+    45, 16, -65, -31, -92, -31, 15, -33, -53, 4, 20, 28, -52, -21, -98, -127,
+    -85, 5, 14, 10, -90, 103, 76, -79, -100, 103, 31, 26, -19, -75, 1, -8,
+    23, 24, -23, -8, 88, 36, -7, -60, -97, 25, -76, 19, 69, -92, -30, -51,
+    74, -4, -48, -81, 44, -6, -6, -24, 20, -25, -27, -1, -23, -123, -19, 62,
+    -79, -109, -49, 65, 84, -22, -40, 117, -70, -12, -82, 127, -36, 55, -3, -1,
+    -34, 19, 4, -40, -23, 53, -39, -10, -7, 32, 8, -22, -94, 127, -70, 21,
+    -42, 21, 14, 11, 36, -14, 15, -37, 2, 18, 47, 48, -49, -30, -10, -6,
+    50, -22, 17, 19, 73, 45, -18, 83, 62, 52, -80, 59, 55, -23, 47, 124,
+    49, -46, 17, 10, 74, 1, 4, 2, 58, 5, 17, -31, -28, -50, -8, -14,
+    -116, -98, 2, -7, -69, -39, 11, 48, 7, -2, -89, -4, -44, 45, -3, 28,
+    -63, 32, -37, 10, -1, 59, -12, 12, -112, 10, -60, -67, 23, -18, 2, -14,
+    79, -5, -103, 25, 127, -121, 23, -32, -91, 3, 79, -35, 6, -78, -79, -91,
+    49, -120, -75, 53, -49, -20, -65, 20, -69, 28, -16, -24, -12, 4, 48, -50,
+    -119, -75, 37, 10, 14, -39, 63, -71, -15, 110, 106, -92, -2, 46, 1, -29,
+    -20, -80, -24, 114, 60, 73, 40, 80, 27, -24, -7, -5, -127, -14, -29, 61,
+    68, 7, -38, -101, 58, -86, 2, -10, 7, -59, -4, 94, 6, -1, -81, -6,
+    47, -45, -13, 56, -7, -4, 12, 37, 26, 17, -77, -87, -117, 56, -43, -23,
+    -62, 73, -64, 30, -27, 75, 57, -56, 15, 21, 26, 12, -6, -35, -46, 21,
+    41, 22, -72, 26, 58, 58, 20, 70, -16, 63, -59, -52, -5, -2, -38, -9,
+    -11, -14, -86, -14, 77, -29, 32, 26, -37, -20, 5, 83, -34, -29, -16, -103,
+    18, -77, -51, 45, 33, 47, -29, -10, -62, 24, -59, 66, -127, 16, 30, 3,
+    -25, -42, 18, 48, -83, -28, 77, 101, -13, -35, -87, 79, -11, 9, -28, 95,
+    53, 25, -31, 127, 103, 35, 116, -11, -27, -47, 20, 63, -125, -18, 9, -24,
+    33, -30, -3, -13, 19, -5, 5, -2, 46, -80, 71, -34, -2, -29, -63, -41,
+    -21, -99, -50, 82, -36, 123, 50, 17, -112, -16, -31, -46, -42, 38, -49, -7,
+    95, 31, 32, -49, 37, 3, 105, -6, -54, 15, -6, 9, -21, -30, -10, 76,
+    -88, 49, -36, -46, -9, -22, -66, -60, -8, 42, -84, 56, -2, -50, -44, -15,
+    8, -5, -17, 2, 127, -19, 41, -67, -56, -9, 70, 11, 48, 28, 22, -53,
+    38, -3, -47, 89, 26, 30, 17, -45, -46, 36, 23, -27, -50, 8, -14, -22,
+    -52, -102, -12, -8, -72, -63, -3, -82, -25, -51, 19, -15, 43, 37, 26, -51,
+    28, -24, -18, 56, 23, 87, 5, -22, -28, -3, -77, -56, -7, -25, -30, 70,
+    41, -15, 8, 42, -42, 84, 19, 79, -20, -1, 41, 27, -49, -38, -31, 90,
+    -127, -80, -87, -56, 2, -13, -14, -8, -120, 76, -36, -44, -44, 32, 62, 25,
+    1, 9, -120, -52, -96, -30, 26, -17, -22, -35, 45, -3, -72, 87, -4, 17,
+    52, 125, -18, -43, 68, 72, 51, -30, -127, 82, -31, 26, -1, 60, -99, -47,
+    49, -68, -25, -27, -49, 91, -48, 14, -78, -35, 65, -3, 20, -82, -56, 6,
+    -42, -38, -78, -42, 103, 66, 54, -28, -47, 6, -42, 68, -12, -29, -61, -11,
+    -93, 36, 24, 5, -44, 49, -52, -45, -48, 34, -58, 89, -88, 0, 7, 18,
+    16, 58, 15, -7, -58, 70, -64, -11, 42, 76, -60, 50, 18, -67, 13, 106,
+    -64, -25, -20, 33, 49, 14, 18, 29, -9, -31, 64, 95, -100, -99, 12, 29,
+    -34, -54, -6, -9, -14, -13, -121, 12, -26, 23, 23, -17, -50, 3, -16, 127,
+    -76, -94, -27, -20, -46, 127, -28, -9, 7, 48, 41, -52, -27, 83, 36, 27,
+    -23, 68, -50, -11, 93, 71, 35, -40, -60, 68, 12, -1, -5, -16, -24, 81,
+    47, -109, -8, -25, 46, 8, 31, -32, -43, -37, 19, 55, -10, -34, 10, -53,
+    86, -51, -46, 43, 10, 34, -1, 32, -6, -14, -17, -11, -15, 2, -16, 13,
+    9, -40, -94, -72, -28, 3, 73, 26, -49, -14, 45, -7, 11, 34, 26, 59,
+    -65, -28, -127, -27, 31, 75, -49, -21, -43, 82, -9, 13, 36, 114, 42, -41,
+    12, -54, -60, -26, -24, 1, 4, -18, -95, -22, -10, 74, -1, -3, -32, 5,
+    29, -30, -7, 67, -59, -57, 7, 115, 0, 62, -45, -90, -65, -22, 83, 45,
+    -41, 18, -6, 1, -66, -15, 5, -81, -61, -19, 29, -55, -127, -2, 10, 14,
+    -33, 15, -67, 84, 26, 9, 66, -19, 24, -14, 11, -9, -79, 24, 15, -35,
+    -1, 34, -39, -57, 8, 14, -27, 19, 53, -6, 96, -19, -103, -17, 82, -33,
+    8, -115, -15, 86, -43, 9, 17, 46, -48, -9, -75, 31, 58, -64, -14, 64,
+    -127, -46, -61, 6, 39, 103, -104, -33, -108, -25, 34, -30, -61, -41, 54, -23,
+    -43, 32, -26, 64, 15, 33, -28, -8, -79, 92, -64, -41, -41, -30, 31, 82,
+    13, 5, 56, 87, -114, 11, 77, -60, -60, -14, 48, -23, -51, -114, -8, 83,
+    -59, -126, -24, 23, 13, 19, -83, 24, -14, 74, -48, -29, 28, 73, 94, -72,
+    -7, -12, 31, 35, 7, -72, 65, -43, 82, 11, 99, 35, -60, -3, -63, 15,
+    78, 107, -61, 45, 5, 28, -26, 23, 15, -75, -31, 8, -8, 100, -51, -66,
+    127, 19, -26, -39, -4, 32, -105, 8, -40, 77, 80, 20, -7, -23, -4, 3,
+    -11, -12, -65, 68, -37, -36, -41, 74, -80, 35, -117, 0, -118, -17, -6, 28,
+    -10, -80, -24, 42, -102, -57, 81, -1, -86, 17, -58, -49, 89, 81, -8, 90,
+    15, 5, -28, -7, 23, 115, 37, -18, 2, 127, -77, 45, -26, -28, -34, -57,
+    21, -20, -85, -86, 27, 3, -56, 63, -26, -3, -46, 66, -38, -74, 109, 117,
+    77, -51, -88, 73, -73, -12, -45, 50, -86, 29, 45, -13, -65, 16, -4, 7,
+    34, -27, -75, -43, -29, 51, 19, -43, 2, 12, -33, 37, -37, 21, -81, 39,
+    117, 64, -97, -69, 51, -14, 20, -9, -11, -90, 59, -57, -7, -96, -23, -88,
+    -46, -3, -35, 16, 83, 23, 8, -65, 54, -22, 50, 29, 43, 7, 51, -92,
+    10, 31, -20, -18, -101, 50, 32, 0, 44, 62, -127, -97, -100, 59, 4, 6,
+    -58, 101, 35, 18, -11, 25, 34, 44, -55, -68, 70, 18, -6, 50, 66, 31,
+    -78, 100, -5, 21, -15, 3, 43, -43, -17, -127, 11, 0, 1, -10, -69, -8,
+    31, -32, -80, -2, 23, 66, 53, -59, -69, -97, -42, 6, -46, -16, 37, 64,
+    -16, -113, -34, 39, -32, 31, -48, -46, 7, -3, -33, -22, -9, -13, 7, 0,
+    1, -32, 0, 12, -29, -23, 45, 21, -109, 45, 106, -102, -24, 24, 29, -53,
+    31, 59, 40, 127, 71, 2, -76, 82, 35, -10, -30, 43, 26, -77, -8, -20,
+    65, -8, -51, 53, 42, -46, -19, 40, 29, 45, 27, 77, -55, -33, 89, -37,
+    -20, -90, 22, 78, 57, -8, 22, -63, -35, 86, -38, -86, -56, -17, 40, -28,
+    -66, 0, 60, -15, -68, 17, 30, -47, 15, 21, -68, -102, -64, 0, -93, 120,
+    -19, 93, 18, -14, 10, 15, -55, -55, -111, 8, -30, 49, -62, -28, 13, 31,
+    88, 14, -5, 91, -17, 10, -45, 22, -80, -27, 23, 6, 13, 7, 16, -48,
+    87, -92, -61, 27, 19, 53, -31, 127, 26, 9, -50, 15, 6, -3, 66, 102,
+    7, -10, 35, -6, -1, -99, 61, -121, 28, -67, 34, 2, -17, -14, 127, 58,
+    61, 67, 121, -12, 25, 27, -20, 5, 24, 90, 2, -30, -40, 21, 90, 38,
+    36, 35, 11, -53, -14, 23, -2, -74, -9, -47, 55, 25, -49, 2, -26, -4,
+    64, -9, -42, -126, 4, 72, 50, 59, 73, 27, 12, -19, 10, 23, -14, -3,
+    -84, -44, -26, 1, -27, 26, 108, 66, 46, 2, -12, -2, 7, 19, -127, 22,
+    -95, 62, 28, 39, -17, 57, -31, 32, -63, 35, -89, -87, -26, -10, -23, 60,
+    -18, -48, -45, -15, 39, 64, 87, -51, 19, -62, 4, 23, -81, 5, -34, -85,
+    -43, 1, -13, 37, -63, 55, 101, 57, -19, -2, -16, -18, 10, 16, 32, 8,
+    -114, -31, 36, -57, -83, 49, 24, -99, 4, -3, 55, 11, -49, 63, -87, 4,
+    -21, 63, -117, 16, 127, -37, -44, 23, 40, 94, 31, -42, 6, -45, 71, 13,
+    -10, -44, -47, -54, 49, -22, 13, 41, -62, -46, 61, 45, 56, -9, -63, 57,
+    -18, 17, 18, 115, -62, 22, 32, -27, -33, 20, -67, 46, -54, -92, 14, 26,
+    3, 13, -36, -23, -55, 5, 32, -111, 56, -14, 15, -13, 14, -33, 73, -46,
+    51, -29, 25, -12, -1, 12, 19, 81, 29, -52, -13, 23, 3, -8, -53, 0,
+    14, -49, -42, 50, 34, -45, -51, -11, -23, 18, -26, -67, -26, -57, 39, -59,
+    -20, -43, 76, -45, -68, 0, -25, 127, 38, 19, -66, -1, -51, -9, 61, -108,
+    -20, -44, -8, 41, -29, -18, 46, -67, -28, -26, 32, -127, -46, 8, -46, -3,
+    -68, 42, -25, 29, -13, 24, -11, 4, -26, 58, -2, 30, 13, -35, 42, -53,
+    63, -13, -23, -37, -52, -33, 12, -31, -42, 7, -44, -9, 10, 18, 20, -32,
+    -66, -9, -18, 3, -26, 14, -26, -14, -33, -29, 26, -11, -5, -56, -45, -11,
+    37, 19, -15, 13, -93, 75, 70, 18, -55, 30, -38, -65, 63, 8, 54, -72,
+    -5, -34, -66, -60, 39, 90, -63, 6, 16, 23, -22, -10, -13, -20, -38, -67,
+    62, -52, -18, 62, 29, 38, 108, 26, -54, -127, -96, -26, -10, 14, -39, 77,
+    115, -59, -65, -40, -44, -4, -71, -21, -29, -13, -96, -94, 28, 90, 47, 75,
+    -6, 15, -50, -117, -126, -12, 34, -78, -3, 33, -22, 6, 8, 65, 4, 48,
+    -44, 44, -36, 106, 11, 78, -65, -66, -64, 12, 30, 27, -31, -72, 23, 49,
+    103, 7, 15, -12, 68, 15, 65, 20, -58, 5, 36, 13, -36, -65, -11, 8,
+    -51, -12, -1, -11, -127, -6, -78, 2, 57, 8, -35, 41, -75, -61, -18, 52,
+    -97, 22, -127, 62, -69, 27, 47, -21, 14, 15, -25, -19, -28, 34, -17, 4,
+    -21, -19, 9, 48, -5, 54, -86, 33, -84, 4, 10, 23, 85, -51, 23, 25,
+    7, 40, 11, -2, -10, -80, 9, 83, -43, 16, 60, -11, -32, 16, 36, -19,
+    -51, 27, -5, -24, 30, 25, 32, 18, -22, -8, -41, -28, -10, -24, 31, 11,
+    -37, -4, 44, 101, -40, 76, 77, -44, -32, 106, 6, -127, 83, 40, -24, 25,
+    -26, 16, -84, -71, -26, 35, 50, -25, -12, -21, -100, 8, 52, -12, -16, 30,
+    19, -35, 25, -17, 27, 9, 2, -54, -76, -74, 69, 17, -24, -25, -84, 32,
+    107, -5, 65, 56, -10, 23, 54, -42, -70, -5, 53, 38, -39, 17, 44, 40,
+    -127, 0, -15, 26, -103, 44, 105, -71, -59, -47, -55, -97, -67, 20, 23, 39,
+    8, 31, 54, 71, 47, 63, -34, -15, -40, 56, -53, -79, -88, 5, -4, -9,
+    -23, -73, -66, 34, 69, -23, 67, 38, -42, -57, 35, 79, -87, -79, -67, 3,
+    40, -30, -50, 49, -65, 38, -56, 78, -20, 98, -34, -45, -84, -48, -3, 33,
+    -87, -43, 15, -37, -6, 83, 0, 12, 7, -26, 32, -69, -62, 17, -67, 25,
+    -5, 118, 15, 9, -38, 55, 38, 68, 7, 28, -36, -12, -30, 30, 73, 12,
+    30, -56, -48, -42, -20, -38, -47, 19, -127, -98, 24, 98, 5, -33, 26, 40,
+    29, -57, -31, 4, 47, -5, -62, -4, -118, -72, -23, -39, -25, -42, 34, -15,
+    -78, 6, -21, 10, -28, 34, 42, -114, -77, 64, 41, -61, -91, 42, -23, -23,
+    39, 25, -57, 17, 121, 61, -125, 7, -47, 50, -63, 31, 9, -78, -77, 23,
+    90, 23, -26, -55, 5, -35, -4, -28, -88, -20, 18, 90, -87, 36, -61, -1,
+    5, -57, -102, 61, -22, 127, -40, 27, -26, -59, -54, -34, -53, -34, -31, 4,
+    -100, -90, 18, 0, -48, -14, 23, -42, -27, 27, 95, -69, -39, -10, -84, 55,
+    -35, 55, -49, -33, -3, 21, -14, 15, -61, -61, -53, 107, -71, -51, -59, 63,
+    -26, -25, 3, -19, -33, 22, -126, 2, -94, -72, 10, -2, -86, -73, 31, 35,
+    127, 15, -2, 105, 2, -9, -61, 60, 3, 4, -80, 67, -91, -11, 0, -14,
+    -16, -84, -30, 94, 46, -16, -28, -45, -38, -39, 49, -55, 45, 101, 17, -80,
+    77, 28, 79, -36, 29, -17, 24, -6, 77, 2, -6, -82, -84, 19, -29, 44,
+    75, -67, 11, -99, 3, 127, -34, 78, -67, 4, 50, 26, -52, -31, -45, -47,
+    -11, -78, -12, 3, 2, 40, 21, 85, 1, -84, -7, 22, 7, 26, 25, 78,
+    -54, -18, 0, 22, -18, 23, 10, -2, 12, 11, 42, -63, -23, -16, 66, -9,
+    25, -42, -9, 2, 32, 78, -44, 83, 9, 9, -127, -4, 37, -70, 68, 9,
+    -49, -41, 13, 17, 50, -6, 15, 39, -70, 12, 15, -78, 2, 41, -47, 36,
+    -20, 14, -36, 24, -79, -32, 7, -104, -15, 36, -17, 46, -12, -28, 17, -31,
+    -81, -60, -34, -1, -67, 10, 63, -19, -41, -101, 41, 38, 36, 20, -7, 6,
+    38, 107, -28, -6, 53, 100, -36, 11, -31, 45, -45, -26, -28, 4, -11, 6,
+    -40, 66, -12, 15, 91, 8, -55, 18, -51, 53, -32, -20, -41, -60, 0, -127,
+    67, -19, -25, 26, 18, 62, 7, 73, -60, 17, -56, 23, -50, -61, -12, 10,
+    3, -3, -31, -2, -100, -47, 48, -2, -39, 18, 15, -5, -3, 17, -11, 31,
+    -25, 43, 32, 48, 0, 52, -33, 72, -68, 30, 23, -54, -46, -35, -15, -18,
+    -4, -41, 5, -29, 49, -80, 20, -45, -28, -55, 127, 16, 1, -27, -26, -27,
+    -2, -1, -24, 98, 20, 11, -19, 39, -12, 38, 0, 18, 16, -62, 18, -85,
+    -21, -9, 28, -56, -36, -46, 12, -20, 62, 13, 45, -44, -8, 20, -127, 24,
+    64, 22, -17, -10, -49, 16, -24, 4, -94, 40, -33, 25, -2, -6, 8, 12,
+    47, -45, -46, 7, 23, -36, -13, 0, -64, -11, 39, 4, -9, -5, -39, -19,
+    -30, 85, 23, 7, -17, 23, -41, 31, -11, 40, -40, 37, -41, -34, 9, 60,
+    -73, -22, -41, -20, -3, -75, 28, 82, 12, 1, -99, -67, 75, -16, -78, -21,
+    -21, 127, -3, 68, 50, -51, 28, 94, 12, 3, -35, 45, 15, 13, -36, 11,
+    -7, -45, 79, -53, 82, -58, 70, 47, 97, -8, -36, 79, 4, 24, 28, -44,
+    -19, 3, -61, -20, 37, 14, -15, 82, 12, 71, 30, -39, -110, -33, 2, 18,
+    -65, -43, 65, 2, -25, 31, -65, -27, 64, -5, 33, -40, 3, 2, -47, -127,
+    79, 74, 77, 14, 16, 24, -75, 37, -9, 5, -27, -38, -29, -13, -25, -27,
+    24, 47, 17, -52, 35, 47, -17, -10, 98, -76, -2, 16, 36, 1, -5, 118,
+    86, -76, -16, -6, 32, 4, -2, 23, -11, -44, -30, -11, -17, 13, -72, 29,
+    -10, -48, -25, 63, 6, -16, -30, -7, -40, -9, 67, -88, 63, 31, -6, 73,
+    -37, 75, -51, 9, -39, 6, 75, -20, -39, -19, 50, -12, -39, 29, -19, -45,
+    35, -11, -94, -31, 24, 36, -10, 35, 71, -66, -25, 127, -14, 58, -1, 20,
+    1, 84, -110, -46, -22, 57, -7, 23, 5, -34, 38, -8, 5, -27, 11, 48,
+    -77, -34, -22, 46, 33, -41, 108, -10, 55, 8, 71, -7, -49, 4, 37, 55,
+    4, 59, -8, 40, 46, -25, -60, -40, -13, 50, -89, 16, -11, -29, -9, -44,
+    44, 19, -43, 48, 42, 23, -1, 38, -93, 6, 38, 49, -127, 20, -42, 6,
+    38, -16, -104, 33, -2, 84, -98, 45, 24, -62, -67, -22, -15, -22, 7, -26,
+    -33, -73, -4, 3, -20, 10, 46, -127, -23, -37, -7, 47, -57, 2, -5, 15,
+    43, 24, -37, 48, 35, 20, -34, -29, -59, 21, 5, -94, -15, -47, -34, 14,
+    -14, -86, 10, -28, 48, -4, 32, 18, -50, 13, -12, 11, -23, -12, -69, -33,
+    13, -9, 14, 94, -6, -3, -42, 2, -95, 21, -12, -21, -52, -72, 10, -35,
+    -47, -23, -48, 43, -29, -63, 5, -74, -25, -32, 52, -120, -66, 46, 3, 9,
+    52, 26, -16, 41, 17, 51, 54, -30, 38, -11, -85, -15, -4, -15, -23, 44,
+    -36, -27, -113, -51, 19, -84, -9, 19, -83, -100, 5, 52, -27, -72, -54, -45,
+    -17, 14, -20, 127, 81, -7, 16, 67, -16, -9, 23, -28, -68, 0, 11, 51,
+    -21, 38, -21, -23, -12, -27, -8, 8, -10, -19, 9, -19, -43, 62, -10, 0,
+    -26, 50, -29, 61, 8, 47, 29, 6, -20, -19, 14, 42, -20, -49, -28, -28,
+    5, 12, -25, -7, 16, 0, -7, -29, -53, 0, -51, 46, -11, -24, -8, 17,
+    68, -11, -14, 42, 36, 81, -21, 127, -8, -31, -10, 36, -47, 23, 40, -39,
+    -46, 4, -28, 20, 21, 95, 37, 37, -10, -16, -40, -25, -27, 47, -35, 10,
+    -51, 22, -74, -24, 25, 12, -9, -16, -13, 43, -33, 127, 24, -38, -45, -9,
+    -7, 79, 3, -44, 93, 0, 15, 45, -87, -63, 57, -6, -57, -27, -67, -40,
+    -52, -30, -34, -3, 4, 54, -53, 36, -13, 26, -84, -19, -15, -19, -22, 1,
+    -90, -66, -91, -42, -94, -44, -8, -94, -17, 14, -71, -68, 67, 117, -26, -41,
+    63, -29, -46, 41, 11, 52, 97, 44, -54, -93, -59, -20, 1, 76, 45, -4,
+    -12, -10, -36, 15, -31, -55, 32, -123, 62, -111, -32, 44, -7, -46, -40, 30,
+    3, -112, -79, 127, 20, 42, -81, 13, -40, 58, -35, -64, -8, -123, 62, -13,
+    14, -17, 34, 127, -14, 5, -14, -83, 11, -80, 25, 0, -61, -3, -85, 64,
+    -11, 5, 38, 43, -35, 31, 9, 3, -100, 13, -30, -24, 7, -13, 50, -9,
+    43, 25, -28, -2, 66, 4, -10, 125, -28, -73, 1, 76, -21, -33, 8, 29,
+    20, -4, -14, 70, 70, -36, 20, 31, 16, -1, -52, 32, -24, -54, 45, -57,
+    -12, -26, -20, -39, -31, -23, 63, 1, 3, 38, -24, -60, -70, 43, -28, -22,
+    -31, 32, -15, -28, 18, 55, 10, -76, -56, 54, -79, -42, 127, -59, -23, 48,
+    12, 80, 16, -40, 27, 20, -47, -19, -32, 8, 44, -38, -38, 9, -65, -84,
+    -47, -47, -33, 87, -58, -3, -11, -13, -10, 46, -5, -79, -27, -60, 37, -30,
+    18, 42, 15, -45, -88, 40, 57, -57, -70, 0, -28, -34, 4, -7, -30, -60,
+    19, 70, 15, 51, 38, -32, -39, 73, 12, 29, -1, 32, -41, -5, -19, 58,
+    29, 2, -85, 17, -20, -104, -47, 30, -56, -53, 2, 44, -66, 7, 21, 77,
+    -56, -39, -127, -11, 60, 15, 0, 18, 3, 69, -56, -28, 1, -20, 33, 87,
+    -1, -63, 27, -29, 77, -14, -19, -10, -58, -32, -58, -54, -51, 18, -25, 77,
+    -52, -100, 31, 65, 18, 39, -30, 34, 8, 65, -36, 3, -41, -38, -26, 13,
+    45, 17, 21, 34, 35, 21, -31, -21, -80, -1, 92, 0, -31, -27, -66, -21,
+    20, 30, 24, 41, 19, 51, -18, -12, -60, 37, -35, -41, -41, 62, 127, 18,
+    -4, -17, 20, 73, -40, -9, 66, -65, -103, -24, -15, -16, 1, 45, -28, 57,
+    -62, 119, -62, -45, 53, 86, -9, -22, -81, 102, -16, 68, -1, -45, -92, 18,
+    29, -64, -127, 25, 118, 1, 35, -31, -118, -2, -1, -14, -76, -47, -14, -26,
+    -1, -53, -26, 28, 14, 22, -16, -62, 4, -67, 11, 17, -105, 4, 12, 25,
+    -15, -40, -28, -118, -36, -35, 16, -34, -1, 70, -31, -56, -102, -9, -51, -81,
+    -79, 21, 21, 119, 42, -24, -14, 25, 54, 16, -90, -10, -1, -90, -57, 5,
+    10, 58, -92, -37, 62, -10, 94, 6, -127, 27, -14, 15, -72, 104, -38, 24,
+    29, -28, -17, 73, -3, -19, 116, 115, -103, 29, -55, -17, 85, -113, -31, 51,
+    -108, -45, -34, 20, -71, -30, 19, -26, -14, -36, -8, -31, 20, 14, 13, 62,
+    -113, 52, -82, 89, -37, 54, 5, -42, 25, -67, -57, 9, -12, -13, -54, 4,
+    31, -38, -57, -80, -65, 13, -22, -101, -11, -127, -8, 74, -23, 45, 6, 68,
+    1, -53, 16, 18, 32, 22, -17, 29, -30, -57, -52, -8, -74, -4, -15, -51,
+    -72, -23, 34, -16, 64, 74, 115, -49, 23, 76, -64, -9, 30, -41, -15, 32,
+    32, -46, -118, -43, 2, -55, 25, 15, -54, -78, 5, 4, 7, 80, 15, 115,
+    42, -29, 113, -43, -22, -22, 127, -61, 33, -85, -98, -10, 53, -22, 24, 24,
+    93, 8, -86, 17, -35, -3, -15, -37, 1, -26, 2, -19, -106, 82, -12, 102,
+    18, -3, -20, 51, 40, 55, 45, 65, 127, 19, -56, 21, -53, 4, -33, 8,
+    -26, 9, -13, 46, -31, 9, 10, -8, 4, 68, 12, -77, -41, 27, -42, -23,
+    24, 84, -12, 15, 61, -33, -17, -37, 14, -43, -21, -5, -11, -8, -47, 0,
+    -1, 3, -17, -11, 10, 8, 12, 75, 27, -1, -16, 44, -12, -60, 34, 18,
+    35, -41, -6, 4, -26, 40, 22, 16, 19, 14, 0, -45, -16, -30, 60, 22,
+    13, 77, -48, -73, 19, 63, -43, 61, -42, -4, -48, -18, -82, -98, -1, -49,
+    -14, 79, -10, 6, 121, -3, -17, -10, -53, -29, -30, 72, -14, -68, -86, 55,
+    8, -127, 23, -2, 25, -34, 17, -81, 24, -9, 53, -74, -23, -38, 1, 87,
+    36, 15, -58, 40, -13, -94, -97, -38, 21, -76, -33, -9, 63, -27, 16, -79,
+    -88, -54, -51, -100, 33, -20, 6, 84, 70, -1, 23, 19, -26, -26, 12, 109,
+    -60, 63, -27, -9, -35, -62, 42, -20, 49, -1, 92, -66, 24, 65, -11, -4,
+    -26, -96, -67, 52, 127, -20, -72, -27, 17, -50, 31, -20, -45, -59, 49, 62,
+    -53, 49, 7, 63, -38, -64, -56, 75, -17, -42, -62, 110, 33, 20, -89, -32,
+    -92, 98, -15, -28, 65, 61, 28, -76, 44, 22, 14, -116, 49, -63, 90, 29,
+    -26, -16, -72, 89, -12, -127, -20, -102, -36, -10, -6, -3, -50, 27, -24, -83,
+    -21, -59, 23, 23, -109, -2, 25, 13, 36, 117, 13, 8, -49, -29, 32, -65,
+    -19, -49, -37, 63, -78, 114, 59, -1, -50, 7, 85, -37, -12, -127, 68, -45,
+    24, 60, -46, 51, -41, 40, 57, 7, 51, 26, 9, -99, 7, -24, -63, 79,
+    -94, 9, 42, 31, 28, 71, 107, -27, -24, 29, -19, 3, -35, -57, -28, -47,
+    -51, -19, -71, 61, 29, -10, -32, 27, 68, 122, 49, 6, 15, -11, 5, -40,
+    -25, 17, -41, 9, 1, -74, -9, -23, -57, -5, -68, 22, 36, -51, 58, -1,
+    -71, 56, -4, -32, 127, 68, -30, 77, 19, 30, -15, -59, 30, -13, 9, -29,
+    31, -63, 27, -58, 0, 27, 6, -39, 51, -53, -69, 63, -49, -58, -13, 15,
+    -46, -31, -56, -38, 20, 58, 2, -8, 90, 58, -59, 23, -32, 3, -34, 25,
+    29, -127, 37, 41, -89, -51, 30, -25, 28, -50, 14, 26, -58, 103, 55, -62,
+    -3, -46, -11, 60, -112, 61, 30, 111, -12, 4, 9, -14, -81, 41, -6, 25,
+    7, 20, 42, -54, 67, -77, 17, 52, -52, -78, -58, 79, 14, -51, 97, 20,
+    59, -58, -57, 55, -56, -42, -42, 89, -60, -64, -43, -61, -122, 109, 58, -23,
+    2, 56, 29, -8, 40, 127, 56, -22, -31, 6, 83, -41, 63, 62, 3, 30,
+    5, 23, -75, 21, -13, -22, -7, -23, -24, 45, -24, 14, -24, 35, -5, 43,
+    -61, 33, 35, -18, -22, 5, -25, 13, 45, 5, 3, 47, 7, -26, 4, 48,
+    -36, 25, -62, 11, -38, 60, -15, -86, -25, -3, -40, -22, 25, -29, 30, 12,
+    -127, -3, -52, 39, -57, 28, 3, -6, 27, 39, 13, 17, 22, -6, 63, -51,
+    -6, 53, 22, -25, 3, -22, -11, -1, 14, 16, -30, 6, -9, -25, -26, -19,
+    44, 5, -25, 1, 10, 15, 62, -7, 16, -22, -4, 1, 11, 33, -40, 1,
+    0, 67, -57, 54, -52, 32, -22, -71, -20, 70, -15, -14, -71, 16, -19, 18,
+    -94, -87, -7, 61, -52, -51, 98, 1, -75, -21, 88, 17, -110, 51, 29, 14,
+    -33, 95, 21, 20, 127, -19, 33, 26, -58, 0, -13, 120, 52, -21, -17, -36,
+    -22, -22, 59, 47, 58, 24, 18, 45, -17, -35, 4, -62, 44, -32, -54, 75,
+    20, -61, -67, 20, 11, -38, -29, -42, -12, 28, -3, -51, -4, 48, 90, 67,
+    4, -30, 127, 35, 24, 7, -17, -5, 47, 27, -23, 64, 43, 15, -22, -21,
+    -24, 16, -61, -53, -19, 27, -45, 21, -66, -56, -26, -4, 20, 2, -51, -11,
+    -37, 0, 90, -28, 6, 3, -25, 27, -18, -22, -4, 51, 29, -12, 33, 16,
+    -33, -20, -15, -2, -31, 29, -12, 4, 73, -25, -17, -17, 20, -7, 13, -9,
+    -44, 38, -21, -34, -94, -96, 66, -9, -29, -113, 15, -57, 17, 39, 37, -81,
+    5, 127, -116, 41, -7, 97, 38, -8, 119, 40, -21, -29, -30, -63, -8, -53,
+    -4, -76, 16, 18, -110, -111, -7, 24, -60, -63, -71, 59, 6, -34, -92, -71,
+    43, -83, 5, -22, -17, -19, -31, 31, -41, 118, 29, 52, -37, -14, -42, 4,
+    24, -38, -30, -16, 46, 17, 48, -4, -84, 13, 47, 28, 17, 22, -84, -81,
+    -30, 36, 18, -9, -19, 32, 0, -44, 37, 47, 25, -12, -30, -44, 9, 37,
+    64, -20, 69, 1, 46, -21, -33, -19, -55, -19, 54, 81, -23, 26, 25, 32,
+    -13, -58, 24, 37, 34, -8, -92, -22, -34, 127, -53, 35, -2, -44, 23, -15,
+    -37, -12, 57, 93, -44, 7, 62, -81, -13, 7, 49, -11, 25, 22, 2, -47,
+    34, -49, -2, -21, 47, 10, 73, -12, -16, 99, 1, 23, -8, -22, -54, 21,
+    66, 42, 24, 53, -72, -30, 81, -29, 12, 13, -56, 26, 59, 35, 5, -53,
+    -102, -64, 10, 75, -17, -28, -61, 127, -62, -49, -29, -11, 38, -6, 9, -25,
+    9, 79, -127, 100, 58, 68, -22, 64, 11, -70, 46, 40, 69, 41, -23, -72,
+    14, -101, 8, -42, 15, 23, -95, 20, -47, 29, -36, 35, -43, 43, 41, -84,
+    55, -67, -57, 3, -60, -91, 17, 64, -3, -17, 11, 44, -112, -45, -31, 4,
+    24, -61, 34, -46, -26, -76, 39, -40, -41, 74, 3, -27, 33, -7, -70, 27,
+    -15, -15, -33, -39, -39, 127, 45, 5, -36, 18, 10, -6, 6, 47, -14, 48,
+    -77, -7, -16, 45, 101, -37, 9, -14, -73, -47, -99, 24, -40, 19, -44, 44,
+    36, 59, -85, -36, 9, 37, -64, 70, 15, -20, -29, -7, 26, -29, -54, -12,
+    58, 7, 47, 26, 19, 99, -24, 10, 85, 51, 8, 44, -28, -73, 36, -9,
+    -127, 5, 20, 21, 17, -34, 65, -108, -61, -86, 18, -87, 3, 38, 55, -60,
+    -10, 29, -21, 42, -27, -65, -4, -2, -1, 44, 46, -23, 33, -3, -110, 37,
+    5, -116, -104, 26, -20, 94, -23, -63, 4, -84, -56, 50, -23, 36, -80, 74,
+    25, -105, 51, 24, 5, -98, -88, -22, 66, 51, 90, -17, 33, -21, -66, 3,
+    7, 5, -44, 9, -111, -55, 32, -64, -19, -31, 115, -44, 2, 28, 62, -3,
+    -41, 88, 58, 91, -61, 96, -23, 16, 22, -72, -22, 38, 88, -24, 47, -97,
+    72, 96, 69, 64, 58, 21, 6, 23, 35, -73, 45, 127, 11, -37, 8, -94,
+    45, -3, 88, 21, -40, -4, 3, 21, 13, 1, -104, -65, 110, -17, -50, 69,
+    21, -127, 57, 22, 25, -39, 26, 36, -32, -35, 8, 6, -34, -67, -3, -41,
+    28, 59, 36, 39, 10, -13, -35, 41, 6, -70, 17, -9, 61, -48, 13, 46,
+    14, -22, 17, -14, 10, -41, 55, -9, -94, 70, -26, 20, -125, 21, -12, 55,
+    -114, -20, -69, -20, 20, -73, -101, 66, -15, 38, 13, -55, 44, -83, 77, -11,
+    -25, -2, -8, 39, -127, 4, 23, 14, -23, -21, 85, -30, -72, -1, -18, 26,
+    -20, -19, -51, 19, 45, 1, -19, 13, -16, 5, 21, -9, 6, -34, 35, 21,
+    -33, -15, 3, -50, 23, -34, 25, -3, -15, -15, 2, 55, -17, 5, -17, -6,
+    -11, -37, -29, -25, -24, -1, 20, 0, 12, -21, 4, -19, -37, -11, 5, -18,
+    -42, -118, 26, 53, -28, 16, -44, 96, -23, 69, -8, 1, 24, 106, -45, 50,
+    10, 46, -126, 14, -7, 33, -47, -13, 34, 18, -34, -85, 10, 51, 9, 11,
+    54, 47, -107, -61, 37, -29, 74, 30, 32, 21, 127, -24, -45, 26, -48, -3,
+    34, 44, 19, 17, 23, 87, 22, -72, -23, 48, 10, -27, -12, -78, -1, -5,
+    2, -11, 1, 88, 0, 56, -21, 9, -27, 54, -60, -55, -10, 36, -42, 73,
+    -82, 26, 57, -61, 36, -26, -97, -25, -1, -40, -9, 44, 7, 73, -10, -11,
+    61, 3, -41, -55, -20, 94, -52, -83, -39, -127, 31, 41, -2, -101, 93, -29,
+    -76, -56, -35, -14, -22, -7, -46, 23, 5, 1, -75, 17, -81, -43, -11, -16,
+    -81, -44, -16, 50, 14, -35, 29, -20, -1, -44, 31, -16, 18, 13, 64, 111,
+    -127, 42, 14, 13, -6, -14, -34, 19, 105, -51, -38, 49, 11, 42, 44, 11,
+    45, 22, 45, 34, 83, -67, 11, 11, -71, 60, 72, 79, 95, 53, -51, 89,
+    -44, -25, -8, 37, 13, -16, -77, -28, -48, 14, 4, -22, 36, -39, -26, -31,
+    9, 23, 22, 26, -63, 21, -43, 37, -68, 79, 66, 16, 62, 60, 45, 68,
+    59, 29, 37, -26, -127, -99, -3, 27, -1, 14, 41, 54, -18, -18, 6, -116,
+    2, -71, 4, 4, 28, -124, -43, -62, -26, 69, -42, 14, -107, -25, 22, 29,
+    -12, -123, 15, 20, -19, -4, 8, 52, -12, -37, -58, -33, -35, 80, -27, 5,
+    66, -40, 1, -13, -14, 25, -62, -21, -20, 8, 21, -43, -4, -4, -30, 26,
+    15, 97, -49, 50, -27, 33, 0, -13, -12, 37, -7, 9, -57, 41, 19, 95,
+    50, 21, -94, -31, -36, -24, -17, 8, 60, -111, 48, 92, 21, 20, -62, 83,
+    -31, -49, -127, 26, -94, -5, -25, 43, 44, -5, 48, -46, -64, 67, -8, -43,
+    -54, 2, 12, 50, 34, 68, -27, 22, -60, -127, -6, 72, 36, 52, 35, 8,
+    -69, 18, -24, -24, 56, 86, -24, 15, -49, 82, 4, -39, -39, 33, -82, 49,
+    -58, 64, 34, 37, -5, -83, 74, -75, 1, -59, -37, 53, -53, -21, 8, -98,
+    -9, 112, 46, -101, 26, -5, 0, 2, 1, 9, 68, 16, 19, -47, -65, -54,
+    -30, 44, 44, -53, -48, 48, 15, -67, 31, -40, 2, -55, 53, 110, 2, -28,
+    -33, 36, -31, -118, 60, 48, 24, 51, -7, -127, -13, -69, -20, 20, -45, -93,
+    94, -80, -64, 55, 31, 51, 49, -30, 63, -25, -21, 69, -120, -16, 58, -24,
+    48, -23, -87, -21, -50, 12, 34, -13, 2, -18, 119, -96, 22, -40, 16, -63,
+    -48, -2, 44, 29, -46, -40, 20, -1, -98, 93, -11, 67, -9, -2, 100, -48,
+    0, 2, -11, 25, 41, -31, 12, 127, -57, -10, -27, -81, 20, 1, 87, 93,
+    2, 36, 78, 22, 13, -95, -7, 50, -17, -9, -13, 60, 28, 4, 22, 16,
+    52, 39, 28, -37, -61, 24, 4, 3, -60, -8, -37, -90, -24, -53, -75, 23,
+    -58, -31, -75, 55, -57, 8, 13, 10, 12, 32, 10, 25, -38, -31, 29, 37,
+    -47, -64, 24, -66, 83, -62, -66, -7, -21, -49, -71, 49, -8, -40, 54, 68,
+    10, 127, 45, -20, 74, -38, 94, -22, -22, -23, 74, -39, 4, -79, 30, -5,
+    -2, -42, -122, -7, -34, -13, -89, -10, 34, -14, 104, 22, 19, 2, 53, -33,
+    -16, -4, -46, -3, 15, 30, -5, -20, -55, 16, 29, -29, -31, -29, 7, -27,
+    -14, 50, -7, -30, -11, -34, 7, 70, 20, -9, -15, 38, 72, 2, 26, 10,
+    27, -50, 127, -7, 48, 41, 54, 25, 48, -8, -15, 52, 7, 19, -21, 68,
+    -23, -13, 28, -41, -16, -76, -4, 56, -5, -31, 51, 18, -26, -5, 29, -9,
+    34, -23, 10, 14, -62, -7, 16, 40, 48, -22, 43, 13, 26, 32, -36, 39,
+    -68, -1, 16, 20, 13, 11, -49, 56, 18, 127, -40, -68, -63, -38, -23, 30,
+    -40, -57, 6, 13, 1, 27, 83, -50, -23, -53, 16, 1, -22, 41, 0, -99,
+    -1, 52, -34, 97, 41, 15, -8, 24, -36, 44, -1, -14, -62, -72, -48, -71,
+    15, 42, 80, 63, -6, 80, 22, -74, -93, 96, -39, -12, -44, 1, -92, 56,
+    19, 108, 43, 1, 114, 23, 45, -56, -43, 68, -100, -26, -41, 92, 48, -28,
+    22, 9, -10, -42, 119, 5, 22, 31, -33, -26, -5, 7, 56, -49, 64, -86,
+    -78, 28, -70, 63, 40, 74, 45, 29, -13, 47, -11, -127, -24, -101, -30, 53,
+    11, -32, -65, 5, -1, -39, -5, -21, 31, -118, 58, 9, 3, -26, 75, -24,
+    14, -35, 110, -59, 38, 23, -4, -56, 60, 1, 127, -44, 18, 44, -53, -20,
+    23, -24, 14, 82, -20, -82, 64, 58, 52, 3, -78, 30, -44, -35, 15, 38,
+    -16, 49, -33, 70, -31, -80, -30, 22, 2, 94, 50, -10, -15, 65, 77, -72,
+    -24, -118, 110, 67, -127, 34, -25, 55, -46, 113, 116, -20, -39, -20, -31, 29,
+    -75, -5, -33, 7, 123, -4, 9, -4, 45, 36, -102, -45, 77, -48, -9, 21,
+    73, -51, 82, 41, 0, -105, 2, 108, 37, 58, -32, 31, -2, -72, -103, 74,
+    -69, 22, 33, -43, -32, 42, 70, 27, 108, -52, 19, -15, 113, 58, -65, -11,
+    -19, 73, -54, 74, -66, 1, 42, 73, -59, -56, -27, 3, 0, -8, 41, 24,
+    49, 26, 33, -64, 9, 40, -30, -7, 11, 4, -25, -20, 27, -48, -23, 91,
+    74, 84, -6, -3, -7, 37, 113, 28, -68, 38, -49, 29, 19, 14, -74, 29,
+    42, -36, 13, 78, -47, -17, -30, -43, 75, -6, -50, -127, 88, -36, 22, -36,
+    -69, -42, 45, -31, -67, 61, 12, 44, 1, -29, 2, -26, -80, -14, -127, 53,
+    -57, -14, -24, -5, 17, 5, -84, 37, -10, 28, -54, -27, -54, -52, -52, 19,
+    16, -33, 5, -17, 47, -12, 17, 16, -29, -124, -31, -89, -37, -40, 22, 38,
+    -38, -60, -43, 22, -83, 106, -41, -4, 13, 68, 39, 75, -16, -47, -29, 47,
+    -46, 17, -61, 39, -23, 32, 37, -43, -14, 74, -64, 17, -77, -16, 14, 33,
+    -87, -68, 11, -9, -48, 27, -75, -19, 87, 95, -95, -72, 4, -5, 96, -52,
+    6, 27, 103, -30, -112, -21, 8, -7, -41, 63, 11, -45, -25, -104, -127, 10,
+    -56, -28, 12, 98, 11, 64, 49, -32, 3, -1, -35, -23, -17, -102, -36, 51,
+    -49, -5, 25, -8, -15, 51, 53, -21, -66, -23, 37, 48, 17, 12, -30, -53,
+    -20, 71, -25, -23, -21, -27, -9, 47, -16, 15, 33, -54, -43, 67, 14, -19,
+    35, -17, -111, 22, 59, 13, -122, -33, -16, -68, -62, -9, 14, -89, -78, -2,
+    12, -36, -106, 92, -78, -4, 18, 17, -123, -55, 15, -107, -20, -127, -15, -31,
+    -102, -47, -42, -65, 51, -17, 35, -65, -46, -16, 79, -92, 10, -97, -28, 9,
+    -75, 89, -28, -15, 47, -35, 44, -16, -3, 60, 20, 2, -46, -67, 92, 7,
+    -50, 41, 2, -96, -102, -67, 14, 103, 17, -80, -127, 72, -9, -38, -65, 36,
+    18, -8, 5, -45, -42, -1, 31, 46, -34, 63, -1, -102, 54, 46, -1, -63,
+    -27, 17, -1, 17, 68, 7, 28, -27, 5, -48, 40, -5, -76, -20, -49, 45,
+    25, -10, 25, -50, -54, 26, -25, 6, 4, -32, 63, -22, -10, 69, -4, 22,
+    26, 15, 57, 25, -2, 3, 8, 87, 6, 55, 41, 17, -71, 80, 47, -15,
+    -5, 2, -22, 9, 34, 29, -11, 38, -127, 85, 64, -3, -78, -4, -37, 46,
+    -39, 17, 39, -37, 12, -16, 23, -82, 100, 11, -10, 36, -54, -48, 95, 41,
+    19, -39, -5, 37, 127, -20, 32, 60, -40, 64, -107, 12, 55, -11, -57, -19,
+    25, 85, -56, 95, -14, -49, -17, 37, 61, 17, 65, 15, -35, -39, 2, 16,
+    -32, -17, 54, 17, 92, -58, -87, 39, -5, 14, -8, -68, -38, -3, -94, 9,
+    -52, 15, -1, 10, 19, -23, 32, 13, -37, 20, 47, 18, -17, 65, 12, -10,
+    -64, 71, -84, -37, -76, -8, 127, 19, -4, 27, -23, -41, -36, -21, 33, -88,
+    -3, 9, -1, 64, -24, -3, -10, 20, 1, -73, 12, 54, -48, -12, 12, 13,
+    -3, 68, -70, 47, 48, 49, -25, 3, -6, 6, -70, -45, -47, -26, 27, 37,
+    27, -38, 49, 43, 8, 127, 82, -74, 28, -41, -43, 2, 32, 84, -32, -14,
+    -10, 39, -18, 77, 13, 75, -25, 30, -33, -1, -14, -77, 43, 51, -117, -13,
+    -47, -55, 52, 13, 24, 53, -35, -76, -17, -90, -62, -15, -4, -41, 56, 93,
+    65, 7, 71, 62, 46, 2, -23, -70, -40, -28, -12, -5, -4, -26, -53, -2,
+    -51, -5, -50, -7, -85, -3, -10, -50, 23, 58, 92, 33, -8, -4, -62, 31,
+    -89, -38, -5, -71, 42, -6, -97, 30, 0, -31, 14, -20, 22, -52, 17, 101,
+    -88, -88, -35, -47, 18, -12, 4, -53, 45, -30, 6, 32, 16, 127, 0, 10,
+    77, 35, 19, -5, 2, 0, 10, -77, -26, 79, -72, -25, 72, 28, 23, 29,
+    -41, 69, 11, -10, -11, 32, -3, 13, 4, 48, 21, 67, -18, 53, -64, 29,
+    -40, 83, 48, -3, 20, 70, 33, 5, 51, 8, -13, -45, -41, 5, -68, 10,
+    68, 25, -35, -45, -42, -7, 41, -28, -45, 44, -118, -12, 30, 44, 31, -88,
+    -28, -11, 49, 38, -127, 97, 34, 27, -9, -24, 82, -23, -21, 6, -57, -33,
+    -47, 55, -4, 101, 76, 14, 38, -59, 11, -10, 100, 44, 66, 23, -62, 13,
+    -55, -21, 62, 1, 56, 104, -41, 39, -72, 117, 27, -64, 28, -41, 44, -77,
+    -14, 21, -116, -13, 79, 92, 46, -16, -21, 42, -20, 33, 42, 11, -59, 51,
+    -53, -127, -2, 80, -31, 1, 7, -21, -98, 38, 47, -28, -7, -20, -109, 1,
+    -25, -57, 60, 44, -75, -46, 55, -50, 67, -37, 18, -127, -80, 109, -59, 27,
+    20, 74, -36, -66, 13, -7, 30, 27, -106, 2, -20, -41, -65, 66, 23, -39,
+    -21, 39, -43, 26, 15, 2, 35, 2, 25, -31, 42, 49, 64, -82, 14, -14,
+    6, -53, -6, -10, -30, 39, 40, 10, -10, 88, 6, 25, -23, 54, 18, 31,
+    -71, -56, -31, 71, -40, 20, 77, 41, -10, 112, 1, -31, 25, -106, -9, -38,
+    -95, -7, -14, 32, 113, 32, 2, 51, -86, -3, 103, -1, -127, -30, 92, -9,
+    32, -29, -57, 73, -61, -52, 61, 16, -110, 53, 4, 66, 27, -60, -7, -93,
+    41, -95, -47, 17, -7, -66, -50, -16, -23, 79, -79, -82, 52, 7, 31, 71,
+    90, -76, 24, -29, -27, 100, 14, 49, -12, 82, 32, 43, -120, -20, -20, 29,
+    30, 30, 5, 3, -16, -9, 70, 68, -70, -49, -23, 69, -41, -9, -15, 81,
+    22, 80, -37, -25, -10, 14, 33, -36, -31, 12, -77, 73, -69, -27, -127, -69,
+    -31, -2, -45, 55, -53, -39, -45, -66, 4, -42, -37, -35, -45, 10, -38, 105,
+    -25, -15, 13, -11, 12, -14, 38, -22, 14, 5, 23, 14, 9, 23, -3, 0,
+    -2, -13, -18, -21, -6, -20, 17, 6, 0, -6, -14, 38, -32, 28, -12, -23,
+    59, 20, 8, 27, -8, 27, 12, -14, 5, 24, 21, 33, 23, -19, 19, 16,
+    18, -68, 15, -36, 26, 62, -36, 14, 16, 21, -9, -12, 127, -6, -4, -18,
+    -6, 18, -4, -43, 16, -39, -14, -70, -38, 25, -23, -48, 39, 13, -14, -14,
+    -28, 127, -41, 26, 16, 52, -37, 28, 7, -11, -7, -18, -3, 15, 31, 17,
+    21, 25, -14, -24, -3, -81, 0, 21, -67, -8, 48, -11, 1, -31, -77, -1,
+    19, -17, -67, 45, 8, -4, 58, 18, -34, 58, 39, -43, -45, -1, 24, -61,
+    -101, 2, -42, 11, -90, -61, -107, 62, 11, 22, 83, -20, 86, -8, 10, 75,
+    16, 70, -35, 127, 3, -32, 7, -54, -14, 74, -53, -93, -29, -11, -51, -7,
+    122, -27, -3, 10, 30, -38, 62, 3, -85, -76, -39, 84, 4, -82, 29, -112,
+    79, -82, -16, 14, 15, 31, -94, 8, -59, 100, 13, -37, -96, 70, 80, -3,
+    46, -13, 46, 60, -88, -29, 59, -12, 57, 47, 10, 14, 13, 25, 45, 69,
+    14, -5, -26, 19, 56, 127, -56, -19, -9, 51, -24, 27, -87, -17, -10, 45,
+    36, 105, -30, -26, 42, -43, -37, -122, -28, -3, -27, 26, -38, -59, -69, -22,
+    -40, 61, 47, -4, 117, -22, -120, 15, -34, 100, -3, -85, 74, 7, -11, 10,
+    -85, -42, -37, 19, 70, 37, -3, -102, 2, 47, -63, -92, -69, -26, -45, -57,
+    15, 21, -120, 35, 64, 36, -59, 76, -60, 24, 72, 10, 38, 127, -40, -54,
+    -27, 52, -106, -117, -80, -45, 92, 0, -88, 30, 87, 115, 20, -48, 86, -9,
+    66, -29, -95, 49, 0, 49, -59, -9, -101, -105, 55, 44, -56, 60, -54, -56,
+    3, 127, 49, -6, -72, 85, 6, 80, 53, -19, -62, -77, -71, -68, 6, 77,
+    -23, -34, 21, -61, 41, 20, -32, -47, -33, 48, -31, -62, 116, -54, -70, 24,
+    65, 20, 9, -108, -11, -30, -34, -3, -5, 1, 42, -32, -30, 35, 16, -27,
+    4, -15, -24, 45, 5, -4, -27, -72, -11, -50, -41, 1, -1, 14, 57, -9,
+    -44, 21, -15, 34, -30, -83, 123, 8, -11, -35, 19, 16, 63, -66, -2, -26,
+    0, 28, 30, 22, -10, -28, -39, 75, 15, 44, 44, -58, 43, -38, -8, 43,
+    26, -26, 0, 24, 39, -22, 13, 19, -27, -23, 46, 55, 21, -106, -100, -70,
+    92, -127, -25, -21, 4, 21, -5, 37, -87, -72, -12, 11, 12, 2, 59, -25,
+    -95, 30, 34, 78, 46, -56, 1, 22, -29, -2, 56, -110, -48, 53, -51, -98,
+    58, -47, -87, 96, 5, 30, 32, -69, 27, 16, -61, -88, -6, -11, 57, -26,
+    5, -9, -1, -10, 127, -15, -14, -75, 19, -24, 18, 25, -5, 7, -62, 35,
+    5, -30, 1, 125, -76, -54, -122, 1, 43, -32, 0, 29, -19, -89, -35, -49,
+    -21, -9, -4, 32, 6, -85, -7, -25, 12, 11, 64, 36, 127, -65, -76, -28,
+    -11, 2, 5, 94, 21, 8, -9, 17, -78, 127, -43, 4, 111, -1, 106, 31,
+    -20, 26, -42, 21, -1, 9, -3, -18, 49, 67, 89, -21, 39, 49, -58, -36,
+    34, -1, -3, 37, -29, 24, -83, 4, 40, 43, 74, -50, 112, 54, 31, -47,
+    28, 0, -127, 38, -65, 15, -16, -24, -41, 16, 26, -125, -49, 72, 56, -47,
+    -49, -14, 31, 33, 35, 25, 26, 102, 27, 23, 5, -108, 6, -109, 52, 40,
+    -8, -50, 67, 84, 37, -33, -46, -18, 9, -11, 44, 48, -21, -15, 15, 11,
+    -67, 46, 0, 26, 18, 68, -57, 6, 10, -28, 32, -56, -3, 60, -77, -51,
+    -47, -44, -55, 45, -56, 33, 15, -37, 17, -9, 27, 18, -14, 50, -92, -37,
+    -4, 12, 10, 62, 42, 62, 15, -22, -35, -64, -40, 22, 17, 20, -2, -116,
+    57, 4, 67, 20, 25, -73, 4, -15, -93, 110, -43, -28, -21, 47, -69, 19,
+    -53, -39, 33, -83, 88, -43, -34, 127, -7, -11, 54, -42, -36, 16, 57, -53,
+    -17, 38, 32, -40, -54, -22, 8, -5, -75, -42, -56, 18, -39, 50, -6, 19,
+    -32, -27, -50, 15, 9, -50, 1, -10, -29, 23, -79, 1, -50, -11, 30, 1,
+    69, -16, -39, 0, 20, 46, 3, 24, -26, -37, 14, 57, -4, 21, 2, -61,
+    127, -18, -102, 21, 36, -50, 31, 4, -10, -7, -61, -5, -11, -13, -15, -79,
+    47, -8, 17, 37, -36, -127, 3, -48, 14, -32, 5, -65, -78, -13, -20, -2,
+    78, 33, 22, 24, -13, -9, -16, -10, -46, -34, -19, -15, 10, -39, 69, 9,
+    34, 14, -15, 10, -41, -59, 56, -43, -56, 6, -17, 2, 18, -36, -32, 29,
+    -91, 48, 18, 41, -23, 16, 34, 6, -115, -15, 76, -4, -10, -26, 86, -18,
+    -19, 12, -24, 23, 12, 21, 0, 51, -3, 57, -19, -78, 115, 24, 34, 88,
+    66, 62, -35, -13, -41, 40, 61, -38, 22, 17, -11, -9, -2, -52, -7, 65,
+    25, 43, -3, 12, -7, 75, 29, -1, -4, -36, -14, 38, -8, -14, 25, -1,
+    9, 8, -39, 59, 69, -127, 28, -12, -11, 56, -73, 62, 77, -52, -14, -80,
+    -10, -22, 80, -28, -11, 5, 11, 28, 63, -39, -36, 25, 51, 29, 2, 51,
+    93, -62, 2, -27, -85, -6, 1, -17, 33, 14, 9, -43, 48, -13, 19, 16,
+    -111, -100, -7, 33, -10, 33, -15, -16, 25, 127, -32, 44, 77, 79, 16, 35,
+    -10, -47, -46, -20, -24, 27, -26, 16, 0, 0, 24, -31, 70, 13, -29, -77,
+    -45, -1, -47, 53, 25, 7, 45, -15, 4, 41, 9, 73, -40, 2, -36, 22,
+    -38, 1, -19, -40, 53, 107, -66, 15, 127, -3, 65, -56, -14, -78, 16, 46,
+    -74, -28, 27, -15, -19, 22, 75, 23, -11, -25, 32, -59, 41, 6, -31, 49,
+    37, -26, -48, 91, -12, -55, -43, 16, 72, 5, 6, -36, 0, -55, -51, -54,
+    35, 22, 23, 127, -60, -37, -79, 59, -3, -50, 20, -11, -28, -32, -3, -61,
+    -74, -50, 46, -15, -64, 9, -7, -10, -51, 39, 50, 13, 44, 72, -32, -54,
+    -32, -19, 1, -13, 6, 51, 54, 44, -20, -27, 13, 28, 35, 0, -23, 0,
+    37, 75, 46, 34, -70, 49, -9, 2, -32, 52, 5, -5, -49, -25, 4, 57,
+    113, 18, 95, 4, 77, -83, -101, 3, 53, -36, 16, 27, -15, 55, -50, 4,
+    12, -32, 6, -103, 11, 51, 93, -19, 127, -1, -70, 113, -40, 126, 6, 5,
+    -51, 82, -33, 23, 4, 25, 22, 58, 7, -24, -109, -122, 78, 27, 23, 60,
+    -45, -51, -5, -15, 26, 10, 44, 35, -6, -14, 68, -10, 70, -60, -18, -69,
+    31, -29, -60, 34, -36, -37, 19, -10, -47, 79, 65, -33, -30, -22, 10, 60,
+    19, -25, -24, 91, -65, -65, -18, 26, 17, -24, 62, -9, -16, 114, -42, -26,
+    75, 46, -39, -12, -8, 98, -8, -9, -58, 41, -122, -71, 16, -48, -49, 77,
+    -24, 21, -34, -127, 89, -50, -104, -21, -23, -105, 30, -35, 12, -30, 3, 18,
+    0, -22, -77, 70, 92, -12, -98, -14, -27, -11, -18, 35, 18, 91, -34, -41,
+    -71, -81, -57, -13, 17, -25, -30, 9, 6, 87, 23, 36, 37, -18, -26, -29,
+    11, 98, -6, 67, -29, 50, -68, -28, -127, -78, -66, 47, -2, 28, -6, -34,
+    27, 57, 19, 111, -37, 68, 74, -120, 31, -48, -29, -90, -13, 8, -32, 34,
+    -8, -47, -70, -23, 93, -105, 34, -35, -6, 32, -62, 41, 12, -111, 28, -35,
+    12, -5, -90, -104, -76, -84, -13, -107, -24, -8, 98, 26, -48, -19, 50, 12,
+    -70, 41, 19, -9, -5, -31, -52, -12, 16, -2, 47, 21, -113, -124, 43, -2,
+    127, 58, 67, 28, -86, 59, -36, -31, 56, -32, 64, -67, 66, -37, 82, -44,
+    49, -5, 120, 58, -57, 22, -9, 50, -14, -45, -52, -39, -77, -73, 26, 92,
+    -35, 56, -23, -74, 86, 50, -30, -104, 28, -27, -73, -31, -30, 50, -24, 5,
+    -60, -30, -3, 61, -30, -67, 26, 18, -39, -30, 7, 127, 14, -15, -75, 1,
+    -33, 12, -32, 25, 42, -17, 11, 60, 33, -65, -96, -31, -67, -13, -35, -3,
+    -76, -123, -69, -35, 0, 60, 0, 2, -12, -44, -56, 119, 31, -90, 76, 27,
+    61, -4, 40, 40, -28, 47, 55, -56, 5, 83, 1, 34, 45, 34, 73, 5,
+    27, 27, 8, 24, 23, -57, -60, -31, -61, -76, 42, 127, 48, 62, 14, 53,
+    -33, -52, 1, 109, 31, -44, 39, 64, -98, 16, 46, -9, 20, -3, -109, 23,
+    29, -2, -33, 28, 41, -21, 8, -2, -58, 72, -29, 12, -43, -4, -14, 47,
+    2, -58, 14, -29, 50, 40, 33, -4, -44, -6, -11, 11, 10, -51, -42, -80,
+    -6, 62, -11, -29, -56, -57, 127, -26, 24, 11, -19, 25, -7, 21, 9, -6,
+    16, -30, 74, 37, -23, 24, 31, -3, 36, 66, -64, 2, 36, -36, -7, -8,
+    -16, 66, -37, -14, -22, 20, 27, 61, 13, 10, 30, -38, 33, -37, -14, -24,
+    89, 21, 51, 14, -30, 62, 32, 30, 9, -11, 44, 79, -13, 127, 5, 117,
+    25, -18, 30, 59, 4, -21, -63, 41, 24, -1, -85, 24, -8, 17, 30, 29,
+    -32, 44, 67, 44, 38, 46, 120, -34, -15, -32, 14, -31, -15, 21, -64, -47,
+    12, -49, -54, 8, -15, -13, 9, 49, -108, -21, 39, 53, 18, -65, 7, -7,
+    -104, -32, -25, -38, 9, 50, -127, 27, -92, 11, 1, -9, -49, 51, 1, -22,
+    -28, 24, -28, 62, -26, -71, 53, 25, 3, -75, 25, -23, -97, 58, 17, -122,
+    -21, -104, 37, 20, -85, -111, -9, 2, -18, 29, -35, 6, 33, 47, -58, 11,
+    9, -53, 22, 97, 53, -8, -127, -15, 56, -9, 62, -37, -5, 22, 30, -51,
+    59, 39, 66, 19, -81, 51, 71, 23, 0, -12, 6, 50, 87, -38, -48, 11,
+    -60, -50, -59, -37, -11, -59, -30, 60, -49, 18, -51, 22, 60, -55, -1, 93,
+    43, 9, -30, -65, -52, -41, 7, 24, 16, 64, -99, 55, 63, -17, 10, -13,
+    97, -32, 21, 8, -43, 56, -9, -40, -11, -127, -3, 6, 28, 72, -30, 14,
+    7, 4, -19, -20, 57, -120, 105, 60, -8, 72, 106, 75, -45, -27, -4, -16,
+    17, -58, -50, -48, -13, 34, 65, -60, -18, -66, -31, -43, -30, 16, -41, 35,
+    76, -25, -60, -24, -15, -26, 0, -27, 36, -9, 28, 7, -12, 8, -51, 5,
+    44, 17, -47, -4, 60, -54, 28, -20, -27, -127, -55, -17, -27, -43, -19, -115,
+    66, 19, 10, 21, 49, 7, 52, 14, 24, 2, -36, 32, 56, -34, 31, -22,
+    21, -20, 40, 30, -28, -19, 38, -41, -19, 22, -7, -16, 43, 57, 7, 19,
+    41, 6, 33, 31, -50, 52, -17, 0, 96, -28, -28, -39, -23, 75, 42, -6,
+    -30, -81, -29, 10, 26, 42, 24, 22, -5, -54, 0, 16, -9, 43, -37, 26,
+    -21, 23, -93, 30, -29, -57, -15, 75, -21, -14, -31, 1, -40, -45, -33, 3,
+    30, -2, 28, -21, 52, 17, -1, 18, -3, 89, 103, -17, -34, -64, 127, -17,
+    -30, 79, 32, 69, -43, -4, 22, -51, 48, -63, 17, -66, 54, -29, -32, 21,
+    -26, 49, 41, -16, 28, -1, 35, 127, -20, -62, 6, -77, 73, 41, 56, -10,
+    49, 72, 17, 29, 10, 7, -36, -16, 3, -32, -5, 51, -84, -27, 38, -44,
+    -68, -22, -52, -42, 60, 46, 65, -48, -41, 49, -3, -62, 32, 28, 0, -63,
+    -14, 28, 6, -40, 4, 9, 25, 4, -109, -13, 97, 75, -11, 18, 26, 76,
+    -36, 11, -16, 46, 2, -42, -16, 1, 62, -18, 24, 37, 22, 127, -34, 16,
+    5, -63, -25, -16, 77, -41, 51, 4, 37, 50, 28, -31, 20, -88, -48, 37,
+    56, 22, 28, -12, -30, 13, -63, -68, 70, -38, -105, 19, -33, -92, 38, 30,
+    69, 14, 24, -87, -16, 37, -4, 0, -106, 48, -45, -15, 69, -17, -37, -2,
+    45, -26, 30, 56, 50, 5, -55, -9, -55, -87, -24, -27, -19, 28, -11, 4,
+    -29, 1, 20, -30, -53, 55, -44, 22, 41, 73, 44, 17, 127, -59, -105, -2,
+    64, 58, 86, 31, -16, -77, 35, 2, 78, 33, 29, 34, 20, 38, -73, 12,
+    36, 41, -67, 36, -36, -12, 0, 45, -31, 1, 56, 69, 51, 32, -42, 0,
+    49, 52, 45, 44, -29, 36, -41, -45, 47, 12, 100, 54, -58, 12, 28, -1,
+    26, -16, -23, 127, 0, 28, -78, 42, -16, -49, 52, 18, 75, 50, 33, 20,
+    34, -90, 51, -33, 39, -10, 14, 43, 20, -3, 5, 17, -22, 45, -28, -73,
+    -5, -26, -3, 38, -14, 49, 12, 34, 44, 80, 109, -39, 4, 11, 20, -19,
+    15, 66, -34, -33, -29, -10, 50, 47, -28, 32, -71, -36, -14, -92, 34, -73,
+    -70, -37, -58, 3, 34, -1, -19, 13, -24, 34, 117, -64, 42, 27, -81, 29,
+    -25, 16, 11, 48, -54, -27, 31, 60, 49, 51, 79, 11, -19, -2, -22, 67,
+    -127, -62, 38, -47, 14, -57, -4, -5, 63, -20, -23, -21, -50, -36, 75, -99,
+    43, 72, -111, 43, -15, 58, -46, 2, 87, -14, -115, 2, -3, -16, -111, 79,
+    43, -15, -127, 7, 3, -124, -33, -17, 49, 78, -19, -37, 82, -48, 71, 100,
+    -70, -37, -3, -15, -21, -7, 15, 92, -54, 16, -84, 25, 12, -13, 51, -62,
+    -4, 12, -25, 54, 57, -66, -80, -39, 37, 3, -38, -88, 68, -5, -86, 12,
+    54, -72, 5, -1, -12, -74, -47, 58, 28, -89, -34, 23, 13, -22, 18, -12,
+    -19, -4, 52, 41, -5, -8, 9, -18, 127, -48, -46, -35, 25, 38, -18, 49,
+    12, -66, 47, 1, -15, -23, -36, 21, 75, 119, -65, -20, 39, -36, 19, -60,
+    27, -33, 39, -33, -94, -53, -56, -43, -9, 0, 6, -46, -55, 11, -51, 34,
+    11, -14, 3, -26, 37, -19, -23, 2, 25, -24, -4, -51, 37, 20, -4, -63,
+    36, -127, 1, 33, -13, 89, 1, -18, -6, -20, 56, 44, -6, 42, 57, 56,
+    17, -18, 43, 21, 8, 28, -28, -37, 10, -34, -30, 48, -44, 35, 40, 20,
+    18, -5, -30, -25, -27, -29, 34, 2, 37, 24, 66, 1, 18, 4, -14, 25,
+    12, -9, -53, 34, 31, -18, 16, -30, 9, -33, 2, 16, 73, 73, 32, 48,
+    44, -21, 105, 67, 57, -61, -6, 7, 12, 17, 18, -24, 58, -9, 7, -71,
+    -104, 9, 42, -47, 25, -59, 35, -19, -41, 33, 34, 21, -44, -33, -24, 19,
+    -55, 39, 26, 4, -31, -127, 63, 7, 3, 14, 19, 40, -49, 23, 58, -47,
+    -118, 47, 22, 30, -40, 45, 94, 13, 51, -17, -49, -38, 79, 36, 63, -12,
+    -68, -92, 4, 14, -59, 4, 34, 82, 27, -7, 3, -127, 86, 40, 42, 18,
+    3, -23, -14, -61, 32, 40, 15, 14, -85, 103, -92, -50, -6, -55, 9, 22,
+    -85, 93, 38, 78, -114, 44, 26, 68, 53, 43, -62, -28, 55, -8, 65, 12,
+    37, 8, -47, -15, 3, 36, 43, 15, 75, -37, -9, 11, 31, 55, 120, -57,
+    6, 26, 78, 58, 38, 24, 80, 16, 2, -38, 48, 30, 39, 40, 20, 80,
+    38, -10, 43, -25, -127, -71, -37, -78, 13, -27, -5, -46, 39, -38, 81, 8,
+    51, -15, -60, 10, -56, -43, -109, -41, -63, -24, -13, -9, -21, -4, 7, 16,
+    46, 83, 42, -39, 35, -41, 10, -41, -2, -5, -36, -32, 40, 15, 24, -20,
+    66, -61, 62, 26, -21, 33, -5, -54, -45, 18, -36, -14, -2, -52, -96, -15,
+    -12, 51, 56, 1, -8, 39, -22, 28, 28, -2, -43, -15, 74, -18, 11, -45,
+    -39, -22, 3, -17, 15, -33, 2, 47, 16, -61, 1, -56, -49, -22, 127, 17,
+    28, -48, -52, -21, 37, -50, 45, -122, -4, 55, -28, 55, -38, 4, 24, -65,
+    5, -32, 1, 28, 12, 73, 49, 48, 30, 12, -127, -49, -8, -95, 4, 14,
+    -21, -39, -45, -49, -57, 42, -5, 56, -47, -27, 34, 16, -62, 18, 49, 24,
+    -51, 13, -56, -31, -11, -47, 10, 24, -7, 79, 48, -67, 2, 50, 9, 21,
+    28, -12, -5, 91, 50, 20, 56, 51, 33, -29, -7, 51, -18, 71, -44, 37,
+    -20, 2, -69, -5, -73, 74, 14, 14, 5, -60, -99, 17, -123, -8, -16, -31,
+    102, -11, -54, -21, 68, 51, -94, -22, 127, -56, 39, -42, 31, 0, 23, -52,
+    29, -42, 22, -30, 105, 16, 42, -49, 46, -3, -10, 21, -70, 27, 69, -5,
+    -24, -84, 54, -46, -58, 52, 1, -16, 67, -43, -32, -13, -10, -46, 10, 21,
+    -65, -44, -3, 16, 127, 26, -24, -82, 13, -67, 46, 54, 42, 4, 27, 41,
+    51, 22, 19, -94, 10, -5, -12, 10, 32, 19, 63, -32, 10, 82, 76, 6,
+    -19, 35, 54, 50, 28, 81, 30, -84, -19, 54, 4, 38, 34, 9, -2, -6,
+    -21, -17, 43, -31, 29, 56, -5, -39, -26, 44, -75, 69, -47, 99, 60, 23,
+    -63, 39, -127, -26, 117, -53, 70, 47, -56, -7, 47, 37, 49, 37, 78, 42,
+    -20, 47, 10, -74, -25, 70, -33, 90, 77, -51, 6, 19, 20, 2, -117, 19,
+    -10, 3, 21, -18, -96, -39, -61, -67, 1, 38, 35, 21, -3, 93, 17, 4,
+    -27, -7, 44, -35, -26, 33, -30, -24, 43, 35, -55, 11, 34, -58, 18, 14,
+    -77, -52, 70, -17, -24, -86, 10, 100, 36, 50, 3, 68, 28, 0, 48, 21,
+    41, 23, 80, 52, 6, 50, -65, -12, 7, 26, -36, -49, -9, 12, 37, -47,
+    -21, 31, 74, 4, 47, -10, 32, 12, -125, 65, -22, 12, -70, 22, 127, -5,
+    48, 42, -50, -46, -24, -2, -11, -118, 49, 63, -52, 32, 35, -62, -6, 57,
+    -14, 11, 101, -33, 11, -49, 43, -45, 75, -37, -41, 87, 34, -40, 12, -58,
+    -103, -13, 22, -3, 34, -110, 36, 69, 64, 97, -15, -37, 15, 68, -98, -33,
+    -78, -10, 62, -10, 26, -127, -69, -7, -47, -86, -48, -65, 81, -13, 98, 28,
+    -43, -127, 15, -116, -68, 26, 38, 30, 17, -83, 9, 46, -29, -14, 8, 20,
+    17, -41, 87, -64, -68, 56, 51, 100, -17, 54, 5, 96, 20, 65, 83, -42,
+    49, -11, 0, -60, -3, -42, 20, -9, -17, 4, -4, 44, 8, -6, -28, -41,
+    -76, -41, 12, 23, 27, 71, -36, -34, 67, 37, -86, -46, -39, -14, 124, -103,
+    -89, 7, 14, 13, -22, 6, -76, -36, -27, 3, -61, -49, -1, 25, 9, -13,
+    81, -23, 94, -45, -19, 4, 87, -69, 48, -18, 80, 3, -90, 127, -25, -82,
+    1, -8, 1, 69, 36, -62, -90, -20, 55, 25, 1, -42, -7, -57, -24, -17,
+    74, 8, -20, -83, -19, 11, -7, 20, 49, -5, 39, -38, -4, 78, -36, 3,
+    29, -31, -25, 31, -32, 27, 0, -54, -75, 82, -52, 3, -6, -33, -35, -42,
+    31, -29, 8, -35, -36, -1, -32, -37, 6, 31, -61, 99, -55, 24, 24, 78,
+    -69, 94, -117, -67, 127, 44, 102, -55, 84, -1, -44, -56, -65, -50, 95, -42,
+    19, -56, -74, 69, -19, 73, -7, -17, 23, -44, -38, 98, -59, -33, 31, -47,
+    -28, -70, 19, -15, 39, 99, -2, 51, -53, 39, 5, -49, -54, 80, 47, -81,
+    -1, 59, 56, -20, -19, 20, -47, -38, 40, 53, 23, -66, -12, 15, -24, -62,
+    -30, -3, -105, 42, -52, 17, -2, -1, 23, -87, 0, -36, 116, 105, 13, -127,
+    35, 2, 23, 21, -85, -110, 2, -55, 8, -50, -64, 28, 92, 51, 28, -32,
+    -22, 51, -34, -95, 64, -13, -28, -1, -91, 30, 47, 5, 39, 14, -55, -20,
+    -40, -18, -2, 72, 10, -20, 50, 127, -63, 7, -75, -56, 37, 42, -2, 103,
+    -59, 45, -32, -34, 22, 16, 39, -9, -8, -69, 66, 87, -29, 46, -5, -27,
+    85, -29, -46, -68, -104, -20, 16, 26, 12, 60, 20, -18, 34, -90, 35, -58,
+    9, 2, 33, -24, 50, 17, 3, 127, -2, -94, 0, -44, -20, -64, -82, 11,
+    103, -75, -66, -62, 24, 35, 52, 75, -61, -11, -6, 38, -49, 37, -61, -105,
+    33, 94, -16, -24, -21, -23, -118, -5, -38, 76, 41, -10, 53, 22, 56, -29,
+    -113, -5, 87, 33, 105, 14, -57, 109, 20, -40, -13, -40, 51, 7, 1, 125,
+    -12, 27, 11, -17, -34, 49, -71, -105, -63, -8, -44, -34, -18, -23, 14, 42,
+    -20, 41, -42, -54, -46, 31, -5, 14, 12, -70, 25, 72, -80, 15, -107, -67,
+    -106, 98, -66, 37, -78, 69, 22, 51, 75, 72, -77, 120, 53, -60, 19, 19,
+    33, 35, 39, -22, 45, 6, -127, -47, 19, -101, -5, 47, 46, 59, 9, 70,
+    -43, 18, 71, -17, 124, 18, 0, 47, 2, -12, 15, -81, -18, -86, 50, 14,
+    18, 18, 60, 71, 73, -19, 78, 16, 19, -24, 127, -60, -30, -61, 26, -44,
+    -39, -36, 10, 77, 36, 47, -81, 13, 22, 14, -11, -30, 95, -18, -5, -79,
+    -61, 23, 46, -28, -17, -46, -48, 49, -3, 25, 53, -29, -42, -29, 61, -11,
+    38, 22, 14, 69, -66, -20, 23, -22, -2, -11, -29, 8, -9, 28, -79, -55,
+    -48, 15, -112, 52, -34, 99, -54, 38, -61, -12, -13, -30, 68, -83, 70, 2,
+    -33, 16, -39, 42, -24, 111, 6, 60, 1, 18, 88, 82, -77, 14, -95, 6,
+    -58, -18, -36, -5, -61, -89, -36, -12, 9, 127, -19, 48, 3, 32, 8, 37,
+    -72, 16, 2, 41, 30, 29, -28, -5, 51, 25, 75, -100, 57, 53, -41, -95,
+    18, 43, -9, -25, -56, 7, 40, -3, 40, 13, -37, 20, -4, 44, 37, 80,
+    5, -17, -67, 111, -10, 31, 71, -50, 11, 16, -66, -49, -46, -33, -10, 10,
+    12, -27, -26, -9, 13, -11, 20, -10, 52, -42, -21, 3, 28, 103, -127, -25,
+    8, -32, 15, 6, -64, -35, -23, -23, 22, -40, 55, 36, 34, -29, -49, -21,
+    30, 16, 63, 37, 24, -88, 106, 72, 93, -76, 64, 2, 42, 43, 51, 96,
+    -30, 11, 36, 115, 26, 41, -3, -113, -83, -12, 25, -6, -15, -44, -28, 38,
+    -12, -10, 6, 15, -107, -127, 23, -58, 47, 87, -37, 19, -39, -52, -120, 75,
+    24, 60, -44, 20, 33, 2, -13, -9, -32, -12, 26, 26, 61, 69, -28, -42,
+    -22, 54, 24, -48, 61, -17, -59, 15, -6, -3, -27, -61, 21, 6, 26, 63,
+    -83, 12, -64, -20, 17, -5, 1, 28, -11, -51, 32, 31, -16, 9, -21, 23,
+    -42, -23, 60, 31, -22, 2, 1, -16, 23, 6, 17, -64, -26, -14, -49, -127,
+    -3, 29, 58, 74, -32, -35, -6, -14, -40, -48, -59, 31, -14, -33, 27, -5,
+    28, -10, 2, -1, -32, 8, 0, 56, 39, -58, 30, 40, 77, 3, -24, -2,
+    -6, 25, -22, 24, 61, -6, -22, -63, -46, 9, -59, 11, 27, -5, 25, -93,
+    16, -61, -16, 60, 82, 57, 74, 35, -3, 127, -9, 31, -14, -38, 47, -1,
+    -119, -63, 20, -38, 20, -78, 110, -7, 4, -18, -104, -3, 50, -16, -79, -8,
+    17, -125, 44, 46, -56, 12, 3, -105, -43, 8, 108, 12, -78, -59, -65, 70,
+    37, 58, 39, 30, 9, -6, 41, 40, -65, 7, -11, 24, -46, -27, 10, 72,
+    78, -58, -23, -108, -9, -18, 20, -42, 127, -48, -60, -15, -89, -75, -71, -78,
+    29, -59, -80, -17, 69, 15, 22, -56, -23, -64, -71, 37, 0, -18, 71, 68,
+    -127, -50, -48, -49, 21, -44, -34, -40, -34, -35, -27, -81, -38, 9, 66, 53,
+    -34, 3, -23, 103, 51, 32, 48, -37, -7, 52, -91, 31, 55, 81, 22, -20,
+    -12, 24, -31, 26, 17, 87, -23, 98, 71, 46, -13, 64, -35, 76, -26, 10,
+    105, -53, -30, -44, 4, 19, 5, -49, 43, 22, 62, -11, -19, 61, -22, 71,
+    69, -60, -19, -100, 13, -76, 19, -17, 90, -16, 114, 68, -64, 76, -53, -83,
+    -30, -20, 39, 124, -59, 45, 63, 70, -100, -49, -16, -4, -96, -16, -95, -127,
+    52, -34, -100, -8, -3, 13, 84, -11, 79, 21, -7, -28, 9, -110, 60, -89,
+    -31, -16, -118, 25, 14, 15, 3, -56, -80, -50, -22, 54, 21, -7, -11, 68,
+    -18, -35, 30, 45, -25, 19, 18, 51, 98, 89, 4, -14, 76, -78, -20, 3,
+    -8, 2, -31, 127, -66, -24, 15, -33, -8, 59, -19, -59, 54, -2, 37, 34,
+    6, -19, -53, -54, -65, -48, 49, -64, 89, 51, -48, -1, -11, 24, 11, -121,
+    -127, 101, 79, 45, -51, 18, 75, 32, -54, 21, 58, 4, 36, 34, 5, -54,
+    -47, -11, -16, -48, -34, 31, -45, -44, -50, 27, 77, 52, -25, -75, 112, 54,
+    1, -35, 38, 20, 20, -21, -7, -1, -33, 19, 80, 75, -73, 101, 36, -43,
+    14, 40, -11, 57, 7, 41, 60, 22, 1, 40, 21, -73, -86, -80, 23, 7,
+    -24, -9, -19, 4, 8, -48, 36, 24, -49, -51, 18, -45, -7, -21, 73, -6,
+    4, -56, 6, -11, 27, -51, -97, 94, -43, 11, -14, 38, 4, -4, -5, 24,
+    -40, 31, 35, 15, 60, -53, -110, 1, 18, -16, -50, -65, 84, 36, -49, -2,
+    -61, -6, -24, -19, -56, -5, -13, 93, 16, 127, -35, 2, 51, -26, -59, 46,
+    -17, -82, 127, 4, -41, 14, 36, -26, -58, 5, -2, 25, -58, 72, -93, 17,
+    -10, -6, 46, 44, -57, -52, -6, 4, -61, 11, 28, -33, -19, -22, 0, -23,
+    27, 92, -48, -70, 5, 26, -34, -5, -6, -41, -88, 24, -17, 15, 46, -18,
+    -10, 42, -12, -24, 41, -1, -3, -68, -49, -36, 62, -13, 3, 40, 37, -9,
+    -27, 112, 100, 67, -55, -32, -40, 12, -88, 43, 21, 55, 86, -14, -114, -5,
+    -23, -15, 57, 101, -99, 37, -33, 51, -8, 87, -26, 53, -48, 55, 13, -127,
+    -64, -46, 78, 9, -14, -21, 50, -48, 33, -39, 96, -43, 41, -6, 47, -95,
+    -62, 37, -3, 22, 27, 66, -103, 71, 11, 62, 43, -3, 1, 29, 30, -83,
+    51, 52, -23, 61, -15, -52, -75, 43, 73, 31, -127, 83, -54, 21, 59, -49,
+    68, 9, -32, 34, -71, -74, -30, -53, -22, 13, 55, 50, -41, 0, 31, 20,
+    14, -46, 26, -13, -19, 63, 63, -72, 103, 6, -47, -121, 83, 12, -32, -11,
+    33, -7, 44, 8, 63, -6, 66, 81, -43, 24, 2, 16, 22, 35, -3, 60,
+    -50, 32, 11, 11, 6, -27, 20, 38, 24, -36, -101, -90, 92, 90, -51, -25,
+    54, -45, 9, -48, 51, -74, -47, -26, 7, -3, 17, -5, -127, 23, -2, 49,
+    -36, -55, -37, 47, -3, -45, 73, -12, -16, 16, 11, 9, 40, -19, 67, 28,
+    -8, -29, -6, 73, -33, 22, 48, -51, 62, 15, -38, 25, 13, 12, -2, -7,
+    38, -15, 127, -3, -17, -17, -14, -3, -25, 17, -2, 8, 8, -21, 38, 17,
+    -17, -62, -33, 82, -28, 14, -68, 27, 28, 62, -7, -6, 24, 78, 19, 2,
+    -34, -101, -38, -42, 51, 16, 29, 0, -47, 57, 27, -12, -15, 39, 14, 25,
+    -11, 34, 6, 6, 5, 33, -4, 31, 53, 35, 15, -26, -35, -54, -13, -7,
+    19, -49, -3, -16, 16, -33, -9, -3, 54, -8, 33, 18, 32, -14, 0, -33,
+    -44, 13, 23, 45, -43, -21, 14, -25, -13, 12, -29, -74, 19, 78, -46, -5,
+    -21, -17, -77, -51, -1, -66, 45, 16, -25, 44, 16, -13, -52, -6, 29, 127,
+    38, 9, 39, -5, 15, -10, 63, -28, 16, -17, 30, 36, 31, -32, 27, 32,
+    35, 13, 42, 26, -38, -21, 33, 27, -73, 5, 58, -92, -2, 61, -23, 0,
+    -14, 47, -7, -40, 12, -82, 2, 49, -3, -11, -40, 1, 3, 26, 61, 14,
+    24, 127, -7, -40, -42, -9, -29, 52, -6, 55, -29, -47, -18, -48, 73, -78,
+    25, 9, 1, 15, 32, 3, -24, 103, 43, 59, 2, 63, -39, 2, 34, 54,
+    86, 9, -53, -21, -20, 13, -14, 28, -54, 21, -14, 23, -44, -16, -35, 8,
+    -17, 40, 23, -13, -5, -39, 46, -20, -87, -31, -78, -56, -69, -18, 18, -8,
+    -33, -57, 74, 127, -85, 76, -10, -34, 9, 7, -100, 37, -1, 1, -53, 8,
+    12, -50, -5, -6, -22, 42, -53, -84, 50, -64, -23, 55, 7, 10, -5, -56,
+    69, 58, -54, -2, -55, -14, 77, 13, -32, 19, -97, 11, -38, -39, 50, 18,
+    55, 39, -82, 33, 35, 46, 34, 92, -50, 1, -5, -36, -114, 99, 29, 3,
+    -15, -14, -6, 51, -74, 72, -18, 26, -25, 33, -1, -71, 28, -13, 91, 93,
+    48, 103, 104, -5, -59, -125, 10, 28, 40, 1, 75, 4, 68, 127, 67, -34,
+    -26, -22, 61, 5, 26, -29, -60, -19, 17, 14, 57, 31, 15, -79, 39, 29,
+    -26, 21, 39, -83, 127, -33, 27, 11, 13, -123, -45, -4, 47, -7, -17, 74,
+    51, 44, -20, 93, -26, -28, 5, 41, 32, -5, 6, 6, 18, -26, -17, 97,
+    19, 16, 80, 5, 30, 14, -92, 102, 35, -41, -29, 14, 2, -23, 115, -41,
+    -4, 30, 22, 15, -34, 66, -55, -61, 17, 21, 31, 34, -8, -6, -52, -17,
+    101, 36, -78, 25, 20, 38, 24, 38, 7, 1, -10, -39, -77, 3, 54, 52,
+    127, 45, 42, -35, 29, -42, 19, 49, -62, -71, -19, -65, -84, 7, 28, -5,
+    5, -12, 124, 27, -26, -2, -108, 13, -37, 42, 27, 15, -26, -6, 58, -6,
+    -13, -69, -37, 12, -37, 26, 14, -24, -47, 40, -4, -11, -28, 127, 9, -21,
+    -72, 47, -57, -86, 5, 39, -25, -44, 9, 26, -35, -9, -8, 36, -56, 44,
+    57, -41, -13, 11, 54, 5, 27, -32, 110, -94, -64, -5, -59, 76, -8, -48,
+    -31, -3, -85, 26, -15, 38, -75, -40, 6, -50, -50, 19, -4, -51, 4, 34,
+    -98, 30, 72, -3, 37, -46, 19, -104, -98, -48, 105, -73, -94, 24, -80, 85,
+    53, -64, -27, 6, -31, 10, 1, -47, -93, -31, -45, -63, 44, 18, 56, -55,
+    61, -26, -24, -22, 24, 15, -39, 3, -17, -117, -1, -35, 2, -45, 50, -127,
+    -50, -35, -47, 96, 85, 92, 30, -41, -87, -16, -36, -21, -44, -30, -66, 70,
+    -98, -40, -30, -105, -15, 14, 69, 3, 29, 11, -11, -11, -61, 127, -38, 30,
+    -53, 39, -97, 38, 118, 55, -32, 72, -1, 99, 36, -83, 13, -16, 38, -87,
+    35, 23, -14, 43, 50, -4, 127, -36, -23, -68, -2, 74, -47, -85, -87, -22,
+    67, -44, -93, 91, 14, -27, -57, 3, -44, 21, -64, 29, -35, -77, 27, -5,
+    -11, -23, 21, 18, -68, -33, 48, 17, -1, -32, 37, 41, 75, -36, -77, 38,
+    -8, 30, 52, -40, 95, 54, 31, 22, 121, 40, 16, -35, 63, -127, -25, -21,
+    -59, 84, 0, 72, -62, 26, 73, 6, -11, -13, 116, 10, -93, 26, -82, 78,
+    15, -17, 3, 78, -89, -38, 10, 54, -59, -41, 39, -80, -34, 14, -124, -7,
+    -98, -29, -26, -51, 10, -106, 3, -63, 42, -82, 25, -32, -15, -45, 37, 40,
+    28, 127, -34, 42, 27, 67, -40, 71, -28, 74, -28, -6, -44, 33, 5, 65,
+    48, -66, 19, -16, -5, 10, 25, -18, 35, -68, -3, 46, -69, -51, -14, 1,
+    3, -33, -40, 76, -44, 66, -22, -17, 7, -42, -59, -19, -16, 3, 96, -29,
+    -12, 21, -39, 38, -123, 18, -15, -71, -97, 66, 38, -64, -23, -59, -71, 66,
+    -86, -16, -116, -12, 93, 85, -76, 6, -30, -22, -53, 4, -40, -62, -87, -22,
+    21, 41, 48, 53, 127, 32, -23, -18, -106, -114, -11, -6, -35, 44, 3, -22,
+    10, -77, -52, 116, -31, 14, -3, 5, -62, -14, -63, -46, -3, -111, -37, 77,
+    -68, 60, -70, 8, -1, -10, -45, 52, 64, 79, 19, 1, -65, 59, -10, 112,
+    -36, -27, -31, -33, 28, 8, -59, 82, -84, 80, -15, 74, 83, -127, 47, 53,
+    -25, 14, -97, 18, -28, 61, 99, -64, 52, -87, 37, 17, -75, -51, -71, -57,
+    19, -21, -8, -3, -127, -20, -44, -69, 41, 44, 55, -76, -37, -102, -101, -29,
+    15, -44, 41, -98, -69, 29, 47, -4, -18, -66, -28, -80, 18, 47, 2, -48,
+    14, 22, -24, 16, 64, -27, -48, -23, -90, -25, -85, -71, -95, -18, -17, 38,
+    83, 13, -18, -31, 62, 1, 45, 35, -127, -58, -1, 71, -22, -68, -39, -8,
+    13, -59, 23, 26, 48, 41, -64, 51, -41, -65, -58, 72, -26, 30, -70, -18,
+    26, -67, -58, 34, -70, 117, -31, 6, -79, -3, 127, -82, 0, 65, -66, 107,
+    -14, -6, -71, -58, 31, 34, 74, -62, -62, 45, -27, -75, 12, -22, -87, 78,
+    -72, 2, 38, -75, 13, 29, -49, -51, 41, -113, 38, 3, -70, 38, -47, 29,
+    45, -43, -49, 33, -68, 47, 50, 10, -44, -20, -3, 36, 12, -97, -48, -2,
+    -12, -17, 22, -30, -57, 41, 10, -56, -91, -7, 60, 3, -41, 71, -77, -11,
+    -98, -12, -28, -43, 81, 127, 26, 33, 10, 63, 14, -59, 57, -25, -6, 105,
+    -65, -35, -23, -95, 98, 1, 0, -71, -104, 63, 37, 24, -82, 19, -96, 46,
+    21, -21, -75, -25, 41, 5, -101, -16, 15, 14, -104, -35, -19, -16, -32, 74,
+    -127, -13, -63, 14, -45, -39, 80, -27, 3, -40, -19, -87, -74, 55, 49, 19,
+    0, 66, -57, -19, 75, 2, -83, -3, -28, 64, -52, 10, 18, 46, -4, 19,
+    -3, 60, 22, -50, 64, -37, -2, -47, -62, -9, 37, 68, -91, 35, -19, 48,
+    -36, -63, 1, -25, -66, -49, -25, 40, -13, -20, -102, -20, -57, -27, -18, -56,
+    29, -34, 66, 90, 47, 122, 86, -52, -28, 34, 8, -60, 5, 127, 53, 38,
+    95, 32, 4, -22, 10, -27, 14, -44, -21, -72, -22, 3, -9, 36, -23, 54,
+    88, 26, -72, 84, -97, 30, 18, 61, 80, -27, -28, 26, -17, 59, 27, 107,
+    83, -27, 25, -88, 27, 7, -22, -2, -60, -23, -28, 65, -43, -124, 66, 92,
+    11, 12, -55, -68, -83, -19, -3, 45, 28, 13, -22, -9, -19, 9, 18, -19,
+    -6, 20, -34, -13, 53, 27, -59, -28, -56, 9, -47, -72, -8, -21, 27, -41,
+    -32, 31, -9, 22, 75, 61, -39, -17, -64, 32, 2, 81, -33, -14, -23, -57,
+    40, 36, -116, 127, -35, 14, -70, 40, -107, 92, -48, -1, -45, 12, -31, -76,
+    -32, -20, -46, 29, -25, 10, 72, -67, -29, 7, 37, -82, 1, -8, 52, 9,
+    -50, 55, -12, 79, -7, 22, -56, 93, 11, 27, -52, -32, 12, 6, 5, -34,
+    -17, 16, -7, -53, 1, -67, -4, 42, -27, -10, 8, -9, -110, 14, -64, -30,
+    127, -17, -45, 76, -3, 3, -92, -3, 1, 22, 94, -13, 18, -31, -27, -15,
+    -59, 0, -46, 78, -30, -19, 127, -5, -34, -10, -5, 0, -52, 61, 9, 19,
+    -18, 29, -43, -1, -19, 17, -81, 46, 26, -9, 6, -58, -19, -78, -27, 79,
+    67, -24, -24, -58, 6, 6, -5, -31, -18, -12, 40, 68, -9, -51, -62, -63,
+    -112, -47, -39, 74, -42, 23, 11, 94, -95, 68, -52, -22, -28, -32, 24, -36,
+    6, -44, -44, 16, -57, 24, 5, -38, -31, -16, -12, -36, 15, 60, -47, -44,
+    -70, 11, -53, 54, 9, -40, -124, -42, 14, 26, -65, 12, 10, -26, -6, 22,
+    19, -23, -32, -84, -20, 109, 38, 9, -32, -53, 127, 57, 58, -108, -63, -7,
+    -18, -78, 55, -56, 27, 33, 14, 0, -60, 2, -46, -126, -63, -68, -45, -26,
+    -70, 14, 103, -22, -64, 19, -1, 68, -63, 31, -50, -44, -20, 76, -4, 93,
+    27, 3, -72, 22, 67, -2, -65, 20, -2, 28, -6, 21, -10, -16, 26, -18,
+    -29, 77, 11, -15, -15, 28, -15, -82, -54, -5, -12, 72, -127, -58, -84, -59,
+    -20, -29, -9, 80, -5, 40, 37, -43, 14, 23, 1, 62, -63, -13, -39, -55,
+    6, 16, -37, 46, -32, -27, 36, -88, 22, -46, 78, 1, 21, -12, -26, -4,
+    6, 28, -5, 67, 22, 45, 38, 127, 29, 28, 4, 4, -73, -25, -1, 18,
+    26, 12, 1, 18, -80, -44, -18, -32, -31, 48, -14, -24, 33, 100, -15, 53,
+    49, -70, -6, -39, -57, -2, 2, -37, -19, -8, 3, 35, -101, -17, 32, -39,
+    -10, -61, -4, 43, 1, -63, 107, -1, 12, 36, 45, 4, -35, 61, 6, -95,
+    -44, 72, -10, 44, 70, 22, 27, -52, -100, 14, -28, -34, -1, -31, -37, -14,
+    -37, -51, 16, 29, -5, -127, 0, 18, -95, 8, 38, 46, -73, -2, -20, -16,
+    -22, -82, -98, 19, 46, 43, -37, -34, 5, 53, -44, 6, -71, -6, -16, -22,
+    17, 8, -120, 33, -40, 5, 100, 20, -53, 16, 50, 15, -127, -41, -11, 61,
+    -26, -30, 73, 15, 92, 5, -28, -25, -29, 44, -91, -15, 40, 7, 49, 90,
+    -18, 16, 13, -48, 60, -51, 39, 10, 11, 78, 45, 95, -51, -37, -12, -10,
+    -8, -46, 16, 65, 25, -28, -50, -10, -8, 2, -30, 37, 11, -28, 4, 36,
+    -46, -47, 0, -11, -49, 43, 67, 8, -57, 33, -50, -53, -112, 65, 13, 49,
+    28, 127, -83, -73, -25, 41, -51, 12, -27, 83, -54, 6, -35, -52, -13, 22,
+    -27, -60, 8, -36, 23, 17, 32, -40, 8, -48, 43, 29, -33, -33, -33, -42,
+    90, -57, 45, 18, -12, 100, -94, 21, -7, 52, -44, -21, -63, -105, 31, 4,
+    -54, -127, -80, -7, -62, 44, -42, -58, -69, -72, -23, -29, 80, 73, -59, 0,
+    88, 90, -30, 24, 34, 12, -91, 3, -28, -18, -3, -48, -9, -71, -4, 31,
+    -7, 67, 40, -1, 6, -4, 47, -83, 10, -33, 14, 27, -28, 32, -59, -9,
+    -13, 26, -47, 76, 26, 0, -3, -46, -44, 96, -32, -10, 35, -12, -26, -1,
+    -33, -24, -20, 19, -53, 60, -56, -82, -86, 15, 18, -56, 81, 67, -2, 120,
+    -20, 58, -127, 15, 71, 98, -50, -81, -74, 2, 34, -44, -60, 2, 29, 34,
+    7, 78, -34, -75, 64, 67, 22, 125, -64, 8, 37, 23, -75, 38, -115, -6,
+    -17, -39, -61, 64, -33, 73, -75, -29, -49, -60, -116, 16, -102, -29, -22, 2,
+    -55, -42, -69, 2, 14, -108, -16, -68, -86, 75, -13, 11, -7, -35, 64, 55,
+    -22, 23, -2, 26, 93, 59, -2, -41, 0, 88, -1, -32, 50, -35, -12, 127,
+    5, -40, 15, 35, 113, -46, 57, -9, -100, -43, 24, -18, -74, 13, -64, 9,
+    -69, -82, 35, -5, -54, -13, 4, 57, -29, -5, -62, -28, 35, -10, 51, -26,
+    -6, 44, 67, -28, -11, -71, 47, 24, 34, -34, 23, -96, -31, 26, -34, 52,
+    15, 9, 5, -5, 14, 74, -11, 26, -14, 36, 31, -93, -38, 29, 7, -21,
+    28, 3, -36, -14, 37, 1, -5, 3, -23, -18, -3, -29, -9, -1, 2, -5,
+    15, -42, -49, -53, 66, 46, -67, 33, -127, 43, -27, 39, -15, -25, -4, 4,
+    -4, -34, 37, 36, 7, 32, 9, -28, -11, -81, 3, 13, -3, 54, 26, -19,
+    -22, 62, -64, 65, 37, 4, 10, -41, -28, -29, -46, 1, 43, -11, 67, -10,
+    -1, -19, -127, -8, -28, -19, 22, -3, -12, -58, -31, 21, -23, -24, 19, -46,
+    54, -27, -82, -14, -43, 7, -43, 4, -23, 21, -21, -39, 5, -26, -92, -35,
+    -46, -41, -33, 89, -5, -83, 27, -35, 36, 57, -44, -28, 39, 71, 32, 29,
+    0, 112, -84, -57, 18, -16, -5, 40, -114, 9, 11, 1, -21, -33, -13, -35,
+    -22, -36, 15, 32, -21, -5, -74, 3, -40, 2, 4, 15, -80, 28, -54, -3,
+    62, -51, -64, 109, 21, -19, 10, 56, 36, 21, 22, 28, 45, 127, -14, -114,
+    -100, -27, 19, 59, -127, 2, 1, 20, -35, -32, -50, 9, 7, 59, 35, -78,
+    0, 75, 7, 52, 42, 82, 46, 102, -22, 47, -16, -21, 57, 21, 41, -40,
+    50, 15, -65, 12, -11, 60, -61, -11, -62, -51, -31, 22, -66, -52, -17, 14,
+    6, -57, -51, 78, 33, 71, -9, 34, -14, -42, 1, 44, -22, -63, -12, 25,
+    40, -43, 46, 18, -3, -77, -1, -71, 38, 99, 69, -35, -19, 31, 41, 25,
+    69, 51, 30, 71, -24, -34, -25, 54, -60, 49, -15, 25, 18, 9, 37, -73,
+    47, 25, 4, 0, 14, -82, -106, 50, -106, -21, -30, 42, -21, 15, 25, 23,
+    -21, -127, -20, 49, 0, 69, -96, 126, -26, -5, -23, 36, -72, -63, 35, 46,
+    -65, 7, 5, 9, -69, 55, 101, -79, -35, 29, -52, -26, 8, 14, -13, -4,
+    -103, 82, 63, 32, 45, 29, -80, -69, -60, 30, -40, 29, -104, -58, 34, 47,
+    36, -29, 56, -84, -14, -111, -55, 127, -21, -15, -27, 7, -92, -6, -116, -62,
+    22, -101, -26, 84, -30, -22, -51, -54, 51, 14, -52, -7, -8, -48, 33, 11,
+    -53, -114, -71, 33, -25, 2, -32, -24, -35, 37, -5, -5, -8, -38, 36, -53,
+    9, 21, 23, 46, 127, -31, -55, -31, -68, 18, 24, -6, 33, -34, -52, 30,
+    -3, -25, -33, 69, -2, -14, -44, -46, -21, 26, -23, 58, -5, -22, 10, 20,
+    62, -53, -48, -15, -49, 31, -5, 19, -40, -30, 51, -40, -25, -87, 74, 12,
+    4, -18, -34, 11, -108, -5, -4, -22, 14, -3, 12, -53, -8, -69, -46, -22,
+    -7, 23, -1, -1, 36, 10, 10, -16, -11, 85, -84, -62, -13, 28, -84, -16,
+    31, -63, 10, -45, -2, 32, 24, -55, -73, 29, 74, 54, -33, 13, -38, -39,
+    -41, -21, 14, 108, -30, 65, 13, -17, -15, 127, 45, -35, -48, -108, -4, -31,
+    -91, -62, 67, -3, -101, 57, 50, -20, -51, 22, -7, -85, -2, 34, -22, -12,
+    -55, -30, -60, -10, 19, 97, 72, 33, -14, 64, -39, -18, 12, 14, 22, 27,
+    32, 69, -44, -8, -3, 40, 60, -79, -40, 32, 127, 110, -31, 91, -35, -105,
+    30, -53, -42, 25, 21, -14, 2, -23, 74, -28, -36, 60, -121, -71, 31, 57,
+    -22, -48, -23, 2, -41, -16, 50, -6, -25, -4, -25, 17, 21, -20, 12, 34,
+    43, -26, 11, 23, -11, -62, 14, -23, 78, 17, -16, -21, 53, 6, -52, -15,
+    -2, 21, -1, 71, 2, -39, -4, 92, -60, -127, 44, -35, -13, 54, -11, -43,
+    -22, -39, 27, -32, 1, -24, -73, 72, 26, 82, 64, -42, -36, 39, -47, -40,
+    -6, -26, 51, 26, -12, 19, 23, -76, -29, 26, 53, -78, -50, -28, 3, -13,
+    -1, 43, 10, 48, -21, 104, 12, 78, -35, 29, -61, 107, 13, 65, 22, 49,
+    115, -35, -41, -9, 56, -12, -11, 20, -18, 22, 18, 51, -70, 21, -20, 31,
+    1, -15, -49, 21, -14, 2, -6, 28, -127, 1, -42, 7, -47, -35, -33, -94,
+    -19, -13, 15, -2, -2, -56, 75, -9, -127, 75, -9, -6, -33, 20, 16, -55,
+    10, 18, 21, 32, 57, 34, -29, -9, -10, 44, 60, 2, -9, -75, -92, -12,
+    46, 24, -52, -41, -43, 7, 56, 53, -9, -38, 5, -26, -27, -85, -68, 120,
+    33, 82, -52, 15, -32, 1, -51, -43, -8, 38, -80, -19, -12, -35, -10, -79,
+    16, -63, 16, -32, -14, -16, -20, 83, 80, 11, -20, -101, -20, 125, 12, 94,
+    -35, 18, -69, -19, 10, 40, -79, 31, -85, 82, 5, 43, 64, -48, -107, 0,
+    -98, -46, -51, -118, -35, -4, 109, -25, -91, 8, 29, 26, 16, -8, -30, -37,
+    7, -122, 4, 127, -15, 85, 15, -16, -14, 66, -80, -55, 25, 16, -31, 14,
+    -94, -62, 39, -24, -6, 72, 5, -99, -37, -19, 38, -55, -21, -20, 70, 44,
+    -50, 79, 73, 39, -16, 43, 2, 94, -96, 67, -97, -36, 31, -110, 59, -7,
+    104, 44, 81, -67, 51, -26, 25, 61, -51, 37, 34, 66, -88, -10, 87, 17,
+    -49, -127, -14, 68, -19, -80, -48, 18, -27, 51, 29, -42, -83, -123, -11, 2,
+    -8, -73, -7, -36, -28, 46, 56, 26, 24, 60, 3, -50, 5, 75, -52, -27,
+    18, 6, -51, 16, 13, 40, -52, 3, 59, -3, 45, 76, 7, -16, 19, 45,
+    26, -80, -127, 23, -7, 34, 15, 38, 35, -58, -9, 66, 0, -21, -41, -50,
+    -10, 41, -32, 41, 34, 76, -60, 10, 11, -47, 16, 15, 4, -24, -8, -36,
+    -18, 24, -11, 66, -62, 41, -10, -25, 32, -53, -60, -11, -53, -24, 43, -75,
+    -1, 34, -45, 19, 61, -28, 13, 8, 18, 74, -12, -5, -127, -51, -16, -16,
+    1, 1, -12, -35, 41, -23, 8, -25, -67, -37, 14, 101, -43, 10, -37, -26,
+    4, -15, -18, 1, -75, 51, -36, 12, -56, 79, -68, -11, 66, -9, 48, -64,
+    -51, -107, 18, 45, -47, -24, -50, -75, 32, -53, 52, -30, 46, 10, 82, 0,
+    30, 97, 19, 77, 62, 26, -58, 57, -88, 48, -51, 49, -93, -65, 104, -23,
+    77, -102, -86, 14, 66, -74, -29, 64, -75, -76, 58, 65, 2, -31, 61, -31,
+    -36, 37, -104, 88, -14, 24, 0, 127, -93, -54, -70, 16, -106, -101, 88, 3,
+    -39, -7, -54, 69, 9, -2, 31, -5, -37, -39, -1, -42, 9, -48, 10, -17,
+    -46, 23, -83, 36, 62, 16, 19, 10, -42, 68, -72, 17, -15, -127, -13, 66,
+    10, -15, -55, -11, 43, -23, 32, 8, 11, 4, -42, 59, -56, -24, -71, 28,
+    21, -57, -24, -10, -20, 25, -9, 8, -6, 51, -42, -64, -52, 1, 7, -28,
+    -56, 1, 6, -34, -25, 5, 8, 51, -34, -31, 21, -38, -39, 59, -45, -5,
+    -35, -21, -1, -20, 10, 15, 57, -34, -56, 15, -127, 11, -92, -28, 13, -63,
+    70, -55, -41, -5, 33, -40, -15, -38, -25, -43, 71, 41, -55, -25, -40, 69,
+    36, 16, -72, 29, -28, 13, -59, 74, -68, -33, -15, -24, -46, -30, -3, 17,
+    -2, -33, -27, 12, -56, 2, -40, -48, -38, 14, 57, -75, 41, 127, -3, -26,
+    60, 47, -102, 60, 43, -2, -18, 60, 38, 85, -66, -40, -23, 54, -55, -57,
+    -2, -23, -27, 57, 18, -15, -4, -34, 31, -41, -11, 24, -16, -23, 19, 64,
+    22, -43, -74, -5, -86, -24, -18, 18, -38, -38, -15, 3, 18, 10, 45, 23,
+    -72, 37, 23, 8, 8, 33, -29, -119, 37, 38, 83, 53, -83, 40, 23, -45,
+    -88, -44, -20, -66, -64, 50, -5, -21, 49, -38, -69, 22, 26, -57, -20, 66,
+    -92, 26, -40, -3, 10, -29, -26, -2, 15, -4, -2, 14, -62, -48, -32, -60,
+    -47, 48, -40, -40, -20, -26, -9, -127, -14, 30, 25, -63, 49, -45, 27, -48,
+    -102, 42, 3, -70, -57, -82, -9, 12, -78, -40, 35, 98, -71, -3, 99, -23,
+    97, -9, -8, 1, 20, 59, 0, -5, -107, 63, -60, 13, -93, -3, -94, 27,
+    -3, 38, -14, 39, 77, -106, 79, 127, -19, -4, 37, -57, 24, 35, 3, 22,
+    -10, 22, 13, 37, -19, -37, 0, 77, 66, -42, -23, -1, -21, -92, -50, 4,
+    -40, 16, -44, 42, 19, -7, 2, 2, -27, 10, -61, -62, -3, 17, -29, 46,
+    14, -31, 53, 21, 9, 29, -26, 110, -42, -62, -56, -26, -9, -7, -33, 2,
+    3, -49, -11, -43, 10, -39, 19, 8, -93, -36, 20, 82, 13, 12, -52, 2,
+    -49, 34, -55, 78, -14, 91, -14, -12, -57, 66, -6, 24, -17, -127, -41, -9,
+    0, -61, 94, -15, -117, -43, -4, -122, 13, -69, 71, -77, 14, 63, -68, 39,
+    38, -41, -21, 58, -10, 7, -84, 19, 8, -7, -127, -4, -10, 47, 45, -77,
+    18, -20, -33, 23, 28, -83, -48, -5, -14, -31, 1, 83, 5, -33, -34, 5,
+    -42, -53, -26, -7, 33, 24, -36, 46, -99, -30, 22, 33, -83, -42, 34, -23,
+    -59, -68, -69, 18, -100, -49, 59, -6, -91, -55, -73, -21, 37, -19, -26, 8,
+    14, 62, -25, 27, 42, -28, 29, 68, -45, -12, -47, -31, 53, 51, 25, -24,
+    -2, -28, -21, 37, -9, -14, 71, 25, -13, -77, -109, -82, -127, 29, -74, 13,
+    39, 15, 28, -12, 66, 34, -88, 48, -1, -23, -92, -60, 4, 30, 16, -72,
+    -45, -37, 23, -1, 8, 33, -30, -28, 28, 38, -14, -98, -16, 9, 14, 16,
+    -29, -13, -22, -4, 78, 38, 58, 8, -106, -87, 35, 127, -79, 11, -74, 115,
+    -1, 30, 102, -21, -2, 93, 15, 90, -15, 34, -35, -61, -16, -63, 35, -16,
+    25, -17, -91, -58, 11, -62, -86, -3, -21, -69, -42, -52, 31, -9, -17, 12,
+    -23, -53, 6, -33, -16, 82, 56, -70, -24, -127, 55, -2, 6, 85, -12, -83,
+    29, 43, 27, 18, -17, -24, -26, -14, -52, -95, -27, 58, -37, -20, 60, 10,
+    5, 12, 4, 9, -15, -13, -6, 21, 23, -21, 35, 5, 29, -60, -42, 46,
+    81, 26, -88, -62, 38, 85, -119, 95, -4, -60, -11, 23, -77, 22, 27, 63,
+    40, -3, -81, 41, 6, -39, 14, -8, -10, 82, -13, -85, 8, 48, 13, 32,
+    -127, 25, -30, -30, 97, 21, -15, 18, -56, 62, -52, -79, -82, -32, 45, 32,
+    90, -7, 25, -74, 26, 23, -56, 97, -52, -3, -14, -87, -12, -28, 37, -17,
+    -30, -25, -107, -4, -24, 97, -79, -50, 17, 10, -72, 14, -46, -8, -37, 6,
+    -67, -25, -25, 104, -87, -19, 10, -79, -102, 58, -108, -23, 9, 74, -34, -43,
+    -63, 99, -32, -127, 68, 11, 50, 43, -37, 56, 28, -79, 2, -51, 40, 11,
+    81, -84, -79, -51, 102, 35, 0, -71, -81, -61, 5, 116, -27, -62, -82, -123,
+    80, 66, 62, 31, -18, -42, -110, 47, -25, 22, -73, 14, -52, -26, -24, -37,
+    -24, -43, 50, 10, -4, -114, 98, -52, -7, 1, 73, -5, 65, 53, 13, -21,
+    -68, -3, -62, 22, 53, 42, 92, 19, -29, 63, -46, 32, 16, -80, 2, -24,
+    35, -16, 30, -12, 13, -69, 116, 59, -46, 15, 4, 120, -23, -91, -2, -83,
+    -45, -88, 72, 59, -4, 51, -91, 37, -127, 22, 9, 67, -30, -88, -45, 34,
+    25, -37, -4, 28, -82, 5, 18, -37, -20, -22, 15, -62, -4, 45, 71, -18,
+    -14, 32, -127, 38, -50, -15, 107, 16, -45, 6, 30, -76, -32, -18, -24, -36,
+    54, -37, -93, 2, 56, -25, 31, -27, -26, -26, 28, -19, -6, -59, 22, 33,
+    57, -34, -19, -16, 65, 85, 18, 52, -31, 23, 20, -52, -15, -1, -22, -25,
+    -66, -59, -1, -16, -103, 6, 11, 45, -31, 44, -7, -22, -41, -26, -76, 10,
+    -70, 27, -36, -118, 1, 9, -112, -25, -10, 84, -49, -19, -49, -47, -9, -12,
+    -40, 127, -47, -62, 34, 28, 9, 34, -72, 24, 42, -16, -38, -33, 0, -66,
+    -33, -50, -30, 80, 53, 26, 29, -19, -42, 19, -75, 12, -82, -83, 27, -11,
+    0, 9, -81, 6, -28, 14, -55, -67, 15, -81, -65, -34, -27, 9, -50, 39,
+    26, 34, -7, 45, -88, 14, 47, 32, -39, -35, 46, -62, 6, -11, 13, 7,
+    51, -4, -51, 32, 24, -57, -5, -52, -30, 52, 45, 18, -9, -32, -60, 19,
+    7, -127, -25, 5, -59, 29, 17, 104, -81, 35, -27, -53, -6, 36, -33, -19,
+    -69, -88, -62, -14, -80, -14, 6, -26, 25, 28, 77, -52, -37, 39, 127, -24,
+    46, 35, 4, -14, 5, 41, 59, 15, -41, 2, -26, -24, -25, -99, 63, -43,
+    55, 37, -90, -20, 9, 19, 6, 9, -92, -67, -9, 69, -20, 27, -8, 60,
+    -58, -70, 14, -18, -34, 23, -106, 1, -13, 64, 5, 39, -102, 13, -36, -53,
+    -28, 43, -31, 38, -55, 0, 19, -1, -8, -19, -15, 13, -16, 41, -14, 3,
+    -45, 30, 18, 3, 112, 36, -1, 14, -25, 63, -41, -3, 1, -43, 41, 24,
+    -85, -30, -8, -31, -24, 16, 78, -85, -42, 65, 79, -40, -94, -30, -47, -18,
+    7, 4, 46, 76, -33, -69, -50, 68, -58, 92, -49, -127, -34, -35, -10, -89,
+    -41, 17, 3, 56, -22, 4, 46, -76, -72, -9, 125, -42, 5, 91, -38, 68,
+    96, 94, -73, -6, 57, -17, -39, 20, -22, 58, 20, -25, -17, -54, 9, 4,
+    89, -9, -69, -18, 12, -58, -7, -116, -45, -49, -47, 55, -89, -24, 73, 77,
+    -3, -32, -30, 0, 17, 40, -127, 16, 43, -45, -61, -118, -63, 43, 105, 93,
+    23, -81, 23, -37, -64, 39, 78, -53, 90, -1, 67, -100, -13, -127, 35, -7,
+    -65, -45, -35, 12, -54, -64, -49, -44, -25, 29, 27, 56, -1, -43, 85, -36,
+    18, 44, 49, -32, 47, 3, -17, 18, 9, -33, 9, -21, -111, -56, 6, 1,
+    -37, -50, 20, 80, -3, 61, 27, 77, -53, -33, -61, 7, -66, -70, 37, -26,
+    22, -74, -126, -57, -25, -9, 79, -20, 54, -63, 0, -44, 83, -44, -25, -10,
+    46, 50, -41, -82, 21, 118, 20, 36, -90, 127, 74, -30, 19, -15, 52, -33,
+    62, -44, -15, -10, 62, 14, 17, 16, -48, -84, -23, -5, 83, -52, 9, -66,
+    52, -53, -24, 18, 39, -15, -60, 1, 99, -40, -13, -65, -19, -111, -37, 19,
+    -56, -11, -38, 39, -67, 10, 22, 57, -42, -40, 55, 12, 4, 2, 3, -21,
+    -1, -35, -4, 38, -30, 90, -39, -31, -29, 13, -57, -32, 48, -105, 88, 57,
+    -29, 40, -35, -95, -65, -1, -42, -2, 6, 41, 35, 2, 20, 84, -26, 34,
+    -26, -10, -33, 34, -18, -7, 21, 90, -77, -1, 49, -54, -91, -127, -25, -41,
+    -47, -68, 27, 16, -73, 25, 97, -76, -84, -21, 3, -38, 47, 17, -18, -24,
+    12, 75, -18, 1, -5, 64, 66, -40, -25, 22, -25, 10, -41, 0, 1, -11,
+    18, 0, -127, 7, 3, -33, -6, -40, -65, -63, 33, 43, 7, -123, 14, 49,
+    44, -33, -32, 29, -93, 91, -74, 83, 0, -21, -16, 11, -15, 38, 5, -7,
+};
+
+static const float _L7_scale[256] = {
+    4.37272174e-05f, 4.02303558e-05f, 4.72275351e-05f, 4.30329928e-05f, 4.54109140e-05f, 4.93666048e-05f,
+    4.65491466e-05f, 5.19094829e-05f, 4.27596824e-05f, 4.45873957e-05f, 4.92878826e-05f, 4.21781006e-05f,
+    4.71317544e-05f, 4.99844027e-05f, 4.56798007e-05f, 4.31639528e-05f, 4.78560905e-05f, 4.34741996e-05f,
+    4.74179869e-05f, 5.18442175e-05f, 4.82684081e-05f, 4.40974145e-05f, 4.86719946e-05f, 4.87510770e-05f,
+    4.39126488e-05f, 5.14066742e-05f, 4.02519836e-05f, 5.23207418e-05f, 4.78219845e-05f, 4.51056294e-05f,
+    4.50955813e-05f, 4.53143584e-05f, 4.74556691e-05f, 4.33184323e-05f, 4.37076123e-05f, 5.11422513e-05f,
+    4.12369300e-05f, 4.50102416e-05f, 4.39254618e-05f, 4.86855461e-05f, 4.75067427e-05f, 4.82025753e-05f,
+    5.05846328e-05f, 4.74799235e-05f, 4.09014283e-05f, 4.42496203e-05f, 4.63980541e-05f, 4.73040855e-05f,
+    4.30179134e-05f, 4.48998035e-05f, 4.24337595e-05f, 4.66328820e-05f, 4.62181924e-05f, 4.91703504e-05f,
+    4.67530772e-05f, 5.00924580e-05f, 4.76646564e-05f, 4.82405303e-05f, 4.90092280e-05f, 4.91854626e-05f,
+    4.47428829e-05f, 4.92743929e-05f, 4.64667719e-05f, 4.71037201e-05f, 4.86902463e-05f, 4.03523591e-05f,
+    4.80114868e-05f, 3.79943267e-05f, 4.52843778e-05f, 4.37924464e-05f, 4.23181773e-05f, 4.92699364e-05f,
+    4.13752750e-05f, 3.88974549e-05f, 4.94443375e-05f, 4.54143192e-05f, 4.25254002e-05f, 4.39627511e-05f,
+    4.08590822e-05f, 4.24941936e-05f, 4.10462162e-05f, 4.42685268e-05f, 4.56176531e-05f, 4.07709995e-05f,
+    3.79109770e-05f, 4.26682709e-05f, 4.31923436e-05f, 4.37455674e-05f, 3.48728136e-05f, 4.43450044e-05f,
+    4.25871476e-05f, 4.02513033e-05f, 4.36864902e-05f, 4.70928353e-05f, 4.39600226e-05f, 4.25984690e-05f,
+    4.20111792e-05f, 4.14313654e-05f, 4.11710753e-05f, 4.51230262e-05f, 4.44219295e-05f, 4.63100332e-05f,
+    4.09579297e-05f, 3.78965924e-05f, 4.60622250e-05f, 4.23325946e-05f, 4.26986298e-05f, 4.06793697e-05f,
+    4.19509925e-05f, 4.32036104e-05f, 4.56834168e-05f, 5.02915573e-05f, 4.00115059e-05f, 3.53805954e-05f,
+    4.69862680e-05f, 4.36388254e-05f, 4.12137306e-05f, 4.37271483e-05f, 4.59652838e-05f, 4.58565919e-05f,
+    4.44088400e-05f, 4.27315535e-05f, 4.74096996e-05f, 4.21338300e-05f, 4.25474864e-05f, 4.26530532e-05f,
+    4.33486675e-05f, 4.30698892e-05f, 4.66721831e-05f, 4.43693425e-05f, 3.59167680e-05f, 4.07089465e-05f,
+    4.44952893e-05f, 4.27058658e-05f, 4.14588212e-05f, 4.20903962e-05f, 3.97228796e-05f, 4.15543800e-05f,
+    4.40332406e-05f, 3.97633230e-05f, 4.29166830e-05f, 4.29631255e-05f, 3.68399742e-05f, 4.02582118e-05f,
+    4.56510170e-05f, 4.83149161e-05f, 4.27336417e-05f, 4.46434387e-05f, 3.93589798e-05f, 4.30222717e-05f,
+    4.00423123e-05f, 4.23922174e-05f, 4.23360616e-05f, 4.56751659e-05f, 3.84160267e-05f, 4.73022010e-05f,
+    3.58779471e-05f, 4.27283012e-05f, 4.15494760e-05f, 4.00957106e-05f, 4.18481213e-05f, 4.03266640e-05f,
+    4.09935601e-05f, 4.34177709e-05f, 3.73735311e-05f, 4.00551653e-05f, 4.32015404e-05f, 4.48345600e-05f,
+    4.10017637e-05f, 3.98714146e-05f, 4.33920613e-05f, 4.41392258e-05f, 4.37458948e-05f, 4.07429725e-05f,
+    4.22304511e-05f, 3.95554052e-05f, 3.90318201e-05f, 4.32083616e-05f, 4.01705838e-05f, 4.41245538e-05f,
+    3.92006332e-05f, 4.07147745e-05f, 3.68616420e-05f, 3.78289697e-05f, 4.41992561e-05f, 3.97921031e-05f,
+    4.06613326e-05f, 4.14790920e-05f, 3.99440396e-05f, 4.26212464e-05f, 4.30776854e-05f, 4.44803154e-05f,
+    4.64616569e-05f, 3.76673452e-05f, 5.10863829e-05f, 4.28761450e-05f, 4.88215846e-05f, 4.59138937e-05f,
+    4.44896468e-05f, 5.25114665e-05f, 4.94552223e-05f, 5.05333519e-05f, 5.26416625e-05f, 4.14267852e-05f,
+    5.05091994e-05f, 4.78092152e-05f, 4.63667857e-05f, 4.17452029e-05f, 4.49453655e-05f, 4.99687158e-05f,
+    5.79059961e-05f, 5.24733878e-05f, 4.76991372e-05f, 4.50688822e-05f, 4.82525429e-05f, 4.52518616e-05f,
+    4.92630243e-05f, 4.75494926e-05f, 4.23553865e-05f, 5.47315904e-05f, 4.94540327e-05f, 5.16660621e-05f,
+    4.91840692e-05f, 5.18415727e-05f, 4.75461748e-05f, 4.24123136e-05f, 4.56086527e-05f, 4.84695847e-05f,
+    5.03588744e-05f, 5.39883404e-05f, 4.92877662e-05f, 5.22513219e-05f, 4.89574522e-05f, 5.08808153e-05f,
+    4.99615271e-05f, 4.45227197e-05f, 4.19582138e-05f, 4.77370268e-05f, 4.85621640e-05f, 4.91033825e-05f,
+    4.35065740e-05f, 4.44365323e-05f, 4.10053653e-05f, 5.11952239e-05f, 4.78836700e-05f, 4.91751962e-05f,
+    4.72401734e-05f, 5.10159480e-05f, 4.90293751e-05f, 4.99627822e-05f, 4.94663145e-05f, 4.87412726e-05f,
+    4.50567313e-05f, 4.55280715e-05f, 4.64196492e-05f, 5.13639206e-05f,
+};
+
+static const float _L7_recurrent_scale[256] = {
+    1.33726753e-05f, 1.03457596e-05f, 1.22000674e-05f, 1.22694146e-05f, 1.27721069e-05f, 1.27270578e-05f,
+    1.13247206e-05f, 1.28306792e-05f, 9.92204059e-06f, 1.14767718e-05f, 9.92146124e-06f, 1.31859906e-05f,
+    9.99190343e-06f, 1.11795580e-05f, 1.20049253e-05f, 9.59877252e-06f, 1.06037860e-05f, 9.36835113e-06f,
+    9.85296901e-06f, 9.78515254e-06f, 1.30821199e-05f, 1.13106944e-05f, 1.08029562e-05f, 9.80807454e-06f,
+    1.08356335e-05f, 1.16194205e-05f, 8.75172282e-06f, 1.10561959e-05f, 9.48256275e-06f, 1.06815260e-05f,
+    1.11960162e-05f, 1.33515596e-05f, 9.64193259e-06f, 1.10087421e-05f, 1.38642617e-05f, 9.84069720e-06f,
+    1.05837853e-05f, 1.35320233e-05f, 1.03419670e-05f, 1.03350130e-05f, 1.24866365e-05f, 1.04173596e-05f,
+    1.05765102e-05f, 1.09467783e-05f, 1.19442375e-05f, 1.27261765e-05f, 1.65136153e-05f, 1.46231623e-05f,
+    1.02123477e-05f, 1.16400543e-05f, 1.05698873e-05f, 1.24394874e-05f, 1.17562295e-05f, 1.12560720e-05f,
+    1.71512929e-05f, 1.46432931e-05f, 8.63047080e-06f, 1.32921550e-05f, 1.35225819e-05f, 1.10694236e-05f,
+    1.28686688e-05f, 9.04002354e-06f, 9.37730692e-06f, 9.77730633e-06f, 9.69078428e-06f, 1.55644357e-05f,
+    1.24050512e-05f, 9.42441511e-06f, 9.26246594e-06f, 9.44779731e-06f, 1.10930114e-05f, 9.24384858e-06f,
+    1.50822007e-05f, 1.48243371e-05f, 1.05804675e-05f, 1.39303347e-05f, 9.10460312e-06f, 1.17123300e-05f,
+    1.00991019e-05f, 9.55261021e-06f, 1.17039081e-05f, 1.12586240e-05f, 9.75292915e-06f, 1.08088734e-05f,
+    1.47964147e-05f, 9.84535109e-06f, 1.06416519e-05f, 1.16442143e-05f, 8.83684788e-06f, 1.04007713e-05f,
+    9.59124372e-06f, 1.11199060e-05f, 1.04744468e-05f, 1.11667505e-05f, 1.45957147e-05f, 1.26140039e-05f,
+    9.39271104e-06f, 1.13836613e-05f, 7.39964071e-06f, 1.17452400e-05f, 1.07041769e-05f, 1.05347071e-05f,
+    1.00947027e-05f, 8.97912651e-06f, 1.25843999e-05f, 1.00556326e-05f, 1.15756638e-05f, 9.70834117e-06f,
+    1.10191368e-05f, 1.04820565e-05f, 9.20546790e-06f, 1.23974769e-05f, 8.26439918e-06f, 1.05424624e-05f,
+    1.67252383e-05f, 1.45336398e-05f, 1.07634969e-05f, 1.05760055e-05f, 8.35943774e-06f, 1.30834396e-05f,
+    1.17725085e-05f, 1.09050470e-05f, 1.02784998e-05f, 1.14654868e-05f, 1.02414579e-05f, 1.45402637e-05f,
+    1.31338420e-05f, 1.14420218e-05f, 1.29138889e-05f, 1.29227819e-05f, 1.32660098e-05f, 7.95092365e-06f,
+    9.05114302e-06f, 8.26984342e-06f, 7.65839195e-06f, 8.86252201e-06f, 8.54168593e-06f, 1.18257985e-05f,
+    9.93968115e-06f, 8.68489587e-06f, 1.04569808e-05f, 1.11164363e-05f, 1.34903084e-05f, 1.23855070e-05f,
+    1.04140154e-05f, 1.02752074e-05f, 1.06763655e-05f, 1.25744818e-05f, 1.03200127e-05f, 8.75567548e-06f,
+    1.20442937e-05f, 1.40319444e-05f, 1.25318475e-05f, 7.42120892e-06f, 1.04906976e-05f, 1.27958656e-05f,
+    1.15124349e-05f, 1.04308720e-05f, 1.04831615e-05f, 9.18866681e-06f, 1.01455880e-05f, 1.01379574e-05f,
+    9.90090939e-06f, 1.22050124e-05f, 8.54017890e-06f, 1.05659301e-05f, 1.02121967e-05f, 8.83361281e-06f,
+    1.08356917e-05f, 1.14960112e-05f, 9.10883227e-06f, 1.07411424e-05f, 7.94874813e-06f, 1.34170741e-05f,
+    9.80151526e-06f, 7.89531896e-06f, 9.88129341e-06f, 7.54997563e-06f, 1.08063268e-05f, 8.88888098e-06f,
+    1.11977042e-05f, 1.25184179e-05f, 8.58286876e-06f, 1.06286743e-05f, 9.37416553e-06f, 1.05200688e-05f,
+    1.10527835e-05f, 1.19452907e-05f, 1.18693597e-05f, 7.38012159e-06f, 1.01415144e-05f, 1.07718724e-05f,
+    1.22285919e-05f, 1.04652936e-05f, 1.06986117e-05f, 1.11007730e-05f, 1.30528124e-05f, 9.48897286e-06f,
+    1.02876083e-05f, 1.13514443e-05f, 9.69918165e-06f, 1.08015793e-05f, 1.18782791e-05f, 1.25602282e-05f,
+    1.28431111e-05f, 1.20952946e-05f, 1.29965938e-05f, 1.07691030e-05f, 1.24228327e-05f, 1.33174981e-05f,
+    1.32227860e-05f, 1.47830660e-05f, 1.42251447e-05f, 1.13826873e-05f, 1.10271039e-05f, 1.15611847e-05f,
+    1.34758111e-05f, 1.42366443e-05f, 1.09123639e-05f, 1.20063160e-05f, 1.14380136e-05f, 1.17298505e-05f,
+    1.37482939e-05f, 1.41890141e-05f, 9.79902688e-06f, 1.40999282e-05f, 1.34968532e-05f, 1.13828164e-05f,
+    8.34259208e-06f, 1.03346556e-05f, 1.39402382e-05f, 1.40816192e-05f, 9.74824434e-06f, 1.61060325e-05f,
+    1.39412905e-05f, 1.27460817e-05f, 1.12169082e-05f, 9.88119882e-06f, 1.45167296e-05f, 1.14622853e-05f,
+    1.09124448e-05f, 1.16686924e-05f, 1.03733655e-05f, 1.01234691e-05f, 1.02897720e-05f, 1.12184807e-05f,
+    1.43512161e-05f, 1.22390211e-05f, 1.16995225e-05f, 1.21367893e-05f, 1.44942487e-05f, 1.04169039e-05f,
+    1.16016226e-05f, 8.90560659e-06f, 1.18553589e-05f, 1.30888684e-05f,
+};
+
+static const float _L7_float_bias[256] = {
+    7.28771865e-01f, 6.50201511e+00f, 1.53940535e+01f, 5.84816360e+00f, 6.53196859e+00f, 9.86568832e+00f,
+    6.57017899e+00f, 1.31145344e+01f, 2.35401106e+00f, 3.80544996e+00f, 1.35314493e+01f, -2.32425165e+00f,
+    7.07867813e+00f, 8.80075836e+00f, 9.59752083e+00f, 9.82827568e+00f, 5.49992943e+00f, 5.66624451e+00f,
+    1.42430668e+01f, 6.33899975e+00f, 7.54121637e+00f, 9.07631111e+00f, 1.28056307e+01f, 6.31722355e+00f,
+    6.56388569e+00f, 1.12042103e+01f, 5.08569098e+00f, 7.56506348e+00f, 9.74366283e+00f, 7.76818419e+00f,
+    1.18030024e+01f, 9.77688503e+00f, 1.07613878e+01f, 4.44133234e+00f, 6.15389919e+00f, 3.32235527e+00f,
+    7.49508858e+00f, 5.00640011e+00f, 4.56551552e+00f, 8.00135708e+00f, 6.37496567e+00f, 1.27584543e+01f,
+    1.66369095e+01f, 2.64957881e+00f, 2.67025161e+00f, 1.07651930e+01f, 1.06274948e+01f, 1.59083977e+01f,
+    7.58542347e+00f, 9.22126412e-01f, -2.86115289e+00f, 1.14475002e+01f, 1.18423643e+01f, 1.15406036e+01f,
+    7.32076836e+00f, 1.03132353e+01f, 4.25201559e+00f, 1.22685242e+01f, 1.04401503e+01f, 8.33221149e+00f,
+    5.25384283e+00f, 5.10033703e+00f, 7.48701763e+00f, 1.11810112e+01f, -2.15435100e+00f, 5.67086220e-01f,
+    4.23160124e+00f, 3.42164993e+00f, 4.87773705e+00f, 6.40260696e+00f, 1.11055965e+01f, 6.95870590e+00f,
+    -1.06203926e+00f, 7.48079538e-01f, 8.54446030e+00f, -4.45136261e+00f, 5.03573990e+00f, 8.99439907e+00f,
+    2.42023563e+00f, 2.89995384e+00f, 7.14449787e+00f, 5.02356339e+00f, 6.17722321e+00f, 2.00629044e+00f,
+    6.30703926e-01f, 3.68426156e+00f, 8.47418487e-01f, 6.81559563e+00f, 2.14278150e+00f, 1.13543034e+01f,
+    5.69111347e-01f, 3.19497287e-01f, 4.33651352e+00f, 3.79347324e+00f, 2.45437002e+00f, 8.23556423e+00f,
+    1.09081612e+01f, 2.64472342e+00f, 5.55510330e+00f, 3.43527412e+00f, 1.16143608e+01f, -8.44724536e-01f,
+    5.95530891e+00f, 5.58757925e+00f, 8.10953045e+00f, 6.15044165e+00f, 1.05311031e+01f, 8.31894517e-01f,
+    9.85984862e-01f, 7.47870350e+00f, 4.64894438e+00f, 8.38680363e+00f, 1.05018127e+00f, 1.80093646e+00f,
+    -4.36817837e+00f, 9.05450153e+00f, 4.61723232e+00f, 5.58592796e-01f, 7.60600710e+00f, 2.41052914e+00f,
+    8.60225105e+00f, 4.91563320e+00f, 4.47832012e+00f, 3.34274483e+00f, -9.99093056e-02f, 1.02297378e+00f,
+    6.28875780e+00f, 4.74436283e+00f, -7.75052309e+00f, -5.23708391e+00f, -2.29737425e+00f, 5.83064497e-01f,
+    -4.91183949e+00f, -1.02594972e+00f, 4.39350748e+00f, -2.80599380e+00f, -3.85295463e+00f, -2.57082224e+00f,
+    9.16597605e-01f, -1.82222903e+00f, -6.04199231e-01f, 2.20829344e+00f, 3.25291872e-01f, 3.54512662e-01f,
+    6.49285197e-01f, 2.82593322e+00f, -6.17314398e-01f, 1.76473820e+00f, 2.91562724e+00f, 4.82989645e+00f,
+    -1.94038942e-01f, 2.11507940e+00f, -1.14946222e+00f, 6.29000282e+00f, -4.90643358e+00f, -2.51771474e+00f,
+    -3.39773297e-01f, -3.76281476e+00f, -9.36138034e-01f, 8.74437094e-01f, 8.92678261e-01f, -2.31958196e-01f,
+    -2.55923581e+00f, 8.26569200e-01f, 1.37415814e+00f, -1.31554282e+00f, 1.60092509e+00f, 1.39191404e-01f,
+    -2.51510239e+00f, -1.39108145e+00f, 1.15245473e+00f, 4.07596111e+00f, -3.43412066e+00f, -5.80063581e-01f,
+    -5.06212854e+00f, -4.90536928e-01f, 7.01060534e-01f, -9.22210884e+00f, -4.27176619e+00f, 4.06427670e+00f,
+    -2.07155681e+00f, 9.90470588e-01f, -1.96142793e+00f, 2.28485394e+00f, -2.85724878e-01f, 2.23215222e+00f,
+    -5.52028131e+00f, -3.20393419e+00f, -2.71422696e+00f, -1.71609378e+00f, -3.67387056e-01f, -4.47626448e+00f,
+    4.98918152e+00f, -4.10426587e-01f, 1.35290689e+01f, 4.52208138e+00f, 1.01062393e+01f, 6.87778378e+00f,
+    6.48661661e+00f, 1.21473026e+01f, 9.21286678e+00f, 9.29259491e+00f, 1.41294184e+01f, 1.92955625e+00f,
+    1.84258480e+01f, 1.37747517e+01f, 1.24832945e+01f, 7.50286531e+00f, 6.10433912e+00f, 9.71752262e+00f,
+    1.16086540e+01f, 7.97756720e+00f, 6.95070648e+00f, 6.55193090e+00f, 1.30245686e+01f, 1.50839510e+01f,
+    8.38460541e+00f, 6.79002714e+00f, 2.82041597e+00f, 6.38987541e+00f, 1.14459677e+01f, 1.02072229e+01f,
+    1.02426262e+01f, 1.33114691e+01f, 8.19346523e+00f, 7.40652514e+00f, 7.26644230e+00f, 1.02958965e+01f,
+    8.75811291e+00f, 9.26693249e+00f, 1.51320372e+01f, 1.20845060e+01f, 7.67033815e+00f, 1.32258873e+01f,
+    1.62124920e+01f, 9.17906570e+00f, 8.98459816e+00f, 1.44984579e+01f, 8.66330719e+00f, 1.30696478e+01f,
+    7.96998072e+00f, 2.92713404e-01f, -2.40792108e+00f, 9.03117657e+00f, 1.79504662e+01f, 1.09400549e+01f,
+    9.97953415e+00f, 1.10915728e+01f, 1.08564243e+01f, 1.19727049e+01f, 1.04934616e+01f, 1.75985184e+01f,
+    2.85442209e+00f, 5.99913359e+00f, 8.57967663e+00f, 7.70479155e+00f,
+};
+
+// Layer 8: QUANT_LAYER_MEAN, [6, 64] to [1, 64]
+static const float _L8_scale[1] = {
+    1.75442562e-01f,
+};
+
+// Layer 9: QUANT_LAYER_DENSE, [1, 64] to [1, 7]
+static const int8_t _L9_weights[448] = {
+    -20, 57, -38, -90, -73, -39, 44, 30, 59, -85, -60, 74, 86, 108, 123, -127,
+    126, 113, -79, -54, 111, -77, 1, 125, 68, 94, 125, -70, -51, -75, -88, 43,
+    -15, -104, 45, 83, -59, 80, -2, -35, -24, -52, -76, 77, 114, -88, -9, -40,
+    108, 63, 22, 47, -96, -45, -116, -32, 86, -11, -46, -90, 49, 108, 31, -65,
+    -28, 88, -24, -111, -40, -67, 37, 22, -33, -25, 101, 78, -5, -84, 100, -1,
+    -36, -81, 83, 121, 44, -3, -6, 116, 82, -37, 91, 11, 37, -95, 127, 83,
+    17, -10, 121, -96, -46, -72, 3, 74, -99, 59, 15, -35, -31, -18, -89, 98,
+    -20, -16, 87, 111, 99, -82, -15, -28, -59, 33, -58, -38, -105, 8, 126, 40,
+    -102, -44, 97, -33, 89, 51, -44, 5, -91, -26, 70, -70, -42, 51, -68, 1,
+    99, 56, -88, -86, -37, -97, 124, -20, -37, -99, -50, 102, -103, 54, -11, 64,
+    61, -79, -64, 27, -73, 117, -119, 101, 57, -69, -98, 56, -5, -54, 4, 116,
+    -22, -65, -57, 2, 19, 46, -99, -77, -1, -127, 55, 79, 6, -67, 24, 79,
+    33, 59, 67, 75, 35, 71, -61, 44, 91, -21, 40, 19, 34, 95, 23, -29,
+    65, 40, 117, -36, -44, 38, 91, 65, 112, 67, -96, -83, -14, 59, 42, -24,
+    -98, -34, -51, 7, -111, 102, 45, -5, -72, -40, 45, 18, 48, 65, -60, 79,
+    -71, 102, 5, 8, -51, 22, 127, -64, -115, 95, 43, -72, 30, -71, -121, -36,
+    28, -89, 104, -63, -47, 25, -88, 122, 45, -24, 1, 95, -117, -114, -114, 32,
+    66, -26, -57, -68, 14, -30, -89, -62, -41, 28, -108, -66, -108, 90, 23, -122,
+    2, -71, 21, 14, 112, 42, -24, 115, -102, -39, 90, -71, 108, -123, 111, -99,
+    12, 87, -21, 95, 95, 124, 109, 127, -87, -34, -106, 10, -118, -112, -32, 8,
+    89, 83, -79, 26, 93, -24, -72, 84, 7, 70, -121, 34, -73, -43, 80, -37,
+    -42, 67, 114, -57, 74, 7, 7, -75, 90, -3, -63, 103, -30, -104, -25, 33,
+    -47, 12, 17, 98, -90, 1, -77, 79, 38, 92, -107, -51, -15, -49, 3, 102,
+    -61, 42, -18, -64, 101, -127, 31, -8, 107, -112, -95, -10, 55, 98, 25, 14,
+    -63, 92, -86, -64, -7, 127, 102, 98, -81, 67, -82, 89, -60, 68, -85, 72,
+    -95, 20, 6, -99, 93, 98, -90, -76, 38, 97, -52, -106, -44, -43, -15, 117,
+    -81, -83, 2, -65, 111, 112, 75, -17, -15, -108, 28, -25, -83, -7, -55, 3,
+    43, 31, -3, 57, -95, 41, -5, -97, 97, -20, -113, -31, 26, -37, -92, -2,
+};
+
+static const float _L9_scale[7] = {
+    1.86464185e-05f, 1.98208527e-05f, 2.04779371e-05f, 2.01587991e-05f, 1.84645887e-05f, 2.04423668e-05f,
+    2.06453697e-05f,
+};
+
+static const float _L9_float_bias[7] = {
+    1.14396624e-02f, 5.47499303e-03f, -1.32011995e-02f, -3.13507952e-03f, -1.34778023e-02f, -1.18854586e-02f,
+    8.50204192e-03f,
+};
+
+static const quant_layer_t _layers[10] = {
+    {
+        .type = QUANT_LAYER_CONV,
+        .in_cols = 50, .in_channels = 30, .out_cols = 25, .out_channels = 16,
+        .taps = 3, .stride = 2, .pad = 0,
+        .input_offset = -22, .output_offset = -128, .act_min = -128, .act_max = 127,
+        .weights = _L0_weights,
+        .bias = _L0_bias, .multiplier = _L0_multiplier, .shift = _L0_shift,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_CONV,
+        .in_cols = 25, .in_channels = 16, .out_cols = 25, .out_channels = 32,
+        .taps = 3, .stride = 1, .pad = 1,
+        .input_offset = 128, .output_offset = 3, .act_min = -128, .act_max = 127,
+        .weights = _L1_weights,
+        .bias = _L1_bias, .multiplier = _L1_multiplier, .shift = _L1_shift,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_CONV,
+        .in_cols = 25, .in_channels = 32, .out_cols = 25, .out_channels = 32,
+        .taps = 3, .stride = 1, .pad = 1,
+        .input_offset = -3, .output_offset = -128, .act_min = -128, .act_max = 127,
+        .weights = _L2_weights,
+        .bias = _L2_bias, .multiplier = _L2_multiplier, .shift = _L2_shift,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_MAX_POOL,
+        .in_cols = 25, .in_channels = 32, .out_cols = 12, .out_channels = 32,
+        .taps = 2, .stride = 2, .pad = 0,
+        .input_offset = 0, .output_offset = 0, .act_min = 0, .act_max = 0,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_CONV,
+        .in_cols = 12, .in_channels = 32, .out_cols = 12, .out_channels = 64,
+        .taps = 3, .stride = 1, .pad = 1,
+        .input_offset = 128, .output_offset = 2, .act_min = -128, .act_max = 127,
+        .weights = _L4_weights,
+        .bias = _L4_bias, .multiplier = _L4_multiplier, .shift = _L4_shift,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_CONV,
+        .in_cols = 12, .in_channels = 64, .out_cols = 12, .out_channels = 64,
+        .taps = 3, .stride = 1, .pad = 1,
+        .input_offset = -2, .output_offset = -128, .act_min = -128, .act_max = 127,
+        .weights = _L5_weights,
+        .bias = _L5_bias, .multiplier = _L5_multiplier, .shift = _L5_shift,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_MAX_POOL,
+        .in_cols = 12, .in_channels = 64, .out_cols = 6, .out_channels = 64,
+        .taps = 2, .stride = 2, .pad = 0,
+        .input_offset = 0, .output_offset = 0, .act_min = 0, .act_max = 0,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_LSTM,
+        .in_cols = 6, .in_channels = 64, .out_cols = 6, .out_channels = 64,
+        .taps = 0, .stride = 0, .pad = 0,
+        .input_offset = 0, .output_offset = 0, .act_min = 0, .act_max = 0,
+        .weights = _L7_weights,
+        .recurrent_weights = _L7_recurrent_weights, .recurrent_scale = _L7_recurrent_scale,
+        .scale = _L7_scale,
+        .float_bias = _L7_float_bias,
+        .cell_clip = 1.00000000e+01f,
+    },
+    {
+        .type = QUANT_LAYER_MEAN,
+        .in_cols = 6, .in_channels = 64, .out_cols = 1, .out_channels = 64,
+        .taps = 0, .stride = 0, .pad = 0,
+        .input_offset = 0, .output_offset = -1, .act_min = -128, .act_max = 127,
+        .scale = _L8_scale,
+        .cell_clip = 0.00000000e+00f,
+    },
+    {
+        .type = QUANT_LAYER_DENSE,
+        .in_cols = 1, .in_channels = 64, .out_cols = 1, .out_channels = 7,
+        .taps = 0, .stride = 0, .pad = 0,
+        .input_offset = 0, .output_offset = 0, .act_min = 0, .act_max = 0,
+        .weights = _L9_weights,
+        .scale = _L9_scale,
+        .float_bias = _L9_float_bias,
+        .cell_clip = 0.00000000e+00f,
+    },
+};
+
+const quant_model_t model_int8 = {
+    .layers = _layers,
+    .layer_count = 10,
+    .input_frames = 50,
+    .input_bands = 30,
+    .input_scale = 5.37068658e-02f,
+    .input_zero_point = 22,
+    .output_count = 7,
+    .activation_size = 1500,
+    .readonly_size = 62700,
+};
+
+#endif /* MODEL_INT8_ENABLE */
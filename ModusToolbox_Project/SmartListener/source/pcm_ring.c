@@ -0,0 +1,184 @@
+/*
+ * pcm_ring.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Portable lock-free SPSC sample ring, see pcm_ring.h. The producer
+ * publishes samples with a release store of head after copying them, the
+ * consumer frees space with a release store of tail after copying them out,
+ * so neither side ever sees a partially written region.
+ */
+
+#include "pcm_ring.h"
+
+#include <string.h>
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static inline uint32_t min_u32(uint32_t a, uint32_t b);
+
+
+/*******************************************************************************
+* Function Name: pcm_ring_init
+********************************************************************************
+* Summary:
+*    Initializes an empty ring on top of the given storage.
+*
+* Parameters:
+*    ring           Ring to initialize
+*    buffer         Storage for capacity samples
+*    capacity       Number of samples, must be a power of two
+*    frame          Samples per frame, 1 for mono or 2 for stereo
+*
+* Return:
+*    0 on success, -1 if the capacity is not a power of two or not a
+*    multiple of the frame
+*
+*******************************************************************************/
+int pcm_ring_init(pcm_ring_t *ring, int16_t *buffer, uint32_t capacity, uint32_t frame)
+{
+    if ((capacity == 0) || (capacity & (capacity - 1)) || (frame == 0) || (capacity % frame != 0))
+    {
+        return -1;
+    }
+
+    ring->buffer = buffer;
+    ring->capacity = capacity;
+    ring->mask = capacity - 1;
+    ring->frame = frame;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->high_water, 0);
+    atomic_init(&ring->dropped, 0);
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: pcm_ring_write
+********************************************************************************
+* Summary:
+*    Copies as many whole frames as fit into the ring. Producer only.
+*
+* Parameters:
+*    ring           Ring to write to
+*    src            Samples to write, starting on a frame
+*    count          Number of samples, a multiple of the frame
+*
+* Return:
+*    Number of samples written, a multiple of the frame
+*
+*******************************************************************************/
+uint32_t pcm_ring_write(pcm_ring_t *ring, const int16_t *src, uint32_t count)
+{
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    uint32_t depth;
+    uint32_t offset;
+    uint32_t first;
+
+    /* The consumer may leave part of a frame free */
+    count = min_u32(count, ring->capacity - (head - tail));
+    count -= count % ring->frame;
+    offset = head & ring->mask;
+    first = min_u32(count, ring->capacity - offset);
+
+    memcpy(&ring->buffer[offset], src, first * sizeof(int16_t));
+    memcpy(&ring->buffer[0], src + first, (count - first) * sizeof(int16_t));
+    atomic_store_explicit(&ring->head, head + count, memory_order_release);
+
+    depth = head + count - tail;
+    if (depth > atomic_load_explicit(&ring->high_water, memory_order_relaxed))
+    {
+        atomic_store_explicit(&ring->high_water, depth, memory_order_relaxed);
+    }
+    return count;
+}
+
+
+/*******************************************************************************
+* Function Name: pcm_ring_drop
+********************************************************************************
+* Summary:
+*    Records samples the producer had to discard because the ring was full.
+*    Producer only.
+*
+* Parameters:
+*    ring           Ring the samples were meant for
+*    count          Number of discarded samples
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void pcm_ring_drop(pcm_ring_t *ring, uint32_t count)
+{
+    uint32_t dropped = atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+    atomic_store_explicit(&ring->dropped, dropped + count, memory_order_relaxed);
+}
+
+
+/*******************************************************************************
+* Function Name: pcm_ring_read
+********************************************************************************
+* Summary:
+*    Copies up to count samples out of the ring. Consumer only.
+*
+* Parameters:
+*    ring           Ring to read from
+*    dst            Destination of the samples
+*    count          Maximum number of samples
+*
+* Return:
+*    Number of samples read
+*
+*******************************************************************************/
+uint32_t pcm_ring_read(pcm_ring_t *ring, int16_t *dst, uint32_t count)
+{
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t offset;
+    uint32_t first;
+
+    count = min_u32(count, head - tail);
+    offset = tail & ring->mask;
+    first = min_u32(count, ring->capacity - offset);
+
+    memcpy(dst, &ring->buffer[offset], first * sizeof(int16_t));
+    memcpy(dst + first, &ring->buffer[0], (count - first) * sizeof(int16_t));
+    atomic_store_explicit(&ring->tail, tail + count, memory_order_release);
+    return count;
+}
+
+
+/* Samples currently stored */
+uint32_t pcm_ring_depth(pcm_ring_t *ring)
+{
+    /* Tail first: head never falls behind it, so the difference cannot wrap */
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return head - tail;
+}
+
+
+/* Largest depth seen since pcm_ring_init() */
+uint32_t pcm_ring_high_water(pcm_ring_t *ring)
+{
+    return atomic_load_explicit(&ring->high_water, memory_order_relaxed);
+}
+
+
+/* Samples discarded with pcm_ring_drop() */
+uint32_t pcm_ring_dropped(pcm_ring_t *ring)
+{
+    return atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+}
+
+
+static inline uint32_t min_u32(uint32_t a, uint32_t b)
+{
+    return (a < b) ? a : b;
+}
@@ -0,0 +1,52 @@
+/*
+ * pcm_ring.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_PCM_RING_H_
+#define SOURCE_PCM_RING_H_
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Lock-free single-producer/single-consumer ring of PCM samples. The
+ * producer only writes head, high_water and dropped, the consumer only
+ * writes tail. Both indices run freely and are masked on access. Writes
+ * store whole frames of interleaved channels, so a full ring never splits
+ * a frame and the channels cannot swap. */
+typedef struct {
+    int16_t *buffer;
+    uint32_t capacity;              /* Power of two */
+    uint32_t mask;
+    uint32_t frame;                 /* Samples per frame, one per channel */
+    atomic_uint_least32_t head;     /* Samples written */
+    atomic_uint_least32_t tail;     /* Samples read */
+    atomic_uint_least32_t high_water;
+    atomic_uint_least32_t dropped;
+} pcm_ring_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int pcm_ring_init(pcm_ring_t *ring, int16_t *buffer, uint32_t capacity, uint32_t frame);
+
+/* Producer side */
+uint32_t pcm_ring_write(pcm_ring_t *ring, const int16_t *src, uint32_t count);
+void pcm_ring_drop(pcm_ring_t *ring, uint32_t count);
+
+/* Consumer side */
+uint32_t pcm_ring_read(pcm_ring_t *ring, int16_t *dst, uint32_t count);
+
+/* Either side */
+uint32_t pcm_ring_depth(pcm_ring_t *ring);
+uint32_t pcm_ring_high_water(pcm_ring_t *ring);
+uint32_t pcm_ring_dropped(pcm_ring_t *ring);
+
+
+#endif /* SOURCE_PCM_RING_H_ */
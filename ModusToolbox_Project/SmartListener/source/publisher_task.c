@@ -51,6 +51,7 @@
 #include "publisher_task.h"
 #include "mqtt_task.h"
 #include "subscriber_task.h"
+#include "event_clip.h"
 
 /* Configuration file for MQTT client */
 #include "mqtt_client_config.h"
@@ -105,6 +106,39 @@ cy_mqtt_publish_info_t publish_info =
     .dup = false
 };
 
+/* Publish message information of the event clip chunks. */
+cy_mqtt_publish_info_t clip_publish_info =
+{
+    .qos = (cy_mqtt_qos_t) MQTT_MESSAGES_QOS,
+    .topic = MQTT_CLIP_TOPIC,
+    .topic_len = (sizeof(MQTT_CLIP_TOPIC) - 1),
+    .retain = false,
+    .dup = false
+};
+
+/* Publish message information of the sound level reports. */
+cy_mqtt_publish_info_t level_publish_info =
+{
+    .qos = (cy_mqtt_qos_t) MQTT_MESSAGES_QOS,
+    .topic = MQTT_LEVEL_TOPIC,
+    .topic_len = (sizeof(MQTT_LEVEL_TOPIC) - 1),
+    .retain = false,
+    .dup = false
+};
+
+/* Publish message information of the stage profiler dumps. */
+cy_mqtt_publish_info_t profile_publish_info =
+{
+    .qos = (cy_mqtt_qos_t) MQTT_MESSAGES_QOS,
+    .topic = MQTT_PROFILE_TOPIC,
+    .topic_len = (sizeof(MQTT_PROFILE_TOPIC) - 1),
+    .retain = false,
+    .dup = false
+};
+
+/* Payload of the chunk being published */
+static uint8_t clip_chunk[EVENT_CLIP_CHUNK_BYTES];
+
 /* Structure that stores the callback data for the GPIO interrupt event. */
 cyhal_gpio_callback_data_t cb_data =
 {
@@ -193,6 +227,69 @@ void publisher_task(void *pvParameters)
                     print_heap_usage("publisher_task: After publishing an MQTT message");
                     break;
                 }
+
+                case PUBLISH_MQTT_CLIP:
+                {
+                    /* Send the pre-roll of the event chunk by chunk, then
+                     * hand the clip back to the ML task. */
+                    event_clip_t *clip = (event_clip_t *) publisher_q_data.data;
+                    uint16_t chunk_count = event_clip_chunk_count(clip);
+
+                    printf("\nPublisher: Publishing %u clip chunks of '%s' on the topic '%s'\n",
+                           (unsigned int) chunk_count, clip->label, clip_publish_info.topic);
+
+                    for (uint16_t i = 0; i < chunk_count; i++)
+                    {
+                        clip_publish_info.payload = (const char *) clip_chunk;
+                        clip_publish_info.payload_len = event_clip_chunk(clip, i, clip_chunk, sizeof(clip_chunk));
+
+                        result = cy_mqtt_publish(mqtt_connection, &clip_publish_info);
+                        if (result != CY_RSLT_SUCCESS)
+                        {
+                            printf("  Publisher: MQTT Publish of clip chunk %u failed with error 0x%0X.\n\n",
+                                   (unsigned int) i, (int)result);
+                            mqtt_task_cmd = HANDLE_MQTT_PUBLISH_FAILURE;
+                            xQueueSend(mqtt_task_q, &mqtt_task_cmd, portMAX_DELAY);
+                            break;
+                        }
+                    }
+                    event_clip_release(clip);
+                    break;
+                }
+
+                case PUBLISH_MQTT_LEVEL:
+                {
+                    /* Publish the sound level report of the last period. */
+                    level_publish_info.payload = publisher_q_data.data;
+                    level_publish_info.payload_len = strlen(level_publish_info.payload);
+
+                    result = cy_mqtt_publish(mqtt_connection, &level_publish_info);
+                    if (result != CY_RSLT_SUCCESS)
+                    {
+                        printf("  Publisher: MQTT Publish of the sound level failed with error 0x%0X.\n\n",
+                               (int)result);
+                        mqtt_task_cmd = HANDLE_MQTT_PUBLISH_FAILURE;
+                        xQueueSend(mqtt_task_q, &mqtt_task_cmd, portMAX_DELAY);
+                    }
+                    break;
+                }
+
+                case PUBLISH_MQTT_PROFILE:
+                {
+                    /* Publish the per-stage timing of the model pipeline. */
+                    profile_publish_info.payload = publisher_q_data.data;
+                    profile_publish_info.payload_len = strlen(profile_publish_info.payload);
+
+                    result = cy_mqtt_publish(mqtt_connection, &profile_publish_info);
+                    if (result != CY_RSLT_SUCCESS)
+                    {
+                        printf("  Publisher: MQTT Publish of the stage profile failed with error 0x%0X.\n\n",
+                               (int)result);
+                        mqtt_task_cmd = HANDLE_MQTT_PUBLISH_FAILURE;
+                        xQueueSend(mqtt_task_q, &mqtt_task_cmd, portMAX_DELAY);
+                    }
+                    break;
+                }
             }
         }
     }
@@ -61,10 +61,16 @@ typedef enum
 {
     PUBLISHER_INIT,
     PUBLISHER_DEINIT,
-    PUBLISH_MQTT_MSG
+    PUBLISH_MQTT_MSG,
+    PUBLISH_MQTT_CLIP,
+    PUBLISH_MQTT_LEVEL,
+    PUBLISH_MQTT_PROFILE
 } publisher_cmd_t;
 
-/* Struct to be passed via the publisher task queue */
+/* Struct to be passed via the publisher task queue. For PUBLISH_MQTT_CLIP,
+ * data points to the event_clip_t to upload; it is released when sent. For
+ * PUBLISH_MQTT_LEVEL and PUBLISH_MQTT_PROFILE, data is the payload of
+ * sound_level_format() and stage_profiler_format(). */
 typedef struct{
     publisher_cmd_t cmd;
     char *data;
@@ -0,0 +1,355 @@
+/*
+ * quant_model.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Int8 execution of the conv1dlstm network. smartlistener_host quantize
+ * calibrates the activation ranges of the float network over the recorded
+ * sessions and writes the int8 layers to models/model_int8.c: symmetric
+ * weights with one scale per output channel, asymmetric activations with
+ * one scale and zero point per tensor, int32 biases, as the TFLite int8
+ * scheme. The float window is quantized once, the convolutions and the
+ * pooling then run on int8 columns with int32 accumulators and a Q31
+ * requantization per output channel.
+ *
+ * The LSTM multiplies int8 inputs and an int8 hidden state (fixed scale
+ * 2^-7) with int8 weights, but its 4 x 64 gate pre-activations, the
+ * nonlinearities and the cell state stay float, like the TFLM hybrid LSTM:
+ * they are a few hundred values per step. The FULLY_CONNECTED layer
+ * dequantizes its logits for the float SOFTMAX, so the scores are float as
+ * before.
+ *
+ * The zero point of an input only appears as input offset * sum of the
+ * weights, the generator folds that into the biases, so every dot product
+ * is a plain arm_dot_prod_q7(): 2 MACs per SMLAD on the Cortex-M4, as in
+ * CMSIS-NN.
+ */
+
+#include "quant_model.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define LSTM_GATES                      (4)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const quant_model_t *network;
+
+static int8_t activations[2][QUANT_MODEL_ACTIVATION_SIZE] __attribute__((aligned(4)));
+
+/* LSTM gate pre-activations, cell and hidden state */
+static float gates[LSTM_GATES * QUANT_MODEL_MAX_UNITS];
+static float cell[QUANT_MODEL_MAX_UNITS];
+static int8_t hidden[QUANT_MODEL_MAX_UNITS] __attribute__((aligned(4)));
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void run_conv(const quant_layer_t *layer, const int8_t *input, int8_t *output);
+static void run_max_pool(const quant_layer_t *layer, const int8_t *input, int8_t *output);
+static void run_lstm(const quant_layer_t *layer, const int8_t *input, int8_t *output);
+static void run_mean(const quant_layer_t *layer, const int8_t *input, int8_t *output);
+static void run_dense(const quant_layer_t *layer, const int8_t *input, float *scores);
+static int32_t dot_q7(const int8_t *x, const int8_t *w, int count);
+static int32_t requantize(int32_t acc, int32_t multiplier, int shift);
+static int8_t saturate_q7(int32_t x);
+static int32_t round_float(float x);
+
+
+/*******************************************************************************
+* Function Name: quant_model_init
+********************************************************************************
+* Summary:
+*    Checks that the int8 network fits the buffers of the runtime and makes
+*    it the one quant_model_run() uses.
+*
+* Parameters:
+*    model          Network generated by smartlistener_host quantize
+*
+* Return:
+*    0 on success, -1 if the network is not supported
+*
+*******************************************************************************/
+int quant_model_init(const quant_model_t *model)
+{
+    const quant_layer_t *last;
+
+    network = NULL;
+    if ((model == NULL) || (model->layer_count < 1) || (model->activation_size > QUANT_MODEL_ACTIVATION_SIZE) ||
+        ((uint32_t)model->input_frames * model->input_bands > QUANT_MODEL_ACTIVATION_SIZE) ||
+        (model->input_scale <= 0.0f))
+    {
+        return -1;
+    }
+    for (int i = 0; i < model->layer_count; i++)
+    {
+        const quant_layer_t *layer = &model->layers[i];
+
+        if (((uint32_t)layer->in_cols * layer->in_channels > QUANT_MODEL_ACTIVATION_SIZE) ||
+            ((uint32_t)layer->out_cols * layer->out_channels > QUANT_MODEL_ACTIVATION_SIZE) ||
+            ((layer->type == QUANT_LAYER_LSTM) && (layer->out_channels > QUANT_MODEL_MAX_UNITS)) ||
+            ((layer->type == QUANT_LAYER_DENSE) && (i != model->layer_count - 1)))
+        {
+            return -1;
+        }
+    }
+    last = &model->layers[model->layer_count - 1];
+    if ((last->type != QUANT_LAYER_DENSE) || (last->out_channels != model->output_count) ||
+        (model->output_count > QUANT_MODEL_MAX_OUTPUTS))
+    {
+        return -1;
+    }
+    network = model;
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: quant_model_run
+********************************************************************************
+* Summary:
+*    Runs the int8 network on one window of float features.
+*
+* Parameters:
+*    window         Features, float[input_frames][input_bands]
+*    scores         Output scores, float[output_count]
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void quant_model_run(const float *window, float *scores)
+{
+    const int32_t count = (int32_t)network->input_frames * network->input_bands;
+    const float inverse_scale = 1.0f / network->input_scale;
+    int8_t *input = activations[0];
+    int8_t *output = activations[1];
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        input[i] = saturate_q7(round_float(window[i] * inverse_scale) + network->input_zero_point);
+    }
+
+    for (int i = 0; i < network->layer_count; i++)
+    {
+        const quant_layer_t *layer = &network->layers[i];
+        int8_t *swap;
+
+        switch (layer->type)
+        {
+            case QUANT_LAYER_CONV:
+                run_conv(layer, input, output);
+                break;
+            case QUANT_LAYER_MAX_POOL:
+                run_max_pool(layer, input, output);
+                break;
+            case QUANT_LAYER_LSTM:
+                run_lstm(layer, input, output);
+                break;
+            case QUANT_LAYER_MEAN:
+                run_mean(layer, input, output);
+                break;
+            case QUANT_LAYER_DENSE:
+                run_dense(layer, input, scores);
+                return;
+        }
+        swap = input;
+        input = output;
+        output = swap;
+    }
+}
+
+
+/* Every output is one dot product over the taps inside the input, the
+ * columns and the [taps][in] weights of a channel are contiguous. The bias
+ * holds input offset * sum of all the weights, a padded tap is a zero whose
+ * quantized value cancels its offset, so the edge columns take the weights
+ * of their padded taps back out. */
+static void run_conv(const quant_layer_t *layer, const int8_t *input, int8_t *output)
+{
+    const int in = layer->in_channels;
+    const int taps = layer->taps;
+
+    for (int col = 0; col < layer->out_cols; col++)
+    {
+        const int first = col * layer->stride - layer->pad;
+        const int tap_begin = (first < 0) ? -first : 0;
+        const int tap_end = (first + taps > layer->in_cols) ? layer->in_cols - first : taps;
+        int8_t *y = &output[col * layer->out_channels];
+
+        for (int o = 0; o < layer->out_channels; o++)
+        {
+            const int8_t *w = &layer->weights[o * taps * in];
+            int32_t acc = layer->bias[o];
+
+            if (tap_end > tap_begin)
+            {
+                acc += dot_q7(&input[(first + tap_begin) * in], &w[tap_begin * in], (tap_end - tap_begin) * in);
+            }
+            if ((tap_begin > 0) || (tap_end < taps))
+            {
+                int32_t padded = 0;
+
+                for (int i = 0; i < tap_begin * in; i++)
+                {
+                    padded += w[i];
+                }
+                for (int i = tap_end * in; i < taps * in; i++)
+                {
+                    padded += w[i];
+                }
+                acc -= padded * layer->input_offset;
+            }
+            acc = requantize(acc, layer->multiplier[o], layer->shift[o]) + layer->output_offset;
+            acc = (acc < layer->act_min) ? layer->act_min : ((acc > layer->act_max) ? layer->act_max : acc);
+            y[o] = (int8_t)acc;
+        }
+    }
+}
+
+
+/* Same quantization in and out, the maximum of the int8 values */
+static void run_max_pool(const quant_layer_t *layer, const int8_t *input, int8_t *output)
+{
+    const int channels = layer->in_channels;
+
+    for (int col = 0; col < layer->out_cols; col++)
+    {
+        const int8_t *x = &input[col * layer->taps * channels];
+        int8_t *y = &output[col * channels];
+
+        memcpy(y, x, channels);
+        for (int k = 1; k < layer->taps; k++)
+        {
+            for (int c = 0; c < channels; c++)
+            {
+                y[c] = (x[k * channels + c] > y[c]) ? x[k * channels + c] : y[c];
+            }
+        }
+    }
+}
+
+
+/* Input, forget, cell and output gate rows in that order, zero initial state.
+ * The float biases hold the input offsets. */
+static void run_lstm(const quant_layer_t *layer, const int8_t *input, int8_t *output)
+{
+    const int units = layer->out_channels;
+    const int inputs = layer->in_channels;
+
+    memset(hidden, 0, units);
+    memset(cell, 0, units * sizeof(float));
+    for (int t = 0; t < layer->in_cols; t++)
+    {
+        const int8_t *x = &input[t * inputs];
+
+        for (int r = 0; r < LSTM_GATES * units; r++)
+        {
+            const int32_t dot_input = dot_q7(x, &layer->weights[r * inputs], inputs);
+            const int32_t dot_hidden = dot_q7(hidden, &layer->recurrent_weights[r * units], units);
+
+            gates[r] = layer->float_bias[r] + (float)dot_input * layer->scale[r] +
+                       (float)dot_hidden * layer->recurrent_scale[r];
+        }
+        for (int u = 0; u < units; u++)
+        {
+            const float in_gate = 1.0f / (1.0f + expf(-gates[u]));
+            const float forget_gate = 1.0f / (1.0f + expf(-gates[units + u]));
+            const float out_gate = 1.0f / (1.0f + expf(-gates[3 * units + u]));
+
+            cell[u] = forget_gate * cell[u] + in_gate * tanhf(gates[2 * units + u]);
+            if (layer->cell_clip > 0.0f)
+            {
+                cell[u] = (cell[u] > layer->cell_clip) ? layer->cell_clip
+                                                       : ((cell[u] < -layer->cell_clip) ? -layer->cell_clip : cell[u]);
+            }
+            hidden[u] = saturate_q7(round_float(out_gate * tanhf(cell[u]) / QUANT_MODEL_HIDDEN_SCALE));
+        }
+        memcpy(&output[t * units], hidden, units);
+    }
+}
+
+
+/* scale[0] is input scale / (columns * output scale) */
+static void run_mean(const quant_layer_t *layer, const int8_t *input, int8_t *output)
+{
+    for (int c = 0; c < layer->in_channels; c++)
+    {
+        int32_t sum = 0;
+
+        for (int col = 0; col < layer->in_cols; col++)
+        {
+            sum += input[col * layer->in_channels + c] + layer->input_offset;
+        }
+        output[c] = saturate_q7(round_float((float)sum * layer->scale[0]) + layer->output_offset);
+    }
+}
+
+
+static void run_dense(const quant_layer_t *layer, const int8_t *input, float *scores)
+{
+    const int inputs = layer->in_cols * layer->in_channels;
+    float max;
+    float sum = 0.0f;
+
+    for (int o = 0; o < layer->out_channels; o++)
+    {
+        scores[o] = layer->float_bias[o] +
+                    (float)dot_q7(input, &layer->weights[o * inputs], inputs) * layer->scale[o];
+    }
+    max = scores[0];
+    for (int o = 1; o < layer->out_channels; o++)
+    {
+        max = (scores[o] > max) ? scores[o] : max;
+    }
+    for (int o = 0; o < layer->out_channels; o++)
+    {
+        scores[o] = expf(scores[o] - max);
+        sum += scores[o];
+    }
+    for (int o = 0; o < layer->out_channels; o++)
+    {
+        scores[o] /= sum;
+    }
+}
+
+
+static int32_t dot_q7(const int8_t *x, const int8_t *w, int count)
+{
+    q31_t dot;
+
+    arm_dot_prod_q7(x, w, count, &dot);
+    return dot;
+}
+
+
+/* acc * multiplier * 2^(shift - 31), rounded half up. The generator keeps
+ * shift at or below 30. */
+static int32_t requantize(int32_t acc, int32_t multiplier, int shift)
+{
+    const int total = 31 - shift;
+
+    return (int32_t)(((int64_t)acc * multiplier + ((int64_t)1 << (total - 1))) >> total);
+}
+
+
+static int8_t saturate_q7(int32_t x)
+{
+    return (int8_t)((x > 127) ? 127 : ((x < -128) ? -128 : x));
+}
+
+
+/* Round half away from zero without the libm call */
+static int32_t round_float(float x)
+{
+    return (int32_t)((x >= 0.0f) ? x + 0.5f : x - 0.5f);
+}
@@ -0,0 +1,94 @@
+/*
+ * quant_model.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_QUANT_MODEL_H_
+#define SOURCE_QUANT_MODEL_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* 1 runs the model windows with quant_model_run() on the int8 network of
+ * models/model_int8.c instead of the float flatbuffer, see quant_model.c */
+#ifndef MODEL_INT8_ENABLE
+#define MODEL_INT8_ENABLE                   (0)
+#endif
+
+/* Bytes of each of the two activation buffers the layers ping-pong between */
+#define QUANT_MODEL_ACTIVATION_SIZE         (1536)
+
+/* Largest supported network */
+#define QUANT_MODEL_MAX_UNITS               (64)    /* LSTM units */
+#define QUANT_MODEL_MAX_OUTPUTS             (16)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef enum {
+    QUANT_LAYER_CONV = 0,           /* CONV_2D along time, per output channel requantization */
+    QUANT_LAYER_MAX_POOL,           /* MAX_POOL_2D along time, size == stride, no requantization */
+    QUANT_LAYER_LSTM,               /* Stateless LSTM, int8 weights, float gates and cell */
+    QUANT_LAYER_MEAN,               /* MEAN over time */
+    QUANT_LAYER_DENSE               /* FULLY_CONNECTED and SOFTMAX, float scores */
+} quant_layer_type_t;
+
+/* One layer on [columns][channels] int8 activations. Weights are symmetric
+ * int8 with one scale per output channel (per gate row for the LSTM),
+ * activations asymmetric int8 with one scale per tensor. */
+typedef struct {
+    quant_layer_type_t type;
+    uint16_t in_cols;
+    uint16_t in_channels;
+    uint16_t out_cols;
+    uint16_t out_channels;          /* LSTM: units */
+    uint8_t taps;                   /* CONV: kernel width, MAX_POOL: size and stride */
+    uint8_t stride;
+    uint8_t pad;                    /* CONV: zero columns before column 0 */
+    int16_t input_offset;           /* Minus the zero point of the input, CONV and MEAN */
+    int16_t output_offset;          /* Zero point of the output */
+    int8_t act_min;                 /* Output clamp, ReLU folded in */
+    int8_t act_max;
+    const int8_t *weights;          /* CONV [out][taps][in], LSTM [4 * units][in], DENSE [out][in] */
+    const int32_t *bias;            /* CONV: bias / (input scale * weight scale) + input offset * sum of the weights */
+    const int32_t *multiplier;      /* CONV: Q31 of input scale * weight scale / output scale */
+    const int8_t *shift;            /* CONV: left shift of the multiplier */
+    const int8_t *recurrent_weights;  /* LSTM [4 * units][units] */
+    const float *scale;             /* LSTM, DENSE: input scale * weight scale per row; MEAN: one factor */
+    const float *recurrent_scale;   /* LSTM: hidden state scale * weight scale per row */
+    const float *float_bias;        /* LSTM [4 * units], DENSE [out], with input offset * sum of the weights * scale */
+    float cell_clip;                /* LSTM, 0 for none */
+} quant_layer_t;
+
+/* Network generated by smartlistener_host quantize */
+typedef struct {
+    const quant_layer_t *layers;
+    int layer_count;
+    uint16_t input_frames;          /* Float input window [frames][bands] */
+    uint16_t input_bands;
+    float input_scale;
+    int16_t input_zero_point;
+    uint16_t output_count;
+    uint32_t activation_size;       /* Largest activation in bytes */
+    uint32_t readonly_size;         /* Bytes of weights and tables */
+} quant_model_t;
+
+/* Hidden state of the LSTM, symmetric with a fixed scale of 2^-7 */
+#define QUANT_MODEL_HIDDEN_SCALE            (1.0f / 128.0f)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int quant_model_init(const quant_model_t *model);
+void quant_model_run(const float *window, float *scores);
+
+/* Network of models/model_int8.c, there with MODEL_INT8_ENABLE only */
+extern const quant_model_t model_int8;
+
+
+#endif /* SOURCE_QUANT_MODEL_H_ */
@@ -0,0 +1,310 @@
+/*
+ * resampler.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Streaming polyphase resampler for 16-bit PCM, used to bring 8, 22.05,
+ * 44.1 or 48 kHz audio to the 16 kHz the model front-end expects.
+ *
+ * The anti-aliasing/interpolation filter is a Kaiser windowed sinc with its
+ * cutoff below the lower of the two Nyquist frequencies. It is stored as
+ * RESAMPLER_PHASES + 1 branches of RESAMPLER_TAPS Q14 coefficients, each
+ * normalized to unity DC gain. An output sample between two branches is
+ * the linear interpolation of the two branch outputs, so the table size
+ * does not depend on the rate ratio. The position is tracked as an integer
+ * plus a remainder in 1/out_rate units, so there is no drift.
+ *
+ * The dot products use CMSIS-DSP on the device and SSE2 or NEON on the
+ * host. Q14 leaves room for a sum of absolute coefficients up to 4 per
+ * branch (the sinc side lobes of a 0.95 band interpolator add up to about
+ * 2.3), so a branch output always fits in 32 bits.
+ */
+
+#include "resampler.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(COMPONENT_CMSIS_DSP)
+#include "arm_math.h"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define HALF_TAPS                       (RESAMPLER_TAPS / 2)
+
+/* Fractional bits of the coefficients */
+#define COEF_SHIFT                      (14)
+#define HISTORY_SIZE                    (RESAMPLER_TAPS + RESAMPLER_CHUNK)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int32_t dot_q15(const int16_t *a, const int16_t *b);
+static float bessel_i0(float x);
+
+
+/*******************************************************************************
+* Function Name: resampler_init
+********************************************************************************
+* Summary:
+*    Designs the polyphase filter for the given rates and resets the stream.
+*    Equal rates make the resampler a copy.
+*
+* Parameters:
+*    resampler      Instance to initialize
+*    in_rate        Input sample rate in Hz
+*    out_rate       Output sample rate in Hz
+*
+* Return:
+*    0 on success, -1 if the ratio is not supported
+*
+*******************************************************************************/
+int resampler_init(resampler_t *resampler, uint32_t in_rate, uint32_t out_rate)
+{
+    float cutoff;
+    float beta_scale = 1.0f / bessel_i0(RESAMPLER_KAISER_BETA);
+
+    if ((in_rate == 0) || (out_rate == 0) ||
+        (in_rate > out_rate * RESAMPLER_MAX_RATIO) || (out_rate > in_rate * RESAMPLER_MAX_RATIO))
+    {
+        return -1;
+    }
+
+    resampler->in_rate = in_rate;
+    resampler->out_rate = out_rate;
+    resampler->step_int = in_rate / out_rate;
+    resampler->step_rem = in_rate % out_rate;
+
+    /* Cutoff in cycles per input sample, times two */
+    cutoff = RESAMPLER_BANDWIDTH * ((out_rate < in_rate) ? (float)out_rate / in_rate : 1.0f);
+
+    for (int p = 0; p <= RESAMPLER_PHASES; p++)
+    {
+        float branch[RESAMPLER_TAPS];
+        float sum = 0.0f;
+        int32_t abs_sum = 0;
+        float frac = (float)p / RESAMPLER_PHASES;
+
+        /* Tap j multiplies the input sample at distance t from the output */
+        for (int j = 0; j < RESAMPLER_TAPS; j++)
+        {
+            float t = frac + HALF_TAPS - 1 - j;
+            float x = (float)M_PI * cutoff * t;
+            float r = t / HALF_TAPS;
+            float sinc = (fabsf(x) < 1e-6f) ? 1.0f : sinf(x) / x;
+            float window = (fabsf(r) >= 1.0f) ? 0.0f :
+                bessel_i0(RESAMPLER_KAISER_BETA * sqrtf(1.0f - r * r)) * beta_scale;
+
+            branch[j] = cutoff * sinc * window;
+            sum += branch[j];
+        }
+
+        for (int j = 0; j < RESAMPLER_TAPS; j++)
+        {
+            int32_t q = (int32_t)lrintf(branch[j] / sum * (float)(1 << COEF_SHIFT));
+
+            q = (q > 32767) ? 32767 : ((q < -32767) ? -32767 : q);
+            resampler->coefs[p * RESAMPLER_TAPS + j] = (int16_t) q;
+            abs_sum += (q < 0) ? -q : q;
+        }
+        if (abs_sum >= (4 << COEF_SHIFT))
+        {
+            return -1;
+        }
+    }
+
+    resampler_reset(resampler);
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: resampler_reset
+********************************************************************************
+* Summary:
+*    Clears the history, the next input sample becomes the first output
+*    position.
+*
+* Parameters:
+*    resampler      Initialized instance
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void resampler_reset(resampler_t *resampler)
+{
+    memset(resampler->history, 0, sizeof(resampler->history));
+    resampler->buffered = HALF_TAPS - 1;
+    resampler->pos_int = HALF_TAPS - 1;
+    resampler->pos_rem = 0;
+}
+
+
+/*******************************************************************************
+* Function Name: resampler_process
+********************************************************************************
+* Summary:
+*    Consumes count input samples and writes every output sample that can be
+*    computed from them. The output lags the input by RESAMPLER_TAPS / 2
+*    input samples.
+*
+* Parameters:
+*    resampler      Initialized instance
+*    src            Input samples at in_rate
+*    count          Number of input samples
+*    dst            Output samples at out_rate, room for
+*                   RESAMPLER_MAX_OUTPUT(count, in_rate, out_rate) samples
+*
+* Return:
+*    Number of samples written to dst
+*
+*******************************************************************************/
+size_t resampler_process(resampler_t *resampler, const int16_t *src, size_t count, int16_t *dst)
+{
+    const uint32_t out_rate = resampler->out_rate;
+    size_t written = 0;
+
+    if (resampler->in_rate == out_rate)
+    {
+        memcpy(dst, src, count * sizeof(int16_t));
+        return count;
+    }
+
+    while (count > 0)
+    {
+        uint32_t n = HISTORY_SIZE - resampler->buffered;
+        uint32_t drop;
+
+        if (n > count)
+        {
+            n = (uint32_t) count;
+        }
+        memcpy(&resampler->history[resampler->buffered], src, n * sizeof(int16_t));
+        resampler->buffered += n;
+        src += n;
+        count -= n;
+
+        /* Every output position whose taps are all available */
+        while (resampler->pos_int + HALF_TAPS < resampler->buffered)
+        {
+            const int16_t *taps = &resampler->history[resampler->pos_int - (HALF_TAPS - 1)];
+            uint32_t phase_pos = resampler->pos_rem * RESAMPLER_PHASES;
+            uint32_t phase = phase_pos / out_rate;
+            int32_t weight = (int32_t)(((uint64_t)(phase_pos % out_rate) << 15) / out_rate);
+            int32_t y0 = dot_q15(taps, &resampler->coefs[phase * RESAMPLER_TAPS]);
+            int32_t y1 = dot_q15(taps, &resampler->coefs[(phase + 1) * RESAMPLER_TAPS]);
+            int64_t y = y0 + ((((int64_t)y1 - y0) * weight) >> 15);
+
+            y = (y + (1 << (COEF_SHIFT - 1))) >> COEF_SHIFT;
+            dst[written++] = (int16_t)((y > 32767) ? 32767 : ((y < -32768) ? -32768 : y));
+
+            resampler->pos_int += resampler->step_int;
+            resampler->pos_rem += resampler->step_rem;
+            if (resampler->pos_rem >= out_rate)
+            {
+                resampler->pos_rem -= out_rate;
+                resampler->pos_int++;
+            }
+        }
+
+        /* Keep the samples still needed by the next output position */
+        drop = resampler->pos_int - (HALF_TAPS - 1);
+        memmove(resampler->history, &resampler->history[drop], (resampler->buffered - drop) * sizeof(int16_t));
+        resampler->buffered -= drop;
+        resampler->pos_int -= drop;
+    }
+    return written;
+}
+
+
+/* Q29 dot product of RESAMPLER_TAPS Q15 samples and Q14 coefficients */
+#if defined(COMPONENT_CMSIS_DSP)
+
+static int32_t dot_q15(const int16_t *a, const int16_t *b)
+{
+    q63_t result;
+
+    arm_dot_prod_q15(a, b, RESAMPLER_TAPS, &result);
+    return (int32_t) result;
+}
+
+#elif defined(__SSE2__)
+
+static int32_t dot_q15(const int16_t *a, const int16_t *b)
+{
+    __m128i acc = _mm_setzero_si128();
+
+    for (int i = 0; i < RESAMPLER_TAPS; i += 8)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)&a[i]);
+        __m128i c = _mm_load_si128((const __m128i *)&b[i]);
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(x, c));
+    }
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(acc);
+}
+
+#elif defined(__ARM_NEON)
+
+static int32_t dot_q15(const int16_t *a, const int16_t *b)
+{
+    int32x4_t acc = vdupq_n_s32(0);
+
+    for (int i = 0; i < RESAMPLER_TAPS; i += 8)
+    {
+        int16x8_t x = vld1q_s16(&a[i]);
+        int16x8_t c = vld1q_s16(&b[i]);
+        acc = vmlal_s16(acc, vget_low_s16(x), vget_low_s16(c));
+        acc = vmlal_s16(acc, vget_high_s16(x), vget_high_s16(c));
+    }
+    return vaddvq_s32(acc);
+}
+
+#else
+
+static int32_t dot_q15(const int16_t *a, const int16_t *b)
+{
+    int32_t acc = 0;
+
+    for (int i = 0; i < RESAMPLER_TAPS; i++)
+    {
+        acc += (int32_t) a[i] * b[i];
+    }
+    return acc;
+}
+
+#endif
+
+
+/* Modified Bessel function of the first kind, order 0 (power series) */
+static float bessel_i0(float x)
+{
+    float term = 1.0f;
+    float sum = 1.0f;
+    float half = x * 0.5f;
+
+    for (int k = 1; k < 32; k++)
+    {
+        term *= (half / k) * (half / k);
+        sum += term;
+        if (term < sum * 1e-9f)
+        {
+            break;
+        }
+    }
+    return sum;
+}
@@ -0,0 +1,67 @@
+/*
+ * resampler.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_RESAMPLER_H_
+#define SOURCE_RESAMPLER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Taps of each polyphase branch. A multiple of 8 so the dot products map to
+ * whole SIMD vectors. The group delay is RESAMPLER_TAPS / 2 input samples. */
+#define RESAMPLER_TAPS                  (64)
+
+/* Number of polyphase branches. Positions between two branches are linearly
+ * interpolated, so any rate ratio is supported with a fixed table size. */
+#define RESAMPLER_PHASES                (64)
+
+/* Input samples buffered per pass */
+#define RESAMPLER_CHUNK                 (256)
+
+/* Largest supported up- or down-sampling factor */
+#define RESAMPLER_MAX_RATIO             (8)
+
+/* Passband edge relative to the lower of the two Nyquist frequencies. At
+ * 0.95 decimation to 16 kHz keeps the mel filterbank band (up to 7 kHz) flat. */
+#define RESAMPLER_BANDWIDTH             (0.95f)
+
+/* Kaiser window shape, about 80 dB stopband */
+#define RESAMPLER_KAISER_BETA           (8.0f)
+
+/* Upper bound of the samples resampler_process() writes for count inputs */
+#define RESAMPLER_MAX_OUTPUT(count, in_rate, out_rate) \
+                                        ((size_t)(((uint64_t)(count) * (out_rate) + (in_rate) - 1) / (in_rate)) + 1)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint32_t in_rate;
+    uint32_t out_rate;
+    uint32_t step_int;              /* Input samples per output sample ... */
+    uint32_t step_rem;              /* ... plus step_rem / out_rate */
+    uint32_t pos_int;               /* Index in history of the next output position ... */
+    uint32_t pos_rem;               /* ... plus pos_rem / out_rate */
+    uint32_t buffered;              /* Valid samples in history */
+    int16_t history[RESAMPLER_TAPS + RESAMPLER_CHUNK] __attribute__((aligned(16)));
+    /* Q14 coefficients, RESAMPLER_PHASES + 1 branches of RESAMPLER_TAPS */
+    int16_t coefs[(RESAMPLER_PHASES + 1) * RESAMPLER_TAPS] __attribute__((aligned(16)));
+} resampler_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int resampler_init(resampler_t *resampler, uint32_t in_rate, uint32_t out_rate);
+void resampler_reset(resampler_t *resampler);
+size_t resampler_process(resampler_t *resampler, const int16_t *src, size_t count, int16_t *dst);
+
+
+#endif /* SOURCE_RESAMPLER_H_ */
@@ -0,0 +1,288 @@
+/*
+ * sound_level.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * A-weighted sound level meter on the magnitude spectrum of the feature bus.
+ * Every hop the power of the 257 bins is weighted with a table of A-weighting
+ * power gains (IEC 61672-1) that also holds the Hann window and the real FFT
+ * scaling (Parseval) and the input gain of the samples, which gives the
+ * A-weighted mean square of the hop relative to the PCM full scale in one
+ * multiply-add per bin. No FFT runs for the meter.
+ *
+ * The hops are integrated into LAeq over the configured period, and an
+ * exponential Fast (125 ms) time weighting gives LAFmax. The meter needs the
+ * magnitude spectrum, so it is only built with SOUND_LEVEL_ENABLE, without the
+ * q15 and the stereo front-ends. Inputs that clip after the digital boost read low, the peak of
+ * the report shows it. `smartlistener_host level-cal` checks the readings
+ * against reference tones.
+ */
+
+#include "sound_level.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "feature_bus.h"
+
+#if SOUND_LEVEL_ENABLE
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Mean square of a full-scale sine */
+#define FULL_SCALE_SINE_POWER               (0.5f)
+
+/* Sum of the squares of the symmetric Hann window of models/model.c */
+#define WINDOW_POWER_SUM                    (3.0 * (FEATURE_BUS_FFT_LEN - 1) / 8.0)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    int id;                         /* Feature bus subscription, -1 if none */
+    sound_level_config_t config;
+    uint32_t period_hops;
+    float fast_alpha;               /* Fast time weighting per hop */
+    float fast;                     /* Fast weighted mean square */
+    float energy;                   /* Sum of the mean squares of the period */
+    float fast_max;
+    float peak;
+    uint32_t hops;
+    uint32_t sequence;
+    int pending;                    /* report holds a period not yet taken */
+    sound_level_report_t report;
+} sound_level_meter_t;
+
+static sound_level_meter_t meter = { .id = -1 };
+
+/* A-weighting power gain of every bin, with the window, FFT and input gain */
+static float bin_gain[FEATURE_BUS_BINS];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static double a_weighting(double hz);
+static float to_db(float power, float reference);
+static void sound_level_hop(const feature_frame_t *frame, void *context);
+
+
+/*******************************************************************************
+* Function Name: sound_level_default_config
+********************************************************************************
+* Summary:
+*    Returns the configuration of the macros in sound_level.h.
+*
+* Parameters:
+*    config         Filled with the defaults, input_gain is 1
+*
+*******************************************************************************/
+void sound_level_default_config(sound_level_config_t *config)
+{
+    config->reference_db_spl = SOUND_LEVEL_REFERENCE_DB_SPL;
+    config->input_gain = 1.0f;
+    config->period_ms = SOUND_LEVEL_PERIOD_MS;
+}
+
+
+/*******************************************************************************
+* Function Name: sound_level_init
+********************************************************************************
+* Summary:
+*    Computes the weighting table and subscribes the meter to the magnitude
+*    spectrum of the feature bus. Restarts the integration.
+*
+* Parameters:
+*    config         Calibration and integration period
+*
+* Return:
+*    0 or -1 if the configuration is invalid or the bus is full
+*
+*******************************************************************************/
+int sound_level_init(const sound_level_config_t *config)
+{
+    const double hop_s = (double)SOUND_LEVEL_HOP / SOUND_LEVEL_SAMPLE_RATE;
+    double scale;
+
+    sound_level_deinit();
+    if ((config->input_gain <= 0.0f) || (config->period_ms < 1000.0 * hop_s))
+    {
+        return -1;
+    }
+
+    /* |X(k)|^2 of the bins between DC and Nyquist stands for both halves of
+     * the spectrum */
+    scale = 1.0 / ((double)FEATURE_BUS_FFT_LEN * WINDOW_POWER_SUM * config->input_gain * config->input_gain);
+    for (int k = 0; k < FEATURE_BUS_BINS; k++)
+    {
+        const double hz = (double)k * SOUND_LEVEL_SAMPLE_RATE / FEATURE_BUS_FFT_LEN;
+        const double weight = a_weighting(hz);
+        const double sides = ((k == 0) || (k == FEATURE_BUS_BINS - 1)) ? 1.0 : 2.0;
+
+        bin_gain[k] = (float)(sides * scale * weight * weight);
+    }
+
+    meter.config = *config;
+    meter.period_hops = (uint32_t)(config->period_ms / (1000.0 * hop_s) + 0.5);
+    meter.fast_alpha = (float)(1.0 - exp(-hop_s / SOUND_LEVEL_FAST_TAU_S));
+    meter.fast = 0.0f;
+    meter.energy = 0.0f;
+    meter.fast_max = 0.0f;
+    meter.peak = 0.0f;
+    meter.hops = 0;
+    meter.sequence = 0;
+    meter.pending = 0;
+
+    meter.id = feature_bus_subscribe(sound_level_hop, &meter, FEATURE_BUS_MAGNITUDE);
+    return (meter.id < 0) ? -1 : 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sound_level_deinit
+********************************************************************************
+* Summary:
+*    Removes the meter from the feature bus.
+*
+*******************************************************************************/
+void sound_level_deinit(void)
+{
+    if (meter.id >= 0)
+    {
+        feature_bus_unsubscribe(meter.id);
+        meter.id = -1;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sound_level_peak
+********************************************************************************
+* Summary:
+*    Records the peak of a block for the report of the current period.
+*
+* Parameters:
+*    sample_max     Largest absolute sample of the block, as returned by
+*                   audio_ingest_block()
+*
+*******************************************************************************/
+void sound_level_peak(float sample_max)
+{
+    if (sample_max > meter.peak)
+    {
+        meter.peak = sample_max;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sound_level_get_report
+********************************************************************************
+* Summary:
+*    Takes the report of the last completed period.
+*
+* Parameters:
+*    report         Filled with the report if there is a new one
+*
+* Return:
+*    1 if a period completed since the last call, else 0
+*
+*******************************************************************************/
+int sound_level_get_report(sound_level_report_t *report)
+{
+    if (!meter.pending)
+    {
+        return 0;
+    }
+    *report = meter.report;
+    meter.pending = 0;
+    return 1;
+}
+
+
+/*******************************************************************************
+* Function Name: sound_level_format
+********************************************************************************
+* Summary:
+*    Formats a report as the compact JSON payload of the MQTT level metric,
+*    e.g. {"seq":12,"T":10,"LAeq":48.3,"LAFmax":61.0,"peak":-14.2}
+*
+* Parameters:
+*    report         Report to format
+*    buffer         Payload, SOUND_LEVEL_PAYLOAD_MAX bytes are always enough
+*    size           Size of the buffer
+*
+* Return:
+*    Length of the payload, as snprintf()
+*
+*******************************************************************************/
+int sound_level_format(const sound_level_report_t *report, char *buffer, size_t size)
+{
+    return snprintf(buffer, size, "{\"seq\":%lu,\"T\":%g,\"LAeq\":%.1f,\"LAFmax\":%.1f,\"peak\":%.1f}",
+                    (unsigned long)report->sequence, (double)report->period_s, (double)report->laeq,
+                    (double)report->lafmax, (double)report->peak_dbfs);
+}
+
+
+/* Linear A-weighting gain, IEC 61672-1 (A = 0 dB at 1 kHz) */
+static double a_weighting(double hz)
+{
+    const double f2 = hz * hz;
+    const double ra = (12194.0 * 12194.0 * f2 * f2) /
+                      ((f2 + 20.6 * 20.6) * sqrt((f2 + 107.7 * 107.7) * (f2 + 737.9 * 737.9)) *
+                       (f2 + 12194.0 * 12194.0));
+
+    /* 10^(2.00 / 20) */
+    return ra * 1.2589254117941673;
+}
+
+
+static float to_db(float power, float reference)
+{
+    float db = 10.0f * log10f(power / reference);
+
+    return (db > SOUND_LEVEL_FLOOR_DB) ? db : SOUND_LEVEL_FLOOR_DB;
+}
+
+
+/* Feature bus consumer, one front-end hop */
+static void sound_level_hop(const feature_frame_t *frame, void *context)
+{
+    sound_level_meter_t *level = (sound_level_meter_t *)context;
+    const float *magnitude = frame->magnitude;
+    float power = 0.0f;
+
+    for (int k = 0; k < FEATURE_BUS_BINS; k++)
+    {
+        power += bin_gain[k] * magnitude[k] * magnitude[k];
+    }
+
+    level->fast += level->fast_alpha * (power - level->fast);
+    if (level->fast > level->fast_max)
+    {
+        level->fast_max = level->fast;
+    }
+    level->energy += power;
+
+    if (++level->hops == level->period_hops)
+    {
+        sound_level_report_t *report = &level->report;
+
+        report->sequence = ++level->sequence;
+        report->hops = level->hops;
+        report->period_s = (float)level->hops * SOUND_LEVEL_HOP / SOUND_LEVEL_SAMPLE_RATE;
+        report->laeq = level->config.reference_db_spl +
+                       to_db(level->energy / level->hops, FULL_SCALE_SINE_POWER);
+        report->lafmax = level->config.reference_db_spl + to_db(level->fast_max, FULL_SCALE_SINE_POWER);
+        report->peak_dbfs = to_db(level->peak * level->peak, 1.0f);
+        level->pending = 1;
+
+        level->energy = 0.0f;
+        level->fast_max = 0.0f;
+        level->peak = 0.0f;
+        level->hops = 0;
+    }
+}
+
+#endif /* SOUND_LEVEL_ENABLE */
@@ -0,0 +1,83 @@
+/*
+ * sound_level.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_SOUND_LEVEL_H_
+#define SOURCE_SOUND_LEVEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "frontend_q15.h"
+#include "stereo_frontend.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* The meter reads the magnitude spectrum that only the float mono front-end
+ * publishes on the feature bus, so it is not built with the q15 or the
+ * stereo front-end */
+#define SOUND_LEVEL_ENABLE                  (!FRONTEND_Q15_ENABLE && !STEREO_FRONTEND_ENABLE)
+
+/* Sound pressure level in dB SPL of a full-scale sine at the PDM/PCM output.
+ * Nominal value for a -26 dBFS at 94 dB SPL microphone with MICROPHONE_GAIN
+ * 20 (+10 dB). Measure it with an acoustic calibrator (1 kHz, 94 dB SPL)
+ * and set it per board for absolute readings. */
+#define SOUND_LEVEL_REFERENCE_DB_SPL        (110.0f)
+
+/* Integration period of one LAeq/LAFmax report */
+#define SOUND_LEVEL_PERIOD_MS               (10000u)
+
+/* Hop and sample rate of the model front-end the meter is fed from */
+#define SOUND_LEVEL_SAMPLE_RATE             (16000)
+#define SOUND_LEVEL_HOP                     (320)
+
+/* Time constant of the Fast (F) time weighting, IEC 61672-1 */
+#define SOUND_LEVEL_FAST_TAU_S              (0.125f)
+
+/* Floor of the reported levels, in dB below the reference */
+#define SOUND_LEVEL_FLOOR_DB                (-120.0f)
+
+/* Largest payload of sound_level_format() */
+#define SOUND_LEVEL_PAYLOAD_MAX             (96)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    float reference_db_spl;         /* See SOUND_LEVEL_REFERENCE_DB_SPL */
+    float input_gain;               /* Gain applied to the samples before the front-end,
+                                     * DIGITAL_BOOST_FACTOR of ml_task.c */
+    uint32_t period_ms;             /* See SOUND_LEVEL_PERIOD_MS */
+} sound_level_config_t;
+
+/* One integration period */
+typedef struct {
+    uint32_t sequence;              /* Periods completed since sound_level_init() */
+    uint32_t hops;                  /* Front-end hops integrated */
+    float period_s;                 /* Length of the period */
+    float laeq;                     /* A-weighted equivalent level, dB(A) */
+    float lafmax;                   /* Largest A-weighted Fast level, dB(A) */
+    float peak_dbfs;                /* Largest sample at the front-end input, dB below its
+                                     * full scale. 0 means the input clipped. */
+} sound_level_report_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void sound_level_default_config(sound_level_config_t *config);
+int sound_level_init(const sound_level_config_t *config);
+void sound_level_deinit(void);
+
+/* Called with the peak of every block that goes to the front-end */
+void sound_level_peak(float sample_max);
+
+int sound_level_get_report(sound_level_report_t *report);
+int sound_level_format(const sound_level_report_t *report, char *buffer, size_t size);
+
+
+#endif /* SOURCE_SOUND_LEVEL_H_ */
@@ -0,0 +1,335 @@
+/*
+ * stage_profiler.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ *
+ * Per-stage timing of the model pipeline. models/model.c starts the clock
+ * before the input window dequeue and marks the end of every stage (Hann
+ * window, FFT, mel/log, activity gate, feature bus, feature enqueue,
+ * network), each mark reads the clock once and charges the time since the
+ * previous mark to the stage. Count, min, max, total and a log-scale
+ * histogram (4 bins per octave, for the p99) are kept per stage, so a mark
+ * costs one clock read, a count-leading-zeros and a few adds.
+ *
+ * Timestamps come from the DWT cycle counter on the device and from
+ * CLOCK_MONOTONIC in the host build. Marks are made by the task that feeds
+ * the model only; readers in other tasks may see a snapshot that is one
+ * measurement behind.
+ */
+
+#include "stage_profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(COMPONENT_CM4)
+#include "cyhal.h"
+#else
+#include <time.h>
+#endif
+
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t histogram[STAGE_PROFILER_HISTOGRAM_BINS];
+} stage_state_t;
+
+static stage_state_t stages[STAGE_PROFILER_NUM_STAGES];
+static uint32_t last_ticks;
+
+static const char *const stage_names[STAGE_PROFILER_NUM_STAGES] = {
+    "window", "hann", "rfft", "mel_log", "frontend", "gate", "bus", "features", "model"
+};
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t now_ticks(void);
+static uint32_t histogram_bin(uint32_t ticks);
+static uint32_t histogram_upper_edge(uint32_t bin);
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_reset
+********************************************************************************
+* Summary:
+*    Clears the measurements of all stages and starts the time base.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stage_profiler_reset(void)
+{
+    memset(stages, 0, sizeof(stages));
+    for (int i = 0; i < STAGE_PROFILER_NUM_STAGES; i++)
+    {
+        stages[i].min = UINT32_MAX;
+    }
+#if defined(COMPONENT_CM4)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    last_ticks = now_ticks();
+}
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_name
+********************************************************************************
+* Summary:
+*    Returns the short name of a stage used in the dumps.
+*
+* Parameters:
+*    stage          Stage
+*
+* Return:
+*    Name, "?" for an invalid stage
+*
+*******************************************************************************/
+const char *stage_profiler_name(stage_profiler_stage_t stage)
+{
+    return ((unsigned)stage < STAGE_PROFILER_NUM_STAGES) ? stage_names[stage] : "?";
+}
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_unit
+********************************************************************************
+* Summary:
+*    Returns the unit of the ticks, "cycles" on the device and "ns" on the
+*    host.
+*
+*******************************************************************************/
+const char *stage_profiler_unit(void)
+{
+#if defined(COMPONENT_CM4)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_get_stats
+********************************************************************************
+* Summary:
+*    Returns the measurements of one stage since the last reset.
+*
+* Parameters:
+*    stage          Stage
+*    stats          Filled with the statistics, all 0 if the stage never ran
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stage_profiler_get_stats(stage_profiler_stage_t stage, stage_profiler_stats_t *stats)
+{
+    const stage_state_t *state = &stages[stage];
+    uint32_t threshold;
+    uint32_t seen = 0;
+    uint32_t bin;
+
+    memset(stats, 0, sizeof(*stats));
+    if (((unsigned)stage >= STAGE_PROFILER_NUM_STAGES) || (state->count == 0))
+    {
+        return;
+    }
+    stats->count = state->count;
+    stats->min = state->min;
+    stats->max = state->max;
+    stats->total = state->total;
+    stats->mean = (uint32_t)(state->total / state->count);
+
+    /* Smallest bin below which 99 % of the measurements are */
+    threshold = state->count - state->count / 100;
+    for (bin = 0; bin < STAGE_PROFILER_HISTOGRAM_BINS - 1; bin++)
+    {
+        seen += state->histogram[bin];
+        if (seen >= threshold)
+        {
+            break;
+        }
+    }
+    stats->p99 = (bin < STAGE_PROFILER_HISTOGRAM_BINS - 1) ? histogram_upper_edge(bin) : state->max;
+    if (stats->p99 > state->max)
+    {
+        stats->p99 = state->max;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_print
+********************************************************************************
+* Summary:
+*    Prints the statistics of every stage that ran, with its share of the
+*    profiled time.
+*
+* Parameters:
+*    void
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stage_profiler_print(void)
+{
+    stage_profiler_stats_t stats[STAGE_PROFILER_NUM_STAGES];
+    uint64_t total = 0;
+
+    for (int i = 0; i < STAGE_PROFILER_NUM_STAGES; i++)
+    {
+        stage_profiler_get_stats((stage_profiler_stage_t)i, &stats[i]);
+        total += stats[i].total;
+    }
+    printf("Stage profile (%s)\r\n", stage_profiler_unit());
+    printf("%-9s %8s %9s %9s %9s %9s %6s\r\n", "stage", "count", "min", "mean", "p99", "max", "share");
+    for (int i = 0; i < STAGE_PROFILER_NUM_STAGES; i++)
+    {
+        if (stats[i].count > 0)
+        {
+            printf("%-9s %8lu %9lu %9lu %9lu %9lu %5.1f%%\r\n", stage_names[i], (unsigned long)stats[i].count,
+                (unsigned long)stats[i].min, (unsigned long)stats[i].mean, (unsigned long)stats[i].p99,
+                (unsigned long)stats[i].max, (total > 0) ? 100.0 * (double)stats[i].total / (double)total : 0.0);
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_format
+********************************************************************************
+* Summary:
+*    Formats the statistics of every stage that ran as the compact JSON
+*    payload of the MQTT profile dump, [count, min, mean, p99, max] per stage,
+*    e.g. {"unit":"cycles","hann":[2500,1630,1642,1664,2210],...}
+*
+* Parameters:
+*    buffer         Payload, STAGE_PROFILER_PAYLOAD_MAX bytes are always enough
+*    size           Size of the buffer
+*
+* Return:
+*    Length of the payload, as snprintf()
+*
+*******************************************************************************/
+int stage_profiler_format(char *buffer, size_t size)
+{
+    int length = snprintf(buffer, size, "{\"unit\":\"%s\"", stage_profiler_unit());
+
+    for (int i = 0; i < STAGE_PROFILER_NUM_STAGES; i++)
+    {
+        stage_profiler_stats_t stats;
+
+        stage_profiler_get_stats((stage_profiler_stage_t)i, &stats);
+        if (stats.count > 0)
+        {
+            length += snprintf(buffer + ((size_t)length < size ? (size_t)length : size),
+                               ((size_t)length < size) ? size - length : 0, ",\"%s\":[%lu,%lu,%lu,%lu,%lu]",
+                               stage_names[i], (unsigned long)stats.count, (unsigned long)stats.min,
+                               (unsigned long)stats.mean, (unsigned long)stats.p99, (unsigned long)stats.max);
+        }
+    }
+    length += snprintf(buffer + ((size_t)length < size ? (size_t)length : size),
+                       ((size_t)length < size) ? size - length : 0, "}");
+    return length;
+}
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_start
+********************************************************************************
+* Summary:
+*    Starts timing the first stage of a pipeline pass.
+*
+*******************************************************************************/
+void stage_profiler_start(void)
+{
+    last_ticks = now_ticks();
+}
+
+
+/*******************************************************************************
+* Function Name: stage_profiler_mark
+********************************************************************************
+* Summary:
+*    Charges the time since the previous mark to a stage and starts the next
+*    one.
+*
+* Parameters:
+*    stage          Stage that just ended
+*
+*******************************************************************************/
+void stage_profiler_mark(stage_profiler_stage_t stage)
+{
+    const uint32_t now = now_ticks();
+    const uint32_t ticks = now - last_ticks;
+    stage_state_t *state = &stages[stage];
+
+    state->count++;
+    state->total += ticks;
+    state->histogram[histogram_bin(ticks)]++;
+    if (ticks < state->min)
+    {
+        state->min = ticks;
+    }
+    if (ticks > state->max)
+    {
+        state->max = ticks;
+    }
+    last_ticks = now;
+}
+
+
+static uint32_t now_ticks(void)
+{
+#if defined(COMPONENT_CM4)
+    return DWT->CYCCNT;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec);
+#endif
+}
+
+
+/* Exact below 4 ticks, then the octave and the next two bits */
+static uint32_t histogram_bin(uint32_t ticks)
+{
+    uint32_t octave;
+    uint32_t bin;
+
+    if (ticks < STAGE_PROFILER_BINS_PER_OCTAVE)
+    {
+        return ticks;
+    }
+    octave = 31u - (uint32_t)__builtin_clz(ticks);
+    bin = STAGE_PROFILER_BINS_PER_OCTAVE * (octave - 1u) + ((ticks >> (octave - 2u)) & 3u);
+    return (bin < STAGE_PROFILER_HISTOGRAM_BINS) ? bin : STAGE_PROFILER_HISTOGRAM_BINS - 1;
+}
+
+
+/* Largest tick count of a bin plus one */
+static uint32_t histogram_upper_edge(uint32_t bin)
+{
+    uint32_t octave;
+
+    if (bin < STAGE_PROFILER_BINS_PER_OCTAVE)
+    {
+        return bin + 1u;
+    }
+    octave = bin / STAGE_PROFILER_BINS_PER_OCTAVE + 1u;
+    return (STAGE_PROFILER_BINS_PER_OCTAVE + 1u + bin % STAGE_PROFILER_BINS_PER_OCTAVE) << (octave - 2u);
+}
@@ -0,0 +1,90 @@
+/*
+ * stage_profiler.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_STAGE_PROFILER_H_
+#define SOURCE_STAGE_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to time every stage of the model pipeline in models/model.c.
+ * With 0 the marks compile to nothing. */
+#ifndef STAGE_PROFILER_ENABLE
+#define STAGE_PROFILER_ENABLE               (0)
+#endif
+
+/* Histogram of every stage: 4 bins per octave, exact below 4 ticks, up to
+ * 2^25 ticks (224 ms at 150 MHz). The last bin also holds everything above. */
+#define STAGE_PROFILER_BINS_PER_OCTAVE      (4)
+#define STAGE_PROFILER_HISTOGRAM_BINS       (96)
+
+/* Model outputs between two dumps of ml_task.c, 120 ms each */
+#define STAGE_PROFILER_DUMP_OUTPUTS         (500u)
+
+/* Largest payload of stage_profiler_format() */
+#define STAGE_PROFILER_PAYLOAD_MAX          (512)
+
+#if STAGE_PROFILER_ENABLE
+/* Starts timing the first stage */
+#define STAGE_PROFILER_START()              stage_profiler_start()
+/* Ends a stage and starts the next one */
+#define STAGE_PROFILER_MARK(stage)          stage_profiler_mark(stage)
+#else
+#define STAGE_PROFILER_START()              do { } while (0)
+#define STAGE_PROFILER_MARK(stage)          do { } while (0)
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Stages of IMAI_dequeue() and IMAI_enqueue_block() in the order they run.
+ * Magnitude, mel filterbank, clip and log are timed together (mel_log_f32()). */
+typedef enum {
+    STAGE_PROFILER_WINDOW = 0,      /* Input window dequeue (fixwin_dequeue_inplace) */
+    STAGE_PROFILER_HANN,            /* Hann window multiply */
+    STAGE_PROFILER_RFFT,            /* 512-point real FFT */
+    STAGE_PROFILER_MEL_LOG,         /* Magnitude, mel, clip and log */
+    STAGE_PROFILER_FRONTEND,        /* Whole frame of the q15, stereo and constexpr front-ends */
+    STAGE_PROFILER_GATE,            /* Activity gate update */
+    STAGE_PROFILER_BUS,             /* Feature bus consumers */
+    STAGE_PROFILER_FEATURES,        /* Feature frame enqueue (fixwin_enqueue_mirrored) */
+    STAGE_PROFILER_MODEL,           /* Network on one 50-frame window, run windows only */
+    STAGE_PROFILER_NUM_STAGES
+} stage_profiler_stage_t;
+
+/* Ticks are CPU cycles on the device (DWT) and nanoseconds on the host */
+typedef struct {
+    uint32_t count;                 /* Measurements */
+    uint32_t min;
+    uint32_t mean;
+    uint32_t max;
+    uint32_t p99;                   /* Upper edge of the 99th percentile bin */
+    uint64_t total;
+} stage_profiler_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void stage_profiler_reset(void);
+const char *stage_profiler_name(stage_profiler_stage_t stage);
+const char *stage_profiler_unit(void);
+void stage_profiler_get_stats(stage_profiler_stage_t stage, stage_profiler_stats_t *stats);
+
+/* UART dump and compact JSON for MQTT */
+void stage_profiler_print(void);
+int stage_profiler_format(char *buffer, size_t size);
+
+/* Called through STAGE_PROFILER_START() and STAGE_PROFILER_MARK() */
+void stage_profiler_start(void);
+void stage_profiler_mark(stage_profiler_stage_t stage);
+
+
+#endif /* SOURCE_STAGE_PROFILER_H_ */
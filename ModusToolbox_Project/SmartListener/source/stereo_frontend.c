@@ -0,0 +1,297 @@
+/*
+ * stereo_frontend.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Log-mel front-end for stereo capture, built with STEREO_FRONTEND_ENABLE.
+ * Each channel goes through its own 512-point arm_rfft_fast_f32(). Packing
+ * both into one complex FFT was slower on the host (19966 against 16925
+ * cycles per frame in stereo-eval) because of the split of the result. The
+ * mel filterbank, clip and log are the ones of the generated model front-end
+ * (the tables are passed by IMAI_init()), so either channel alone reproduces
+ * the mono features. The two mel spectra are then combined by
+ * keeping the channel with the higher SNR or by averaging them.
+ */
+
+#include "stereo_frontend.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+#if STEREO_FRONTEND_ENABLE
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Noise floor tracking of the per channel frame energy, as in the activity
+ * gate: follow drops quickly and rises slowly */
+#define FLOOR_FALL_RATE                 (0.2f)
+#define FLOOR_RISE_RATE                 (0.003f)
+
+/* Smoothing of the per channel SNR */
+#define SNR_SMOOTHING                   (0.1f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static arm_rfft_fast_instance_f32 rfft_instance;
+
+static const float *hann_window;
+static const int16_t *filter_points;
+static const float *filter_coefs;
+
+/* FFT input, destroyed by arm_rfft_fast_f32(), and output */
+static float frame[STEREO_FRONTEND_FFT_LEN] __attribute__((aligned(8)));
+static float spectrum[STEREO_FRONTEND_FFT_LEN] __attribute__((aligned(8)));
+static float magnitude[2][STEREO_FRONTEND_BINS];
+static float mel[2][STEREO_FRONTEND_MEL_BANDS];
+
+static stereo_mix_t mix_mode = STEREO_MIX_BEST_SNR;
+static int selected_channel;
+static float energy_floor[2];
+static float snr[2];
+static int floor_ready;
+
+static stereo_frontend_stats_t frontend_stats;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void channel_spectrum(const float *input, const float *window, float *output);
+static void mel_filterbank(const float *input, float *output);
+static void update_selection(void);
+
+
+/*******************************************************************************
+* Function Name: stereo_frontend_init
+********************************************************************************
+* Summary:
+*    Initializes the FFT and keeps the window and mel tables of the model
+*    front-end.
+*
+* Parameters:
+*    window         Analysis window, STEREO_FRONTEND_FFT_LEN values
+*    mel_points     Filter edge bins, STEREO_FRONTEND_MEL_BANDS + 2 values
+*    mel_coefs      Concatenated filter weights
+*
+* Return:
+*    0 on success, -2 if the FFT could not be initialized
+*
+*******************************************************************************/
+int stereo_frontend_init(const float *window, const int16_t *mel_points, const float *mel_coefs)
+{
+    if (arm_rfft_fast_init_f32(&rfft_instance, STEREO_FRONTEND_FFT_LEN) != ARM_MATH_SUCCESS)
+    {
+        return -2;
+    }
+    hann_window = window;
+    filter_points = mel_points;
+    filter_coefs = mel_coefs;
+
+    selected_channel = 0;
+    floor_ready = 0;
+    snr[0] = 0.0f;
+    snr[1] = 0.0f;
+    memset(&frontend_stats, 0, sizeof(frontend_stats));
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: stereo_frontend_set_mix
+********************************************************************************
+* Summary:
+*    Selects how the two channels are combined.
+*
+* Parameters:
+*    mix            One of stereo_mix_t
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stereo_frontend_set_mix(stereo_mix_t mix)
+{
+    mix_mode = mix;
+}
+
+
+/*******************************************************************************
+* Function Name: stereo_frontend_get_stats
+********************************************************************************
+* Summary:
+*    Returns the channel selection counters.
+*
+* Parameters:
+*    stats          Destination of the counters
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stereo_frontend_get_stats(stereo_frontend_stats_t *stats)
+{
+    *stats = frontend_stats;
+}
+
+
+/*******************************************************************************
+* Function Name: stereo_frontend_spectra
+********************************************************************************
+* Summary:
+*    Magnitude spectra of two real frames, arm_rfft_fast_f32() followed by
+*    arm_cmplx_mag_f32() on each channel.
+*
+* Parameters:
+*    left, right        STEREO_FRONTEND_FFT_LEN samples each
+*    window             Applied to both channels, may be NULL
+*    magnitude_left     STEREO_FRONTEND_BINS values
+*    magnitude_right    STEREO_FRONTEND_BINS values
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stereo_frontend_spectra(const float *left, const float *right, const float *window,
+                             float *magnitude_left, float *magnitude_right)
+{
+    channel_spectrum(left, window, magnitude_left);
+    channel_spectrum(right, window, magnitude_right);
+}
+
+
+/*******************************************************************************
+* Function Name: stereo_frontend_frame
+********************************************************************************
+* Summary:
+*    Computes one log-mel frame from a stereo frame, combining the channels
+*    as selected with stereo_frontend_set_mix().
+*
+* Parameters:
+*    left, right    STEREO_FRONTEND_FFT_LEN samples each
+*    log_mel        STEREO_FRONTEND_MEL_BANDS values
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stereo_frontend_frame(const float *left, const float *right, float *log_mel)
+{
+    const float *source;
+
+    stereo_frontend_spectra(left, right, hann_window, magnitude[0], magnitude[1]);
+    mel_filterbank(magnitude[0], mel[0]);
+    mel_filterbank(magnitude[1], mel[1]);
+    update_selection();
+
+    switch (mix_mode)
+    {
+        case STEREO_MIX_AVERAGE:
+            arm_add_f32(mel[0], mel[1], mel[0], STEREO_FRONTEND_MEL_BANDS);
+            arm_scale_f32(mel[0], 0.5f, mel[0], STEREO_FRONTEND_MEL_BANDS);
+            source = mel[0];
+            break;
+        case STEREO_MIX_LEFT:
+            source = mel[0];
+            break;
+        case STEREO_MIX_RIGHT:
+            source = mel[1];
+            break;
+        default:
+            source = mel[selected_channel];
+            break;
+    }
+
+    arm_clip_f32(source, log_mel, STEREO_FRONTEND_MEL_FLOOR, 3.40282347E+38f, STEREO_FRONTEND_MEL_BANDS);
+    arm_vlog_f32(log_mel, log_mel, STEREO_FRONTEND_MEL_BANDS);
+}
+
+
+/* Windowed real FFT of one channel and its magnitude */
+static void channel_spectrum(const float *input, const float *window, float *output)
+{
+    const int n = STEREO_FRONTEND_FFT_LEN;
+
+    if (window != NULL)
+    {
+        arm_mult_f32(input, window, frame, n);
+    }
+    else
+    {
+        memcpy(frame, input, sizeof(frame));
+    }
+    arm_rfft_fast_f32(&rfft_instance, frame, spectrum, 0);
+
+    /* DC and Nyquist are packed into the first complex value */
+    output[0] = fabsf(spectrum[0]);
+    output[n / 2] = fabsf(spectrum[1]);
+    arm_cmplx_mag_f32(&spectrum[2], &output[1], n / 2 - 1);
+}
+
+
+/* Same filterbank as mel_cmsis_f32() in the generated model code */
+static void mel_filterbank(const float *input, float *output)
+{
+    const float *coefs = filter_coefs;
+
+    for (int i = 0; i < STEREO_FRONTEND_MEL_BANDS; i++)
+    {
+        int n0 = filter_points[i];
+        int len = filter_points[i + 2] - n0 + 1;
+
+        arm_dot_prod_f32(input + n0, coefs, len, &output[i]);
+        coefs += len;
+    }
+}
+
+
+/* Tracks the SNR of both channels and picks the better one with hysteresis */
+static void update_selection(void)
+{
+    for (int c = 0; c < 2; c++)
+    {
+        float sum = 0.0f;
+        float energy;
+
+        for (int i = 0; i < STEREO_FRONTEND_MEL_BANDS; i++)
+        {
+            sum += mel[c][i];
+        }
+        energy = logf(sum + STEREO_FRONTEND_MEL_FLOOR);
+
+        if (!floor_ready)
+        {
+            energy_floor[c] = energy;
+        }
+        else if (energy < energy_floor[c])
+        {
+            energy_floor[c] += FLOOR_FALL_RATE * (energy - energy_floor[c]);
+        }
+        else
+        {
+            energy_floor[c] += FLOOR_RISE_RATE * (energy - energy_floor[c]);
+        }
+        snr[c] += SNR_SMOOTHING * ((energy - energy_floor[c]) - snr[c]);
+    }
+    floor_ready = 1;
+
+    if (snr[1 - selected_channel] > snr[selected_channel] + STEREO_FRONTEND_SWITCH_MARGIN)
+    {
+        selected_channel = 1 - selected_channel;
+        if (mix_mode == STEREO_MIX_BEST_SNR)
+        {
+            frontend_stats.switches++;
+        }
+    }
+
+    frontend_stats.frames++;
+    if (((mix_mode == STEREO_MIX_BEST_SNR) && (selected_channel == 1)) || (mix_mode == STEREO_MIX_RIGHT))
+    {
+        frontend_stats.right_frames++;
+    }
+}
+
+#endif /* STEREO_FRONTEND_ENABLE */
@@ -0,0 +1,66 @@
+/*
+ * stereo_frontend.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_STEREO_FRONTEND_H_
+#define SOURCE_STEREO_FRONTEND_H_
+
+#include <stdint.h>
+
+#include "audio_capture.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* The stereo front-end and its buffers are only built for stereo capture.
+ * Set to 1 to build it with mono capture, e.g. for the host stereo-eval.
+ * Not available with FRONTEND_Q15_ENABLE. */
+#ifndef STEREO_FRONTEND_ENABLE
+#define STEREO_FRONTEND_ENABLE              (AUDIO_CAPTURE_CHANNELS == 2)
+#endif
+
+/* Frame geometry of the model front-end */
+#define STEREO_FRONTEND_FFT_LEN             (512)
+#define STEREO_FRONTEND_BINS                (STEREO_FRONTEND_FFT_LEN / 2 + 1)
+#define STEREO_FRONTEND_MEL_BANDS           (30)
+
+/* Clip and log of the model front-end */
+#define STEREO_FRONTEND_MEL_FLOOR           (0.00031f)
+
+/* Smoothed SNR (natural log units) the other channel must gain before the
+ * selection switches to it */
+#define STEREO_FRONTEND_SWITCH_MARGIN       (0.5f)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef enum {
+    STEREO_MIX_BEST_SNR = 0,        /* Mel of the channel with the higher SNR */
+    STEREO_MIX_AVERAGE,             /* Mean of the two mel spectra */
+    STEREO_MIX_LEFT,
+    STEREO_MIX_RIGHT
+} stereo_mix_t;
+
+typedef struct {
+    uint32_t frames;                /* Frames processed */
+    uint32_t right_frames;          /* Frames taken from the right channel */
+    uint32_t switches;              /* Channel changes of STEREO_MIX_BEST_SNR */
+} stereo_frontend_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int stereo_frontend_init(const float *window, const int16_t *mel_points, const float *mel_coefs);
+void stereo_frontend_set_mix(stereo_mix_t mix);
+void stereo_frontend_get_stats(stereo_frontend_stats_t *stats);
+
+void stereo_frontend_spectra(const float *left, const float *right, const float *window,
+                             float *magnitude_left, float *magnitude_right);
+void stereo_frontend_frame(const float *left, const float *right, float *log_mel);
+
+
+#endif /* SOURCE_STEREO_FRONTEND_H_ */
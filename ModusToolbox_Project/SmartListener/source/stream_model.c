@@ -0,0 +1,678 @@
+/*
+ * stream_model.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Streaming execution of the conv1dlstm network. The model sees 50 feature
+ * frames with a stride of 6, so 44 of them were already in the previous
+ * window. The convolutions are shift-equivariant along time, so most of
+ * their output columns are the ones of the previous window, moved by a few
+ * columns. Each CONV_2D layer keeps its output of the last window in a ring
+ * of columns. Only the new columns at the end of the window are computed,
+ * plus the columns at both edges: those depend on the zero padding and
+ * differ from one window to the next. The pooling, the LSTM (stateless, it
+ * restarts from zero in every window), MEAN, FULLY_CONNECTED and SOFTMAX run
+ * on the whole window, they are cheap.
+ *
+ * The layers are read from the model flatbuffer with tflite_model.c, the
+ * weights stay in flash. The columns are computed with the same kernels
+ * whether they are cached or not, so the scores are bit-identical to those
+ * of a window computed from scratch (first window, or after a gap in the
+ * window indices, e.g. when the activity gate skipped a window).
+ *
+ * Strides make the column grids line up only every few windows: with a
+ * stride of 6 frames, the columns after the first (stride 2) convolution
+ * move by 3 per window, but the ones after the first pooling by 1.5. Such a
+ * layer keeps one ring per phase and reuses the columns of the window two
+ * windows back.
+ */
+
+#include "stream_model.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "tflite_model.h"
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define LSTM_GATES                      (4)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Columns of a layer in the current window, channels contiguous */
+typedef struct {
+    const float *base;
+    int cols;                       /* Columns in the window and in the ring */
+    int origin;                     /* Ring slot of column 0 */
+    int channels;
+} column_view_t;
+
+typedef struct {
+    int pool;                       /* 0 CONV_2D, else MAX_POOL_2D of this size and stride */
+    const float *weights;           /* [out][taps][in] */
+    const float *bias;
+    int in;                         /* Channels */
+    int out;
+    int taps;
+    int stride;
+    int pad;                        /* Zero columns before column 0 of the input */
+    int relu;
+    int cols;                       /* Output columns per window */
+    int clean_first;                /* Columns that do not depend on the padding */
+    int clean_last;
+    int period;                     /* Windows until the column grid lines up again */
+    int shift;                      /* Columns it moves by in that time */
+    float *rings[STREAM_MODEL_MAX_PERIOD];
+    int origin[STREAM_MODEL_MAX_PERIOD];
+    uint32_t ring_index[STREAM_MODEL_MAX_PERIOD];
+    uint8_t ring_valid[STREAM_MODEL_MAX_PERIOD];
+} stream_layer_t;
+
+typedef struct {
+    const float *input_weights[LSTM_GATES];     /* Input, forget, cell, output gate */
+    const float *recurrent_weights[LSTM_GATES];
+    const float *bias[LSTM_GATES];
+    int units;
+    int inputs;
+    int steps;
+    float cell_clip;
+} stream_lstm_t;
+
+static stream_layer_t layers[STREAM_MODEL_MAX_LAYERS];
+static int layer_count;
+static stream_lstm_t lstm;
+static const float *dense_weights;
+static const float *dense_bias;
+static int dense_outputs;
+static int window_frames;
+static int window_bands;
+
+static float memory[STREAM_MODEL_MEMORY_SIZE / sizeof(float)];
+static int memory_used;
+static float *pooled[STREAM_MODEL_MAX_LAYERS];
+
+static stream_model_stats_t model_stats;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int add_conv(const tflite_model_t *model, const tflite_operator_t *op, int *cols, int *channels);
+static int add_pool(const tflite_model_t *model, const tflite_operator_t *op, int *cols, int *channels);
+static int add_lstm(const tflite_model_t *model, const tflite_operator_t *op, int cols, int channels);
+static int add_dense(const tflite_model_t *model, const tflite_operator_t *op);
+static const float *float_tensor(const tflite_model_t *model, int index, int32_t elements);
+static float *alloc_floats(int count);
+static int greatest_common_divisor(int a, int b);
+static void conv_column(const stream_layer_t *layer, const column_view_t *input, int col, float *output);
+static void run_lstm(const float *input, float *mean);
+
+
+/*******************************************************************************
+* Function Name: stream_model_init
+********************************************************************************
+* Summary:
+*    Reads the layers of the model flatbuffer and lays out their caches. The
+*    network must be CONV_2D layers along time (kernel height 1) and 2-wide
+*    max pooling, then one LSTM, MEAN over time, FULLY_CONNECTED and SOFTMAX,
+*    all float. RESHAPE operators only move unit dimensions and are skipped.
+*
+* Parameters:
+*    model_bin      Model flatbuffer
+*    model_size     Bytes of the flatbuffer
+*    window_stride  Frames between the starts of consecutive windows
+*
+* Return:
+*    0 on success, -1 if the model is not supported
+*
+*******************************************************************************/
+int stream_model_init(const void *model_bin, uint32_t model_size, int window_stride)
+{
+    tflite_model_t model;
+    tflite_tensor_t input;
+    int cols;
+    int channels;
+    int distance = 1;
+    int clean_first;
+    int clean_last;
+    int stage = 0;                  /* 0 convolutions, 1 LSTM, 2 MEAN, 3 FULLY_CONNECTED, 4 SOFTMAX */
+
+    layer_count = 0;
+    memory_used = 0;
+    dense_outputs = 0;
+    if ((tflite_model_open(&model, model_bin, model_size) != 0) ||
+        (tflite_model_get_tensor(&model, model.input, &input) != 0) ||
+        (input.type != TFLITE_TYPE_FLOAT32) || (input.dims != 3) || (window_stride < 1))
+    {
+        return -1;
+    }
+    window_frames = input.shape[1];
+    window_bands = input.shape[2];
+    cols = window_frames;
+    channels = window_bands;
+    clean_first = 0;
+    clean_last = cols - 1;
+
+    for (int i = 0; i < model.operator_count; i++)
+    {
+        tflite_operator_t op;
+        int result = -1;
+
+        if (tflite_model_get_operator(&model, i, &op) != 0)
+        {
+            return -1;
+        }
+        switch (op.code)
+        {
+            case TFLITE_OP_RESHAPE:
+                result = 0;
+                break;
+            case TFLITE_OP_CONV_2D:
+            case TFLITE_OP_MAX_POOL_2D:
+                if ((stage == 0) && (layer_count < STREAM_MODEL_MAX_LAYERS))
+                {
+                    stream_layer_t *layer = &layers[layer_count];
+
+                    result = (op.code == TFLITE_OP_CONV_2D) ? add_conv(&model, &op, &cols, &channels)
+                                                            : add_pool(&model, &op, &cols, &channels);
+                    if (result != 0)
+                    {
+                        break;
+                    }
+
+                    /* Columns whose inputs are all clean and inside the window */
+                    if (layer->pool)
+                    {
+                        clean_first = (clean_first + layer->pool - 1) / layer->pool;
+                        clean_last = (clean_last - (layer->pool - 1)) / layer->pool;
+                    }
+                    else
+                    {
+                        clean_first = (clean_first + layer->pad + layer->stride - 1) / layer->stride;
+                        clean_last = (clean_last + layer->pad - (layer->taps - 1)) / layer->stride;
+                    }
+                    layer->clean_first = clean_first;
+                    layer->clean_last = (clean_last < cols) ? clean_last : cols - 1;
+
+                    /* Columns are distance frames apart, the grid repeats after
+                     * period windows, shifted by shift columns */
+                    distance *= layer->pool ? layer->pool : layer->stride;
+                    layer->period = distance / greatest_common_divisor(distance, window_stride);
+                    layer->shift = layer->period * window_stride / distance;
+                    if (!layer->pool)
+                    {
+                        if (layer->period > STREAM_MODEL_MAX_PERIOD)
+                        {
+                            return -1;
+                        }
+                        for (int p = 0; p < layer->period; p++)
+                        {
+                            layer->rings[p] = alloc_floats(cols * layer->out);
+                            if (layer->rings[p] == NULL)
+                            {
+                                return -1;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        pooled[layer_count] = alloc_floats(cols * channels);
+                        if (pooled[layer_count] == NULL)
+                        {
+                            return -1;
+                        }
+                    }
+                    layer_count++;
+                }
+                break;
+            case TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM:
+                result = (stage == 0) ? add_lstm(&model, &op, cols, channels) : -1;
+                stage = 1;
+                break;
+            case TFLITE_OP_MEAN:
+                result = (stage == 1) ? 0 : -1;
+                stage = 2;
+                break;
+            case TFLITE_OP_FULLY_CONNECTED:
+                result = (stage == 2) ? add_dense(&model, &op) : -1;
+                stage = 3;
+                break;
+            case TFLITE_OP_SOFTMAX:
+                result = (stage == 3) ? 0 : -1;
+                stage = 4;
+                break;
+            default:
+                break;
+        }
+        if (result != 0)
+        {
+            return -1;
+        }
+    }
+    if ((stage != 4) || (layer_count == 0) || (layers[layer_count - 1].pool == 0))
+    {
+        return -1;
+    }
+
+    stream_model_reset();
+    memset(&model_stats, 0, sizeof(model_stats));
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: stream_model_reset
+********************************************************************************
+* Summary:
+*    Drops the cached columns, the next window is computed from scratch.
+*
+*******************************************************************************/
+void stream_model_reset(void)
+{
+    for (int i = 0; i < layer_count; i++)
+    {
+        memset(layers[i].ring_valid, 0, sizeof(layers[i].ring_valid));
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: stream_model_run
+********************************************************************************
+* Summary:
+*    Computes the scores of one window. Columns are reused from earlier
+*    windows when their index says they overlap with this one.
+*
+* Parameters:
+*    window         window_frames x window_bands features
+*    index          Window number, one more for every window_stride frames.
+*                   Windows can be skipped, their successors are then
+*                   computed from scratch.
+*    scores         Output scores
+*
+* Return:
+*    void
+*
+*******************************************************************************/
+void stream_model_run(const float *window, uint32_t index, float *scores)
+{
+    column_view_t input = { window, window_frames, 0, window_bands };
+    float mean[STREAM_MODEL_MAX_UNITS];
+    float max_score = -INFINITY;
+    float sum = 0.0f;
+    int reused_any = 0;
+
+    for (int i = 0; i < layer_count; i++)
+    {
+        stream_layer_t *layer = &layers[i];
+
+        if (layer->pool)
+        {
+            float *output = pooled[i];
+
+            /* Input columns are consumed in pairs (VALID), the rest is dropped */
+            for (int col = 0; col < layer->cols; col++)
+            {
+                const float *a = input.base + ((input.origin + col * layer->pool) % input.cols) * input.channels;
+
+                memcpy(&output[col * input.channels], a, input.channels * sizeof(float));
+                for (int k = 1; k < layer->pool; k++)
+                {
+                    const float *b = input.base + ((input.origin + col * layer->pool + k) % input.cols) * input.channels;
+
+                    for (int c = 0; c < input.channels; c++)
+                    {
+                        output[col * input.channels + c] = fmaxf(output[col * input.channels + c], b[c]);
+                    }
+                }
+            }
+            input.base = output;
+            input.cols = layer->cols;
+            input.origin = 0;
+        }
+        else
+        {
+            int phase = (int)(index % (uint32_t)layer->period);
+            int continued = layer->ring_valid[phase] && (index == layer->ring_index[phase] + (uint32_t)layer->period);
+            float *ring = layer->rings[phase];
+            uint64_t column_macs = (uint64_t)layer->out * layer->taps * layer->in;
+
+            layer->origin[phase] = continued ? (layer->origin[phase] + layer->shift) % layer->cols : 0;
+            for (int col = 0; col < layer->cols; col++)
+            {
+                /* The column was computed for the earlier window and did not
+                 * depend on the padding there or here */
+                if (continued && (col >= layer->clean_first) && (col + layer->shift <= layer->clean_last))
+                {
+                    reused_any = 1;
+                    continue;
+                }
+                conv_column(layer, &input, col, &ring[((layer->origin[phase] + col) % layer->cols) * layer->out]);
+                model_stats.conv_macs += column_macs;
+            }
+            model_stats.conv_batch_macs += column_macs * layer->cols;
+            layer->ring_index[phase] = index;
+            layer->ring_valid[phase] = 1;
+
+            input.base = ring;
+            input.cols = layer->cols;
+            input.origin = layer->origin[phase];
+        }
+        input.channels = layer->pool ? input.channels : layer->out;
+    }
+
+    run_lstm(input.base, mean);
+
+    for (int o = 0; o < dense_outputs; o++)
+    {
+        float dot;
+
+        arm_dot_prod_f32(mean, &dense_weights[o * lstm.units], lstm.units, &dot);
+        scores[o] = dense_bias[o] + dot;
+        max_score = fmaxf(max_score, scores[o]);
+    }
+    for (int o = 0; o < dense_outputs; o++)
+    {
+        scores[o] = expf(scores[o] - max_score);
+        sum += scores[o];
+    }
+    for (int o = 0; o < dense_outputs; o++)
+    {
+        scores[o] /= sum;
+    }
+
+    model_stats.runs++;
+    model_stats.full_runs += reused_any ? 0 : 1;
+}
+
+
+/*******************************************************************************
+* Function Name: stream_model_get_stats
+********************************************************************************
+* Summary:
+*    Returns the windows and convolution work since stream_model_init().
+*
+*******************************************************************************/
+void stream_model_get_stats(stream_model_stats_t *stats)
+{
+    *stats = model_stats;
+}
+
+
+/* CONV_2D along the width axis: kernel [out][1][taps][in], SAME or VALID */
+static int add_conv(const tflite_model_t *model, const tflite_operator_t *op, int *cols, int *channels)
+{
+    stream_layer_t *layer = &layers[layer_count];
+    tflite_tensor_t kernel;
+    int padding;
+    int activation;
+
+    memset(layer, 0, sizeof(*layer));
+    if ((op->input_count < 2) || (tflite_model_get_tensor(model, op->inputs[1], &kernel) != 0) ||
+        (kernel.dims != 4) || (kernel.shape[1] != 1) || (kernel.shape[3] != *channels) ||
+        (kernel.shape[2] > STREAM_MODEL_MAX_TAPS))
+    {
+        return -1;
+    }
+    layer->out = kernel.shape[0];
+    layer->taps = kernel.shape[2];
+    layer->in = *channels;
+    layer->weights = float_tensor(model, op->inputs[1], tflite_tensor_elements(&kernel));
+    layer->bias = ((op->input_count > 2) && (op->inputs[2] >= 0)) ? float_tensor(model, op->inputs[2], layer->out) : NULL;
+    layer->stride = tflite_option_int(model, op, TFLITE_CONV_STRIDE_W, 1);
+    padding = tflite_option_byte(model, op, TFLITE_CONV_PADDING, TFLITE_PADDING_SAME);
+    activation = tflite_option_byte(model, op, TFLITE_CONV_ACTIVATION, TFLITE_ACTIVATION_NONE);
+    if ((layer->weights == NULL) || ((op->input_count > 2) && (op->inputs[2] >= 0) && (layer->bias == NULL)) ||
+        (layer->stride < 1) || (tflite_option_int(model, op, TFLITE_CONV_STRIDE_H, 1) != 1) ||
+        (tflite_option_int(model, op, TFLITE_CONV_DILATION_W, 1) != 1) ||
+        ((activation != TFLITE_ACTIVATION_NONE) && (activation != TFLITE_ACTIVATION_RELU)))
+    {
+        return -1;
+    }
+    layer->relu = (activation == TFLITE_ACTIVATION_RELU);
+
+    /* Output size and padding as TFLite computes them */
+    if (padding == TFLITE_PADDING_SAME)
+    {
+        int total;
+
+        layer->cols = (*cols + layer->stride - 1) / layer->stride;
+        total = (layer->cols - 1) * layer->stride + layer->taps - *cols;
+        layer->pad = (total > 0) ? total / 2 : 0;
+    }
+    else
+    {
+        layer->cols = (*cols - layer->taps) / layer->stride + 1;
+        layer->pad = 0;
+    }
+    if (layer->cols < 1)
+    {
+        return -1;
+    }
+
+    *cols = layer->cols;
+    *channels = layer->out;
+    return 0;
+}
+
+
+/* MAX_POOL_2D with filter size == stride along the time axis, VALID */
+static int add_pool(const tflite_model_t *model, const tflite_operator_t *op, int *cols, int *channels)
+{
+    stream_layer_t *layer = &layers[layer_count];
+    int size = tflite_option_int(model, op, TFLITE_POOL_FILTER_W, 1) * tflite_option_int(model, op, TFLITE_POOL_FILTER_H, 1);
+    int stride = tflite_option_int(model, op, TFLITE_POOL_STRIDE_W, 1) * tflite_option_int(model, op, TFLITE_POOL_STRIDE_H, 1);
+
+    memset(layer, 0, sizeof(*layer));
+    if ((size < 2) || (size != stride) ||
+        (tflite_option_byte(model, op, TFLITE_POOL_PADDING, TFLITE_PADDING_SAME) != TFLITE_PADDING_VALID) ||
+        (tflite_option_byte(model, op, TFLITE_POOL_ACTIVATION, TFLITE_ACTIVATION_NONE) != TFLITE_ACTIVATION_NONE))
+    {
+        return -1;
+    }
+    layer->pool = size;
+    layer->in = *channels;
+    layer->out = *channels;
+    layer->cols = *cols / size;
+    if (layer->cols < 1)
+    {
+        return -1;
+    }
+    *cols = layer->cols;
+    return 0;
+}
+
+
+/* UNIDIRECTIONAL_SEQUENCE_LSTM without peepholes, projection or layer norm,
+ * batch major, tanh cell activation */
+static int add_lstm(const tflite_model_t *model, const tflite_operator_t *op, int cols, int channels)
+{
+    tflite_tensor_t weights;
+
+    if ((op->input_count < 16) || (tflite_model_get_tensor(model, op->inputs[1], &weights) != 0) ||
+        (weights.dims != 2) || (weights.shape[1] != channels) || (weights.shape[0] > STREAM_MODEL_MAX_UNITS) ||
+        (tflite_option_byte(model, op, TFLITE_LSTM_ACTIVATION, TFLITE_ACTIVATION_TANH) != TFLITE_ACTIVATION_TANH) ||
+        (tflite_option_byte(model, op, TFLITE_LSTM_TIME_MAJOR, 0) != 0))
+    {
+        return -1;
+    }
+    for (int i = 9; i < 12; i++)
+    {
+        if (op->inputs[i] >= 0)
+        {
+            return -1;
+        }
+    }
+    for (int i = 16; i < op->input_count; i++)
+    {
+        /* Inputs 18 and 19 are the zero initial states */
+        if ((i != 18) && (i != 19) && (op->inputs[i] >= 0))
+        {
+            return -1;
+        }
+    }
+
+    lstm.units = weights.shape[0];
+    lstm.inputs = channels;
+    lstm.steps = cols;
+    lstm.cell_clip = tflite_option_float(model, op, TFLITE_LSTM_CELL_CLIP, 0.0f);
+    for (int g = 0; g < LSTM_GATES; g++)
+    {
+        lstm.input_weights[g] = float_tensor(model, op->inputs[1 + g], lstm.units * lstm.inputs);
+        lstm.recurrent_weights[g] = float_tensor(model, op->inputs[5 + g], lstm.units * lstm.units);
+        lstm.bias[g] = float_tensor(model, op->inputs[12 + g], lstm.units);
+        if ((lstm.input_weights[g] == NULL) || (lstm.recurrent_weights[g] == NULL) || (lstm.bias[g] == NULL))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+static int add_dense(const tflite_model_t *model, const tflite_operator_t *op)
+{
+    tflite_tensor_t weights;
+
+    if ((op->input_count < 3) || (tflite_model_get_tensor(model, op->inputs[1], &weights) != 0) ||
+        (weights.dims != 2) || (weights.shape[1] != lstm.units) || (weights.shape[0] > STREAM_MODEL_MAX_OUTPUTS) ||
+        (tflite_option_byte(model, op, TFLITE_FC_ACTIVATION, TFLITE_ACTIVATION_NONE) != TFLITE_ACTIVATION_NONE))
+    {
+        return -1;
+    }
+    dense_outputs = weights.shape[0];
+    dense_weights = float_tensor(model, op->inputs[1], dense_outputs * lstm.units);
+    dense_bias = float_tensor(model, op->inputs[2], dense_outputs);
+    return ((dense_weights != NULL) && (dense_bias != NULL)) ? 0 : -1;
+}
+
+
+/* Constant float tensor with the given number of elements, NULL otherwise */
+static const float *float_tensor(const tflite_model_t *model, int index, int32_t elements)
+{
+    tflite_tensor_t tensor;
+
+    if ((index < 0) || (tflite_model_get_tensor(model, index, &tensor) != 0) ||
+        (tensor.type != TFLITE_TYPE_FLOAT32) || (tensor.data == NULL) ||
+        (tensor.bytes != elements * sizeof(float)) || (((uintptr_t)tensor.data % sizeof(float)) != 0))
+    {
+        return NULL;
+    }
+    return (const float *)tensor.data;
+}
+
+
+static float *alloc_floats(int count)
+{
+    float *block = &memory[memory_used];
+
+    if ((memory_used + count) * sizeof(float) > sizeof(memory))
+    {
+        return NULL;
+    }
+    memory_used += count;
+    return block;
+}
+
+
+static int greatest_common_divisor(int a, int b)
+{
+    while (b != 0)
+    {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+
+/* One output column. The taps are summed one by one, so a column comes out
+ * the same wherever its inputs are in the rings. */
+static void conv_column(const stream_layer_t *layer, const column_view_t *input, int col, float *output)
+{
+    const float *taps[STREAM_MODEL_MAX_TAPS];
+    int first = col * layer->stride - layer->pad;
+
+    for (int k = 0; k < layer->taps; k++)
+    {
+        int t = first + k;
+
+        taps[k] = ((t >= 0) && (t < input->cols)) ? input->base + ((input->origin + t) % input->cols) * input->channels : NULL;
+    }
+
+    for (int o = 0; o < layer->out; o++)
+    {
+        const float *weights = &layer->weights[o * layer->taps * layer->in];
+        float sum = (layer->bias != NULL) ? layer->bias[o] : 0.0f;
+
+        for (int k = 0; k < layer->taps; k++)
+        {
+            float dot;
+
+            if (taps[k] != NULL)
+            {
+                arm_dot_prod_f32(taps[k], &weights[k * layer->in], layer->in, &dot);
+                sum += dot;
+            }
+        }
+        output[o] = (layer->relu && (sum < 0.0f)) ? 0.0f : sum;
+    }
+}
+
+
+/* LSTM from zero state over the pooled columns, mean of its outputs */
+static void run_lstm(const float *input, float *mean)
+{
+    float hidden[STREAM_MODEL_MAX_UNITS];
+    float cell[STREAM_MODEL_MAX_UNITS];
+    float gates[LSTM_GATES][STREAM_MODEL_MAX_UNITS];
+
+    memset(hidden, 0, sizeof(hidden));
+    memset(cell, 0, sizeof(cell));
+    memset(mean, 0, lstm.units * sizeof(float));
+
+    for (int t = 0; t < lstm.steps; t++)
+    {
+        const float *x = &input[t * lstm.inputs];
+
+        for (int g = 0; g < LSTM_GATES; g++)
+        {
+            for (int u = 0; u < lstm.units; u++)
+            {
+                float dot_input;
+                float dot_recurrent;
+
+                arm_dot_prod_f32(x, &lstm.input_weights[g][u * lstm.inputs], lstm.inputs, &dot_input);
+                arm_dot_prod_f32(hidden, &lstm.recurrent_weights[g][u * lstm.units], lstm.units, &dot_recurrent);
+                gates[g][u] = lstm.bias[g][u] + dot_input + dot_recurrent;
+            }
+        }
+
+        for (int u = 0; u < lstm.units; u++)
+        {
+            float input_gate = 1.0f / (1.0f + expf(-gates[0][u]));
+            float forget_gate = 1.0f / (1.0f + expf(-gates[1][u]));
+            float cell_gate = tanhf(gates[2][u]);
+            float output_gate = 1.0f / (1.0f + expf(-gates[3][u]));
+
+            cell[u] = forget_gate * cell[u] + input_gate * cell_gate;
+            if (lstm.cell_clip > 0.0f)
+            {
+                cell[u] = fminf(fmaxf(cell[u], -lstm.cell_clip), lstm.cell_clip);
+            }
+            hidden[u] = output_gate * tanhf(cell[u]);
+            mean[u] += hidden[u];
+        }
+    }
+
+    for (int u = 0; u < lstm.units; u++)
+    {
+        mean[u] /= lstm.steps;
+    }
+}
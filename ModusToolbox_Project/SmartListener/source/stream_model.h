@@ -0,0 +1,52 @@
+/*
+ * stream_model.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_STREAM_MODEL_H_
+#define SOURCE_STREAM_MODEL_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* 1 runs the model windows with stream_model_run() instead of the ML
+ * middleware, see stream_model.c */
+#ifndef MODEL_STREAMING_ENABLE
+#define MODEL_STREAMING_ENABLE              (0)
+#endif
+
+/* Bytes for the layer caches and the working buffers of the network */
+#define STREAM_MODEL_MEMORY_SIZE            (25600)
+
+/* Largest supported network */
+#define STREAM_MODEL_MAX_LAYERS             (8)     /* CONV_2D and MAX_POOL_2D */
+#define STREAM_MODEL_MAX_TAPS               (8)     /* Kernel width */
+#define STREAM_MODEL_MAX_PERIOD             (4)     /* Caches per CONV_2D layer */
+#define STREAM_MODEL_MAX_UNITS              (64)    /* LSTM units */
+#define STREAM_MODEL_MAX_OUTPUTS            (16)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+typedef struct {
+    uint32_t runs;                  /* Windows evaluated */
+    uint32_t full_runs;             /* Windows without any cached column */
+    uint64_t conv_macs;             /* Multiply-accumulates of the CONV_2D layers */
+    uint64_t conv_batch_macs;       /* The same without the caches */
+} stream_model_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int stream_model_init(const void *model_bin, uint32_t model_size, int window_stride);
+void stream_model_reset(void);
+void stream_model_run(const float *window, uint32_t index, float *scores);
+void stream_model_get_stats(stream_model_stats_t *stats);
+
+
+#endif /* SOURCE_STREAM_MODEL_H_ */
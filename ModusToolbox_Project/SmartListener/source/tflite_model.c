@@ -0,0 +1,428 @@
+/*
+ * tflite_model.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ *
+ * Read-only access to the tensors and operators of a TFLite model flatbuffer
+ * (the _K14 array of the generated model code), without the flatbuffers
+ * library. Tensor data is returned as pointers into the model, nothing is
+ * copied. Every offset is checked against the model size, so a damaged model
+ * is reported instead of read out of bounds.
+ *
+ * Only the parts of the schema that the model uses are read: the first
+ * subgraph, its tensors (shape, type, buffer, name), its operators (builtin
+ * code, inputs, outputs, builtin options) and the buffers.
+ */
+
+#include "tflite_model.h"
+
+#include <stddef.h>
+#include <string.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Fields of the schema tables */
+#define MODEL_OPERATOR_CODES            (1)
+#define MODEL_SUBGRAPHS                 (2)
+#define MODEL_BUFFERS                   (4)
+#define SUBGRAPH_TENSORS                (0)
+#define SUBGRAPH_INPUTS                 (1)
+#define SUBGRAPH_OUTPUTS                (2)
+#define SUBGRAPH_OPERATORS              (3)
+#define TENSOR_SHAPE                    (0)
+#define TENSOR_TYPE                     (1)
+#define TENSOR_BUFFER                   (2)
+#define TENSOR_NAME                     (3)
+#define BUFFER_DATA                     (0)
+#define OPERATOR_CODE_DEPRECATED        (0)
+#define OPERATOR_CODE_BUILTIN           (3)
+#define OPERATOR_OPCODE_INDEX           (0)
+#define OPERATOR_INPUTS                 (1)
+#define OPERATOR_OUTPUTS                (2)
+#define OPERATOR_OPTIONS                (4)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int in_bounds(const tflite_model_t *model, uint32_t offset, uint32_t bytes);
+static uint32_t read_u32(const tflite_model_t *model, uint32_t offset);
+static uint32_t field_offset(const tflite_model_t *model, uint32_t table, int field);
+static uint32_t field_table(const tflite_model_t *model, uint32_t table, int field);
+static uint32_t field_vector(const tflite_model_t *model, uint32_t table, int field, int *count);
+static uint32_t vector_table(const tflite_model_t *model, uint32_t vector, int count, int index);
+static int read_int_vector(const tflite_model_t *model, uint32_t table, int field, int32_t *values, int max);
+
+
+/*******************************************************************************
+* Function Name: tflite_model_open
+********************************************************************************
+* Summary:
+*    Locates the first subgraph of a model flatbuffer.
+*
+* Parameters:
+*    model          Handle to fill
+*    bin            Model flatbuffer, 4 byte aligned
+*    size           Bytes of the flatbuffer
+*
+* Return:
+*    0 on success, -1 if the flatbuffer is not a TFLite model
+*
+*******************************************************************************/
+int tflite_model_open(tflite_model_t *model, const void *bin, uint32_t size)
+{
+    uint32_t root;
+    uint32_t subgraphs;
+    uint32_t subgraph;
+    int32_t io[1];
+    int count;
+
+    memset(model, 0, sizeof(*model));
+    model->bin = (const uint8_t *)bin;
+    model->size = size;
+
+    /* Root table offset and the "TFL3" file identifier */
+    if ((size < 8) || (memcmp(&model->bin[4], "TFL3", 4) != 0))
+    {
+        return -1;
+    }
+    root = read_u32(model, 0);
+
+    model->operator_codes = field_vector(model, root, MODEL_OPERATOR_CODES, &model->operator_code_count);
+    model->buffers = field_vector(model, root, MODEL_BUFFERS, &model->buffer_count);
+    subgraphs = field_vector(model, root, MODEL_SUBGRAPHS, &count);
+    subgraph = vector_table(model, subgraphs, count, 0);
+    if ((model->operator_codes == 0) || (model->buffers == 0) || (subgraph == 0))
+    {
+        return -1;
+    }
+
+    model->tensors = field_vector(model, subgraph, SUBGRAPH_TENSORS, &model->tensor_count);
+    model->operators = field_vector(model, subgraph, SUBGRAPH_OPERATORS, &model->operator_count);
+    if ((model->tensors == 0) || (model->operators == 0))
+    {
+        return -1;
+    }
+
+    if (read_int_vector(model, subgraph, SUBGRAPH_INPUTS, io, 1) < 1)
+    {
+        return -1;
+    }
+    model->input = io[0];
+    if (read_int_vector(model, subgraph, SUBGRAPH_OUTPUTS, io, 1) < 1)
+    {
+        return -1;
+    }
+    model->output = io[0];
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: tflite_model_get_tensor
+********************************************************************************
+* Summary:
+*    Returns the shape, type and data of a tensor of the first subgraph.
+*
+* Parameters:
+*    model          Handle from tflite_model_open()
+*    index          Tensor index
+*    tensor         Tensor to fill
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int tflite_model_get_tensor(const tflite_model_t *model, int index, tflite_tensor_t *tensor)
+{
+    uint32_t table = vector_table(model, model->tensors, model->tensor_count, index);
+    uint32_t offset;
+    int count;
+
+    memset(tensor, 0, sizeof(*tensor));
+    if (table == 0)
+    {
+        return -1;
+    }
+
+    tensor->dims = read_int_vector(model, table, TENSOR_SHAPE, tensor->shape, TFLITE_MAX_DIMS);
+    if (tensor->dims < 0)
+    {
+        return -1;
+    }
+
+    offset = field_offset(model, table, TENSOR_TYPE);
+    tensor->type = (offset != 0) ? (int8_t)model->bin[offset] : TFLITE_TYPE_FLOAT32;
+
+    offset = field_offset(model, table, TENSOR_NAME);
+    if ((offset != 0) && in_bounds(model, offset + read_u32(model, offset), 4))
+    {
+        tensor->name = (const char *)&model->bin[offset + read_u32(model, offset) + 4];
+    }
+
+    /* Buffer 0 is the empty buffer of activations */
+    offset = field_offset(model, table, TENSOR_BUFFER);
+    if (offset != 0)
+    {
+        uint32_t buffer = vector_table(model, model->buffers, model->buffer_count, (int)read_u32(model, offset));
+        uint32_t data;
+
+        if (buffer == 0)
+        {
+            return -1;
+        }
+        data = field_vector(model, buffer, BUFFER_DATA, &count);
+        if ((data != 0) && (count > 0))
+        {
+            tensor->data = &model->bin[data];
+            tensor->bytes = (uint32_t)count;
+        }
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: tflite_model_get_operator
+********************************************************************************
+* Summary:
+*    Returns the builtin code, operands and options of an operator of the
+*    first subgraph, in execution order.
+*
+* Parameters:
+*    model          Handle from tflite_model_open()
+*    index          Operator index
+*    op             Operator to fill
+*
+* Return:
+*    0 on success, -1 on error
+*
+*******************************************************************************/
+int tflite_model_get_operator(const tflite_model_t *model, int index, tflite_operator_t *op)
+{
+    uint32_t table = vector_table(model, model->operators, model->operator_count, index);
+    uint32_t code_table;
+    uint32_t offset;
+    int32_t operands[TFLITE_MAX_OPERANDS];
+
+    memset(op, 0, sizeof(*op));
+    if (table == 0)
+    {
+        return -1;
+    }
+
+    /* The builtin code moved from a byte field to an int field in schema 3a,
+     * converters write both and the larger one is valid */
+    offset = field_offset(model, table, OPERATOR_OPCODE_INDEX);
+    code_table = vector_table(model, model->operator_codes, model->operator_code_count,
+                              (offset != 0) ? (int)read_u32(model, offset) : 0);
+    if (code_table == 0)
+    {
+        return -1;
+    }
+    offset = field_offset(model, code_table, OPERATOR_CODE_DEPRECATED);
+    op->code = (offset != 0) ? (int8_t)model->bin[offset] : 0;
+    offset = field_offset(model, code_table, OPERATOR_CODE_BUILTIN);
+    if ((offset != 0) && ((int32_t)read_u32(model, offset) > op->code))
+    {
+        op->code = (int32_t)read_u32(model, offset);
+    }
+
+    op->input_count = read_int_vector(model, table, OPERATOR_INPUTS, operands, TFLITE_MAX_OPERANDS);
+    for (int i = 0; i < op->input_count; i++)
+    {
+        op->inputs[i] = operands[i];
+    }
+    op->output_count = read_int_vector(model, table, OPERATOR_OUTPUTS, operands, TFLITE_MAX_OPERANDS);
+    for (int i = 0; i < op->output_count; i++)
+    {
+        op->outputs[i] = operands[i];
+    }
+    if ((op->input_count < 0) || (op->output_count < 1))
+    {
+        return -1;
+    }
+
+    op->options = field_table(model, table, OPERATOR_OPTIONS);
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: tflite_option_byte
+********************************************************************************
+* Summary:
+*    Reads a byte field (padding, activation, bool) of the builtin options of
+*    an operator. tflite_option_int() and tflite_option_float() read 32-bit
+*    fields.
+*
+* Parameters:
+*    model          Handle from tflite_model_open()
+*    op             Operator from tflite_model_get_operator()
+*    field          Field index, TFLITE_CONV_PADDING etc.
+*    value          Value returned if the field is not stored (the default)
+*
+* Return:
+*    The field value
+*
+*******************************************************************************/
+int tflite_option_byte(const tflite_model_t *model, const tflite_operator_t *op, int field, int value)
+{
+    uint32_t offset = (op->options != 0) ? field_offset(model, op->options, field) : 0;
+
+    return (offset != 0) ? (int8_t)model->bin[offset] : value;
+}
+
+
+int32_t tflite_option_int(const tflite_model_t *model, const tflite_operator_t *op, int field, int32_t value)
+{
+    uint32_t offset = (op->options != 0) ? field_offset(model, op->options, field) : 0;
+
+    return ((offset != 0) && in_bounds(model, offset, 4)) ? (int32_t)read_u32(model, offset) : value;
+}
+
+
+float tflite_option_float(const tflite_model_t *model, const tflite_operator_t *op, int field, float value)
+{
+    uint32_t offset = (op->options != 0) ? field_offset(model, op->options, field) : 0;
+
+    if ((offset != 0) && in_bounds(model, offset, 4))
+    {
+        memcpy(&value, &model->bin[offset], sizeof(value));
+    }
+    return value;
+}
+
+
+int32_t tflite_tensor_elements(const tflite_tensor_t *tensor)
+{
+    int32_t elements = 1;
+
+    for (int i = 0; i < tensor->dims; i++)
+    {
+        elements *= tensor->shape[i];
+    }
+    return elements;
+}
+
+
+const char *tflite_operator_name(int code)
+{
+    static const char *const names[] = {
+        [TFLITE_OP_CONV_2D] = "CONV_2D", [TFLITE_OP_FULLY_CONNECTED] = "FULLY_CONNECTED",
+        [TFLITE_OP_MAX_POOL_2D] = "MAX_POOL_2D", [TFLITE_OP_RESHAPE] = "RESHAPE", [TFLITE_OP_SOFTMAX] = "SOFTMAX",
+        [TFLITE_OP_MEAN] = "MEAN", [TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM] = "UNIDIRECTIONAL_SEQUENCE_LSTM"
+    };
+
+    if ((code < 0) || (code >= (int)(sizeof(names) / sizeof(names[0]))) || (names[code] == NULL))
+    {
+        return "UNKNOWN";
+    }
+    return names[code];
+}
+
+
+static int in_bounds(const tflite_model_t *model, uint32_t offset, uint32_t bytes)
+{
+    return (offset <= model->size) && (bytes <= model->size - offset);
+}
+
+
+/* Little-endian, like the flatbuffer. 0 outside the model, which no valid
+ * offset can be. */
+static uint32_t read_u32(const tflite_model_t *model, uint32_t offset)
+{
+    uint32_t value;
+
+    if (!in_bounds(model, offset, 4))
+    {
+        return 0;
+    }
+    memcpy(&value, &model->bin[offset], sizeof(value));
+    return value;
+}
+
+
+/* Absolute offset of a table field, 0 if the field is not stored */
+static uint32_t field_offset(const tflite_model_t *model, uint32_t table, int field)
+{
+    uint32_t vtable = table - read_u32(model, table);
+    uint16_t vtable_size;
+    uint16_t offset;
+
+    if ((table == 0) || !in_bounds(model, vtable, 4))
+    {
+        return 0;
+    }
+    memcpy(&vtable_size, &model->bin[vtable], sizeof(vtable_size));
+    if (((uint32_t)(4 + 2 * field + 2) > vtable_size) || !in_bounds(model, vtable + 4 + 2 * field, 2))
+    {
+        return 0;
+    }
+    memcpy(&offset, &model->bin[vtable + 4 + 2 * field], sizeof(offset));
+    return ((offset != 0) && in_bounds(model, table + offset, 1)) ? table + offset : 0;
+}
+
+
+/* Table referenced by a field */
+static uint32_t field_table(const tflite_model_t *model, uint32_t table, int field)
+{
+    uint32_t offset = field_offset(model, table, field);
+
+    return ((offset != 0) && in_bounds(model, offset + read_u32(model, offset), 4)) ? offset + read_u32(model, offset) : 0;
+}
+
+
+/* First element of a vector field, its length in count */
+static uint32_t field_vector(const tflite_model_t *model, uint32_t table, int field, int *count)
+{
+    uint32_t vector = field_table(model, table, field);
+
+    *count = 0;
+    if ((vector == 0) || (read_u32(model, vector) > model->size) || !in_bounds(model, vector + 4, read_u32(model, vector)))
+    {
+        return 0;
+    }
+    *count = (int)read_u32(model, vector);
+    return vector + 4;
+}
+
+
+/* Table at an index of a vector of tables */
+static uint32_t vector_table(const tflite_model_t *model, uint32_t vector, int count, int index)
+{
+    uint32_t element;
+
+    if ((vector == 0) || (index < 0) || (index >= count))
+    {
+        return 0;
+    }
+    element = vector + 4 * (uint32_t)index;
+    if (!in_bounds(model, element, 4) || !in_bounds(model, element + read_u32(model, element), 4))
+    {
+        return 0;
+    }
+    return element + read_u32(model, element);
+}
+
+
+/* Vector of int32 values, returns the length or -1 if it is longer than max */
+static int read_int_vector(const tflite_model_t *model, uint32_t table, int field, int32_t *values, int max)
+{
+    int count;
+    uint32_t vector = field_vector(model, table, field, &count);
+
+    if ((count > max) || ((vector != 0) && !in_bounds(model, vector, 4 * (uint32_t)count)))
+    {
+        return -1;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        values[i] = (int32_t)read_u32(model, vector + 4 * (uint32_t)i);
+    }
+    return count;
+}
@@ -0,0 +1,120 @@
+/*
+ * tflite_model.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Bedair
+ */
+
+#ifndef SOURCE_TFLITE_MODEL_H_
+#define SOURCE_TFLITE_MODEL_H_
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Builtin operator codes of the TFLite schema that the model uses */
+#define TFLITE_OP_CONV_2D                       (3)
+#define TFLITE_OP_FULLY_CONNECTED               (9)
+#define TFLITE_OP_MAX_POOL_2D                   (17)
+#define TFLITE_OP_RESHAPE                       (22)
+#define TFLITE_OP_SOFTMAX                       (25)
+#define TFLITE_OP_MEAN                          (40)
+#define TFLITE_OP_UNIDIRECTIONAL_SEQUENCE_LSTM  (44)
+
+/* Tensor types */
+#define TFLITE_TYPE_FLOAT32                     (0)
+#define TFLITE_TYPE_INT32                       (2)
+#define TFLITE_TYPE_INT8                        (9)
+
+/* Option fields, in schema order. Padding, activation and bool fields are
+ * bytes, strides, sizes and dilations 32-bit integers, clips and beta float. */
+#define TFLITE_CONV_PADDING                     (0)
+#define TFLITE_CONV_STRIDE_W                    (1)
+#define TFLITE_CONV_STRIDE_H                    (2)
+#define TFLITE_CONV_ACTIVATION                  (3)
+#define TFLITE_CONV_DILATION_W                  (4)
+#define TFLITE_CONV_DILATION_H                  (5)
+#define TFLITE_POOL_PADDING                     (0)
+#define TFLITE_POOL_STRIDE_W                    (1)
+#define TFLITE_POOL_STRIDE_H                    (2)
+#define TFLITE_POOL_FILTER_W                    (3)
+#define TFLITE_POOL_FILTER_H                    (4)
+#define TFLITE_POOL_ACTIVATION                  (5)
+#define TFLITE_FC_ACTIVATION                    (0)
+#define TFLITE_LSTM_ACTIVATION                  (0)
+#define TFLITE_LSTM_CELL_CLIP                   (1)
+#define TFLITE_LSTM_PROJ_CLIP                   (2)
+#define TFLITE_LSTM_TIME_MAJOR                  (3)
+#define TFLITE_MEAN_KEEP_DIMS                   (0)
+#define TFLITE_SOFTMAX_BETA                     (0)
+
+/* Option values */
+#define TFLITE_PADDING_SAME                     (0)
+#define TFLITE_PADDING_VALID                    (1)
+#define TFLITE_ACTIVATION_NONE                  (0)
+#define TFLITE_ACTIVATION_RELU                  (1)
+#define TFLITE_ACTIVATION_RELU_N1_TO_1          (2)
+#define TFLITE_ACTIVATION_RELU6                 (3)
+#define TFLITE_ACTIVATION_TANH                  (4)
+
+#define TFLITE_MAX_DIMS                         (5)
+#define TFLITE_MAX_OPERANDS                     (24)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* First subgraph of a model flatbuffer, the model stays where it is */
+typedef struct {
+    const uint8_t *bin;
+    uint32_t size;
+    uint32_t tensors;               /* Vectors of the subgraph table */
+    uint32_t operators;
+    uint32_t buffers;               /* Vectors of the model table */
+    uint32_t operator_codes;
+    int tensor_count;
+    int operator_count;
+    int buffer_count;
+    int operator_code_count;
+    int input;                      /* First input and output tensor */
+    int output;
+} tflite_model_t;
+
+typedef struct {
+    int dims;
+    int32_t shape[TFLITE_MAX_DIMS];
+    int type;
+    const void *data;               /* NULL for activations */
+    uint32_t bytes;
+    const char *name;
+} tflite_tensor_t;
+
+typedef struct {
+    int code;                       /* TFLITE_OP_* */
+    int input_count;
+    int output_count;
+    int inputs[TFLITE_MAX_OPERANDS];  /* -1 for an omitted optional input */
+    int outputs[TFLITE_MAX_OPERANDS];
+    uint32_t options;               /* Builtin options table, 0 if there is none */
+} tflite_operator_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int tflite_model_open(tflite_model_t *model, const void *bin, uint32_t size);
+int tflite_model_get_tensor(const tflite_model_t *model, int index, tflite_tensor_t *tensor);
+int tflite_model_get_operator(const tflite_model_t *model, int index, tflite_operator_t *op);
+
+int tflite_option_byte(const tflite_model_t *model, const tflite_operator_t *op, int field, int value);
+int32_t tflite_option_int(const tflite_model_t *model, const tflite_operator_t *op, int field, int32_t value);
+float tflite_option_float(const tflite_model_t *model, const tflite_operator_t *op, int field, float value);
+
+/* Number of elements of a tensor */
+int32_t tflite_tensor_elements(const tflite_tensor_t *tensor);
+
+/* Name of a TFLITE_OP_* code as in the TFLite schema, "UNKNOWN" for the others */
+const char *tflite_operator_name(int code);
+
+
+#endif /* SOURCE_TFLITE_MODEL_H_ */